@@ -0,0 +1,238 @@
+// Micro benchmarks for the field arithmetic backends
+//
+//     make bench
+//
+//     Times field_mul/field_sq, the Fp square roots, the Legendre symbol and the group (generate_pubkey, generate_pubkeys (per key), scalar_mul, scalar_mul_batch (per point), 256 point msm), Poseidon (single and poseidon_hash_many, per hash),
+//     sign, verify and verify_batch (per signature) workloads on top of them, once per available
+//     backend (see set_backend).
+
+#include <stdio.h>
+#include <time.h>
+#include <inttypes.h>
+
+#include "pasta_fp.h"
+#include "crypto.h"
+#include "poseidon.h"
+
+#define DEFAULT_TOKEN_ID 1
+
+static const char *BACKEND_NAMES[] = { "fiat", "sparse", "adx" };
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, const size_t iterations, const double start)
+{
+    const double elapsed = now() - start;
+    printf("  %-16s %10.3f us/op  (%zu ops)\n", name, 1e6 * elapsed / iterations, iterations);
+}
+
+static void prepare_transaction(Transaction *txn)
+{
+    prepare_memo(txn->memo, "this is a memo");
+    txn->fee = 3;
+    txn->fee_token = DEFAULT_TOKEN_ID;
+    read_public_key_compressed(&txn->fee_payer_pk, "B62qiy32p8kAKnny8ZFwoMhYpBppM1DWVCqAPBYNcXnsAHhnfAAuXgg");
+    txn->nonce = 200;
+    txn->valid_until = 10000;
+    txn->tag[0] = 0;
+    txn->tag[1] = 0;
+    txn->tag[2] = 0;
+    read_public_key_compressed(&txn->source_pk, "B62qiy32p8kAKnny8ZFwoMhYpBppM1DWVCqAPBYNcXnsAHhnfAAuXgg");
+    read_public_key_compressed(&txn->receiver_pk, "B62qrcFstkpqXww1EkSGrqMCwCNho86kuqBd4FrAAUsPxNKdiPzAUsy");
+    txn->token_id = DEFAULT_TOKEN_ID;
+    txn->amount = 42;
+    txn->token_locked = false;
+}
+
+static void bench_backend(void)
+{
+    double start;
+    Field a = { 0x1ea1cbbee4f3dc9c, 0x2e0f1cb0bc5b1a8f, 0x3b5f9d1a6e23b58d, 0x0b2c4a3d5e6f7081 };
+    Field b = { 0x3a91b4a3c3e8c1f5, 0x7d6c2b1a09f8e7d6, 0x1c2d3e4f50617283, 0x1234567890abcdef };
+
+    start = now();
+    for (size_t i = 0; i < 1000000; i++) {
+        field_mul(a, a, b);
+    }
+    report("field_mul", 1000000, start);
+
+    start = now();
+    for (size_t i = 0; i < 1000000; i++) {
+        field_sq(a, a);
+    }
+    report("field_sq", 1000000, start);
+
+    Field square;
+    field_sq(square, a);
+    start = now();
+    for (size_t i = 0; i < 2000; i++) {
+        fiat_pasta_fp_sqrt_ts(b, square);
+    }
+    report("sqrt (t-s)", 2000, start);
+
+    start = now();
+    for (size_t i = 0; i < 2000; i++) {
+        fiat_pasta_fp_sqrt(b, square);
+    }
+    report("sqrt", 2000, start);
+
+    start = now();
+    for (size_t i = 0; i < 2000; i++) {
+        fiat_pasta_fp_sqrt_ct(b, square);
+    }
+    report("sqrt (ct)", 2000, start);
+
+    const uint64_t p_minus_1_over_2[4] = { 0xcc96987680000000, 0x11234c7e04a67c8d, 0x0, 0x2000000000000000 };
+    start = now();
+    for (size_t i = 0; i < 2000; i++) {
+        fiat_pasta_fp_pow(b, square, p_minus_1_over_2);
+    }
+    report("legendre (pow)", 2000, start);
+
+    start = now();
+    for (size_t i = 0; i < 2000; i++) {
+        fiat_pasta_fp_legendre(a);
+    }
+    report("legendre", 2000, start);
+
+    Scalar priv_key = { 0xca14d6eed923f6e3, 0x61185a1b5e29e6b2, 0xe26d38de9c30753b, 0x3fdf0efb0a5714 };
+    Keypair kp;
+    start = now();
+    for (size_t i = 0; i < 200; i++) {
+        generate_pubkey(&kp.pub, priv_key);
+    }
+    report("generate_pubkey", 200, start);
+    scalar_copy(kp.priv, priv_key);
+
+    static Scalar batch_keys[64];
+    static Affine batch_pub_keys[64];
+    for (size_t i = 0; i < 64; i++) {
+        scalar_mul(batch_keys[i], i ? batch_keys[i - 1] : priv_key, priv_key);
+    }
+    start = now();
+    for (size_t i = 0; i < 4; i++) {
+        generate_pubkeys(batch_pub_keys, batch_keys, 64);
+    }
+    report("generate_pubkeys", 4 * 64, start);
+
+    Affine point;
+    start = now();
+    for (size_t i = 0; i < 200; i++) {
+        affine_scalar_mul(&point, priv_key, &kp.pub);
+    }
+    report("scalar_mul", 200, start);
+
+    static Scalar msm_k[256];
+    static Affine msm_P[256];
+    for (size_t i = 0; i < 256; i++) {
+        scalar_mul(msm_k[i], i ? msm_k[i - 1] : priv_key, priv_key);
+        generate_pubkey(&msm_P[i], msm_k[i]);
+    }
+    Group msm_out;
+    start = now();
+    for (size_t i = 0; i < 20; i++) {
+        group_msm(&msm_out, msm_k, msm_P, 256);
+    }
+    report("msm (per point)", 20 * 256, start);
+
+    static Affine batch_points[64];
+    start = now();
+    for (size_t i = 0; i < 4; i++) {
+        affine_scalar_mul_batch(batch_points, msm_k, msm_P, 64);
+    }
+    report("scalar_mul_batch", 4 * 64, start);
+
+    PoseidonCtx ctx;
+    Field input[8];
+    for (size_t i = 0; i < 8; i++) {
+        field_copy(input[i], i & 1 ? a : b);
+    }
+    Scalar out;
+    start = now();
+    for (size_t i = 0; i < 200; i++) {
+        poseidon_init(&ctx, POSEIDON_LEGACY, NULLNET_ID);
+        poseidon_update(&ctx, input, 8);
+        poseidon_digest(out, &ctx);
+    }
+    report("poseidon legacy", 200, start);
+
+    start = now();
+    for (size_t i = 0; i < 200; i++) {
+        poseidon_init(&ctx, POSEIDON_KIMCHI, NULLNET_ID);
+        poseidon_update(&ctx, input, 8);
+        poseidon_digest(out, &ctx);
+    }
+    report("poseidon kimchi", 200, start);
+
+    const Field *many_inputs[64];
+    size_t many_lens[64];
+    static Scalar many_out[64];
+    for (size_t i = 0; i < 64; i++) {
+        many_inputs[i] = input;
+        many_lens[i] = 8;
+    }
+    start = now();
+    for (size_t i = 0; i < 4; i++) {
+        poseidon_hash_many(many_out, many_inputs, many_lens, 64, POSEIDON_LEGACY, NULLNET_ID);
+    }
+    report("poseidon many", 4 * 64, start);
+
+    Transaction txn;
+    prepare_transaction(&txn);
+    Compressed pub_compressed;
+    compress(&pub_compressed, &kp.pub);
+    Signature sig;
+    start = now();
+    for (size_t i = 0; i < 100; i++) {
+        sign(&sig, &kp, &txn, TESTNET_ID);
+    }
+    report("sign", 100, start);
+
+    start = now();
+    for (size_t i = 0; i < 100; i++) {
+        if (!verify(&sig, &pub_compressed, &txn, TESTNET_ID)) {
+            fprintf(stderr, "verify failed\n");
+            exit(1);
+        }
+    }
+    report("verify", 100, start);
+
+    static Signature batch_sigs[64];
+    static Compressed batch_pubs[64];
+    static Transaction batch_txns[64];
+    for (size_t i = 0; i < 64; i++) {
+        batch_txns[i] = txn;
+        batch_txns[i].amount = 1000 + i;
+        batch_pubs[i] = pub_compressed;
+        sign(&batch_sigs[i], &kp, &batch_txns[i], TESTNET_ID);
+    }
+    start = now();
+    for (size_t i = 0; i < 4; i++) {
+        if (!verify_batch(NULL, batch_sigs, batch_pubs, batch_txns, 64, TESTNET_ID)) {
+            fprintf(stderr, "verify_batch failed\n");
+            exit(1);
+        }
+    }
+    report("verify_batch", 4 * 64, start);
+}
+
+int main(void)
+{
+    const Backend backends[] = { BACKEND_FIAT, BACKEND_SPARSE, BACKEND_ADX };
+
+    for (size_t i = 0; i < sizeof(backends)/sizeof(backends[0]); i++) {
+        if (!set_backend(backends[i])) {
+            printf("%s: not supported\n", BACKEND_NAMES[backends[i]]);
+            continue;
+        }
+        printf("%s:\n", BACKEND_NAMES[backends[i]]);
+        bench_backend();
+    }
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+// comb_tables_gen.c - generates pasta_comb_tables.h
+//
+//     make comb_tables
+//
+//     Fixed-base (Lim-Lee comb) tables for the Pallas generator G, used by
+//     the fixed-base scalar multiplication in crypto.c.  The scalar bits
+//     are arranged as COMB_TEETH teeth of COMB_SPACING bits, each tooth cut
+//     into COMB_BLOCKS blocks of COMB_BLOCK_BITS bits, so that bit
+//
+//         j = COMB_SPACING * i + COMB_BLOCK_BITS * b + c
+//
+//     belongs to tooth i, block b and column c.  For every block b and
+//     non-zero mask of teeth
+//
+//         COMB_TABLE[b][mask - 1] = sum_{i in mask} 2^(COMB_SPACING * i + COMB_BLOCK_BITS * b) * G
+//
+//     It also generates the signed comb of the constant time
+//     multiplication, with the same teeth but COMB_SIGNED_BLOCKS blocks of
+//     COMB_SIGNED_BLOCK_BITS bits (fewer doublings for the same additions).
+//     Every bit of the (odd) scalar stands for a digit +-1 there and the
+//     top tooth gives the sign of the whole entry: for the lower teeth i
+//
+//         COMB_SIGNED_TABLE[b][i] = 2^(COMB_SPACING * (COMB_TEETH - 1) + COMB_SIGNED_BLOCK_BITS * b) * G
+//             + sum_{t < COMB_TEETH - 1} (bit t of i ? 1 : -1) * 2^(COMB_SPACING * t + COMB_SIGNED_BLOCK_BITS * b) * G
+//
+//     The points are computed with the (generic) public affine API.
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "crypto.h"
+
+#define COMB_TEETH 8
+#define COMB_BLOCKS 4
+#define COMB_BLOCK_BITS 8
+#define COMB_SPACING (COMB_BLOCKS * COMB_BLOCK_BITS)
+
+#if COMB_TEETH * COMB_SPACING < FIELD_SIZE_IN_BITS
+#error "comb does not cover the scalar"
+#endif
+
+#define COMB_SIGNED_BLOCKS 8
+#define COMB_SIGNED_BLOCK_BITS 4
+#define COMB_SIGNED_ENTRIES (1 << (COMB_TEETH - 1))
+
+#if COMB_SIGNED_BLOCKS * COMB_SIGNED_BLOCK_BITS != COMB_SPACING
+#error "signed comb blocks do not cover the teeth"
+#endif
+
+static void print_affine(const Affine *a)
+{
+    printf("        {{ ");
+    for (size_t i = 0; i < LIMBS_PER_FIELD; i++) {
+        printf("0x%016" PRIx64 "%s", a->x[i], i + 1 < LIMBS_PER_FIELD ? ", " : " }, { ");
+    }
+    for (size_t i = 0; i < LIMBS_PER_FIELD; i++) {
+        printf("0x%016" PRIx64 "%s", a->y[i], i + 1 < LIMBS_PER_FIELD ? ", " : " }},\n");
+    }
+}
+
+// G (as AFFINE_ONE in crypto.c, which itself uses these tables)
+static const Affine GENERATOR = {
+    {
+        0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff
+    },
+    {
+        0x2f474795455d409d, 0xb443b9b74b8255d9, 0x270c412f2c9a5d66, 0x8e00f71ba43dd6b
+    }
+};
+
+// teeth[i] = 2^(COMB_SPACING * i) * g
+static void comb_teeth(Affine teeth[COMB_TEETH], const Affine *g)
+{
+    teeth[0] = *g;
+    for (size_t i = 1; i < COMB_TEETH; i++) {
+        teeth[i] = teeth[i - 1];
+        for (size_t j = 0; j < COMB_SPACING; j++) {
+            affine_add(&teeth[i], &teeth[i], &teeth[i]);
+        }
+    }
+}
+
+int main(void)
+{
+    // g = 2^(COMB_BLOCK_BITS * b) * G at the start of block b
+    Affine g = GENERATOR, teeth[COMB_TEETH];
+
+    printf("// pasta_comb_tables.h - fixed-base comb tables for the Pallas generator\n");
+    printf("//\n");
+    printf("//    These constants were generated by comb_tables_gen.c\n");
+    printf("//    Generate: make comb_tables\n");
+    printf("//    Do not edit this file\n");
+    printf("\n");
+    printf("#pragma once\n");
+    printf("\n");
+    printf("#include \"crypto.h\"\n");
+    printf("\n");
+    printf("#define COMB_TEETH %u\n", COMB_TEETH);
+    printf("#define COMB_BLOCKS %u\n", COMB_BLOCKS);
+    printf("#define COMB_BLOCK_BITS %u\n", COMB_BLOCK_BITS);
+    printf("#define COMB_SPACING (COMB_BLOCKS * COMB_BLOCK_BITS)\n");
+    printf("\n");
+    printf("// COMB_TABLE[b][mask - 1] = sum_{i in mask} 2^(COMB_SPACING * i + COMB_BLOCK_BITS * b) * G\n");
+    printf("static const Affine COMB_TABLE[COMB_BLOCKS][(1 << COMB_TEETH) - 1] = {\n");
+
+    for (size_t b = 0; b < COMB_BLOCKS; b++) {
+        comb_teeth(teeth, &g);
+
+        Affine table[(1 << COMB_TEETH) - 1];
+        for (size_t mask = 1; mask < (1 << COMB_TEETH); mask++) {
+            // add the highest tooth of mask to the entry without it
+            size_t top = COMB_TEETH - 1;
+            while (!(mask & (1 << top))) {
+                top--;
+            }
+            const size_t rest = mask & ~(1 << top);
+            if (rest == 0) {
+                table[mask - 1] = teeth[top];
+            }
+            else {
+                affine_add(&table[mask - 1], &table[rest - 1], &teeth[top]);
+            }
+        }
+
+        printf("    {\n");
+        for (size_t mask = 1; mask < (1 << COMB_TEETH); mask++) {
+            print_affine(&table[mask - 1]);
+        }
+        printf("    },\n");
+
+        for (size_t j = 0; j < COMB_BLOCK_BITS; j++) {
+            affine_add(&g, &g, &g);
+        }
+    }
+
+    printf("};\n");
+
+    // g = 2^(COMB_SIGNED_BLOCK_BITS * b) * G at the start of block b
+    g = GENERATOR;
+    printf("\n");
+    printf("#define COMB_SIGNED_BLOCKS %u\n", COMB_SIGNED_BLOCKS);
+    printf("#define COMB_SIGNED_BLOCK_BITS %u\n", COMB_SIGNED_BLOCK_BITS);
+    printf("#define COMB_SIGNED_ENTRIES (1 << (COMB_TEETH - 1))\n");
+    printf("\n");
+    printf("// COMB_SIGNED_TABLE[b][i] = 2^(COMB_SPACING * (COMB_TEETH - 1) + COMB_SIGNED_BLOCK_BITS * b) * G\n");
+    printf("//     + sum_{t < COMB_TEETH - 1} (bit t of i ? 1 : -1) * 2^(COMB_SPACING * t + COMB_SIGNED_BLOCK_BITS * b) * G\n");
+    printf("static const Affine COMB_SIGNED_TABLE[COMB_SIGNED_BLOCKS][COMB_SIGNED_ENTRIES] = {\n");
+    for (size_t b = 0; b < COMB_SIGNED_BLOCKS; b++) {
+        comb_teeth(teeth, &g);
+
+        // entry 0 has all lower digits -1; entry i is the entry without
+        // the lowest bit of i plus twice that tooth
+        Affine table[COMB_SIGNED_ENTRIES], neg, twice;
+        table[0] = teeth[COMB_TEETH - 1];
+        for (size_t t = 0; t < COMB_TEETH - 1; t++) {
+            affine_negate(&neg, &teeth[t]);
+            affine_add(&table[0], &table[0], &neg);
+        }
+        for (size_t i = 1; i < COMB_SIGNED_ENTRIES; i++) {
+            size_t low = 0;
+            while (!(i & (1 << low))) {
+                low++;
+            }
+            affine_add(&twice, &teeth[low], &teeth[low]);
+            affine_add(&table[i], &table[i & (i - 1)], &twice);
+        }
+
+        printf("    {\n");
+        for (size_t i = 0; i < COMB_SIGNED_ENTRIES; i++) {
+            print_affine(&table[i]);
+        }
+        printf("    },\n");
+
+        for (size_t j = 0; j < COMB_SIGNED_BLOCK_BITS; j++) {
+            affine_add(&g, &g, &g);
+        }
+    }
+    printf("};\n");
+
+    return 0;
+}
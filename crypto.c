@@ -6,13 +6,19 @@
 //     * Signer reference here: https://github.com/MinaProtocol/signer-reference
 //
 //     * Curve arithmatic
+//         - set_backend, get_backend (fiat, sparse or x86-64 ADX field arithmetic)
 //         - field_add, field_sub, field_mul, field_sq, field_inv, field_negate, field_pow, field_eq
-//         - scalar_add, scalar_sub, scalar_mul, scalar_sq, scalar_pow, scalar_eq
-//         - group_add, group_dbl, group_scalar_mul (group elements use projective coordinates)
-//         - affine_scalar_mul
-//         - affine_from_group
-//         - generate_pubkey, generate_keypair
-//         - sign
+//         - field_is_square (binary GCD Legendre symbol)
+//         - scalar_add, scalar_sub, scalar_mul, scalar_sq, scalar_inv, scalar_pow, scalar_eq
+//         - group_add, group_dbl, group_negate, group_eq, group_is_on_curve, group_scalar_mul (GLV + wNAF)
+//           (group elements use jacobian coordinates and never invert)
+//         - affine_to_group, affine_from_group, group_batch_to_affine (one inversion, when serializing)
+//         - affine_add, affine_negate, affine_eq, affine_is_on_curve, affine_scalar_mul, affine_scalar_mul_batch
+//         - group4_dbl, group4_madd, projective4_madd (four points per instruction, pasta_avx2.h)
+//         - group_msm (Pippenger multi-scalar multiplication)
+//         - projective_add, projective_madd, projective_dbl (complete formulas for batch and constant time kernels)
+//         - generate_pubkey, generate_pubkeys, generate_keypair (constant time signed comb, pasta_comb_tables.h)
+//         - sign, verify, verify_batch
 //
 //     * Curve details
 //         Pasta.Pallas (https://github.com/zcash/pasta)
@@ -28,11 +34,23 @@
 #include <inttypes.h>
 #include <math.h>
 
+// group_msm spreads its windows over MSM_THREADS threads (0 disables threading)
+#ifndef MSM_THREADS
+#define MSM_THREADS 4
+#endif
+
+#if MSM_THREADS > 0
+#include <pthread.h>
+#endif
+
 #include "crypto.h"
 #include "utils.h"
 #include "poseidon.h"
 #include "pasta_fp.h"
 #include "pasta_fq.h"
+#include "pasta_inline.h"
+#include "pasta_avx2.h"
+#include "pasta_comb_tables.h"
 #include "blake2.h"
 #include "libbase58.h"
 #include "sha256.h"
@@ -45,15 +63,6 @@ static const Field GROUP_COEFF_B = {
 static const Field FIELD_ONE = {
   0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff
 };
-static const Field FIELD_THREE = {
-  0x6b0ee5d0fffffff5, 0x86f76d2b99b14bd0, 0xfffffffffffffffe, 0x3fffffffffffffff
-};
-static const Field FIELD_FOUR = {
-  0x65a221cfffffff1, 0xfddd093b747d6762, 0xfffffffffffffffd, 0x3fffffffffffffff
-};
-static const Field FIELD_EIGHT = {
-  0x7387134cffffffe1, 0xd973797adfadd5a8, 0xfffffffffffffffb, 0x3fffffffffffffff
-};
 static const Field FIELD_ZERO = { 0, 0, 0, 0 };
 static const Scalar SCALAR_ZERO = { 0, 0, 0, 0 };
 
@@ -87,40 +96,118 @@ bool field_from_hex(Field b, const char *hex) {
       return false;
   }
 
-  fiat_pasta_fp_to_montgomery(b, (uint64_t *)bytes);
+  pasta_fp_to_montgomery(b, (uint64_t *)bytes);
   return true;
 }
 
 void field_copy(Field c, const Field a)
 {
-    fiat_pasta_fp_copy(c, a);
+    pasta_fp_copy(c, a);
+}
+
+// Select the field arithmetic backend; returns false (and keeps the
+// current one) if it is not available on this CPU
+bool set_backend(Backend backend)
+{
+    switch (backend) {
+        case BACKEND_FIAT:
+            pasta_use_adx = false;
+            pasta_use_sparse = false;
+            return true;
+        case BACKEND_SPARSE:
+            pasta_use_adx = false;
+            pasta_use_sparse = true;
+            return true;
+        case BACKEND_ADX:
+            if (!pasta_x86_64_supported()) {
+                return false;
+            }
+            pasta_use_adx = true;
+            pasta_use_sparse = false;
+            return true;
+    }
+    return false;
+}
+
+Backend get_backend(void)
+{
+    if (pasta_use_adx) {
+        return BACKEND_ADX;
+    }
+    return pasta_use_sparse ? BACKEND_SPARSE : BACKEND_FIAT;
 }
 
 bool field_is_odd(const Field y)
 {
     uint64_t tmp[4];
-    fiat_pasta_fp_from_montgomery(tmp, y);
+    pasta_fp_from_montgomery(tmp, y);
     return tmp[0] & 1;
 }
 
+// Quadratic residuosity via the (binary GCD) Legendre symbol, much
+// cheaper than a square root; zero counts as a square
+bool field_is_square(const Field a)
+{
+    return fiat_pasta_fp_legendre(a) != -1;
+}
+
 void field_add(Field c, const Field a, const Field b)
 {
-    fiat_pasta_fp_add(c, a, b);
+    pasta_fp_add(c, a, b);
 }
 
 void field_sub(Field c, const Field a, const Field b)
 {
-    fiat_pasta_fp_sub(c, a, b);
+    pasta_fp_sub(c, a, b);
 }
 
 void field_mul(Field c, const Field a, const Field b)
 {
-    fiat_pasta_fp_mul(c, a, b);
+    pasta_fp_mul(c, a, b);
 }
 
 void field_sq(Field c, const Field a)
 {
-    fiat_pasta_fp_square(c, a);
+    pasta_fp_sq(c, a);
+}
+
+// Unreduced field elements (lazy reduction)
+//
+//     p < 2^254 leaves two spare bits in the representation, so a sum or
+//     difference that only feeds a multiplication can skip the conditional
+//     subtraction of field_add/field_sub.  The backends scan the rows of
+//     the Montgomery product over the second operand: for a reduced first
+//     operand a and any second operand b < R = 2^256 the running sum stays
+//     below a + p, so (a b + m p) / R < 2p and the final conditional
+//     subtraction returns a reduced product.  The first operand has no
+//     such slack on the sparse and ADX backends (anything from 2p up gives
+//     wrong products), so unreduced values are only ever passed second,
+//     through field_mul_unreduced, and are never squared.
+typedef uint64_t FieldUnreduced[LIMBS_PER_FIELD];
+
+// c = a + b < 2^256
+static void field_add_unreduced(FieldUnreduced c, const uint64_t a[4], const uint64_t b[4])
+{
+    pasta_fp_add_unreduced(c, a, b);
+}
+
+// c = a + p - b, for reduced b and a < 2^256 - p
+static void field_sub_unreduced(FieldUnreduced c, const uint64_t a[4], const Field b)
+{
+    pasta_fp_sub_unreduced(c, a, b);
+}
+
+// c = a * b, reduced, for a reduced a and any b < 2^256
+static void field_mul_unreduced(Field c, const Field a, const FieldUnreduced b)
+{
+    field_mul(c, a, b);
+}
+
+// c = k * a for a small integer constant k, without a multiplication by
+// the montgomery form of k
+static void field_mul_small(Field c, const Field a, const uint64_t k)
+{
+    pasta_fp_mul_small(c, a, k);
 }
 
 void field_pow(Field c, const Field a, const uint8_t b)
@@ -148,6 +235,47 @@ void field_inv(Field c, const Field a)
     fiat_pasta_fp_inv(c, a);
 }
 
+// Montgomery's batch inversion: out[i] = 1/in[i] for all i, costing
+// one inversion and 3(k - 1) multiplications for k non-zero entries.
+// Zero entries map to zero.  out doubles as the scratch buffer, so it
+// must not alias in.
+void field_batch_inv(Field *out, const Field *in, size_t n)
+{
+    // the product starts at the first non-zero entry
+    size_t first = 0;
+    while (first < n && fiat_pasta_fp_equals_zero(in[first])) {
+        field_copy(out[first], FIELD_ZERO);
+        first++;
+    }
+    if (first == n) {
+        return;
+    }
+
+    Field acc, tmp;
+    field_copy(acc, in[first]);
+
+    // out[i] = product of the non-zero in[j] for first <= j < i
+    for (size_t i = first + 1; i < n; i++) {
+        field_copy(out[i], acc);
+        if (!fiat_pasta_fp_equals_zero(in[i])) {
+            field_mul(acc, acc, in[i]);
+        }
+    }
+
+    field_inv(acc, acc);
+
+    for (size_t i = n - 1; i > first; i--) {
+        if (fiat_pasta_fp_equals_zero(in[i])) {
+            field_copy(out[i], FIELD_ZERO);
+            continue;
+        }
+        field_mul(tmp, acc, out[i]); // 1/in[i]
+        field_mul(acc, acc, in[i]);  // 1/(in[first] * ... * in[i - 1])
+        field_copy(out[i], tmp);
+    }
+    field_copy(out[first], acc);
+}
+
 void field_negate(Field c, const Field a)
 {
     fiat_pasta_fp_opp(c, a);
@@ -162,6 +290,17 @@ unsigned int field_eq(const Field a, const Field b)
     }
 }
 
+// Little-endian bytes to scalar, rejecting non-canonical encodings (>= q)
+bool scalar_from_bytes(Scalar b, const uint8_t bytes[SCALAR_BYTES])
+{
+    uint64_t tmp[4];
+    if (!fiat_pasta_fq_from_bytes_checked(tmp, bytes)) {
+        return false;
+    }
+    pasta_fq_to_montgomery(b, tmp);
+    return true;
+}
+
 bool scalar_from_hex(Field b, const char *hex) {
   if (strnlen(hex, 64) != 64) {
     return false;
@@ -175,7 +314,7 @@ bool scalar_from_hex(Field b, const char *hex) {
       return false;
   }
 
-  fiat_pasta_fq_to_montgomery(b, (uint64_t *)bytes);
+  pasta_fq_to_montgomery(b, (uint64_t *)bytes);
   return true;
 }
 
@@ -184,32 +323,90 @@ void scalar_from_words(Scalar b, const uint64_t words[4])
     uint64_t tmp[4];
     memcpy(tmp, words, sizeof(tmp));
     tmp[3] &= (((uint64_t)1 << 62) - 1); // drop top two bits
-    fiat_pasta_fq_to_montgomery(b, tmp);
+    pasta_fq_to_montgomery(b, tmp);
 }
 
 void scalar_copy(Scalar b, const Scalar a)
 {
-    fiat_pasta_fq_copy(b, a);
+    pasta_fq_copy(b, a);
 }
 
 void scalar_add(Scalar c, const Scalar a, const Scalar b)
 {
-    fiat_pasta_fq_add(c, a, b);
+    pasta_fq_add(c, a, b);
 }
 
 void scalar_sub(Scalar c, const Scalar a, const Scalar b)
 {
-    fiat_pasta_fq_sub(c, a, b);
+    pasta_fq_sub(c, a, b);
 }
 
 void scalar_mul(Scalar c, const Scalar a, const Scalar b)
 {
-    fiat_pasta_fq_mul(c, a, b);
+    pasta_fq_mul(c, a, b);
 }
 
 void scalar_sq(Scalar c, const Scalar a)
 {
-    fiat_pasta_fq_square(c, a);
+    pasta_fq_sq(c, a);
+}
+
+// c = a^e for an arbitrary (non-montgomery) 256-bit exponent e
+// Not constant time in e
+void scalar_pow(Scalar c, const Scalar a, const uint64_t e[4])
+{
+    fiat_pasta_fq_pow(c, a, e);
+}
+
+bool scalar_sqrt(Scalar c, const Scalar a)
+{
+    return fiat_pasta_fq_sqrt(c, a);
+}
+
+int scalar_legendre(const Scalar a)
+{
+    return fiat_pasta_fq_legendre(a);
+}
+
+void scalar_inv(Scalar c, const Scalar a)
+{
+    fiat_pasta_fq_inv(c, a);
+}
+
+// Montgomery's batch inversion, see field_batch_inv
+void scalar_batch_inv(Scalar *out, const Scalar *in, size_t n)
+{
+    size_t first = 0;
+    while (first < n && scalar_eq(in[first], SCALAR_ZERO)) {
+        scalar_copy(out[first], SCALAR_ZERO);
+        first++;
+    }
+    if (first == n) {
+        return;
+    }
+
+    Scalar acc, tmp;
+    scalar_copy(acc, in[first]);
+
+    for (size_t i = first + 1; i < n; i++) {
+        scalar_copy(out[i], acc);
+        if (!scalar_eq(in[i], SCALAR_ZERO)) {
+            scalar_mul(acc, acc, in[i]);
+        }
+    }
+
+    scalar_inv(acc, acc);
+
+    for (size_t i = n - 1; i > first; i--) {
+        if (scalar_eq(in[i], SCALAR_ZERO)) {
+            scalar_copy(out[i], SCALAR_ZERO);
+            continue;
+        }
+        scalar_mul(tmp, acc, out[i]);
+        scalar_mul(acc, acc, in[i]);
+        scalar_copy(out[i], tmp);
+    }
+    scalar_copy(out[first], acc);
 }
 
 void scalar_negate(Scalar c, const Scalar a)
@@ -223,19 +420,41 @@ bool scalar_eq(const Scalar a, const Scalar b)
 }
 
 // zero is the only point with Z = 0 in jacobian coordinates
-unsigned int is_zero(const Group *p)
+bool group_is_zero(const Group *p)
 {
     return field_eq(p->Z, FIELD_ZERO);
 }
 
+// p == q without inversions: X1 Z2^2 == X2 Z1^2 and Y1 Z2^3 == Y2 Z1^3
+bool group_eq(const Group *p, const Group *q)
+{
+    if (group_is_zero(p) || group_is_zero(q)) {
+        return group_is_zero(p) && group_is_zero(q);
+    }
+
+    Field z1z1, z2z2, a, b;
+    field_sq(z1z1, p->Z);
+    field_sq(z2z2, q->Z);
+    field_mul(a, p->X, z2z2);
+    field_mul(b, q->X, z1z1);
+    if (!field_eq(a, b)) {
+        return false;
+    }
+    field_mul(z2z2, z2z2, q->Z);
+    field_mul(z1z1, z1z1, p->Z);
+    field_mul(a, p->Y, z2z2);
+    field_mul(b, q->Y, z1z1);
+    return field_eq(a, b);
+}
+
 unsigned int affine_is_zero(const Affine *p)
 {
     return (field_eq(p->x, FIELD_ZERO) && field_eq(p->y, FIELD_ZERO));
 }
 
-unsigned int group_is_on_curve(const Group *p)
+bool group_is_on_curve(const Group *p)
 {
-    if (is_zero(p)) {
+    if (group_is_zero(p)) {
         return 1;
     }
 
@@ -296,16 +515,70 @@ void affine_from_group(Affine *r, const Group *p)
     field_mul(r->y, p->Y, zi3); // Y/Z^3
 }
 
+// Convert n points to affine with a single inversion (Montgomery's trick)
+// and 3(k - 1) multiplications for the k inverses of Z, as in
+// field_batch_inv.  The x-coordinates of out hold the prefix products of
+// the Z-coordinates, so out must not alias in.  Points at infinity map to
+// (0, 0).
+void group_batch_to_affine(Affine *out, const Group *in, size_t n)
+{
+    // the product starts at the first finite point
+    size_t first = 0;
+    while (first < n && group_is_zero(&in[first])) {
+        field_copy(out[first].x, FIELD_ZERO);
+        field_copy(out[first].y, FIELD_ZERO);
+        first++;
+    }
+    if (first == n) {
+        return;
+    }
+
+    Field acc;
+    field_copy(acc, in[first].Z);
+
+    // out[i].x = product of the non-zero Z_j for first <= j < i
+    for (size_t i = first + 1; i < n; i++) {
+        field_copy(out[i].x, acc);
+        if (!group_is_zero(&in[i])) {
+            field_mul(acc, acc, in[i].Z);
+        }
+    }
+
+    field_inv(acc, acc);
+
+    Field zi, zi2;
+    for (size_t i = n; i > first; i--) {
+        const Group *p = &in[i - 1];
+        Affine *r = &out[i - 1];
+        if (group_is_zero(p)) {
+            field_copy(r->x, FIELD_ZERO);
+            field_copy(r->y, FIELD_ZERO);
+            continue;
+        }
+        if (i - 1 == first) {
+            field_copy(zi, acc);        // 1/Z
+        }
+        else {
+            field_mul(zi, acc, r->x);   // 1/Z
+            field_mul(acc, acc, p->Z);
+        }
+        field_sq(zi2, zi);           // 1/Z^2
+        field_mul(r->x, p->X, zi2);  // X/Z^2
+        field_mul(zi2, zi2, zi);     // 1/Z^3
+        field_mul(r->y, p->Y, zi2);  // Y/Z^3
+    }
+}
+
 void group_one(Group *a)
 {
     affine_to_group(a, &AFFINE_ONE);
 }
 
 // https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/doubling/dbl-2009-l.op3
-// cost 2M + 5S + 6add + 3*2 + 1*3 + 1*8
+// cost 2M + 5S + 6add + 3*2 + 1*3 + 1*8 (field_mul_small for *3 and *8)
 void group_dbl(Group *r, const Group *p)
 {
-    if (is_zero(p)) {
+    if (group_is_zero(p)) {
         *r = *p;
         return;
     }
@@ -321,53 +594,58 @@ void group_dbl(Group *r, const Group *p)
     field_sub(r->Z, r->Y, a);     // t2 = t1 - a
     field_sub(r->X, r->Z, c);     // t3 = t2 - c
     field_add(d, r->X, r->X);     // d = 2 * t3
-    field_mul(e, FIELD_THREE, a); // e = 3 * a
+    field_mul_small(e, a, 3);     // e = 3 * a
     field_sq(f, e);               // f = e^2
 
     field_add(r->Y, d, d);        // t4 = 2 * d
     field_sub(r->X, f, r->Y);     // X = f - t4
 
-    field_sub(r->Y, d, r->X);     // t5 = d - X
-    field_mul(f, FIELD_EIGHT, c); // t6 = 8 * c
-    field_mul(r->Z, e, r->Y);     // t7 = e * t5
-    field_sub(r->Y, r->Z, f);     // Y = t7 - t6
+    FieldUnreduced t;
+    field_sub_unreduced(t, d, r->X); // t5 = d - X < 2p
+    field_mul_small(f, c, 8);        // t6 = 8 * c
+    field_mul_unreduced(r->Z, e, t); // t7 = e * t5
+    field_sub(r->Y, r->Z, f);        // Y = t7 - t6
 
-    field_mul(f, p->Y, p->Z);     // t8 = Y1 * Z1
-    field_add(r->Z, f, f);        // Z = 2 * t8
+    field_add_unreduced(t, p->Y, p->Y); // t8 = 2 * Y1 < 2p
+    field_mul_unreduced(r->Z, p->Z, t); // Z = t8 * Z1
 }
 
 // https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/addition/add-2007-bl.op3
 // cost 11M + 5S + 9add + 4*2
 void group_add(Group *r, const Group *p, const Group *q)
 {
-    if (is_zero(p)) {
+    if (group_is_zero(p)) {
         *r = *q;
         return;
     }
 
-    if (is_zero(q)) {
+    if (group_is_zero(q)) {
         *r = *p;
         return;
     }
 
-    if (field_eq(p->X, q->X) && field_eq(p->Y, q->Y) && field_eq(p->Z, q->Z)) {
-        return group_dbl(r, p);
-    }
-
     Field z1z1, z2z2;
     field_sq(z1z1, p->Z);         // Z1Z1 = Z1^2
     field_sq(z2z2, q->Z);         // Z2Z2 = Z2^2
 
     Field u1, u2, s1, s2;
+    Field h, i, j, w, v;
     field_mul(u1, p->X, z2z2);    // u1 = x1 * z2z2
     field_mul(u2, q->X, z1z1);    // u2 = x2 * z1z1
-    field_mul(r->X, q->Z, z2z2);  // t0 = z2 * z2z2
-    field_mul(s1, p->Y, r->X);    // s1 = y1 * t0
-    field_mul(r->Y, p->Z, z1z1);  // t1 = z1 * z1z1
-    field_mul(s2, q->Y, r->Y);    // s2 = y2 * t1
+    field_mul(h, q->Z, z2z2);     // t0 = z2 * z2z2
+    field_mul(s1, p->Y, h);       // s1 = y1 * t0
+    field_mul(h, p->Z, z1z1);     // t1 = z1 * z1z1
+    field_mul(s2, q->Y, h);       // s2 = y2 * t1
 
-    Field h, i, j, w, v;
     field_sub(h, u2, u1);         // h = u2 - u1
+    if (field_eq(h, FIELD_ZERO)) {
+        // q = p or q = -p, in any projective representation
+        if (field_eq(s1, s2)) {
+            return group_dbl(r, p);
+        }
+        *r = GROUP_ZERO;
+        return;
+    }
     field_add(r->Z, h, h);        // t2 = 2 * h
     field_sq(i, r->Z);            // i = t2^2
     field_mul(j, h, i);           // j = h * i
@@ -382,30 +660,32 @@ void group_add(Group *r, const Group *p, const Group *q)
     field_sub(r->X, r->Z, r->Y);  // t6 - t5
 
     // Y3 = w * (v - X3) - 2*s1*j
-    field_sub(r->Y, v, r->X);     // t7 = v - X3
-    field_mul(r->Z, s1, j);       // t8 = s1 * j
-    field_add(s1, r->Z, r->Z);    // t9 = 2 * t8
-    field_mul(r->Z, w, r->Y);     // t10 = w * t7
-    field_sub(r->Y, r->Z, s1);    // w * (v - X3) - 2*s1*j
+    FieldUnreduced t;
+    field_sub_unreduced(t, v, r->X);   // t7 = v - X3 < 2p
+    field_mul_unreduced(r->Y, w, t);   // t10 = w * t7
+    field_add_unreduced(t, s1, s1);    // t8 = 2 * s1 < 2p
+    field_mul_unreduced(s1, j, t);     // t9 = t8 * j
+    field_sub(r->Y, r->Y, s1);         // w * (v - X3) - 2*s1*j
 
     // Z3 = ((Z1 + Z2)^2 - Z1Z1 - Z2Z2) * h
-    field_add(r->Z, p->Z, q->Z);  // t11 = z1 + z2
-    field_sq(s1, r->Z);           // t12 = (z1 + z2)^2
-    field_sub(r->Z, s1, z1z1);    // t13 = (z1 + z2)^2 - z1z1
-    field_sub(j, r->Z, z2z2);     // t14 = (z1 + z2)^2 - z1z1 - z2z2
-    field_mul(r->Z, j, h);        // ((z1 + z2)^2 - z1z1 - z2z2) * h
+    field_add(r->Z, p->Z, q->Z);       // t11 = z1 + z2
+    field_sq(s1, r->Z);                // t12 = (z1 + z2)^2
+    field_sub_unreduced(t, s1, z1z1);  // t13 = (z1 + z2)^2 - z1z1 < 2p
+    field_sub_unreduced(t, t, z2z2);   // t14 = (z1 + z2)^2 - z1z1 - z2z2 < 3p
+    field_mul_unreduced(r->Z, h, t);   // ((z1 + z2)^2 - z1z1 - z2z2) * h
 }
 
 // https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/addition/madd-2007-bl.op3
 // for p = (X1, Y1, Z1), q = (X2, Y2, Z2); assumes Z2 = 1
 // cost 7M + 4S + 9add + 3*2 + 1*4 ?
+// r must not alias p; q = p (doubling) and q = -p are handled
 void group_madd(Group *r, const Group *p, const Group *q)
 {
-    if (is_zero(p)) {
+    if (group_is_zero(p)) {
         *r = *q;
         return;
     }
-    if (is_zero(q)) {
+    if (group_is_zero(q)) {
         *r = *p;
         return;
     }
@@ -420,10 +700,19 @@ void group_madd(Group *r, const Group *p, const Group *q)
 
     Field h, hh;
     field_sub(h, u2, p->X);          // h = u2 - X1
+    if (field_eq(h, FIELD_ZERO)) {
+        // q = p or q = -p
+        field_sub(hh, s2, p->Y);
+        if (field_eq(hh, FIELD_ZERO)) {
+            return group_dbl(r, p);
+        }
+        *r = GROUP_ZERO;
+        return;
+    }
     field_sq(hh, h);                 // hh = h^2
 
     Field j, w, v;
-    field_mul(r->X, FIELD_FOUR, hh); // i = 4 * hh
+    field_mul_small(r->X, hh, 4);    // i = 4 * hh
     field_mul(j, h, r->X);           // j = h * i
     field_sub(r->Y, s2, p->Y);       // t1 = s2 - Y1
     field_add(w, r->Y, r->Y);        // w = 2 * t1
@@ -436,10 +725,11 @@ void group_madd(Group *r, const Group *p, const Group *q)
     field_sub(r->X, r->Z, r->Y);     // X3 = w^2 - j - 2*v = t4 - t3
 
     // Y3 = w * (V - X3) - 2*Y1*J
-    field_sub(r->Y, v, r->X);        // t5 = v - X3
-    field_mul(v, p->Y, j);           // t6 = Y1 * j
-    field_add(r->Z, v, v);           // t7 = 2 * t6
-    field_mul(s2, w, r->Y);          // t8 = w * t5
+    FieldUnreduced t;
+    field_sub_unreduced(t, v, r->X); // t5 = v - X3 < 2p
+    field_mul_unreduced(s2, w, t);   // t8 = w * t5
+    field_add_unreduced(t, p->Y, p->Y); // t6 = 2 * Y1 < 2p
+    field_mul_unreduced(r->Z, j, t); // t7 = t6 * j
     field_sub(r->Y, s2, r->Z);       // w * (v - X3) - 2*Y1*j = t8 - t7
 
     // Z3 = (Z1 + H)^2 - Z1Z1 - HH
@@ -449,46 +739,1051 @@ void group_madd(Group *r, const Group *p, const Group *q)
     field_sub(r->Z, w, hh);          // (Z1 + h)^2 - Z1Z1 - hh = t11 - hh
 }
 
-void group_scalar_mul(Group *r, const Scalar k, const Group *p)
+void group_negate(Group *q, const Group *p)
 {
-    *r = GROUP_ZERO;
-    if (is_zero(p)) {
-        return;
+    field_copy(q->X, p->X);
+    field_negate(q->Y, p->Y);
+    field_copy(q->Z, p->Z);
+}
+
+// Complete formulas in homogeneous projective coordinates
+//
+//     (X : Y : Z) with x = X/Z, y = Y/Z, and zero = (0 : 1 : 0).  The
+//     Renes-Costello-Batina formulas for a = 0 (eprint 2015/1060,
+//     algorithms 7 and 8) have no exceptional cases: the same sequence
+//     of operations adds P + Q for P = Q, P = -Q or either point zero.
+//     They cost a few more multiplications than group_add/group_madd but
+//     have no data dependent branches, so batch kernels run them over
+//     several independent points in lockstep.  The output may alias the
+//     inputs.
+typedef struct projective_t {
+    Field X;
+    Field Y;
+    Field Z;
+} Projective;
+
+static const Projective PROJECTIVE_ZERO = {
+    { 0, 0, 0, 0},
+    { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0, 0, 0, 0}
+};
+
+// 3 * b
+#define GROUP_COEFF_B3 15
+
+// Jacobian (X Z, Y Z^2, Z) of the same point; zero maps to Z = 0
+static void projective_to_group(Group *r, const Projective *p)
+{
+    Field z2;
+    field_sq(z2, p->Z);
+    field_mul(r->X, p->X, p->Z);
+    field_mul(r->Y, p->Y, z2);
+    field_copy(r->Z, p->Z);
+}
+
+// Algorithm 7, cost 12M + 2m3b + 19add
+static void projective_add(Projective *r, const Projective *p, const Projective *q)
+{
+    Field t0, t1, t2, t3, t4, x3, y3, z3;
+    field_mul(t0, p->X, q->X);
+    field_mul(t1, p->Y, q->Y);
+    field_mul(t2, p->Z, q->Z);
+    field_add(t3, p->X, p->Y);
+    field_add(t4, q->X, q->Y);
+    field_mul(t3, t3, t4);
+    field_add(t4, t0, t1);
+    field_sub(t3, t3, t4);          // X1 Y2 + X2 Y1
+    field_add(t4, p->Y, p->Z);
+    field_add(x3, q->Y, q->Z);
+    field_mul(t4, t4, x3);
+    field_add(x3, t1, t2);
+    field_sub(t4, t4, x3);          // Y1 Z2 + Y2 Z1
+    field_add(x3, p->X, p->Z);
+    field_add(y3, q->X, q->Z);
+    field_mul(x3, x3, y3);
+    field_add(y3, t0, t2);
+    field_sub(y3, x3, y3);          // X1 Z2 + X2 Z1
+    field_mul_small(t0, t0, 3);
+    field_mul_small(t2, t2, GROUP_COEFF_B3);
+    field_add(z3, t1, t2);
+    field_sub(t1, t1, t2);
+    field_mul_small(y3, y3, GROUP_COEFF_B3);
+    field_mul(x3, t4, y3);
+    field_mul(t2, t3, t1);
+    field_sub(r->X, t2, x3);
+    field_mul(y3, y3, t0);
+    field_mul(t1, t1, z3);
+    field_add(r->Y, t1, y3);
+    field_mul(t0, t0, t3);
+    field_mul(z3, z3, t4);
+    field_add(r->Z, z3, t0);
+}
+
+// Algorithm 8, for q = (x, y, 1) (q not zero), cost 11M + 2m3b + 13add
+static void projective_madd(Projective *r, const Projective *p, const Affine *q)
+{
+    Field t0, t1, t2, t3, t4, x3, y3, z3;
+    FieldUnreduced u3, u4;
+    field_mul(t0, p->X, q->x);
+    field_mul(t1, p->Y, q->y);
+    field_add_unreduced(u3, q->x, q->y); // < 2p
+    field_add(t4, p->X, p->Y);
+    field_mul_unreduced(t3, t4, u3);
+    field_add(t4, t0, t1);
+    field_sub_unreduced(u3, t3, t4);   // X1 y2 + x2 Y1 < 2p
+    field_mul(t4, q->y, p->Z);
+    field_add_unreduced(u4, t4, p->Y); // Y1 + y2 Z1 < 2p
+    field_mul(y3, q->x, p->Z);
+    field_add(y3, y3, p->X);        // X1 + x2 Z1
+    field_mul_small(t0, t0, 3);
+    field_mul_small(t2, p->Z, GROUP_COEFF_B3);
+    field_add(z3, t1, t2);
+    field_sub(t1, t1, t2);
+    field_mul_small(y3, y3, GROUP_COEFF_B3);
+    field_mul_unreduced(x3, y3, u4);
+    field_mul_unreduced(t2, t1, u3);
+    field_sub(r->X, t2, x3);
+    field_mul(y3, y3, t0);
+    field_mul(t1, t1, z3);
+    field_add(r->Y, t1, y3);
+    field_mul_unreduced(t0, t0, u3);
+    field_mul_unreduced(z3, z3, u4);
+    field_add(r->Z, z3, t0);
+}
+
+// Algorithm 9, cost 6M + 2S + 1m3b + 9add
+static void projective_dbl(Projective *r, const Projective *p)
+{
+    Field t0, t1, t2, x3, y3, z3;
+    field_sq(t0, p->Y);
+    field_mul_small(z3, t0, 8);
+    field_mul(t1, p->Y, p->Z);
+    field_sq(t2, p->Z);
+    field_mul_small(t2, t2, GROUP_COEFF_B3);
+    field_mul(x3, t2, z3);
+    field_add(y3, t0, t2);
+    field_mul(z3, t1, z3);
+    field_mul_small(t1, t2, 3);
+    field_sub(t0, t0, t1);
+    field_mul(y3, t0, y3);
+    field_add(y3, x3, y3);
+    field_mul(t1, p->X, p->Y);
+    field_mul(x3, t0, t1);
+    field_add(r->X, x3, x3);
+    field_copy(r->Y, y3);
+    field_copy(r->Z, z3);
+}
+
+// Convert n <= PROJECTIVE_BATCH points to affine with one inversion,
+// zero maps to (0, 0)
+#define PROJECTIVE_BATCH 8
+
+static void projective_batch_to_affine(Affine *out, const Projective *in, const size_t n)
+{
+    Field z[PROJECTIVE_BATCH], zi[PROJECTIVE_BATCH];
+    for (size_t i = 0; i < n; i++) {
+        field_copy(z[i], in[i].Z);
+    }
+    field_batch_inv(zi, z, n);
+    for (size_t i = 0; i < n; i++) {
+        field_mul(out[i].x, in[i].X, zi[i]);
+        field_mul(out[i].y, in[i].Y, zi[i]);
+    }
+}
+
+// Four independent points in lockstep
+//
+//     The formulas of group_dbl, group_madd and projective_madd over the
+//     limb-interleaved four-lane field elements of pasta_avx2.c, used by
+//     the batch APIs when pasta_use_avx2 is set.  Points are packed and
+//     unpacked only at the ends of a batch; the outputs may alias the
+//     inputs.  Lanes are independent, so a batch of fewer than four
+//     points pads the last lanes with copies of its last point.
+typedef struct group4_t {
+    PastaFp4 X;
+    PastaFp4 Y;
+    PastaFp4 Z;
+} Group4;
+
+typedef struct projective4_t {
+    PastaFp4 X;
+    PastaFp4 Y;
+    PastaFp4 Z;
+} Projective4;
+
+typedef struct affine4_t {
+    PastaFp4 x;
+    PastaFp4 y;
+} Affine4;
+
+static void affine4_pack(Affine4 *r, const Affine *p[PASTA_FP4_LANES])
+{
+    const uint64_t *x[PASTA_FP4_LANES], *y[PASTA_FP4_LANES];
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        x[i] = p[i]->x;
+        y[i] = p[i]->y;
+    }
+    pasta_fp4_pack(&r->x, x);
+    pasta_fp4_pack(&r->y, y);
+}
+
+// Unpacks the first lanes (up to PASTA_FP4_LANES) into r[0..lanes)
+static void group4_unpack(Group *r, const Group4 *p, const size_t lanes)
+{
+    Group tmp[PASTA_FP4_LANES];
+    uint64_t *x[PASTA_FP4_LANES], *y[PASTA_FP4_LANES], *z[PASTA_FP4_LANES];
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        x[i] = tmp[i].X;
+        y[i] = tmp[i].Y;
+        z[i] = tmp[i].Z;
+    }
+    pasta_fp4_unpack(x, &p->X);
+    pasta_fp4_unpack(y, &p->Y);
+    pasta_fp4_unpack(z, &p->Z);
+    memcpy(r, tmp, lanes * sizeof(Group));
+}
+
+static void projective4_pack(Projective4 *r, const Projective *p[PASTA_FP4_LANES])
+{
+    const uint64_t *x[PASTA_FP4_LANES], *y[PASTA_FP4_LANES], *z[PASTA_FP4_LANES];
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        x[i] = p[i]->X;
+        y[i] = p[i]->Y;
+        z[i] = p[i]->Z;
+    }
+    pasta_fp4_pack(&r->X, x);
+    pasta_fp4_pack(&r->Y, y);
+    pasta_fp4_pack(&r->Z, z);
+}
+
+static void projective4_unpack(Projective *r, const Projective4 *p, const size_t lanes)
+{
+    Projective tmp[PASTA_FP4_LANES];
+    uint64_t *x[PASTA_FP4_LANES], *y[PASTA_FP4_LANES], *z[PASTA_FP4_LANES];
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        x[i] = tmp[i].X;
+        y[i] = tmp[i].Y;
+        z[i] = tmp[i].Z;
+    }
+    pasta_fp4_unpack(x, &p->X);
+    pasta_fp4_unpack(y, &p->Y);
+    pasta_fp4_unpack(z, &p->Z);
+    memcpy(r, tmp, lanes * sizeof(Projective));
+}
+
+// group_dbl
+static void group4_dbl(Group4 *r, const Group4 *p)
+{
+    PastaFp4 a, b, c, d, e, f, t, x3, y3;
+    pasta_fp4_sq(&a, &p->X);          // a = X1^2
+    pasta_fp4_sq(&b, &p->Y);          // b = Y1^2
+    pasta_fp4_sq(&c, &b);             // c = b^2
+
+    pasta_fp4_add(&t, &p->X, &b);     // t0 = X1 + b
+    pasta_fp4_sq(&t, &t);             // t1 = t0^2
+    pasta_fp4_sub(&t, &t, &a);        // t2 = t1 - a
+    pasta_fp4_sub(&t, &t, &c);        // t3 = t2 - c
+    pasta_fp4_add(&d, &t, &t);        // d = 2 * t3
+    pasta_fp4_mul_small(&e, &a, 3);   // e = 3 * a
+    pasta_fp4_sq(&f, &e);             // f = e^2
+
+    pasta_fp4_add(&t, &d, &d);        // t4 = 2 * d
+    pasta_fp4_sub(&x3, &f, &t);       // X = f - t4
+
+    pasta_fp4_sub(&t, &d, &x3);       // t5 = d - X
+    pasta_fp4_mul_small(&f, &c, 8);   // t6 = 8 * c
+    pasta_fp4_mul(&y3, &e, &t);       // t7 = e * t5
+    pasta_fp4_sub(&y3, &y3, &f);      // Y = t7 - t6
+
+    pasta_fp4_add(&t, &p->Y, &p->Y);  // t8 = 2 * Y1
+    pasta_fp4_mul(&r->Z, &p->Z, &t);  // Z = t8 * Z1
+    r->X = x3;
+    r->Y = y3;
+}
+
+// group_madd for non-zero p and q, returning the mask of the lanes where
+// q = +-p (h = 0), which the formulas do not handle
+static unsigned group4_madd(Group4 *r, const Group4 *p, const Affine4 *q)
+{
+    PastaFp4 z1z1, u2, s2, h, hh, i, j, w, v, t, x3, y3;
+    pasta_fp4_sq(&z1z1, &p->Z);       // z1z1 = Z1^2
+    pasta_fp4_mul(&u2, &q->x, &z1z1); // u2 = X2 * z1z1
+    pasta_fp4_mul(&t, &p->Z, &z1z1);  // t0 = Z1 * z1z1
+    pasta_fp4_mul(&s2, &q->y, &t);    // s2 = Y2 * t0
+
+    pasta_fp4_sub(&h, &u2, &p->X);    // h = u2 - X1
+    const unsigned exceptional = pasta_fp4_is_zero(&h);
+    pasta_fp4_sq(&hh, &h);            // hh = h^2
+
+    pasta_fp4_mul_small(&i, &hh, 4);  // i = 4 * hh
+    pasta_fp4_mul(&j, &h, &i);        // j = h * i
+    pasta_fp4_sub(&t, &s2, &p->Y);    // t1 = s2 - Y1
+    pasta_fp4_add(&w, &t, &t);        // w = 2 * t1
+    pasta_fp4_mul(&v, &p->X, &i);     // v = X1 * i
+
+    // X3 = w^2 - J - 2*V
+    pasta_fp4_sq(&x3, &w);            // t2 = w^2
+    pasta_fp4_sub(&x3, &x3, &j);      // t4 = t2 - j
+    pasta_fp4_add(&t, &v, &v);        // t3 = 2*v
+    pasta_fp4_sub(&x3, &x3, &t);      // X3 = t4 - t3
+
+    // Y3 = w * (V - X3) - 2*Y1*J
+    pasta_fp4_sub(&t, &v, &x3);       // t5 = v - X3
+    pasta_fp4_mul(&y3, &w, &t);       // t8 = w * t5
+    pasta_fp4_add(&t, &p->Y, &p->Y);  // t6 = 2 * Y1
+    pasta_fp4_mul(&t, &j, &t);        // t7 = t6 * j
+    pasta_fp4_sub(&y3, &y3, &t);      // t8 - t7
+
+    // Z3 = (Z1 + H)^2 - Z1Z1 - HH
+    pasta_fp4_add(&t, &p->Z, &h);     // t9 = Z1 + h
+    pasta_fp4_sq(&t, &t);             // t10 = t9^2
+    pasta_fp4_sub(&t, &t, &z1z1);     // t11 = t10 - z1z1
+    pasta_fp4_sub(&r->Z, &t, &hh);    // t11 - hh
+    r->X = x3;
+    r->Y = y3;
+    return exceptional;
+}
+
+// projective_madd (complete)
+static void projective4_madd(Projective4 *r, const Projective4 *p, const Affine4 *q)
+{
+    PastaFp4 t0, t1, t2, t3, t4, x3, y3, z3;
+    pasta_fp4_mul(&t0, &p->X, &q->x);
+    pasta_fp4_mul(&t1, &p->Y, &q->y);
+    pasta_fp4_add(&t3, &q->x, &q->y);
+    pasta_fp4_add(&t4, &p->X, &p->Y);
+    pasta_fp4_mul(&t3, &t3, &t4);
+    pasta_fp4_add(&t4, &t0, &t1);
+    pasta_fp4_sub(&t3, &t3, &t4);     // X1 y2 + x2 Y1
+    pasta_fp4_mul(&t4, &q->y, &p->Z);
+    pasta_fp4_add(&t4, &t4, &p->Y);   // Y1 + y2 Z1
+    pasta_fp4_mul(&y3, &q->x, &p->Z);
+    pasta_fp4_add(&y3, &y3, &p->X);   // X1 + x2 Z1
+    pasta_fp4_mul_small(&t0, &t0, 3);
+    pasta_fp4_mul_small(&t2, &p->Z, GROUP_COEFF_B3);
+    pasta_fp4_add(&z3, &t1, &t2);
+    pasta_fp4_sub(&t1, &t1, &t2);
+    pasta_fp4_mul_small(&y3, &y3, GROUP_COEFF_B3);
+    pasta_fp4_mul(&x3, &t4, &y3);
+    pasta_fp4_mul(&t2, &t3, &t1);
+    pasta_fp4_sub(&r->X, &t2, &x3);
+    pasta_fp4_mul(&y3, &y3, &t0);
+    pasta_fp4_mul(&t1, &t1, &z3);
+    pasta_fp4_add(&r->Y, &t1, &y3);
+    pasta_fp4_mul(&t0, &t0, &t3);
+    pasta_fp4_mul(&z3, &z3, &t4);
+    pasta_fp4_add(&r->Z, &z3, &t0);
+}
+
+// projective_dbl (complete)
+static void projective4_dbl(Projective4 *r, const Projective4 *p)
+{
+    PastaFp4 t0, t1, t2, x3, y3, z3;
+    pasta_fp4_sq(&t0, &p->Y);
+    pasta_fp4_mul_small(&z3, &t0, 8);
+    pasta_fp4_mul(&t1, &p->Y, &p->Z);
+    pasta_fp4_sq(&t2, &p->Z);
+    pasta_fp4_mul_small(&t2, &t2, GROUP_COEFF_B3);
+    pasta_fp4_mul(&x3, &t2, &z3);
+    pasta_fp4_add(&y3, &t0, &t2);
+    pasta_fp4_mul(&z3, &t1, &z3);
+    pasta_fp4_mul_small(&t1, &t2, 3);
+    pasta_fp4_sub(&t0, &t0, &t1);
+    pasta_fp4_mul(&y3, &t0, &y3);
+    pasta_fp4_add(&y3, &x3, &y3);
+    pasta_fp4_mul(&t1, &p->X, &p->Y);
+    pasta_fp4_mul(&x3, &t0, &t1);
+    pasta_fp4_add(&r->X, &x3, &x3);
+    r->Y = y3;
+    r->Z = z3;
+}
+
+// Window width of the wNAF scalar multiplication (2 to 8): the table holds
+// 2^(w - 2) odd multiples and on average one in w + 1 digits is non-zero
+#ifndef WNAF_WIDTH
+#define WNAF_WIDTH 5
+#endif
+
+#if WNAF_WIDTH < 2 || WNAF_WIDTH > 8
+#error "WNAF_WIDTH must be between 2 and 8"
+#endif
+
+#define WNAF_TABLE_SIZE (1 << (WNAF_WIDTH - 2))
+#define WNAF_DIGITS (FIELD_SIZE_IN_BITS + 2)
+
+// Width-w non-adjacent form of the (non-montgomery) integer k, least
+// significant digit first: odd digits in (-2^(w-1), 2^(w-1)), any two
+// non-zero digits at least w apart.  Returns the number of digits.
+static size_t scalar_wnaf(int8_t naf[WNAF_DIGITS], const uint64_t k[4])
+{
+    uint64_t n[4] = { k[0], k[1], k[2], k[3] };
+
+    size_t len = 0;
+    while (n[0] | n[1] | n[2] | n[3]) {
+        int digit = 0;
+        if (n[0] & 1) {
+            // digit = n mods 2^w, then n -= digit
+            digit = n[0] & ((1 << WNAF_WIDTH) - 1);
+            if (digit >= (1 << (WNAF_WIDTH - 1))) {
+                digit -= (1 << WNAF_WIDTH);
+            }
+            uint64_t carry = (uint64_t)(digit < 0 ? -digit : digit);
+            for (size_t i = 0; i < 4; i++) {
+                const uint64_t limb = n[i];
+                if (digit > 0) {
+                    n[i] = limb - carry;
+                    carry = (limb < carry);
+                }
+                else {
+                    n[i] = limb + carry;
+                    carry = (n[i] < carry);
+                }
+            }
+        }
+        naf[len++] = digit;
+
+        n[0] = (n[0] >> 1) | (n[1] << 63);
+        n[1] = (n[1] >> 1) | (n[2] << 63);
+        n[2] = (n[2] >> 1) | (n[3] << 63);
+        n[3] = n[3] >> 1;
+    }
+
+    return len;
+}
+
+// table[i] = (2i + 1) * p with Z = 1, using a single inversion
+static void group_odd_multiples(Group table[WNAF_TABLE_SIZE], const Group *p)
+{
+    Group proj[WNAF_TABLE_SIZE], p2;
+    Affine aff[WNAF_TABLE_SIZE];
+
+    proj[0] = *p;
+    group_dbl(&p2, p);
+    for (size_t i = 1; i < WNAF_TABLE_SIZE; i++) {
+        group_add(&proj[i], &proj[i - 1], &p2);
+    }
+
+    group_batch_to_affine(aff, proj, WNAF_TABLE_SIZE);
+    for (size_t i = 0; i < WNAF_TABLE_SIZE; i++) {
+        affine_to_group(&table[i], &aff[i]);
+    }
+}
+
+// GLV endomorphism: phi(x, y) = (beta x, y) = lambda (x, y), where beta
+// and lambda are cube roots of unity in Fp and Fq
+static const Field GLV_BETA = {
+    0x02021cf6619a153d, 0x9e8c26974980b78e, 0x2a676d5cc87a4666, 0x15d8049da7a17876
+};
+static const Scalar GLV_LAMBDA = {
+    0x7c541a8480111122, 0x40630b9c56ed29da, 0x02c275fb135b2b29, 0x121d29f888245b10
+};
+
+// Reduced basis (B1, -B1'), (B1', B2) of the lattice {(a, b) : a + b lambda
+// = 0 mod q}, with B1 = 0x49e69d1640a899538cb1279300000000 and
+// B2 = 0x93cd3a2c8198e2690c7c095a00000001 (montgomery), and
+// GLV_Gi = round(2^256 Bi / q) (non-montgomery)
+static const Scalar GLV_B1 = {
+    0x59824cd500000001, 0x0e0a5d03258217c3, 0x52a568b65c85c76d, 0x186bf7a9a1203e95
+};
+static const Scalar GLV_B2 = {
+    0xb5820455fffffffe, 0xcedde66ce9b7da38, 0x0447da18446bf0a4, 0x30d7ef53421a18b8
+};
+static const uint64_t GLV_G1[4] = {
+    0x32c49e4bffffffff, 0x279a745902a2654e, 0x0000000000000001, 0x0000000000000000
+};
+static const uint64_t GLV_G2[4] = {
+    0x31f0256800000003, 0x4f34e8b2066389a4, 0x0000000000000002, 0x0000000000000000
+};
+
+// c = round(n * g / 2^256), as a scalar
+static void glv_round(Scalar c, const uint64_t n[4], const uint64_t g[4])
+{
+    uint64_t t[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    for (size_t i = 0; i < 4; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < 4; j++) {
+            uint64_t hi;
+            const uint64_t lo = pasta_mul_wide(&hi, n[i], g[j]);
+            t[i + j] += lo;
+            hi += (t[i + j] < lo);
+            t[i + j] += carry;
+            carry = hi + (t[i + j] < carry);
+        }
+        t[i + 4] = carry;
+    }
+
+    // + 2^255
+    uint64_t carry = (uint64_t)1 << 63;
+    for (size_t i = 3; i < 8; i++) {
+        t[i] += carry;
+        carry = (t[i] < carry);
+    }
+    pasta_fq_to_montgomery(c, &t[4]);
+}
+
+// k = k1 + k2 lambda (mod q) with |k1|, |k2| < 2^128: returns the
+// (non-montgomery) absolute values and their signs (Babai rounding,
+// c1 = round(B2 k / q), c2 = round(B1 k / q), k2 = c1 B1 - c2 B2)
+static void scalar_glv_split(uint64_t k1[4], bool *neg1, uint64_t k2[4], bool *neg2, const Scalar k)
+{
+    uint64_t n[4];
+    pasta_fq_from_montgomery(n, k);
+
+    Scalar c1, c2, s1, s2, t;
+    glv_round(c1, n, GLV_G2);
+    glv_round(c2, n, GLV_G1);
+    scalar_mul(s2, c1, GLV_B1);
+    scalar_mul(t, c2, GLV_B2);
+    pasta_fq_sub(s2, s2, t);
+    scalar_mul(t, s2, GLV_LAMBDA);
+    pasta_fq_sub(s1, k, t);
+
+    // values above 2^128 are negative
+    pasta_fq_from_montgomery(k1, s1);
+    *neg1 = (k1[2] | k1[3]) != 0;
+    if (*neg1) {
+        scalar_negate(s1, s1);
+        pasta_fq_from_montgomery(k1, s1);
+    }
+    pasta_fq_from_montgomery(k2, s2);
+    *neg2 = (k2[2] | k2[3]) != 0;
+    if (*neg2) {
+        scalar_negate(s2, s2);
+        pasta_fq_from_montgomery(k2, s2);
+    }
+}
+
+// GLV + wNAF recoding of k * p = |k1| (+-p) + |k2| (+-phi(p)): table1 and
+// table2 get the odd multiples of the signed points, naf1 and naf2 the
+// digits of |k1| and |k2| zero padded to the returned length (at least
+// min_len, 0 if k or p is zero)
+static size_t group_glv_prepare(Group table1[WNAF_TABLE_SIZE], Group table2[WNAF_TABLE_SIZE],
+                                int8_t naf1[WNAF_DIGITS], int8_t naf2[WNAF_DIGITS],
+                                const Scalar k, const Group *p, const size_t min_len)
+{
+    size_t len1 = 0, len2 = 0;
+    if (!group_is_zero(p) && !scalar_eq(k, SCALAR_ZERO)) {
+        uint64_t k1[4], k2[4];
+        bool neg1, neg2;
+        scalar_glv_split(k1, &neg1, k2, &neg2, k);
+
+        group_odd_multiples(table1, p);
+        for (size_t i = 0; i < WNAF_TABLE_SIZE; i++) {
+            table2[i] = table1[i];
+            field_mul(table2[i].X, table1[i].X, GLV_BETA);
+            if (neg1) {
+                field_negate(table1[i].Y, table1[i].Y);
+            }
+            if (neg2) {
+                field_negate(table2[i].Y, table2[i].Y);
+            }
+        }
+
+        len1 = scalar_wnaf(naf1, k1);
+        len2 = scalar_wnaf(naf2, k2);
+    }
+
+    size_t len = len1 > len2 ? len1 : len2;
+    len = len > min_len ? len : min_len;
+    for (; len1 < len; len1++) {
+        naf1[len1] = 0;
+    }
+    for (; len2 < len; len2++) {
+        naf2[len2] = 0;
+    }
+    return len;
+}
+
+// r += digit * p for an odd wNAF digit, table from group_odd_multiples
+static void group_wnaf_add(Group *r, const Group table[WNAF_TABLE_SIZE], const int digit)
+{
+    Group tmp, neg;
+    if (digit > 0) {
+        group_madd(&tmp, r, &table[digit / 2]);
     }
-    if (scalar_eq(k, SCALAR_ZERO)) {
+    else if (digit < 0) {
+        group_negate(&neg, &table[-digit / 2]);
+        group_madd(&tmp, r, &neg);
+    }
+    else {
         return;
     }
+    *r = tmp;
+}
+
+// GLV + interleaved wNAF double-and-add: ~128 doublings and ~2 * 128/(w + 1)
+// mixed additions against the affine odd multiples of p and phi(p)
+// (Not constant time)
+void group_scalar_mul(Group *r, const Scalar k, const Group *p)
+{
+    Group table1[WNAF_TABLE_SIZE], table2[WNAF_TABLE_SIZE];
+    int8_t naf1[WNAF_DIGITS], naf2[WNAF_DIGITS];
+    const size_t len = group_glv_prepare(table1, table2, naf1, naf2, k, p, 0);
 
-    // Group r1 = *p;
     Group tmp;
+    *r = GROUP_ZERO;
+    for (size_t i = len; i > 0; i--) {
+        group_dbl(&tmp, r);
+        *r = tmp;
+        group_wnaf_add(r, table1, naf1[i - 1]);
+        group_wnaf_add(r, table2, naf2[i - 1]);
+    }
+}
+
+// Comb table index + 1 of block b in column c of the (non-montgomery)
+// scalar n: its bits in that column, 0 for no entry
+static size_t comb_mask(const uint64_t n[4], const size_t b, const size_t c)
+{
+    size_t mask = 0;
+    for (size_t i = 0; i < COMB_TEETH; i++) {
+        const size_t j = COMB_SPACING * i + COMB_BLOCK_BITS * b + c;
+        mask |= ((n[j / 64] >> (j % 64)) & 1) << i;
+    }
+    return mask;
+}
+
+// r += the comb column c of the (non-montgomery) scalar n: one table
+// entry per block, selected by the bits of n in that column
+static void group_comb_add(Group *r, const uint64_t n[4], const size_t c)
+{
+    Group q, tmp;
+    field_copy(q.Z, FIELD_ONE);
+
+    for (size_t b = 0; b < COMB_BLOCKS; b++) {
+        const size_t mask = comb_mask(n, b, c);
+        if (mask == 0) {
+            continue;
+        }
+
+        field_copy(q.X, COMB_TABLE[b][mask - 1].x);
+        field_copy(q.Y, COMB_TABLE[b][mask - 1].y);
+        group_madd(&tmp, r, &q);
+        *r = tmp;
+    }
+}
+
+// Constant time fixed-base multiplication by the generator
+//
+//     For secret scalars (private keys and signing nonces).  k is made
+//     odd (k or q - k, the result negated to match), so that with
+//     m = (k + 2^256 - 1) / 2 it is sum (2 m_i - 1) 2^i: every bit of m
+//     stands for a digit +-1 and no digit is zero.  The comb columns of m
+//     (the teeth of COMB_TABLE in COMB_SIGNED_BLOCKS blocks) then index
+//     COMB_SIGNED_TABLE (see comb_tables_gen.c) by their lower teeth,
+//     negated by the top one: COMB_SIGNED_BLOCK_BITS - 1 doublings and one
+//     complete mixed addition per block and column.  Entries are read by
+//     pasta_avx2_table_select and negated by fiat_pasta_fp_selectznz, so
+//     neither branches nor memory accesses depend on k.
+
+// m with k = +-sum (2 m_i - 1) 2^i; *negate is set if that is q - k
+static void scalar_comb_recode(uint64_t m[4], uint64_t *negate, const Scalar k)
+{
+    uint64_t n[4], t[4], borrow;
+    pasta_fq_from_montgomery(n, k);
+    borrow = pasta_subborrow(&t[0], 0, PASTA_FQ_M0, n[0]);
+    borrow = pasta_subborrow(&t[1], borrow, PASTA_FQ_M1, n[1]);
+    borrow = pasta_subborrow(&t[2], borrow, 0, n[2]);
+    pasta_subborrow(&t[3], borrow, PASTA_M3, n[3]);
+
+    const uint64_t even = (n[0] & 1) - 1;
+    for (size_t i = 0; i < 4; i++) {
+        n[i] = (n[i] & ~even) | (t[i] & even);
+    }
+    *negate = even & 1;
+
+    // (n + 2^256 - 1) / 2 = (n - 1) / 2 + 2^255 for odd n
+    m[0] = (n[0] >> 1) | (n[1] << 63);
+    m[1] = (n[1] >> 1) | (n[2] << 63);
+    m[2] = (n[2] >> 1) | (n[3] << 63);
+    m[3] = (n[3] >> 1) | ((uint64_t)1 << 63);
+}
+
+// q = the signed comb entry of block b in column c of m: the lower teeth
+// index COMB_SIGNED_TABLE[b], the top one (the sign) negates it if clear
+static void comb_signed_lookup(Affine *q, const uint64_t m[4], const size_t b, const size_t c)
+{
+    uint64_t mask = 0;
+    for (size_t i = 0; i < COMB_TEETH; i++) {
+        const size_t j = COMB_SPACING * i + COMB_SIGNED_BLOCK_BITS * b + c;
+        mask |= ((m[j / 64] >> (j % 64)) & 1) << i;
+    }
+    const uint64_t top = mask >> (COMB_TEETH - 1);
+    const uint64_t index = (mask ^ (top - 1)) & (COMB_SIGNED_ENTRIES - 1);
+    pasta_avx2_table_select((uint64_t *)q, (const uint64_t *)COMB_SIGNED_TABLE[b], COMB_SIGNED_ENTRIES, index);
+
+    Field y_neg;
+    field_negate(y_neg, q->y);
+    fiat_pasta_fp_selectznz(q->y, top, y_neg, q->y);
+}
+
+// r = k * G in constant time (zero for k = 0)
+static void projective_scalar_mul_base(Projective *r, const Scalar k)
+{
+    uint64_t m[4], negate;
+    scalar_comb_recode(m, &negate, k);
+
+    // the first entry is never zero, so it starts the sum
+    Affine q;
+    comb_signed_lookup(&q, m, 0, COMB_SIGNED_BLOCK_BITS - 1);
+    field_copy(r->X, q.x);
+    field_copy(r->Y, q.y);
+    field_copy(r->Z, FIELD_ONE);
+    for (size_t c = COMB_SIGNED_BLOCK_BITS; c > 0; c--) {
+        if (c < COMB_SIGNED_BLOCK_BITS) {
+            projective_dbl(r, r);
+        }
+        for (size_t b = c < COMB_SIGNED_BLOCK_BITS ? 0 : 1; b < COMB_SIGNED_BLOCKS; b++) {
+            comb_signed_lookup(&q, m, b, c - 1);
+            projective_madd(r, r, &q);
+        }
+    }
+
+    Field y_neg;
+    field_negate(y_neg, r->Y);
+    fiat_pasta_fp_selectznz(r->Y, negate, r->Y, y_neg);
+}
+
+// r[0..lanes) = the signed comb sums of the recoded scalars m[0..lanes),
+// four lanes in lockstep (lanes <= PASTA_FP4_LANES, constant time)
+static void projective4_sum_comb(Projective *r, const uint64_t m[][4], const size_t lanes)
+{
+    Affine q[PASTA_FP4_LANES];
+    const Affine *qs[PASTA_FP4_LANES];
+    const Projective *zero[PASTA_FP4_LANES];
+    for (size_t l = 0; l < PASTA_FP4_LANES; l++) {
+        qs[l] = &q[l < lanes ? l : lanes - 1];
+        zero[l] = &PROJECTIVE_ZERO;
+    }
+
+    Projective4 acc;
+    Affine4 q4;
+    projective4_pack(&acc, zero);
+    for (size_t c = COMB_SIGNED_BLOCK_BITS; c > 0; c--) {
+        if (c < COMB_SIGNED_BLOCK_BITS) {
+            projective4_dbl(&acc, &acc);
+        }
+        for (size_t b = 0; b < COMB_SIGNED_BLOCKS; b++) {
+            for (size_t l = 0; l < lanes; l++) {
+                comb_signed_lookup(&q[l], m[l], b, c - 1);
+            }
+            affine4_pack(&q4, qs);
+            projective4_madd(&acc, &acc, &q4);
+        }
+    }
+    projective4_unpack(r, &acc, lanes);
+}
 
-    uint64_t k_bits[4];
-    fiat_pasta_fq_from_montgomery(k_bits, k);
+// r = s * G + e * p (Strauss-Shamir): a single ~128 step doubling chain
+// over the GLV + wNAF digits of e, with the comb columns of s added
+// during its last COMB_BLOCK_BITS steps (Not constant time)
+static void group_scalar_mul_base_double(Group *r, const Scalar s, const Scalar e, const Group *p)
+{
+    uint64_t n[4];
+    pasta_fq_from_montgomery(n, s);
 
-    // Not constant time
-    for (size_t i = 0; i < FIELD_SIZE_IN_BITS; ++i) {
-        size_t j = FIELD_SIZE_IN_BITS - 1 - i;
-        size_t limb_idx = j / 64;
-        size_t in_limb_idx = (j % 64);
-        bool di = (k_bits[limb_idx] >> in_limb_idx) & 1;
+    Group table1[WNAF_TABLE_SIZE], table2[WNAF_TABLE_SIZE];
+    int8_t naf1[WNAF_DIGITS], naf2[WNAF_DIGITS];
+    const size_t len = group_glv_prepare(table1, table2, naf1, naf2, e, p, COMB_BLOCK_BITS);
 
+    Group tmp;
+    *r = GROUP_ZERO;
+    for (size_t i = len; i > 0; i--) {
         group_dbl(&tmp, r);
+        *r = tmp;
+        group_wnaf_add(r, table1, naf1[i - 1]);
+        group_wnaf_add(r, table2, naf2[i - 1]);
+        if (i <= COMB_BLOCK_BITS) {
+            group_comb_add(r, n, i - 1);
+        }
+    }
+}
 
-        if (di) {
-          group_add(r, &tmp, p);
-        } else {
-          field_copy(r->X, tmp.X);
-          field_copy(r->Y, tmp.Y);
-          field_copy(r->Z, tmp.Z);
+// Pippenger multi-scalar multiplication
+//
+//     out = sum k[i] * P[i].  Each scalar is recoded once, before the
+//     workers start, into signed c-bit digits in [-2^(c-1), 2^(c-1)),
+//     c ~ ln(n) + 2, so every window sorts
+//     the points into 2^(c-1) buckets.  Buckets are kept in affine
+//     coordinates and filled MSM_BATCH additions at a time sharing one
+//     inversion (about 6M per addition instead of 11M for group_madd);
+//     an addition to a bucket that already has one pending in the batch,
+//     or that would double it, goes to a projective overflow bucket
+//     instead.  Overflow buckets and the bucket sums use the complete
+//     projective formulas, so zero and P = +-Q need no special cases.  Each
+//     window is then summed with the running-sum trick and the
+//     windows are combined with c doublings each.  Windows are spread
+//     over up to MSM_THREADS threads (0 disables threading).
+//     Not constant time.
+
+#define MSM_BATCH 128
+#define MSM_MAX_WINDOW 16
+
+typedef struct msm_ctx_t {
+    const int16_t *digits;  // n rows of windows signed digits
+    const Affine *P;
+    size_t n;
+    size_t c;
+    size_t windows;
+    Group *sums;            // per window
+    size_t first, step;     // windows handled by this worker
+} MsmCtx;
+
+// Signed c-bit digits of k, one per window, carrying into the next
+static void msm_recode(int16_t *digits, const uint64_t k[4], const size_t c, const size_t windows)
+{
+    int carry = 0;
+    for (size_t w = 0; w < windows; w++) {
+        const size_t pos = w * c;
+        uint64_t bits = 0;
+        if (pos < 256) {
+            bits = k[pos / 64] >> (pos % 64);
+            if (pos % 64 + c > 64 && pos / 64 < 3) {
+                bits |= k[pos / 64 + 1] << (64 - pos % 64);
+            }
         }
+        const int digit = (int)(bits & ((1 << c) - 1)) + carry;
+        carry = digit >= (1 << (c - 1));
+        digits[w] = (int16_t)(digit - (carry << c));
     }
 }
 
-void group_negate(Group *q, const Group *p)
+// Affine bucket additions awaiting the batch inversion
+typedef struct msm_batch_t {
+    size_t len;
+    size_t bucket[MSM_BATCH];
+    Affine point[MSM_BATCH];
+    Field dx[MSM_BATCH];
+    Field dx_inv[MSM_BATCH];
+} MsmBatch;
+
+static void msm_flush(Affine *buckets, uint8_t *busy, MsmBatch *batch)
 {
-    field_copy(q->X, p->X);
-    field_negate(q->Y, p->Y);
-    field_copy(q->Z, p->Z);
+    field_batch_inv(batch->dx_inv, batch->dx, batch->len);
+
+    Field lambda, t;
+    for (size_t i = 0; i < batch->len; i++) {
+        Affine *b = &buckets[batch->bucket[i]];
+        const Affine *q = &batch->point[i];
+        field_sub(t, q->y, b->y);
+        field_mul(lambda, t, batch->dx_inv[i]); // (y2 - y1)/(x2 - x1)
+        field_sq(t, lambda);
+        field_sub(t, t, b->x);
+        field_sub(t, t, q->x);                  // x3 = lambda^2 - x1 - x2
+        field_sub(b->x, b->x, t);
+        field_mul(b->x, b->x, lambda);
+        field_sub(b->y, b->x, b->y);            // y3 = lambda (x1 - x3) - y1
+        field_copy(b->x, t);
+        busy[batch->bucket[i]] = 0;
+    }
+    batch->len = 0;
+}
+
+// Per worker bucket storage
+typedef struct msm_buckets_t {
+    Affine *affine;
+    Projective *overflow;     // complete formulas, starts at zero
+    uint8_t *filled;          // affine bucket holds a point
+    uint8_t *busy;            // affine bucket has a pending batch addition
+    MsmBatch *batch;
+} MsmBuckets;
+
+// sum of window w: sum_j (j + 1) * bucket[j]
+static void msm_window(Group *sum, const MsmCtx *ctx, const size_t w, MsmBuckets *b)
+{
+    const size_t nbuckets = (size_t)1 << (ctx->c - 1);
+    Affine *buckets = b->affine;
+    uint8_t *filled = b->filled, *busy = b->busy;
+    MsmBatch *batch = b->batch;
+    memset(filled, 0, nbuckets);
+    memset(busy, 0, nbuckets);
+    for (size_t j = 0; j < nbuckets; j++) {
+        b->overflow[j] = PROJECTIVE_ZERO;
+    }
+    batch->len = 0;
+
+    for (size_t i = 0; i < ctx->n; i++) {
+        const int digit = ctx->digits[i * ctx->windows + w];
+        if (digit == 0 || affine_is_zero(&ctx->P[i])) {
+            continue;
+        }
+        const size_t j = (digit > 0 ? digit : -digit) - 1;
+
+        Affine q = ctx->P[i];
+        if (digit < 0) {
+            field_negate(q.y, q.y);
+        }
+
+        if (!filled[j]) {
+            buckets[j] = q;
+            filled[j] = 1;
+            continue;
+        }
+        const bool same_x = field_eq(buckets[j].x, q.x);
+        if (busy[j] || (same_x && field_eq(buckets[j].y, q.y))) {
+            // pending addition or doubling: keep it projective
+            projective_madd(&b->overflow[j], &b->overflow[j], &q);
+            continue;
+        }
+        if (batch->len == MSM_BATCH) {
+            msm_flush(buckets, busy, batch);
+        }
+
+        if (same_x) {
+            // cancellation
+            filled[j] = 0;
+            continue;
+        }
+
+        batch->bucket[batch->len] = j;
+        batch->point[batch->len] = q;
+        field_sub(batch->dx[batch->len], q.x, buckets[j].x);
+        batch->len++;
+        busy[j] = 1;
+    }
+    msm_flush(buckets, busy, batch);
+
+    // running = bucket[B-1] + ... + bucket[j], total += running
+    Projective running = PROJECTIVE_ZERO, total = PROJECTIVE_ZERO;
+    for (size_t j = nbuckets; j > 0; j--) {
+        if (filled[j - 1]) {
+            projective_madd(&running, &running, &buckets[j - 1]);
+        }
+        if (!fiat_pasta_fp_equals_zero(b->overflow[j - 1].Z)) { // most stay empty
+            projective_add(&running, &running, &b->overflow[j - 1]);
+        }
+        projective_add(&total, &total, &running);
+    }
+    projective_to_group(sum, &total);
+}
+
+static void *msm_worker(void *arg)
+{
+    const MsmCtx *ctx = arg;
+    const size_t nbuckets = (size_t)1 << (ctx->c - 1);
+
+    MsmBuckets b;
+    b.affine = malloc(nbuckets * sizeof(Affine));
+    b.overflow = malloc(nbuckets * sizeof(Projective));
+    b.filled = malloc(2 * nbuckets);
+    b.batch = malloc(sizeof(MsmBatch));
+    void *ret = (void *)ctx; // failure
+    if (b.affine != NULL && b.overflow != NULL && b.filled != NULL && b.batch != NULL) {
+        b.busy = b.filled + nbuckets;
+        for (size_t w = ctx->first; w < ctx->windows; w += ctx->step) {
+            msm_window(&ctx->sums[w], ctx, w, &b);
+        }
+        ret = NULL;
+    }
+
+    free(b.affine);
+    free(b.overflow);
+    free(b.filled);
+    free(b.batch);
+    return ret;
+}
+
+void group_msm(Group *out, const Scalar *k, const Affine *P, const size_t n)
+{
+    *out = GROUP_ZERO;
+    if (n == 0) {
+        return;
+    }
+
+    size_t c = n < 32 ? 3 : (size_t)log((double)n) + 2;
+    c = c > MSM_MAX_WINDOW ? MSM_MAX_WINDOW : c;
+
+    MsmCtx ctx;
+    ctx.P = P;
+    ctx.n = n;
+    ctx.c = c;
+    ctx.windows = (FIELD_SIZE_IN_BITS + c - 1) / c + 1; // + final carry
+    int16_t *digits = malloc(n * ctx.windows * sizeof(int16_t));
+    ctx.sums = malloc(ctx.windows * sizeof(Group));
+    if (digits == NULL || ctx.sums == NULL) {
+        goto fallback;
+    }
+    for (size_t i = 0; i < n; i++) {
+        uint64_t t[4];
+        pasta_fq_from_montgomery(t, k[i]);
+        msm_recode(&digits[i * ctx.windows], t, c, ctx.windows);
+    }
+    ctx.digits = digits;
+
+    bool failed = false;
+#if MSM_THREADS > 0
+    size_t threads = n < 64 ? 1 : MSM_THREADS;
+    threads = threads > ctx.windows ? ctx.windows : threads;
+    MsmCtx workers[MSM_THREADS];
+    pthread_t ids[MSM_THREADS];
+    bool started[MSM_THREADS];
+    for (size_t t = 1; t < threads; t++) {
+        workers[t] = ctx;
+        workers[t].first = t;
+        workers[t].step = threads;
+        started[t] = pthread_create(&ids[t], NULL, msm_worker, &workers[t]) == 0;
+    }
+    // this thread takes the first share and the share of any thread that
+    // could not be started
+    workers[0] = ctx;
+    workers[0].first = 0;
+    workers[0].step = threads;
+    failed |= msm_worker(&workers[0]) != NULL;
+    for (size_t t = 1; t < threads; t++) {
+        void *ret = NULL;
+        if (started[t]) {
+            pthread_join(ids[t], &ret);
+        }
+        else {
+            ret = msm_worker(&workers[t]);
+        }
+        failed |= ret != NULL;
+    }
+#else
+    ctx.first = 0;
+    ctx.step = 1;
+    failed = msm_worker(&ctx) != NULL;
+#endif
+    if (failed) {
+        goto fallback;
+    }
+
+    // out = sum_w 2^(c w) sums[w]
+    Group tmp;
+    for (size_t w = ctx.windows; w > 0; w--) {
+        for (size_t i = 0; i < c && w < ctx.windows; i++) {
+            group_dbl(&tmp, out);
+            *out = tmp;
+        }
+        group_add(&tmp, out, &ctx.sums[w - 1]);
+        *out = tmp;
+    }
+    free(digits);
+    free(ctx.sums);
+    return;
+
+fallback:
+    // out of memory: one scalar multiplication per point
+    free(digits);
+    free(ctx.sums);
+    *out = GROUP_ZERO;
+    for (size_t i = 0; i < n; i++) {
+        Group p, kp, sum;
+        affine_to_group(&p, &P[i]);
+        group_scalar_mul(&kp, k[i], &p);
+        group_add(&sum, out, &kp);
+        *out = sum;
+    }
+}
+
+// Constant time, including the inversion
+static void affine_scalar_mul_base(Affine *r, const Scalar k)
+{
+    Projective pr;
+    Field zi;
+    projective_scalar_mul_base(&pr, k);
+    field_inv(zi, pr.Z);
+    field_mul(r->x, pr.X, zi);
+    field_mul(r->y, pr.Y, zi);
 }
 
 void affine_scalar_mul(Affine *r, const Scalar k, const Affine *p)
@@ -499,6 +1794,128 @@ void affine_scalar_mul(Affine *r, const Scalar k, const Affine *p)
     affine_from_group(r, &pr);
 }
 
+// Regular recoding for affine_scalar_mul_batch: k (made odd) as
+// FIXED_WINDOWS odd signed digits of FIXED_WINDOW_BITS bits (Joye-Tunstall)
+#define FIXED_WINDOW_BITS 5
+#define FIXED_WINDOWS 51
+#define FIXED_DIGITS (1 << (FIXED_WINDOW_BITS - 1))
+
+// Odd digits d[j] in (-2^w, 2^w) with k = +-sum d[j] 2^(w j); *negate
+// is set if the digits are those of q - k
+static void scalar_fixed_recode(int8_t d[FIXED_WINDOWS], uint64_t *negate, const Scalar k)
+{
+    uint64_t n[4], m[4], borrow;
+    pasta_fq_from_montgomery(n, k);
+    borrow = pasta_subborrow(&m[0], 0, PASTA_FQ_M0, n[0]);
+    borrow = pasta_subborrow(&m[1], borrow, PASTA_FQ_M1, n[1]);
+    borrow = pasta_subborrow(&m[2], borrow, 0, n[2]);
+    pasta_subborrow(&m[3], borrow, PASTA_M3, n[3]);
+
+    const uint64_t even = (n[0] & 1) - 1;
+    for (size_t i = 0; i < 4; i++) {
+        n[i] = (n[i] & ~even) | (m[i] & even);
+    }
+    *negate = even & 1;
+
+    // d = (n mod 2^(w + 1)) - 2^w, n = (n - d) / 2^w = (n >> w) | 1
+    for (size_t j = 0; j < FIXED_WINDOWS - 1; j++) {
+        d[j] = (int8_t)((int)(n[0] & ((2 << FIXED_WINDOW_BITS) - 1)) - (1 << FIXED_WINDOW_BITS));
+        n[0] = (n[0] >> FIXED_WINDOW_BITS) | (n[1] << (64 - FIXED_WINDOW_BITS)) | 1;
+        n[1] = (n[1] >> FIXED_WINDOW_BITS) | (n[2] << (64 - FIXED_WINDOW_BITS));
+        n[2] = (n[2] >> FIXED_WINDOW_BITS) | (n[3] << (64 - FIXED_WINDOW_BITS));
+        n[3] = n[3] >> FIXED_WINDOW_BITS;
+    }
+    d[FIXED_WINDOWS - 1] = (int8_t)n[0];
+}
+
+// r[i] = k[i] * p[i] for n independent points (Not constant time)
+//
+//     With pasta_use_avx2 the points go four at a time: the odd multiples
+//     (2i + 1) p of each point in affine coordinates (one inversion per
+//     batch), then the odd signed digits of scalar_fixed_recode from the
+//     top, with FIXED_WINDOW_BITS doublings and one mixed addition per
+//     window (group4_dbl, group4_madd).  The running sum is an odd
+//     multiple of p larger than the one added, so the incomplete mixed
+//     addition only fails for p = 0 or k = 0; lanes where it reports
+//     q = +-p are recomputed with group_scalar_mul.
+void affine_scalar_mul_batch(Affine *r, const Scalar *k, const Affine *p, const size_t n)
+{
+    if (!pasta_use_avx2) {
+        for (size_t i = 0; i < n; i++) {
+            affine_scalar_mul(&r[i], k[i], &p[i]);
+        }
+        return;
+    }
+
+    const uint64_t *one[PASTA_FP4_LANES] = { FIELD_ONE, FIELD_ONE, FIELD_ONE, FIELD_ONE };
+    for (size_t start = 0; start < n; start += PASTA_FP4_LANES) {
+        const size_t lanes = n - start < PASTA_FP4_LANES ? n - start : PASTA_FP4_LANES;
+        int8_t d[PASTA_FP4_LANES][FIXED_WINDOWS];
+        uint64_t negate[PASTA_FP4_LANES];
+        Group multiples[PASTA_FP4_LANES][FIXED_DIGITS], p2;
+        Affine table[PASTA_FP4_LANES][FIXED_DIGITS];
+        unsigned exceptional = 0;
+
+        for (size_t l = 0; l < lanes; l++) {
+            scalar_fixed_recode(d[l], &negate[l], k[start + l]);
+            if (affine_is_zero(&p[start + l])) {
+                exceptional |= 1 << l;
+            }
+            affine_to_group(&multiples[l][0], &p[start + l]);
+            group_dbl(&p2, &multiples[l][0]);
+            for (size_t i = 1; i < FIXED_DIGITS; i++) {
+                group_add(&multiples[l][i], &multiples[l][i - 1], &p2);
+            }
+        }
+        group_batch_to_affine(table[0], multiples[0], lanes * FIXED_DIGITS);
+
+        Affine q[PASTA_FP4_LANES];
+        const Affine *qs[PASTA_FP4_LANES];
+        for (size_t l = 0; l < PASTA_FP4_LANES; l++) {
+            qs[l] = &q[l < lanes ? l : lanes - 1];
+        }
+
+        // the top digit is positive
+        Group4 acc;
+        Affine4 q4;
+        for (size_t l = 0; l < lanes; l++) {
+            q[l] = table[l][d[l][FIXED_WINDOWS - 1] >> 1];
+        }
+        affine4_pack(&q4, qs);
+        acc.X = q4.x;
+        acc.Y = q4.y;
+        pasta_fp4_pack(&acc.Z, one);
+
+        for (size_t j = FIXED_WINDOWS - 1; j > 0; j--) {
+            for (size_t b = 0; b < FIXED_WINDOW_BITS; b++) {
+                group4_dbl(&acc, &acc);
+            }
+            for (size_t l = 0; l < lanes; l++) {
+                const int digit = d[l][j - 1];
+                q[l] = table[l][(digit < 0 ? -digit : digit) >> 1];
+                if (digit < 0) {
+                    field_negate(q[l].y, q[l].y);
+                }
+            }
+            affine4_pack(&q4, qs);
+            exceptional |= group4_madd(&acc, &acc, &q4);
+        }
+
+        Group out[PASTA_FP4_LANES], tmp;
+        group4_unpack(out, &acc, lanes);
+        for (size_t l = 0; l < lanes; l++) {
+            if (exceptional & (1 << l)) {
+                affine_to_group(&tmp, &p[start + l]);
+                group_scalar_mul(&out[l], k[start + l], &tmp);
+            }
+            else if (negate[l]) {
+                field_negate(out[l].Y, out[l].Y);
+            }
+        }
+        group_batch_to_affine(&r[start], out, lanes);
+    }
+}
+
 bool affine_eq(const Affine *p, const Affine *q)
 {
     return field_eq(p->x, q->x) && field_eq(p->y, q->y);
@@ -513,19 +1930,30 @@ void affine_add(Affine *r, const Affine *p, const Affine *q)
     affine_from_group(r, &gr);
 }
 
+// The affine negation and curve check work on the coordinates directly
 void affine_negate(Affine *q, const Affine *p)
 {
-    Group gq, gp;
-    affine_to_group(&gp, p);
-    group_negate(&gq, &gp);
-    affine_from_group(q, &gq);
+    field_copy(q->x, p->x);
+    if (affine_is_zero(p)) {
+        field_copy(q->y, FIELD_ZERO);
+    }
+    else {
+        field_negate(q->y, p->y);
+    }
 }
 
 bool affine_is_on_curve(const Affine *p)
 {
-    Group gp;
-    affine_to_group(&gp, p);
-    return group_is_on_curve(&gp);
+    if (affine_is_zero(p)) {
+        return true;
+    }
+
+    Field lhs, rhs;
+    field_sq(lhs, p->y);                // y^2
+    field_sq(rhs, p->x);
+    field_mul(rhs, rhs, p->x);          // x^3
+    field_add(rhs, rhs, GROUP_COEFF_B); // x^3 + b
+    return field_eq(lhs, rhs);
 }
 
 void roinput_print_fields(const ROInput *input) {
@@ -574,7 +2002,7 @@ void roinput_add_scalar(ROInput *input, const Scalar a) {
   const size_t len = FIELD_SIZE_IN_BITS;
 
   uint64_t scalar_bigint[4];
-  fiat_pasta_fq_from_montgomery(scalar_bigint, a);
+  pasta_fq_from_montgomery(scalar_bigint, a);
 
   if (remaining < len) {
     printf("add_scalar: bits at capacity\n");
@@ -642,7 +2070,7 @@ void roinput_to_bytes(uint8_t *out, const ROInput *input) {
 
   // first the field elements, then the bitstrings
   for (size_t i = 0; i < input->fields_len; ++i) {
-    fiat_pasta_fp_from_montgomery(tmp, input->fields + (i * LIMBS_PER_FIELD));
+    pasta_fp_from_montgomery(tmp, input->fields + (i * LIMBS_PER_FIELD));
 
     for (size_t j = 0; j < FIELD_SIZE_IN_BITS; ++j) {
       size_t limb_idx = j / 64;
@@ -691,7 +2119,7 @@ size_t roinput_to_fields(uint64_t *out, const ROInput *input) {
 
       chunk_non_montgomery[limb_idx] =  chunk_non_montgomery[limb_idx] | (((uint64_t) b) << in_limb_idx);
     }
-    fiat_pasta_fp_to_montgomery(next_chunk, chunk_non_montgomery);
+    pasta_fp_to_montgomery(next_chunk, chunk_non_montgomery);
 
     output_len += 1;
     bits_consumed += chunk_size_in_bits;
@@ -701,6 +2129,19 @@ size_t roinput_to_fields(uint64_t *out, const ROInput *input) {
   return output_len;
 }
 
+// Fill buf with len random bytes; false if /dev/urandom cannot be opened
+// or read (errno tells why)
+static bool read_urandom(void *buf, const size_t len)
+{
+    FILE *fr = fopen("/dev/urandom", "r");
+    if (fr == NULL) {
+        return false;
+    }
+    const bool ok = fread(buf, sizeof(uint8_t), len, fr) == len;
+    fclose(fr);
+    return ok;
+}
+
 void generate_keypair(Keypair *keypair, uint32_t account)
 {
     if (!keypair) {
@@ -708,10 +2149,7 @@ void generate_keypair(Keypair *keypair, uint32_t account)
     }
 
     uint64_t priv_non_montgomery[4] = { 0, 0, 0, 0 };
-    FILE* fr = fopen("/dev/urandom", "r");
-    if (!fr) perror("urandom"), exit(EXIT_FAILURE);
-    fread((void*)priv_non_montgomery, sizeof(uint8_t), 32, fr);
-    fclose(fr), fr = NULL;
+    if (!read_urandom(priv_non_montgomery, 32)) perror("urandom"), exit(EXIT_FAILURE);
 
     // Make sure the private key is in [0, p)
     //
@@ -735,16 +2173,62 @@ void generate_keypair(Keypair *keypair, uint32_t account)
     // insignificant amount of entropy.
 
     priv_non_montgomery[3] &= (((uint64_t)1 << 62) - 1); // drop top two bits
-    fiat_pasta_fq_to_montgomery(keypair->priv, priv_non_montgomery);
+    pasta_fq_to_montgomery(keypair->priv, priv_non_montgomery);
 
-    affine_scalar_mul(&keypair->pub, keypair->priv, &AFFINE_ONE);
+    affine_scalar_mul_base(&keypair->pub, keypair->priv);
 
     return;
 }
 
 void generate_pubkey(Affine *pub_key, const Scalar priv_key)
 {
-    affine_scalar_mul(pub_key, priv_key, &AFFINE_ONE);
+    affine_scalar_mul_base(pub_key, priv_key);
+}
+
+// Public keys of n private keys: the constant time signed comb run over
+// PROJECTIVE_BATCH keys in lockstep (four lanes per instruction with
+// pasta_use_avx2), with one inversion per batch.  Zero private keys give
+// (0, 0).
+void generate_pubkeys(Affine *pub_keys, const Scalar *priv_keys, const size_t n)
+{
+    for (size_t start = 0; start < n; start += PROJECTIVE_BATCH) {
+        const size_t lanes = n - start < PROJECTIVE_BATCH ? n - start : PROJECTIVE_BATCH;
+        uint64_t m[PROJECTIVE_BATCH][4];
+        uint64_t negate[PROJECTIVE_BATCH];
+        Projective r[PROJECTIVE_BATCH];
+        Affine q;
+        for (size_t l = 0; l < lanes; l++) {
+            scalar_comb_recode(m[l], &negate[l], priv_keys[start + l]);
+            r[l] = PROJECTIVE_ZERO;
+        }
+
+        if (pasta_use_avx2) {
+            for (size_t l = 0; l < lanes; l += PASTA_FP4_LANES) {
+                const size_t width = lanes - l < PASTA_FP4_LANES ? lanes - l : PASTA_FP4_LANES;
+                projective4_sum_comb(&r[l], &m[l], width);
+            }
+        }
+        else {
+            for (size_t c = COMB_SIGNED_BLOCK_BITS; c > 0; c--) {
+                for (size_t l = 0; l < lanes && c < COMB_SIGNED_BLOCK_BITS; l++) {
+                    projective_dbl(&r[l], &r[l]);
+                }
+                for (size_t b = 0; b < COMB_SIGNED_BLOCKS; b++) {
+                    for (size_t l = 0; l < lanes; l++) {
+                        comb_signed_lookup(&q, m[l], b, c - 1);
+                        projective_madd(&r[l], &r[l], &q);
+                    }
+                }
+            }
+        }
+
+        Field y_neg;
+        for (size_t l = 0; l < lanes; l++) {
+            field_negate(y_neg, r[l].Y);
+            fiat_pasta_fp_selectznz(r[l].Y, negate[l], r[l].Y, y_neg);
+        }
+        projective_batch_to_affine(&pub_keys[start], r, lanes);
+    }
 }
 
 bool generate_address(char *address, const size_t len, const Affine *pub_key)
@@ -767,7 +2251,7 @@ bool generate_address(char *address, const size_t len, const Affine *pub_key)
     raw.payload[1] = 0x01; // compressed_poly version
 
     // x-coordinate
-    fiat_pasta_fp_from_montgomery((uint64_t *)&raw.payload[2], pub_key->x);
+    pasta_fp_from_montgomery((uint64_t *)&raw.payload[2], pub_key->x);
 
     // y-coordinate parity
     raw.payload[34] = field_is_odd(pub_key->y);
@@ -837,7 +2321,7 @@ void message_derive(Scalar out, const Keypair *kp, const ROInput *msg, uint8_t n
         tmp[i] |= ((uint64_t) hash_out[8*i + j]) << (8 * j);
       }
     }
-    fiat_pasta_fq_to_montgomery(out, tmp);
+    pasta_fq_to_montgomery(out, tmp);
 }
 
 void message_hash(Scalar out, const Affine *pub, const Field rx, const ROInput *msg, const uint8_t hash_type, const uint8_t network_id)
@@ -863,15 +2347,23 @@ void message_hash(Scalar out, const Affine *pub, const Field rx, const ROInput *
     roinput_add_field(&input, pub->y);
     roinput_add_field(&input, rx);
 
-    // Initial sponge state
-    PoseidonCtx ctx;
-    poseidon_init(&ctx, hash_type, network_id);
-
     Field packed_elements[input.fields_len + (size_t)ceil((float)input.bits_len/(FIELD_SIZE_IN_BITS - 1))];
     size_t packed_elements_len = roinput_to_fields((uint64_t *)packed_elements, &input);
     assert(packed_elements_len == sizeof(packed_elements)/FIELD_BYTES);
 
-    poseidon_update(&ctx, (Field *)packed_elements, packed_elements_len);
+    // Initial sponge state.  When the first blocks are message fields and
+    // the public key (not rx) the prefix cache may already have them.
+    PoseidonCtx ctx;
+    size_t absorbed = 0;
+    if (msg->fields_len + 2 >= POSEIDON_PREFIX_LEN && poseidon_prefix_cache_enabled()) {
+        poseidon_init_prefix(&ctx, hash_type, network_id, (const Field *)packed_elements);
+        absorbed = POSEIDON_PREFIX_LEN;
+    }
+    else {
+        poseidon_init(&ctx, hash_type, network_id);
+    }
+
+    poseidon_update(&ctx, (Field *)packed_elements + absorbed, packed_elements_len - absorbed);
     poseidon_digest(out, &ctx);
 }
 
@@ -882,7 +2374,7 @@ void compress(Compressed *compressed, const Affine *pt) {
   fiat_pasta_fp_copy(compressed->x, pt->x);
 
   Field y_bigint;
-  fiat_pasta_fp_from_montgomery(y_bigint, pt->y);
+  pasta_fp_from_montgomery(y_bigint, pt->y);
 
   compressed->is_odd = y_bigint[0] & 1;
 }
@@ -897,12 +2389,17 @@ bool decompress(Affine *pt, const Compressed *compressed) {
   Field y2;
   fiat_pasta_fp_add(y2, x3, GROUP_COEFF_B);
 
+  // Reject x not on the curve before paying for the square root
+  if (!field_is_square(y2)) {
+    return false;
+  }
+
   Field y_pre;
   if (!fiat_pasta_fp_sqrt(y_pre, y2)) {
     return false;
   }
   Field y_pre_bigint;
-  fiat_pasta_fp_from_montgomery(y_pre_bigint, y_pre);
+  pasta_fp_from_montgomery(y_pre_bigint, y_pre);
 
   const bool y_pre_odd = (y_pre_bigint[0] & 1);
   if (y_pre_odd == compressed->is_odd) {
@@ -931,7 +2428,7 @@ void read_public_key_compressed(Compressed *out, const char *pubkeyBase58) {
     }
   }
 
-  fiat_pasta_fp_to_montgomery(out->x, x_coord_non_montgomery);
+  pasta_fp_to_montgomery(out->x, x_coord_non_montgomery);
   out->is_odd = (bool) pubkeyBytes[offset + 32];
 }
 
@@ -947,7 +2444,9 @@ void prepare_memo(uint8_t *out, const char *s) {
   }
 }
 
-bool verify(Signature *sig, const Compressed *pub_compressed, const Transaction *transaction, uint8_t network_id)
+// Decompress the public key and compute the challenge e of a signature
+static bool verify_challenge(Scalar e, Affine *pub, const Signature *sig, const Compressed *pub_compressed,
+                             const Transaction *transaction, uint8_t network_id)
 {
     // Convert transaction to ROInput
     uint64_t input_fields[4 * 3];
@@ -979,42 +2478,137 @@ bool verify(Signature *sig, const Compressed *pub_compressed, const Transaction
     roinput_add_uint64(&input, transaction->amount);
     roinput_add_bit(&input, transaction->token_locked);
 
-    Affine pub;
-    if (!decompress(&pub, pub_compressed)) {
+    if (!decompress(pub, pub_compressed)) {
       return false;
     }
 
-    Scalar e;
-    message_hash(e, &pub, sig->rx, &input, POSEIDON_LEGACY, network_id);
+    message_hash(e, pub, sig->rx, &input, POSEIDON_LEGACY, network_id);
+    return true;
+}
 
-    Group g;
-    affine_to_group(&g, &AFFINE_ONE);
+// Verification rejects without any inversion: rx and s are range checked
+// before hashing and r = (X : Y : Z) is compared with rx projectively,
+// rx * Z^2 == X.  Only a candidate that passes pays the inversion for
+// the parity of y = Y / Z^3.
+bool verify(Signature *sig, const Compressed *pub_compressed, const Transaction *transaction, uint8_t network_id)
+{
+    if (!pasta_fp_is_reduced(sig->rx) || !pasta_fq_is_reduced(sig->s)) {
+      return false;
+    }
 
-    Group sg;
-    group_scalar_mul(&sg, sig->s, &g);
+    Affine pub;
+    Scalar e;
+    if (!verify_challenge(e, &pub, sig, pub_compressed, transaction, network_id)) {
+      return false;
+    }
 
-    Group pub_proj;
+    // r = s*G - e*pub
+    Group pub_proj, neg_pub;
     affine_to_group(&pub_proj, &pub);
-    Group epub;
-    group_scalar_mul(&epub, e, &pub_proj);
-
-    Group neg_epub;
-    fiat_pasta_fp_copy(neg_epub.X, epub.X);
-    fiat_pasta_fp_opp(neg_epub.Y, epub.Y);
-    fiat_pasta_fp_copy(neg_epub.Z, epub.Z);
+    group_negate(&neg_pub, &pub_proj);
 
     Group r;
-    group_add(&r, &sg, &neg_epub);
+    group_scalar_mul_base_double(&r, sig->s, e, &neg_pub);
+    if (group_is_zero(&r)) {
+      return false;
+    }
 
-    Affine raff;
-    affine_from_group(&raff, &r);
+    Field z2, t;
+    field_sq(z2, r.Z);
+    field_mul(t, sig->rx, z2);
+    if (!field_eq(t, r.X)) {
+      return false;
+    }
 
+    // y = Y / Z^3
     Field ry_bigint;
-    fiat_pasta_fp_from_montgomery(ry_bigint, raff.y);
+    field_inv(t, r.Z);
+    field_sq(z2, t);
+    field_mul(t, t, z2);
+    field_mul(t, r.Y, t);
+    pasta_fp_from_montgomery(ry_bigint, t);
+
+    return (ry_bigint[0] & 1) == 0;
+}
+
+// Batch verification of n signatures
+//
+//     With R_i = (rx_i, even y) and random 128-bit weights z_i, checks
+//
+//         (sum z_i s_i) G - sum z_i R_i - sum (z_i e_i) P_i = 0
+//
+//     with a single group_msm over the 2n + 1 points.  If the combined
+//     check fails (or a public key or rx does not decompress), every
+//     signature is verified on its own.  Returns true if all signatures
+//     are valid; valid (if not NULL) receives the individual results.
+bool verify_batch(bool *valid, Signature *sigs, const Compressed *pubs, const Transaction *transactions,
+                  const size_t n, uint8_t network_id)
+{
+    if (n == 0) {
+        return true;
+    }
 
-    const bool ry_even = (ry_bigint[0] & 1) == 0;
+    bool ok = false;
+    Affine *points = malloc((2 * n + 1) * sizeof(Affine));
+    Scalar *scalars = malloc((2 * n + 1) * sizeof(Scalar));
+    uint64_t *weights = malloc(2 * n * sizeof(uint64_t));
+    if (points == NULL || scalars == NULL || weights == NULL
+        || !read_urandom(weights, 2 * n * sizeof(uint64_t))) {
+        goto fallback;
+    }
 
-    return (ry_even && fiat_pasta_fp_equals(raff.x, sig->rx));
+    Scalar s_sum, z, t;
+    scalar_copy(s_sum, SCALAR_ZERO);
+    for (size_t i = 0; i < n; i++) {
+        if (!pasta_fp_is_reduced(sigs[i].rx) || !pasta_fq_is_reduced(sigs[i].s)) {
+            goto fallback;
+        }
+
+        Scalar e;
+        Compressed r_compressed;
+        field_copy(r_compressed.x, sigs[i].rx);
+        r_compressed.is_odd = false;
+        if (!verify_challenge(e, &points[2 * i + 1], &sigs[i], &pubs[i], &transactions[i], network_id)
+            || !decompress(&points[2 * i], &r_compressed)) {
+            goto fallback;
+        }
+
+        const uint64_t z_words[4] = { weights[2 * i], weights[2 * i + 1], 0, 0 };
+        scalar_from_words(z, z_words);
+        scalar_mul(t, z, sigs[i].s);
+        scalar_add(s_sum, s_sum, t);                // z_i s_i
+        scalar_negate(scalars[2 * i], z);           // -z_i for R_i
+        scalar_mul(t, z, e);
+        scalar_negate(scalars[2 * i + 1], t);       // -z_i e_i for P_i
+    }
+    points[2 * n] = AFFINE_ONE;
+    scalar_copy(scalars[2 * n], s_sum);
+
+    Group sum;
+    group_msm(&sum, scalars, points, 2 * n + 1);
+    ok = group_is_zero(&sum);
+
+fallback:
+    free(points);
+    free(scalars);
+    free(weights);
+
+    if (ok) {
+        for (size_t i = 0; valid != NULL && i < n; i++) {
+            valid[i] = true;
+        }
+        return true;
+    }
+
+    ok = true;
+    for (size_t i = 0; i < n; i++) {
+        const bool v = verify(&sigs[i], &pubs[i], &transactions[i], network_id);
+        if (valid != NULL) {
+            valid[i] = v;
+        }
+        ok &= v;
+    }
+    return ok;
 }
 
 void sign(Signature *sig, const Keypair *kp, const Transaction *transaction, uint8_t network_id)
@@ -1060,16 +2654,14 @@ void sign(Signature *sig, const Keypair *kp, const Transaction *transaction, uin
 
     // r = k*g
     Affine r;
-    affine_scalar_mul(&r, k, &AFFINE_ONE);
+    affine_scalar_mul_base(&r, k);
 
     field_copy(sig->rx, r.x);
 
-    if (field_is_odd(r.y)) {
-        // negate (k = -k)
-        Scalar tmp;
-        fiat_pasta_fq_copy(tmp, k);
-        scalar_negate(k, tmp);
-    }
+    // negate (k = -k) if r.y is odd, without a branch
+    Scalar k_neg;
+    scalar_negate(k_neg, k);
+    fiat_pasta_fq_selectznz(k, field_is_odd(r.y), k, k_neg);
 
     Scalar e;
     message_hash(e, &kp->pub, r.x, &input, POSEIDON_LEGACY, network_id);
@@ -100,6 +100,13 @@ typedef struct roinput_t {
   size_t bits_capacity;
 } ROInput;
 
+// Field arithmetic beneath field_* and scalar_*
+typedef enum {
+    BACKEND_FIAT,   // fiat-crypto Montgomery (verified reference)
+    BACKEND_SPARSE, // portable reduction specialised to 2^254 + c
+    BACKEND_ADX,    // x86-64 MULX/ADX assembly (default when supported)
+} Backend;
+
 void roinput_add_field(ROInput *input, const Field a);
 void roinput_add_scalar(ROInput *input, const Scalar a);
 void roinput_add_bit(ROInput *input, bool b);
@@ -107,34 +114,68 @@ void roinput_add_bytes(ROInput *input, const uint8_t *bytes, size_t len);
 void roinput_add_uint32(ROInput *input, const uint32_t x);
 void roinput_add_uint64(ROInput *input, const uint64_t x);
 
+bool set_backend(Backend backend);
+Backend get_backend(void);
+
 bool scalar_from_hex(Scalar b, const char *hex);
+bool scalar_from_bytes(Scalar b, const uint8_t bytes[SCALAR_BYTES]);
 void scalar_from_words(Scalar b, const uint64_t words[4]);
 void scalar_copy(Scalar b, const Scalar a);
 bool scalar_eq(const Scalar a, const Scalar b);
 void scalar_add(Scalar c, const Scalar a, const Scalar b);
 void scalar_mul(Scalar c, const Scalar a, const Scalar b);
+void scalar_sq(Scalar c, const Scalar a);
+void scalar_pow(Scalar c, const Scalar a, const uint64_t e[4]);
+bool scalar_sqrt(Scalar c, const Scalar a);
+int scalar_legendre(const Scalar a);
+void scalar_inv(Scalar c, const Scalar a);
+void scalar_batch_inv(Scalar *out, const Scalar *in, size_t n);
 void scalar_negate(Scalar b, const Scalar a);
 
 bool field_from_hex(Field b, const char *hex);
 void field_copy(Field c, const Field a);
 bool field_is_odd(const Field y);
+bool field_is_square(const Field a);
 void field_add(Field c, const Field a, const Field b);
 void field_mul(Field c, const Field a, const Field b);
 void field_sq(Field c, const Field a);
 void field_pow(Field c, const Field a, const uint8_t b);
+void field_inv(Field c, const Field a);
+void field_batch_inv(Field *out, const Field *in, size_t n);
+
+// Group elements stay in jacobian coordinates: chain group_* operations
+// and convert with affine_from_group (or group_batch_to_affine) only to
+// serialize, since each conversion costs an inversion.  The result of
+// group_add, group_dbl and group_scalar_mul must not alias an input.
+void affine_to_group(Group *r, const Affine *p);
+void affine_from_group(Affine *r, const Group *p);
+void group_batch_to_affine(Affine *out, const Group *in, size_t n);
+void group_one(Group *a);
+bool group_is_zero(const Group *p);
+bool group_is_on_curve(const Group *p);
+bool group_eq(const Group *p, const Group *q);
+void group_add(Group *r, const Group *p, const Group *q);
+void group_dbl(Group *r, const Group *p);
+void group_negate(Group *q, const Group *p);
+void group_scalar_mul(Group *r, const Scalar k, const Group *p);
+void group_msm(Group *out, const Scalar *k, const Affine *P, size_t n);
 
 bool affine_eq(const Affine *p, const Affine *q);
 void affine_add(Affine *r, const Affine *p, const Affine *q);
 void affine_negate(Affine *q, const Affine *p);
 void affine_scalar_mul(Affine *r, const Scalar k, const Affine *p);
+void affine_scalar_mul_batch(Affine *r, const Scalar *k, const Affine *p, size_t n);
 bool affine_is_on_curve(const Affine *p);
 
 void generate_keypair(Keypair *keypair, uint32_t account);
 void generate_pubkey(Affine *pub_key, const Scalar priv_key);
+void generate_pubkeys(Affine *pub_keys, const Scalar *priv_keys, size_t n);
 bool generate_address(char *address, size_t len, const Affine *pub_key);
 
 void sign(Signature *sig, const Keypair *kp, const Transaction *transaction, const uint8_t network_id);
 bool verify(Signature *sig, const Compressed *pub, const Transaction *transaction, const uint8_t network_id);
+bool verify_batch(bool *valid, Signature *sigs, const Compressed *pubs, const Transaction *transactions,
+                  size_t n, const uint8_t network_id);
 
 void compress(Compressed *compressed, const Affine *pt);
 bool decompress(Affine *pt, const Compressed *compressed);
@@ -0,0 +1,534 @@
+// AVX2 four-lane Fp arithmetic for the batch point kernels
+//
+//     The batch APIs of crypto.c (generate_pubkeys, affine_scalar_mul_batch)
+//     run the same point formulas on independent points.  Here the four
+//     points' coordinates are packed limb-interleaved, so one 256-bit
+//     instruction works on the same limb of four field elements.  AVX2
+//     only multiplies 32 x 32 -> 64 bits (vpmuludq), so elements are nine
+//     29-bit limbs and the products of a whole row of the schoolbook
+//     multiplication can be accumulated in 64-bit lanes without carries.
+//
+//     Montgomery reduction is by 2^261 = 2^(9 * 29).  Both Pasta moduli are
+//     2^254 + c with c < 2^126 and m = 1 mod 2^32, which makes the
+//     reduction cheap in this radix: the quotient digit is just -t0 (no
+//     multiplication by -1/m) and only limbs 0..4 and 8 (= 2^22) of m are
+//     non-zero.  A lane holding x represents x / 2^261 in the field, i.e.
+//     a montgomery element a (a * 2^256) is stored as a * 2^5, which
+//     pasta_fp4_pack/pasta_fp4_unpack convert with shifts.
+//
+//     Bounds: values are kept in [0, 2m) with normalized limbs.  For such
+//     inputs the Montgomery product is below m + 4m^2 / 2^261 < 2m without
+//     a final subtraction, and every column accumulates at most 9 + 6
+//     products below 2^58.  Sums, differences and small multiples (below
+//     2^261) are brought back to [0, 2m) by folding the bits above 2^254
+//     with 2^254 = -c (pasta_fp4_reduce).
+//
+//     Only Fp is needed (point coordinates).  Without AVX2 at build time
+//     the same entry points loop over the lanes with fiat, so callers need
+//     no conditional compilation; at run time they check pasta_use_avx2.
+
+#include "pasta_avx2.h"
+#include "pasta_fp.h"
+#include "pasta_inline.h"
+
+#include <string.h>
+
+bool pasta_use_avx2 = false;
+
+#if PASTA_AVX2
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define AVX2 __attribute__((target("avx2")))
+
+#define LIMBS 9
+#define LIMB_BITS 29
+#define LIMB_MASK (((uint64_t)1 << LIMB_BITS) - 1)
+
+// m in 29-bit limbs: (1, m1, m2, m3, m4, 0, 0, 0, 2^22)
+static const uint64_t FP_LIMBS[LIMBS] = {
+    0x1, 0x9698768, 0x133e46e6, 0xd31f812, 0x224, 0x0, 0x0, 0x0, 0x400000
+};
+
+// 2m in 29-bit limbs
+static const uint64_t FP_2M_LIMBS[LIMBS] = {
+    0x2, 0x12d30ed0, 0x67c8dcc, 0x1a63f025, 0x448, 0x0, 0x0, 0x0, 0x800000
+};
+
+typedef struct {
+    __m256i v[LIMBS];
+} Fe4;
+
+AVX2 static inline void fe4_load(Fe4 *r, const PastaFp4 *a)
+{
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        r->v[j] = _mm256_loadu_si256((const __m256i *)a->l[j]);
+    }
+}
+
+AVX2 static inline void fe4_store(PastaFp4 *r, const Fe4 *a)
+{
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        _mm256_storeu_si256((__m256i *)r->l[j], a->v[j]);
+    }
+}
+
+// Carry limbs of absolute value below 2^62 into 29-bit limbs; a negative
+// value leaves a negative top limb.  There is no 64-bit arithmetic shift
+// in AVX2, so the shift is taken of the limb biased by 2^62.
+AVX2 static inline void fe4_carry(Fe4 *a)
+{
+    const __m256i mask = _mm256_set1_epi64x(LIMB_MASK);
+    const __m256i bias = _mm256_set1_epi64x((uint64_t)1 << 62);
+    const __m256i unbias = _mm256_set1_epi64x((uint64_t)1 << (62 - LIMB_BITS));
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS - 1; j++) {
+        const __m256i c = _mm256_sub_epi64(_mm256_srli_epi64(_mm256_add_epi64(a->v[j], bias), LIMB_BITS), unbias);
+        a->v[j] = _mm256_and_si256(a->v[j], mask);
+        a->v[j + 1] = _mm256_add_epi64(a->v[j + 1], c);
+    }
+}
+
+// Normalized limbs of a value below 2^261 -> congruent value in [0, 2m):
+// with h = a >> 254 and l = a mod 2^254, a = l - h c, and
+// l + m - h c = l + 2^254 - (h - 1) c lies in [m - 2^133, 2^254 + m)
+AVX2 static inline void fe4_reduce(Fe4 *a)
+{
+    const __m256i h = _mm256_srli_epi64(a->v[8], 22);
+    a->v[8] = _mm256_and_si256(a->v[8], _mm256_set1_epi64x(((uint64_t)1 << 22) - 1));
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < 5; j++) {
+        const __m256i m = _mm256_set1_epi64x(FP_LIMBS[j]);
+        a->v[j] = _mm256_sub_epi64(_mm256_add_epi64(a->v[j], m), _mm256_mul_epu32(h, m));
+    }
+    a->v[8] = _mm256_add_epi64(a->v[8], _mm256_set1_epi64x(FP_LIMBS[8]));
+    fe4_carry(a);
+}
+
+// r = a * b / 2^261 (operand scanning, one 29-bit Montgomery step per limb
+// of b).  The low limb of the accumulator is the only one carried per
+// step; it becomes divisible by 2^29 once q * m is added.
+AVX2 static void fe4_mul(Fe4 *r, const Fe4 *a, const Fe4 *b)
+{
+    const __m256i mask = _mm256_set1_epi64x(LIMB_MASK);
+    const __m256i m1 = _mm256_set1_epi64x(FP_LIMBS[1]);
+    const __m256i m2 = _mm256_set1_epi64x(FP_LIMBS[2]);
+    const __m256i m3 = _mm256_set1_epi64x(FP_LIMBS[3]);
+    const __m256i m4 = _mm256_set1_epi64x(FP_LIMBS[4]);
+
+    __m256i t[LIMBS];
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        t[j] = _mm256_setzero_si256();
+    }
+
+    #pragma GCC unroll 9
+
+    for (size_t i = 0; i < LIMBS; i++) {
+        const __m256i bi = b->v[i];
+        #pragma GCC unroll 9
+        for (size_t j = 0; j < LIMBS; j++) {
+            t[j] = _mm256_add_epi64(t[j], _mm256_mul_epu32(a->v[j], bi));
+        }
+
+        // q = -t0 / m mod 2^29 = -t0 mod 2^29 (m = 1 mod 2^29)
+        const __m256i q = _mm256_and_si256(_mm256_sub_epi64(_mm256_setzero_si256(), t[0]), mask);
+        const __m256i t0 = _mm256_add_epi64(t[0], q);
+        t[1] = _mm256_add_epi64(t[1], _mm256_add_epi64(_mm256_mul_epu32(q, m1), _mm256_srli_epi64(t0, LIMB_BITS)));
+        t[2] = _mm256_add_epi64(t[2], _mm256_mul_epu32(q, m2));
+        t[3] = _mm256_add_epi64(t[3], _mm256_mul_epu32(q, m3));
+        t[4] = _mm256_add_epi64(t[4], _mm256_mul_epu32(q, m4));
+        t[8] = _mm256_add_epi64(t[8], _mm256_slli_epi64(q, 22));
+
+        // t /= 2^29
+        #pragma GCC unroll 9
+        for (size_t j = 0; j < LIMBS - 1; j++) {
+            t[j] = t[j + 1];
+        }
+        t[LIMBS - 1] = _mm256_setzero_si256();
+    }
+
+    #pragma GCC unroll 9
+
+    for (size_t j = 0; j < LIMBS; j++) {
+        r->v[j] = t[j];
+    }
+    fe4_carry(r);
+}
+
+AVX2 static void fp4_pack(PastaFp4 *out, const uint64_t *a[PASTA_FP4_LANES])
+{
+    // limb j = bits [29 j - 5, 29 j + 24) of a
+    Fe4 r;
+    const __m256i mask = _mm256_set1_epi64x(LIMB_MASK);
+    __m256i w[5];
+    #pragma GCC unroll 9
+    for (size_t k = 0; k < 4; k++) {
+        w[k] = _mm256_set_epi64x(a[3][k], a[2][k], a[1][k], a[0][k]);
+    }
+    w[4] = _mm256_setzero_si256();
+
+    r.v[0] = _mm256_and_si256(_mm256_slli_epi64(w[0], 5), mask);
+    #pragma GCC unroll 9
+    for (size_t j = 1; j < LIMBS; j++) {
+        const size_t bit = LIMB_BITS * j - 5;
+        const size_t k = bit / 64, s = bit % 64;
+        __m256i v = _mm256_srlv_epi64(w[k], _mm256_set1_epi64x(s));
+        if (s > 64 - LIMB_BITS) {
+            v = _mm256_or_si256(v, _mm256_sllv_epi64(w[k + 1], _mm256_set1_epi64x(64 - s)));
+        }
+        r.v[j] = _mm256_and_si256(v, mask);
+    }
+
+    // a < 2^255, so a * 2^5 < 2^260
+    fe4_reduce(&r);
+    fe4_store(out, &r);
+}
+
+AVX2 static void fp4_unpack(uint64_t *out[PASTA_FP4_LANES], const PastaFp4 *a)
+{
+    // a / 2^5 = (a + q m) / 2^5 with q = -a mod 2^5, below 2m
+    Fe4 r;
+    fe4_load(&r, a);
+    const __m256i q = _mm256_and_si256(_mm256_sub_epi64(_mm256_setzero_si256(), r.v[0]), _mm256_set1_epi64x(31));
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        r.v[j] = _mm256_add_epi64(r.v[j], _mm256_mul_epu32(q, _mm256_set1_epi64x(FP_LIMBS[j])));
+    }
+    fe4_carry(&r);
+
+    uint64_t l[LIMBS][PASTA_FP4_LANES];
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        _mm256_storeu_si256((__m256i *)l[j], r.v[j]);
+    }
+
+    static const uint64_t zero[4] = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        uint64_t x[4] = { 0, 0, 0, 0 };
+        #pragma GCC unroll 9
+        for (size_t j = 0; j < LIMBS; j++) {
+            // bits [29 j - 5, 29 j + 24) of the result
+            const int bit = LIMB_BITS * j - 5;
+            const uint64_t v = l[j][i];
+            if (bit < 0) {
+                x[0] |= v >> 5;
+                continue;
+            }
+            x[bit / 64] |= v << (bit % 64);
+            if (bit % 64 > 64 - LIMB_BITS && bit / 64 < 3) {
+                x[bit / 64 + 1] |= v >> (64 - bit % 64);
+            }
+        }
+        // [0, 2m) -> [0, m)
+        fiat_pasta_fp_add(out[i], x, zero);
+    }
+}
+
+AVX2 static void fp4_mul(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    Fe4 x, y, r;
+    fe4_load(&x, a);
+    fe4_load(&y, b);
+    fe4_mul(&r, &x, &y);
+    fe4_store(out, &r);
+}
+
+AVX2 static void fp4_add(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    Fe4 x, y;
+    fe4_load(&x, a);
+    fe4_load(&y, b);
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        x.v[j] = _mm256_add_epi64(x.v[j], y.v[j]);
+    }
+    fe4_carry(&x);
+    fe4_reduce(&x);
+    fe4_store(out, &x);
+}
+
+// a + 2m - b in (0, 4m)
+AVX2 static void fp4_sub(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    Fe4 x, y;
+    fe4_load(&x, a);
+    fe4_load(&y, b);
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        x.v[j] = _mm256_sub_epi64(_mm256_add_epi64(x.v[j], _mm256_set1_epi64x(FP_2M_LIMBS[j])), y.v[j]);
+    }
+    fe4_carry(&x);
+    fe4_reduce(&x);
+    fe4_store(out, &x);
+}
+
+// k a <= 16 * 2m < 2^261
+AVX2 static void fp4_mul_small(PastaFp4 *out, const PastaFp4 *a, const uint64_t k)
+{
+    Fe4 x;
+    fe4_load(&x, a);
+    const __m256i kk = _mm256_set1_epi64x(k);
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        x.v[j] = _mm256_mul_epu32(x.v[j], kk);
+    }
+    fe4_carry(&x);
+    fe4_reduce(&x);
+    fe4_store(out, &x);
+}
+
+AVX2 static __m256i lane_mask(const unsigned mask)
+{
+    return _mm256_set_epi64x(-(int64_t)((mask >> 3) & 1), -(int64_t)((mask >> 2) & 1),
+                             -(int64_t)((mask >> 1) & 1), -(int64_t)(mask & 1));
+}
+
+AVX2 static void fp4_select(PastaFp4 *out, const unsigned mask, const PastaFp4 *a, const PastaFp4 *b)
+{
+    const __m256i m = lane_mask(mask);
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)a->l[j]);
+        const __m256i y = _mm256_loadu_si256((const __m256i *)b->l[j]);
+        _mm256_storeu_si256((__m256i *)out->l[j], _mm256_blendv_epi8(x, y, m));
+    }
+}
+
+// Zero in [0, 2m) is 0 or m
+AVX2 static unsigned fp4_is_zero(const PastaFp4 *a)
+{
+    __m256i zero = _mm256_set1_epi64x(-1), m = zero;
+    #pragma GCC unroll 9
+    for (size_t j = 0; j < LIMBS; j++) {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)a->l[j]);
+        zero = _mm256_and_si256(zero, _mm256_cmpeq_epi64(x, _mm256_setzero_si256()));
+        m = _mm256_and_si256(m, _mm256_cmpeq_epi64(x, _mm256_set1_epi64x(FP_LIMBS[j])));
+    }
+    return (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_or_si256(zero, m)));
+}
+
+// One row is two vectors: a lane compare against the row number gives the
+// mask of each row
+AVX2 static void table_select(uint64_t out[8], const uint64_t *table, const size_t n, const uint64_t index)
+{
+    const __m256i want = _mm256_set1_epi64x((long long)index);
+    const __m256i one = _mm256_set1_epi64x(1);
+    __m256i row = _mm256_setzero_si256(), lo = row, hi = row;
+    for (size_t i = 0; i < n; i++, table += 8) {
+        const __m256i mask = _mm256_cmpeq_epi64(row, want);
+        lo = _mm256_or_si256(lo, _mm256_and_si256(mask, _mm256_loadu_si256((const __m256i *)table)));
+        hi = _mm256_or_si256(hi, _mm256_and_si256(mask, _mm256_loadu_si256((const __m256i *)(table + 4))));
+        row = _mm256_add_epi64(row, one);
+    }
+    _mm256_storeu_si256((__m256i *)out, lo);
+    _mm256_storeu_si256((__m256i *)(out + 4), hi);
+}
+
+bool pasta_avx2_supported(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    const unsigned int OSXSAVE = 1 << 27;
+    const unsigned int AVX = 1 << 28;
+    if (!(ecx & OSXSAVE) || !(ecx & AVX)) {
+        return false;
+    }
+
+    // the OS saves the xmm and ymm state
+    unsigned int xcr0_lo, xcr0_hi;
+    __asm__ ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    if ((xcr0_lo & 6) != 6) {
+        return false;
+    }
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    const unsigned int AVX2_BIT = 1 << 5;
+    return ebx & AVX2_BIT;
+}
+
+__attribute__((constructor))
+static void pasta_avx2_init(void)
+{
+    pasta_use_avx2 = pasta_avx2_supported();
+}
+
+void pasta_fp4_pack(PastaFp4 *out, const uint64_t *a[PASTA_FP4_LANES])
+{
+    fp4_pack(out, a);
+}
+
+void pasta_fp4_unpack(uint64_t *out[PASTA_FP4_LANES], const PastaFp4 *a)
+{
+    fp4_unpack(out, a);
+}
+
+void pasta_fp4_mul(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    fp4_mul(out, a, b);
+}
+
+void pasta_fp4_sq(PastaFp4 *out, const PastaFp4 *a)
+{
+    fp4_mul(out, a, a);
+}
+
+void pasta_fp4_add(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    fp4_add(out, a, b);
+}
+
+void pasta_fp4_sub(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    fp4_sub(out, a, b);
+}
+
+void pasta_fp4_mul_small(PastaFp4 *out, const PastaFp4 *a, const uint64_t k)
+{
+    fp4_mul_small(out, a, k);
+}
+
+void pasta_fp4_select(PastaFp4 *out, const unsigned mask, const PastaFp4 *a, const PastaFp4 *b)
+{
+    fp4_select(out, mask, a, b);
+}
+
+unsigned pasta_fp4_is_zero(const PastaFp4 *a)
+{
+    return fp4_is_zero(a);
+}
+
+#else
+
+// Lane by lane: l[0..3][i] is the montgomery element of lane i
+
+bool pasta_avx2_supported(void)
+{
+    return false;
+}
+
+static void lane_get(uint64_t x[4], const PastaFp4 *a, const size_t i)
+{
+    for (size_t k = 0; k < 4; k++) {
+        x[k] = a->l[k][i];
+    }
+}
+
+static void lane_set(PastaFp4 *a, const size_t i, const uint64_t x[4])
+{
+    for (size_t k = 0; k < 4; k++) {
+        a->l[k][i] = x[k];
+    }
+}
+
+void pasta_fp4_pack(PastaFp4 *out, const uint64_t *a[PASTA_FP4_LANES])
+{
+    memset(out, 0, sizeof(PastaFp4));
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        lane_set(out, i, a[i]);
+    }
+}
+
+void pasta_fp4_unpack(uint64_t *out[PASTA_FP4_LANES], const PastaFp4 *a)
+{
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        lane_get(out[i], a, i);
+    }
+}
+
+void pasta_fp4_mul(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        uint64_t x[4], y[4];
+        lane_get(x, a, i);
+        lane_get(y, b, i);
+        fiat_pasta_fp_mul(x, x, y);
+        lane_set(out, i, x);
+    }
+}
+
+void pasta_fp4_sq(PastaFp4 *out, const PastaFp4 *a)
+{
+    pasta_fp4_mul(out, a, a);
+}
+
+void pasta_fp4_add(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        uint64_t x[4], y[4];
+        lane_get(x, a, i);
+        lane_get(y, b, i);
+        fiat_pasta_fp_add(x, x, y);
+        lane_set(out, i, x);
+    }
+}
+
+void pasta_fp4_sub(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b)
+{
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        uint64_t x[4], y[4];
+        lane_get(x, a, i);
+        lane_get(y, b, i);
+        fiat_pasta_fp_sub(x, x, y);
+        lane_set(out, i, x);
+    }
+}
+
+void pasta_fp4_mul_small(PastaFp4 *out, const PastaFp4 *a, const uint64_t k)
+{
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        uint64_t x[4];
+        lane_get(x, a, i);
+        pasta_fp_mul_small(x, x, k);
+        lane_set(out, i, x);
+    }
+}
+
+void pasta_fp4_select(PastaFp4 *out, const unsigned mask, const PastaFp4 *a, const PastaFp4 *b)
+{
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        uint64_t x[4], y[4];
+        lane_get(x, a, i);
+        lane_get(y, b, i);
+        fiat_pasta_fp_selectznz(x, (mask >> i) & 1, x, y);
+        lane_set(out, i, x);
+    }
+}
+
+unsigned pasta_fp4_is_zero(const PastaFp4 *a)
+{
+    unsigned mask = 0;
+    for (size_t i = 0; i < PASTA_FP4_LANES; i++) {
+        uint64_t x[4];
+        lane_get(x, a, i);
+        mask |= ((x[0] | x[1] | x[2] | x[3]) == 0) << i;
+    }
+    return mask;
+}
+
+#endif
+
+void pasta_avx2_table_select(uint64_t out[8], const uint64_t *table, const size_t n, const uint64_t index)
+{
+#if PASTA_AVX2
+    if (pasta_use_avx2) {
+        table_select(out, table, n, index);
+        return;
+    }
+#endif
+    uint64_t r[8] = { 0 };
+    for (uint64_t i = 0; i < n; i++, table += 8) {
+        const uint64_t mask = 0 - (((i ^ index) - 1) >> 63);
+        for (size_t j = 0; j < 8; j++) {
+            r[j] |= table[j] & mask;
+        }
+    }
+    memcpy(out, r, sizeof(r));
+}
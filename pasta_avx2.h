@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// The AVX2 kernels are built for x86-64 with GCC or clang (per function
+// target attributes, no -mavx2); elsewhere the pasta_fp4_* entry points
+// run lane by lane on fiat and pasta_use_avx2 stays false.
+#if defined(__x86_64__) && defined(__GNUC__)
+#define PASTA_AVX2 1
+#else
+#define PASTA_AVX2 0
+#endif
+
+// Set at startup when the CPU and OS support AVX2; crypto.c runs its
+// batch point kernels four lanes at a time when it is true
+extern bool pasta_use_avx2;
+
+bool pasta_avx2_supported(void);
+
+// Four Fp elements, limb-interleaved: l[j][i] is limb j of lane i.
+//
+// Each lane holds a * 2^5 (a in the montgomery form of pasta_fp_*) in
+// nine 29-bit limbs, lazily reduced to [0, 2m): the kernels multiply
+// with Montgomery radix 2^261 = 2^(9 * 29), so that form is closed under
+// pasta_fp4_mul.  Convert with pasta_fp4_pack/pasta_fp4_unpack.
+typedef struct pasta_fp4_t {
+    uint64_t l[9][4];
+} PastaFp4;
+
+// Lane masks: bit i selects lane i
+#define PASTA_FP4_LANES 4
+#define PASTA_FP4_ALL 0xf
+
+// a[i] is a (canonical) montgomery Fp element; out[i] gets one back
+void pasta_fp4_pack(PastaFp4 *out, const uint64_t *a[PASTA_FP4_LANES]);
+void pasta_fp4_unpack(uint64_t *out[PASTA_FP4_LANES], const PastaFp4 *a);
+
+// Lane-wise arithmetic; outputs may alias inputs
+void pasta_fp4_mul(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b);
+void pasta_fp4_sq(PastaFp4 *out, const PastaFp4 *a);
+void pasta_fp4_add(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b);
+void pasta_fp4_sub(PastaFp4 *out, const PastaFp4 *a, const PastaFp4 *b);
+// out = k * a for a small constant k <= 16
+void pasta_fp4_mul_small(PastaFp4 *out, const PastaFp4 *a, const uint64_t k);
+
+// out = lanes of b where mask is set, of a elsewhere
+void pasta_fp4_select(PastaFp4 *out, const unsigned mask, const PastaFp4 *a, const PastaFp4 *b);
+// Mask of the lanes equal to zero
+unsigned pasta_fp4_is_zero(const PastaFp4 *a);
+
+// out = row index of the n rows of eight words (affine points) of table.
+// Every row is read and masked, so neither branches nor memory accesses
+// depend on index; AVX2 when pasta_use_avx2 is set, 64-bit words otherwise
+void pasta_avx2_table_select(uint64_t out[8], const uint64_t *table, const size_t n, const uint64_t index);
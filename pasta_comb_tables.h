@@ -0,0 +1,2095 @@
+// pasta_comb_tables.h - fixed-base comb tables for the Pallas generator
+//
+//    These constants were generated by comb_tables_gen.c
+//    Generate: make comb_tables
+//    Do not edit this file
+
+#pragma once
+
+#include "crypto.h"
+
+#define COMB_TEETH 8
+#define COMB_BLOCKS 4
+#define COMB_BLOCK_BITS 8
+#define COMB_SPACING (COMB_BLOCKS * COMB_BLOCK_BITS)
+
+// COMB_TABLE[b][mask - 1] = sum_{i in mask} 2^(COMB_SPACING * i + COMB_BLOCK_BITS * b) * G
+static const Affine COMB_TABLE[COMB_BLOCKS][(1 << COMB_TEETH) - 1] = {
+    {
+        {{ 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff }, { 0x2f474795455d409d, 0xb443b9b74b8255d9, 0x270c412f2c9a5d66, 0x08e00f71ba43dd6b }},
+        {{ 0xf9af7636254b4ded, 0xfde16dd55cdc4074, 0x053d85769e209145, 0x281a611cb5a692a9 }, { 0xbe7ae9070b27e61a, 0xfaf6dee0676e5c45, 0xb077db6c4069cce8, 0x0d8046ee0eca53a0 }},
+        {{ 0xf919dda8122f3f15, 0xbaa1318a41c18862, 0x66afdbdcc8f270d8, 0x05ee92e1fc84a0a5 }, { 0x44d82523e297c1db, 0xd8f5ee15a20a2689, 0x6ea05013faea9adf, 0x3a3f906115b19469 }},
+        {{ 0xd3ef3898d7a287b0, 0x27cc6a4a473ff99a, 0x0a0cfab1a987fafb, 0x357c8681257a2b4e }, { 0x01eaf8485b287538, 0x08f39da0fda718e8, 0x2dae9eb7c18d3c2e, 0x2ac54f225d4e6e46 }},
+        {{ 0xde37a47f3258126f, 0x5cbeca66221bf7c5, 0xac39fba85af7e5b5, 0x2c66ec2da5fa031f }, { 0xa5d04b19e98547c4, 0x52c2d2c5c0feec08, 0xf76d32e4eab55222, 0x0d761aeb6ff7b4e9 }},
+        {{ 0x469cdcd3fdbe5214, 0xb2f4919e139e230b, 0xd01d2b2e97cc9ac1, 0x27291545a26fe0b7 }, { 0x38b06adbb1149cc5, 0x24f6a10a99a15a84, 0x2ac3328143bfaecc, 0x2a5f5e49259dd5d8 }},
+        {{ 0xdf37f9c92b36ca78, 0x8399029fbccc6734, 0xc0c9eb659ce6dbc1, 0x07e3b4f8ea655155 }, { 0x671e0b09b4c03b00, 0xe8ac8d5955d499ea, 0xd03991051f93c4e2, 0x2f16c4299336c39b }},
+        {{ 0xb53592294ba84d04, 0xcedc2e3dee109c08, 0x6042ccc671437d1a, 0x29d7c06063f7bf14 }, { 0xad7418f63b3fd913, 0xd3abbcb2c3ea1762, 0xddb0b2337cfa0b75, 0x060c44845d5f3dfb }},
+        {{ 0xd29edfff735609a8, 0x24413cdb4438bf6e, 0xf7d93f4c2459d797, 0x24a915283ef943b0 }, { 0x02be1f7ab8892470, 0x647a106b4e54282b, 0x96c920cc8e3bc54c, 0x1cf2d8e39c6e4f8f }},
+        {{ 0x90c8e518060c8071, 0x1c26872822a655a5, 0x29c400b31e93a5fa, 0x364dafc4a4902a88 }, { 0x01d0bc2ed8e3221a, 0x5c8c7935f542503a, 0x432a7ee52f2a081c, 0x05733e01b3d9113d }},
+        {{ 0x83917ad66112ae11, 0x779cf8900148302d, 0x9e79d21cdfee1f4e, 0x301e00a64def2710 }, { 0xd959423643b2263d, 0x24e0bf481517011c, 0x9c6e2d98df9a767e, 0x1113ad470d078013 }},
+        {{ 0x828de335b4e64d2d, 0xb9a6cf33a0c557f6, 0x810d1750c37f8fd9, 0x219d066468c6e690 }, { 0x54de37ed6a7225ba, 0x872bb00864acd83f, 0x3fb0b20eb79fa2f3, 0x3c4e10f126314ba3 }},
+        {{ 0xeaa04f56aa25bc3e, 0x09628532138f42dc, 0xc439c089ebfa88c9, 0x3938748244718049 }, { 0xeb5420898e7aad53, 0xea2109b1e90d867a, 0x0deab74753fbde78, 0x3ef17ee19c201b2c }},
+        {{ 0xf77a12e180253fa8, 0xeeb7c474b2fcd098, 0x4efe67690c10cd85, 0x0f5bce35f74b00b5 }, { 0x6c4b9564899a2255, 0xdb4d1e11edb42cd3, 0x9c211aa75b090f78, 0x25ab1c279928c001 }},
+        {{ 0xc34efdcd994816a0, 0x667b574cafac2dc7, 0xcf5f0ecfb246db0d, 0x269db32c59666ee2 }, { 0x3780ee7b2c9d5480, 0xc0b0208af479bb82, 0xc21de8d3011b4d07, 0x3a7c5cf08070c3fd }},
+        {{ 0x6f151a89b363135a, 0x1d21718614519620, 0x32825b77b8ac503c, 0x1c8b5c8d561a9d75 }, { 0xb161e3182cb81e9f, 0xa3d01fe9ee651f57, 0xdf9557f0fc34015e, 0x067a2b851a861c46 }},
+        {{ 0x1d31fd60c36d627e, 0x45ba9d920a23540e, 0x9159836fe78cc89c, 0x16e8914fb864859a }, { 0x38deef8cf33b03b5, 0xe3dc38c449f1390b, 0x381579b8379ffa0a, 0x004cbb4d19387cb6 }},
+        {{ 0x975cc632aaca39f4, 0xc518b318f81125da, 0x8d9979f0f941a5ea, 0x3cf2fbeb93591257 }, { 0x04c3f982ecd0c001, 0x8c6e89cfcf58fe85, 0xb972645e76ef084e, 0x2e1753b16f847027 }},
+        {{ 0x59fce360853127ed, 0xa3a52f4198122461, 0x050acc9244503cc0, 0x10223d7f99c02f8f }, { 0x7c1ec643dc21b0c9, 0xd5ff5aee43185d90, 0xdabc97129128a27d, 0x0efaf905de616871 }},
+        {{ 0xfd7cf8774a99b403, 0x7440be6f3d586394, 0x82455d7a1a30f3a0, 0x31e9e75d46cbcea6 }, { 0x4153d189306af847, 0xa8280c84a0a24588, 0x06be3c3139912f66, 0x2ee69c2d1402eaab }},
+        {{ 0x7f836b40cf90436f, 0x7c87b6ce5d356aad, 0x788850f2b448acac, 0x0c433a78eb5b3dc8 }, { 0x051c44eec66869db, 0x3ac5821c4a9ec8d8, 0x9275f867db9e7a02, 0x2334026288d647fc }},
+        {{ 0xb647d1c7dac2363f, 0x6e8d5bef27c13456, 0x74d8659e07f6d918, 0x3351791d365c86b6 }, { 0xde211c6266ea3d02, 0xe3a65b78a61194f7, 0x017eac69d9dfa60e, 0x3f6e9f134a40da85 }},
+        {{ 0x2b8c0e21dbf51b18, 0xd18f3742c5c720aa, 0xb8ec032d51c88152, 0x3aa939b66e3e5ac6 }, { 0x378ea1a03f1d1824, 0x0aa67175cd0882e2, 0x36354a0ded9a9863, 0x34cd9b96ff89d43c }},
+        {{ 0xd2d825169c6591be, 0xb2fe318d318a38be, 0x7b43b181ed52ae73, 0x0ec4aaf98b0810bb }, { 0xbf15abc598342fc4, 0x9a04cab36a71f332, 0x14ccff73917eba06, 0x33d07a03bd095aa8 }},
+        {{ 0x389981a9b7d81592, 0x1bd6a88adfc504a2, 0xc81c750fdca1f1fa, 0x06b6ac1af4f6fa75 }, { 0x0a47e99746235991, 0x28317ddecb5f0472, 0x690299eac0ae0c00, 0x2f4687f831f8dc9c }},
+        {{ 0xe843a7c95a4d3014, 0xe11d1b4bf7cc2476, 0xb09a6d25eaeefb65, 0x2dc43efac37d6861 }, { 0xc69e9ade49356af3, 0x32340685d23aa0da, 0x50cbce6e3018d753, 0x0872628ed7995104 }},
+        {{ 0x3439861669c087c4, 0x5c0285c053462186, 0x525be9b7b7eb0744, 0x19f0cfb82a81a823 }, { 0x9817eda45f79c799, 0x71266c9d9f31a0a1, 0x4a93ab34a7dff5ee, 0x1deae4e4a40ad0eb }},
+        {{ 0x4e14d66ca8bfb383, 0x855f61e5299e6971, 0x54702df9bd70c921, 0x2dd1d84449caa728 }, { 0xa814ee4f34599716, 0xb61ed0260fcdbc0f, 0x93412b2c39923392, 0x32efc4b8ac2572bd }},
+        {{ 0x975caf090f00658b, 0xad586a34c62c008c, 0xdef130adc9b43571, 0x1e491a5be77fad7e }, { 0x9fed870f263d1127, 0xb93fa876b3fe63f5, 0x7b40ec6f404a2c55, 0x083d1f730d3997fb }},
+        {{ 0x83eff1600522e306, 0xab7078aae9f06555, 0xd15a8ccb4d5f9937, 0x07c4b2a70c5a15a8 }, { 0x833cd51d0eef3287, 0x80e1c6501f46c494, 0x3184a050b346947e, 0x050b9dac667775e6 }},
+        {{ 0xc2e88c7ce4a72f9c, 0x79043253ea8477dc, 0x849b271dbffc1fb3, 0x1a70d2f9ec3f2aba }, { 0xa7152b65568eb007, 0x3026955691553394, 0xd8c86c40307b0b60, 0x3b7eebfd2c67dad8 }},
+        {{ 0xd925cca1350b46d9, 0x12396f787b08f72c, 0xc4f2603f76371905, 0x365435e17783b009 }, { 0x063a9c4b15a112f3, 0x41b7e03de76b23cd, 0x2ee0cc5ba576f474, 0x0079b0c450e1e617 }},
+        {{ 0x65c70baaa8f13211, 0x2531c20ccd8a6f37, 0x6b0a92483c518469, 0x28713e68b2c6291e }, { 0x6c6c03783ec6f894, 0x9c75fc2b809c4cc8, 0xe0ceafc507bebfd4, 0x32cbb72c27e6e7c6 }},
+        {{ 0x3e211fa02c4f80bb, 0x070489e8dcb28078, 0x210d50544753bd8b, 0x1ac411bb5461368b }, { 0x0981322156b6947c, 0xbf49ae82c962f139, 0xacd08d012edbe7d0, 0x1699c986f3d72c1d }},
+        {{ 0x76aa9c51ad2fa381, 0xcfacc785b0363136, 0x2c4a45124ef37f23, 0x0529b527a9612aa7 }, { 0xd94e5bad66299c02, 0x0dc17f95713aea4d, 0xf9ac1f932e67e58f, 0x1376cc3ed660f8c9 }},
+        {{ 0x1e12c0d9ead80504, 0x1eb3517a88c00d88, 0x9ae718b1a86f00ec, 0x3ba1dbaf8678c759 }, { 0xb761ec7e747858fc, 0xb195747caf0aaaa3, 0x43b61e2c20e2ccb5, 0x05da74b18a5c8218 }},
+        {{ 0x2f17aaebfa4f2219, 0x799126d436ee9daf, 0xb670ed3ca3dcbf7e, 0x16e173df3538c705 }, { 0x76a93762fb9601be, 0x13d4dc0244d4e21e, 0x52e66b0d30f0fa8f, 0x01e57445e7635e91 }},
+        {{ 0x3e348c653b1906f0, 0x8587c149f7d43127, 0xa88d3231a843632c, 0x306f8c0ed3aecb06 }, { 0xd19498c7cadcfc19, 0xaa7c6d7d981eadd5, 0x3ab039e01d9767a3, 0x1a181ea3fafc54ec }},
+        {{ 0xd18be2f1db067654, 0x34b47f8d0e742d6f, 0x2649129302bd09ba, 0x1575a42595c800bf }, { 0xe32e85b13b06ca93, 0xe29df1fe94b3604a, 0x4a9fdedc7fa4f90e, 0x3cb7da93d185d837 }},
+        {{ 0xd75880b5e39096c4, 0x0ce6226033919fa3, 0xe3924a0fdbc33bc3, 0x1c0c4885f028c2c1 }, { 0x36fe7742b5211388, 0x596985e4f44778c4, 0x60c5ac0e000d4375, 0x2fc659767e8a831a }},
+        {{ 0x5b894918f5646ee7, 0x833509213208ea17, 0x1fec76c952759cf8, 0x056ddfd8f2097dd3 }, { 0x15db595822fe298d, 0x462d10569c7863f4, 0xec9d76ca085bc8cb, 0x1e3b25bbf25c65d0 }},
+        {{ 0xe5a5afbfc8bd58b4, 0x08611dc645ac100e, 0xb386507f9ff0b395, 0x3df03ce74f1a4665 }, { 0x84ce19dab432527b, 0x91747dddf19e3ad4, 0x89404ea4bf9f3187, 0x0113eee6751b52da }},
+        {{ 0x644a84a62e31947a, 0x36210d33a19dd7b0, 0xa9f29bf6ab5051ec, 0x3ef5823ac1121763 }, { 0xbdc170dbd50b3707, 0xa3f646e250a67feb, 0x1c3cadede3e59ebb, 0x2e5cb45726e240dd }},
+        {{ 0xdf650ec0824592d0, 0xe89690c4188121e1, 0x4f73015675babdd3, 0x161eacdc553848bf }, { 0x940d6398e0353423, 0x9a696dfead8637ab, 0xc181550abf7caba1, 0x0128a58d253a8a8b }},
+        {{ 0x7bb9c56f3e393b5e, 0xbd14251e935249e4, 0x2ad5a0c2841c5f8a, 0x06d41ec841404917 }, { 0x08cea0701ac1ebc1, 0x53e5a2f26d2a4768, 0xb6a94abe2240f688, 0x20a4625e2a9379b0 }},
+        {{ 0x7c39a5445899555b, 0x56ab3290d7786d8d, 0xf7d16d8c94b521dc, 0x25a0a0775f5faa65 }, { 0xbc865743471357ad, 0x2dbf2bc342a00a43, 0xba1b1e51a7a6e85b, 0x3ded8d7602c04bdc }},
+        {{ 0xd76a25db9313b24f, 0x557bc104536cfd68, 0x1c1dafc97c33f8ce, 0x206eba3f9bb6f645 }, { 0x680f1726ede9f40c, 0xc08096571454f9b6, 0xfda2f2744374a6d5, 0x1dc82129b0d26246 }},
+        {{ 0x228ad26c7966d5b0, 0xea0b9451fd2d7cc6, 0x379990f9acc23c7a, 0x05c29872e47e98e8 }, { 0x852eeb0fb5b60ec5, 0x352d4fe7fe7b9f9f, 0x81fd2f0258b55e72, 0x07012271db6a7399 }},
+        {{ 0xb04ab883078d66be, 0xf006977d29344b51, 0xc294120bc2256fa2, 0x0c95497bc5409bdf }, { 0xb51c0c9da6b1c0e8, 0x480a98b927940841, 0x6bbf2e0fa6397061, 0x0995f3b94397eb34 }},
+        {{ 0xdb86e782cf92cd03, 0x2aa78839e64f5e50, 0x9db34b767632db7d, 0x0dd742bd4b33b890 }, { 0x1820adef1af1fbfc, 0xdd35db9d88e7d2d2, 0x579fe5d1b123b393, 0x0e79d2d4e06b47a7 }},
+        {{ 0xac27d18844d23952, 0xce928e68d0f7b805, 0xf21442772c00b8de, 0x246e14d172bc248c }, { 0x4306df44fa913d91, 0xfe91d993f28baa65, 0xab8f8122dbba2225, 0x059c789c19a7c360 }},
+        {{ 0xe04ae0d00327218c, 0xb81b23977fe45507, 0xdf402df90e04b1ea, 0x397a89f085e1201b }, { 0x9436a9e39534528d, 0x88dc023fd73f3563, 0xc25500ef53b638ff, 0x36a216c39cd29597 }},
+        {{ 0x9dcac80f31e5c365, 0x96e868d83291ab98, 0xab26ee5382ae4203, 0x22892577a883ad12 }, { 0xd6638d7a6feb7389, 0xdf543111f02325d6, 0xe7e29a689ae60b7a, 0x2456bef54de7b3db }},
+        {{ 0xa5180bf6f5d2af61, 0x67b746ecc8a12426, 0x30d7487587270067, 0x11bc640353d3352d }, { 0x19ef60ce38895cc9, 0x33cc56aef7017c3e, 0xa48074b1a22d939b, 0x372fceea5b1569b0 }},
+        {{ 0xbbb95854c49fe6c6, 0x57051ba3ee592565, 0x1cdf8e8b108af234, 0x109c8dcf51b781fc }, { 0x40c62c4716d91fda, 0xc4c321da68cafd00, 0x65d8d72d8fd82e08, 0x1f10559337389e8b }},
+        {{ 0x23cb71235113c1cd, 0x3b13a6e37ae4043b, 0x7336b43dc9d757de, 0x3b32a2b1a247d633 }, { 0xc69409908448ae67, 0xd0035b361d621a30, 0x28cd9d9601b7f0c0, 0x1a192efba14cd7a4 }},
+        {{ 0x3539766284684961, 0xe62772946bbebdae, 0xa111c395584063e5, 0x18d49abb6583a7bb }, { 0xee3d57e7cad55b4a, 0x648160f4206db533, 0x887d54e6a1f4d623, 0x35ea49247dcabb52 }},
+        {{ 0x9bb86f607ba15b14, 0x4ead315e003584cb, 0x41eaa6397c4b8480, 0x2b90165371445d04 }, { 0xa4cea643d8ac629c, 0x7116986cfa135bb5, 0x10683a13fe897130, 0x35658da694ad4bb3 }},
+        {{ 0x0de9e58a27bc61bf, 0xdd0ae2678e6ca24c, 0x587197e5da304b78, 0x042e5660a9e82272 }, { 0x2387d4b60015ccbc, 0xeacfaffb84422234, 0xd925e1cfcee07457, 0x130818567606055a }},
+        {{ 0x57e3d3fb6355f57d, 0xc88267150fd66324, 0xc106f72b9e6981b9, 0x098dcecd9cc8f17f }, { 0xf00300c4b6a9fed4, 0x8f3461cf413747d5, 0xbb93ef28d4e528d9, 0x101865af6b8f7e09 }},
+        {{ 0xd73add9ec3afe70b, 0x505fcce282c1b0f8, 0xa44ee4343323c144, 0x1c7d4573306ace09 }, { 0x97b2584e8482d09d, 0x2fd032d83cf6febe, 0x9751ad89121261fe, 0x247935173711f656 }},
+        {{ 0xb9d62e208578bbb9, 0x88ca503f6a2238b8, 0x11282cfbbb6b9d30, 0x30c2dc3dd5f463fd }, { 0xcde0e3b9a2ed1afd, 0x8f7492fa2c713e88, 0xa20cf6f42fcda81e, 0x0a9b0324297aceb0 }},
+        {{ 0x90f257be5c49a69d, 0x984234c2e7a75b26, 0xac1fcd94b6cec4cd, 0x0e93653ea06d74dd }, { 0x2310ffdc0bccd290, 0xd66c18faffa4e96d, 0x38e54c71bc92a4e1, 0x397c73374a4e3cc8 }},
+        {{ 0xf7a944552fb5acf1, 0x1fe1f5594d8f7930, 0x3a39477099a9ea1d, 0x0dc87c0e0b2c6b50 }, { 0xac1bb47409e0a7f9, 0xff2cbfd5dc286df2, 0x8485922a590931c4, 0x3419e0e5f780715d }},
+        {{ 0xbaf0f771151f305a, 0x236b841b03d9ce8e, 0xbc658529d046e834, 0x0f7184c70f6e90c7 }, { 0xfb785469813ef6f0, 0xe767035be897911f, 0x8b10c72b7d9b5a7d, 0x149f95d5f22178a1 }},
+        {{ 0x4829c06d10644f0a, 0x18abea4aaae1e9d8, 0x9e1d580dbbb20832, 0x16f04a5a8f000111 }, { 0x72532b5069c7dd6d, 0x4a114c79a0376bec, 0x76c3e788b8b19bad, 0x2e8516f2aa86eb6f }},
+        {{ 0xae244b27eacf8e96, 0x60e90a09ed77bdf4, 0x52be12663b1e11f2, 0x138b03324aaada48 }, { 0x9a46b76c4081c20c, 0x143fdf9dc117dca1, 0x31dad0bbd5aac1e7, 0x0f2decda31ac1bf5 }},
+        {{ 0x92ec273c0e33343f, 0xad38e18d4a438b35, 0x5d395d831de1cb62, 0x355e016398b4f3cb }, { 0xea09d5bc4f96d7d6, 0x1708b56062478009, 0x93cf63ca56e483b3, 0x21812eae3726fba8 }},
+        {{ 0xaeaf6d659324d51e, 0x9ce062ecae621e87, 0xeab8965b23139297, 0x3a5970744b75ded8 }, { 0x10041997749ab115, 0xedeec8a514bf9821, 0x0a7d305139837236, 0x1386a33323006dd3 }},
+        {{ 0xe51576ff1eab5146, 0xefc7152b9893a2d5, 0x3823cf3a353ef923, 0x1d91221021a1b41a }, { 0x2b1bb30cbbb683a2, 0x2a51dcc78e2acfae, 0x3f3a94222ee3b4b6, 0x02776b6b98614506 }},
+        {{ 0x9e39df927a81ac43, 0x68e74b446f4b93ce, 0x158edbf0ac458991, 0x175080d0e36e6130 }, { 0x80dceca914aa247e, 0x506e0b0fc1abd2f8, 0xed07765ee89f6474, 0x31d2558ea3fb7656 }},
+        {{ 0x2abf24137fc7d51e, 0xd077751442017cc1, 0xe1482033e109b09d, 0x300ad3e39d8b9aa9 }, { 0xcaa30e4d3309b28e, 0x9c50cc5b23f157f9, 0x2c72e1a1e47dff09, 0x10c706ed8af03cbb }},
+        {{ 0x295c46ac155b1ed9, 0x1545cae6613d4671, 0x7eee7889a538b964, 0x195741f247b43cd6 }, { 0x467123bad4e3145e, 0x1172d738398739f0, 0x0dbcf02d28dffa93, 0x39b729780ebe1633 }},
+        {{ 0x70d7cf5ad54ab728, 0xa797e002249f5943, 0xdbf33974bfe901c7, 0x223bcae2be6ba3be }, { 0xc997a8daf081618b, 0x004db95a6c7ad7fc, 0x4dac67a823362afe, 0x10227fadb0313afe }},
+        {{ 0xb1f528f9ef04ef67, 0x24f55e86a10e0bb7, 0x098bc301762d3bc2, 0x05345daee824fddd }, { 0x5a137fc2251a6a34, 0x0b1fb1836914ba31, 0x23e312b9bdec401d, 0x08ecbe84e7bfe437 }},
+        {{ 0xe5db8cce5b247674, 0xffb797f047f49745, 0x8955b9a3be81cb44, 0x3d31c3b8663dfc4c }, { 0x2c30fabf4ea3e128, 0x1eabe84ea136e0a5, 0x31e05810d078fee3, 0x1e1fc004b68560a2 }},
+        {{ 0x0cf2b554beda1caa, 0x298dc9866fae1325, 0x3e063e77053ec840, 0x1b5ffe2865e3d55a }, { 0xe4c9575f935648f0, 0x85e4a57b9e73abfe, 0xc95e092d72da8413, 0x165b9372346bcbd6 }},
+        {{ 0x17848f4ae45b8123, 0xfbb29b3ccd0abe5e, 0x5b11d521592818a3, 0x14571d5bd885e617 }, { 0xa34b8e2f605b7f79, 0x130bf0a2c20188c5, 0x380134242e72e22b, 0x3d8f7b87d98f7f13 }},
+        {{ 0xb9f141fcd4fc5350, 0xa1640c08a83d0787, 0xa7537725cbf108d0, 0x0dc8c610d4a38900 }, { 0x1648d1c389d9bc22, 0xb5854d55bf3ca4ff, 0x4a4790eb6107e4a6, 0x2788358ef8902369 }},
+        {{ 0x462ce7f1bb005c1e, 0x47c486dc2d803940, 0x99521a0db1de83c1, 0x3c19e17006a4af9b }, { 0x51e3875a7987afce, 0x25e0189a563aec38, 0x8a5fa08c0b5581cd, 0x3a1510af22fc53a5 }},
+        {{ 0x7b31f7c8f27c34ac, 0x49a6ac3705334e2b, 0x24fde680657a8442, 0x0c7d1eab055e2b01 }, { 0x8b9aaf92e4413594, 0x3402e9fa2dabc6b3, 0xc6ff6e0feb7a25ae, 0x23b4871ec83a8816 }},
+        {{ 0xc4614a17d86a50f6, 0xf3030281bbfe56e7, 0xb32032ded828dfa8, 0x0ad6a0aa420c77b2 }, { 0x972b87827f2e1d6c, 0xd398da25e593425f, 0xaf1553070763b748, 0x005bdd6b0b2b8f16 }},
+        {{ 0xdef676f8fe64eef5, 0x1de7295c516a13fa, 0x84a9d2d339b28d92, 0x39b10f34be8d8ca4 }, { 0x7fc7117a4a9efff4, 0x8b626d04a0493b1e, 0x79d3bd3e7f7c8027, 0x158c7d1ede5431ef }},
+        {{ 0xbce321c73ab44c6f, 0xb82f478e0eaa0d37, 0x186bf9f2131ae437, 0x293fe697597f9d7e }, { 0x61ee9c0537fa3dca, 0xa0638f5dc3cc0e7e, 0xef3d176091b4b15a, 0x357267798afaf815 }},
+        {{ 0x7b95f210d0f68a4a, 0xb8100155b3719860, 0xb4fec83145ce2888, 0x32e5ea1107efb98b }, { 0xb4f4099a0df67df9, 0x72adadc293389160, 0x7df565ee76c0f872, 0x1a219bff799cfacc }},
+        {{ 0xca2e376349fac59d, 0x8d5f1c54070fac01, 0xa287f2d48482b075, 0x06cf8bcbcb4fc266 }, { 0xec4abd2c015979db, 0xaaf3a6761a7d580b, 0x3cd9a293fde62058, 0x0344f76147e01d96 }},
+        {{ 0xdf35a3afc1bb50e6, 0x2d1a9830fae2dee0, 0xc044a5ad88364d78, 0x02ffab5941c669bc }, { 0x94a23caed45e1d4a, 0x81b206eb5c5b79ef, 0x0be9963753da011d, 0x1fd24e6fbc462b73 }},
+        {{ 0xac3d239a99261e2d, 0xe48b8702172f7ff6, 0xabdda6277c5494bf, 0x3d7d267dacb47cdb }, { 0xc86f5c9ab310bcef, 0xfc009151445f8220, 0xbc07696bab077917, 0x01019d1c99752501 }},
+        {{ 0xd3540e18ab73b0e4, 0x64c38a07afc65614, 0xcb1504f435c00fdb, 0x1aa5909f0affc2a3 }, { 0xb67168685711e372, 0x4b8903c8c877068a, 0x6b59aabb4861e05e, 0x104133fabd44ad42 }},
+        {{ 0xfa238268986c8ad0, 0x0776f1fb00a7b41b, 0x0290c5c9f3e22234, 0x16237395fa00aece }, { 0xfc5106ea39e8b2fe, 0x23010976b9d46c82, 0x3d9549f2f89067dd, 0x18e2f608d1969d31 }},
+        {{ 0x4ea77ac3c2ce88a4, 0xcb14317e33ca62e7, 0x22150f0fee6e3c50, 0x342677e79d602f00 }, { 0x4d83335f98532c7d, 0xf8625ce7c0435b99, 0xed0374511ff93bf8, 0x0db3eecb52ef2600 }},
+        {{ 0xced02b98163c953f, 0x36254dec00d06d92, 0xfb8ae321f74e00f2, 0x05d84835cf54cdb9 }, { 0xe5f3ae773cbca104, 0xd1758661320ced57, 0xa9349f1481acbf80, 0x34d4d71935faca25 }},
+        {{ 0x98cddab139d92da3, 0xd630edbd0c167e2b, 0xdfa4243dae3d9e26, 0x09bf3d6f2b18adb1 }, { 0xf560e9cef1eb236a, 0xb570b80021ff8922, 0x07c0158104d26e92, 0x229344861b683a7c }},
+        {{ 0x41dd34a7539576aa, 0x88f51b44a2cddb6e, 0x48591a3c27d49123, 0x236a9193e58232c9 }, { 0x0980cb3e2ea31676, 0x0f17eb0c76d7b527, 0x23a6ce3f88a364de, 0x2921e9d0f434bae8 }},
+        {{ 0xc921a96a345b79e2, 0xa2a2382dd931fe12, 0xd4f0dd705e086bbe, 0x1f0ce780fe630d03 }, { 0x6cc79bf8d42f868d, 0x4813584e7ca29e1f, 0xf23db2634e601525, 0x0fe438824382c4b0 }},
+        {{ 0x66ef544e76ef6506, 0xdb18c6e8ea2b1672, 0xf351aedd057bdf05, 0x08a79efe627725a7 }, { 0x9a4fb35c77a6825a, 0x7d8777b7c23edb2d, 0xa70fd194e0252c2c, 0x38f17da2035223b0 }},
+        {{ 0x714e3c543ee94bcf, 0x2dc3eefabcf3a274, 0xecf0b05560bd4e17, 0x3d60caf48804f6c2 }, { 0x6943f33883e3b863, 0x062083ac60d86eff, 0xd799fcc528637702, 0x2b138a029e765075 }},
+        {{ 0x7f969ef1ea034e4b, 0xadf865ce25f4bb3e, 0x974c69b224543477, 0x1e05a6b44445fd42 }, { 0x329ca366d11dd38e, 0x3d26fe51abf377d6, 0x4d2fbadecf5ae4bc, 0x1be54b68d1a6506d }},
+        {{ 0x719b58baf246508b, 0xfad0db2ba998971f, 0x05a304cd87558659, 0x295b1eab7da60168 }, { 0xbfeedebd873624bb, 0xea4c69577756e046, 0xc4dcbb51593ee4a3, 0x271babc27efbfba4 }},
+        {{ 0x24b1c4b14815e444, 0xc60c15444aed5eea, 0x4c7d71b8f7a6b9b7, 0x30d33e2d16221caa }, { 0xfb9bfbd43e56184d, 0x533e4b53e843893e, 0x826264ffebf6bdec, 0x03905c62dd445c2a }},
+        {{ 0x73e75e0aee3028c7, 0x35dc15f15c21b8f1, 0xfce8b9d97baa1053, 0x326d835938d4f7ed }, { 0xa26aaf7db3dd54c3, 0xb2fc3ab9c245ea77, 0x2651e498a51576a0, 0x3844a262458e850c }},
+        {{ 0x615c4ae524ef3d64, 0x3756bb91de707b9f, 0x82883363146f230d, 0x1d75a94ff75a759b }, { 0x6690064446ffc7a3, 0x7d97b815be78bad2, 0x0a15afa8582ef02f, 0x0942db716bf0ae8b }},
+        {{ 0x0821c2b4c9f16248, 0x2b562eb150e70cfb, 0xcf6af9be57c6cac1, 0x382b20bc267a506e }, { 0xf698723ce5f8545a, 0x8e043c1e2d6ee876, 0x5a3ca7d0643d50c0, 0x182d316c6c7c9f75 }},
+        {{ 0xa99d51b4ae80d489, 0x59244338e7e563df, 0xed831807c169915f, 0x0297b93f7f4becc2 }, { 0x319f3f3699c6b81b, 0x2729796e3ebfb929, 0x028cbf69a636526f, 0x1d8ccb8a037d0b3d }},
+        {{ 0x32763256db5f2fd3, 0x5100bab7e9673a47, 0xa11a7f0b351d600a, 0x2881ee1a5a57ec7b }, { 0x1b8e0f92441034c4, 0x5e69231eabafc26e, 0x364364b24b4a1d99, 0x38611b383ee4cbd0 }},
+        {{ 0x95da41fe537c64f6, 0x90fb9dc8603d234f, 0x07248072eb963912, 0x102fe16ec585e394 }, { 0x23f2af4db97824f3, 0xc0f707778301c9ef, 0x530e132b16eccc5a, 0x1a94bf3a28972a6a }},
+        {{ 0x189cacddb3f529ae, 0x703c1b4c4d7dd7c9, 0x19a60ea5e53bd913, 0x207f3cd500c01b77 }, { 0x6a09a6b8b7034c0c, 0x7e2eb1b1e44ce7f8, 0xb2abeaecc34b84ff, 0x040322e6f13b13bc }},
+        {{ 0x36d50d7dda6efb75, 0xe0d66ec3cbeaed63, 0xfd9d37b292797223, 0x344c12af115c24d1 }, { 0x274c13fd989f31dd, 0x79a795b00829df3b, 0x39114cac3bbba92b, 0x1024a66b6305c270 }},
+        {{ 0xc72942fd6ffa8bcc, 0x41f0dd087a194894, 0x08245fad542b7959, 0x356362bd6f6813a2 }, { 0x50182501fe26331e, 0x0993842999d34259, 0xca66edbd15096410, 0x3073b25f0b7415b1 }},
+        {{ 0xdc1bce9d1326b19c, 0x6255eaee6f15ad39, 0x8037b9bca8e7b006, 0x1abaef0f2b313c12 }, { 0x4415b0a08e886559, 0xfa97e3d036089671, 0xf3ae6b8e6efb3679, 0x27010591d1ecd805 }},
+        {{ 0x14ea7c0f01eb80c8, 0x04aaa96f3671af86, 0x993e42d9a4fa7939, 0x2c0f09620d660623 }, { 0x78dab7cedb38c189, 0x6fc2c02fc691c27d, 0xb260dc8320317518, 0x1910fe2db8942437 }},
+        {{ 0x0c2f553eef759040, 0xdd9973757209782b, 0x0c378f111c3f25c0, 0x379dd1191974acf0 }, { 0xbc61855e7568a5ad, 0xfb61f72a5c3fbb6a, 0x0e22531ef4e8d365, 0x3a89c7098c1edee0 }},
+        {{ 0x77bbf6f9e53be696, 0x5137d8519e1a7b38, 0x4aefaeefa4ac5a43, 0x255d623349a93386 }, { 0xcd04f96272b3e2e3, 0x2d8888b24ab9d7d5, 0x7aaf65ecc38d647f, 0x292f04fbbb5b0025 }},
+        {{ 0x6863ee983cd62207, 0x9fa4067789d991dd, 0x22af238d661a54ea, 0x0c52979ec991f562 }, { 0x303df1770cd52c47, 0x9ad7496e5230cffc, 0x56d8d49ecb690117, 0x1d053f8f54ceb666 }},
+        {{ 0xb6f23a4cd2621aee, 0x1458bc91a79641cf, 0xcf26af009e120797, 0x18284059091b8d45 }, { 0x9a2c123df2c857d8, 0x9d28b97090230799, 0xc0571f9294352e4a, 0x1173c122a7bdd1f6 }},
+        {{ 0x50752ee267ba521f, 0x138f721418a3d77a, 0xfbacfa91360b5f76, 0x130c55428d57a4de }, { 0x001dac26d75c1221, 0xcb23b47d8e60f1bd, 0x6c861c84cc47250f, 0x0f42c33aea4415b2 }},
+        {{ 0xa057d1fd84bebd87, 0x3f7a3349bd3dd284, 0x8d4fe2a398ecffc2, 0x0693122995452683 }, { 0xf06379152db01f55, 0x814fb789b0450a2d, 0xd3c3a283ae0db71a, 0x1a26c41a0836ef39 }},
+        {{ 0x13f43084844caa27, 0x21d9481cb5a1dd11, 0x305119d684a09656, 0x01cf0623c898e555 }, { 0xcd8745ebb9461afc, 0x301d971ae16e9fee, 0x92efdf0e6d092654, 0x12b528ee5363e31f }},
+        {{ 0xb11cd54a1027a2b9, 0x208ee6f7c8680fa1, 0x2e51a10d0e67988a, 0x10b3f3c959607bb3 }, { 0xd103384eac298e97, 0xb003a9aa4bb8ac7d, 0xdee93e127781e3cc, 0x0bc1df163ca31324 }},
+        {{ 0x6193173d400ff726, 0x85b17c9e84dc801c, 0x181589c89892eec6, 0x0255ec3e2bce4a95 }, { 0xd0cd5edfad8a1c92, 0x538c0ca5e3df603f, 0xbe21092241a995e2, 0x1f19ec2128e4fa37 }},
+        {{ 0x2bcf50aa09ae8991, 0xf9a068b135ed426b, 0x76d57cbceac81253, 0x2769040170457ac1 }, { 0x7886d3fae7098585, 0x423bae84b5228526, 0xab20b8e672311512, 0x388bbdcb7acb394f }},
+        {{ 0x34a8456f3b67f975, 0xcd98614b41fc1107, 0x24fdae9e23edc41e, 0x0fe5d0a7673598cf }, { 0xb4fab0995ea02131, 0xa4eca4551a34b953, 0x9d0318a2f0911654, 0x360b18fb57a4a160 }},
+        {{ 0xe2ee283e60293f6c, 0xf8e706d9ca60237e, 0x6fbb95796a2367db, 0x1e0c106011b40055 }, { 0x7f8de798d354232d, 0x4607e6144211efbc, 0x8a9dfb00c7601c17, 0x30e8e4cd8562f642 }},
+        {{ 0x65ef89f147471d12, 0xde5603cc956579b5, 0xdaccf5d9081c26fe, 0x30fbdc8fc5a83feb }, { 0x999cc65198aaf1df, 0x655301505008e8a3, 0x28ff355bd8bf156f, 0x2b1d17f65c6bbca9 }},
+        {{ 0xb79812ed99e080e8, 0x9c8fbbb9a5d70442, 0x659df19ec7897846, 0x145b62cb6174180f }, { 0x7b3d2d2744a07039, 0xe0ab19ba08e4b199, 0x7239a300b53ce18b, 0x172a9e4f5221a293 }},
+        {{ 0x59e0f11ef445c032, 0xfad8cb688c6106a2, 0xb51ac4c9c96887c1, 0x2e822fe4a2331b9e }, { 0x77a79b24189df83a, 0xfb394f8902c55852, 0x14939819b0ea2134, 0x18e7a899b655c3fd }},
+        {{ 0xb5d3e9177eb4fa1e, 0xdc3284cb823e3ae3, 0xe591d1227eb8c3dd, 0x29eb6de8be618bf8 }, { 0x01965819b68acbd2, 0x1bcde956b053ce7e, 0x09153b7204c8bc39, 0x396add67103ac0d0 }},
+        {{ 0x0bd330775604cbee, 0x865900ba8edb9bfc, 0xe436892e3d8c7c58, 0x1805a0233dc24c8f }, { 0x7ce21b02893e5bf5, 0x72c755cb88b84c84, 0xa871a2a3c912505e, 0x31cbbe352b7e2745 }},
+        {{ 0xfb77d0e3d8043d96, 0x0094ab656487eddf, 0x2b4c560f945b548e, 0x0c9604ccc82d6b8f }, { 0xa191a1a02a4a1558, 0x3c24112d4ddc7e5c, 0x75684a4ff10e1c3e, 0x3cc2915bf6ae1c85 }},
+        {{ 0x73c1360d840e88c4, 0xc9a3d4edb5edaff1, 0x1a4ad5111ae58857, 0x1df12d400df60380 }, { 0x14da3fc460aac6d8, 0x0f279499c0cdd8e7, 0xc7b58a00c93ae65f, 0x0b7ab13322c422a6 }},
+        {{ 0xdaa5ca20f7dbd105, 0xdfe4914fdd0f2004, 0xdd735421ca3902c7, 0x148880baeea036d9 }, { 0xeaef295eff8482a3, 0x2af0626cc0e23efe, 0x0b6267ad7656dffc, 0x0afe4aa6ce84352e }},
+        {{ 0x3ee78515c80eef4d, 0xe2f6bbd4a2f39427, 0x5ccb994e395d253f, 0x383c99a95a2612a9 }, { 0xb3fc29342d4cc8b1, 0x8fa57f1d7aaa3e69, 0xcef332aca32b5ce0, 0x08d075b0911c6572 }},
+        {{ 0x63c903065adeaad6, 0x7ca6367a3abf1546, 0x8f86351fa3d8c04b, 0x3bdf9ddb0ec17a89 }, { 0xb40755a82b8d4394, 0xe7e70d2ba3dcb2d2, 0x0ae89a88d7217b0a, 0x36cdcc7137552d8a }},
+        {{ 0x35bdb4e9262b5013, 0x7d3e37ccdba95e6f, 0xca51d708c90f7508, 0x00888a748f67b581 }, { 0x6f09349a51943e40, 0x24f39b9ed1688d35, 0xc3d61991c9c4bd84, 0x0af1bac07c7745c0 }},
+        {{ 0x5379d838f14fa384, 0x15c3e8c575505dcd, 0xb2937d9417222f29, 0x13bd1ab58910fc6b }, { 0x790d85650be90d4c, 0xe20f681509819b22, 0x03834c94c57657ff, 0x3a076f2a615945dc }},
+        {{ 0x25f14c86facbf7df, 0x07d69dd8f91736de, 0x6ab1f1fe0a00412d, 0x069dfd9787baea2f }, { 0x0779959eff1bc69b, 0x5c0641d0584aeff3, 0xe42985fb2ec031e6, 0x0d50de9e2343593b }},
+        {{ 0xfd61b0a6b2724ead, 0x45cbefcb5c192364, 0xc68ceedcecd961e6, 0x0132a8a6f13a4a99 }, { 0xe90d3435b3ff9257, 0x16d211751b5e4c96, 0xc8142705ccf3b38f, 0x3f3f0c0f3bbd9f5a }},
+        {{ 0x3926be69a83e5a19, 0x9547d38ab246b93e, 0x3c1553e563cef54a, 0x325337fe978b869a }, { 0x62fe5594885626cc, 0x934ae43f9c483db5, 0x8b5221196b4499db, 0x09f1c346e8c98b96 }},
+        {{ 0x7e7ad3113151857e, 0x44bb27c841b61188, 0x0c1173610e8c6865, 0x2cbd8e3957528460 }, { 0xc94561107f01d037, 0x219f73e498260494, 0x112bb89b8778b9b4, 0x1aaa3f6af83487a2 }},
+        {{ 0x6a9592ab0677839b, 0x8e841e8ce0890336, 0x2a36ba6322f8e4c8, 0x16d2a5fa9db81fcd }, { 0x072005b13d324bef, 0xfb17cef9b448c41b, 0x323b58d2ede68de8, 0x182d053b9e2c05fe }},
+        {{ 0xf61a61c8f95f36dd, 0x3035665bc00b38ef, 0x3297a3344237891d, 0x1e69611d820871c9 }, { 0x8239d35b59be7d2b, 0xe603e1858f5d5374, 0xff2f10eac2d67b35, 0x33c0d54cf1cacdba }},
+        {{ 0xb1ca3e7d1cbcb275, 0x77d6a006857859ed, 0xa95140bc83e2d595, 0x1815b7534abccbb9 }, { 0x033a3638b0b9d9fa, 0x24753f7c24321353, 0xcddf6e457531fddd, 0x04a30519ccc1479d }},
+        {{ 0x7fb1182717cb9d4b, 0x506a2e4b61a829cb, 0xfcbdfa5f346512ca, 0x20f2d77af23e204a }, { 0xeeafd604dac554f9, 0x0a70ecadc9c2b7ef, 0x9afb8a394576c952, 0x30e21d112fc147c3 }},
+        {{ 0x4ea73e949ebd086a, 0x1d2dfbe8b6a0a6ee, 0xfaf41b2598a767df, 0x3fd520dd1dd6218d }, { 0xf9f6761247fbe09e, 0xbe6dc261648884c8, 0x465a2a5ba81b0ecc, 0x292d832c618739a7 }},
+        {{ 0x07c704b2b08a09db, 0x809273dfedbf9e94, 0xdbd0738765481a8b, 0x15b6d2539055b381 }, { 0xd416c13be310f031, 0x2b3b9089594631a6, 0xc99c485a28904fe1, 0x36023166a83eb187 }},
+        {{ 0xcd24b1c5ec997690, 0xc43ead925bb11ce6, 0x2a344d4691a1e2a7, 0x0219ebacf030b738 }, { 0xeaa38f57d529d0bc, 0x8121b1b060eb1f7b, 0x54bbcbbe896df1ed, 0x259696df01d3d673 }},
+        {{ 0x51dfa97773a05bd2, 0xfdcdd0f4e4142308, 0xfc3a0868bec7a7e4, 0x03266247e73d0b39 }, { 0x3aa600247f2f5af0, 0x3d765a758143ce35, 0xfb9ae46527b6cb0f, 0x28488af6108dcd43 }},
+        {{ 0x24bc804d0bc0906a, 0x37da97f6750f1818, 0x1195f85c5737d8d9, 0x12f146538c2e5686 }, { 0x4b7b5609256b6f7e, 0xbe6eacd07efe6cec, 0xa906a1ab79d1c6ef, 0x0e61d9107c9eafff }},
+        {{ 0x21626498e789ea4a, 0xe919220d5983b9a0, 0x41a00fc97478a93c, 0x027759079613a288 }, { 0xaf34a85cc8c82c51, 0xcb9b07389e8820c3, 0xde2df6b421d28794, 0x2366a00f6ffe0af6 }},
+        {{ 0x94d702dd5a1a4ca2, 0xd495a00cd4d7cca3, 0x1b8d746ac09d37e2, 0x273938ab12cdf321 }, { 0x80bc32b1186a7d79, 0x767c344e104b3d82, 0xb7523c3c56eb021a, 0x0a64d34478b4d5d1 }},
+        {{ 0x83f9e04e7939b233, 0x6049e81e15f87970, 0x5e263be0b826ae51, 0x007f5a909ad8b9d7 }, { 0x6702bd6a644f2daa, 0x0cb8ba0814583a6b, 0xbdaffb1f23222eee, 0x0f513c1609ce6d4b }},
+        {{ 0xd767cea900b9b349, 0x09c20ff04c820c9a, 0x068faa117b0c3530, 0x121a017a5d129fc1 }, { 0x9913c606997ba696, 0x42e8ce41a1be21cf, 0x8d2a3928b7079cae, 0x23d35355368158ba }},
+        {{ 0x86f6bd261a25dc5c, 0x7c022dad5c1b8fdc, 0xeb77c246294ffbd0, 0x0ba9fb3a7fdfc5ad }, { 0xd7825c88b3e8b9dd, 0xbe74d13292c29930, 0x01d9d7355236803d, 0x0e08d00f087e958b }},
+        {{ 0xbba2e2bc0b03465f, 0x5f9b3791ada4bb7c, 0x24f08f873f88a54a, 0x07af5848118e47c3 }, { 0xb8757328402a502c, 0xc62ddb54a2cc1c94, 0x1c7cb35c82a1d614, 0x1b9b516cb75819cd }},
+        {{ 0x750474b86cccbf7f, 0xc7d7f6bcb2fff7d6, 0xafee387b586a0310, 0x2cc78386b1c8c094 }, { 0x5b3219224c497307, 0xebc9665dd518960c, 0x93dfe1ab9c9c2508, 0x3da460dc82a10aa2 }},
+        {{ 0x4ccf82fbb743dfcb, 0x8757606eb9d9ebf9, 0x4f7a0f394a44399e, 0x0567316a1c8924bd }, { 0xe2196924436339cc, 0xd9664292a3645688, 0xb51a2d05cfe03e9a, 0x3624a944f99db727 }},
+        {{ 0xd6ee98e5a6e01f9b, 0x31a00326b79e69c2, 0x50de4433dbe1380e, 0x1dd29f88431110a8 }, { 0xa02e9254fb4c11db, 0xf04341225ca41b54, 0xe0cfc01a71ea30bd, 0x140c8a463523c988 }},
+        {{ 0xae8999be26c9853c, 0xde55daa542a9f120, 0xa53018738d2ecbd8, 0x106bae4996c74f8b }, { 0x477cc2dc05be97d2, 0x2caae6bc699a7bd5, 0x945d318bd8d997f8, 0x1c8e3e2e7bc9b59e }},
+        {{ 0x06afff8f1b4f11d3, 0x0f21d46d848cff5a, 0x74a59f83fdeaefe8, 0x0ab9daa39c99e517 }, { 0x4524a7b566913e16, 0xca6d44b1eb5cc405, 0xa35598c5f25afbf2, 0x1dac3ed1f1abb9f1 }},
+        {{ 0x705466d4bc5ca39c, 0x030e40643c086eb5, 0xdff585051e7531c4, 0x280d1a34d5666c1c }, { 0xea7ceed679a53d0b, 0xea10f1436f9d7748, 0x8a539dd58eba1236, 0x022bcdbb7ad1f3d1 }},
+        {{ 0xad1b4eb6668ca5cb, 0xa5962ae2f70c2cf4, 0x33fefb4b22b2a1ca, 0x0b5ea81c8fc1aef6 }, { 0x3c6006f96516a4f0, 0x850d52f0d7ad896b, 0x7808f9cd8ff92b53, 0x288e31ebe408b37c }},
+        {{ 0x3969619afe4ea628, 0xde8c5ccdeeb10c73, 0xd1079441fded3848, 0x06082b10d8f0016c }, { 0xa410003f9b39a481, 0xa6d85e4d67d9f2da, 0xe87037481abd59ed, 0x372f42d65d65f680 }},
+        {{ 0xd6e78ecbd0230b00, 0x64411d98385d58c1, 0x03c9be7d34d76f28, 0x0c8d5846ef027ac9 }, { 0x4b7fc173e4ac0d63, 0xa5a96bb0ea05b0d3, 0xc1281833194cdf15, 0x1e5045292df96ab1 }},
+        {{ 0xa6f50cac98951bf2, 0xcf4bbc3d0e4a3875, 0xe532928b029e83a5, 0x33ca0cfaf809ff65 }, { 0x4b96e819c410eb97, 0x2f33f1591262dd76, 0x9eded07b635942e2, 0x315e98a7bd44ed59 }},
+        {{ 0x9495bdb841b0acc7, 0x32949cf8a9d86ed1, 0x538271123f8e8203, 0x16f109343954939d }, { 0x2205c3aff83db1b0, 0x4d751e1dd4458492, 0x954aef18f822887e, 0x2dcb9a40b8003dc3 }},
+        {{ 0x210a12b443911322, 0xeb141239f747c841, 0xce0081a92a0415b8, 0x306f5215448f2efd }, { 0x8bfacc1d248bd13f, 0xe28f78608bc35ae9, 0x03337b8f6ae6e9f4, 0x0bd669556cd1131d }},
+        {{ 0x56d315004ccd4523, 0x5d05c71428e04154, 0xfd12cdec7a0be002, 0x22d3686aca97ff57 }, { 0x4ddd68ef8c3bd789, 0x888afb626fe7ae9e, 0xe221e6c9bb4dc751, 0x246557c31f9e3ff5 }},
+        {{ 0xfe423c4bbb7febc2, 0xb237c4c43ab11718, 0x56c3d798f2b4e34b, 0x201ac7cc9ec462a8 }, { 0x730154d5eb8de16b, 0x26ff5ae772583aeb, 0x1a73dd0d1468bbf7, 0x39366cbb479911eb }},
+        {{ 0x58e5a7ac3617c68e, 0x2c619fdcdd96fd8b, 0x8f6809335ce1b4d5, 0x2c092506027303cb }, { 0x870ad542ffa64967, 0xc1ad305165d23c06, 0x520b3b93bc1a40e5, 0x1e59c831da821bd8 }},
+        {{ 0xff408643c7651d4c, 0x6b3719c11a5d0147, 0x1a8b52928fe40ffe, 0x06c13c4acfc46736 }, { 0xedba52695050c17b, 0x837f0800ee84cd1e, 0xb1f5ff43abe07490, 0x206ca1eae3e514d1 }},
+        {{ 0x5ae7307069e5c4f6, 0x6a4e08b54f348c58, 0xf20b4afad4d6ec05, 0x134be1b783af2317 }, { 0x884f918042f66ce3, 0x136d014f0b857658, 0xa3b0ff0e30ed9cc7, 0x30c50ec7f46d3d4d }},
+        {{ 0x6bbfe99052e05cc3, 0x201399bffd5d032c, 0x1727405c6248d970, 0x1293db418a7d1b2f }, { 0x4a768d43730c6566, 0x48a6a6d3de74ba96, 0xde996118db78ca71, 0x3c94f09e43230c7c }},
+        {{ 0xe9374d9b1c2df582, 0x6347144a584000dd, 0xb267db21f61165b7, 0x33ec34e5423f9041 }, { 0x65650af0f6cec936, 0x006e5a8e2522893c, 0xd444fe65b2ba941f, 0x058032518b792a3f }},
+        {{ 0x08b8524cb05653cc, 0x1304449c61168746, 0x97ccad631aae989f, 0x1ece59ebaf107251 }, { 0xabc8ba4932169a1f, 0xdd8ceede84dcf363, 0x7fe1540c68cc8da3, 0x197e26205598795f }},
+        {{ 0x4a8ec757cd9e13b9, 0xa23ff856bf653d0a, 0x88b248045c2bcbda, 0x34409a985f927161 }, { 0xbc48a6e1337af274, 0x0f16c16fa5911e2b, 0x4e5c1118ce3d7123, 0x3d1fb2dd8d45d814 }},
+        {{ 0x1f841038367e459f, 0x2171ab7349a5bf20, 0xcf333b911d34ada3, 0x2ce60c12b1350e17 }, { 0x80c3af7ce1e834f2, 0x1a90a87f5ddf0a5e, 0xfcd8e54f7ee486d7, 0x1e5afdaa95dc9d5d }},
+        {{ 0xf97ccb02e2efc036, 0xfb5eac1367f6f187, 0x4ab6c45e3ff0c3fd, 0x162efff42becad3a }, { 0xedd64e362011b428, 0x1f72ade5a5169169, 0xc1c2bee03ad2f1d8, 0x3410d35c8e3aecb9 }},
+        {{ 0x29f88556941487b3, 0xc423aba3531cad58, 0x6faa0cf2798ae759, 0x3a133e72f3ccad28 }, { 0x3a453baeee8c3568, 0x1daa897ec0c7ddb8, 0x2583a6cb237574e0, 0x312c5383415946d2 }},
+        {{ 0xf3ff3170721f4134, 0x4c06f86097061017, 0x2c950af45bba80c5, 0x1bcfed3c1e16ef02 }, { 0x4c0da2b6267ea940, 0xe7ac343ec74d3afc, 0x9b0343c26e181f05, 0x1c1e528e26215b91 }},
+        {{ 0xaa8c102f9cd8a7a3, 0x9ebc0c78cbe3bcd4, 0xedbd858f7e84be95, 0x1e2e897b3e301132 }, { 0x559fa8bb57de792a, 0x555d7d3a904b769f, 0xed3e09f96af2aead, 0x29b82ed7f97493c9 }},
+        {{ 0xe9daefe4a8a493f7, 0xffd6b825fb1984e5, 0xa73113e5d2989f7a, 0x08d7134803f3d48a }, { 0xd301f1d548a253c3, 0x70a783ff5a1e9b37, 0xcf3fae6b297f41c9, 0x3143246d451a1ac0 }},
+        {{ 0xd0e8888c2252f5a0, 0x3de68128f58103da, 0x7e9435f31cdc47e9, 0x198fdd103d7c2d62 }, { 0x22bd2181799e48ce, 0x2ee4fb0e0899499a, 0xf1d218298b9e659c, 0x1e9c0507c63a7693 }},
+        {{ 0x63c0e88c2ed2d747, 0xcc48a8820d741822, 0x8c035009c2a37351, 0x01c059c7b5a9b90d }, { 0xc02e28a5b8875063, 0x0cd8df6b28b35bf6, 0xf6e191303ce5c1bb, 0x39a76df4905edef4 }},
+        {{ 0x2d2652f59f0de71e, 0x42e7fc5f50538893, 0x1bf853a011e8beec, 0x24d7042416f2f5f8 }, { 0x992bd3455868f171, 0xb209a85d54e70342, 0x837643632163f4a3, 0x04ed23170db4d0fe }},
+        {{ 0x824b64c99329058b, 0xf9f31c6e0220cc1a, 0x2ab469d29117b071, 0x3014bbd7ebcd5bff }, { 0xada11bcc14c9c754, 0x9fb6ddf343f4f799, 0x432f017b8d479220, 0x053f78c1ed7b5248 }},
+        {{ 0x8dfdfcd563cab4fe, 0x369ec078d21f038f, 0x53c0e80a843a79ce, 0x0323ec8123be3fe6 }, { 0xd0c2aeb067b70a5a, 0x70292a65134a5341, 0x4f826c1e43a89870, 0x075cb43ac9457108 }},
+        {{ 0x5f0da534b5d7868f, 0xa89e2ca47df17cec, 0x034514ce640ea941, 0x3924d4fe06c1490e }, { 0x7d8aa8a05e5a2d0c, 0xe7dc70165fc1a60d, 0x085a6d865a8c170e, 0x0b49a2a158d96ede }},
+        {{ 0x0e95b866f268a583, 0x17e7a3afdaf3e0a6, 0xd9a00a5995290c5c, 0x0922c09485bcab4b }, { 0x449cfab5615ae6ee, 0x71b8ad8184b36c7a, 0x10394698f6163a78, 0x1d7a4055f9693539 }},
+        {{ 0x563e1d4c73f26d7a, 0x835f06e5fa1277ed, 0xf961bf5252663d4c, 0x0c1eb15acb5e12ae }, { 0xfd0c8325b0c6a81c, 0x92ee7b60d538576b, 0xce0eafc7129eec1c, 0x280e63c804fe808c }},
+        {{ 0x000b151ee54ec2e3, 0xedfb04187c05a894, 0x390e9cad0b9e37f9, 0x1d8d6189ffd0121e }, { 0x96a9134e2103d3fc, 0x9161a83709aae74a, 0x0f720027bac9b622, 0x1f27c647146009cb }},
+        {{ 0x8b888550b2d3fff5, 0x47b2a265973343e6, 0x10ce38fee3a21b8f, 0x0943bf3dcdb45199 }, { 0x04ad3989f05f508f, 0x415d966b640befdd, 0xab1e5c9faeb28394, 0x0da8f5f9cf70451b }},
+        {{ 0xa8f8ee7e31beff41, 0x6397a842282e76f3, 0xa5e5d0166479815c, 0x02ff1857522891d1 }, { 0xaf3d332e1aed2ea1, 0x126c699d6f6afdb4, 0x52a1ea2a7635fad6, 0x2f6dfcf0482982c4 }},
+        {{ 0xff929472ed82fe6e, 0xe4721c8bd8bd34a4, 0xea75472af2d4d9ae, 0x09c519781b71a9a4 }, { 0x33ca408568a175ba, 0x1a40e9a2b162e975, 0xc98da29add84ddcf, 0x39eab183545886b8 }},
+        {{ 0xa5d3ec0fb98b8147, 0xc41df62e4edb58bd, 0xe357476c2ece087c, 0x2cfb5e99726fda0b }, { 0x8051e850baaf1d8a, 0x7ee64072f4021fed, 0x13e1d83d445991ee, 0x0591a51ac09a239a }},
+        {{ 0xed58401f2a1daf5d, 0x451f4083181970b0, 0x464151e763676899, 0x06a46f8204625105 }, { 0xc84fe58fac74b122, 0x8d556f614961b483, 0x9c30769f380c4e4c, 0x2f89e14aa68ba9e5 }},
+        {{ 0x40e4ef9f6e250a1d, 0xfc874c4b7e8b7812, 0x52c342dc0c35cccf, 0x3e7afd029b0bb42f }, { 0x26386afa957b8183, 0x9531906592ff709e, 0xcfdd8af2710b951b, 0x2aafbac685f3cb88 }},
+        {{ 0xed8bfacb27f63daf, 0x1e96927e81fe4f8d, 0xe21c52322021b42e, 0x1c7ce0f6c41034d7 }, { 0x6f55501f47b8f4c6, 0x6e2790e775cbb71f, 0x017a8f20031ed1f7, 0x15129e88b9880b0f }},
+        {{ 0x72a3628a498a959b, 0x9ecc0188d44e4335, 0x5e09d169d1959f2e, 0x16a5fb57b0faeb98 }, { 0x7c9266e30c014fa7, 0x6b2a18b336b55e4d, 0xc4060fac7883456b, 0x2c9dac1b1fcdd5f2 }},
+        {{ 0x11b176ee8bd6f7de, 0x2b5c1044752192e5, 0x927090895d557c60, 0x14ef530f2987ab32 }, { 0x00cc10f0290537b8, 0x17f4f2b8194f9f04, 0xab6a2e0060c4ed9e, 0x31b3b4d971d5729e }},
+        {{ 0x870da74e1d9f601a, 0xf08309e8d282140d, 0xb988a3d56854b283, 0x22f411a5f25af15e }, { 0xb4ad61db51f2623b, 0xf1dabc11ca9727d9, 0x24dc2f1539bc19b9, 0x3f956ed72529456a }},
+        {{ 0x4c58ed4a6ae5f554, 0x850897d8ab3a02a0, 0xd4710d489b756158, 0x2ef958089b3834f8 }, { 0x45fd0cf7b5332c3c, 0xc1359b66018711c8, 0x1aab8c523c57c1ac, 0x37deadce7dc2f69e }},
+        {{ 0xaea0493497d41976, 0x493eb1ca1f696374, 0xefb59d1ad5726ee5, 0x2de7f94ae34e28a4 }, { 0xe3a0248b48dfbdf0, 0xd5928d190a691d64, 0x57da2ecabc4388da, 0x3376d22d70b280f2 }},
+        {{ 0x0f98aac36fff5a63, 0xf7de26991f40e9e1, 0x37f1bec6fc134340, 0x3aa9559356a12a05 }, { 0xe63ad10b07793d9f, 0x1b1eb609a5523103, 0x0d6a2ccec89fefa6, 0x2260077349ddc146 }},
+        {{ 0xc5a928160895ae97, 0x758b033cacc6b3eb, 0x07aff753f24768cd, 0x1cca77452057c1bd }, { 0xcafd0648667fed52, 0x1ecff53f5dddee24, 0xb3a1b20cfba5f1ca, 0x05fb125a20cfa100 }},
+        {{ 0xeb99a36853e5c204, 0x4d7c826cc62e45f9, 0xed8e3383b25240f9, 0x25bbb5ed5e2bd296 }, { 0xfb2b6c23d92a760e, 0x3a7372f5f8f19e56, 0x96f232b93df892b8, 0x1395e4c26209e210 }},
+        {{ 0xbb1a2bda62a5f346, 0xd2a3879d855e271f, 0xdeec6e29ef4e3a79, 0x3464503414e3bac7 }, { 0x9656c709c7ddedda, 0x361e20e27e04b5b9, 0x72e5cb22777af718, 0x00f1f4f4b1fe2fb3 }},
+        {{ 0xc7da0e2e115ab8a0, 0x36b69152bc3d4a13, 0xad81620264cb51ec, 0x32e2f30768b29af0 }, { 0x9b28ae77c40a3af8, 0xe358a29fabc15245, 0xbfc653699bf957c0, 0x0059dd85d7e471de }},
+        {{ 0x9f565961b2bff18e, 0x1ea403fb0dcbaaf8, 0x21f46fb93ca0eb69, 0x09118caa521423e3 }, { 0x64c755c771cfab13, 0xf95acb40bfe9b674, 0x35b4fbb8cb59d667, 0x093b4bec16ac5859 }},
+        {{ 0x54a4f0659e394d37, 0xcc2b515c635349aa, 0xe6a00294373a2abf, 0x3c8cac61786dba73 }, { 0xd4742df221bf5817, 0x003694596a19962d, 0xd0273c47ccb8d57b, 0x0dee1fa5f6834ebd }},
+        {{ 0x757a76e2bc6eafb4, 0x84081b19c5be458f, 0xd65a2ef1a0b7e37a, 0x0c395b023baf9aa7 }, { 0x9c9bdc573458776e, 0xd6b4faf677a89b34, 0x18889268a142e8fa, 0x1efbd00c438899c6 }},
+        {{ 0xa6ab2e8cf603254c, 0x9bd80209ad4f109a, 0x1df486a44d19495f, 0x202d6029c3fab16c }, { 0x1b489d7ac5c49f3a, 0xf02da9b67d76d3c4, 0x8fa5b3024c982643, 0x319808133c57e802 }},
+        {{ 0xfef77bf97d7b233b, 0xe505c6c40257986c, 0xfc3cceda14bca7d1, 0x00fe52ee9cae9754 }, { 0x33576a9129ffdaef, 0xe9bfe96a5327925f, 0x5e6d35fa894d6e32, 0x3a66f19e6dd82547 }},
+        {{ 0x01eeebf6c08e38b2, 0xe6f6ae783d6a741e, 0xcd98832cafb0d17d, 0x00d2066c72fab7b3 }, { 0xbacce37d91a49fc2, 0x81434316a0953504, 0xa5e750ae1083466c, 0x06724de0f5a1e50c }},
+        {{ 0x3cf5790b91706195, 0xc0a7b81ef3836954, 0x052ca7b76ac16c07, 0x36f49895deb48f6b }, { 0x5a3cc4072be9ab3d, 0x5a1963fe605bbf83, 0x49a19acff8fac8c9, 0x3e00a1267714e95d }},
+        {{ 0xf46629fbbb7e81fe, 0x6c00f6e1ab17f146, 0xb547d85681c6b481, 0x0d78e0ba610e13e8 }, { 0xea9b31a38e6d0ac1, 0xa45a9dd1673ef96d, 0x1c1908414899fdb0, 0x16bc0492abe72214 }},
+        {{ 0x6071e1e506fdef4e, 0xb4bdf03635fff508, 0x3d79a9f97b180f70, 0x3cc0e30a93ce8e71 }, { 0x22927c550703f48d, 0x19e2f2bb08acb92d, 0xb2b11f9b75d4f7bb, 0x060e600291dcd025 }},
+        {{ 0xca414e632aed92f7, 0xb368b460a1da222b, 0x24ef641c132ef5da, 0x0f13f166a6de7822 }, { 0x1c5b70a7045a513c, 0x67850e95d633b951, 0x4a391a5497a715e7, 0x1c2c42b31a078122 }},
+        {{ 0x277612bb82a5745b, 0x4d4d04ac3e46c5e8, 0x4ececb9c7f3f79e3, 0x3c5ddbc7bf9a0479 }, { 0x9ba267f798798769, 0x5ba27bb9b64aafac, 0xb86eec728596b2ac, 0x1ecfa0a56557932f }},
+        {{ 0xf9f9660e192ce103, 0x1b51d8895f13d29a, 0xe481a7f0e324f2d5, 0x2ab0f204d42bcf20 }, { 0x45797ec6708425e1, 0x2987f4f861fd1f14, 0xeac997d881445b0c, 0x2c6d9846fb98bc0a }},
+        {{ 0x2d15cb41a5b6e798, 0xd81d34d46c9c519a, 0xd18f65baea98f92c, 0x143f21014f98981b }, { 0x8c9ad5e91c76d841, 0xc788eb89ddf84135, 0xbbf5a15e34a2dc87, 0x3d7acefe0d8fcc1b }},
+        {{ 0xd484ba217e38ceb7, 0x4ec693ce3e589d4d, 0xb584b27a0661895e, 0x0a692c046b3db3a4 }, { 0x5a2adf2e2b3a019c, 0xdeb95a2c356ea6c1, 0xe0b2f5fb15df8625, 0x2eac83068fab2c71 }},
+        {{ 0xa55e80c7d6ace89e, 0x66c7ce40bbd43db7, 0x415dcab0318158bb, 0x31cf7d9d56116bda }, { 0x41947dc752474116, 0x15eb0fe3752b9668, 0x053043816ae24dd7, 0x2a706277c4ad3f9d }},
+        {{ 0xa19c3c9fb7700a2f, 0x8579e54b5b040b6d, 0x658e20026523d922, 0x1d544c6a863ca467 }, { 0x6bcf73040034ab69, 0x7c8609d71c03daac, 0x8184f58726c7d4cf, 0x2e7d8bf3afdd912f }},
+        {{ 0x57cfa215133f15d2, 0x58e8756f31e1caca, 0x8802201646d04ad8, 0x00cb92e963dafc2f }, { 0x5d0cadd50839f659, 0x9e5d4f78daf75bf8, 0x8a4faedd4d95b382, 0x083c8a1fd2b7e7e4 }},
+        {{ 0xccf0f0113939cb7f, 0x0b0b54a58ac2d195, 0xed9301fb41b6285b, 0x0949b71518b891ba }, { 0x83a17ce6c31cd78b, 0x645b03bcc31abda6, 0x8297eb93f4f1b15b, 0x1bd1627e7ee70dbe }},
+        {{ 0xa17e059537d26896, 0x32e55d045ed0b453, 0x7c769b9ea2d0ae9f, 0x26da52be4bb10b45 }, { 0x9ea33983bf79379c, 0x7469947873982d48, 0x6500d326ef0a4f11, 0x37da2e03966dfef5 }},
+        {{ 0x788c5fed457046c9, 0xff28575927b80e01, 0x39238310c08268b9, 0x0d2613895857d922 }, { 0x690f16f9a89b5bf7, 0xd41bcf072af935cc, 0x1f466711780d3c5f, 0x3739a23621e8dbcf }},
+        {{ 0x1e78b12d9d53027e, 0xdf36387740a1401f, 0xd899fe0988cf643c, 0x0122aec79aa60621 }, { 0x66b24d5a31ea0298, 0x3785ac0390cb9f68, 0xc47a7d5a776958ba, 0x02c5872daef1ffad }},
+        {{ 0x5205c603fa05efe3, 0x04e44191fd803a92, 0xfdcbddf41172fa59, 0x057b2dbb02f57781 }, { 0xa31b25c0e2099875, 0x443082013b1f3623, 0x2e1e0958012a459a, 0x2769fdfab5a61aa8 }},
+        {{ 0xc3af05d35e8c3012, 0x425dc84c0122b585, 0xf69c2cf468538030, 0x37b83e442953edfd }, { 0x769d2871421224b4, 0xb93064280dbff1f2, 0xf46ccda638130505, 0x02af934aaa90d83b }},
+        {{ 0xdeb00509c2d6ce5b, 0x0c59b957c9dfec83, 0x319a3fcb08d680c4, 0x3c601556b5bb3b23 }, { 0xb4f9e5dfc1abe74a, 0x3551243a59001b11, 0xcb61caf9ef479f3a, 0x17c2fd2decfc39b8 }},
+        {{ 0x547d09a176012a1a, 0x698ecd769dbd4447, 0x879aedaf649c1aa6, 0x04473cac3f1b3fb4 }, { 0x6c587a18ee5db873, 0xbf1d52855b9c5e4a, 0x0d926b929087975e, 0x39db834c1a02f2c3 }},
+        {{ 0x6cdefdfee5cc55be, 0xa0f9e106972c702c, 0xce68733318d308a7, 0x3f7bb61aaad0470f }, { 0xab27d9c8046a3301, 0x86ae31feeae55f3f, 0x4be90cfe9b1e66f3, 0x219cf49922376ee7 }},
+        {{ 0x1b1cf87c6f92d033, 0x09a972916e2b9fb1, 0xd5d668d8de6f6244, 0x3684b6fb448c4748 }, { 0xdd13e0ba2769ee3d, 0x50dbb43406ef50a4, 0x076fed617b09d07e, 0x298088a0822c6793 }},
+        {{ 0x1f5154b1a27d0a71, 0xc9de7898e91887f0, 0x39a3a1a023e4b743, 0x01c3371dd92d228d }, { 0xf973d9e4da024505, 0x37ecb4f77c6feab4, 0xea3f057d60773ea4, 0x00fb415782bfc91a }},
+        {{ 0xc93ec575e0bc9429, 0x5ba9970ebbff041a, 0x6336a597b584d926, 0x1fea241ac5c32918 }, { 0xc81d59e7bbbe557d, 0x33c237788f252510, 0x7ac7f4c8fb16fe8d, 0x0f4c6716963610b9 }},
+        {{ 0x0a9e5b3e7aef3f6e, 0x66b484d3a08ce8cd, 0xda5fe9f26184c184, 0x2d73610df55e721b }, { 0x5544522a4c26a090, 0xe0e13b59f9ae3e3a, 0x135f8d0c50495f62, 0x1474f9cbd4b3365d }},
+        {{ 0x228ea090071a0bc2, 0xe241f7d485664ca4, 0x76352def7e6b7121, 0x0ac0b2f9e63ea5ad }, { 0x28ceb0633bc971d9, 0x96fc0b0557e274fe, 0x6226de05fb864a0c, 0x27b8da58c7be8db9 }},
+        {{ 0x5f862f757c962fc3, 0xa8bb193977312046, 0xfbda408a8caf2197, 0x32e7777014a28136 }, { 0x2eb87d5d13a9b57e, 0x9379b2cca44a3bf4, 0xce2b3357ddf08067, 0x112275f5013cd33a }},
+        {{ 0x32ceffabed384a5c, 0x50fbb8716950850c, 0x12baa0a826083b8a, 0x270cfb85425b933c }, { 0x78e575c8b67f7999, 0x1502649674c6e89a, 0xeace4f39d6f34ebf, 0x338ab1d9221cf3fd }},
+        {{ 0x5d271587881efddc, 0xc20a088f69394fac, 0xdc97aaa8c3bf1041, 0x1319dcc31c93eda9 }, { 0xc584ba15fd4f8f0e, 0xae8493a2b6f0987b, 0x6b5511bb92810895, 0x284fdc1e55bd303b }},
+        {{ 0xcffb95e4edca2523, 0x9ec7664eca47ee92, 0x3396e01a507f775b, 0x0af7e0117a4efb9e }, { 0x281d7bcfe31672f1, 0xb3f032a080e2aafd, 0xa60cf36feee1e768, 0x167d0399c357211f }},
+        {{ 0x66e3301c98031432, 0x2af5dc2614c3fb30, 0x6660e75420c07971, 0x0757f405a751d055 }, { 0xd2b5ec0277e6c9f2, 0x6b99dbe1d23de69b, 0x7c28e2e92363fa3b, 0x39711220e395a2ea }},
+        {{ 0x3adfc475863ac2c9, 0x5d5702fea1fc468e, 0x23fccae57d182325, 0x270d9636cedcbe38 }, { 0x775342490ff789ff, 0x14db5b34d8d6599a, 0x58917ce7065a73b6, 0x1a0baaed76b1f5dc }},
+        {{ 0xd69f01b81d872e5b, 0xa415f8bebafd8bb8, 0x29c094974b143737, 0x19001f4f1e7d0941 }, { 0xaabadbfce61ee64e, 0xaf51a85e9703d021, 0x036f225dc8d54d04, 0x14137ffe0ccdbff2 }},
+        {{ 0xa84f62779989bb9b, 0x3f6b89527d903555, 0xb082dd0f18a36f5f, 0x2bd928285d474207 }, { 0x86ae57ca15688f89, 0xa133223eae0a7989, 0xc07fa2272fef74fb, 0x01980947af93fd5a }},
+        {{ 0x8808ae3282888c59, 0x8c3830c2cc163161, 0xe1a34a239565f920, 0x0579f3954404d3ba }, { 0xff411dd96c7f99db, 0x91496bfa260692f5, 0x6749fe30cdafd885, 0x39f56b08e32b77da }},
+        {{ 0xd6234a682eafaddd, 0x0f1fe8f6512a03de, 0xcdb11c7bef8a020b, 0x2871665a44d54476 }, { 0x52968a0955cedfb4, 0x04bf3599c5779008, 0x141d606318d82d6a, 0x2ce225fc576d249f }},
+        {{ 0xb671502ab912a271, 0xad6062df558ce870, 0x18c3779cb75003d0, 0x01d50e8109a05665 }, { 0x4ca8d8104c431c8f, 0x64f34b3b636373a8, 0xa050f2672b5fe81e, 0x2265ab2ea9bb8216 }},
+        {{ 0x626661345f8a8a85, 0xf39730d4e12f6a91, 0xedd0f9f406d287d1, 0x06604d0bf1a1a75a }, { 0x53ca81739b12e125, 0xacd647e2daba92c6, 0xc3336b5e44550ab8, 0x12d6826832f8e351 }},
+        {{ 0xd214944fdd9dd1e1, 0x6cdaf0a07a2c56d3, 0x1592b38465192379, 0x31b3a37d9c5cc6a3 }, { 0x1cd3d8652ded3c73, 0xd7ba86e336e7f024, 0x23a684408de6d01a, 0x178422126be60e43 }},
+        {{ 0x82c4cbfb575e0e65, 0x2960c53d7de56d39, 0x0e6350774dddc9cd, 0x191ace6f5316f9dd }, { 0xd7d1a19adf2f3f95, 0xcab6865b5ae40d8a, 0xf98fb71cac22872e, 0x2ce5510d15ee6344 }},
+        {{ 0x74bf397935e074f8, 0xfc3af3da8d3e16df, 0xd04f819f9d49ed1a, 0x02b6cb7383cef366 }, { 0x36139f2e7e031430, 0x037a3913b1e99b62, 0xe10b9848feb18daf, 0x026c7bfcd28e806b }},
+        {{ 0x5aa09c0968f80c80, 0x0c484a1c85e33eee, 0xa6663c727082a44a, 0x0cbc7456acee5828 }, { 0xe3522d96ff9820e0, 0x5cd30a00dfaf13a9, 0xc55376849a83b5ea, 0x02092681711d7b38 }},
+        {{ 0xac54f1057c26ba67, 0x7668fa50e2a00194, 0x8501445598cf3181, 0x0602c90dda2fa06a }, { 0xd294160eb07107da, 0xeae62883703be8ae, 0x8652ae7cefec5ad3, 0x1db8b6ebaefec077 }},
+    },
+    {
+        {{ 0xd9941a3d9c8ec7b6, 0x457f9f32223838c2, 0xd57d0f184317e558, 0x2a501f9b2ab22e6d }, { 0x83bc021a8cd6541a, 0xa6dd22e595899aca, 0x138c2723fb0fcfdf, 0x3daf716592a31f25 }},
+        {{ 0xe26dd9f086fbd016, 0x19b267c1cb3de939, 0xbedd8a49cdf749d6, 0x2839d64a36adf19b }, { 0xb40132683ca52add, 0x99d17b5667c27877, 0x6662dd53c7d452fb, 0x2ad28de937f72892 }},
+        {{ 0x1a76e0a149429b45, 0xa999bf2af6ce7697, 0x00868ff0e45e9ca1, 0x377262be72ab6871 }, { 0x43a05b1a04447d65, 0x35ee86abfc0c0c1d, 0x1756849acf6a694a, 0x343bba8fed764316 }},
+        {{ 0x5ce37548e1949dba, 0x2ca168b4c49fd0c1, 0x730e0e924eda5b24, 0x1c6638a90cf04987 }, { 0xcbc5232cd053f697, 0x786cb67c051a4c56, 0x673b22ab81681857, 0x3c8434553c112a15 }},
+        {{ 0x96505f42b7c7c21c, 0x51e7b6f0b1536bec, 0x447198e1fb704d7b, 0x1741534f28277e40 }, { 0xac246747ed4ae434, 0xddfa0ccfb3245359, 0x30d40bd50f80a48a, 0x39d2a96bd22fb959 }},
+        {{ 0xa41f0579b277d246, 0x623132f88ec090ea, 0x0e5bf7a64c62051c, 0x37eae07f4a20501b }, { 0x1ef174bf3de924f8, 0x54962cf4bbbaa403, 0x9adff0244f85950f, 0x2e6fde73b8ba4d4b }},
+        {{ 0x794e1ad3fd39ac3d, 0x48a69af9f8747496, 0xc7165b778e7e4f43, 0x1292d803bcba1172 }, { 0x7e75dd59f8001879, 0xd275ee82d68bf6b2, 0x5b9ace1ea03303a6, 0x291d57ff8e2fe497 }},
+        {{ 0x475c7bc729eeaff6, 0x2250d64279ae476b, 0x2f57ff5432af5865, 0x06ec4024b5a6b6d0 }, { 0x2cd88124d3846efd, 0xfb9943dcc6cc4e7a, 0x70340b206f50cdc4, 0x3eef3a0868a654b2 }},
+        {{ 0xd627c3b5c8782d69, 0x03539d98aa9a9803, 0xd8727caa28f0e6df, 0x0b487e74fb432e92 }, { 0x21e35b5a48b39d1a, 0x7e109f7dda270bae, 0xf7227c6d711b4b04, 0x17e4071a87133427 }},
+        {{ 0x98212a0704062b95, 0x24bc5e5c4a73757c, 0x3bc1f20c1a372ba5, 0x2c29d60881b07940 }, { 0x9c4ac4d015613f0c, 0x3da365121026c517, 0x417f964ebe8c800d, 0x180595f2d2605d94 }},
+        {{ 0xac6e2ab78b6a6910, 0xd9dc5b5d0a136099, 0x937862b0f2429590, 0x1ce9abbf8c51f74d }, { 0xa954f81603635f66, 0xc5929344eaf80095, 0x8e91158176159b53, 0x0c722d51493022a1 }},
+        {{ 0x26c7ea1fb9fa0e50, 0xeb6707a76302fcc6, 0x3fddcb3dedaf8079, 0x13d4e48dd124943f }, { 0xec283c7fc7310525, 0xd5fe7bd44f22304a, 0xe5d24dcea4f02bad, 0x3b8f9ed5c14bf635 }},
+        {{ 0x3bbc9621da524473, 0x5f12f0d308729378, 0x1cb48d02cdb8da40, 0x1c8bc1d9a7a023d0 }, { 0xcb74222a7edc3d01, 0x2f41cf271ab3dce2, 0xadcc149f8a73d5be, 0x3b5596f3918e0e33 }},
+        {{ 0xbfdc85b1b63dd5a7, 0xe8f3bb63a1765036, 0xa3a5b7d15fa8509f, 0x121c7efc8015982d }, { 0x9191dc4cf3528434, 0x8e134cf5ce5fa4d8, 0x7579dd4f20e5abfb, 0x07a1dc68870c5e3b }},
+        {{ 0xf8e1b6132fc75b45, 0xe6621608ba3f7954, 0x684e398ed80e2203, 0x3307bee1d99e2a15 }, { 0x167790f5b7718b72, 0x1ab9c76f0d54f045, 0x2bc2cc3e87e30c92, 0x34cd2b2d039bca8f }},
+        {{ 0x63940829b00d0565, 0x1a00086708b47081, 0x2e06fce06e780776, 0x18d07f4130eb90c6 }, { 0x8801bd8db3f3da1e, 0xf249461e0a4d519e, 0x84ef3e2d5650ed25, 0x08aac05a0ae072ae }},
+        {{ 0xec91ca1cd0c05ff6, 0xc70c1c0ef8bc57cf, 0x241e1801deadffa1, 0x05ba89b7c9f982cc }, { 0x8d02a45ba8f74a20, 0x310d1fa59fa978b4, 0x6f1a93f9279876f2, 0x24317489f1916fde }},
+        {{ 0xd8479535a0edc58f, 0x7ed3f6e3e287d919, 0xe7510c29866bd330, 0x10422ca1e8a68a08 }, { 0xebdb6177eef06392, 0xce84ae6a7a4773f0, 0x1a5451acd16842fb, 0x00c15c288d3f7eaa }},
+        {{ 0xbfb64d6e04a2a24a, 0xbfc0266ee4f9737b, 0x5c5f4ecdd7c01217, 0x0ddfdeafebff3d16 }, { 0x1172b1d4be3fc1cf, 0x158764664662f4e8, 0xdaefa806fa8977a7, 0x04408ede52eb5e38 }},
+        {{ 0x56b3b5cf18ecc008, 0x1f738fdfc156a1fd, 0xe167c6136becc9e7, 0x09e831eaeab45baf }, { 0x52c8c084f7935391, 0xba5b98227eabbda6, 0x020b45356416efb6, 0x1697cb9fb14f0c43 }},
+        {{ 0x35ac34699c8000f5, 0x3ba77c2928fde6a2, 0x1c6cedc518f75b33, 0x39cc075151d78f78 }, { 0xf133be40b799919a, 0xdd0a700df4472bc8, 0x12da5cbc3a07b889, 0x2b18fb1a4b59438c }},
+        {{ 0x16f0bbfaf57cd26b, 0xa5364b8b2fd7fe13, 0x3c6f80885b14cc7b, 0x28a2fcf9d745688f }, { 0xf3acd04e67c8d5b4, 0xfaf5b3fbb7ddf8d5, 0x02f519d4caeb6f5b, 0x218d26d1c5929803 }},
+        {{ 0xc781bda2c636e396, 0x978ac50680769234, 0xaa2f080e6e6a35b3, 0x3408e924ab9d8ea5 }, { 0xe1df7e9d55b4570d, 0x5ea84aff6bf6515c, 0xd828c19bebbbd8e3, 0x1a0d8a42e0d4ae05 }},
+        {{ 0xbd17527fb3d697af, 0x9ef1772a6566c31d, 0x55da77d6d96a9fea, 0x37cec9326e9e1108 }, { 0x4565f3277f5cdf14, 0x014c1fd1d312bbd6, 0x4ae0a249dba65e6d, 0x2401f477784007a0 }},
+        {{ 0x8202395050954399, 0xee568b86152cf2b5, 0xeca652b7bda7562b, 0x1576626cf39a0ead }, { 0x90aeb5c72cb21b6c, 0x36ef1e6c119e82e9, 0x595d1c047c9c8c27, 0x0b096a4173be2990 }},
+        {{ 0x729ece6ba4c88b31, 0xfc152dbce46506e9, 0x9395839d35ea1f74, 0x0aa61640909bfd54 }, { 0x6f5c076be23d6e8b, 0x3fc0b0c8e240633b, 0xfad688a1acc87995, 0x0f6a7a1f61eb96f4 }},
+        {{ 0x1517ae2f058c9b92, 0x209e202f053e330c, 0xcdd30cd994655023, 0x350856c55f1e5643 }, { 0xca61d54cb90629f6, 0x22ec21e57e33bbfc, 0xa38ba39e9adae2a5, 0x2faccfaed3bad1d4 }},
+        {{ 0x229a5a9dc5eaeabc, 0x8d47dcbde3635b18, 0x35b8b36b07f3a395, 0x27ec72a426d61e9f }, { 0x0eb8b8e7d68effce, 0x2d03da16220ae5e5, 0xe8da3b1f6da2935e, 0x1f6fd67b24201caa }},
+        {{ 0xd35a3f9387efec13, 0x6d58f2611c7a2725, 0xcba8af280fbc5bc5, 0x25bc91512310fe5f }, { 0xefc0be15d74c4274, 0x151a143b3758b91c, 0x18ced3f22bd66077, 0x0e6cea7b4fcebcd7 }},
+        {{ 0x754e85bb4dc69292, 0xb67f55a1045cc5e7, 0xb9680f2a2c67f956, 0x17dbd2450da34df7 }, { 0x506739bbc8396924, 0xbb7c0b60366f566e, 0x8e48531b12492489, 0x25f51362fa4e2a5c }},
+        {{ 0x92035a0835801de3, 0xd94ac92ac08ce876, 0xa35ddb7dc3d34944, 0x3d53ad5b80eb2c95 }, { 0x7f1269bdf6421659, 0xb4709a352c29c1e5, 0xbd8d91fdd71e6b9c, 0x35feeab2d485a0fd }},
+        {{ 0x9e12742302c4fd9d, 0x9e668be27f8d4857, 0xd8e5a5752de92af7, 0x337b787154d86caa }, { 0xee0075ce990780d3, 0xe90faa534f4c8eab, 0x15cea41eab603516, 0x059cca3941afa806 }},
+        {{ 0xe63a0e9b1c1e5deb, 0xb4e6a9d4a12e4319, 0x881d57faf81a5951, 0x3ae3fb8dddded6e6 }, { 0x66c4458fa1eb4ccd, 0x47debf5d2bcd9f6e, 0xa7c8812c716ec9a4, 0x24050079fe549ff8 }},
+        {{ 0x0c579cd72d4cca98, 0xb53555fb6404b930, 0x51b8332f3a21c16e, 0x28fbf4d72470f334 }, { 0x928eca9e6a8aa0ba, 0xb11d19d7923e98aa, 0x24f445d546a9c7ed, 0x143c30204603caee }},
+        {{ 0xc01b0b79067ef2ea, 0x2ebdf178a78a52d2, 0x3720c1d7be287ec8, 0x09452dc26d786f1c }, { 0x302bd4777039398d, 0x92fb55aca4833fd0, 0x0b3fe4649ec54379, 0x2bc945ed1e28919d }},
+        {{ 0xf14f95b15141f8d0, 0x909ea34e0fabbbc8, 0xbeb0ab245e43a38c, 0x35d6cf3e9034c3d1 }, { 0xe497b3b2e17ca649, 0x0448fe8592842384, 0xe6fe4fd9875856ef, 0x04c8b0b89db71cbd }},
+        {{ 0xcc257bf2c262b9b6, 0xb6618d9545290cd7, 0x0ccd44e9aee13f22, 0x193b11d29355c898 }, { 0x7541c8a0e5420753, 0xa1fd3f2c79350cb5, 0x89100ca354af3b1b, 0x1a73b965499b5d28 }},
+        {{ 0x777d72a295b9c5b3, 0xf56330bdc2e5da8e, 0x17af72d0dba74229, 0x32265ac7771f38b3 }, { 0xc38298452c3dff32, 0x5b00f35dcb117021, 0xd0826b3073764aeb, 0x2cba653f7ea52330 }},
+        {{ 0x8d88967281eb9076, 0xc2d77fd2a5ae28f9, 0xdb439f7286b572ce, 0x2103b032be420082 }, { 0xa424716ca5e1300f, 0x1e9ccfd8950d73a3, 0x7ced990051361734, 0x3a1c35b5f29684aa }},
+        {{ 0xe4363976122b3f50, 0x502b317a45b2f2e5, 0xd8bbb11d57a3b694, 0x112569ad622d9d7f }, { 0x1f808cce9e984975, 0x6ad3bb0bc0206d80, 0x6a84ca49b26661c5, 0x1ff92533e88b2a9d }},
+        {{ 0xf012ebc1eecc33ba, 0x692ef5b427568e73, 0x2d9ece091d35f009, 0x3a221326794e0861 }, { 0x88a4d3a654048780, 0xded0b549e5c49824, 0x84146b5448ea10df, 0x16c3b02bceade69b }},
+        {{ 0x7375afa68928fe24, 0xebc065175b396791, 0x40217882803da9d6, 0x1ea7b694ec0ef5e3 }, { 0x171cd9771cf726b4, 0x6b347e3eb4beb9c1, 0xa4e2c2fad50030e7, 0x23f8aa052582bbf2 }},
+        {{ 0x4b844d7cfd1e9342, 0x8de30887e0ccdea9, 0xe70963ae8fb6c26d, 0x201c5475beb9d752 }, { 0x9771d24a5b445324, 0xa35ac6467c557931, 0xbc6a8188e706b50c, 0x1d758dff876ce065 }},
+        {{ 0x60bd0ef9620f0a83, 0x7418f23491736c97, 0x0c95f609ee2b1a83, 0x0ccdec2a67ca6fce }, { 0x1c5d3c1367f73340, 0x8ee644e11b124b85, 0x329b6e19968f108c, 0x0ef68b0b380f10e8 }},
+        {{ 0xa24423d7352f842e, 0x7380768012f68515, 0x250c785e6628edce, 0x186c636584cdc0ae }, { 0xbbce7aa3dfe69d5c, 0xd6f5607664c859d6, 0x55cdd745b9676594, 0x1957dbe8bc05f090 }},
+        {{ 0xff4b4775f6806421, 0x47563a181e8c8f66, 0xbcbf0edca041844c, 0x17b98d9b7722f3a9 }, { 0x901050cea3d3b3d3, 0x213b0515ec27e1d5, 0xf7de4c263797a6be, 0x024e090a02ec64ab }},
+        {{ 0x0dd4f88c86b31990, 0x6400734ae7009dc3, 0x600ce7a8305e5983, 0x2fafeebe3441adc5 }, { 0x269a16b8705380e6, 0x0efde6ec05922a54, 0x3152d0322117dfb9, 0x35082768a9ee9dff }},
+        {{ 0xd8c8379bc5ce17a9, 0xca898fbadf05ec50, 0x05683e52ec70190f, 0x215654905212ba4e }, { 0x426797c19720f5bf, 0xf27f6e3360506fba, 0xd33df361ee61aa97, 0x12a2b698b67dba07 }},
+        {{ 0x5364f528d1e93199, 0x9c915e7a9663fd5e, 0x1c0745b36d7284d1, 0x26f7af3956afd2ee }, { 0x5707a2a409add2e8, 0x7ef5e7fd588ea762, 0x3a31c1feeaa0dfff, 0x0f0c0a551864e0ff }},
+        {{ 0xecfa57bc93cdaff9, 0x299295a077ea3258, 0xde8dc1236cbe065f, 0x083698839f05af6e }, { 0xa3d8e5f4c33456cf, 0xc869ab1d63903f2f, 0x047c714f6284461c, 0x2ba114f452b3679e }},
+        {{ 0xaadcfca1e1b6e1b0, 0x87b46feb5b284b25, 0x8bcfcdf73fabb040, 0x200a80a1a241f1ea }, { 0x62ee5eb38df4407f, 0x9c17f630b00fcc03, 0x2e8de0f3b37302d5, 0x3fed82a5a43722ee }},
+        {{ 0x43608523d3635a3b, 0x3ab26a7bb2856532, 0x20b3b183ec3ae635, 0x0506ce257b6436d7 }, { 0x6129312509ca5796, 0xe26da6f13fd1a84c, 0xf64a0aba562c4b42, 0x20b808aac0d7d49f }},
+        {{ 0x2c1d49f09688fb1f, 0x8eb2a82256a8180f, 0x3f80ddf348d29b77, 0x0e777c9cd12d016a }, { 0x5b6bab1c243581c1, 0x0a443d23fd89e4b1, 0x91a10b926a1c435b, 0x2caf197ccef69a15 }},
+        {{ 0xd26857a8b007a4c1, 0x01bc8e26cf7faf26, 0x564a6cdb4fa0afae, 0x19a5ab675d709222 }, { 0x944ff2be4f7e506e, 0x1083d86b160312cd, 0xc5973a4585d9e80b, 0x3ac176978be2679b }},
+        {{ 0x58f834752e56be2e, 0x20a733124420376d, 0xffda1e81f375050e, 0x2b9efeaad9b79176 }, { 0x3854fe2b441700aa, 0x34d8c43754fe7924, 0x8af306ae76d4fb11, 0x3b230be56f7a93d0 }},
+        {{ 0x8c1358722cfc9662, 0x9105ee51bda4b77a, 0x23b1a1b4b18b18fe, 0x2cd575fc788f5fc0 }, { 0x3a9cb0bdfff5892d, 0x8d554d4325408993, 0xf25861255138497a, 0x2e8195ec9e1726a3 }},
+        {{ 0xf7a9bae5c0592fbe, 0x18c5339139f08a75, 0x50ee643602034828, 0x2a54059600f06c7b }, { 0x1c75fb01dba15df4, 0x7ce22c5fd326080b, 0xb1360d578c8b8d54, 0x15be9d6c918b1411 }},
+        {{ 0x3ae8dac9280f30e1, 0xc124f5f2258e8d3b, 0x82d5ccf6aed7f6eb, 0x282d7a306aba9ffd }, { 0xd04b9cb40c3e6eb1, 0x916077e2bb1f33dd, 0x29d231ab1302abeb, 0x14db58d18eab028c }},
+        {{ 0x1f67749976db76a1, 0x1e36238b50aa773e, 0xc7d318d463c0459e, 0x390be2b2052b2a55 }, { 0xc50e300e5518f3a3, 0x15aea7a9eefd077d, 0x9bac41d7eaf84223, 0x11717fd2587d897b }},
+        {{ 0x3ec3d63f09ca2bc4, 0x18eba98fccdaeaa8, 0x00dd54034a5f2b91, 0x2b0782531cd756d7 }, { 0x96a18acf026116cd, 0x031ad60e2f37c7b8, 0x3529a9713fda0f93, 0x18feb02d6d9b33db }},
+        {{ 0x527251444b37a7c9, 0x7b8f26662d8e5710, 0x21ce95f18fef8187, 0x12cd80056148f4c3 }, { 0x5192e36bb4780f19, 0x6ae93e17c93e59ec, 0xc8e3f9f1ffb5b2a5, 0x26f663ef2486e415 }},
+        {{ 0x4da194eb96442ffa, 0x13568d0653b84b7f, 0x32b397858b31c2a4, 0x237d1dfd8965561f }, { 0x3f179a015357c4ec, 0x2e99d9b83f7d4341, 0x025989af6ebde956, 0x03cffc59adda8136 }},
+        {{ 0xa271606b5ac3f09b, 0x239783f258396a02, 0x648a33720a9b5427, 0x0dac4cca1d48d384 }, { 0x5950113fc3b2eba2, 0xa01b90c4c6277112, 0xfb6d5f3ff14c10db, 0x37a75dc278b7e8a8 }},
+        {{ 0xd3c899a0e431ff37, 0x500a3f0b09dccf69, 0xec5d5b2dd954e6a0, 0x28133d13d3b0ce21 }, { 0x214aae525d4b0eee, 0x633376daece7905e, 0x07a7687b55f26d6d, 0x160bf0a351981abd }},
+        {{ 0x6afa2bfbf64b1bf3, 0xa02d0b3b6af30147, 0x779bac86a43264a0, 0x128a02aa98071403 }, { 0x5f5a5e3265d1b673, 0x39e290e1b8dbfe5c, 0x9a23f665a9d1c6cf, 0x1c8acbae6e6a6b4f }},
+        {{ 0x1cfa9e03a8bf72b5, 0xce0bd81ef3094263, 0x700af2df726a9909, 0x0acfe85055799da2 }, { 0xb858f8daef42b2da, 0x2113d6251933d9a8, 0xc79a474d981bb209, 0x3d730f85a972320d }},
+        {{ 0x1336a3b54e42f7f2, 0x5ebd4dfd11218b70, 0xe415743dafd3ccd5, 0x1dbfb2db409f5d6c }, { 0x30cc66abb1653309, 0x3b2a7d1c57ad72ea, 0x88f8e14d33978994, 0x36ece69119200178 }},
+        {{ 0x761aff0d4a41a63c, 0x3408598d2ee2066b, 0xf15c375d5f3ddc3a, 0x0e3d476400c30010 }, { 0x9dbcc1578f18b1c0, 0x33d3b504b580e47c, 0xd938792aa91c267b, 0x3ac4eabd37178e75 }},
+        {{ 0xcfae1e5370227825, 0xc0c5d3f2183e4237, 0x36aed6db3b9646de, 0x31eebdb9d62529a2 }, { 0x7d827e449388738d, 0x1428e0caf2a13184, 0x5490c4eb8c62a9d4, 0x181c10e49dab3402 }},
+        {{ 0x5da7f7e3f5e442bd, 0x97d35b9de6fe3767, 0x1acf8dd0f5d7315b, 0x259b5929d2093328 }, { 0x8164065c73bfe97a, 0x03b61c2af72b06f7, 0xc330c8ec64677396, 0x209ef8d50eb453aa }},
+        {{ 0x549f27856bc2cc84, 0x79ff6bae67d03906, 0xa751f187989c2234, 0x2c576fe2b30a8a07 }, { 0xcf5f19cab455158e, 0x25ce52cf3da28612, 0x7998376f7a71b21f, 0x0b28e1bc56183ff5 }},
+        {{ 0x966f3c89cad88ee8, 0xdf060cc4e760de6a, 0x211a4549386086d6, 0x277b21ffb353b288 }, { 0x515e1b582e61aa7b, 0xf07373b890ffc285, 0x1e1ab7039b43a101, 0x34262911b3919bfc }},
+        {{ 0x9a724fb6324950f6, 0xdaba195364689ab2, 0x6b262dde95315200, 0x1de84a0786db0bb2 }, { 0x03635d9c2e28f5ac, 0x181ae6a33f6dc11c, 0xdc97fdc56f15fddd, 0x27b48fe2ab8cbe1c }},
+        {{ 0x153202848e8aed6a, 0xa6372551d8c73d22, 0x32b25d14615977a5, 0x3b549c07cc71b274 }, { 0x613c8c1df63b5973, 0x4e681c5eae221a10, 0x23d812fb74500ac4, 0x3c4236c51124d8fd }},
+        {{ 0x7716efd734dba935, 0x31862b3bd8a07a23, 0xa88e0b51e3ee61a8, 0x2a420b006a5aabd9 }, { 0x891bc64bc2ab2ff6, 0x9e02558956570ad9, 0xf056e7b657d599ad, 0x3de0ea040ea351d7 }},
+        {{ 0x26ab672ebc8b02c3, 0x24b10ea07211b467, 0x0fd7efcf030204b7, 0x2c7e37c93a8a5f21 }, { 0x54202f7492d6b216, 0x4dcec7b607f86b8b, 0xf3f1e90c3a784d96, 0x08302c575fd62c9e }},
+        {{ 0xe43a2e3b5a3ccc5c, 0x6791025463cabfee, 0xa4a58dc1493c1ff2, 0x08249fb9d61803e2 }, { 0xe5fb55f39bf4e5a9, 0x7de55ad95d3278b0, 0x3e92dc531c969603, 0x0b20d876844a01e4 }},
+        {{ 0x97db6db003c29dc2, 0x956ca05be3eb729f, 0x2ada04dc61782728, 0x150db9b974288b4e }, { 0x154e80d0a81c36ef, 0x3ad7d62dc324f22f, 0x46d7e541aabf5de1, 0x1a259ceae6c3d4eb }},
+        {{ 0x114404312a7f85db, 0xb874ae81660cc55c, 0x2e401749e03bf208, 0x2b1f89d6b63b1960 }, { 0x20c26341e5fcee81, 0x708ae4ace582e546, 0x364cbd9c7065591e, 0x174e9690588bb445 }},
+        {{ 0x9e412b6c77b98918, 0x1e66ad0e443c3060, 0x189070c142b3364b, 0x2804c371c3ec8b04 }, { 0x793015173831cfd3, 0xb611e03903d02f41, 0xe0fd6f2a56966a9f, 0x1ca5b3c5fb55326a }},
+        {{ 0xac48a58f1f66f620, 0x9c76a4ff1a9d8104, 0xbfbc2591c76c2f09, 0x0bbef41af01f22a0 }, { 0x7ea4838f987ff5b3, 0x346784eba52315b7, 0xf6446dc1556137ac, 0x04a53418493c21c8 }},
+        {{ 0x7826af07569e8d4f, 0x29116cd60d412a6a, 0x0eedcf97ec89a28d, 0x074b2319038f0c8c }, { 0xe2defbe24cc45e9f, 0x6a6393cadbaa7188, 0xc8d5a8a2c6b4ba2f, 0x1cb10752808e2484 }},
+        {{ 0x75beda1369426824, 0x7b3e6c0389f57338, 0x31df2bc538991fc1, 0x2ba3d1aa44682935 }, { 0x1063c7cecdefdbf7, 0xb6cf4f70eb794d20, 0x56f23721601522e2, 0x0e8c4a8f30adc3f9 }},
+        {{ 0x89bdef590828f07c, 0x44ea676eb62b8ed6, 0x0db33488fe357352, 0x1070f8d925a90024 }, { 0xd99fba1d8904963b, 0xf82a0b60ad3dc74d, 0xb74fe40c38e46000, 0x39f3c8c4a4eadacb }},
+        {{ 0x7b754f96c3bdb562, 0xe1fd89d31147a6ff, 0xb4100e2e774f2210, 0x07e51d2065c778ea }, { 0x752ea206f9ff057b, 0xea218cefe66724cb, 0x0ae16e905495b570, 0x38dd6f4946a8bf66 }},
+        {{ 0x000732f3af093d58, 0xc0fbbeccc6f08696, 0xeee9099bb8b01a4b, 0x23b84358c4405830 }, { 0xb8668574fabee3f0, 0xdaa5a04776fb0a11, 0x49e585f155fd624d, 0x332dfb4aa5715baf }},
+        {{ 0xac4275efac3f9cf3, 0xa60adf2af369d229, 0xe740751d53aab6b4, 0x2e06c26c26b8e904 }, { 0xfebd3e88f5194bfe, 0x3f9854fa1a90e2bf, 0xee9ab179247beabd, 0x3a5ecae22d609ec0 }},
+        {{ 0x76bb854d5e57515c, 0x13cfec4253c3e4fc, 0x3828109ef44a4d6d, 0x32f3c5e9ea89fdd9 }, { 0xf045fd7bd682ef57, 0xf98a9fa8f7f64727, 0xe186c17128f99ffb, 0x33f8428dd983a5d6 }},
+        {{ 0x1f8675452e8a32f2, 0xe3c09bb9ee851f57, 0x80f4125dc55aea16, 0x09e0b6d803fb5943 }, { 0x4558a36abd2a9b72, 0xd238f0f8c1b6bb41, 0x927147d173fd9acf, 0x14e49721de67e78d }},
+        {{ 0x8e69af3d9ed58176, 0x6a94b8884456cce2, 0x3ae0f412b8a6a8fc, 0x0d3eaf62b5793274 }, { 0x7ed9e3c927ae052c, 0xc4fac8aa8ead67e9, 0xab81e87683513543, 0x1f6e950b9787aad1 }},
+        {{ 0x8a3e2b243b73f2c0, 0x52abe45dbfa750b8, 0x682aa892b34ecdae, 0x10ee232a5bb55b82 }, { 0x69c08ab017082865, 0x6db8bd65b322ca49, 0x69e1c4fc91c037f6, 0x0b6f5a763ad0ad95 }},
+        {{ 0x05de2d5f6102de9e, 0x0a9f0d511633931e, 0xc5018db9cb73a2e6, 0x244b149ef0a90ff6 }, { 0x3a18c1026ec4e871, 0xcf3c96c92df9801f, 0xf8de886457c972cf, 0x3f878d871de19543 }},
+        {{ 0x0b5f6aae2ef0b1bc, 0x0dd20c3afbad9487, 0x78df6824ccd22d0f, 0x1fd41c1a567e6e57 }, { 0xfcde4e49c4c98040, 0x85e2429f1e34a834, 0x3c57e3b66bc1add9, 0x26bb3f668e399c26 }},
+        {{ 0x63389d26f89028f6, 0xfbf604e73b7cd5db, 0x9200243ef1e39213, 0x07694f5579fcc614 }, { 0x2f40c7ddd01fc723, 0xa63ebd001a9b7d46, 0x5a6cdaac61e00d99, 0x0d74e02b9f9d9b88 }},
+        {{ 0xbeaf0600266fad96, 0xb56ed6ff1c79dc2d, 0xaf6fa8e47cce6e94, 0x1ee241ed80e5f82f }, { 0xe06710c931032cc3, 0x22418f3a0b4ceee2, 0xe9627472f9bd9ee6, 0x3c876bf06939439a }},
+        {{ 0x6ad7a98bae5570ce, 0x5de035dbed364a6b, 0xb2b8f2a9bf4ae3ce, 0x2235b71715697be1 }, { 0x01336fc4de21755c, 0x56e4896c50015242, 0x11087d659c7e1671, 0x05cfe4f9dc7e732c }},
+        {{ 0x335f819f3ddc5293, 0x5a5acf7eef434817, 0x2c5915310f6ee6ba, 0x141c26a9345ba9a9 }, { 0x1bf321b9a02bbf97, 0xa1fd0c5f12dcd9a4, 0xd6f557a5a19ee667, 0x16f1c95753a0e13d }},
+        {{ 0xfbf77b66a93d0510, 0xc5b22fc73199b2b1, 0x033e8c8ab726b25b, 0x1aff49a79de25252 }, { 0x096bbb9c4e3bae5b, 0x6a465e2384947cae, 0xde5702af2aa96505, 0x38f89d51404cb923 }},
+        {{ 0x1fbff98f8c253a3e, 0x2b2d91ed551557ac, 0x94b329f98b4e0a5e, 0x380c69ddbb540d87 }, { 0xb82232d7f460f4f9, 0x9f368615e2f8610a, 0x5abd533d8e19d929, 0x251ddca06cc7ae1a }},
+        {{ 0xc27af48013543eb7, 0xea43f36323d34477, 0x56ee7fb727161539, 0x3d2c0897b37cc473 }, { 0xc19293cbf951010b, 0x68e353222f7c0a48, 0x15964cf4e4b97c87, 0x3b5c0463fcb289ca }},
+        {{ 0x44328b6595603f00, 0xea3fc4777dae4d6d, 0x619c46e44985cd9b, 0x203021e8c0f1631d }, { 0xcdd2d10edc912092, 0x7a1d218f71b49f0a, 0x37f7d9f918f4ec1d, 0x3153e91910031bcb }},
+        {{ 0x7533f905d443560b, 0x2c483800d49f4442, 0x6413fa39daf36a9c, 0x38659019011c0e37 }, { 0x9ec42f9e81c204da, 0x6e677f63868f0784, 0xb51286333a23dca7, 0x30f7365e8b4f6904 }},
+        {{ 0x4887eca50651c6d4, 0x6550ce270401b0b1, 0xe491d066ba634588, 0x3bcfb6395dcae492 }, { 0x7f72a3f3a00b30b4, 0x72d050e8b4f592a6, 0x10d24e6acb3aa7f8, 0x25b21596ae3dfae1 }},
+        {{ 0x41fa28a0b79a009e, 0x97ed9fa502e3c16c, 0xc19e940758e77d2d, 0x032e65b5d426b93c }, { 0x4c64b7e8a4e2e693, 0x9c6f0c8dde546d97, 0xd81a8d80b76f0c00, 0x316fa2d5806a2d73 }},
+        {{ 0x53106212bc500fb0, 0x4e65541f0f6f805e, 0xb7c88b0e677221fa, 0x2942a58e47dc9f39 }, { 0xff8c63027c81c3f3, 0x5baa172cb2921222, 0xa18b4e9a93fa404b, 0x34d77763ee0e898e }},
+        {{ 0x7a442e4ab0d8ba4a, 0x4bf99ec4ede6407e, 0xfe54862fbc5141c0, 0x0c22a791414a5346 }, { 0x9b7216b5b54e7c5e, 0xea2c96e526464808, 0x0a0a5914e7249928, 0x098b574756255137 }},
+        {{ 0x28bf802a656124ef, 0xbcbbcfb82b059fdc, 0x6d81ac2aa0835e2e, 0x175ebabc8b57eafd }, { 0xff4706a779d33be0, 0xb79c665f3f09b2dc, 0x7e0bc1f31348add1, 0x303d0d0c20c913ad }},
+        {{ 0x99cfca67d1f1494f, 0x2d1551a5c4c2da13, 0x9bed3af0db81ab85, 0x152fffa0e2e6a3bc }, { 0x111733a7e795a9c7, 0x0cb77426519bd9c8, 0x894f1a7b8853b156, 0x0cac30e185f33166 }},
+        {{ 0xc37f3e2a53729982, 0xd6cbc9461c28df3e, 0xe3d0163ffdfcbcdf, 0x3a66505ab00c0560 }, { 0xc54891c7286e81eb, 0xa80b464cb90aad0b, 0x5511967e573ccf4a, 0x003564183fb95d65 }},
+        {{ 0xdac8a0a7287058c1, 0xd70e1e89a1de8105, 0xdf4c9c68ae196b17, 0x1f1eca8f84cd1b60 }, { 0x1d4341b99bd9bde1, 0xb2aa8a3354186fe3, 0xd5b2ffc92c58bfc6, 0x1e3ebd80b1643b58 }},
+        {{ 0xba9c69277257bbd7, 0xd89f9d4c11c63cd5, 0x77b7778006000d9b, 0x3ab8b9b6b30f9267 }, { 0x4e28abf277b1d89e, 0xade8d5d1324f0658, 0x40489ba1d0ac8ce7, 0x2c32f37b3fde81f5 }},
+        {{ 0x90abc8316b91afae, 0x5f6c3dd009ba0e29, 0x7201e0722f6d29f4, 0x29944fab50ff90a5 }, { 0xc2978260f6d8f581, 0xfbad0857e383a804, 0xa4d21f245ac7f379, 0x09ca06876450fa0d }},
+        {{ 0x3c3e1fac954e9765, 0x18d893e2e75eae1a, 0x0fc9084b68696850, 0x071e1e4be442e622 }, { 0xfd3147bd1fc28aac, 0xf04c91f22941f7c8, 0xee056103404040c6, 0x31e4681107bd8c6d }},
+        {{ 0x258d20d166c92764, 0x50ec346a38923bed, 0xa6a5cdc236a94737, 0x02a3406912a1e33f }, { 0x3a175c2961c40337, 0x89494aabfa7124d7, 0xc004d04571af47fc, 0x1422e816513607a5 }},
+        {{ 0xd0d8872efe617a0e, 0x7a8dd7a3b135fddb, 0xa577a37531640339, 0x1b6cb43640e88990 }, { 0x18ae01fd38c12d32, 0x0f42846e56d50d20, 0x0fe0e4ff1472e235, 0x09673d8818c8f032 }},
+        {{ 0xc2459191622e6eb1, 0x9d7bbd2875d0748b, 0x5a3596a3249b7d30, 0x171b2077d19eeb0c }, { 0xf5966bf412040a9e, 0x815ff6c3c793bb73, 0xd195919ac3467bb0, 0x1b1a8fdcf53d87a5 }},
+        {{ 0x0a0c46ac60207d36, 0x0959b3c9246884a2, 0x199c4866a04d35e1, 0x08717ae0e449fb9c }, { 0xe90effb6625b235d, 0xfebc6e3cecef4fe1, 0x884c20c735e46a53, 0x11544f0066911dde }},
+        {{ 0x8e24641ce90def6c, 0xf6945ffe6521d98d, 0x4b3067390d360417, 0x1d50aee56a1d8a82 }, { 0x888ab765f947566e, 0x5b87c5732f102746, 0xb4e8419f1c81b5de, 0x343885f0afa316bc }},
+        {{ 0xfeafbb1bb7398655, 0x5f179a14e9c5cfc3, 0x342cdf3539eb2ed0, 0x3a26a21b0d947eef }, { 0x072208e88fb14629, 0x06e21b81d2c41c46, 0x4e590a0448c2246e, 0x06b71be5b6fd0298 }},
+        {{ 0x2dd53be30708e997, 0x931a226c3884f707, 0xdc3a4165a5b4fb65, 0x1c108b0fe3ec52b4 }, { 0x68af4330eb862f48, 0xed6cf4adbfd7f314, 0xb6ec85ede00c7316, 0x2f1e277318ef4d99 }},
+        {{ 0xb7beade46bbca25a, 0xacc0c258401f6da4, 0xf89bb8e1167a12a2, 0x13e5c6a0ec343cfd }, { 0x875aeeaf06454643, 0xe73ec14a17006ea7, 0x0463c737bdbdb346, 0x347e38f821ba47f5 }},
+        {{ 0xaef965f142b5fb50, 0x2725b2f5ee6a7502, 0x4c1056b46ce8d1b6, 0x0ec9505c871b7881 }, { 0xdb1662c48abf6522, 0x4b39ae3edc1bd7fb, 0x1a691cadc5937df3, 0x273c95b40dac8ff6 }},
+        {{ 0x5743af0140eb77fc, 0x91128c297cf50235, 0x07b6357f739c6147, 0x279f6857e799f62a }, { 0x5ade28a2049b668a, 0x7225338ab25fb833, 0x97e830fe3d21823c, 0x33ab0c072ba2a1fc }},
+        {{ 0x51d1cc348aba782c, 0x34951f27f45fada7, 0xdfee81b62533e368, 0x1378d3ae3086501b }, { 0xce519ae866b23a57, 0x613073772e3544e6, 0x60934ff8d2d4cd29, 0x3c0b917d4aaab61e }},
+        {{ 0x4465313b7e6ce18b, 0xa552fe981a9253aa, 0x2d9b1d8162e8c61e, 0x18896ba143623355 }, { 0x0455613fcc8390e7, 0x1a24aa967f84cb15, 0x720124a729631242, 0x23cf5a152572ca94 }},
+        {{ 0xde0b862ab35e0d2f, 0xd457dab24a92670d, 0x133f6643a6440719, 0x259cf9d89bdafeeb }, { 0xc6eb955abb7e8363, 0xff7d5e518e000a69, 0x21b646b521e1f037, 0x3ba26b7281f1187a }},
+        {{ 0xafefef8b802d071e, 0xd644d642f819fc29, 0x51bfe08021dd0f40, 0x01ef614fddb88971 }, { 0x8165006acd4ec758, 0xf80dd5beb7454d62, 0x219da214e86d622f, 0x25b350d0e3880d4e }},
+        {{ 0xca2fcd00b4d0fbeb, 0x7d9828a61f981eea, 0x6e98779b6f570e7a, 0x32c9506a4deec47b }, { 0x897558e6085d9e29, 0x1723d60805448730, 0x554841a6ba82a074, 0x34593c8586479017 }},
+        {{ 0x17a5643038fe45d4, 0xc543f4c887619701, 0xb6323b146e5ea94a, 0x0a327b9252070130 }, { 0x8a28471ebec86565, 0x1bf4bd89570c4db4, 0xf910e5356d2795e9, 0x1e01363a1f5ccae4 }},
+        {{ 0x4aa462d4a99c19ea, 0xd8dc4878b7dba82f, 0x44b77eb55c92b44f, 0x1970e18c5d437d11 }, { 0xbe5853871fb22c15, 0x3c9cf5914705c497, 0x484d31e29dc8b712, 0x145108780a59f77a }},
+        {{ 0x5893681c394cd125, 0xb5d4b8a759bafe88, 0xeb60273765971aac, 0x11cf7cec959541aa }, { 0x46cba63e76a5ad79, 0x5217158b768f6a65, 0x98d9e4d006ce04ed, 0x2d3a27728aa85218 }},
+        {{ 0x3e7d65686b1df43c, 0xd366b8236ee526f7, 0xd4b03cd8c89db730, 0x34c67112a50095f7 }, { 0xbe133f2cb3d4071b, 0x5debc627d1f8ca2e, 0x4b1666a13d811f8a, 0x25d18d8dc4dad8de }},
+        {{ 0xbf1e684c5f05d11d, 0x2251db895367c807, 0xe18299781305b330, 0x21b175e14b9e50ee }, { 0xfd7e03d99c6d161a, 0x43dcc8d115642310, 0x62f7e2209383f1e3, 0x05be3ab4f2b7f7aa }},
+        {{ 0x4e6142eda3037d25, 0xb54410e2f0a5d8cd, 0x4b337753287e9c9a, 0x16e54d88f4e06c63 }, { 0xa09c1e2a46be503d, 0x07e5dc6b37721f4e, 0xf080ebcebdbbb5a5, 0x36805c728248ed88 }},
+        {{ 0x8df6a8a4a00f62dd, 0xe59ba610a546cb93, 0xafe47d36b1d27250, 0x27bc93f97bef51a1 }, { 0x07b7af7622077da4, 0xcf491a3e50590cb6, 0xf71bf0f16afa152c, 0x02ea1d6943b9ae33 }},
+        {{ 0x9e6c3539e5cb9198, 0x635ad610e6788c43, 0x5b49965d50a84b68, 0x0a69fdbbde1a0352 }, { 0xc6d714f82baee01a, 0xc862a0e9dc975365, 0x660cddecc17d3a89, 0x08d8b2ea9544dfe5 }},
+        {{ 0xd0bb9e931ac993c2, 0x6d4a143fdc910f6e, 0x407008961801f8b2, 0x3bfd947dfd3e20da }, { 0x69d692e69317bb2a, 0xb3c9dfed39b1350e, 0xc919cb782b4eed87, 0x21873ff6ac1cb3b0 }},
+        {{ 0x493922dde8e2da3f, 0xb04c8984beddc0d8, 0xd86cf46b4e61a936, 0x1d66ccf9ffabec0f }, { 0xa8b03ef4ae307be6, 0x0ef1605922d46c0f, 0x3cdae45e7b903877, 0x1906dc111e09da27 }},
+        {{ 0x3d035fa63ef57068, 0x127a7499ce95b1bd, 0x71b98b5923cbfd16, 0x1e2f5d320407a33f }, { 0x67a7a79b35766a89, 0x9784707471e0d129, 0x44fdc74a0b8f61eb, 0x024575e0c9ea9cf2 }},
+        {{ 0xce157821e507ea05, 0xdea606d0316a0c2b, 0xb7a64d40b7bc73c2, 0x07bcdbfa9d02482e }, { 0x5c7526272a2981c9, 0x806d5b8ee7337af2, 0xc04a3c06a29d556d, 0x27bd1d8cbaa10c72 }},
+        {{ 0xe5370702cbf7d7ac, 0xd7eeab52953f5de9, 0x67c82c1ab0bb26ec, 0x1d52ad417bb121bc }, { 0x01a63e3142cd7fdf, 0x876ecb9d24f8dba9, 0x2eab07d0d8ecc5c0, 0x03ae2065c9abcde1 }},
+        {{ 0x14c702851da1cf0a, 0x7ccce8ecbbf560da, 0xfc8af760a269bb87, 0x38b8098a7449cb91 }, { 0x89edc70b871728c8, 0x93da1990f1ab47fc, 0x941d81f086e23080, 0x24f966232767045f }},
+        {{ 0x24760398cd71c4fa, 0x5f2d883e1bdf4601, 0x26b8c2690e9ab0fb, 0x3ea1fe9be4e26bcf }, { 0x9e797989edcf74a6, 0x08ef433b263d2944, 0xd70de935403a5524, 0x1dd287dc959e3cf5 }},
+        {{ 0xedcc5069e91b6f5f, 0xb5557beddc4e86a6, 0xabc5eb238560fa84, 0x2264bcd57a0dce6a }, { 0xaee7b91d4c419461, 0x1b6a728cbfc33993, 0x52432262bcb5dd41, 0x2c09837fa0afba7f }},
+        {{ 0x60ea610bfc972bd8, 0x2f5dc17a7177aa59, 0x4f68d5516e7a556b, 0x3881d1c9e217dd9a }, { 0xe20e9b9cd38a66bc, 0x023a2946c9f786f4, 0xc5c7d4ef6e362562, 0x2cccf21929c0162a }},
+        {{ 0x5048ab29c8b05d45, 0xbb72e01771beeeaf, 0x0efe8d7059ecf2b1, 0x15c5853a2554b0a9 }, { 0x496345ae848a95f5, 0x27814b27f1913dde, 0x9218774f983d7af5, 0x328f7fc345526748 }},
+        {{ 0xac973180957b11d1, 0x2b4c0b179566c1b5, 0xdda6ec0f5d4f17d5, 0x11c7d9055e3f9d2e }, { 0xbd2823e32f0b1b63, 0x10569ef1842f897a, 0xc2a19c655c0ea32b, 0x02b88b26d3aaf353 }},
+        {{ 0x10d6695552ea1acb, 0xd6ddf19cb4cee9be, 0x47581a1ac80165bb, 0x0ea6c2091de446af }, { 0x3cd53c7f7dc51b50, 0x949e3ef7eecf070a, 0xf8274cd836c46159, 0x20c868be65355351 }},
+        {{ 0x5cbdc80cfffd0b2a, 0x3ef6a2b8bdb6fa04, 0x0dfe87ae3a84a569, 0x34a1f02ce24e10f1 }, { 0x93334bcd2b47f01c, 0x39584b77f3a00dba, 0x04846456cd5f41f4, 0x0647f43b92aea3c5 }},
+        {{ 0xd4e67ace9624ae34, 0xbd68010e101ce305, 0x5790d8b50d2dd3e0, 0x32c0e53a9188a890 }, { 0xb1f84912b8e69ca7, 0x362999dc1be13cff, 0x21f39074adfa517c, 0x3d9f9be417e0ae38 }},
+        {{ 0x25b1f0f68d01e803, 0x7a4e62ab1c0b19ec, 0x855179b9eee7f6c1, 0x0479d16de2e8301c }, { 0x796be0633b818d0b, 0x3d019cec00f60268, 0x58189381734082d1, 0x1c915f809e69eb2c }},
+        {{ 0xad649eabb08cbada, 0x15299dc9e7f15bff, 0x61cded9f15b71eb8, 0x0b6e0ffe4f57df9d }, { 0xd78c898b7bc98fd6, 0x312771edba95b838, 0x4927235767f955e9, 0x3b068a4fc6eede89 }},
+        {{ 0x853405dcda8a9136, 0xded05c5d2ccb1aa5, 0x1b5fe0df5c9afab5, 0x2e467fa636db6626 }, { 0xab8cecb2fe54fd36, 0x0568ec47897b9fcf, 0xb1db0d4e6800e35d, 0x1f7f0c4380eb6f82 }},
+        {{ 0x11680a2f279d73cd, 0x7e1d9cfff60d9bc1, 0xba09a578dba41db8, 0x29b0162b93552e82 }, { 0xef098dc4a1860a8b, 0xce1984936c3d5486, 0x41efa10e324d1bc0, 0x318dc5eb3c81015c }},
+        {{ 0xee5bbd07d995afd3, 0xa8ce4bbb08701e06, 0x37e16091cacf8a92, 0x13cd6f045acc052f }, { 0x5594a3435c492bb6, 0x4c8dfd176cc341ac, 0x182287d7ecaf792f, 0x1d90f66920dd35aa }},
+        {{ 0xeb24ccb936ff7da7, 0xdf9d1057a1309e60, 0xaeaf16a19bcc4f62, 0x17c7fa8ab2e3acd1 }, { 0x7b85a2a80926e10d, 0xcb3cacda62d67b04, 0x38b9bd77327ba239, 0x1c42eb59193bb081 }},
+        {{ 0xed4f7a6b52d555d9, 0x5178995ef2a8aaa6, 0x4d9c742b175da2bc, 0x21f1937de94b7487 }, { 0xf42bbff3e746af46, 0xe66b2199436596eb, 0xcc12e29a2b5b0d2f, 0x1db82dc2adb8b571 }},
+        {{ 0x932d5f6fc9a4f9b9, 0x9dc3e95a34ea7eb4, 0x6c0b8a2529168aa9, 0x2677227ee58fe54c }, { 0xdb69112205c49363, 0x8b3858557a7270cd, 0xfbf9b7e0510db87b, 0x34e34c418a8c46a6 }},
+        {{ 0x678f977ef8263aee, 0x92024830f93b0ab1, 0x43079c0f9bb211b0, 0x2c1db40a4f70321a }, { 0x4ed69fc052101ea4, 0x7bc09e378a65af91, 0x755e5a8b7c8ec3fe, 0x26111c3fa9813c7c }},
+        {{ 0xba4b98117d66cbbc, 0xfd47dfb2a1bc5eaf, 0x13299f0e0e921e8f, 0x261c164e77173094 }, { 0x4b69ffb31c9f4c16, 0x4a2c0bacdc40c832, 0x58316ec748f93e15, 0x2ee925d19a0c2a3c }},
+        {{ 0x75f7bbbbdfffaaba, 0xb76975b6199527e1, 0xfa96d7779e81ad0e, 0x1b0222e580f93295 }, { 0x830c539cc6153efa, 0x3f4690f5abdc9cad, 0xc30b95f9a48fed63, 0x3c21ed722fc81cf7 }},
+        {{ 0xab8c57c6ef87d39d, 0x78283a10f572efdf, 0x28888f9b2add110f, 0x353d2f0d5473a14d }, { 0x012104a118736b9a, 0x8d201251241824e7, 0x1bcde6bb5194d23a, 0x3511677b6b0e5ae8 }},
+        {{ 0x5ecc6ff6837627ba, 0xf700f92dc2a745b3, 0x027994c0e54f1247, 0x02fc18945e10bfa7 }, { 0x65a89a364e05a5e4, 0xa96b67dc7df5b594, 0x0ae7b3a44ea2087b, 0x0441e80fff45497d }},
+        {{ 0x4c3aa111e59c902e, 0xf5f987c8d8bcaff3, 0x785d5d624f2d8342, 0x0e43f43f550ddc9b }, { 0x6dee689123f3b6b4, 0xa5bd8179b191eccf, 0x2e157a391edeafdd, 0x319a5c6a58622ecc }},
+        {{ 0x0d3fbc6af7ce2e61, 0x93e872b9b05bb718, 0xb24150ae59a6661e, 0x210fe233e839b26a }, { 0xc44c83d709bb9c97, 0x536482ec16c96191, 0xb98da753ce59c242, 0x3cf0ae6d50924c82 }},
+        {{ 0x6a17e2a82c8bca1a, 0xd63df9aa8d0a85b4, 0x88ef01cdf728ba8b, 0x06385f6c458e9687 }, { 0x64d18f768c7ef73a, 0xdf2020364484ec74, 0xd30de52764c8bedc, 0x24fb33ad522656d9 }},
+        {{ 0xca4822e82886e045, 0x3b1d6c17a8c9994f, 0xa17f2e61fe5d9ce0, 0x1b281d864050f981 }, { 0xf31418f67ba59776, 0x9b0ac22d8ad91fb4, 0x78cac3a9062b3346, 0x084dac828e93eafc }},
+        {{ 0x5c67d4e371a36495, 0x621ba49e2de81b7e, 0xf2add09ad917ec3f, 0x290d8c465c5aef4d }, { 0x77934ca9a63aba60, 0x473a7dd5c3f50612, 0xd0a06750dcc0744e, 0x3c19af067160b044 }},
+        {{ 0xe49f56edbc5fc80d, 0x45b5ba87392413b3, 0xe17591a1f47dad81, 0x25641c8835af908f }, { 0xd341a43830f84917, 0xb149c2502aba5d32, 0x6a1c3c0692e69743, 0x01ec2ac260403a04 }},
+        {{ 0xe5ad6e74bc708bc4, 0xfc83c4157e3d2272, 0xae8150459ae30895, 0x390cb7d141a0b9ee }, { 0x0ffe75f09bdf4dab, 0xe19ebe93ce61c6e0, 0xbafcdcad09e7967f, 0x21735839362d5b12 }},
+        {{ 0xed9561943d27d5de, 0xe99a0d74a10de963, 0x504dceb6fd3dc689, 0x18e435f7a3dc1f82 }, { 0x81d599c2c5eb5515, 0x41ffb305bc6b60d4, 0xd208e668088b82c5, 0x1867dbc4bfcc0e49 }},
+        {{ 0x6058498d69aba4dc, 0xdfaa74a4dc9ed6a4, 0xbe8f987df75f511e, 0x32901d48aff9a052 }, { 0x4c12e927e1bac88f, 0x0d20384e07a177eb, 0x6a49fe856c42186b, 0x1ca80dbb2490148f }},
+        {{ 0xa4576badb461038d, 0x097d6d03e0c0da3e, 0x5146298d4167414e, 0x056046ed8afe31da }, { 0xa97d514c4d6b6c5d, 0x8d4907498eaf6613, 0xb2dac363c0084f77, 0x1814b3c25c73c226 }},
+        {{ 0x3d3b5f21a7a1c37c, 0x848af2ae4128cc9d, 0x8064a4a26cc7da99, 0x14c5061b7d69f055 }, { 0x08635fc0733475f4, 0x8a00d2c326e11e3b, 0x3dfd95741e06cc27, 0x2b384c30ad2843d6 }},
+        {{ 0x8c6d3c77c316c070, 0x892a02d948379027, 0xe88a4ce88cd0bed9, 0x05dac1eaed529176 }, { 0x1f161f2d5b21dd33, 0x5e6eeccc91823a8f, 0x2f6d6c8049dfa42b, 0x09219f1ef4ab13a1 }},
+        {{ 0xa8ca31362469b92c, 0x7e97881863704f6e, 0x80e1ceb61620b7ec, 0x26976da12b787e74 }, { 0xffccf421dde460f4, 0x5ea3e0743c3ee02d, 0x0e0b05cf899094c5, 0x30d4f6647f4ad230 }},
+        {{ 0x754061c980560770, 0x854d9122533c4a36, 0xc509e026a78001a5, 0x0de4ab12e29634fc }, { 0x04aa031ba4b0be9d, 0x873bdceee8d003ea, 0xa89a6c8a0a5c47c2, 0x3e443ad4764e925c }},
+        {{ 0xbf81a24ccb63d2e6, 0x868fbe2dcd88c0ce, 0xd53b76732d639385, 0x0032334cd56bc172 }, { 0xac9e7e1c3e5b40f0, 0xa002397bff6ce60a, 0xd3dc0b33fb61395d, 0x195a0084fe360618 }},
+        {{ 0x8d2edab9a68ea958, 0x57bf851df171c634, 0x07d808b2c3989621, 0x047ed37493d818c4 }, { 0x5a54b53afd842daa, 0x2c94009029faf280, 0x8a9e7dc60be7b030, 0x2c70615a04ee8d40 }},
+        {{ 0xfdf2c5e68833dd0b, 0x7ce32613b9184dd6, 0x0928d1063c052028, 0x269152edb0923b70 }, { 0xa2d27b6d6a7797aa, 0xa05f6083976dc417, 0x8b75f1fbadaf87c9, 0x27a1a4d0c0814637 }},
+        {{ 0x5027172819a0e7dd, 0x9cade6d1279f5345, 0x09a21e900aa7270d, 0x17ad98be2d7e77cc }, { 0x123d1eadaef46e01, 0x65661d7232578672, 0xe58efb42c9750b12, 0x0c0bd6a5ac046c8d }},
+        {{ 0x20ecdcf5167ab176, 0xe1c2ad4c2ae313dd, 0xc58f2924b297a5d4, 0x253f7a86e51d7ce7 }, { 0xf92e5f0f91712375, 0xb9a9389ff451b712, 0x769411e22acc3eaa, 0x2694a4dba39a97e4 }},
+        {{ 0x8f0cb820e6b425b3, 0x5aa021a32f4cc154, 0xfb814348f25cc5c1, 0x03fbb7e532b5eaf5 }, { 0x6e612bcbca15d359, 0xd193296cf4fdf5ea, 0x3fdab1b6d167596a, 0x07899a2c2a7921c5 }},
+        {{ 0x6d73b9cafd8ad878, 0xa83756eb8dbe8993, 0x086b8d357d87dd4a, 0x06475ee6c54d1ac5 }, { 0xb019cbacd808216b, 0xdd8519d117fbbe56, 0x6829d9804ec3de2c, 0x3376acf99403abec }},
+        {{ 0x38e65dc3377cb08f, 0xcb91504498db7637, 0x17390e7cfd89f36a, 0x3ad5ec1970a1cf1a }, { 0xe2b7ff794063d5ea, 0x88ddd9b271e86b3c, 0xc2b8408702a9ffdb, 0x32de3c7c1db55645 }},
+        {{ 0x0d1ba1e44b53e123, 0xe8845b10c29350ca, 0xc102a3d874826d9b, 0x3a5324cbe94a4bed }, { 0x0944cf42f016f9ee, 0xbf209f7fa5d1cf5d, 0x840e4625d373cffb, 0x1caa09b868bfe347 }},
+        {{ 0x4af9cc9f469b4418, 0xb7101f93a82a9cbb, 0xbb831b2c044fe54b, 0x20e5401800e10f55 }, { 0xc4e8d095988d2438, 0x0b8b765790a8a2d7, 0xab24d65198112fde, 0x05ed51bafbf0649e }},
+        {{ 0x163cd5719f617ea9, 0x4ba41466d9c724c5, 0x5cb997ebc76953a8, 0x11b130a9a4bb1cbb }, { 0x886d88310b643458, 0x68c25f8266ed94fa, 0x25ee59ff62dd3d2f, 0x11cc483fdbdb1858 }},
+        {{ 0x7acc6c656dff8487, 0xf6acf660fe621184, 0xe988426917d6b1f1, 0x332d8bac2ec10203 }, { 0x49d0f48b32a3188e, 0x5dc085231a6c3eb3, 0xc9160f36605a6754, 0x08a453575a12dde4 }},
+        {{ 0xa13c566e00d8cb49, 0xfc63f85befcc4955, 0xa0c45aa3d60f335c, 0x0abacb1bf9ca593b }, { 0xbaceaaca0a9673c1, 0x78b6e060b651114a, 0x3fcfa50d45f6677e, 0x3ede7ff091ccc71b }},
+        {{ 0xb28a1bb8631f69af, 0x823f04a6f0654364, 0x5e11fb1cb5576d83, 0x176709c1ed7a6840 }, { 0xb12e74b5f6da5d96, 0x897efbbc045ead3b, 0x8bad75dd7d8af9ac, 0x08f563b5f2ad52a9 }},
+        {{ 0x5f8a92740dbf9c42, 0x0a05c643446fa0c7, 0x86266395c9e0a162, 0x1b9492c6edabe529 }, { 0x36864023c577df13, 0x52f18f87a253ef6f, 0x443f0a3eaff74c8c, 0x15eb44adc2110505 }},
+        {{ 0xc935ca35558cabae, 0xe7aba0efe3a9d27a, 0xb96679d7e4eaa548, 0x028a1011f07abbc0 }, { 0xcf2d1c9d1f01bb4b, 0x698b8c71631f9f6f, 0xf7586d24a8c9efe6, 0x1f880639c16596f4 }},
+        {{ 0x6932034d3d83ddb9, 0x02b787ebf1b1bd28, 0x55534bdc49d518de, 0x1ae8cb38040115e7 }, { 0x7a9d23ac29adfb13, 0x2a961b0cff359708, 0x5422c3aea9a913ba, 0x3a8b305444fcb30d }},
+        {{ 0x023f1dd3adfa64ed, 0x82d44c9d826ee1b5, 0xd95f26237fe26e2e, 0x26ac7a90e0cf6234 }, { 0xd994e7468065bbf8, 0x9d9222ecac9da2d2, 0x26387df7ad6616d6, 0x3c4ccdb4e17c2141 }},
+        {{ 0x7af9cf8945e9b105, 0xba458bf53fe351b2, 0xb4a2266619d3d26a, 0x24a289ff765caaf5 }, { 0x18722d5421bc690c, 0xd191511b8dcf7f3a, 0x014ad4e09039901d, 0x16885abfc5bd451d }},
+        {{ 0xc5bcd707f84555f8, 0x7f831f69187f6cf6, 0x6ed0b3df011fb3a6, 0x3a6d8b9407aecd3a }, { 0x02dcfed4373d5a88, 0x81d6021c8b3975c7, 0x7cca6c9ecdd33a45, 0x3cf69239091b758b }},
+        {{ 0xa063f64ce2f700d7, 0x45821e0b5c0c33d1, 0xb60e09577bd30f25, 0x26fa3a0848a06329 }, { 0xb2a2932a7dda6563, 0x28c0f16614bc6f62, 0xdd296a3ea0477665, 0x1fd8a90d077f81b6 }},
+        {{ 0x8a06584bf637cbe4, 0xbfd7cf2c8651a27f, 0x798f68dd2b7bbc0f, 0x1cf388d739f489e8 }, { 0xe86e0e7bcb194486, 0x8dee51d3814b5617, 0x6bf9cf0654123f85, 0x182f373b9a31f1f5 }},
+        {{ 0xa8e17471abdd7379, 0x306e0322343c4d04, 0x3a081ecb857f8723, 0x2cdd1caa91095c3e }, { 0x9517848acf4d8cae, 0x551606e5199e7a3f, 0xec8b2c30ffb3eedc, 0x1b5ea9ecaab97a01 }},
+        {{ 0x077df8d21d402802, 0xd13889e967240abf, 0x7ee9ea0ac2bcf5c4, 0x3713a6097022ca4d }, { 0x531a6f657545bf60, 0x2fc760e65d6d830c, 0xc289a659ead92c92, 0x02f4f492620f83df }},
+        {{ 0xec87cd73a22e0c0c, 0x1f0255854a383e1a, 0xdeab984c80bb1a74, 0x12050942abc1911b }, { 0xed3e7fc4bd3a98d7, 0x16e8503e4d9e1261, 0x8250c41e1474b0a3, 0x36fac91f67afd3d1 }},
+        {{ 0xf3331e5dc9e7a379, 0x6127d5fb86668176, 0xa5513b2b1ad26ed3, 0x3080947debb492d0 }, { 0x645e7314828b16e6, 0xdf8261bf7424941d, 0x13e1678175c9ef3c, 0x35ae2b6ecc23eb3a }},
+        {{ 0xaff215ad7b38a1fa, 0xb70275af33f38f0e, 0x6bc2a59c2837629e, 0x3bfb55e8b083f854 }, { 0xd9ec608dc41399f9, 0x906cc5e676a82fe3, 0x56944a108728ec02, 0x188006a70121377e }},
+        {{ 0xb160ce32952a7775, 0xbd02c4e496e43579, 0xbec86f5c0a142b35, 0x103d43beada4d7f8 }, { 0x8987832fade62297, 0x457ade9c964e953e, 0x3a696f6da821b818, 0x002e4b391277d4de }},
+        {{ 0x8b14f2a41f4dc922, 0xe93b9f75ba983e70, 0x4923cf7174c39640, 0x05141a0c2300731e }, { 0xbc28bff969748b2f, 0x2eea7597bbb306af, 0xf4ad705933e3aa79, 0x0d94d390320269bb }},
+        {{ 0x771bad047188bb7f, 0x092c63ec17c3c9d3, 0xcecdfab03b5ef409, 0x1849576d594e34b2 }, { 0x65065a774d8ea7b8, 0xb9e1d009aa6cfe57, 0x392910c46af0a63f, 0x276f401bb47cb063 }},
+        {{ 0xdbca8ec9cea0fba6, 0x8ceb4d863d809329, 0x313b8bef757d73d9, 0x1ff7d7673e196419 }, { 0x7374d9d9fd0b2626, 0xea14ea971d477cd6, 0xab4ca6cb33d62ea3, 0x3ca4cddec6f61022 }},
+        {{ 0xd7be943f73d76210, 0x81e85fad0cd98367, 0x3193c9ceb2df2b48, 0x0e067120391cdff8 }, { 0x0575c0031a95e989, 0xda750f497151d127, 0x10e7f33a3e667232, 0x21e8586c34bf5fa6 }},
+        {{ 0x5923ad9f2706dd37, 0x4d5775a67a7003f5, 0x6448361a78f21c53, 0x27a60b877361268e }, { 0xc58fa2561c9f1aea, 0xf2fd7d641dfee734, 0x51fc8ca491ca660f, 0x105d4675e188c131 }},
+        {{ 0x06188cd55ea8f568, 0xa4284bb359a751d8, 0xb873c333076df26a, 0x3d2ff7aeba62acc1 }, { 0xb6b1c52569339b63, 0x47509f7548dc8973, 0x8d12ca44c0d9788c, 0x03aae6100a6a6d34 }},
+        {{ 0xfeec8697cc5c2251, 0xbc7465cfb6177680, 0xf67c35d5c336b437, 0x1d45e9274fb57d3c }, { 0xb11e4123ecfa3ac5, 0x95f81cd2ac5dbe2f, 0x6c77eac289631a74, 0x2dfab0fb796252fd }},
+        {{ 0x270813b584add03e, 0x9d0e9fc35181a2d5, 0xe514e0bd40eab9e6, 0x1069a31bb81f641b }, { 0xc7de658cc502638c, 0x37ff33f4f8883b41, 0xb78c0812b2a23e82, 0x19ba5f2ce1b2b7bd }},
+        {{ 0xdad951e3515225b5, 0x6354ed06d8a4bc5c, 0xca55c5bc6a561586, 0x011937bfcf3e2868 }, { 0x2cca85ab62300b8e, 0x1b43f08215f092af, 0x763446adfa2dd16c, 0x3a2ab0acc3b38c1b }},
+        {{ 0x6b945307e812c638, 0x0e6d004e557579b0, 0xccaed5d7b443f30a, 0x0390080e8e832e2a }, { 0x6c2037c7d22fb57c, 0xf2d58fa55ad8b4e4, 0x6ad73504c9ace7a1, 0x3222d660d2966d18 }},
+        {{ 0xc39ad95cb7af178a, 0xf405e9c03cc6ba2c, 0x8fa28023bb6ac998, 0x19d52e75f166f8c5 }, { 0xcd866b116a6decc7, 0x7d00a874d9f88fac, 0x2bcfa825398b834d, 0x1507e57ea3f84e20 }},
+        {{ 0x17718421cb5ecb5c, 0xbe9400d94abe8f80, 0x701ef8ad6384fdf0, 0x15e5b51726f033cd }, { 0x20415eff19f0dcaa, 0xc1a6f501159928e8, 0x1216135ab3eab2e5, 0x15c56080c8069d84 }},
+        {{ 0xcf1e4742fe463244, 0xd9d8b4d6d8415693, 0xd73ab4a13378156f, 0x2aa831412ea3e52a }, { 0x47b7a7f3da4de4fb, 0x94b94c2cc941572c, 0x7dbcc1769b847e0c, 0x307ff05d988f0ce9 }},
+        {{ 0x13d717d98774308a, 0xc5e4a18692e74749, 0x288befcdbb880815, 0x3d5951aacedba776 }, { 0x9d27dedb73280504, 0x78a5dab83b110193, 0xc003caedcba222b8, 0x32676c729ab67adf }},
+        {{ 0x7907754e1a442de3, 0xb5f063bb54c28775, 0x5ece28898d96a393, 0x1312cf77c4290396 }, { 0xd6969833789c6543, 0xac2f4e0312e36d42, 0x9ea58c9f7a7e62f1, 0x20e35f29a61b7063 }},
+        {{ 0x9169f13774f226c2, 0x0f07fc2adb107a78, 0x59d816ddbc186e80, 0x1e173c8b2ccfd27c }, { 0xb161bc1178317215, 0x27aced7a54eba58e, 0x50cc984671236dc1, 0x0965b851f057fc07 }},
+        {{ 0x16740bb06f766541, 0x3e7cee81abf57426, 0xa79ca15a31845ddf, 0x2b3f53c0e3aa1145 }, { 0x33f531f52cab5801, 0xa7a7ca68735af944, 0xd218a4c874be7365, 0x06e2ab28ff3f3d77 }},
+        {{ 0x64bf3672c7627a96, 0xb2c96442e1972189, 0x47875910baccca2c, 0x378f72d47f52e0f5 }, { 0x0d802267da7492b6, 0xe67384af2454f38d, 0x782daf7571b70155, 0x20d307e4c8535920 }},
+        {{ 0xfbb0d04bb46a88bf, 0xc8999c49dc1b5886, 0xd045889fbdab283f, 0x392c9e75f282a9af }, { 0xfa61d4634b62f73d, 0xa500139524777ba5, 0x588338395cb42f48, 0x3c7990c1eeadb3d2 }},
+        {{ 0x4328773f969da895, 0x0e1b4e442fd6719b, 0x3a7756b2f987502c, 0x1a46cacf358d372a }, { 0x0143e608d02ec649, 0xb416a03916d93ecf, 0x82abd601aabcf46f, 0x2c20397b210159eb }},
+        {{ 0xb677170c02a70cea, 0x43ecd3aac4594574, 0xc46b4d36fc14a5a3, 0x062b5853e1745070 }, { 0xee02b8ff9130a5b7, 0x8709f2a2038a2f23, 0x665606c7d3d67855, 0x05b077317352f78e }},
+        {{ 0xd0fa6886aaa69906, 0x60645a9cc6290e7f, 0xab0596980cf4e197, 0x2b3b2fe0d2da86bd }, { 0xa80148daaf179e57, 0x4e620bab76e4c658, 0x3557ee88b8643b9e, 0x39b3a33b38d706f0 }},
+        {{ 0x76479f49fbe396a3, 0x1bb3c3f7886d6196, 0x346034c1b158699e, 0x00756a992f855de8 }, { 0x3256611362977d29, 0xe37f021db3c545d9, 0xa034edf6c70556ea, 0x10e8f9d6c3a99efc }},
+        {{ 0x3d4b91a43e08b5d9, 0x0cef8b2c6b153cda, 0x9ccf43cbef371a6e, 0x16799e5b3f64e430 }, { 0x43c65a76c198f6ad, 0x70e8cc3d2f826cfd, 0xb1944492891dbcfc, 0x02035211ecfdada9 }},
+        {{ 0x94f9ab20852ef8b3, 0xc3f7010add66da58, 0x083e6297932e70cd, 0x0972929ceba592a8 }, { 0x5e3a465197b7199a, 0xd67fe35fa40e862c, 0x060a751186a193f3, 0x3e6457a0479d517f }},
+        {{ 0xffcf0c9d3500b579, 0xa6974f5217b95129, 0xf850399796c0a133, 0x11bad56543f949e3 }, { 0x80cf82b1239b797a, 0x3c21c98e673bd1e6, 0xe377f6a157918f13, 0x2783a7fc798faada }},
+        {{ 0x1d20826a37031ccc, 0xdcbf84d1a2b18d22, 0xb1e41c77a12f0ba4, 0x166d488ef94c1744 }, { 0x74627d1b3b7fbbfa, 0xe2f97b4be2fbfbc9, 0x43947ecde5c2466a, 0x383ab8416533ba1d }},
+        {{ 0x24b92c28d1af2b9a, 0xf4a1fbb9300a358b, 0x2cb931f7b8460cfb, 0x0a847e2703e0f4fc }, { 0xe76fd0c02d6b49ab, 0x05fe5348691bf209, 0x44b0b55ab93624dd, 0x066c4ada13a8936a }},
+        {{ 0x9836ef1dbbbc25d3, 0x86bf65fb2c77921f, 0xa213fd07943f9375, 0x282feb289b74d4f6 }, { 0x4e7619d95ecba019, 0x0e6765ce8a970688, 0x4689c99417079f6d, 0x3a0826df5fb173c8 }},
+        {{ 0xe72b0ca428778e59, 0xdcf4c9d1c873ef74, 0xc559ba111c2487bd, 0x3e58d553c90bf740 }, { 0xabcf7cca8c38a3bd, 0x46c85cb60a282a21, 0x84cb9bce746c21ab, 0x02428eebff6260df }},
+        {{ 0xeea8f28c1e409206, 0x30abc830d55b55da, 0xddcce0fd3510578b, 0x28fb0f655f0ad0e3 }, { 0xb5fe12669b9c65de, 0xadc46ab125e84865, 0x19c4abfd9417725e, 0x2649cc9e0b7f400d }},
+        {{ 0xe770f0b73275c239, 0x31c526764c6850e2, 0x5a56b98e1ae75e98, 0x122b768100514b04 }, { 0xd96a2ae3f57ca9e0, 0xa0eebf6d8a7a07f8, 0x31ce5dd2222347ec, 0x017890990ace758f }},
+        {{ 0xf376a1640d9dd4f2, 0x63dcb2856e7e22d0, 0x5326a6d10b2c1d21, 0x2b5b5b4cf4d03dcc }, { 0x9aceb12280e84aad, 0x612f3ef3310685b7, 0x1e2c38c37d7eb43d, 0x37721af13c561d2a }},
+        {{ 0xe3673953bc2358b1, 0xc872f1c672590358, 0x0bbe1841851e3f2a, 0x044c019ddb8fd7a7 }, { 0xe6b80bb6d662aeed, 0x83d1c671e5d32d8b, 0x86971bd9fecfed85, 0x39ba39883d6c67c4 }},
+        {{ 0x8a3ce52e8a1d9347, 0x83c5e88eafe4197e, 0xa3d5a86459368766, 0x1515e99106e6860f }, { 0x6217072ac5440c7f, 0xe6b28f0c814d2c60, 0xb9acd3bcfc56a829, 0x18f58ae47122b09a }},
+        {{ 0xb645d86e0cc395fc, 0x1e14b6a01825bd34, 0xd99610e56f3c5200, 0x192d2f059fec50c3 }, { 0x663f131fc8a08dd6, 0x161385dca7d2c06e, 0xfbdb770cbe4e1641, 0x197d5cb2033a98bd }},
+        {{ 0x8c893c731d9a1c7f, 0xd42c1fc0bc43dfa1, 0x53087262373e138f, 0x1b9906108dd467b9 }, { 0x6e4cb81d39d244e7, 0x1b655f9095d53637, 0xcca6ce46c28d2b48, 0x2fe4cc952491329e }},
+        {{ 0x66a34dfbf00c1a74, 0x8b98e0daa654843c, 0xe0952b8f917e33e3, 0x1aed2747e656569a }, { 0x491dc3fca2c0a74c, 0x6ec7c2b322e10fd7, 0x47a8769cba12f5c4, 0x29533726d64486f9 }},
+        {{ 0x70bcbc4567277a25, 0x8214818d327d703d, 0xcd20f43104958f0b, 0x0ee18dacbf707632 }, { 0x6ccac031df882c07, 0xab7920edbd46ef26, 0x7f4a484d5dcf3bd2, 0x2bd8f42aabd24950 }},
+        {{ 0xce7cccec378b3d9b, 0xe044cbf866f22d0b, 0x97c0dfaf5cb3e079, 0x0b54d33f881a87c9 }, { 0x731153dd0b964665, 0xc6359e674a3eb485, 0x5436a08d3d22be28, 0x26e96099f31e4cae }},
+        {{ 0xcdb269107df4c909, 0x7975014a97032a62, 0x7ac5c8a4969f64d6, 0x2f2cbb79a11053af }, { 0x95d13bf60539f74e, 0x3c65b79557f068d9, 0xded7348db62fb6a0, 0x01778e731d60703c }},
+        {{ 0x98c2ac90344012a9, 0x9d4b782f32de920d, 0x9422f4bf42e0f0f4, 0x200e2ebf9d492675 }, { 0xdff86e614585b00b, 0xa6911ce792bbe71d, 0x6946fe7165fec4b6, 0x12f759034bea8d87 }},
+        {{ 0xa66609fb95b1b4a1, 0xd1fb24bc00b91bd6, 0xd5e31d92150048b4, 0x073992d2d81ee0e1 }, { 0x8979161d8098f708, 0xc62c10834b7d368a, 0x871cae9227ab61b3, 0x0babbb46d60c0374 }},
+        {{ 0x76aeb73cc9acac95, 0x4bacff00a628dcfb, 0x79d94dea092685ba, 0x2f2aa2eb577eff3c }, { 0xf01beecff5e51a74, 0x708af8564a8cadd8, 0x7a0affaccae5e9a3, 0x0508bdb9dcdc3a37 }},
+        {{ 0xce87a65de1757204, 0x99f7b4d7825ed0a2, 0x39beb7ba1f67e715, 0x1591ee7bd2aeea53 }, { 0xd8c4356fb295faed, 0x1a42f40c101cdf0f, 0xda9f682eed8bfb83, 0x28762e84687be01f }},
+        {{ 0x7e9bebaea3536025, 0x5af1832f797c0d2e, 0x1e00269bc840052f, 0x1ee3d3d1f4b63731 }, { 0x4b1cb961eef6c2f2, 0x6b718801431b991e, 0xef54d8cc5b74ce36, 0x24768b09a4eb1cd7 }},
+        {{ 0x993db35fad8d4b09, 0x2fca23db99ce32fa, 0xa88437bfa11345c7, 0x016cd7c5c97b3dfd }, { 0x2354ac01fc68a392, 0x70f45e8d97d78158, 0x30a8c03961671f23, 0x2e2382e3bd0ac188 }},
+        {{ 0x167130b458a8a033, 0xec08cbbaecc9f24e, 0x3b0655bbc67bd0bb, 0x3b6db79b594eb75b }, { 0xa7201fb04bbffbe1, 0x672aa5445e98b891, 0x90617bc1b450978f, 0x035a9989a3e52d5a }},
+        {{ 0x8664022d93585496, 0x7fc86a3b86c6f6de, 0x6da0dac5c2966d56, 0x2efdb4787bc832e3 }, { 0x6caed7f1a52a6e61, 0x4f0c3941d9ce4232, 0x334817d790c4634d, 0x2f5c6a3aae81d19c }},
+        {{ 0xf1bd89b9495331b0, 0xf7163f03f4698173, 0xb78656b8a309c864, 0x07e262b3267bfd23 }, { 0x728a5050817965d0, 0x3c94974d4c763fdb, 0x45688912737bc202, 0x33e099a29964e7a0 }},
+    },
+    {
+        {{ 0x35d58ff521e256f5, 0xea9a0d4f7114c2bf, 0xdcfd15fc5c3bcaf7, 0x393867d24fec04bf }, { 0x10069a9814ef7116, 0x54e86d7dc6215795, 0x7f99a5802ebbbf42, 0x0f94e9bc8b831c0d }},
+        {{ 0x5151d5aa661441a8, 0x5aa52ff756cb6c28, 0x4891c8fef7dc7cae, 0x00d44ec275111610 }, { 0x8e7d76a48560ed66, 0x94276ad12e0225ac, 0x190bcba54369a605, 0x11c20fba751b9b6b }},
+        {{ 0x1214dfb016cfad92, 0x5a2c4f4d04fdb5f0, 0x8259fcd16a8a990e, 0x1ca8a834909711e0 }, { 0x854fa98a466481c6, 0x0c9a4e4acda5b597, 0x16630fb878d37f9e, 0x21157e3c2879ea9a }},
+        {{ 0x2e73f91dcf4b43e7, 0x0bec6c13d0073022, 0x83e3fc3595662d22, 0x2e58ef5ceb3480f5 }, { 0xd88117d489354d12, 0x70a3950643aeb82d, 0x54a35c609e7e52dd, 0x3ccc38b00d2b27ad }},
+        {{ 0x9a7c619a67f64270, 0x7ee3031104103fdb, 0x29a88284c089587d, 0x27569d16ab1c50ab }, { 0xf81a2f038c267402, 0xfe4cb7539b01cf85, 0x2d67e9fbc6c2ebd9, 0x2e7a3acab7488936 }},
+        {{ 0xabda51a68dda68d5, 0xa06d7eed691d9749, 0x15802e722c18e6f5, 0x2f65953a37d1a8c6 }, { 0x9fbe3af5eac0ad07, 0xbd31232c3b70bce8, 0x51809fe840ce1a0d, 0x11e2a781b12f65b6 }},
+        {{ 0x196a9279987fa790, 0x73e0a5d917daf2ce, 0x9386685710714437, 0x1550e47f70aa2426 }, { 0x294a5eacfdecc0b5, 0x4db54509f26f1cc9, 0x903589ed13af7bd2, 0x02fde751579ef0c2 }},
+        {{ 0xa6b985f84b9ba44c, 0x558e77b7dd301dc3, 0x799c160a73b2306d, 0x1afe31e5abab2bb5 }, { 0x801862cb08c486e4, 0x87f82a000453cfec, 0x27aedb93d74cdad6, 0x3c5ebba61450ef7f }},
+        {{ 0x02481e37cbde6699, 0x87d6502b00cd9b71, 0xc73839d23e0d420a, 0x288bea80b99ba7dc }, { 0x759ef63032f7e843, 0x3f5af5ea4c7b0c7c, 0x30042aecc100c96e, 0x356393e1036f0f5d }},
+        {{ 0x44029eb1d0a50ae1, 0xbd19c6109629923a, 0x3afc26ba11effd93, 0x38286c3295748b66 }, { 0xc4cc4eb2131a3980, 0x1f04410998daa8ce, 0x4553734015732e68, 0x28f5351be83ab72a }},
+        {{ 0x569c682b513de369, 0x85dd0270e4e1691d, 0xa98f128d3d1926c3, 0x0eba65b63ac11209 }, { 0xf1a94e9b88a43252, 0x05ef7f42eb33cb4b, 0x83a014771843c7d1, 0x1e6cb59c6cea925c }},
+        {{ 0x4f492d12cc166e07, 0x6f908d788d3a1db3, 0x4c890e560e5080b9, 0x03f0a8fb47e3310c }, { 0x2b73a4bee84842df, 0xc6cc62a531b5ffc8, 0xd1a398be0a20c4e1, 0x32676fcd4b3403e1 }},
+        {{ 0x78c8600b0e194ac4, 0x6415f66d400b5286, 0x0b37cf1725f678f2, 0x08e7ac302c407d07 }, { 0x1b7498412f9ae7c2, 0x9edf0e4a7c39c080, 0xc591ab67f558ce17, 0x0a5c4c2bbfa122e9 }},
+        {{ 0xb94637b0c8fc2b38, 0x79fc7bde057248b3, 0x6e2640016513c77b, 0x36b7a3f4c2e33065 }, { 0xf445cbc4c99801e1, 0x8c472f1b52aa8289, 0x572d4df8d3bb4c81, 0x3e929b1d2ad85684 }},
+        {{ 0xef9fee2df1eb21ef, 0x4257cc43908d6277, 0xa87acb095405db95, 0x02a6ed839f5b7f2c }, { 0x4ca1386b8c96e672, 0x84cdf9646f726844, 0xe65b409fc02765ec, 0x0c2022cf80c7f3c7 }},
+        {{ 0xcfb40dfb06679dc3, 0x9a609f07746b7723, 0xd0857e2a167c52c5, 0x07ed63834535a6f0 }, { 0xfa9f657d7e2eee30, 0x4c0d0df19ff5d4cf, 0xac6c5029eeff0f71, 0x0dd08db7521ae88b }},
+        {{ 0x388022568ae3dcbc, 0x357c3f97d2d2b766, 0xc37297b0b6aa7339, 0x2a5eb52b182d049d }, { 0x6af0073ee4ac7866, 0x054b826ada01228a, 0x9d6c876ebe65a26a, 0x3fdf2c2245892241 }},
+        {{ 0xad083d634e345b56, 0x27ba7231662d162b, 0x0ef9a9787a06ae62, 0x32a582c3ad3b9e75 }, { 0x6fc3aeeaf23df23b, 0x04b747e85054268a, 0x398cb39dc4b54dfc, 0x1108692e4f1bfce8 }},
+        {{ 0x67073eb5df80c7b8, 0x1f664b6df34770e8, 0xa1666f361c843c55, 0x0f2657cfe25eb072 }, { 0xbdb4e4d549e603d3, 0x38c24d67791a7b25, 0x20fd31edb2755155, 0x2f3aa1d166d96f2a }},
+        {{ 0x12e70815bc8f37d3, 0x9a5b496ee05e477b, 0x7b5e005dded617d1, 0x022e4af890784cc7 }, { 0x046e8b295853eec0, 0x6e7e619fd9f9f357, 0xc5dfdc53ccc34159, 0x0902ed01b2854af9 }},
+        {{ 0x4651bd960e5d643a, 0x631f0103895e2355, 0xe9620fd932633644, 0x3e87a61297567054 }, { 0x580f82dada1c5e88, 0x162280282417374e, 0x15203a397e4a67c9, 0x3319b3c03bbb686f }},
+        {{ 0xa9ff4dec83a68929, 0x5f83eafcd4585d8c, 0xa396ba9aac0920b3, 0x047683c23e3016a8 }, { 0xb8d2b2c98be6a87e, 0x24cb9686cb83d3ec, 0x9ee5a3da76b829d6, 0x11c3c1c3638cdc8a }},
+        {{ 0xe76564188b3b81db, 0x7ebec560e7919d48, 0x143521d897ecfd88, 0x1f1a0000dc6a35de }, { 0x6a2932a1719cec1d, 0xf4f6a889a4ef62f5, 0xd75f34be1dc9cb8a, 0x3f28490218739a7f }},
+        {{ 0xff6e78c890bb0209, 0x7bf995c27d58422c, 0x8a3d62c998238181, 0x1be8f3966f28747d }, { 0xf59794759f4f0985, 0x1a5e2f3233adff4b, 0x37e106088183374a, 0x117c5d966dcab470 }},
+        {{ 0xe13da66356337c53, 0xa5947f218e0a9668, 0x3c58ad423b22a384, 0x0a14bf1a1cb235a1 }, { 0xc523a93e01321b09, 0x3f89ef3ba41bbc10, 0x868e8c0026659561, 0x1d9a03d6b1fa4648 }},
+        {{ 0x49854beff47779d2, 0x3226467f23c92ec6, 0xdbeee3f9a18baeec, 0x1cfee1d821dc49af }, { 0xe9a5278e50f61d1b, 0xb3029e058d132f10, 0x589d9217eababa20, 0x362fbf8d04484301 }},
+        {{ 0x2b46030b7d14a974, 0x31591c9df8c6da63, 0x8aaa17d0d0e148b0, 0x2ca3d7145587f96e }, { 0xf01175bd8b58d2eb, 0x119348c3192c3236, 0x1bf6efffee686ce2, 0x38c2fc54736cbcc2 }},
+        {{ 0x3c77762bc964739c, 0xf22dd284da3b6a6e, 0xc75c37a0e4b600bc, 0x2021cbc3c9ac8632 }, { 0x56d6996515f15c71, 0xfc0e711e778d7c5a, 0xd917f76819f48329, 0x3862e6f71b8e4e36 }},
+        {{ 0x7c8303e8ddd47742, 0xe9703bf84ad017ac, 0x9a81e9cac9b452e1, 0x15ff68403d0283b3 }, { 0xcd833df5e84d7d54, 0xfe6f01c76053cf29, 0xf3c8b2040ffa13ae, 0x3d901a9b3911098f }},
+        {{ 0x079502a99bb0f442, 0x03e82012fdccd5f9, 0xc0888ac0f61bfd2a, 0x0c9db56829f10f5e }, { 0x43f93d559f401de0, 0x2ecad605568846cf, 0x0b996209863803a3, 0x3451f45cce6a1cf8 }},
+        {{ 0x7be322ba0554bfa8, 0x12bf31b5aa8b7d76, 0x02642d0cb3c797c6, 0x0e928dee56ab2107 }, { 0xc45a1037df3b7e85, 0x69e5f904c1aba9e0, 0x188cf7ee8afbf165, 0x2a9376d228c1b7fb }},
+        {{ 0xda096673de1b6bf8, 0x31b16ea1dd71af93, 0xd0248817e9ecb7c7, 0x29f086c3db35e8c4 }, { 0x69c883938aa0d885, 0xa3f184ae470fa8d8, 0x68bf584ea72fb3b6, 0x0325d9b735c805b4 }},
+        {{ 0x214a946830990322, 0xb9e12c53d80e5b11, 0x8a38550fceb5ab49, 0x07834d1bfc11d2a3 }, { 0x93bedfbef176a92a, 0x7b9699810a2f59d8, 0xfe0e8a2a46aab505, 0x3171f1c0b89f0eae }},
+        {{ 0xdb709c994b1b10be, 0x577452107a90e88d, 0x0009780b6624f653, 0x1a7ca7aec3a770f9 }, { 0x9ab9bdd2565b0242, 0x8e4480fd5010d65d, 0x2a008d017299ae61, 0x3402e35b69c9347c }},
+        {{ 0xa44d43a04aba1d8f, 0x4e81fd0ef3b05b08, 0x58f88c492dfec7d6, 0x2935faa6fcfb9297 }, { 0x562f0b8696256363, 0x7db295fd1ef08c25, 0xfb17f0a9b1ba8c3a, 0x30b473a1a4ecdbbf }},
+        {{ 0xc2382e13deecbcf0, 0x86e267dfd6df197e, 0xa003f560077a3bdf, 0x1dd9e3e9bbe88fa6 }, { 0xd13f16b586171b9c, 0xd7e804408f5c813a, 0xdfa9b4290bddfa8c, 0x2a5c9940a577cf37 }},
+        {{ 0xd7a05aaf7276bc2c, 0x49e4c93fc4b11d1f, 0x2802e19a28a4efff, 0x3a6395e4dcd50fe1 }, { 0xfa28f8ebc9b9be0b, 0xd1dc800b919e81dd, 0xb21aca1158e98fb6, 0x05766946bd58df15 }},
+        {{ 0x63abd51d1aabe536, 0x34ab6d11bded42a4, 0xab9c5420d3314c85, 0x21c7ea8ccc2ece5f }, { 0x23140fc8f76b3657, 0xe1ccdcbbd9393340, 0xa83e26e120bf7652, 0x196bb3f303398304 }},
+        {{ 0x80bbd543b8c6d64f, 0x5b32ebc6ef8a0e27, 0x878827027919314d, 0x35f60f2c15b1c0d6 }, { 0xec881980be900c23, 0x159b3857f86a79bf, 0x7afe1ff859b37dd6, 0x1fd3b7b600b6f287 }},
+        {{ 0x62b210c15b46be18, 0xb9a050cb98e16730, 0x81c8cf5207e257bf, 0x0f7806192da5924f }, { 0xfc2d149479b66c4d, 0x7fb7e82828e5570f, 0x816425e1b7015a5d, 0x3dcdb24e5d86093f }},
+        {{ 0xa9b63f411dc58f89, 0xe2460fb50eac6f68, 0x2109279689233df2, 0x2e9990481e623162 }, { 0x98388706248d51f4, 0x83c98c10e182cd47, 0x7c4460cfa6f7e9b1, 0x3cd991615546ed99 }},
+        {{ 0x8b85447bc09dcfd2, 0x2e1fead2c27a1477, 0xd3b2930ad05415db, 0x221da4db426ecd6c }, { 0x58950a0fcb91b76a, 0x57e7b8704ea28c5f, 0xb98e9efbc5768cf1, 0x2a9cbb9e2522ea5a }},
+        {{ 0x00cec5e934be9b1c, 0x9ba2538bdec2ee13, 0x8153f848916d7eac, 0x21caac13057223d9 }, { 0x11d90a03b7af9b6f, 0x3d24015e94f68d0a, 0x9c3340deff8ce28e, 0x2646143a6a008226 }},
+        {{ 0xf52950bd309c1b70, 0x8d6f11df195cff78, 0x3d8d40ef010d9343, 0x3bfd590c2af822a0 }, { 0x6c9db417fd2bc96c, 0x9adf1eb761de0fca, 0x46cf6b8e97d69c95, 0x2664c123cabce395 }},
+        {{ 0xc0243d5d867c790d, 0xef672f9ae272f526, 0x191265eec639a455, 0x34620d3b2901a8d3 }, { 0xff7f35db58e3c258, 0x829caf31356197e5, 0x302ad86463cb19ba, 0x38c7b4f086283d47 }},
+        {{ 0xd2947f77dd9a0d3a, 0xc1c7282ebef18610, 0xe600e34ccc4da4da, 0x1a360b392b0afed7 }, { 0xc0963c72d52d9cc6, 0xfc0f9c985a9be290, 0xdd0482759d4d1261, 0x149aa79e70a59f0a }},
+        {{ 0x5fd5ea08db871fbc, 0x4be344d800678853, 0xa77ae58cae051262, 0x18d1d71ee35901dd }, { 0x8a345d08c2418607, 0x13c3c1f4aeebada4, 0xd47a68916d342db6, 0x30433522800da360 }},
+        {{ 0x86ec6ee021dcdcdf, 0x5454397f3af1f2a7, 0xe44973d2733b6a31, 0x2fc42534c361db59 }, { 0xd5d4b8776c19a0b6, 0xb8475191d057b63f, 0x944148e2f24555cd, 0x28371a917dcd6a12 }},
+        {{ 0xaf2b54311fb7dcd6, 0xa4fc0fb33472d3f4, 0x27e9b2487d34689b, 0x16d3e49c9e7295f5 }, { 0xa2212fa8abb38b85, 0x1d97d3975848dc8a, 0xbb4ea7d1d53360d0, 0x0415ae61ea031fca }},
+        {{ 0xdf0277fc3e5c57aa, 0x9fd6ecb9685a3e0f, 0x62c55058a01d7bcd, 0x167bbb15777e1867 }, { 0x1d9e7fa286e7f48a, 0x87a1cb4f910c49c1, 0x7730cac8a7430559, 0x3de0c5d320597989 }},
+        {{ 0x5a3e065c92ccf16e, 0x7f48e77286e38f99, 0xb3abfcd3f4e4cf28, 0x2e5b4408e1b70498 }, { 0xc936e155f80bfa1e, 0x85a0d7ee512453da, 0xbcc709368b9ea372, 0x2fb626d1f0f5c147 }},
+        {{ 0xbd38b49a7dc7ac89, 0xbdb921c9cc41292d, 0xa09626de2e84071c, 0x0e5af3afaee4f679 }, { 0x1da6d495061de928, 0xcf1d15b7cc513f4c, 0xdb7beb6cd0987fb6, 0x3fe962e8fc5f4c83 }},
+        {{ 0x0d1fce0868ed4d61, 0xc4a6a254c790d061, 0x144451bd30baca52, 0x3c8a1335ec63e3e9 }, { 0x0c72299220577221, 0xeb220a7e604bfa1a, 0x0abdb4e36ffa3032, 0x21cc21eced9186f5 }},
+        {{ 0x26df214cce2193a7, 0xc9d87253cc335e38, 0x4fe72393e5466e1a, 0x2f4ffb61ce468c50 }, { 0x72479a50e1f76836, 0x2202919a2e4f899a, 0x60411d317113cc08, 0x094d0e07c4be8578 }},
+        {{ 0x4f8c508da83d3337, 0x6033adf84eee3145, 0x186270bfbdb758a2, 0x280dff1afb8abcd8 }, { 0x4329756039df84c3, 0xc2a1fa6f20a37529, 0x487f9be1b2180109, 0x080c802cb3ef9480 }},
+        {{ 0xb28c8d9f853443a9, 0x90b09a728a94ad9f, 0xf62b36347f5c5c75, 0x3b8fda574f7e0a95 }, { 0xceb3e5de9a74ca27, 0x43f43f7ad9dc1b97, 0x4534d3835acb4d07, 0x2f6c7657dbc06501 }},
+        {{ 0x26eb2cc7af22d505, 0x07fa05ee405a8927, 0x79d36d474e3849a8, 0x124cc43df56b1736 }, { 0x9716f5535f4cdea8, 0x70be9500ef3d8587, 0x7d2ba11aa765d1ff, 0x3d2e28107b382ab5 }},
+        {{ 0x14edc8c536b37ebe, 0x5dfd68288f7a4c39, 0x28c9b3712ab4c1ee, 0x281c592f38d03f9e }, { 0x954e7203b0fd1575, 0x29365d892ba799f0, 0x36f3df28d4bba31d, 0x25ee99f7b895a5f0 }},
+        {{ 0xd5d35e606bd34f27, 0x70ff13fe96076c23, 0xc3d7db916821789a, 0x2ec19864de80b888 }, { 0xb98384f0e8d1f91e, 0x69586e444bd56ec0, 0xed7bfb9ab8af99e1, 0x07ee2f5f16b690a8 }},
+        {{ 0xa5464e05117f5945, 0xd041f6e17327b791, 0x3eaab0c28ed5a862, 0x31f2a38dd221766e }, { 0xd155c8d48361e81b, 0x6642b1f3dbc3a831, 0x4be8e3aee5a32cc5, 0x1d3a7972879726ce }},
+        {{ 0xa53b409284e3149f, 0x98266f6d735dbffd, 0x9fa16631762b3d15, 0x33d62a9dc3b70886 }, { 0x340f09160cc6ddf6, 0x4a761d343575ea5f, 0xb82f37327cd5229b, 0x16ca112a231127af }},
+        {{ 0x99326240eb58ad02, 0x0d9e420f8e5000f2, 0x248d797e3b40080d, 0x2c767ce5199d09eb }, { 0x0f6c5fe14c3045de, 0xd6d8239a1bf9b6b8, 0xde412de4b6a9aa25, 0x04b5385d482046c2 }},
+        {{ 0x221734bd8c2e010e, 0xcaa0b1aa2841bd96, 0x69689b30c2827bb8, 0x3ba95f65c89a90f2 }, { 0x87aed369d7a73da1, 0x7b1835b7f8feb667, 0xe269049a29af16f2, 0x3e95082ebe3b852e }},
+        {{ 0x1ffff2ca7fd9f562, 0x59f8adfc200461a7, 0xe5a0a9b843763ac1, 0x37e1faf2ffb11f1e }, { 0xdf3e38ca71b4aacc, 0x12010619a3f3fb1b, 0x635ff552b0ac4420, 0x211c9599e72d65f9 }},
+        {{ 0xcd638fd18fd67728, 0xa7464636db63c16a, 0x78a95beb52fdc323, 0x202d973d3938faa6 }, { 0x9102923e501c085c, 0x6e4b3f0e9eee4fb6, 0x18e4fe4b43166b5b, 0x3ade0c7c724b060d }},
+        {{ 0x459537374315745f, 0x0bed384c443759b0, 0xcce5bcd1ff27cc43, 0x103645e2e4d8ff42 }, { 0x58fea0e044035b2c, 0x130fe77e704b02ed, 0x51a02df6233a472f, 0x14c1e2d3b65d7b43 }},
+        {{ 0x3eb5255402aac7c1, 0x28013a15a865e024, 0xba2bc93a82baf1aa, 0x0d71de30f20b9ee8 }, { 0xaa80a0e8f2c4f722, 0xaecf3a08a9c6dcd1, 0xeaa9901d3bda2911, 0x1cf705df71379906 }},
+        {{ 0x12983b1aa72081f8, 0xc4e10cdf9257f5ad, 0xd1c1bb466d58746d, 0x2b80bca1a91754b2 }, { 0x416f374df16e06f1, 0x4df1f4484d3aaa76, 0x6074a036346b5472, 0x1e51ac97646c5cb5 }},
+        {{ 0x1ee160db4abdc428, 0x7902ad8e8040da64, 0xe7fa50ab2ff06fb1, 0x3234637284dc125e }, { 0xe2d0d30a1bac043b, 0x88dcf484c23bcb3a, 0x1c64670e6f03476a, 0x19294e96b1b5fd6b }},
+        {{ 0x584340a48d38d027, 0x0dea9867623a6176, 0x58df2b2888e05d88, 0x31fb3c5c5e7878b3 }, { 0x4b2f24d83d9609e6, 0x775097e1ebe08e13, 0x2e54e3c224e2bd16, 0x0de202587d1bba19 }},
+        {{ 0xb80c7b0363139b73, 0xc2108d4db55a3120, 0xaf59e20e67510e27, 0x3afbf67ab429019e }, { 0x561b6a73a1daa33d, 0x1cc6ccb962ff73ce, 0x61189aa4209edfcd, 0x39f8e11bfe1487eb }},
+        {{ 0xb5523293d5a1c92d, 0x1557aa64b0bba0d0, 0xad3f7b465b53ee01, 0x214aef4db7e0b272 }, { 0x3bcb7b56e0d678d2, 0xb26c3de46f1df8e1, 0x3b2936e60fd9daef, 0x215395742f0b29ff }},
+        {{ 0xc54bbf33980dc502, 0xf661165c2f5bd349, 0xdefb0a5bb63f134f, 0x1d27e4a91c21e8c1 }, { 0x04c37e5569d362b8, 0xf0db6b529ea1a0d6, 0x9cfa1bf8818ef041, 0x2cf4d493dd272ae2 }},
+        {{ 0x0cdbfcab3ae5a3f3, 0xd5ed4711897c1a63, 0xed82f1e99f6cb792, 0x385520faeee58c33 }, { 0xe800b709e181093d, 0x2a5a6af66de4c04a, 0x9c3b911184250be5, 0x2ee9e44d165b8fd6 }},
+        {{ 0xe5010976e9f7cd00, 0x9b1f9e154f4a66be, 0xd2118abe87848556, 0x34d049e9e85d7bd7 }, { 0xf4976255fffc5a63, 0x481adf80600822f8, 0xf75dc2fc4f49da65, 0x107b8ff976940816 }},
+        {{ 0x7ccbd71d71082f84, 0xaaaa771ff267a322, 0x984aa52f54fd2f40, 0x112b2b4ffbbb3360 }, { 0xbf27ba2a9dc410ac, 0x13ebd4bce6623ef2, 0x1fafaa31fdddb22c, 0x380ceb054e0a41d4 }},
+        {{ 0x8e839cbfe163b779, 0x8bedb5d6ff4a87a4, 0x21c72b4b6795d506, 0x32ed174cff5cf39f }, { 0xf54eed8c8d7ed810, 0x1b49986ffb60cde2, 0xd16452cdb2184b62, 0x2aad020a844067f3 }},
+        {{ 0x8e05050df7798e9e, 0xb931c1f25cd5f792, 0x534a4eacd53a3b26, 0x3f8bab614a4aa18d }, { 0xeb0090c589f3a51c, 0x48a01f5755760f2a, 0xe6401f009ed86021, 0x3fc1c30f588cebc1 }},
+        {{ 0xab1df25ba2f978c9, 0xc013a067f7207b6f, 0x98265fc65d7ef706, 0x10f8262fbfb08594 }, { 0x31f67792dd8568a0, 0xe72a17aeeea63354, 0x96ce542a4ad436d1, 0x3d5769b7ac1aa0e7 }},
+        {{ 0xded794607d431957, 0x25c6210c3f857e66, 0xe63d335507b732ad, 0x2c715eb38f12f631 }, { 0xd36e1871dd10ca71, 0xebe2ace5973204b2, 0x387f05bc30833c55, 0x31bb71c53b4ff93c }},
+        {{ 0x860c5345f5c0437d, 0x74d2267cb324c656, 0xeaf8539f9b650689, 0x062be979b51bee7c }, { 0x501199251ac8de36, 0x1d77ab08654ebbdd, 0x42718f5c0b1891dc, 0x04c6d3428f5ec436 }},
+        {{ 0xb515ecc8bcee8674, 0x6e10e2dd24a77645, 0x63f6cb08ccf28679, 0x3ff56e885db6fb37 }, { 0x86cf9afe63d0e9d6, 0x17ebb963889d0741, 0x8f6707bd3a5a2e36, 0x2e58fad7ee7a05c7 }},
+        {{ 0xa63e75c8110aaedd, 0xb99abca17e0ebf48, 0xbabfe32e87167332, 0x34c3594a5a8c021e }, { 0xcffcfd88a9b52a0d, 0xabd0419206ae3e7b, 0x75bc9cf80a6ad923, 0x1b0d840500f750b9 }},
+        {{ 0xb83ef42d3224324f, 0xe1fb9102489e33dd, 0x08957e3d062e75d0, 0x16bb3bf990ee491a }, { 0x9d51b37d90745c7c, 0xa470a25d5f5bf5ae, 0xbe999e287c5e8951, 0x0654845198765d8b }},
+        {{ 0x764866fe943da84c, 0x43af634007b393aa, 0x5e15ac9161aa704c, 0x0e0f75f95408fcee }, { 0x0b631ff118092e03, 0x60d477e8987dd37d, 0x4201d567ddde5cd7, 0x375330243a314c1a }},
+        {{ 0x1cd3db4e1f108f79, 0xe7a69bf3d43c136f, 0xc585494b234a990d, 0x204be67414e3f990 }, { 0x9576cfe526fb2f63, 0x0cc85289e918b702, 0x43e6d06732c82691, 0x3e4a3575e3f736dc }},
+        {{ 0xe4b5fb5e598d31e3, 0x7e61aff336e1745a, 0x8466342fc2954372, 0x2e057927efb86112 }, { 0x5b1b171268e211cc, 0x8f6840e9a628d02a, 0x095f68e3dc60ed8b, 0x0d0d836b65b5e884 }},
+        {{ 0x9f634e50ab790656, 0x310744ce5d0c6c15, 0x330a26424d99f489, 0x036e3293b7190817 }, { 0x2df96e2f019c9ea6, 0x1eead0dfb4ac9d09, 0xbb04651cfe46202c, 0x042339f29b031109 }},
+        {{ 0x00fac9df6e6fd362, 0xaf76ca097d35381b, 0x5faa44d68c2873b7, 0x2ac1e79824a1265c }, { 0x8399d4ce469b514e, 0x585c3f6d47eef3d7, 0x434fb7649a95e337, 0x3ad34affc42ba597 }},
+        {{ 0x0305d63fa3131b4a, 0xbabeb2608363d353, 0x67ce932d92c04b35, 0x3ebbd10fb919a5ba }, { 0x8341f576b3af5a9f, 0x0eb88a01583e7fe3, 0x4dc946300efece7d, 0x08de53e1072b0387 }},
+        {{ 0x88586f9970277126, 0xcd877199ebe831a3, 0xe91ae44e0a1560f6, 0x13052beaf5c74390 }, { 0xe0d3d73946d8e188, 0xa06bc6535550e7ef, 0xa1fbba5fda397120, 0x23d082038949d91f }},
+        {{ 0xe94795e65b9ba36a, 0x2466363044ed9d91, 0xc5487dc4b328261a, 0x22c279a5479c0dea }, { 0x254f6bc020c63980, 0xbd0b056edf0941ce, 0x1247bc0c10d138c8, 0x002449258bb0872a }},
+        {{ 0xd89858f96e20f6af, 0xd07846e19cd324d3, 0xdf60df91d6ae1a91, 0x12df5af8364f0e01 }, { 0xadc2649d247c67ef, 0x87ed132d0fcc8433, 0x852ac3816fa24ac1, 0x3437671100c3091b }},
+        {{ 0xa1eb61aba8280ca6, 0x8d25f64326ca6523, 0x62da7afd359c480d, 0x327607400c79faa2 }, { 0x16d130749ba86106, 0x5557cfd764654880, 0x012c773db189be67, 0x2f2c4e7a4e604a03 }},
+        {{ 0xb0a9559ba847951a, 0x795cc3dac6024082, 0x08360b3378ee5e4e, 0x002a97858ac36963 }, { 0xf082465b5208c0f9, 0x9910b5cd8d345e3c, 0xf1f68a907be910c5, 0x2adace0e0e619fb3 }},
+        {{ 0xb5c11f80d2847f5f, 0x092008f896f9a444, 0xe00a454d58034bc5, 0x2bd901af1bcd790a }, { 0xc2523e79b47ab40c, 0x9bf87566947d8514, 0x1bd3de6ba46367ba, 0x2d815753f49a1ac9 }},
+        {{ 0x2d2776a643210c61, 0x31d27b6d71a010fe, 0x4082226f931917ab, 0x3bdd9769a5006483 }, { 0x3e785036d2d01b7e, 0xa56c6e13520b510a, 0x1be9776b58253197, 0x231aadee55734457 }},
+        {{ 0x386a5b545ca15060, 0x58a6772fdbcba166, 0xe5aaaccfbbe38d2d, 0x334570f75bfde0ba }, { 0x07d6dc1e3bc3041f, 0xaf1cd22f7f743711, 0xc5808ea9806f96a9, 0x193e25d381c7cf88 }},
+        {{ 0xd28c9f431612d398, 0x4b621d03078a7eb1, 0x0b4223e740a3dfa9, 0x0402de841a5efe34 }, { 0x45de3799c7dd26b5, 0x03614a4bed560474, 0xa64f0ec22812498f, 0x0beeba8f75a50603 }},
+        {{ 0x31773a24c0fa17dd, 0x3d25ede38c19cd98, 0xa1bde45cf04de102, 0x024002df15595c88 }, { 0x51e58c4ec5c70251, 0x1fe646620545b6af, 0x25cd98ca05d44a12, 0x16e6904d9dabfdb6 }},
+        {{ 0xa4069828ce5c065f, 0x08481ea2dedeca4d, 0xd207cbf8a1032017, 0x37cf64f903c4f26d }, { 0x5fe7ac7e422bbaf6, 0xef44b81c01e7b3a4, 0xa1d2f2002c2ebb92, 0x0892aafc3927b858 }},
+        {{ 0xb5b721829b0a0279, 0xef1d2b676e837ba8, 0x00a824226f9a132d, 0x00b15b2a902f62ae }, { 0x94e6f8843e59c055, 0xc351222abe51bf97, 0x856d7eb1696cd99a, 0x25ff750bfbca5cf6 }},
+        {{ 0x3d710c6b6a029ff3, 0xd1357d92bb6affbe, 0x8b61973cd77cb08a, 0x0b3d5bd710590e0a }, { 0xc998f1c6e1f08435, 0x2354936f684f099f, 0xef3746fbb9bd766c, 0x1f239336cb1b81c6 }},
+        {{ 0xe3b173fda8f85209, 0xbbd533dae1116d06, 0x72172ac7b3b2cb37, 0x0f35ddd0be13bf59 }, { 0x87b03345bc21e2eb, 0x3f55037cc977906f, 0x3600ca97067de75d, 0x3f692f8da614ea9d }},
+        {{ 0xf015ae022004523e, 0x824c37e6bd0cf409, 0x537ce301e3919304, 0x123c3015bb096222 }, { 0x747b99d9abcdad36, 0x09167064937fde79, 0xff72ee08d7380487, 0x2c9a226cb0e56ddf }},
+        {{ 0x1efa101f97717bc0, 0xc07d63324dca7b42, 0x50fe2301e6c10120, 0x0c104ad2c8ac7a23 }, { 0x3d833e602bd8c128, 0x23efc89871e1dc95, 0x3db541f4ce71ebe7, 0x39f828f4ac5df941 }},
+        {{ 0x10380d172599d308, 0x5837788f3c32ec97, 0xa921600849ba5219, 0x321a89b908b4b362 }, { 0xb889ed48dca63487, 0xf09c58267cbb134c, 0x8fe68ddb77200ddb, 0x303efe2f85d4e747 }},
+        {{ 0xe34a847ea29f70e0, 0xba44265d079e7ae7, 0x24792f6792b368a9, 0x3d8215548235dc42 }, { 0xccd5a75f34587083, 0x8c7faa2d6746d67f, 0x7e14de7fb8ad5ffb, 0x36e65482570d43e0 }},
+        {{ 0xc3e79b4da9f2eddb, 0x00cba0d06a692f58, 0xffd67587b371ef7e, 0x1e0bba786e91e2b9 }, { 0x0d6926b2450ff951, 0xd39a7eeaaf77927c, 0xf4d11d2e84978740, 0x0b7e9ea1a324249a }},
+        {{ 0x2baa75da607063a2, 0xf3a5405791687de3, 0x50304815fe9380a8, 0x3c4c57b5ee87ebad }, { 0xfe7c789298068905, 0x381958c24aeb2b34, 0xd1dc9aa90b83a369, 0x371efa90c60ac97a }},
+        {{ 0xdad328cc93cb4e0c, 0x0ccbca1d9ed5f54b, 0x4f3c346ea7c3b63b, 0x2aa48b0e4b24e27d }, { 0xfcd190b0cce3adbc, 0x47193eda66273252, 0x8ad3adde881ee314, 0x03ccf9aa96651995 }},
+        {{ 0xe486d9c54595422f, 0xab1b4fe02ba23e2a, 0x49f9b729bc7c67f7, 0x13b9cddb00b9ba92 }, { 0x420794d666610d83, 0x0ecf321cf3ee8ea3, 0xe2e9d1bce4a16ed1, 0x1e40594236073b38 }},
+        {{ 0xbe30066e82f6e416, 0x17b3705926deeabc, 0x0d1a838a89782b87, 0x3f61c99ff260b19d }, { 0x7628d3f5b22bbb58, 0xed66e96369babb95, 0x573e89d2c65d44a6, 0x1a93289c3966f958 }},
+        {{ 0x7061aaa6f887bb05, 0xf013d5573e397546, 0x82e25f65f7903cc5, 0x08798be356250fea }, { 0x99140ed396e7f18a, 0x0a3c7ce8b88433f2, 0x7c2c0cd8a7c28c51, 0x3a9cf7b21e988bd4 }},
+        {{ 0x4569e7e0947154e9, 0x569f84333f7c5c2b, 0x4534dd6dd4c9fea1, 0x0381ffe4ccf31a50 }, { 0x92a612ea8054b223, 0x6b4940891247bc33, 0xeb3b4d048402ebd6, 0x3b1973ddea52486b }},
+        {{ 0x17b6e94d06ca9048, 0xf9aed9d0cc06ec34, 0xe01b4eafb0c069a0, 0x275bc1929216493f }, { 0xf7b265c6b5db806f, 0xa7364ba4bc7dc654, 0xa4a6aaa913aec429, 0x36fc29cc52df0baa }},
+        {{ 0x044ed38bcdf04e94, 0x4324020600e7103d, 0xf8c86d09b283eb0b, 0x043a5b937a80b257 }, { 0x1f636e8edc07f309, 0x02c4de14a72200a5, 0x0d979cb752aaabde, 0x327d03b52a487c7d }},
+        {{ 0xa74c03d7e23b3130, 0x4ea6ced380632aca, 0xcdbad33d57a7a53b, 0x001e258d08572013 }, { 0x7460e685ae658563, 0x7dc82a6b9b4c8862, 0x8613186257f6ec30, 0x2a07b19ef8d1352d }},
+        {{ 0x0cf398fa43d3b936, 0x4230a8d365e61d9f, 0xf7a170813a9c9a8f, 0x008bba4e93d66b54 }, { 0x79dd2f3a446ed817, 0xc25c2d0c8a1e8325, 0xfcf5d814283bb81f, 0x1a88c206df0e6c8e }},
+        {{ 0x1729ac0310736559, 0x4c64c5710437c34f, 0x3754970ea1a6314f, 0x24cd9633242ac71a }, { 0x5c42eda3aa7b6668, 0xfe2c0c1826585504, 0x7480d8e28da066a3, 0x0bb9408b60ed8aa6 }},
+        {{ 0xa102d1b1c8071e44, 0xd52a2d17e0772efb, 0xfb1fff6aa557140a, 0x2ddc5ef26b8a85f9 }, { 0xabffd88802258fe0, 0x4f97e2acdcf2b290, 0x6c68a08a1fc33438, 0x24b4542e4479e6bd }},
+        {{ 0x2ba8f4efa8c63a56, 0x2f0d180b3eef901b, 0xd52196e18df27579, 0x037107e06d1de77c }, { 0x21a7acd9dde6e01b, 0xf4756e1165d8fb8b, 0xcdf3d8210375230a, 0x3e26e9f4b770ac32 }},
+        {{ 0x88c990edc9fd5d3e, 0x544b32fbbdb84183, 0xa6def4f1c8307e4f, 0x3c018cbbc4d0ec0f }, { 0x6327613a45f8f399, 0x221a05df0fc231be, 0x33a5c21a184ea2f0, 0x3b5c7de2fb1e04a4 }},
+        {{ 0x447d0ab19b3aebe3, 0x49380015bb15cd5d, 0x773db65016ca8f99, 0x3b1e229209e6da20 }, { 0x2ad83eb7962fdbdd, 0x350a48c0495e97fa, 0x7fc8d8207efb943e, 0x0a4b9eca40bfe90c }},
+        {{ 0xadc23090412930d4, 0x2ea18fa02db0df49, 0x313705815d983da4, 0x2bdffda8c183da9e }, { 0xde9ebac99c5ac560, 0x4ecca2e028d168d4, 0x5203051ab0693561, 0x30f931ba1d772fcb }},
+        {{ 0xbca62d97b27547c0, 0xfa26599a6869844e, 0xca1c44948f92daad, 0x2907d895032d42f3 }, { 0xf6a021fbffd1f4a9, 0x274e0eac03bda89f, 0x185018bd9072a376, 0x3f9d5dc65e8987b6 }},
+        {{ 0x7b68440ed4e9584d, 0x8ba0ecfaf6ef45c2, 0x035c85693f65227f, 0x3a1683c3e02ccd93 }, { 0x0449601384b5ff1d, 0xa166ad75778ad844, 0x08cb5747e8cb6b86, 0x14e0214b4b22edd7 }},
+        {{ 0x6b9993536155c2d9, 0xf66790890e15bc0a, 0x9539e2fc21c71289, 0x3a9d375377a54053 }, { 0xbbb4a21590163ff7, 0x30f52b322bc0ef5f, 0x16e6b358f047a77e, 0x2371443aa17233cb }},
+        {{ 0x766bff2315b11f94, 0x8bc834e131a61a0c, 0x71a73c1ec6aa4cee, 0x274ba0344718e52c }, { 0x914da9135ff50610, 0x70409a6fe44884a6, 0x9b37a57f81a09ae7, 0x0ae6a77c899cafdd }},
+        {{ 0x69dbef00cc3bd814, 0x15f636b238d6ddbf, 0x505fb4eba8bfcbae, 0x3e8029276c5005ed }, { 0xd0c2415dc252adb3, 0x5c9586ca7b7e879b, 0xe6b8419a3eccdf1b, 0x249e4c5dda7a9381 }},
+        {{ 0x2827288b7664f87c, 0x43b673b9733615de, 0x947de12e74a149bb, 0x376913356929e681 }, { 0x24c3ee0ab6a0bab4, 0x30bb82a1dbd6133a, 0x805d14020efc3a32, 0x00a5cca40a51714b }},
+        {{ 0xe4b7d79badc7d5ba, 0x6b51d2d9238100b1, 0xfe182a9cfc9d31c7, 0x1c238735ccd89bdd }, { 0x14143035957de8a3, 0x1685fe57de7113f7, 0x39c6ef321503ca75, 0x2aadffe56f5d81c9 }},
+        {{ 0x773a9b3bd0674b6d, 0x8839373a3a205aff, 0x3e4d600f8efe541c, 0x3e7b08be3fd5ca6b }, { 0x6231930260832955, 0x2a7a233f83832a61, 0x503791eef678ee54, 0x10b87bc4c6c50875 }},
+        {{ 0xf9bb17a09cfd3eae, 0xf29dd85c199352c6, 0xd09883e4dcb85cc9, 0x1f606f5a84eb1b9d }, { 0xf0f9189cb01ca999, 0xeed5fd6929dbe089, 0x52bf139d5228de1f, 0x2b83f1ef2851ae1c }},
+        {{ 0x18519fee6404a46f, 0x8a8c5fb037eebbae, 0x3ca9495b7c6ae34a, 0x26515ca1501e0175 }, { 0xe46bbdfb1aba4585, 0x399672bfa0b2ece9, 0x0deb03593d261927, 0x29ce1cab1bda2566 }},
+        {{ 0x19cfb12bf5ceaa25, 0xf706c4d511af0268, 0x0772ba7bb2bdfda1, 0x14060ee289f673e4 }, { 0x2910a253eda68163, 0x60675f09f8881a76, 0x653c9fbd3da3ed9a, 0x1560d5670b02e9d6 }},
+        {{ 0x5d144f30b6cb8c1f, 0x9e7af73d16cc190d, 0xaf536f9ef07842c4, 0x2f410b5ed307ffd9 }, { 0x19c2dfebeec50f4f, 0xdaee1a5da7bee5f1, 0x504708e462220555, 0x3bf1db3ac0e05c47 }},
+        {{ 0x67a6a6088fa92ac4, 0x244d729b311ff154, 0x6defc07040ba1823, 0x109ce05095957f0a }, { 0xaa4d7d50b0702d2e, 0x00eb486e4126a81f, 0xc7237480bf3496ea, 0x09d3878473107464 }},
+        {{ 0x81773b97aac58053, 0x7b2be51675b6b813, 0xf32de5a26976fe9c, 0x2bd60b8e407258af }, { 0x08eb932b7b611c32, 0x66a5ab63e00b2a37, 0x366b930aa4a98a4f, 0x330b9c6a7ceedbc2 }},
+        {{ 0xfd108285e679eb7d, 0x63fe953bbfcf8f1a, 0xb6eb23bf34672e46, 0x11d4db8f6362b687 }, { 0xec287ce9eedbe73e, 0x61b36849055d403c, 0x9fc96331b7cf4113, 0x0d1e8efef30ee1f6 }},
+        {{ 0xd874dba955f6ce9e, 0x7e2de30a99bfadf4, 0x81e7cf3ddf12dc5c, 0x15e0d5c46971fade }, { 0x0f2ead550d8789ca, 0x765102b5700ad24b, 0x6ce699280e353763, 0x00b4c9056fa81c23 }},
+        {{ 0x32818166ed15bb21, 0xda1729926e7db724, 0x8a90d4b74c9fabce, 0x236461913450d06a }, { 0x8bce79bf9ada9b10, 0x48618f6662193c56, 0xcc31ea320f37620c, 0x18976e514234681b }},
+        {{ 0x8ffb4b0d3d8c2324, 0x0586cb3058748108, 0x01be494a51bf1dac, 0x1ec1d31549af831a }, { 0x18c1784c0fe00b6a, 0x0f5950a7498d3a02, 0x3f333dd6af1ca435, 0x1cf70088cbf356da }},
+        {{ 0x53c2b5e5190d6b39, 0x26de12b13d468025, 0xe9ea440e67012581, 0x05019835d00c0f76 }, { 0x18c831b030d263e3, 0x971ccb51001b8e3e, 0xf2badc93fad2dbe0, 0x30b8b7336e3f6263 }},
+        {{ 0x82e15fe1f3cf517a, 0xe8f80cfe485a65fa, 0x542b679e7c26d44b, 0x2dfd24c1d5dd3ead }, { 0xa2dd024c51e83a07, 0x67ee1999c4770e37, 0x3916e530435e33c1, 0x056a90126c0fc321 }},
+        {{ 0x03bfcecb71b2b871, 0xdebd826a5c46a72b, 0xc0fd47da98f474e7, 0x0e227932c038624d }, { 0x1b4b78a21732c28c, 0x2c278ee8aac8eb00, 0xf20670a91a74516c, 0x1b41b63613c86e86 }},
+        {{ 0xdedb9ea1bcbe0e87, 0x5eb9e01b602bd526, 0xaedcee744235b1f4, 0x213e031db2b6bd36 }, { 0x01b73e24543a6e65, 0x290daa5ddaacd94e, 0xa87cb6ddab8e8e6e, 0x3df102b2767222bb }},
+        {{ 0x0904c0f8025e65f1, 0xfe2fd723d6407ae5, 0x2288a5037c773962, 0x14387726aecca7fd }, { 0xe3e10e6de220f5c0, 0xb6c4c50597c09f78, 0x7d49628d4dd3f4df, 0x07f0f3d1e1de394e }},
+        {{ 0xafa92558f558b9b3, 0xebdca28cb3e4ba42, 0x5bf0474f754dff9f, 0x2e428177b29918d7 }, { 0x9d8c0431cd092d48, 0xb4f3d7240a0c47c7, 0xe49e7945e9e9b3f8, 0x29e3897717bd8d6c }},
+        {{ 0x8fd1af1e5cd6d068, 0xaae4098db17b1d10, 0xe1ad3c776c969c54, 0x26a59c11c51ac1e5 }, { 0xff127877905b900a, 0xa5dce6448055a156, 0x97d527edca6cc765, 0x2be8011031967fb2 }},
+        {{ 0x374bde4445e5445f, 0x20b2ecba128158da, 0xad3745dc39b1a4b8, 0x14dc38fd90e57182 }, { 0x1f54161706ddbb28, 0x92d51b7dbc1db20e, 0x0896399b4b9ffe47, 0x074641f7f9c7f2f5 }},
+        {{ 0x72a84037a30d2a19, 0x1933c72bfd898091, 0x2051906f6dbfcc2f, 0x036fa17387d77980 }, { 0xc74fd32e93821bd3, 0xf36bf4373bdaaa50, 0x338f131d6f47a8a2, 0x16194070ff5c9dc2 }},
+        {{ 0x4872cccfb0e4bf5a, 0xc118c162a6336301, 0xc2716613276e90eb, 0x2e344836b9941274 }, { 0x212ca66de35ae043, 0x814cfc5eaa053449, 0xe6457400cadca079, 0x1331518064b23b76 }},
+        {{ 0x8c439ad9f49349d0, 0xa5f724ef1f83abb9, 0xea320433f81f80db, 0x0f0dcc9184de9407 }, { 0xd719a29864b7934e, 0x3d9c5abb7e67e618, 0x6506546ff71b1cdc, 0x19cdf76882d5b349 }},
+        {{ 0x21353c218645b4ae, 0x2330c824a2021c94, 0x44865415f3b4a247, 0x33fb30d830f07e13 }, { 0x8a72eb8d07cf1f36, 0x25cbabf98d266e08, 0x00b83930ceaad3d8, 0x23bf8dd419e78794 }},
+        {{ 0x981c0f5b80fdcf3b, 0x62fb2630a77cd479, 0xcec13223647ccfed, 0x39275d0d9435946a }, { 0xecca4ecd731809a7, 0xfc5324c7af99be11, 0xd1452a0e1065271e, 0x21f578e142772975 }},
+        {{ 0x05e687df880bdd7e, 0xe6fa82dfb0b2abb5, 0x1f245ef585842db9, 0x10828874b5c70c62 }, { 0xc4fbb7f6142e231f, 0x4d1d905158fcb7cf, 0xe9b4b4cce011a03a, 0x0f03e3b64f14ab28 }},
+        {{ 0x5f39435029364226, 0x6e902edff532a8c2, 0x2b6fe043730c8c6a, 0x2f5f2ef321c8c24f }, { 0x4adf6f5f6806bf46, 0x353464a1853326db, 0xbba0173263861169, 0x0107cba40b4d5ed5 }},
+        {{ 0x07f74bafabda1975, 0x51790a0d8d3139e0, 0x1d4461aa2488a2be, 0x17252f709c835a5c }, { 0xeb228571e9652909, 0x3e61b6c7c4b9b18f, 0x260107c222456516, 0x092ddad1edb5c183 }},
+        {{ 0xb303c8c429a20e54, 0x1c78bedf10c958f1, 0x77a45dac0564492a, 0x204b238e87cc1830 }, { 0x41250a8725022543, 0xa8ef1e9551af1846, 0xb4d5e52c9aef05be, 0x2ad59299ece5c4f5 }},
+        {{ 0x306cb3437fc03ab4, 0x32648606743d38d5, 0xf5a46a381408b817, 0x037b43f31ddb02a0 }, { 0x39f9fc8120e15cad, 0x88e915e7848d89e5, 0x334e0059f91e50ff, 0x2dfdf0ffefcb6c67 }},
+        {{ 0x737dc0389e1e02c1, 0x578e0ce22ba6fb10, 0x7d8cf80f5a9c2a42, 0x13f19f554f732575 }, { 0xc50bf199d1f8f3e2, 0xa82b7ecc40328deb, 0x45c1715981c1e355, 0x049d823bfcd4638f }},
+        {{ 0x502562e2a1ce61c5, 0x40811bbb5f8075d1, 0x41d5f5ca39d0338c, 0x0ca2cb00367a7be0 }, { 0x16bd4873792c7aa7, 0xb73a6d4b9cf38331, 0x3f3678ed89ffaaa0, 0x3dafc894a137f63f }},
+        {{ 0x25320a0b14c794e0, 0x390c8c928e5aaaee, 0xe98f25701e3ea66c, 0x13c2f3d729079ad9 }, { 0x35600cdcdc2dddb4, 0xfa4a374d44b0e191, 0x325185ec63085017, 0x38ec2c6e89e34efa }},
+        {{ 0x868653e18c29555a, 0xbca1a3fe36983b29, 0xec8a628dc977dd4f, 0x06dee95a4a89bdc0 }, { 0x7f071bc146a160ea, 0xea943360b07217f8, 0xf3cd416780c616ed, 0x1ab5627c7efbefa2 }},
+        {{ 0x3d357ad732a2dd57, 0x90c3472b1594454a, 0x1b45a2932cd67d08, 0x274376e718b73d79 }, { 0xbeba258ed9962571, 0x36b377e98ae391b0, 0x01de012087e7c7be, 0x37bad7b2aadbff1f }},
+        {{ 0x8771d753730494ce, 0x262a7e9ef47b133b, 0xc321a4932dc4f967, 0x11b789b96879f446 }, { 0xbc82f247fc09b1a8, 0x4300a4380d1bca24, 0xa15695ff72e4c5dc, 0x245b56b167efe997 }},
+        {{ 0xd110f393ce06a3f4, 0xe59dc6faa74937b3, 0x8950c1d2486f365e, 0x11766f7863b95a38 }, { 0x871da43409ad6adf, 0x5743316051920987, 0x1108cb0b1c9de183, 0x3c66bd0f85dc5e4c }},
+        {{ 0x240a912e2b64d79b, 0xc98fff51dec8dca6, 0x4b3855154ef33e4e, 0x103359fcaa7cbae3 }, { 0x98f33e80dbae4260, 0x78f8dd6869646db5, 0x2270e2698c24a12e, 0x33911060ee819fcc }},
+        {{ 0x9d0cd4ba13e99197, 0x3ce509e161c90590, 0xdfff357bff2b6695, 0x32ef04d1debfb314 }, { 0x0e8bad7682620cb9, 0x3dfd8d33b37e13c4, 0xd59fccd2cb9409a8, 0x0f5a2810f5dda956 }},
+        {{ 0x6890a943583d1a8a, 0xc0c7d19d64c99eaf, 0x04e047618082d051, 0x0fdc2e85df8db293 }, { 0x7f65a51dd39382a4, 0xaf3700ec26c3f46c, 0xe8a309beb277665e, 0x389459ddc5ee4f86 }},
+        {{ 0x20d3021db81f6c87, 0xe68ef28d19c1c49f, 0x8188908ced48a62e, 0x3aa5b13fa4578e8c }, { 0x5e71dc88a6d85588, 0x023b4779dd50231d, 0xbe370ffca2eef708, 0x1c4839bed777cf37 }},
+        {{ 0xb1fc6f08564a202b, 0x97626ccdf3c5adc7, 0x3e6c1095724f7e51, 0x1b42c56ede2f06c9 }, { 0x882f1dee050bebe0, 0x2819a74c4299dcad, 0x1282123ff625462e, 0x0517dea78c478e5d }},
+        {{ 0x0228b6cffd3368ec, 0x9860b9eca35a869b, 0x61a3de45b941080a, 0x18f147d9bf976b32 }, { 0xbf755eeaba905410, 0xe0180a4e936a2204, 0xc62fc12be3359f9b, 0x3990ea3dc380c393 }},
+        {{ 0x775d513687dcbd71, 0xbcdf9d7d586b418b, 0x3497dc901096101e, 0x184f40b0c48666fd }, { 0x603143abda97cdeb, 0xff882ae59adb12bd, 0x66d456181b9a9ff7, 0x20cec6392232863d }},
+        {{ 0xdae5cbc9309b7fff, 0x6dc65ed3b5813a1a, 0xe38f29fa70f9557f, 0x3718f710b80938f2 }, { 0x92c8fdb44ab4a6cb, 0xef0606298e1f4fa0, 0x021971589c59658e, 0x3b97520f9f712bce }},
+        {{ 0x3f8280df80a0b74a, 0xdabca9915dacc336, 0x0e3f7266d2005742, 0x16e7a9ec3815b354 }, { 0xb50621c28121ff62, 0x5ae5b15e90c206fd, 0xeaa4cdd7343e24d2, 0x3373cd6bd7a777b3 }},
+        {{ 0xd95198a641f042dd, 0x7e1fd35860de6c30, 0x76e1933f3d7db14d, 0x327fa2637b3fbfd9 }, { 0xe537e59094a89563, 0x9154c1a7931b5c87, 0xadd07457763d21ba, 0x3cff7cf5eac69a10 }},
+        {{ 0x404075b9dbf1fcc2, 0xaf618207212b5903, 0xfdda652c0f4c8ae2, 0x34d64619c7aa973c }, { 0x797be498ce9b8d30, 0x8a123583d0e552bd, 0xb82e25b22c1ad61f, 0x2544ea273094b1e3 }},
+        {{ 0x626e566641b2196f, 0xa8e15759c713dde8, 0xc67dd493eff60b9d, 0x23263bb936506dd1 }, { 0x4cbea6c02b4d253d, 0xeef2cd9ee2764c09, 0x68bdc15dfe3caeb3, 0x38b55ae3d6e1d66d }},
+        {{ 0x18b151e897867275, 0x4125cc12adfdf615, 0x10b70ce45f17fd62, 0x3ac3c270b4ee434e }, { 0x71e7f520e487fef4, 0x6d5f4855402b3b72, 0x181384ebd3024f9f, 0x346d1df16bc8b9d5 }},
+        {{ 0x7c0477c531f8d81d, 0x8df95ddf486f9934, 0xd711cd0b00bebb94, 0x346b822b268a24be }, { 0xb61bf733bd1163be, 0x09cd678b7ea54941, 0xdb6cb96a68074aa7, 0x0b4d930884bc81c0 }},
+        {{ 0xeb1ffafae4b96018, 0xde857d30b836e0f2, 0xc81b16e933e356b3, 0x3788bb4e9327c6a2 }, { 0x408800a2c36bb0ac, 0x5aa49cb7e0b1ac14, 0x3106d38c825c53ba, 0x2948c0b128038c71 }},
+        {{ 0x9a79e7d82d44b231, 0xf19f4f8a23a9804e, 0xba6259de5ff4cacd, 0x1777e1f4d93bb04b }, { 0xd07ef7c92d71174b, 0x65aad393367ce99b, 0xe32090091557e666, 0x031a24e1dc6906d1 }},
+        {{ 0x9a5f89599d71cb8d, 0x5956011ad553b7d3, 0x5ec4a451c01c49bb, 0x1d5d33b2fd57a14a }, { 0xab017a6b45270a6d, 0x9083cf059edccbfa, 0x374fceb66c64e4fc, 0x0c887f05dd8df9e6 }},
+        {{ 0xbe92918338e83ac0, 0xa304c7a9aafd6e7f, 0x822e6e3a3e387f2f, 0x35df6936f453f42a }, { 0xb7e754604e8b435b, 0x52aec6a1f8982152, 0x402a5ee90394cec5, 0x09b8c75a426115d8 }},
+        {{ 0xccc61a6207032f65, 0xdd08e3bca772a113, 0xf070837ba45c8132, 0x38c02412e62e195d }, { 0x96ecdbc717f7234e, 0x42bc1d80225b1c85, 0x5fe88886cd77fe10, 0x246d04cae28af616 }},
+        {{ 0xe3544a73281db482, 0x8ab7c11e9d63f072, 0xba82825cbc227dab, 0x24866ec96e5d8d43 }, { 0xeb950f9b33250ffd, 0xe00073e6ba17bc03, 0x4798397db82ab9de, 0x317d1d6658396850 }},
+        {{ 0xa0f92fe2cd843683, 0x3ef7fcbcbc437e26, 0x67e290fae556b280, 0x0de889554fe8103b }, { 0x9823be5198f8878f, 0x06fb66e471b5c450, 0x51360b987021f782, 0x158acea270755c20 }},
+        {{ 0xdf25ff34b8c38a28, 0x0333e5e846e5cf1d, 0x611933d9aa392645, 0x22a79dbc14fa8893 }, { 0x266b36318d75d930, 0x8b63c8ba3827a955, 0xd23e35cdd7de790b, 0x24225e58aeff2fac }},
+        {{ 0x664595de4162fea6, 0x91dcf3fc70f1abbe, 0x3a91b1509d09d4ad, 0x244274a84e8aa540 }, { 0x1c34086b0be35527, 0x10e1f63dae3789c9, 0x70381a9459bfe9b6, 0x265bdb5357f39244 }},
+        {{ 0xa22b6b2f3290c2b3, 0x9e2914b844b1bf34, 0x24a433744997f4eb, 0x1c2b727ef13fe6d0 }, { 0x365575f226171edb, 0x53af6d19e30b6d58, 0xbe868d2210fe74f0, 0x1ff9fbd71826646f }},
+        {{ 0x96732baab374e5c7, 0xd56f6041ad9accca, 0x6b1211d71147f850, 0x1e14c67c7f75950f }, { 0x8c88a23669ed266c, 0xfd3c75e1956f0622, 0x630995cd8eff2e89, 0x21f9e60d4ef7e3cb }},
+        {{ 0x8c60cd930634a738, 0xdc7f79b05eb06eb9, 0x654b41caa4ed7cec, 0x1d70843b1c99e0fc }, { 0x3123a9684c8fe177, 0xa0cc27f3a28514e1, 0x964cb3d1fc347a94, 0x216c0afbd9390ced }},
+        {{ 0x389c755f8bca33d7, 0x466c664c69410e20, 0xb8f6a1354cd127ac, 0x276e1808bfcc53d0 }, { 0x479e1d319ca6a299, 0x877b84aba9d54d1e, 0x12d55623376ad005, 0x147a4b934bd0a7d2 }},
+        {{ 0xc9c2fa6c5272f3ec, 0x5c963523afb5e557, 0x6ba893aa13f969be, 0x2573757ddfef38a5 }, { 0x183d1beb8b99913f, 0x85afd105fd80964b, 0x0a6d4b2a3451235b, 0x36a9c257b653f781 }},
+        {{ 0xeba472e9a6cf15a7, 0x76c53813f3b4efcc, 0x02810459aff0dd62, 0x02280fe14c6a63ea }, { 0x5ead7cbaad0adfac, 0x7d19278905efb07c, 0xc30743a4fa5e3d18, 0x3247754085077264 }},
+        {{ 0x8e8373bcf56018b1, 0xeb3a1d369e4fc738, 0x8c725c86c610aef2, 0x108c9a98f4eac8dc }, { 0xec8798768db7804b, 0x06a24cb99cea71e8, 0x26c559507a76cbd9, 0x33baa73742b850d5 }},
+        {{ 0x773c335928a92889, 0x2decb51bf834cba0, 0xb7840581f4afb1d9, 0x22f1cefdca3bcf90 }, { 0xc4fa2c6a2e07fe26, 0x65ce6ba30e3f3102, 0x6a08c132f30cc0b1, 0x32e4db45081ffb48 }},
+        {{ 0xc39f5329630d4679, 0xbafd05930b0e838a, 0xe937ebf4f91b22db, 0x3319f6ebfed59f8f }, { 0xfd03b6628cfa0811, 0x629f11e48fbc8f5f, 0x89bc8c6b219fd1dd, 0x0b92ac4defb9a606 }},
+        {{ 0xd977b65539eb4005, 0x195c976cd71d975f, 0xb3fa26f024f2f5b7, 0x33c997ebb7eb5f7d }, { 0xa40d0f436788f966, 0x56bdba44c3a48310, 0x8f9171c11d1da7c3, 0x1b404e0f36a96717 }},
+        {{ 0xf805dce062a621fd, 0xc53ca3518b90a1bb, 0x081c4d1b6a4f50dc, 0x1489ac91a2635f8c }, { 0x609d72287923f685, 0x3353e67bfa1d2b19, 0x87559e007e190eb3, 0x144038220d4fb768 }},
+        {{ 0xe27b26d7330b0036, 0xcd2c5e1256af598c, 0x7d0446a0f12ff6fb, 0x114958d6446b9a03 }, { 0x97b17c6285f8fd85, 0x66c0acc929865d74, 0x161e19c84831ba15, 0x07edb5f72ac69534 }},
+        {{ 0xfa1cf59b0d99a4ae, 0x6bd9b234b15c6ab8, 0x33f31f466ddbb6da, 0x090f2edf8b683fcd }, { 0xab0f3eb4e0b2bf0a, 0x721da26ad5cac6ba, 0x4f69912d83cebd57, 0x01daeff61ded8fcf }},
+        {{ 0x3ba00a10562d6877, 0x1150f1b4b782c72d, 0x0bce264286b8c986, 0x22519a833334d843 }, { 0x50ff97061483d4c9, 0xfdaf938bb3ce35f2, 0xa65267a3ca9aaf95, 0x27de35553d40f631 }},
+        {{ 0xa49adcc95d7bf639, 0x0058c2084067246c, 0x8b26c93b629fb31d, 0x36c7daf377b9dbde }, { 0x9b47689ed68a4589, 0xb8748011339cc5fd, 0xeaede28bffaaf045, 0x0f0876fb624672d3 }},
+        {{ 0xaf1a157524fd63fe, 0x61b3be9f9f6c30f9, 0x0f1792a63518b24f, 0x10a5d9847819f26b }, { 0x5b3358f1d6fe8d9a, 0xed6626c9ca837442, 0xbbde888ede3d3592, 0x0c93cf74011e6911 }},
+        {{ 0xcac2f3b38b1f72cd, 0xd8d22988bc48e9fe, 0x6af2f2027560d960, 0x29b7194a0df3ae13 }, { 0x8a92289dc15aebe2, 0x8d79748bfc1b08f4, 0x2474d8c67c870366, 0x38c32b1317ce5043 }},
+        {{ 0xe22355d06e35c087, 0xbe549b7c503eb1f9, 0xef7ffe058bf42ca4, 0x0ec3f47781070ee3 }, { 0xeec6b0540899d0fe, 0xb761be0ce079749a, 0x53479768fa640c5a, 0x21bef5c1cd3445ab }},
+        {{ 0x6594806276aa1cfc, 0x0eadfaafed3787ce, 0x583aa837f318eb42, 0x07622b282ee8bd28 }, { 0x66b6c0548b90e5dc, 0xd35b11df2bb97c55, 0x078f6a21df3802de, 0x2dfd41420c38e1f8 }},
+        {{ 0x07d3d220a00dfc2a, 0x1cfe453ce0250297, 0x8b496a4f2fa3e642, 0x1b08fe3f486df863 }, { 0x149342dd3faf4ca0, 0x5875f7be23eaf736, 0xe581cda93697a1f0, 0x296658823312c108 }},
+        {{ 0xa8b09d2ffba681ab, 0x71221798790e2b74, 0x5d0739891aa034b1, 0x2e08d2fb10ac4f27 }, { 0x358d056edf9e82d1, 0xbd6011ba657d03e6, 0xaf825b40022a05c0, 0x1901d2812205bd71 }},
+        {{ 0x0300a1c1590e067b, 0x74562b53bcda6959, 0xbdaa0450010f8ae3, 0x0e505972433d905c }, { 0xa4b3486a49215f12, 0x26f80516eed810bf, 0x24f831aeecaeef53, 0x32c97c538822cc3c }},
+        {{ 0x5191b95ad56926f2, 0xa2fcf1cd538a3e10, 0x5db1dcac86338d48, 0x05998af0f4d9eccb }, { 0x865a347e9790f1a7, 0xcc1e7c5157f38ad9, 0xab87efdb42ccd77d, 0x20494341ec15ce92 }},
+        {{ 0x1c5931c5220215ce, 0x9c80d2261d1cf4bd, 0x9f80e60e0fabb9fc, 0x336e5422ad877f39 }, { 0xfcde506f2b0d5dcc, 0x790a04b5b3196ee0, 0xd6d7584025caca38, 0x096c5d5e60e6fe96 }},
+        {{ 0x7df7c9544855ef88, 0xda970f5fe5b561fa, 0xc9d2a6223b5646d2, 0x0f55304d5a86cf2a }, { 0xce20b004c8622a2c, 0x9b1a9e1bc8a6cb9b, 0xda22798837ec40ff, 0x2d98274ea27a0f9a }},
+        {{ 0x2906888d87c8a27b, 0x1f57651fe5a3117b, 0xb937c9ecba4ad8dc, 0x02f96aeea2062820 }, { 0x8aeaf8fedde30bf8, 0xbcfab5b794fbfabe, 0x1afa87675bbb4b3e, 0x008b12898641f878 }},
+        {{ 0x06fb043125a3c8e6, 0xb757727f5b7e77ca, 0x83b5fc4cd37fbc32, 0x151f0018768ed352 }, { 0x14bbe4af8f2538a1, 0xbd56ccd1d8b6b673, 0xc70a5fd2e4e18226, 0x2eceb9edb68ada17 }},
+        {{ 0xf1af9f044d1a7045, 0x0431bcd9cc3d8acf, 0xe36eb1bcb2eff2ce, 0x37ec42affcab6750 }, { 0xa6ded2b4dff8c04e, 0xb74e7005d2817d93, 0x43b09324da4f5283, 0x2e3bd4d45e6c9bdc }},
+        {{ 0x640188349d313221, 0x43b934ef2966b7dc, 0x5bdc9cb5f99a2664, 0x22c5b67c592f488a }, { 0xe52401010232fa69, 0xba5923d48c24aa97, 0xb8351b6c0bdb8165, 0x00a8d35a64c42eb6 }},
+        {{ 0x0cd401201dc1cc04, 0x79f0b129097da289, 0x412d497012f8f9e3, 0x0ee3bbbf7b80aa19 }, { 0x8538cc6efba79ed2, 0x03c4106a224aa8cb, 0x0de1267cb89c0354, 0x137b883427ee0d82 }},
+        {{ 0x9420f731283b8f3e, 0xb01281774f1813b9, 0x4a6d5d07f53ff412, 0x1823e79751201e7f }, { 0xcd445507fb2544a5, 0xc3525fd26ebf2bf8, 0xe3aa17df78366035, 0x1cad55ed68ffe626 }},
+        {{ 0x9e77350551482879, 0x358b1d95117cccae, 0xf5a2f64cae97d04b, 0x0780f0ae94b14979 }, { 0x5e3ddde6c5565ebf, 0x367fd979757705a1, 0x4d1b15bbf3189e79, 0x1958271d603fd896 }},
+        {{ 0x615923a2bdfc9042, 0xb0fe9876659b7329, 0x03298dbf02f22726, 0x32687adf1b87026c }, { 0x4ab619d9c67b8716, 0xf36542805d768936, 0x5f4a42e117f11b33, 0x19d735218ee83c9a }},
+        {{ 0x11182ef2e9fbfb58, 0xbc81f9bdef0cdabb, 0x42bb199fc060fb7c, 0x1b144eda0dc510ae }, { 0x071a342e4f684b06, 0x4c96bff740e93c1e, 0xd83f3188caa1dcdb, 0x11c18a2c56dbf77c }},
+        {{ 0x7b97a2f8537abd98, 0x55b249a4ede06369, 0x2102eafc2b201f6f, 0x09b68db28ea6c847 }, { 0xe17561928e7d3581, 0xca6d6498f7de9266, 0x40663c4107ce90b3, 0x1c1b7839a775045d }},
+        {{ 0x46c3dfd2bbcd5341, 0x80e208a66044d03d, 0x38e263baa92eb9da, 0x2371a35ac6ab6851 }, { 0x55dd7d6d751b073d, 0x035e083b51a1fb94, 0x43ebc167067bb213, 0x09c61752adcbcb55 }},
+        {{ 0x0910e8085c9c4012, 0x5790e7896708c1ac, 0xac27056c2c63f1a6, 0x3e6c1936c590785a }, { 0xe9b15e727a0ca14b, 0x044d4008932dca1f, 0xe978511d5ee0a299, 0x1bad86322055dcc4 }},
+        {{ 0xa4fa57b333800a32, 0xece51b425dea26f6, 0x4597e8511919920f, 0x1ccf5b5cdd50e073 }, { 0xeb5ae6cc66ec19f2, 0x24e9345ddd8a8c4f, 0x1b95f3fab9a741ed, 0x05dbd71b1ee7da36 }},
+        {{ 0xcd356f3d0a94f18e, 0xeb7e5c61d2caa4cf, 0xc1f6ffd411787a32, 0x24893e16e42f9833 }, { 0x7c5013f8db8c09c9, 0x6d08fc855b302037, 0x9ac1e1350ba7748a, 0x05b620906eb54091 }},
+        {{ 0x31ddbd96b7f59c10, 0x67875621de28e0f0, 0x7495001002e44677, 0x22999885d319c088 }, { 0xa9f201fe2c18eacd, 0xc324069a25ce0b4d, 0x926888bcda69db23, 0x047b35571d158252 }},
+        {{ 0x518f2cecd95757a8, 0xb7880471e199e54e, 0x8835e9cbd73d540e, 0x1361c9fcb95b86a3 }, { 0x53823d0f0a03bee2, 0xf5d18dc5d91d9f4b, 0xdddb5dbe4353b58f, 0x39e51cf5c8873197 }},
+        {{ 0x4a835060a4b4d91f, 0x7c2730d13163975a, 0x85f7788aaf1be48e, 0x0b39718a6d0b6d7b }, { 0xd69fceb82d730270, 0xbd9e585b81b246c7, 0x746ceecf02231782, 0x2afdbda68aeebb5d }},
+        {{ 0x3aaf86092b06c5da, 0xbe28a9242783a881, 0x169c31f72706de02, 0x3a8eb746e0d1272f }, { 0x5fb10cc9ceaefe82, 0xe5608f0c492b6832, 0x7027c65e4dbbb4c0, 0x1197a44795ddd5ed }},
+        {{ 0xf458731ca5a69400, 0xdee7272c70da7baa, 0x3e43a6c4428ec9d0, 0x06afdca30ad421a0 }, { 0x0c985eb102e36a6e, 0x05c1728f2f58445a, 0x6dedaeeb1798775c, 0x1f82674f420d6875 }},
+        {{ 0x8c3694f0507fd63a, 0xbb7b1eb44d74d25e, 0x9c57dab3b908f708, 0x327c2e24ce14068d }, { 0xfc9d278ea1751379, 0xbafcb5ef64a550ef, 0xaf748953e90b57bb, 0x2ecc8c12ef1700db }},
+        {{ 0x706d58fe1f67dc1d, 0xfbaa29cae1bc5d56, 0x21fe88dece7f55c4, 0x32a39d2be762014b }, { 0xdeafc948898fef27, 0x93f196a72fecc942, 0xfb28f06e955a3a67, 0x000447148386ad43 }},
+        {{ 0xc5a6e152037e96d7, 0x14497dd56a3ff8e4, 0xb659e4936ae560e3, 0x2f4115ccfa522938 }, { 0x2ceec13790fdb223, 0xdef5a8e83aa21ba0, 0x6a36fb4d50ec9405, 0x0b90ba8c1d541492 }},
+        {{ 0xfbf684c5d880a2d8, 0xceb45972f61d68ee, 0x4d9b1cfffcda2f6a, 0x3960c5386c377d4a }, { 0x5fb9c70250cb7f21, 0x50bb8bc2cbfd108c, 0x6a0076e1fce595e4, 0x3e9cf0c91d22a32b }},
+        {{ 0xac498409818f5901, 0x07131d07884a150d, 0xc8cee1d299c533de, 0x07d4da095b001032 }, { 0x71d28921309c67ba, 0x289b52a8c800999a, 0x8b4060014adc2c2e, 0x08f43e1a2a49a630 }},
+        {{ 0x8f76258f5435383c, 0x6fca406522e82660, 0xbb4e088bed6142f8, 0x0c1063a5a6fec242 }, { 0xf4ca0533b31746bc, 0xbe81eaed3189416b, 0x075612fb7f67303d, 0x14aa59eca2756161 }},
+        {{ 0xf16b19f5d61b75d8, 0x7ecc80d224e2af4f, 0x7ec5a754213377ba, 0x008d3c9e27b28a0c }, { 0x1658035457681b32, 0xf285ce9f93f9d121, 0x0d6ca7a2bc204e99, 0x1f4b087e078677d9 }},
+        {{ 0x9fb19e925e5108e3, 0x43a11d2383e25170, 0xa01ef900c923c0c7, 0x39a16a5375b67e09 }, { 0x4b53ef3699383ebb, 0x86b4d1ac6a2e6533, 0xb38855fc1ac8e1da, 0x0520781f93716ab3 }},
+        {{ 0x7ba999d355074cf5, 0x0bb192d4a047ae36, 0x2c30e6a6d80291db, 0x16c67e14c315c08c }, { 0xe93d0b17d07a7caa, 0x1c764df2b720badf, 0x16ba9ba4c17dce43, 0x0139c1ca64f2f0e8 }},
+        {{ 0x64ebc42b5b37890c, 0x5d795ec3955b168f, 0x44c5a519064a6ee1, 0x094e44370690562f }, { 0x139308c3cacd3984, 0x2f3df5b1f86fafa3, 0x8452260e17829a0a, 0x1c773b902a22bcf8 }},
+        {{ 0xca7302c6c21ca1b9, 0xe54d4b14687545b1, 0x69a303ab3783c3e4, 0x2e71c6317a6f7ec7 }, { 0x71ffdaf8310964f0, 0xfdb21ac6638be0ef, 0xecb09499bf3dd469, 0x1a21b45e98821030 }},
+        {{ 0xa8b6fb07f8a98219, 0x68e7097395d56770, 0x610e5e733d5e512a, 0x0952227cba6e8fd2 }, { 0x5f2fcf8fa45bffe0, 0x46fef6b471d6f355, 0xb2cdfe860d0e1ad6, 0x0065196b7a771bce }},
+        {{ 0x9b956fdcf2095042, 0x67cd8a484057891c, 0x0a489c1d70a1560e, 0x363cc635fd2cb482 }, { 0x790ba03c19944e6e, 0x336606c6e85b5426, 0x807f6b3ec8cc85a5, 0x18ceee488066450b }},
+        {{ 0x2d5289c83481e817, 0x175160285e52f4bb, 0x40b1035b38c82305, 0x09a6a9b1c925141d }, { 0x3f57550528631e77, 0xe9127e5b7d1968d2, 0xcb477a0ebf7d8eac, 0x1536c74834c1202c }},
+        {{ 0xe518e83cde347f97, 0xf304af668d1d1caa, 0x3b7f04b5cb822635, 0x128961b16e866879 }, { 0xb0735f28564f879c, 0xac2291de8cc9a8d0, 0x0246bdad483156d5, 0x1294b5d3a9a63b87 }},
+        {{ 0x7c4756860cccd886, 0x43a2c52f9397af26, 0x5c3a38c61abf569d, 0x11b6c0cfc667e935 }, { 0xcdb0fe8be65d8e65, 0x63f8e2f77fb2879f, 0x0c104d482e3fee57, 0x0cc9e9e21b660816 }},
+        {{ 0xc384b407bdcbaf79, 0xbc73d1c94bc972d2, 0x93df882a80269c2f, 0x191f2cc97345cd53 }, { 0x8eafa8e9360951ed, 0xbddd8c62ff1442ec, 0x90be195da81b8ea9, 0x22174f70ce4995fa }},
+        {{ 0xc445fc79845604d6, 0x63e1429c984f30d3, 0x00882691e30c3859, 0x2b07eba2f59148f6 }, { 0x7b8c8db25bfcc254, 0xc768b760c98613fc, 0xf777282dd0fb2b1f, 0x2325d91f0cffab62 }},
+        {{ 0xaeb265d7e0444656, 0x7a6c03244a75149a, 0x634f8615a75eb572, 0x065fc1ca72f0205b }, { 0xf09d38edef5c4e45, 0xda835dbe0abf8764, 0x386379a361b71822, 0x02f2ba889303d4e2 }},
+        {{ 0xfa4cb9e1576de38d, 0x49bc88908f82429b, 0x81ac4298aab9ffac, 0x371e8e29458d6d08 }, { 0xd4e680f8594d6740, 0x2ce7e6a222853c3c, 0xce501d006fce68cc, 0x006079107adc3029 }},
+    },
+    {
+        {{ 0x372278ff6c5d0d5d, 0x70813b1e81c8f6b9, 0xaeb726d5111d74df, 0x161b0aae49d6c69d }, { 0x22e57e555502d6fb, 0xd71ae9f104fea24e, 0xd902e829fa0aa271, 0x2328dc92a371be0e }},
+        {{ 0xb5df49e9fa914c22, 0x667e2db35ee39a89, 0xefc73000d09a596c, 0x32390bfa2e1cf7c2 }, { 0xdb6248c6c826fda3, 0x1b282b5995f72b45, 0xc77b22e5bfa9a470, 0x27d82f43a9c4de21 }},
+        {{ 0xaa7838f1fa14c4a3, 0xfb8f11e4a9e8ca62, 0xf9e4db82ba1a94cb, 0x0b708fded3cfb928 }, { 0x679111aa1e529f2b, 0xed51cd2a08bc6bb2, 0x5a556c2322bb065d, 0x06891ca2aba29225 }},
+        {{ 0x03efc60f3af3b28f, 0x1568966d897f404d, 0x6b258ac63fc7302b, 0x285252b1c8df0e20 }, { 0x4b358106a7ea6d00, 0x14650615edf16611, 0x3edf3359358f4750, 0x3da282979e2338eb }},
+        {{ 0x87a53f4d1e967df0, 0xc930ce3e3ae0747c, 0x60338917e204a801, 0x37aff5a32f49cb27 }, { 0x5b1cab712ce27e5e, 0x49157d9a9cf6fbc5, 0x70b767497ec00578, 0x251c3a14cb196843 }},
+        {{ 0xd91975babfc31534, 0x0b3c52fe2b6be102, 0xb2a174bc80c16c48, 0x309b18a89bcb236a }, { 0x1aaa5d44ea553de6, 0x729817508b17002b, 0xa026f21a1546849e, 0x07212d268ac1db5e }},
+        {{ 0x459fd48f79ee40f5, 0x6025cf7d09faac0d, 0x2ff031e29b62576d, 0x0646ea4cd9bec124 }, { 0xc2508f37050adf15, 0xb058fed5e5f0d888, 0xf3f55cff8f6ca190, 0x3eb91a3727b7adad }},
+        {{ 0xcd43face83e7046c, 0x7b03478ec29f014e, 0x40831b45d0254592, 0x0739a4847ce245b3 }, { 0x2a8d997402bc367c, 0xcce3c34f7aa73522, 0x0bf6f0c8b6b81e68, 0x04d86ebb0bb15f0f }},
+        {{ 0x7178cfdbd7df2c6b, 0x71c9b7da8d4fc2c7, 0x8a0c03999241a26a, 0x0bdd11c09f9923c1 }, { 0x50658a12bb7e1e57, 0xa4e814fd7f848140, 0xc97b7bdbed9e602e, 0x12eaaf3937a2da73 }},
+        {{ 0x7bfbab6254910a13, 0x90b3506327349cab, 0x43ba2a4cb892ffe7, 0x17a1b2038f002c4c }, { 0xa8a6ee686e56bde5, 0xab20c0558b8ba048, 0x29a2d2ea1cd9d8af, 0x21f5e01e5edbd43b }},
+        {{ 0x0192d7f38c218fe4, 0x7eeb33b112b5e9d3, 0xee5fe6dcbc248cef, 0x3806be616814ad6e }, { 0x65d084c12b1ccf01, 0x833ae03888117ae5, 0x2208ff23b359f6f8, 0x338413463e9fb435 }},
+        {{ 0x2ed609d960478b4c, 0xa9dc6f7fb39fa4fa, 0xf07c576228bc4e00, 0x09072bc0ce761fd5 }, { 0xb6437a08fcdf8bee, 0x42c95d7ddba3ff82, 0x937f2f7586696941, 0x3e9ead060f8636a3 }},
+        {{ 0xbcae550441e0a4c3, 0x5fcf860680771c48, 0x17f8e0faece5c3bc, 0x30a5f070979188b1 }, { 0x1b7bb1dd6fde7708, 0xdcb77db52538567f, 0xbfb5f45bb003a864, 0x16f19e7cc01832ea }},
+        {{ 0xbca87d4e0f35e20c, 0x3be83d7597615bee, 0x0c7fcccc49076829, 0x3f1dda1f6cc65667 }, { 0x3adba30bb49ba0a7, 0x8551da4a1f607bcc, 0x0859abfc031fc20b, 0x03a712ebe4ed2295 }},
+        {{ 0x069c1773f249a65a, 0xa273391cb0a7f5c9, 0x2d71e3a8281c67d4, 0x2551b8969c95c888 }, { 0x6ed3fe1b62243c4b, 0x4edf4f2ef0bb9aa3, 0xb4480955229be5a4, 0x0233fb44ff172699 }},
+        {{ 0xbf8692930fca98aa, 0xa66bccf8e3ffd989, 0xcfb4ccc93e443696, 0x1310ccc855acdd96 }, { 0xf6124bbae99a617f, 0x7b552601969e8d78, 0x8ceebfb7351b70fd, 0x0e0d4a14e815948d }},
+        {{ 0x5ff549f499e30dec, 0x4892b6ff788db0db, 0xe4b65f63e0542e08, 0x0b5c588ea4b1b5e0 }, { 0x2e0d1380c57e4551, 0x0b1ce7c820466b68, 0xdd35c6988fb33001, 0x2e76ab9e8acb0e48 }},
+        {{ 0x44f99784486e0c89, 0x2c17f113cb0c3680, 0xb4d893abd931d24d, 0x29fbec6bd411a699 }, { 0x10e6e0874a58453e, 0xc47be5b9e8ae96cc, 0x886924c334933802, 0x1058bd7ccfa7f2ad }},
+        {{ 0xb68f18ff86ee6185, 0xac9c3692bbd0503c, 0xcfc433b9b7f5335c, 0x1879dce6103220e9 }, { 0xf161b40610d959a8, 0xdfb8bd6a6d7f5971, 0x11f22219fe09194a, 0x27bf6d8fdc11cb32 }},
+        {{ 0x439a31d751c20df5, 0xbe80236fa998901a, 0xd4857a9f6de2b142, 0x386d96eacdce0600 }, { 0x62035e42a7ef74b7, 0x7fd9c7b67ad7e55d, 0x38e8466954858ae3, 0x13a9f4724da45544 }},
+        {{ 0xa62657ac19347b25, 0xf889b595d01cca75, 0x8bc324ffa42cd16e, 0x19558594b264eb53 }, { 0x369c08f732ad40f9, 0xc71574e3aa288c2b, 0xaf38290b936e49a4, 0x328e1784888afedc }},
+        {{ 0xd7c43dadf37925c9, 0x920fd898738c620b, 0x926e8fa1cbf902d4, 0x1f62ed0b4654a215 }, { 0xa5e1752f1d9e0a78, 0xf691ecd86e99185e, 0x16be8a9caa5dec9a, 0x3f85728447001c8f }},
+        {{ 0xf3df75d5331f92ae, 0x7d9edca6094630e8, 0xb27cbd9d23dcf582, 0x3c478741845ebcad }, { 0x704c7666cb67bf1d, 0x0e5c5d4550a5ce09, 0xe2ce3643a1f0e0ec, 0x07d86d56b0ee37d2 }},
+        {{ 0x775eef9d5ff7a253, 0x6d384774c4bd1ca2, 0x4fae1a55bc3aa510, 0x1ba2a9f82b4644fa }, { 0x7a642d7289f0ce86, 0x5ca8e16af97861ca, 0x14175fa305767fcc, 0x28664243ed11a71b }},
+        {{ 0xa312e279460045d0, 0x80d6b3352c5ef538, 0x9e7a14f4ae002b1a, 0x3a66529e3026b2c6 }, { 0x33baec79b83d4a2a, 0xaf58289ac38544c5, 0x53ed49bccaa329ae, 0x2e042096e778dc63 }},
+        {{ 0xc2c0546cbea13d55, 0xbd85ea1c2ec53dbc, 0x0e0fccae3174c454, 0x2d249d169fd54b43 }, { 0x959517882d356c68, 0xcbde8284553ca0c1, 0x3178a4c50ed6bcad, 0x16d9a7957cab220b }},
+        {{ 0xf9e5827c926cf5fc, 0xb0d4390a9d875206, 0x467809f1ef2d6f31, 0x28075ed94ca6050a }, { 0x42e62372a8b4b07a, 0x970d8a0456d29fc9, 0x43421a6b7f2511f9, 0x168d712e85f0afde }},
+        {{ 0xe1faea7e9bfe11d1, 0xf6b7f95e1ac0227c, 0x849f172f25907ac2, 0x016b9309b4526aa1 }, { 0x6b2e526426ca3ead, 0xf1dd9423572e94df, 0xfc3ee449e0986366, 0x1ae66e4a813f40af }},
+        {{ 0x421b26a2a68e0100, 0xd57837ddf4eade28, 0x183e26006f700b7a, 0x2de04934f46fa9b4 }, { 0xfa49e0d2074266b1, 0x50e3de15da7b7259, 0x271ce769a72336cb, 0x01b2b4e33443fb5e }},
+        {{ 0x6704a58094f3c2f1, 0x2f6542d050e5adb3, 0x23ef67830d79f587, 0x27cdd6b553438e83 }, { 0x72493a5f7f4d8c8b, 0xdf9b8c5f6e1ade93, 0xa955920269150ff6, 0x3bbe26898bafae7b }},
+        {{ 0x73552cddfe4280db, 0xf3f2dca8265023c1, 0x89f5fc7eb828e98b, 0x23bc24f6d1719a43 }, { 0xbdcf53439b2922e3, 0xee8452e89df19daf, 0x1326942babc85b76, 0x108442f088888b4a }},
+        {{ 0x2e85e6f1c0da6490, 0x30edb8f75d31a60e, 0x70eb939914fcf369, 0x2e19c258590dfcca }, { 0xb3b256abedc652a7, 0xb3ea4c5470aa6436, 0x557a9cdc0867bf5e, 0x22731cb09e2bca3e }},
+        {{ 0x229361ad87af481f, 0xd9858b3d66ef9712, 0x1888203185a722e0, 0x17b3a8bed8b2193e }, { 0x95766ed55e314d5f, 0x0b3775b59ccc483b, 0xdba64a645df5a141, 0x05a33a9e18beb2fe }},
+        {{ 0x1aa64a5ff958c1a3, 0xeb762405dacfae47, 0xe2c7a1f79162ca67, 0x37cd1d3037517af6 }, { 0x79d0297cec43feae, 0xf40017ed8e82058d, 0xa5e57fd4682e81ca, 0x2a44ff54983e8912 }},
+        {{ 0xbf5a08001a35faf1, 0x5dc35b3a3f93b081, 0x4dfb56eb3f6ebe82, 0x2f64b99fbef4c7af }, { 0x498e52b4a2264041, 0x18fe42fdc571a307, 0x2561ad0cad33e709, 0x2d35d56457509a19 }},
+        {{ 0x1d027fec725e508f, 0x721260892d548b71, 0x491334bef565109f, 0x3e9eeb289a02b5ed }, { 0x66623106c8467fd2, 0x9110392b9390723f, 0x2085896da1d923a5, 0x1bc8fd438c2bc1dd }},
+        {{ 0x228353e49d9b3110, 0xe7735df857fa2b35, 0x3cd79d25ac30c4f5, 0x0c2be9b3afc54783 }, { 0x5a6c9858eb7a9aa3, 0x4dca035cfbfe737a, 0xa1329f49b3ced5d4, 0x190920452b43b1d2 }},
+        {{ 0x200cab86a7bf4976, 0xd4a42cdfce313745, 0x3a1ecdcbd9f77c10, 0x2d5cd70676346f2c }, { 0x37b95191d10ed76e, 0x0c90467eaf84ccc6, 0x9be5f06514d57b00, 0x0b0240cdc2dc89b4 }},
+        {{ 0x7fdcb82f937591a3, 0x673138d0ad034f18, 0xb1bc94b9cd9fa8fc, 0x1c3e8621e0dfd517 }, { 0x297d8b597c152e38, 0x54abfc26d60bedca, 0xb8951285cf9a5927, 0x1bf99728104cb42b }},
+        {{ 0x19b7e83ef2b0b848, 0xf88c7ed6d99465a3, 0x0ae32d148d8281be, 0x371ffa962755368e }, { 0x7c07b0c90ce660a6, 0x15657f1dba99666d, 0x9e30177464470d0e, 0x3a99a6c70661ea7f }},
+        {{ 0x69c4c08e8c2a4d57, 0x552e4ff1013fda69, 0x2c6cdfa664799550, 0x3ed94ff20fc9e9ea }, { 0x1b8ccd0f7cf7ccdc, 0xfe348f531d61a009, 0xa199854d003254ba, 0x33af1407f0199fa2 }},
+        {{ 0xf30674c5f14f5363, 0x32cbb41e805730e7, 0xd269a0792658da2c, 0x3fec74e379b0bef4 }, { 0x33b593d2fab22b01, 0xc2a81c47212e84f3, 0xde0006fd9f310e50, 0x12c706df803241db }},
+        {{ 0x2495887ca9cb5a80, 0xd867c9274ca0e24a, 0x72648e08943a60ae, 0x0770542fdc8a9603 }, { 0x20174a1ee8cdb929, 0x535712a60add287f, 0x3082eb9a5429f0a2, 0x1a48b1109ee2fe5b }},
+        {{ 0xb0d20ce0869aafe2, 0xb119f0e523c2287b, 0xa1cbe96c5be174e3, 0x31acd35e3adcf835 }, { 0xc9a0788d2df5035c, 0xe7dc61736445d54d, 0x9d77ec5f6f26c16c, 0x0e1c6470e6c5095e }},
+        {{ 0xb3975d780c3f0abc, 0x56b90ff873b510ca, 0x35a4f08d1f432819, 0x3f24ad8560cc537e }, { 0x62e00b1cc1a651b5, 0x99ec78246deb4b54, 0x5acadb91e6061bd2, 0x19c2d6aed8d7b1ec }},
+        {{ 0xfe6a9e8d432cd200, 0x725ce0640705055a, 0x537ae069896dddae, 0x340302b99f57db95 }, { 0x6ee4337ef38178f6, 0x7336e32894a08217, 0x0f6027397d425c84, 0x3303a78d6b73ac44 }},
+        {{ 0x8665dcc3f56b505b, 0x5d7b1202d1f66950, 0x0b3a87a036469790, 0x0850f57257e30e8e }, { 0xd163959f52790816, 0x5553ae8bac4c926d, 0xbba37d13a40c8d57, 0x3da7e4cdcc034bcb }},
+        {{ 0x97d8d83f497bf528, 0x338a69dc5b4fd460, 0x35998b828360291c, 0x3f9110a32f7cea99 }, { 0xbd6680906ca4f414, 0x34e0eb81b1e66683, 0xb7f4cbb813d3a2d3, 0x07161e332222895a }},
+        {{ 0xf61f43b1dee70aef, 0x40e437e3d70a1936, 0xc4a9fbb777dd7b90, 0x11489d3a749c02c9 }, { 0xc42dab5dd92bc123, 0x83cd0a77dc61fe00, 0x44882704c7344f1b, 0x108683b318eeff62 }},
+        {{ 0x2472766adf1b4b07, 0xb8e29272a580de6f, 0x0f6594a3b5fe3735, 0x1e489f6b7bf189f8 }, { 0x665f49ddd9ee1358, 0x8612f793a9446fc8, 0xfb3cbe719b35de91, 0x077840171c41523f }},
+        {{ 0xfd1099a47e7988aa, 0x7eb3fe73941cc673, 0x0c84dbcb35eeb12c, 0x30ee35c7081f17d2 }, { 0x87603e9655081f46, 0xfe0405168da42fd1, 0xad436cca01eeea7a, 0x353feb081e1c49b9 }},
+        {{ 0x16debf18e463c3ee, 0x02c2f7eb7121a6ee, 0x2ef1feb66e8705d7, 0x0d3378b3d1c703b0 }, { 0x547bb50d68af349a, 0xef09843bfdb578af, 0xb998cb951cc99fa2, 0x316de30c3016a6b7 }},
+        {{ 0xdacbcf2dc6b9ebfc, 0x37ae61c624fd2410, 0xd264cb09d9865acd, 0x38e60803283a316a }, { 0x5b889a8ad61abfbc, 0x36afb90c1afe4af6, 0x9d3ac24091f574a4, 0x2222ba0a4004c881 }},
+        {{ 0x702ddde4283628a8, 0x1eb548b743038fd3, 0xe4771df1ee0112bb, 0x3151a1b59d33cde8 }, { 0x59d101d63b1627a2, 0x759f4fc402870cb9, 0xf519b5ece8dfac16, 0x0e757f6dca5fa436 }},
+        {{ 0x60bcc8637eda5287, 0xd42eafcf48746a6a, 0x3c46e00a4cb4fe7b, 0x210a713b495204b3 }, { 0xfe270775404ade99, 0xa99bb297fceac781, 0x8db83ea31fb8d31f, 0x1ee74211ac74616a }},
+        {{ 0xd38cce8eefe9b0d2, 0xab7ca3d4bd04dd5d, 0x2f749fdffb9dd781, 0x07e2a59eea75d1d3 }, { 0x208c3e4df2eab9cf, 0x013bb079ead7f364, 0x2539deda4391cdb1, 0x3f6c62e0c2648ac0 }},
+        {{ 0x415568f3b9950a11, 0xc8d897d118e45b06, 0xf0671961ec80925f, 0x083c78ce8744bb68 }, { 0xf49e0b00b333641b, 0xf727449a3ec4f049, 0xb0d987fcf42b668e, 0x055863def199cbd7 }},
+        {{ 0x6fe4f9331659a39f, 0xfa77307a7672acc7, 0x9f119adba209f270, 0x025cfd0d3b02acbe }, { 0x495b25b1de867c54, 0x735ad8d79f023fbc, 0xa978aefcc45ecdda, 0x1beee213124b3067 }},
+        {{ 0xc61d7c1ec396c838, 0x8ab9e55efccdccb6, 0x1c94d8365ad78dac, 0x359ba9a2595877c4 }, { 0xe213d4b0b2ebc467, 0xe2da85189fd68cac, 0x0df467aa59bbe438, 0x2a322e26f112adb9 }},
+        {{ 0x4510ef13b5701a82, 0x2db351302a989e5b, 0xde41223262f717cc, 0x24f31bbeada8eafe }, { 0xa3b4cc4ffae2c82c, 0xc74dc7efd3b7d2a2, 0x926695377c7457ac, 0x34ecb0ce09cf68fa }},
+        {{ 0xdb877fe1f70d7571, 0x883f736e8b7b33d2, 0x400cb253a7fb8396, 0x20b2e21bd53066eb }, { 0x13b429800cb741c8, 0x792521a8b2a53f12, 0xe7f9c214d7de8363, 0x345f6a2cefc38423 }},
+        {{ 0x6b3b3b419fe15f8b, 0xd209ff2356ca01af, 0xe7a6d44cd59dfdcd, 0x19c0bbf77705e08b }, { 0x8e5eb868969a267b, 0xdc89d1f6e80ebaca, 0xeff6dfa9359aef6c, 0x11b9514ff2348333 }},
+        {{ 0x17c8cd745b1989a1, 0x306f5417c6c26c04, 0x38b376d30aad711b, 0x067f4a5cc490f496 }, { 0x1efab649c2b59fc1, 0x818dc7a524f6e59d, 0x72176d6dfc28e2de, 0x009c39c0409f7117 }},
+        {{ 0xd02dee44642fec10, 0x937a26f9d247e8c2, 0x365e89f252a0edbf, 0x26fb8536dfa9a897 }, { 0x74dc29b68376c380, 0x6d382f710587c427, 0x7539007ccb091e1f, 0x0b7af6e751de42f0 }},
+        {{ 0xb715911cec01451c, 0x2d6b351d2f3e4ebf, 0x2aa0521a33852e65, 0x008d1133edb94c93 }, { 0x0e232feaa4b2579a, 0xb9d755b94500af64, 0x0a738030d939db9e, 0x37f93738af3ea502 }},
+        {{ 0xc934acfbd5d64608, 0x74de0c1656ffe33a, 0x8a0613017f5d15b0, 0x3d2f5b94b9dbf609 }, { 0xd1cdf1b7139238b7, 0x414e599850f4e906, 0xfed9b51b65bbde4e, 0x29347fa734d92cec }},
+        {{ 0x675ca8932e0c2ef7, 0x31989059ac474710, 0x6ac9ada9a7909e33, 0x362cd6063e6765d5 }, { 0x9b227b12e19e0772, 0x291f51a8cc4438b2, 0x9138ee4fd780df93, 0x07be261d78f25486 }},
+        {{ 0xbe64672dd774208b, 0x75e65177faf31271, 0x5a982bbdc06ae81a, 0x280f784f616b2758 }, { 0x175715be49481f99, 0xf35b233754de3f73, 0x13233fb3cf3afbe0, 0x1d52c11626831ac2 }},
+        {{ 0x492d7c05cb87b15d, 0x6d1d0ca7342e725e, 0x4c8dc7b5197efd6a, 0x2f4113d92c742852 }, { 0x4e2884ba9b1ef3b4, 0xd056c89f4637d5a7, 0x09fe3fbeded8c647, 0x350a96c10f515f6e }},
+        {{ 0x18d41cde7674e952, 0x726c4d2f7e17b506, 0xbf8b655175309922, 0x38ba9004867cf204 }, { 0x070db3d32f39d967, 0xf59bba3aaab86cb2, 0x53987bfbb4c954ab, 0x30e7a6610a58dc5e }},
+        {{ 0x84ded42d5a417bc6, 0x6c615ae08cbd1474, 0xa09ccf6af4eaad9a, 0x03da98383fd4c8f7 }, { 0x068d741c4b574211, 0x135b744d6bba1b61, 0x4e8d3c9ce253043b, 0x131b4f3c15f3b2e7 }},
+        {{ 0x50da8ee16bca26f0, 0xbae384cdd0544303, 0x97d8c17ee6456ff1, 0x2d6a8406f73b4f6a }, { 0x8c80d7685a7e4237, 0xc05e77ca23e0cc2d, 0x7e5f854e1b260527, 0x1348c4c769f4a76e }},
+        {{ 0x8d5c63c5473ae98a, 0xc3351b5c3b9264ba, 0x880c01dba3ce66ea, 0x3b20d7f2f52a90b5 }, { 0xe2e52d37ac2dd09c, 0x8288a8bc1b99969b, 0x61c775fc92cbddce, 0x32ac5e028aab6d0e }},
+        {{ 0x47feaa6a4b0aba75, 0x634f422783ab3a1f, 0xe13b74ef6dad31e5, 0x33b0bf8bc9b8dc23 }, { 0x4a5a1c98953f11c2, 0xe5798d80260c99b6, 0xd2d5b1a2e8cf5611, 0x330bb856ebbfbb34 }},
+        {{ 0x73685ceee6ab8a5f, 0x08d0ce7617455121, 0xb77af8ae651f3009, 0x1d6b75e7df069ae5 }, { 0xbaf37a01394efbad, 0x338bd6a741f5075c, 0x6ebe256b1e2fae40, 0x2f4fdfa897ed0b99 }},
+        {{ 0x615837cc795fa2c5, 0xc9f950ced827548a, 0x93307da93205146d, 0x23b33033d625c610 }, { 0x435a3d8fe630bcca, 0x0b6012042e8c066c, 0xaa4b6c7181e5ba55, 0x1978702fef66950e }},
+        {{ 0xea9f4db4b4274930, 0x1603bc63f17bca11, 0x2ae9718c4c19d3a7, 0x23e564046b5066bf }, { 0xa9815b3630b23b9f, 0x06cb250b099fba23, 0xe2aad859d96c417b, 0x0a2349c526b883bb }},
+        {{ 0x0360829fc51ebdff, 0x970f5e0c2e6ed857, 0x26b462ccc0e0b0cf, 0x21ec9a7f1f531d01 }, { 0xc1534d62cda601d8, 0x228528ee32a201c2, 0x7be030f4cf56fb12, 0x0bc421f4f904503b }},
+        {{ 0xe3c3968c8cd2c5c7, 0xe5bdbab6c70943a7, 0xd06be8f20c2d9c07, 0x09d8542a19599aa3 }, { 0xe8da0a216908cf3d, 0x42351140c5f32756, 0xefe2cf721c1169eb, 0x275e6019adc31417 }},
+        {{ 0xa4230880323b8de9, 0xc8a664eb051b045a, 0xfa268e36cf7ba2e2, 0x3ae9cd1f725eeb6f }, { 0x2a381e83443af78f, 0x92213db7eb730f01, 0xc1e8e1e90b954a45, 0x022c97467a9af719 }},
+        {{ 0x3718cb939e780cc0, 0x768c9a6bbe6a78e6, 0x6d33b421615b41d6, 0x0a988e5521de4554 }, { 0xbca959f0d80af345, 0xd218196a078ddd1f, 0x0601f851f188ed7a, 0x0f0a146772aebee7 }},
+        {{ 0xe775fa51e417da4c, 0xa1ced28571298302, 0x1a3266504086d1d7, 0x1a8854c48caabb98 }, { 0x64ccf2d17e3192dd, 0xcfaf9a3bd9da1872, 0x26f631b88abdcfae, 0x3179753855adf355 }},
+        {{ 0x4dcee28f23451cbb, 0xdda2158408d6df6b, 0xcddbadf9834b7d34, 0x1b8c6d579a5eeafa }, { 0x089922152f548f60, 0xb5e4c2a94414402d, 0xda05772209d00f9a, 0x2f9f639b9e746dcb }},
+        {{ 0x2a7ca2e97b843342, 0x6edd3308ec15103f, 0x7214c9f157aa04f3, 0x00566598beb0ee6d }, { 0xb59e68d5c365717c, 0x076473478339f2fc, 0x6ec935f860400c91, 0x064ae4fb59aacf19 }},
+        {{ 0x3e943075207578ad, 0x949b5982a0356165, 0x2a92571f7788630f, 0x2315726bbd1d7d5c }, { 0x9e43121a0954309d, 0x75b182ff0b1a441b, 0x450ba7f84a058e9d, 0x251db0ee0c5ae7a4 }},
+        {{ 0x9346739402014e60, 0xd6226688407fafd1, 0x10b6c88b1c64dcb3, 0x0bd529a864fab0af }, { 0xd227a35ae969ddeb, 0x0ce99e4727efe83b, 0x4a449c517e0d0860, 0x069a9a5535f822b7 }},
+        {{ 0xbaeb6f080cb6dda2, 0xddb42f54a0d4c6e3, 0x02f7f353d8236299, 0x02bad1ca1adaed20 }, { 0xec736fc8ade138c9, 0xa089e62e46538923, 0x347e0f96eabca7b4, 0x1a97974c52762830 }},
+        {{ 0x07e57f614e9ef037, 0xf7f760f30570a25f, 0xee9f80818cb24da1, 0x1f3556e7eaeb7359 }, { 0x09077881e9e042b3, 0xf7a108980b167d5c, 0x81e4387b1d188f0f, 0x06af949eebed3e83 }},
+        {{ 0xc80343b977908dcf, 0x1479e4c8e7e6fd15, 0x048ccca8289afe68, 0x3c9158bf33377334 }, { 0x20a61df8a0c8cb9a, 0x732f074197ed05a4, 0x1853f41ffbac9fc6, 0x061c4de2eb5d8d25 }},
+        {{ 0x6428e96aa0462d4a, 0xa6cea62dc28221a7, 0x60c910c241a605a0, 0x0c001dcab5321065 }, { 0x9df2e960185e133a, 0xe852f193449dadbc, 0x5933280d514d7759, 0x28b61f977916ddf7 }},
+        {{ 0x59a4a5f7d3435d6f, 0x116ceb40d7c28419, 0x66f0cd6db3480937, 0x2178ed0e293636e3 }, { 0xf71fbd5434003830, 0x0c0b5ae66a154ad5, 0x272f27627b81807e, 0x335bb46aa0d96ea0 }},
+        {{ 0x38fafb4afb011c15, 0x5586d582f1ceb589, 0x0e9065c7f57abbf8, 0x3708ce74a4a18398 }, { 0x23b429cee3a67f61, 0xdacbd6cf0dbed463, 0x079660933a10c90b, 0x2ac5e06cb8a5ae0f }},
+        {{ 0x86d33b36c4e04405, 0x80a865c6738a5f9f, 0x88393016ab007b76, 0x099d5916e6efce97 }, { 0x6ece7c187fd5cef9, 0xf3d3c46d4a3fef65, 0x40b819874a59e5be, 0x03465646f0355590 }},
+        {{ 0xa5a2638615b150e1, 0xd52c048f168414ab, 0x186fc735227b5b99, 0x063a1de1304dcddd }, { 0xdfcec9c4504380ba, 0x165a047f5193df7a, 0x6d33e249657a8ecf, 0x1048824e85657fcb }},
+        {{ 0x4e2b043609d18f8e, 0x2c97712f4230ea0f, 0x260aa08d3df9f912, 0x3fef3517727816bd }, { 0x16bddc3bc53feb6e, 0x2b8cf2b11430d8bb, 0x45f9ad2366c8198d, 0x249314fa7ad9f2a8 }},
+        {{ 0x1841312b5ade8f22, 0x10f0506fd8c5bc9a, 0x550ac6cd254edd4b, 0x2ddcd17c7cdf581e }, { 0xf901c5cce64058d9, 0x326c1a9fc690e62c, 0xc00ddea471270f4e, 0x2bc226aa86f1636d }},
+        {{ 0xd2008d8cde31bc7d, 0xa4b9b9c9cdce7603, 0xf41e7169ddf41ffe, 0x0b4366fdd70277fc }, { 0x0f9b2f297224ee13, 0x74b4619d3fbb6706, 0x727a190fa2619201, 0x28970524598c9600 }},
+        {{ 0x1b5c85a6fb6532cc, 0x32e762498152d394, 0x56aa69cd47bdc106, 0x02008642c3bd5ec5 }, { 0xdca578e6ad040f0e, 0x8cded115276cc8be, 0x59ba51e2f51e8de0, 0x375a2301076eedef }},
+        {{ 0x8876b884e3c6195f, 0x775d01071578ee64, 0x7dfe48ad81aea5df, 0x383525fdbc7ee595 }, { 0xa35fc1713f09e81e, 0xedfa38bd48779032, 0x710c6c31b1d7ea70, 0x0154c833c0454e1b }},
+        {{ 0xfa739ca807663a74, 0x3e506b768f5205f8, 0x9dd678ba7c0b837e, 0x1c221c6d9a8781a3 }, { 0xd3205b1d29b9bbde, 0x9b4d9e4d25657ca8, 0x5ae5a0693535163c, 0x0db04cb00af20ed3 }},
+        {{ 0xd142b136f94d3838, 0x65e56fe365124bfd, 0xa22a2daaf7518a9f, 0x1e1de27ad6c67460 }, { 0x0c15bfecd827ef91, 0x0cb406c5cb606b77, 0xa6b4eca67b685529, 0x178b741c55b1a43b }},
+        {{ 0x9ba55eb89e79ab64, 0x56dafb8ddfcea570, 0x488fbca8dc758375, 0x3ad13e034c26808b }, { 0x53da7535a8854b63, 0xafbb624b3aa73759, 0xe05c0c969f8cc565, 0x01c8f2d93d24e661 }},
+        {{ 0xff61b5593a25e2b4, 0x98e8f1cc5db62f39, 0xac89bc24de2839c3, 0x00311c5382f6741c }, { 0xd60bc25560d740b2, 0xb11c385e13568684, 0x29fa527f81d354e6, 0x0119b581d78ee577 }},
+        {{ 0x46c3af257c295ffc, 0x24e6cfb447124a2d, 0xe4fdb3d9a6a007d7, 0x24bda29c95b89b12 }, { 0x5c3cbfadca3824ce, 0x213ea5b7151b1950, 0x87a07a4123f95345, 0x03162333d8e9b4d1 }},
+        {{ 0xfff3e4590ca255e9, 0xd8f7721950bdf5ae, 0x24809d5ad8252a4d, 0x0ac8bbdeb6f90b14 }, { 0x5d637a2abcb917d4, 0x7c1c5086c691cffa, 0x4a5fb0187def0e07, 0x035d71f9cd8ba72a }},
+        {{ 0x2431c790ccf0288f, 0xe2515b5975d0201e, 0xa162728ee74d0bf8, 0x0f0eb93cfb945b38 }, { 0xf89fbc632d9182ad, 0xea92b9bd87630dc6, 0x5cff752f8110c1dc, 0x07d1323b96e129bc }},
+        {{ 0x4d7e68770c61dc1b, 0xd1b92e5a348297b4, 0x9b4b3985cc5d2aaf, 0x2915daf416f3578e }, { 0x6ad35de1a7cfc3c9, 0x7bf0694a1c84fbc1, 0x7b66dd07bc664dbe, 0x3718f433730cd253 }},
+        {{ 0x9d3f3072eafcb79d, 0x72ff9dea6548ca09, 0xda45fc493e1c08d2, 0x333447983b0a015b }, { 0xfd5c5545e2708e25, 0x7dba3abfe76d5dac, 0xbee1ffdc150b00e8, 0x27193cc247a9d6fa }},
+        {{ 0xf3a149142bdee4b0, 0xc4c0025115fd0aea, 0xdac1ee507765c821, 0x36663488c17a8ed4 }, { 0x1ab986f2f25e4be3, 0x2c00b817dfb8f1f6, 0x6867e122e28d5a4f, 0x39ee9b2660a12980 }},
+        {{ 0xa09ddd8f948ef2a1, 0xaa95498509441f7e, 0x19d7bd0ac4f7694b, 0x16f4fad140c4ba8b }, { 0x3a0613b3ea0056d3, 0x1b025ff6f768100f, 0xf7392aae40369a13, 0x3679019f40448fe7 }},
+        {{ 0x33e9a602e7546e09, 0x6a2d1e0cc3eb098f, 0xf3020ae9cd698cce, 0x1a328fcd19b4df57 }, { 0x536482615e4a1835, 0x445098ec5f93b4f9, 0xd82b16be841263cf, 0x05a03877106ab1b2 }},
+        {{ 0xb6ac783b504c006c, 0x91c96f34570d5267, 0xccdf304b15ebee14, 0x0df69b454c135b3d }, { 0xf2acc4214930bb03, 0x70f09b7b00eb4a79, 0x60ef7679c012ffd5, 0x1fa6cac23fc56d2d }},
+        {{ 0x8978f315a6c62fa7, 0xbd7bc2b17806760b, 0xc004df8ab1f482e2, 0x286e4af5b9a4c2e2 }, { 0xb3071d27937d60e7, 0x750d22c57a0913be, 0xef2457f26ee220aa, 0x277cd029ff05e774 }},
+        {{ 0x2d153758af57dc1c, 0x8b33c375e22f037c, 0xe642446b985a6ac5, 0x2107843ebee2a98b }, { 0x13c4b4da9eefdf5d, 0xe31fa658143a7279, 0xe87a64e60db1e3e4, 0x00eb68874077efd4 }},
+        {{ 0xc501b57c126255de, 0x08a178ee683d7e61, 0x462b99e0bfff442d, 0x22b6269f89b443d2 }, { 0x959323f7afdbf105, 0x41c2588434e71967, 0x6dafe91941708ed1, 0x0a3c0c4987aab9ff }},
+        {{ 0x90fa243dfd2b8339, 0x3201a29d14f91318, 0x78244eaa00e06ba1, 0x23109ee50bfeafdc }, { 0x99161c2ac1473a2a, 0xd31a8fdb6d7172a8, 0x6a665ffa9b52e956, 0x003c4e30806e164c }},
+        {{ 0xb6ce52049da522a3, 0xcc96dfeb29f0b07d, 0x32862bda690b60b2, 0x2abcaf0c754e7ce8 }, { 0x536f8518596bba4f, 0xe838193850e0b5f1, 0xfb064c2cd8392cf9, 0x2a858a321777380f }},
+        {{ 0xff08b4946a4d7f4d, 0xab38cf15c60436dc, 0x6dad516f5c4dc3ad, 0x2da176d765e968a7 }, { 0xce80913c22972d97, 0x1bca1d14cb5a7f96, 0xd212f8e39ff94dfe, 0x15d221a4409be2d0 }},
+        {{ 0x97a9c1302c8fe296, 0x5ce53ccb65b60eef, 0x1b34324bc2c4aa9d, 0x238ba23be555f26b }, { 0xa78d6ea162aa7b55, 0x5b3a66da1b3442da, 0xf061d2b8882041ed, 0x3669c5c0314bf5ce }},
+        {{ 0x51abe5f5b19ed91d, 0x45ee6b1a25484043, 0x65661a0518287db2, 0x0b6b0eae1c3a47c9 }, { 0x15d0b6705de0ffee, 0x246b8b076936fdbd, 0x4c7d02eec0cba272, 0x03662524eb22abf6 }},
+        {{ 0x3988132b857e7dde, 0x77c9797ec9f5de13, 0xf8f994fa995472bd, 0x1654a6337a552f52 }, { 0xf197328c40fbd82e, 0x8d082853dd52fac0, 0x1556b509b1a0ae83, 0x379383bcae7c4f2d }},
+        {{ 0x06b9fe2f51a7f50e, 0x288fea8fb454d5eb, 0x61501642e1b9f243, 0x2ffb582f46364e92 }, { 0xac9a4f6a8ec657ea, 0x7eb2d151c9105186, 0x1e48df5912222301, 0x3e1be258da98174b }},
+        {{ 0x2fadccc191b647bc, 0xe8d7353779473c9c, 0x3d8791306e9132a0, 0x32d55d8f97561c9c }, { 0x223efd02b652ff01, 0x71f42d1c819499e7, 0xbb2f3f6cc1297078, 0x2d9d17828dd4c571 }},
+        {{ 0xa35e75a7d3f42c9d, 0xde4733093b211be2, 0x1420e5ec062cd65c, 0x3e95a5d9dee3887e }, { 0x51ce901adb296ca8, 0xa8f1a791c0b7e1d5, 0xdd4a79e22590d5c7, 0x3f631a7fc921f5c7 }},
+        {{ 0x0cf637ce0dc7069b, 0x472d7b1ea9407025, 0x5c50dfa65303f6aa, 0x13a7c2ff17a2301d }, { 0xf45a9db6f01a0f1d, 0x7e0be6ca7ce9aebd, 0x77f4b29895b8be82, 0x2772e6afbb047f40 }},
+        {{ 0xe5ab37a81290b2a0, 0xc223b23b93f4a295, 0x7ae3472b5489e864, 0x0b570557ff9b077b }, { 0x68d2e84004505b3b, 0x01756111bafec9a2, 0xac1f534b1cf51f85, 0x26653da92b187d2b }},
+        {{ 0xc6628334c3493176, 0xce57e0c9b517dae6, 0xd5350a85c8156714, 0x1fdaaaeff8682713 }, { 0x6499edf9b021387b, 0x02789d82944467a7, 0xc8fcff77533552ae, 0x08c269f6f5e54738 }},
+        {{ 0x2befc13fdf7bfa68, 0xa007ab4d5a79ea3c, 0x26e7954ec85a8b93, 0x0095dc11c5ae5f8f }, { 0x6d6de4080591c778, 0x69923e48f932b67c, 0xfd204f49b26ac07b, 0x2f8fc6be5bc42f4e }},
+        {{ 0xe01b05cb637b7d84, 0x3664ce76e3bb398a, 0x182ab01ecb8e76fe, 0x2110c2e92b87a3c1 }, { 0x9e54e5d100a8eca9, 0xe896516d9c8e22c1, 0xb9017c035a8b33fa, 0x3d7e2179f309caf9 }},
+        {{ 0xeb09d464a609661a, 0x6b677363597c2d3e, 0xf7cbbb76172631d3, 0x0a1dc77402fc07fd }, { 0xdc45b9640e9862f7, 0x7d4af939c9c6e4f6, 0xfa6a3d379f62d9c6, 0x0fd66a25e62bdfec }},
+        {{ 0x212c08d0e2532554, 0xcea216f042910344, 0x803a6a30bf3adafb, 0x35f000c54df72c8d }, { 0x90df0b3a64c11f38, 0x08d99d8cc928d9f9, 0xabe109ea5a558caa, 0x0a2cb347419d6946 }},
+        {{ 0x82d3ba53748031a3, 0x512ba2115c57171a, 0x9df101d10b057f62, 0x2123b7103c74f9ab }, { 0x8f289d3dd51e0df1, 0xdbfa98b56cfaaed3, 0x6a264d13bbcee2ca, 0x3b7d44e05a0de406 }},
+        {{ 0x7bbb96e70b522d2f, 0x63c8bc209e88c1f4, 0x7bcceceae2f32a16, 0x03646bf9b3c4b460 }, { 0x8e206c1f4031366b, 0x0bea9d91453dfcbb, 0x5e59361e3471b1bd, 0x25f0ebbe713e2013 }},
+        {{ 0x4f57f8525824cc90, 0xb25eba5140d3fb6c, 0xb54fb048a67abc96, 0x1a0df16bde58ae6f }, { 0xa622a2694007fe9a, 0x514e8966ceba4385, 0x250569d780ef06f1, 0x38a6a4c3509f3956 }},
+        {{ 0x78c3a52367ff740a, 0xb4546cd29a62adef, 0x8503fb3994997056, 0x20284247f7367cac }, { 0xb88a2e6a07345c2e, 0xd786743e254ae2ff, 0x838a33c57a73c95d, 0x0ab28bccf80cb098 }},
+        {{ 0x21af0bc7b0e1f182, 0xc7a504d477385e1f, 0x5bd4deb4f4d506a4, 0x0e1428f909b926af }, { 0xa0ee450f7d6a1638, 0x849d3ca623673422, 0x463126228c240173, 0x19825bd07a645247 }},
+        {{ 0x01093808dd0953d6, 0x19c88590237e4d26, 0x3c226bf5b71fcadd, 0x2c9d3240cad29a3a }, { 0x413c453ea40a75cc, 0x29204369e04cb5d5, 0xc453857e8f46b16f, 0x334a75cbf895ee6f }},
+        {{ 0xd5ea5fc5cd8aaca6, 0xdb67780cc8b2ee98, 0x40515efde888e323, 0x23e77fcc781548c7 }, { 0xe1e0e252f0e42753, 0xf3628f9a4b1e1fbe, 0xc5aad00c05e93ef4, 0x192727f2f6ffb8d4 }},
+        {{ 0x6dd9be1d80cab5b2, 0x84d58a460afa7bcb, 0xf4a391658355a59f, 0x336aa7ab8f573ebb }, { 0x1a63b8919ccf1552, 0xe2b2ee4b3c275f07, 0xe5fb27be45e8c9ef, 0x1dd6c1907e678a20 }},
+        {{ 0x1ff850168837eefa, 0x097591876fe2c828, 0xb377b40730700317, 0x0a125ff81e08e330 }, { 0xb5949ae6282aed57, 0xb873f2421efed116, 0x1ed08e86690fcb81, 0x39d05f0bcd51c68f }},
+        {{ 0xb841ad1ad40d8719, 0x6f0d6a43c41115d4, 0x9035b1dd8b6b92f0, 0x07233545cfae3318 }, { 0x937c940ed24598aa, 0x77f6d7a7781c982d, 0xf34284fee93207eb, 0x35e9d746e2f70d7a }},
+        {{ 0x7fd57f2cdd58a133, 0x6b38483d1ec0c431, 0x44a0013ac69994ae, 0x1014930e3c6b32b5 }, { 0x904d72adc478fabf, 0xb650369b146d26c4, 0x8155c83dfdced219, 0x3df73b4407da4213 }},
+        {{ 0x26301ad71a544756, 0x8abd8b15416fb4e0, 0x6963803414438cd4, 0x3352d9890c2dd0b8 }, { 0xd10eb67c890f86b4, 0xd80eba499e42aec3, 0xb1f1a95e360829d8, 0x207f3ce3406df985 }},
+        {{ 0x61d98cd0f48f76f8, 0xf0590acd339fead2, 0x38075067c12e1216, 0x127371712c1fd4b0 }, { 0xb82353bf7ffb68c7, 0xb1b1b307eb03d4d0, 0x016bf3da4f296258, 0x3eb166b484fd774d }},
+        {{ 0x447b2d3751279b43, 0xf678169e70bf6aee, 0xb7d61cb5415cecd7, 0x380f99a1ef7aece7 }, { 0xb14c264c3102cb4d, 0x0d2647fe6c11eec3, 0x0f84cd46560ee7b2, 0x31ff0d44f1e316f8 }},
+        {{ 0x170b56087a099ad8, 0x0a4aab9533a63dd1, 0x2f2bbbaefe5b507d, 0x1c13413fed2afeae }, { 0x9e27e79e361b1035, 0x2b668f16367b95cf, 0xfbf18dfd0eb4be47, 0x35016bd9dac4bde3 }},
+        {{ 0xac37119f87277004, 0x6a8b65b05a060bc1, 0x7c3bc4d9f1f5a954, 0x35cb02151d5fb92d }, { 0x6b84fb028d74ba5b, 0x5ae60dde440381b2, 0xc21cc3c454f111cb, 0x12a979a04be1817c }},
+        {{ 0xe72dc267358a4225, 0x8ff16c90447b8c41, 0x5b8cec47776ea52a, 0x11642cf6bae4b020 }, { 0x1bf60c56f8ec1fdc, 0xd9fc9855a1159ca6, 0x57abbbfa764be6b2, 0x258b7384703eb17f }},
+        {{ 0xeebefdbbad86e452, 0xbb98ed438c9c57ec, 0x0cf1c95dfc00e9a5, 0x34d97c116d7c8683 }, { 0x456ffc64060a1c7e, 0xa222e0254152c73c, 0xf714f69f5f81978b, 0x19cfbf1e1d48d6a2 }},
+        {{ 0xf05b5ba750fb627f, 0x1bd2641bba088d4a, 0x8d8eb97326b6501c, 0x22755d718546f970 }, { 0x1cf3684ad6629864, 0x6b155fdc395ab555, 0xb769ed7edb3ea5a4, 0x3315e95b01ebadb9 }},
+        {{ 0xd96a249494aed228, 0x4f6f4704d02d3343, 0xf6d43c04cc683a6e, 0x32448e13be6dbc61 }, { 0xe02a2c6aac586449, 0xcd1c2fc5e1a55e8f, 0x716533b74ee9aa07, 0x3d24bee59f92c0d0 }},
+        {{ 0x4366d763234ba669, 0xf75be30066de14bf, 0x2605e5092c17c521, 0x170abd24e76ed905 }, { 0x5fdc7db96d179d03, 0x64a28f4e1eefd047, 0x762a42336095b35e, 0x329414b6d6166f95 }},
+        {{ 0x4d85d3a6440e8fc4, 0x1f918cec24f227bf, 0xfbb9fbf65a8c8b45, 0x2e70f6f2097df591 }, { 0xf7c285456cbafa27, 0x74f0e3ceb0928fb9, 0x4e142b73b19f0af1, 0x1385fe3768ead1d7 }},
+        {{ 0x4386ba3495501e0c, 0x2b05e5cfbd749e12, 0x251a04addc1737c5, 0x0e735844e9b5a347 }, { 0x7ff0af1e1a4c6941, 0xdfae632abd29b9ce, 0xf90290779b5b745a, 0x1248647c05237412 }},
+        {{ 0xe3acb9480c3002bb, 0x1e281a16f9a65471, 0xc97b56f7662750ff, 0x30c08c22074ed3b9 }, { 0x7aba1d372cadf326, 0x28554508f367600d, 0x73602906e3b2c34b, 0x21e350f34d89ae9b }},
+        {{ 0x3f698a10e225960d, 0x639e1caf0f0ab459, 0x8187e20f7be6917f, 0x38a56c5d75bb881d }, { 0xbc1e535c3a18bb3c, 0x8c4297d4cc682ce8, 0x2d1047b6967f0fdc, 0x32bb4fdd6c2fdf73 }},
+        {{ 0xcc44ade303f4cbd1, 0x7eba59d74be4f5b7, 0xe02427ce7115e54a, 0x3f5cdc728fdd32bb }, { 0x359fa70d99dd4bd0, 0x17d8d5b4c69cc7ee, 0x022d0b5b01d5d23a, 0x2feff60b802551fb }},
+        {{ 0xb147f7371b625a85, 0xce3002b059eb697e, 0x4043743f1364cfcd, 0x1b753a953739bd78 }, { 0x28269920f2ab3cc8, 0xe38dff6e9fdf0bb3, 0xe7b3fe004d36f99a, 0x1ce51e670edd032a }},
+        {{ 0x3ebc22b40fef49bf, 0xf8bf4247cb6760bd, 0x058469dd93070b8f, 0x2e9be20d7a6a73de }, { 0x426872faa76935bb, 0x733fdba4f0b94be8, 0x028a93ea769019ce, 0x190403fbe3c34ea9 }},
+        {{ 0x0e597a92e0bfa660, 0xa54224c4bf693f10, 0xc3d22990ebe7607a, 0x2ce4f09f4f9de1be }, { 0x5a5d3e4f83f40f49, 0x7755911dc1d95756, 0x0a71d03ae6aee82f, 0x215350b86a745728 }},
+        {{ 0x57c2aca06ce9d182, 0x307ec08988619d51, 0xc5296ce9de79712a, 0x13d38d84c9cbe7ac }, { 0x6ddaee1f651944a9, 0x9a1483bfc1640bfc, 0x26130fbd03a99244, 0x0758830f8c275e8c }},
+        {{ 0x2d0b028fb1a0a9d4, 0x3b84594a454bcd57, 0x892177a053610363, 0x1e277f216a7d87aa }, { 0x64c08e21690c0a55, 0xa67816b4e3622bc7, 0x7091b4c15626aed6, 0x073d8a85a2cf96ef }},
+        {{ 0xead7115d06833286, 0x424388c0593a138a, 0xb84f6905c97ee438, 0x2331e0f7e58b57e4 }, { 0xb954efe6144ae989, 0xbe183e39b10e40f8, 0x3f16cef4f7efbffa, 0x2c9a4031036d0c6b }},
+        {{ 0xe5a18546aeba7b16, 0x6bf637c294e73845, 0xec2ecdd51abfb7b3, 0x1125146159957670 }, { 0x6f641f594621a32e, 0xd0686c94d3ce5709, 0x8275546f6c66b398, 0x2157a3e0eca03807 }},
+        {{ 0xbe2dfca50d579dbb, 0x6da5472754e5d61f, 0xf37141e86ddd7a83, 0x17d9d25ce218e9f6 }, { 0xa9bbf2f6070bfc1c, 0x0ef8286b44716345, 0x19f9d3a200adca96, 0x147dc1b1f38251fc }},
+        {{ 0x4c9b94eba2214e99, 0x32912add20951032, 0x89d32967a47689ca, 0x1237d3779117a99d }, { 0xdf578ffa6db2720b, 0xf90ff786756e8cb4, 0xcb8d3a08b2ed52eb, 0x1cc931b17968a377 }},
+        {{ 0xd599bca1f21287a9, 0x91e62087389b7847, 0x2bd017d8fa98b1fd, 0x039601f6d1d0dcd0 }, { 0xf83a394e34edd4e6, 0xbd3e154985b84749, 0xbc7c51193b319f6e, 0x289dda18c161e756 }},
+        {{ 0xf3e6dedf16fff8fb, 0xf2f1a6093396eaf3, 0x25d9e8a0f164f591, 0x3a027de9d9c04271 }, { 0x762c46a2bb5916a7, 0x82119491e188c7c0, 0x481909c68223d534, 0x2305cfab233739bc }},
+        {{ 0xacb7aa9820043a51, 0xe1334a102270a378, 0x5d25177164a3d54a, 0x29bfa2638820650d }, { 0x19f713f98f567497, 0x7d4fb661b876ceff, 0x0d6f11ad212e1d85, 0x0013e797b7fc6cab }},
+        {{ 0xed6c76d3db39a166, 0x464738a6a484a712, 0x8bdc8bc7f6dead9a, 0x101d1cebd9cbd643 }, { 0x8550ca06ede2a1f1, 0x2de4856d81c0fa22, 0x808c772cf76577fd, 0x00e0adf131628404 }},
+        {{ 0x3409840ebeb8c6c0, 0xbe93bc4f0d96b3fb, 0xe88172af82820ee2, 0x29523423653d4493 }, { 0x2567df211156eeae, 0x944a48e2b2de5306, 0x24709e470ba28c40, 0x358b7663949e3778 }},
+        {{ 0x570be317566040f8, 0xf41102cf9c7c8c41, 0xbc269aad8987865d, 0x35ebcdef658b98bb }, { 0xa43fdcec0a1095e7, 0x8c976c69b09f8d42, 0xb1b95cc3924e10ed, 0x07c62a0834996a5e }},
+        {{ 0x2ccad3a9b7e64d36, 0xd193cede7597c951, 0xb53b5d6a3216220d, 0x3b32f2ad5c29fac9 }, { 0x85fbd88a796a5620, 0x60179cbbd0d35d0f, 0x986f997e3888907b, 0x1f8353ade423ad52 }},
+        {{ 0x5e259abe60be9b9a, 0xc969ee2382d66395, 0xe71843781d744a59, 0x38efbe70724ba22c }, { 0xa715dedb1faf1ea7, 0xd8d281a623014b73, 0x3a54e051cfcdd505, 0x3b1c3bcfcf7720a3 }},
+        {{ 0xeed35c89b3430bf3, 0x0d1395c0b498518d, 0x208f4cf4cd738170, 0x03c45f05ac03d5a7 }, { 0x27d049d5fec67b22, 0xe32ac329f5573ef1, 0x1e16e984378c3cb9, 0x0c78255247fa9132 }},
+        {{ 0x0967838f49253eb6, 0x511f2a0b31341f43, 0x93a75f27e2b0eb1b, 0x3a86d5fd0d190862 }, { 0xa980f835def9f42d, 0x5a0ecfbca197f517, 0x412fe6ff33961def, 0x1bb866e9af046785 }},
+        {{ 0xc73b5c0e990000a4, 0xeec94f710b8c7820, 0x6c6064d61f97a29f, 0x205a63e1a1b3fac7 }, { 0xd4f5f13acf3cb61f, 0x029262fce4a31fc8, 0x47de8a7a932137c0, 0x398f2bfb002ff3a9 }},
+        {{ 0x351d384f505d7bc2, 0xf32e772f4b2fd44a, 0xb8e7d2c26d37240d, 0x29d84019e13db226 }, { 0x1e00e72bf962eb36, 0xffde287424bb91aa, 0x9d6f547e05bba813, 0x1e4627d79d953efb }},
+        {{ 0xe2913f0ae362317a, 0x6c81dbd1d1e2d908, 0xf027fdf6ee749202, 0x295744bab6519df5 }, { 0xd02cd597439edeb7, 0xe06f704842041ca0, 0x24eab1b241290284, 0x3bb78f74d7bb3265 }},
+        {{ 0x0cc44d0625dcc47b, 0x9323d50796b0ba14, 0x001ce61a0131d34b, 0x397cfc9e75225200 }, { 0xdbb0236c8a6712f4, 0x2b752e5af422d65d, 0x2716a6651c22d2d4, 0x092a46e05421995c }},
+        {{ 0x35147b0c6439cd02, 0x90aea7005e477beb, 0xe9bc66471e60c310, 0x31425ac1665d4e22 }, { 0x98ff3581e0e73fa4, 0x79908cf570493f8e, 0xf925354352c6c5b8, 0x23689301674c21da }},
+        {{ 0x4bd3c590295f0743, 0x521e595bffbf55f1, 0x53ad28366be6a428, 0x2676f401e3b23a94 }, { 0xe45f9de79a017598, 0xdfded7aef6dcfe20, 0x4d3c249452b36e4e, 0x257cb9ecf2215187 }},
+        {{ 0x3830381da903e34e, 0x4e02c9ca9838d40e, 0xac42cbb2c6bdc20b, 0x27acac919b930a7c }, { 0xbf1dc80b0db72206, 0x6e05f8b6275f17fa, 0x10c1577550f88297, 0x2661e7662491b9fa }},
+        {{ 0xc0909be52f497634, 0x0599fb48879b42d3, 0xd3ee21d0d941aa2c, 0x12f7fb53d8cf6129 }, { 0x0bebcf6e70b361d8, 0xcec809353571d738, 0x76f3b17d3f120577, 0x16a7e3874b3d908e }},
+        {{ 0x7a5d9447aae249c7, 0x623a3a1a311b59b6, 0xfec9b31553c86e74, 0x30618d8241eb7ba5 }, { 0x210d171ad9c08b35, 0xf7c277bdd3a61b32, 0x3bcf49fcb3c58b86, 0x3627042f42701e78 }},
+        {{ 0xc13374b19ba5a724, 0xe810fdd69125648f, 0xa7c34e8190056ef1, 0x0a9ff31e009ad6e1 }, { 0xe552cadf68b1cd26, 0xfbe57fb6c5bb3dd2, 0x9cfce763a24376ec, 0x25c7a814b29bb2ec }},
+        {{ 0x7f6fd05c5c04b3ff, 0x4efc0fff6360eb2d, 0x134787cb71e13c4b, 0x05d287c7f01324db }, { 0x88c207b5d32d4233, 0x54d31ce41dcc561f, 0x1194b65e2903b677, 0x13d1c75718ed1721 }},
+        {{ 0x925aea0772f68f40, 0x51231847fed06ca8, 0x172b11c3de4ea10a, 0x0ae15347c50e9e13 }, { 0x96bb03a1f4844c47, 0x4512a6de5cfc67dc, 0x202fad9e0da7f4af, 0x393d1e749e26d368 }},
+        {{ 0xb00225f0921ee535, 0x966fe92cd8813a6a, 0x97f52e1e72f0be61, 0x277420eed31100d4 }, { 0xd3cbe4765fe68712, 0xc4b08fdd88ac0c3c, 0x44285bc70f7da3e7, 0x23d68392b8659537 }},
+        {{ 0x0c3ad7ac397daa23, 0xf40cec1464c50419, 0x86fec79caa0f8a90, 0x0cdf3303c2e01f3b }, { 0xcc4db38566cd3181, 0xde9a8e85c09b0974, 0x9e1da03e08b74110, 0x0f6b3857f38c0a27 }},
+        {{ 0xfeeacfed1799f01e, 0x297aceb25cd87ac1, 0x0ef1e64f26e516da, 0x14783da390bcee58 }, { 0x284ea6416162882f, 0x4ba4718874c036c8, 0x5250f670b378093a, 0x0970a0f0d1888787 }},
+        {{ 0x03173758b764f44d, 0xdfd7ce6c51d57bf7, 0xe68548a427d0c92d, 0x383a8a12a4596e8a }, { 0x3825497aea534314, 0xe59c6fc34cd7b996, 0x0edd6c6e39c207e1, 0x25c4e61a875620b7 }},
+        {{ 0x47163f442bb4d388, 0x94fca070c4b11d6f, 0x66df2a7b99de9a4c, 0x230a376abdc813f9 }, { 0x3e5e3d709e01095b, 0x2c73ce376404d212, 0xe13648401f96ad0f, 0x32f664bdb79c66b7 }},
+        {{ 0x4060fe8c7435a27d, 0x2c8286d8862eef72, 0x1fd6661e942115bd, 0x227a60c1c6cfc3ce }, { 0x2459321a911670cc, 0x95e7984a5b7bf9fb, 0x3e6dda6a8536868d, 0x2615e6cd8a7b869e }},
+        {{ 0x05a789032352e943, 0x5440efa6ca8ec337, 0x2af98ec375ca9ef4, 0x1cb03964d0460c65 }, { 0x1f15263e4eaac57f, 0x620433eb7604ec0f, 0xf644c09d74c88cab, 0x3ab371c974c488a4 }},
+        {{ 0x8201c92bda5c8ef1, 0xcb359c3f21d81863, 0x6f593579297ebe8b, 0x14b3796fbe530315 }, { 0x3d7478378b2e1e06, 0xcae5eda80bbf9f2e, 0x5e2ff90541b0966a, 0x1f331ebe88e748a7 }},
+        {{ 0xb0522821d8b788d4, 0xa168e04e6d1359e1, 0x3ddc3ba1925a4adb, 0x22f249b5ec54482e }, { 0x48ee3e0735b3669c, 0xc8b5dea07c8e450d, 0x9339010bf236536c, 0x3aebb4ce51ee4e53 }},
+        {{ 0x7ab9b35b3e014663, 0x2e19c9fc0ac1abab, 0x036150a9687f8697, 0x29ef7a2df1238610 }, { 0x0a4d7651e7a36f1d, 0x7274d7334023baa6, 0x79115b3531b86536, 0x30d5f9df5e0d2be1 }},
+        {{ 0x2eed506491565c14, 0x181300c60d1c384a, 0x49ca2c7720a36217, 0x01edc9106fa1d641 }, { 0xec5d57def676e7e1, 0xa3dccdee6a262dfa, 0xe7275f87b239781d, 0x37b3b612a9e2a390 }},
+        {{ 0x9be12dfaf8c054ed, 0x9b53199a6c8bd968, 0xb3f09fa4260df630, 0x284ae5922cb3dcfc }, { 0x3c497688764ae985, 0xc4514163f3cdbcba, 0xa231134f5658affe, 0x3ca1413988125716 }},
+        {{ 0xf300c613dbcd5a78, 0x0b8d9139db8ccaad, 0xddcaa093f7cbb31c, 0x16decd989ccfb6a2 }, { 0x86c320e4f58c4cd5, 0x7ca237c1dcd99bdb, 0x8ec0fe9b256c0f3a, 0x3dcdfc60d58b524a }},
+        {{ 0x1a0dd21bdf74fba8, 0x847e23749e43405b, 0x916ab49b3cc2c7c3, 0x07bf37b52cb399e6 }, { 0x594e10d9c3e259c5, 0x32a56390e1d0a635, 0xabab8e5f016caad9, 0x128d3591036c7aad }},
+        {{ 0x34de55886a996613, 0xf4346310c9057614, 0xce3aca5e19de6fd0, 0x2c4df83b3ef3b3ac }, { 0x6d13efe6d7f28c0a, 0xeb8f8d5565bbb505, 0x0c6e0f0f2c31d42b, 0x0ff2066c9ca8d405 }},
+        {{ 0x6e0e4f69b52b8c50, 0x27500b274b865607, 0xace7e99caf5122a7, 0x032a3254d7a6ac1d }, { 0xb569479e7c67bef5, 0x0a9bb409d3b4147f, 0x52d02eec11bde7c8, 0x23961ac61f7c63bd }},
+        {{ 0x80b1c663ae054360, 0x3240af099b317521, 0x7f104881ca8337c3, 0x0af151c3dda35ab3 }, { 0x8a3ae976f3b97bdd, 0xcb1239710371fb1c, 0xfb42464467403884, 0x177fb124dc422724 }},
+        {{ 0x7ddb2dfb5b66cedd, 0x2e8153d27a41fcd0, 0x9522ef0867ca3433, 0x2be511881b24c00a }, { 0x3cb3c7527021fef9, 0xd7f2c72b8bee38c9, 0x3af6cb5010353093, 0x28cfff772663e76d }},
+        {{ 0x43e161ae289021e1, 0xb013854c8b4803a8, 0x5e78f72f74c077fe, 0x276d9e262101d33c }, { 0xdb0643d5370bdf3b, 0xd479df0f72bfeb4b, 0x3dc682afe337a01e, 0x0fefe503740a2db9 }},
+        {{ 0x4dbb6b2b24082484, 0x5a80b69b653ecff8, 0x421f37f4eb5b44fe, 0x07299fc4d5286946 }, { 0x11ba2953a437c611, 0x07ea2afd217f7684, 0xfbc228080da21f29, 0x17c4ae73b405128d }},
+        {{ 0xee38ddea17334944, 0x1910118f6a06eef4, 0xd9d9bfc36597f72a, 0x2cf09b435a20a338 }, { 0x55fda50aa0e6044d, 0x3e05d0db26b26b08, 0x5df6920a4bb5e07b, 0x1ef738325cb3ab5c }},
+        {{ 0xc477d82e46a80faa, 0xd5b8d1866e7eb431, 0xec921ebaffb6b767, 0x1c85870c0b2aa149 }, { 0x3b32dc88657fb370, 0x43ba32b6d168efbd, 0xce82ce03f2195136, 0x0f6391a1f3cd8d70 }},
+        {{ 0xeb0498e0f0295d8e, 0xd39dbcf4caf66c8d, 0xf5eb353794473844, 0x0bdacc4b5d375c04 }, { 0xdfd5ddd0b99c4415, 0x76412048a4e3a103, 0x508c47779438cdaf, 0x3e8902c9579c5d29 }},
+        {{ 0x1eae6816a077f51e, 0xd139f5cdb5274bac, 0x9ae0d20f6f00e8ad, 0x09a65648620319de }, { 0x2ae8c1d66bb0a933, 0xc4b8ba994ac298c2, 0x4c3c1cb7007f5ea3, 0x08e9bc6ffb49b66d }},
+        {{ 0x37a93d290fe510bd, 0x2bdce55220094fbd, 0xa9b25219b0bae81e, 0x0f6084c83c050b6b }, { 0x3b6668f3293939fd, 0xd40fdead55e47a18, 0x5444efbe597f0fbc, 0x3dd6e4bb7a37a75a }},
+        {{ 0x8d71256466a79fa5, 0xca514dde14b4033e, 0x416e2f7c22d789be, 0x043e89177d325906 }, { 0xfcc99bdfdfd25091, 0xb0b2dab90134adc3, 0x3956d7776afe9c9d, 0x0d9e22c1f1d2cbc5 }},
+        {{ 0xfbd1d925c940be0b, 0x7f5c4c28c9bc0642, 0xdbe3c100df0b2ad5, 0x2802d09cf5a69dac }, { 0x7e66a809fadc865f, 0x74c86336e31e3920, 0x1052dc517ce8510b, 0x10c6d8fbfbb6d2b0 }},
+        {{ 0xb041e1cbfc6a123f, 0x453635bbf3790429, 0xe35c177a150310ee, 0x1d79932d213fff4f }, { 0x4408ad57254254f8, 0x40a69f884d8ed46e, 0x27eb42ceac56c049, 0x348cd7c0ca364e51 }},
+        {{ 0x2b0ebed52b8aff82, 0x571441cc9b9558e1, 0x2e1d720fbad8e29a, 0x046975c797d707bd }, { 0xf8ae7dd0b2ff154b, 0xd75f6a2630f445b2, 0x4fcde7772af5bf1f, 0x233643f9042e6d4f }},
+        {{ 0xcc3956a681984ff0, 0xb2fe90eff1394d02, 0xfca7d5e69f2fa680, 0x2ce4b1b6ea919750 }, { 0x602e6d576b728ef6, 0xd9fea23473690e87, 0x4af1fdccbfbee6e7, 0x306f9f0c0ce3ddec }},
+        {{ 0xd329b1600cef5ec9, 0x59ad0d1cee4d05a7, 0x548be8fe28c077ae, 0x024a0caf75342e04 }, { 0x16e324dd5a157667, 0x6730bd35d84809ba, 0x6c4e26e67122d382, 0x27903d184b96541b }},
+        {{ 0xa01831e323e93d94, 0x4c5bd68b2a20a9de, 0x416585c229518d27, 0x183d03594f45d217 }, { 0x8a180565ab941c04, 0x2c3d1edf1a5f08c7, 0x79728c8292c87a20, 0x3dfd94b654c04888 }},
+        {{ 0x8473411edfd47cb5, 0x6e720d16f3067be6, 0x19babefbbd7d3a16, 0x31f3fa64020e4b68 }, { 0x84048c46d487f649, 0xd86b5486b3f42501, 0xeadc42677cfe9fde, 0x18f06020f19ef47d }},
+        {{ 0xb667f39f5e5280c4, 0x854fa01daf966b44, 0xa5b35f006d66bf90, 0x146b1b072d936520 }, { 0xa928d73c451006cb, 0x97ea1a2ad7864ce2, 0x3360c1ab1ca5d609, 0x2cb696900ce6b0bc }},
+        {{ 0x43d054dd1512be6a, 0x25de36c8f40c855d, 0x229b38bf0a5954b0, 0x2e541b11bb1cb134 }, { 0x0505e0510ecfcd27, 0xe3b67c6e3e707e28, 0x27a4c754dc7519d7, 0x08c02482b90a9ddd }},
+        {{ 0x4e9279df0bed7ce1, 0xcc0a29a148dc6537, 0xb304268e97f5b7ed, 0x0a4cb9f4ae43ca65 }, { 0x4b7ec1a9356f8863, 0x034518efbf7c7727, 0xf5fbad49a12f842a, 0x071bd663861569e8 }},
+        {{ 0x5e2013b8edbb7509, 0x20fad9f6d5a920ed, 0xa8b49da1ca6405e5, 0x22ced16faececea1 }, { 0x85c5cc4635569b10, 0x6997ebddef3243d4, 0x2e8d9141fee23f66, 0x01e457ca5af40740 }},
+        {{ 0xf59456a676d93879, 0xef53c6e124d5b62c, 0x2717180e5f0a007b, 0x21cc69b77966baa2 }, { 0xfb64463b0ecbeded, 0x0c541a860703dee7, 0x10ae26097d95481c, 0x124ec79fa54ebd49 }},
+        {{ 0x818d603b6c566e55, 0x258dae4effcc1eef, 0x44cf8678e3bf7cb2, 0x0d7cec9740538fd2 }, { 0x6b63707135258cec, 0xa000cb78e09b2aed, 0x04f87ff11b7864c7, 0x093a5164e46e414e }},
+        {{ 0x7db92b7a29037f29, 0x7ac703ea23c8886f, 0xdefaaea5b8a51ad2, 0x2d713d9d158b1636 }, { 0xb346f2e46f09dc14, 0x4fa9861598a5edc3, 0x4901a1f1ead09d2e, 0x37ac0a69d37dfbd9 }},
+        {{ 0xb2ed6fa7b5e370aa, 0xe61c088b6b257b13, 0xf1d40c569c5ec031, 0x29e1a979e18a98cb }, { 0xc5af9685cef14973, 0x67c090742e63e3b7, 0x9ac111c6376d3024, 0x1b9d1a96206a7973 }},
+        {{ 0x2d31b8b75377fbc3, 0x15c426f1fc44f77b, 0x5c33c3b846b38669, 0x21a94717bd94293b }, { 0x6af3cae5796a6d51, 0xb105581e1395a2c5, 0x546d5e38bc2c5951, 0x07c754407bfe94fb }},
+        {{ 0xc6b8cdf77d47b84c, 0x0b8570fb65a6b700, 0x0a26efd50a467e11, 0x2453c95a1a863555 }, { 0xc7bd046f76710279, 0x9bf6d0c247a97ab5, 0x3ff90f65d0ab5690, 0x2e59839522aa5cf9 }},
+        {{ 0x9102716ced69d1ee, 0xa70c774715117223, 0xc4c750952a93b531, 0x175deff270b5a68a }, { 0x5498908a3d1e4716, 0xeb7c353580865533, 0x12366d9f98fe9097, 0x1ce3c6a0a716afd4 }},
+        {{ 0x5a624ab321d6adea, 0xb8595c4829a1c989, 0xa39c1046c13abae4, 0x2a0fbf692441d890 }, { 0x03cb8459acd4791f, 0x25efc4695bcce9da, 0x6c0454670e903c06, 0x1191871d89b516f4 }},
+        {{ 0xfda4c77efa93ba10, 0xdf22848dd2159c90, 0x48f1302b3c5f3790, 0x1d89e3201d94b43f }, { 0x883de209d79d87a3, 0xe605f640bed6bb94, 0xad0e6c278f34d4e6, 0x12f26c5b763d170c }},
+        {{ 0x32f2df8490eb0074, 0xe8d27fcdd92d48ca, 0x9647acd557ad5193, 0x332575cd69c3d18a }, { 0x65b9e1a3ea31ff29, 0xead3d3e5dcde0524, 0x98d23e102740f3ac, 0x048e22e67e307d2e }},
+        {{ 0x4ef19b834f41cd95, 0xde11316c233232b6, 0x759b8c92fa0b32ca, 0x0ef2b14cbb6cc9ab }, { 0x5c08cb72f99c20ba, 0x9090d9985f2a7b45, 0x520173110e7cc1a1, 0x31b2e586c84943f0 }},
+        {{ 0x5584f0405f0852cb, 0x42648966d938230c, 0xf16aa615191bf372, 0x100fa4db7599c218 }, { 0xc965844629bf3bd0, 0x91aad6f74726024c, 0x55c8666d897fccd6, 0x1bec5ab62b1df0ac }},
+        {{ 0xe284314973ad59b4, 0x39510222767e1f69, 0x4e076374a6f31a13, 0x0473f98b0a03db4a }, { 0x705982bbf51bcef0, 0x3da8e8f542ee0202, 0x28b5c9fd347c9078, 0x31e67c2ddca53db1 }},
+        {{ 0x1e2e26dbf8a96d9f, 0xf7da7beb9ae4f431, 0xb378a2fbb9c081b9, 0x1356a610b1b85723 }, { 0x8abbd9ac087e3fc8, 0x82e1ed013d9e405e, 0x41dddb0f9c1e72cf, 0x11d051401bf70373 }},
+        {{ 0x808eacb6fd02899a, 0xf2c0733e96595122, 0x42a64bc45b5d0e0b, 0x399b1e429ff34def }, { 0x236146e6dab82595, 0x739c9f8bdb04f51f, 0xeadcfd2d8ad8ddbe, 0x35f9db9cee43f1f7 }},
+        {{ 0xf65ed7af5fca8af8, 0xbaef7bfe83e80d1a, 0x00c400d2babe56e0, 0x12326be49ed0e6e2 }, { 0xa04d8aabe3b028cc, 0x42a01534444997bf, 0x9dba5fbd62e0fe79, 0x18948d27cbc38eeb }},
+        {{ 0x2c30818cbdadf030, 0x7054189c38545c65, 0x1670506020ae787f, 0x0ba33ef4e417e100 }, { 0xccb9c94a1c2fc6b9, 0xf6a4e699b83664a5, 0x1c571bb33a6b5810, 0x38a9b5db4062d6c4 }},
+        {{ 0x9d3af4a0c12bce9b, 0xc1674efd7cabd503, 0xfc9dd622c0125509, 0x2c4bfe1558050066 }, { 0x398b406a6829b6e7, 0xb0d7ad3891173db1, 0xae2a18e8e40b1ad9, 0x04f188b10ac495d4 }},
+        {{ 0xc3ecb06d58068c87, 0x0502de4d71f235fa, 0x7b5731e5dc80abbb, 0x03584c06b13e061e }, { 0x4b853b2adf1732fe, 0x9e406475d6660b14, 0x91c2297ab6147863, 0x1b712fffdc9a0c04 }},
+        {{ 0x81dbec2f2b6c7de9, 0xd9ebb63788e85333, 0xee86edca6758ff3b, 0x3a4052c96637ee74 }, { 0xc94120f80ab2ad8d, 0xd0b37ff53451a060, 0x87df508caae73b57, 0x2f49f20a1181031b }},
+        {{ 0xc293c8ede7b3a73a, 0xc721e3ba50db016a, 0xe7eb94593d3cb109, 0x1345f171a24ca132 }, { 0x7dfc00ad729fb197, 0xe1ac897fab830d67, 0xe0675cc82bac562e, 0x227c54229c3d662b }},
+        {{ 0x53f257d0c61dab87, 0x98f1dfecbf1ee988, 0x6194c263859367f7, 0x1282ad8c07650054 }, { 0x1d4397f155a34a6b, 0xde553951eaa36337, 0x7f965c800138ce4b, 0x2f4d7d30d322365e }},
+        {{ 0xeafafaf7f835c527, 0x96056ac2149d478f, 0x77d3bd084306a45f, 0x27b872f460fdcdf8 }, { 0xcceea7bddd0f2f76, 0x7743d940b5edda7a, 0x15891efaece46703, 0x29c4ce368991dd68 }},
+        {{ 0xd6b66af498640ffb, 0x02c2f093dcf5b0fa, 0xb97e36cfafee7260, 0x33d1e675488208af }, { 0x9f02d404d25ebd6a, 0x5619bbb85e7d8ac4, 0xe778a1757f694fd2, 0x343c962abde1714c }},
+        {{ 0x900a974d664c9557, 0x723f47d201a7f82b, 0xb0447f3d270ff496, 0x1f7a28c84a36f0e4 }, { 0xd73a404d6165030d, 0xd9e65d749269f328, 0x831ef4655feb45ae, 0x37cd1e9f080b22b7 }},
+        {{ 0xc9a1e6503ffe4a40, 0xed8a004cca954116, 0xfd4e57cef1f9d23f, 0x00bfe0dbbea79c1d }, { 0x13b06619442a3d89, 0xdf01ad4bf6235682, 0x19918f96d756b993, 0x003fec592cc44fbf }},
+        {{ 0x2dc0298bff85ace6, 0x385605453d63ea5a, 0x1d2dc98ed3829974, 0x2db2282c37ffb767 }, { 0x1cace7acbf7be428, 0xefa0ab2adc47dc85, 0xa5dd2f2d01c9ec0c, 0x3bd33fd94397848e }},
+        {{ 0xf982a4441cff2cfd, 0x7d7716b4eceec652, 0x7f799fb35152dacb, 0x22a825cd6ab9516b }, { 0x15e0756e1da2ec27, 0xebee07f8b0fe0914, 0x5e2edbbcf8ac6578, 0x3ea49157a65cfffb }},
+        {{ 0x48c83d1a938718d4, 0xdb8e33642e8f66dc, 0x5d4a2b3267264511, 0x3bd5ccb8c17d1fc0 }, { 0x95d7be886f0706fb, 0x26bc2aed3a1f4cb4, 0xb95f0f50e55a4a19, 0x38568e084139911f }},
+        {{ 0xe532c73407adce87, 0x5a501651ad1104a8, 0x09bcc14904bf478e, 0x198951252ff1acc5 }, { 0xaac009563aa4bdb3, 0x145f81282acbfa91, 0xb0d62641ecacebaa, 0x374bc8eb1eef0d74 }},
+    },
+};
+
+#define COMB_SIGNED_BLOCKS 8
+#define COMB_SIGNED_BLOCK_BITS 4
+#define COMB_SIGNED_ENTRIES (1 << (COMB_TEETH - 1))
+
+// COMB_SIGNED_TABLE[b][i] = 2^(COMB_SPACING * (COMB_TEETH - 1) + COMB_SIGNED_BLOCK_BITS * b) * G
+//     + sum_{t < COMB_TEETH - 1} (bit t of i ? 1 : -1) * 2^(COMB_SPACING * t + COMB_SIGNED_BLOCK_BITS * b) * G
+static const Affine COMB_SIGNED_TABLE[COMB_SIGNED_BLOCKS][COMB_SIGNED_ENTRIES] = {
+    {
+        {{ 0xb7fc251c877eed82, 0x3a54955870afb176, 0x21b22a99dc7923ff, 0x351969bc04ecfd7a }, { 0xac3dadd11028ec3b, 0x85fdf796f5599f25, 0xf0099fabea9b10e1, 0x1eee5177a94d2cfc }},
+        {{ 0x37b0d7d865b55371, 0xdac81b95f55025d7, 0xbf3ef3f73efbdca1, 0x2b5179216b816c44 }, { 0x87e8f6219b932500, 0x83210b090e9bef98, 0x92960971160fca4f, 0x24421a73879b0c23 }},
+        {{ 0xec4b6becc0d27ff0, 0x527a15cd080f8b90, 0x378d9168e03f9fef, 0x3b8708817607ec18 }, { 0xc80d59a251e74054, 0x67fd0c96be121436, 0xd7d9ffee0542f57c, 0x05380dc2bf15d8bc }},
+        {{ 0x7bc77941d8a2d130, 0x4ff0372101b79207, 0x1a24a137beaf6651, 0x20e5c1988ac32282 }, { 0xd5979849e609a879, 0x3a6a36bab7c1c65f, 0x70be1c8a1462c8ed, 0x2dc47c71f1f9309d }},
+        {{ 0x2206b2a553edff92, 0x7129016f05faf9bf, 0x513ba0a39b0bfeec, 0x3f90c11d56e15fcf }, { 0x9599f4c685c14fb9, 0xa892f9ed4fdba8f9, 0xd91f39812252f85d, 0x22d5b90e147522bc }},
+        {{ 0xe3cc3ebc37a95766, 0x21b836f2a171568b, 0xf28a6e7d666032d3, 0x3bdcf3a8b475f964 }, { 0x4e6cb6c47054a009, 0x140273fe23102f68, 0x44ee427bc6402636, 0x3f91d62a0aabe747 }},
+        {{ 0x04365d355970b73c, 0x4c0d58b1630466ea, 0xc5fedad519920a18, 0x03e4446f4b3e38ea }, { 0x8b729e2620bfa07e, 0x1c726a238993e8ec, 0xc76a7f7ec97015c7, 0x387f9b6556e0e9df }},
+        {{ 0xc02185e811f7cead, 0x80c11404bb229c42, 0x345efbdede020790, 0x2556376a770b1d86 }, { 0xaeb3aa8ce2da6b4b, 0x9b75b5cb9369ee75, 0x6cfd885aff9d41bd, 0x18c7a0d3be461809 }},
+        {{ 0x7ffd9f01b6e6bcf6, 0xaeeb205341d7431e, 0x581533388e501969, 0x20e94924847a3533 }, { 0x19b9e1dd5d4ad65a, 0xfb108e88d1a0b7a8, 0x47f60544ff6a96c6, 0x15db1a7e66b19845 }},
+        {{ 0x36df74fd65856aed, 0xbb779cb448808ffd, 0xfe9e83416c4553d1, 0x383f6886831d1267 }, { 0xe1a0634109931112, 0x4e5bb9a2f7e8fc22, 0xef34bbb89d8c1b07, 0x1f553fcf229003ed }},
+        {{ 0x9f716dc646f33729, 0x8694d4f20bae576b, 0x40efc4ab4b8dac53, 0x138fd87ba84a0d61 }, { 0x7413ae78d4623e15, 0xaad6a5f249e916e0, 0x151f06b5c4e4f425, 0x169eae5854e01fd2 }},
+        {{ 0xd22bd6e3d51591e1, 0x22253e0b917c80bc, 0xb3b45a14abe36645, 0x33c78e9528ace6eb }, { 0x628b0b23bb6dc99e, 0x8099029a78fcfdf7, 0x6f47882bd354fc4e, 0x2fefbfff764342ad }},
+        {{ 0x03826b8a42f067b6, 0x9a74ab4cb26f2812, 0xd844cea59e5f8649, 0x288a3518b69ebd60 }, { 0xf8abd02a8b990485, 0x4bf35e56e66a968c, 0xb2a48723da22b9a2, 0x3edf324911bb8654 }},
+        {{ 0x190797cc1bf06eab, 0xec32fecaa1fae413, 0xac1f94c820ad42e2, 0x0ca036b92dbadbe0 }, { 0x49f354174d8fcaad, 0x7f567362b818bbe8, 0x838d0d281c696f27, 0x275a76d31a94d085 }},
+        {{ 0xd78418b17db377af, 0xddc917116eb9ee0c, 0x9ec350a11451045b, 0x122ea7b6760b91da }, { 0x595636e4187305d8, 0xfeb0c111f3c1dfe5, 0xa3b3104a354f97c8, 0x0e63a52e7c1df4cd }},
+        {{ 0x4e70f7116ec86814, 0x91a23e1902874bb9, 0xca52f7cac876255f, 0x39caa399a93b0bec }, { 0x549cc126e478ed37, 0x878c61169add9654, 0xc5c7e765c3aaf452, 0x086e83d6ba070bf5 }},
+        {{ 0xb5f8748d278c7fb7, 0xe5bdbdff680c2006, 0x5d0647e99683422b, 0x101d91b5ee778b87 }, { 0xff51e21e2aec0f74, 0xcd642d267514aa0d, 0x8415658b6d02b875, 0x1c80ecb8d7d08f8d }},
+        {{ 0xf550019458f9800c, 0x4c113ff451e55cbc, 0x446c9209428b3d9f, 0x219b5fa8cb934594 }, { 0xb5705747cd5ea3aa, 0xed8e29b75e7a28d1, 0x9900c6d07df5c0c6, 0x114b63a8db149902 }},
+        {{ 0x832dea845e14fde6, 0x27791841cf0cab7e, 0xb36258fe051da0af, 0x12e25e4eb56f399f }, { 0xd4c9cec487cd245e, 0xd58f0f629d1fab0b, 0xe7e5955ba0076d0d, 0x16dbc2c2f4f9e50f }},
+        {{ 0xd424c8019177fa58, 0x0218d3c36dd68284, 0xaed2f8a488a8e68f, 0x120e3d5445d19e82 }, { 0x4eae8b13e5ca452d, 0x310a698a847398ce, 0xf085b6f501c0a691, 0x149e80c6c5393b8e }},
+        {{ 0x422ae468d153c3d2, 0xbc4009e559c71716, 0x6d2070b565c3b7b7, 0x2bf355386eb9b627 }, { 0x1bad5da958edb468, 0xfbf162294d9b0c50, 0xeb45258d2ef7c6b5, 0x3c61e3890019b3f4 }},
+        {{ 0x97c9ffb2a8a0dcea, 0x91e9cab032fd9334, 0x1c0576e298b46500, 0x3456eb43a4b92079 }, { 0xb47f7e167593a9cb, 0x9853e61cb6262b3b, 0xeacb63bf7976d408, 0x3c10422f5d50b0b7 }},
+        {{ 0xa9f8a022c57331e0, 0xd398c81b55e63072, 0x7d043658ffae0362, 0x3700de6c6b39434d }, { 0xe209e114b8fe4fc1, 0xed9269d7f97d0287, 0x8516b9158bec6969, 0x1b62a9e4eb31a7aa }},
+        {{ 0xf00aab65a5aaabfd, 0xae0a1b907484673b, 0xaa461f68824da56d, 0x0b91e2108f9b03e5 }, { 0x9afa8f7507299242, 0x134702f3459c35c2, 0xa1e07cfc91ad6ee0, 0x1f6581812cbf7f6e }},
+        {{ 0x6c9cebdfda0d7318, 0xde11aa05c44225b3, 0x333967ab97807a12, 0x2f61daba5667f665 }, { 0x74da516010b2cf9f, 0xf2f5d5dcab2210e5, 0xdf681bf23911bdab, 0x2f10d5345b0da918 }},
+        {{ 0x20e26850221f8bf4, 0x2b4d602897a39749, 0x8a68cda70bdc9b37, 0x308ab116896b53c3 }, { 0xde33a64edf9783ef, 0xb98b1c6ae5bd9f66, 0x45e332d7b797d30b, 0x0140275255750611 }},
+        {{ 0x34b0162c1e4d575f, 0xabb6f4d2bc55c1c3, 0xf3b38bc6b204d514, 0x3c579a930f201434 }, { 0xd9caec069dd2dd9f, 0xa7dfa4a106747f9c, 0xb48ddb85caeb4dc2, 0x26d10018ff33dfa2 }},
+        {{ 0x4f225f36147f453e, 0x40a979f982d5b0d6, 0x8d98352b112ff37a, 0x2b82bd0f729141d9 }, { 0xfa918b831de88cff, 0x900f3710f8b02426, 0xef20a0b27cc9b75b, 0x07844aec83a0917c }},
+        {{ 0xced34600834b369b, 0x4beb5b20c99f1052, 0x1c45bc0d479d8950, 0x24fbfc1cf3db6454 }, { 0x08140882c3171878, 0x15b3344dd1a2a5af, 0x22929406805c001e, 0x3ff4831ce4a06aaa }},
+        {{ 0xd8dce20f00b38b48, 0xe90fba3235a97a9e, 0x321057fe87f5d310, 0x34f52e883642845c }, { 0x86166934a9ead5d1, 0x02aa7f9bd0096996, 0xfee27a83adba32c1, 0x2c81e22f3475602c }},
+        {{ 0x25cee16784ab1a2e, 0x93d350962a63ab06, 0xf20b72b16d0c7805, 0x34ecd804bb30fc39 }, { 0x546791ec8ff7db01, 0x4562818917e0e99a, 0x9a90d146ff25057e, 0x1f3dae8ab5eafda9 }},
+        {{ 0x844dd2ab5d97d638, 0x10d6c6e83538afb6, 0x5c01564d97429ef5, 0x2c9a79b1fb1cd227 }, { 0xff16fc477747ab0b, 0x4bdf16bfefbb8e92, 0x9765276da6ccd579, 0x05deea76d057be2d }},
+        {{ 0x81f61a419ef8928d, 0x7a56f52c6966cc25, 0xd49abac642209587, 0x15aa02a1d3514a8a }, { 0x7a278ef0fb9e9ad2, 0x923a20b855e6d6b1, 0x93b67f40fbb2353c, 0x07b4ed42376b1452 }},
+        {{ 0xdb1970a7d7bd7894, 0x26b4ff1b4328fcfe, 0xf9382c430016307d, 0x0db4fabd3cdfa0cd }, { 0xaa93d6a9a01738b0, 0x261d425e0335d1f5, 0x28ed216d7c4fbcbf, 0x3a4eadd341805e86 }},
+        {{ 0xe887fab6e0bf16ca, 0x46e65a86af4bfa52, 0xd162ee788a80f582, 0x2422544c2058e533 }, { 0x1d556d1adc31964f, 0x61b53a4a8a23706e, 0x58b7ed950c3c6825, 0x1913d27e9af29a8f }},
+        {{ 0x9f78294265b2ff2c, 0x28584203a7d81ed3, 0x10d3b965670622de, 0x37f19f3f3fd09750 }, { 0x9b16de468e4dada7, 0x8d072a6077b4f431, 0x65b75feb2166d0c3, 0x150b0c1024fedca9 }},
+        {{ 0xc9d231d19a02781d, 0x7a595e13cc735c44, 0x53e2627efa1631f9, 0x1ef0bf2d893bb1ce }, { 0x3c45b71db06bed43, 0x6ceeedaf2848df81, 0x8f0a3b58b670f61e, 0x040048be73a01508 }},
+        {{ 0xf8d67973e6c188f8, 0x3e50d96db3abe57a, 0x02a5bbf019b8305a, 0x25ee94ecd0f98321 }, { 0x4d284e2e1789bee0, 0x4b3b8d98a9ac46f5, 0xb5d9edcf8caa1eed, 0x31aa9c124d64e04b }},
+        {{ 0x8d7dce16fd152f2c, 0xfe13543835fad302, 0x7829753e3debb108, 0x2dbf488c30b011a3 }, { 0x4c4ce79f0c8f510d, 0x30f2ce41df8c6476, 0x37c2f5277c94b1d3, 0x2c018c6ce464cefe }},
+        {{ 0x381b732edba948ed, 0x453d3ab02fd519e0, 0xcea697793460a459, 0x3464818485354de4 }, { 0x3a525c00e8586476, 0x649adefd3989820e, 0x30b4a3831847395a, 0x221da01b05a44a1d }},
+        {{ 0x82d9e828eaa8a042, 0xe35958110e269f5e, 0x2d5b0f2b814475a2, 0x2b1ccaef495be233 }, { 0xfc62d2db119d169f, 0x40eeaca545897ee1, 0x5daec102e20e978d, 0x3284e4192a4b0a47 }},
+        {{ 0x7171a668e501599e, 0x8bd04e55f5469f11, 0x37fea18d658027c0, 0x20839ae36f08eee4 }, { 0xc6672bfef8d9c704, 0xed81e864e9d9ce2c, 0xa390c3a99af7da03, 0x0f849f539e4e10cc }},
+        {{ 0x2ea0f77e887686ac, 0xcf65c3ddbfb300a3, 0x9cdf4a11980020d4, 0x201e16794fd284bb }, { 0x552254dadae9abb5, 0x73bf9b6502363eaa, 0x6adf65e3403a8988, 0x03d496aec270b4ad }},
+        {{ 0x307c837828ef8017, 0xd7df2718c097214e, 0xb6ea9f6ea79b8e5f, 0x22ce8a9d88a3dc26 }, { 0xc00a70c1c35e2e89, 0x00c6472b74666c59, 0xe8c35ab5c2c27ebf, 0x3b9414682ec1b6de }},
+        {{ 0x1c9db355503f4556, 0xaa730ac1ef9ac435, 0x2ab687deb820437b, 0x16306c6f8b197477 }, { 0x9522a255892f8ebd, 0xcd38b1b0e213e533, 0xa03462b629d8b705, 0x31309d8222047f1b }},
+        {{ 0x13f3c840ebd644d4, 0x3bcaf2f0d5cacdb9, 0xfe474e50ee66ab1b, 0x3ca5f6204d105739 }, { 0x4a895587934c2c42, 0x6cd78219b2480b6a, 0x9e96365754ff982c, 0x20a36414c053da67 }},
+        {{ 0x35a1c085e8379670, 0x53498e5ca3323b5a, 0x73e8c7b923ed5130, 0x024da8fb21175e72 }, { 0x331b7850e5b72420, 0xb760d1884840aec6, 0x5afc3ffc5752424a, 0x216805ec79635738 }},
+        {{ 0xfc7dd42d65eb5811, 0x185aff7575fc2bed, 0xf2475176b5a83356, 0x0d412b4d31266311 }, { 0x32a7f65c98b1f198, 0xae849c8373f659ac, 0xa1e0f3c22c4a86b4, 0x2dddcf7a75e3ef0b }},
+        {{ 0xf5c21be319b7154f, 0x6c87dacbf3d91c07, 0xc71929f4d4d3e901, 0x0e47b00b15139e32 }, { 0xc9c09f674f4efca1, 0xda02a4a3d1a4f2d3, 0x418b4166f0e1edb9, 0x10ba392df38f2fe2 }},
+        {{ 0x3f8c51c650b1c08e, 0x9724b9251f683a7a, 0x85219429db5aec97, 0x3bed3b0d6e7d2a26 }, { 0x1e972713a7af4a52, 0x0b7f73a9b4b99ff4, 0xcebd4b5ed039a69d, 0x20e33c096e068c13 }},
+        {{ 0xe5c7c461418f1e17, 0xbbe21afdb4afd602, 0x5f7cf7c23f32a384, 0x2216d42439ab4bcd }, { 0x6090fed37ecfefd5, 0x209cefde85e87141, 0x5ddbcee7a7a1a272, 0x0f4722fa85086d74 }},
+        {{ 0x339c5b4b41a4d1d2, 0xca342731cb65cb51, 0x42cad263750b9bb8, 0x1f3510c9b687008e }, { 0x25b73857ca0f4b65, 0x8d561aead6dc6314, 0x212ea24c6fddb859, 0x135d9d714773f436 }},
+        {{ 0xa2c9820cb253a7ee, 0x1f20dca103699e38, 0xb493004ba7bbdc53, 0x188dad53f665affb }, { 0x521a84a1509f6b6b, 0x471e571ebb6edc24, 0x1565fe8d7a2d192f, 0x08644ccff082d9eb }},
+        {{ 0x814eb319f3da70b4, 0x17510ca480f8e490, 0xaaca524f9b63585e, 0x19d80a9fb9fb9607 }, { 0x2057e73e134ff1e3, 0x77df24ed44aed90b, 0xd98dc227b6f15ede, 0x20832784d623a169 }},
+        {{ 0xa2f3d6b1ad2faa4e, 0xc8a082c0bc340561, 0x4970280c944ab49d, 0x11f948e287e9be13 }, { 0x99f44c337964fdb4, 0x6cf8d8a8e8845f73, 0x69439ac450ea6de1, 0x24f3cdabbf5eaa83 }},
+        {{ 0x1c8be9629944b532, 0xe3891160e2f0b4a4, 0x4353622330185da9, 0x23ead72bb0451f65 }, { 0xe41e507b4fd15953, 0x376c8fdf4bf2416c, 0xbfe603dabcf1adad, 0x3caf2dca98def656 }},
+        {{ 0x9bf26872648624f8, 0x599b21c358e1158c, 0xe2dc3ec5b219aad7, 0x0274792ae0195ab9 }, { 0x2f23740cc7d09ebc, 0x6231d5c584f9cd62, 0x99c848318bc51a01, 0x3812056e01e5e82a }},
+        {{ 0x44d04bf67cecea27, 0x34c37f3f917f6f3b, 0x412cb203dc267ce8, 0x1276b5a922142c93 }, { 0x7bd4cdba43689247, 0x764dc79a9e9ac9ba, 0x52b838e79a131335, 0x0c369d0129090286 }},
+        {{ 0x68e5e453b8b44fab, 0xcccf6ec714af2e24, 0x67fa7091b69a3f7f, 0x09256933fc782afb }, { 0x35b5d5345c28bac9, 0x0ecf033bc6eea2e2, 0x955b9a0e7f5a1cac, 0x328bc55025859aee }},
+        {{ 0x9bedfce87afa5ade, 0xd542eaba71afd05f, 0x57f13e1e32dd827c, 0x238a3e63e7d1da0e }, { 0x1d6c8c382dc1cf3f, 0xd54812cb9c1aa3e8, 0x2751f7e7200c9e78, 0x228b4c2bee999659 }},
+        {{ 0x2affbe70f3d6b288, 0x626afeb2efe65e9a, 0xb3410a743b4b07a4, 0x217309d501bd6b58 }, { 0x572eb6818d729347, 0x81933ba2cae32741, 0x6ac1d56d1a0e94a0, 0x068d086783f7629c }},
+        {{ 0x6572cb79a8954582, 0x316180b338edae6d, 0x5e0952739b82b422, 0x3873a5ae73816357 }, { 0x01599cacc9751982, 0x03094f2f5676d7cf, 0x4da3daf09c3d44a9, 0x05481bfd238f18d8 }},
+        {{ 0x2db8cbc1e1a90d5b, 0x237d2aab5047ff60, 0x9d630fef77d4c2a9, 0x32640a62640b4cf7 }, { 0x95b586bb6db5e1ba, 0xe2bee4794c9e45cc, 0xef93b440a0b5c1bc, 0x0e208507567b28cf }},
+        {{ 0xc7957aa1edc1a9ff, 0xec0ae4b89f43370e, 0x688853736d1cde2b, 0x0c64e9ab856d0e1e }, { 0x0abbae720d458d64, 0xd676de8968fc9142, 0x2fe1a12466a31053, 0x1e8fda99a8529501 }},
+        {{ 0x02d2cd8adc03d293, 0x6a888565d958591c, 0x87105979fd84912e, 0x23dbf3bf1ff2ad3b }, { 0x965a546660d60116, 0x2568929bc24d9ebf, 0x8c0ca821ecc02927, 0x26c0fc6f787ee561 }},
+        {{ 0xb3a034c63be2a856, 0xe744f248fba7ebf5, 0x56fc49f796cd0113, 0x352c7690657b9397 }, { 0x3470b4308c2d3c67, 0x7b68c5fc5379831d, 0x9e49f281a97a5968, 0x106f7d5f36d19c5b }},
+        {{ 0x458cb58a5981d6d2, 0xbcb65646ab14cecd, 0x5fd2cc555ed4a8e9, 0x0496ab92b0fe3cba }, { 0x09d0b4499be98fc3, 0xe8d961b01d857ec4, 0x8ae328d81bb6f1b1, 0x1308a8ef78447612 }},
+        {{ 0x1f27572ba3f54c16, 0xe4aad6f76241be2f, 0x66e5b28c3e89445b, 0x262549700ea86552 }, { 0x01e3049ac1bbc6fa, 0x6ca9221e07b5e684, 0x1a35fae5d7a4bab9, 0x2c6d3dc810ceabc7 }},
+        {{ 0x9390f67bb1c86b24, 0x50aec55248b7879a, 0x3f7794e2009af267, 0x3a89b0ea3ef1a876 }, { 0xb2d66dd1b9ac2952, 0x00d3a7c91f067bae, 0x3d65e27e930ffa58, 0x0faee63daeb90b87 }},
+        {{ 0xab07dbb31004fe50, 0x535fbdd5ccb425e0, 0x91191aed252a2d9e, 0x13bfd195194788e2 }, { 0xca99e8c8daf7d444, 0x451660b19af77224, 0x2e09ecf74c17cd41, 0x3e34bb4ce101b6b1 }},
+        {{ 0x7a72dec0157d9437, 0x7ab2245f08ae99e5, 0xbf99b32281190fda, 0x0304dd22d248d139 }, { 0x17c51f4ecc7b9978, 0x183aa19488b27665, 0x575fee7b908de23b, 0x02e8566d871e5f4b }},
+        {{ 0xe8244b21f8699e41, 0xda22f2c9fbeccbc4, 0x22c06c0769da9469, 0x2fbf80a41da37655 }, { 0x2cb3a12092699c30, 0x84d6fa62513d2c77, 0x691aa770e255ba3e, 0x2d197a43e2d5d00c }},
+        {{ 0x4baa6bc7f087c63b, 0x279bc8c72590b1d0, 0x60b37731a70ce053, 0x14fb9495333577ec }, { 0x9468d85dc0148815, 0x9d34c9ac973382df, 0x2e35c3cc5138119f, 0x143a5810d80b5d80 }},
+        {{ 0x693037ab96014080, 0x7c9cd3842164cc02, 0x9dbbc18ee6fc4883, 0x0120b2ec781584a6 }, { 0xeeed819b3f952830, 0x0a87b4aa1947c777, 0xaed0b536068f7191, 0x1c077a7b209159dd }},
+        {{ 0x04a40fd58bbbb488, 0xa3ad7a636104223c, 0xc9983178479d09d7, 0x22cb3cac355affd5 }, { 0x6014549ff5812c41, 0x22d1bd2174fbcdaa, 0x2b1cae73ab29a237, 0x2f2f4bf0553ca487 }},
+        {{ 0xf3f3eefc123f1bb1, 0x4b3018fccc78d8cf, 0xd9d916fb41ad00c3, 0x151fa84b0b763327 }, { 0xe5abb6585d38a4d4, 0xdc851fe4ebf57f66, 0x6178ad88e4c8f887, 0x17238470758c2e8f }},
+        {{ 0x5e7002295fe3505a, 0xcccc25a8f55f05ce, 0x0dc21bd2785cee60, 0x0b3d2aa3c448530b }, { 0x84052d41c378bb74, 0x39ad0514bfb9d651, 0x2a039946fb6bab9e, 0x32b86fd60ad8200e }},
+        {{ 0x06af4e2e85101826, 0x39dbeabfc38eb0a6, 0xd78943a51f964315, 0x1a35bd0b8ea84493 }, { 0x2aa0da2ac0879af3, 0x84c30da52806c874, 0x281ac84c039a4c3d, 0x2be8b7ffeabedd3f }},
+        {{ 0x9e1153b2a24c5dd1, 0xfb6b4bb8092a4568, 0xbd58404b05a84ec5, 0x1a78229be6f8d66b }, { 0xe004152a8e78dd44, 0xa048ea44b7a0daf0, 0xf2b61044ba57739b, 0x35d591332bfacfd0 }},
+        {{ 0x46480e634f47564b, 0x60b1a7ab1e7c1aed, 0x8529ff889707d4df, 0x291443da36372ef8 }, { 0xc099cbdd8a48bb31, 0xb896001f09961c2e, 0xa149f6b02f9461f5, 0x3dfca13f2bb1ea10 }},
+        {{ 0x929bb3336a760753, 0x9d20bb8894506078, 0x10fb2a1738cf5c30, 0x2eb439caab679da5 }, { 0xceec20af0217cd9d, 0x751a4d30ed4c49d9, 0xfe478cdc97d92e14, 0x158c98a74ece8caf }},
+        {{ 0x3cda80e7f08a3f37, 0x4d8cab484710a7ce, 0x776bb816015d2a47, 0x249dcbceedb74bc8 }, { 0xd422056540d7ac5f, 0xfd424165546ad278, 0xdc110795f7e4f808, 0x3470f42a7baf8f56 }},
+        {{ 0x8b99487501bba97f, 0x9469a3f1da3baad8, 0xfa16248995a90305, 0x3ac46a05e0cc4876 }, { 0xd54cb212aa10a517, 0xd8d3e26fa7c7e8fe, 0xa6b95239efd8a359, 0x025f9afa912b4038 }},
+        {{ 0x04763e8d1f79888d, 0x78b3d9116a3569b5, 0xae320c4c68a9557a, 0x16f96732dc1fa22b }, { 0xd06fccce941f2eda, 0xf0d9609b50b6415a, 0x96e80dfee24bf28f, 0x173f846a38d4cb1a }},
+        {{ 0x88a014699a8c1359, 0x3afab9c1d5a9e836, 0x5af2eb6133580e4c, 0x1e5c90661d51664c }, { 0x0b2f240464a4fe20, 0xce1c3a00d29f8e38, 0x8e4f2201baeb887b, 0x0ac0806b63bfc7e7 }},
+        {{ 0x58fe3c0102394313, 0xa0a0b7000fa8e92b, 0x3ce419fa8ac9a894, 0x17c1c485438855f3 }, { 0xd3370b960354614a, 0x2505138e949b9ce3, 0x03acd4155514d0e7, 0x2395cb8ad672ec3e }},
+        {{ 0x94f7067d1c0e540f, 0x2eca2f2190808646, 0xd43af112480cd455, 0x1f630502462978d0 }, { 0xfe9959631104b3aa, 0xc0a6b2dc97a198fc, 0x6f17e2f13dff345c, 0x01662fa1070ebd92 }},
+        {{ 0x8f48882a2d3c17e2, 0x6940223fc49a9dfe, 0x680a4d829aec94a8, 0x161527b879fd7eb7 }, { 0x48af8640eb412f26, 0x46579327f3c6af0e, 0xa70c6b77d75ef9f8, 0x331e6f8a70e86abc }},
+        {{ 0xe6d743ce340efbdb, 0x18ed51b08e263e17, 0xb8bd4d2a77a048ee, 0x3181873bb3eeb0d2 }, { 0xe3d975c1437213c9, 0x4423214e906af772, 0xfe34546cb0fbb060, 0x3ab4e4cd878e6a5b }},
+        {{ 0x4b84517d6034b4e3, 0x6e53b68a8f0fd342, 0x94576a00b28274d0, 0x38e852395bb2441d }, { 0xe93213e7930b132b, 0xe6fc16c1aa05f6b0, 0x985cd703393ebe86, 0x2e2e8eea3b0d6a9f }},
+        {{ 0x42f2f0491c9f19e8, 0xe0c76661bcddc9ce, 0x46eeb10977d5038e, 0x11e3fc77861b9a72 }, { 0xb36e2efaa789069d, 0x7c2a812c199ff62b, 0xc38d8d8fa8b6d36d, 0x0946906b4dee3b31 }},
+        {{ 0xded7863d75401235, 0xe7fc56ce68071257, 0xc87632d8add017ca, 0x1b504cd05f02fd0d }, { 0x5822e10ec94b0b6f, 0x7f4211d99ed60ef7, 0xb7f749284c6c4c87, 0x1d7796dfa8fd4df1 }},
+        {{ 0xac89006074ab6728, 0x5c55b023f380307b, 0x34c9fe67c9b7e39a, 0x1c611bc97df994b6 }, { 0x2d3ad224adacdf26, 0x59e9ede302fd8647, 0xa30223375c0665da, 0x234d33c9e1420aee }},
+        {{ 0x04102268c1396a45, 0xfd894a0b38fbef9a, 0xeddbc3f64edf062f, 0x345418882115369f }, { 0x5b451a8bf0197685, 0xd1ae7b89da546ffe, 0xecabe46744941356, 0x3dadb0c2e522977d }},
+        {{ 0x620e89505cc62cbe, 0x0b28446588e11f22, 0x1556bc9ea84959cf, 0x21312679869ad02f }, { 0x1ee164a0c95438cc, 0x7f16f543adf4f36c, 0xb0774c3a72544a76, 0x37940070b83fec0c }},
+        {{ 0x01c7b6f27f628019, 0x19ed8d69923f7d34, 0xbf4e12ebdb15351a, 0x130219c2ae39a330 }, { 0x167247359676d080, 0x28ec5bd88e1c7f99, 0x2ec1f0e01eb93447, 0x1399cea872d224d4 }},
+        {{ 0xab722ff8a58a70ca, 0xe700d8f852c05d92, 0x6f263522187b1011, 0x0ed46e1cc49cbc45 }, { 0xdfbbc28dfcabd71d, 0x53d939ea3df9364c, 0x036d702dc64d1e0a, 0x1f942ac92a5d683f }},
+        {{ 0x7987a3b7a0eb506c, 0x065cae392fb43f5a, 0x4fd43ff88c1654e5, 0x22dd6723fff76392 }, { 0x13db3194540cb090, 0xa2135c6e9ab7fcc9, 0xf2fdb23115c1f70b, 0x08faea1f3ad1e09f }},
+        {{ 0xef2480c26226d95d, 0xaf44d52d3f482801, 0x647e6f4c9e5effa9, 0x189cfa9a36f280c9 }, { 0x71524d7835db9a4d, 0x20fd84ae5dcb2fb4, 0xae57fa4567e2ae4f, 0x304d2f67e7a84fc2 }},
+        {{ 0xda6943be9f857d4f, 0x2f41a711efc8eb37, 0x597037700066a8ef, 0x0fb3006dce0dfdbf }, { 0x3a77983ccb89cc58, 0x645eab74c5cf87a8, 0xb27e0d0038a745f7, 0x305ef4202fa82835 }},
+        {{ 0x624a8b690ce67f98, 0x3943728fa5b56837, 0xbd2437ba1652c467, 0x3bbb2738570b7756 }, { 0xb4957807b69611cb, 0x5ef424e3bfaf7147, 0x29d579a48fb8e378, 0x06ee7f38abbb227b }},
+        {{ 0x28e8ecf75e1ab02f, 0x2b1442011b12a6bf, 0x9390ee7e17a7b4ee, 0x2651e71893700668 }, { 0xe301a12ff8d61a66, 0x5cbdc9041f07bd83, 0x5089c97f5591981e, 0x0d7de05e674b4bf3 }},
+        {{ 0x8d98413d7a9d0404, 0x5b9587ad5fad2352, 0x2c1c8eacd1f0c88a, 0x02807294aa08128a }, { 0x0f9c1bc4805a3a34, 0xb848bcf8776f9a45, 0x47def1868bec47e4, 0x3f7c7204ba05454b }},
+        {{ 0xc35fcb61d93c3f77, 0xb574c0b860b7cd1a, 0xfff8c211e3846dce, 0x157be0e046d6e190 }, { 0x1c51ae51b1636b08, 0xf65b44df48a6296a, 0x8d14f79ad671f959, 0x251032dcfcb34dbd }},
+        {{ 0x963c16c6aa0e4312, 0x0f0c2d36015e84c7, 0x90a53ba7afaee131, 0x0003979b94233fe8 }, { 0x26f8c56d4d1f57db, 0xe95ea312ef17a8ac, 0xa4211a57134f166b, 0x0c7d0e010749672a }},
+        {{ 0x551c6a1ac0e13eb7, 0xc70c144cd6f832ba, 0xe0f2498dd60bb418, 0x1f114a67f05bbbb6 }, { 0x39cd5d09d35cfeda, 0xc7d285917f8a16b5, 0x5caec03531c1ef38, 0x23716155e3933390 }},
+        {{ 0x7f846de9bcd01aab, 0xa045cf720f82a84c, 0x21274718009a26ac, 0x3867745611d22296 }, { 0x714246dc822ee314, 0xc8ba6189e4de4847, 0xb8d809082ca9b175, 0x20cceaed982e1914 }},
+        {{ 0xbf69330874b8fe59, 0x81c459ea960ce2e3, 0x26bf52ea0b4b3666, 0x38a7393aba796fd2 }, { 0xfc525c58f7df9bcf, 0xc71109f7e833390b, 0x43ec042ea0cb097b, 0x1358e6df5390286e }},
+        {{ 0xc7fbbbe20a252a47, 0xd0a1e055af99cf5f, 0x41929da6a2baf62b, 0x16dc843602972654 }, { 0x66269ff5108335ca, 0xf4a29f564a6d0dd5, 0x142447921ac662a8, 0x158ebca9c2c36e6a }},
+        {{ 0x9dfb4d213cc5c143, 0x1fab1e8822019665, 0xda83cbac5e952b85, 0x3d46a820f2948fab }, { 0x98ee1af47cf2b97e, 0x09fffa199e645a7a, 0x1b243e1583250ce7, 0x322cfc6758ef613b }},
+        {{ 0xf46cf67c887187a9, 0xb48845582886ad27, 0x12d46f989bb26b76, 0x27d6a97fb3a8f99e }, { 0xf60469df3b564a1f, 0x29def3ffb00df20f, 0x57b7b5c0594ecaf2, 0x2f1b6c9d03a2cdb8 }},
+        {{ 0xc7af137f96bf0b8c, 0x4d57f9e7bfa65fe0, 0x89654e7fa15be9f2, 0x3ae6f82ed84a9d3c }, { 0x80f7406a2db29d79, 0x2b12d470afb09001, 0xd2f387d9155af58c, 0x263f5f1879d3b2fe }},
+        {{ 0x62f5a40b2b656ee6, 0x09d1361452100fb4, 0x66c9e6ca406c194c, 0x1fd06e5d30c05cb4 }, { 0x191d7deb9711703d, 0xe7e7bc60cbb35678, 0x671eb62dee864bd3, 0x27c6472179f9f2f0 }},
+        {{ 0xfd7aa6672a311489, 0xc08e14a154c47658, 0xe54e9b459f896825, 0x14287024bf810f1f }, { 0x815b334b6945ce73, 0x279a46864f7d9a43, 0xe221a7c04ff9ea12, 0x2e380037d2a47313 }},
+        {{ 0x4038abaadb244ec1, 0x7d8cf8c0d81ad43c, 0x23fe92d31ebacd1c, 0x06fb74120c109196 }, { 0x3524fd1f0a45ab12, 0x4c913c20d38c2465, 0xa6959b53fe584bcc, 0x069ca6e025f342fc }},
+        {{ 0xbbb7ef108c41566e, 0x1652f7ed96ee3fbc, 0xc7b3254319927cf8, 0x35a039285c284496 }, { 0xfd1d50df9990753d, 0xc2050f68bb1f6344, 0xa86525e7cd3f16f9, 0x14478c47c26cd852 }},
+        {{ 0xcbff463bfad3628b, 0x3676bc92d5558aae, 0x4db682184a28cc8f, 0x037f73f3bde63f7e }, { 0xd869393631fac3e1, 0x69d06835e7cdd75f, 0x603b7424aaded7a4, 0x2f38734f27b7ebc0 }},
+        {{ 0xfe9263754357be3f, 0xb9e47a616def04cb, 0x7d5d63de39c59360, 0x0dd978698b9b08a1 }, { 0xcaa2c49cb7cbc0b7, 0x326ca8f8e68bf822, 0xc35a359eb76c2a68, 0x0958f7d4fe0a810d }},
+        {{ 0x1b879a9c5db1956f, 0xdb69e58c4fa976cf, 0x3a22faf8f6d53df0, 0x0371ce4ebea7d262 }, { 0x2c620246473d8bce, 0x76389ef4ffd48af1, 0xdf3942546e87ec1c, 0x376c5a3dac5e4398 }},
+        {{ 0x5dfd5a7089f8ca39, 0x3a5bdd07c043fd84, 0x125be2f0c21600a7, 0x1efe1ca4ec37ef7f }, { 0x9c0acb7dd4c516ea, 0xc8e9e65352f6150f, 0x2a063f3c9695a5f6, 0x2db2a50170af980c }},
+        {{ 0x3cce50174c459eac, 0x29f7a6df6ee643c0, 0xbf95d97abf794382, 0x3c9468e972a67d32 }, { 0x10310895e08c0a29, 0x6f406216f3506a2b, 0xe7a2606c33cc57c6, 0x13aa03a92e65c405 }},
+        {{ 0x4a864f90980095f9, 0xfc01936b20d376df, 0x4ecf3c7c8e12f5c6, 0x1caa1983ededb13e }, { 0x4d5f2e62a2db6f06, 0x59ae74d26e93c8e1, 0x26dc0f1532a5490a, 0x3872123301568fcc }},
+        {{ 0xb6b1e9fd4de3c007, 0xc06a7444b2c65386, 0x10cc45928fd5c0ed, 0x0665e0a498744335 }, { 0xb9290ce2128f6bc9, 0x792307f9eb9703ae, 0x1ac743a5c306764d, 0x0754b4ca789a7aeb }},
+        {{ 0xf69f9d4aa0268361, 0xb7884e75c8bc56ac, 0x97650e1dd74bcad8, 0x29bdc3789e4340a3 }, { 0x95f059f28966e69d, 0x1fefc3419d89b399, 0x40341f8ddf05fd74, 0x0b2bed2b48466072 }},
+        {{ 0xf167b0b4c2ae7c3b, 0xa36bff7b9c6633c8, 0xd245ec9651ea6d89, 0x210fbb2e7ce11696 }, { 0x0a84786598eea4af, 0x412eb3392b399ed1, 0x7960f4a3cd643e8f, 0x39ee1d016f15a699 }},
+        {{ 0x6bf05b5e2282a286, 0x29ebdb4abafa6f6b, 0xcf8184aa8e18de24, 0x2905ee21f12536d7 }, { 0x81bb5b7a6e729bf0, 0xb120c5b3b87e7da9, 0xfb938c623ee4b887, 0x115e988416da97f4 }},
+        {{ 0x6543e6a906837e03, 0x420de6bcaeb795f5, 0x1dab2fbd61c55048, 0x2aaf2a14ed670697 }, { 0x717d14b50484c892, 0xf3b8b3e1069b7012, 0x9fa087b4d11c636d, 0x095fc3ac8ee4af3b }},
+        {{ 0xac54f1057c26ba67, 0x7668fa50e2a00194, 0x8501445598cf3181, 0x0602c90dda2fa06a }, { 0xd294160eb07107da, 0xeae62883703be8ae, 0x8652ae7cefec5ad3, 0x1db8b6ebaefec077 }},
+    },
+    {
+        {{ 0x8ee57c172b96bd30, 0xa9182341c396bf9d, 0x901052c90f8b885e, 0x0967692e6301db67 }, { 0xc0e107815f403e09, 0xa9c46216e9adf54d, 0x98d7be55769a121a, 0x1f1297829893306f }},
+        {{ 0x6f5fdf6ac9571ab5, 0x28856abf1bb9710b, 0xb96e1b086fcf32f4, 0x1e1dc376370d6434 }, { 0x2a01cf31cde8b26f, 0x3c3067cc2f061d19, 0xe8862325935c8d80, 0x09b8759bd657448f }},
+        {{ 0x6466bd488d38db73, 0xebd9ed82e441617a, 0x8575a091d64f468a, 0x3d6bdbe3d013ade4 }, { 0xde58c0fbc904799f, 0xd67e270385c36a4c, 0x0ae3ff0851d0ed59, 0x2f588fa8d0873fd3 }},
+        {{ 0x796d0648c2394c88, 0x1fafbd135261ed86, 0x262e3b52d3165066, 0x37c088f042434ab6 }, { 0xd2fab8bdad8e8c5e, 0x84837d76c1b566da, 0xf4f911c5a758beee, 0x385da3a238f37569 }},
+        {{ 0x98a12d5694bc802b, 0x63a85f709476ed90, 0xc2303d632b1055b4, 0x29aa0f0c8fa119c3 }, { 0x0718435d552638c8, 0xbacdc61cc28457f6, 0x80b902190575dbcf, 0x29d0fa264bd5611e }},
+        {{ 0xaf80f0b81cebe8ac, 0xc70b9524e668449c, 0x76a36a8b35fa6830, 0x0fb9dbad8b73487e }, { 0xcca2406cc23c919f, 0x1ec9cac995f8747c, 0xb1f159b372aca54d, 0x0d54d283fdded109 }},
+        {{ 0xe8a014eee7003eb9, 0xe6ce2ffe2c76cb14, 0xac903969c7232d46, 0x34c7a61515a2f80b }, { 0x7a398af66fa9b0b7, 0x90363baa3665c127, 0x5925ae43840ea2eb, 0x2ae94b9eabd42731 }},
+        {{ 0x0d53e27682b6aafe, 0x865ec8a274f7e3eb, 0x137efa50ab00d5de, 0x3167333fd1d08842 }, { 0xf8f2461384666a92, 0x7b6a44815ac2d9c1, 0x44bbebe4f3a70d2a, 0x2c93d2111fa3794b }},
+        {{ 0x2848306b12370636, 0xea462943780c00bd, 0x71ae63a6cdd3330c, 0x1e3d7f7cb5d87402 }, { 0x3387e36fb906c1ae, 0xc81b0ca51bfe9e61, 0x6a9751a9c16628c4, 0x0638f7a30727f70e }},
+        {{ 0x5a8a9eb0bb5cc8b3, 0x927660dab87a5bec, 0x3bbf1bc1515f2ee7, 0x2ae75fcc55123c66 }, { 0xfede33f18db53ccb, 0xd29aa5480887719e, 0x1f3fb4f3c9bdd6e8, 0x3cd9306e96faf8cb }},
+        {{ 0xba3dc972b515a738, 0xa831608c0bde7f76, 0x948cad2425a70919, 0x3f39414b1a845359 }, { 0x99f0c91834986372, 0x4f4e21f10ef1e90b, 0x2aa3c6ed438141dc, 0x386af3d8ebc54345 }},
+        {{ 0xa55405c8d6632e84, 0xa0edc2de4b83164c, 0x47ada7d08240729f, 0x0760958608c4b2c2 }, { 0x8b2d40c73da58df9, 0x4fa600ab2403e223, 0x98437fbb10d93700, 0x3f42c919e8cb936e }},
+        {{ 0x376697504f675465, 0xd655b3f2db60567c, 0xc924cf06855545e8, 0x3dcaa05d1db820ab }, { 0x94ae53c167610193, 0xa44059aee63f7efc, 0x5b17e1f3fe651383, 0x1d4217c60d5adfd4 }},
+        {{ 0x2f37eb70257e2ea2, 0x9bde30137f275712, 0x1e95f25f41335f9e, 0x229b029a48a64b97 }, { 0x7808f4917c5ee5ec, 0x44e53069992a9717, 0x2baa8c9b7dce382d, 0x0098a71bb2ba5706 }},
+        {{ 0xfc6717def98307b5, 0x35b376909c25f463, 0xb7019f6bf914852a, 0x2f84a7102058f657 }, { 0xcfac9dc482431e86, 0x4527b985bc711d2d, 0x8a93242de1eb6622, 0x302d857e1e9ff6e1 }},
+        {{ 0xce3ce8e9594a5a8f, 0x0a7d34334a7a18f6, 0xaaf758156215375a, 0x23bda7c9d677e753 }, { 0xfd8abc022526480d, 0xc89e95fecdf12e06, 0xd83fef042bc846c2, 0x2afadb61c290cdf4 }},
+        {{ 0xdbc6cb4429a2404d, 0xb9700ff044cec776, 0x9bf43882addc71a2, 0x101350154b99bb61 }, { 0x156ad9b46c74bf4e, 0x8ae8796587c24930, 0x0489a8fba97e13a6, 0x0b13d255df6594bd }},
+        {{ 0x718cb618bf3d0bf4, 0x7de995639c6d5708, 0xabb7f038ca9ca6e2, 0x3d04b333da9de349 }, { 0xd6018810ebced13c, 0xe53224509537b0d3, 0xc42f0857190fb502, 0x289c90172ede1d35 }},
+        {{ 0xfc594058536af8dc, 0x449bff3e24900d4e, 0xc24619882954ecc2, 0x004647f493f66bc4 }, { 0x945cfc8cc0aaa338, 0xaaae6c340dee9a40, 0x5a157f5d3a12954c, 0x09aadcfae21b2ba3 }},
+        {{ 0xd4ec6e8ea3cb25fb, 0xc10ecdf5e4fc1922, 0x05327b8bdac3a9cf, 0x1b9009f9b41bf134 }, { 0xbef27569564dafd8, 0x00537a3737eea4e3, 0x59de74fc4b11876d, 0x3c025d5827831791 }},
+        {{ 0xa80be3a8dbefb9be, 0x6456ba9c3970e21a, 0x69f381ada5f08389, 0x2b242607ffafb613 }, { 0x4ff782bc85814995, 0xa0770eb8bc5219a0, 0xec0dffc00d373e2c, 0x3b4a4c513e592d8d }},
+        {{ 0x2e4130edb683ca8c, 0x843098650af2e779, 0xf5a77a0c7fe355bb, 0x3ad909772d54dc4a }, { 0x1a834eb28bdaea9c, 0x053d539c176ad956, 0x3c5abcd9d13b8d00, 0x2fca6e8399e3e905 }},
+        {{ 0xfcf98e637f4d44b2, 0xb609c399127a5405, 0xf187192c3a156358, 0x3e9532c785c2ac9e }, { 0xf423cb3fa8a2ed82, 0x01155e12e88be0ff, 0x1bd71681b26f15f9, 0x0706351d723ddf4c }},
+        {{ 0x4b9a2fa355df8127, 0x32672943f6d69045, 0x55decbaa9b930d06, 0x3adea7260b7bfaf4 }, { 0xea7a11291454ac4e, 0x734869cf540adb42, 0x04952856871cdce9, 0x3aa0756f86b43491 }},
+        {{ 0xc2322ecf2f0a16fa, 0x9140f477f7b0358e, 0x6b03ba2356ba5215, 0x2b33589a2a4d65f7 }, { 0x262ec728b11f4fa2, 0x04add9cd7708f6a4, 0x04474a23cc20a43b, 0x11306891ec23fc81 }},
+        {{ 0xd39c7e3c681d8f2b, 0x4480e6ed58956c9d, 0xc9a153d6ac1dd542, 0x2e5ac1b64320cb45 }, { 0xbbcddf8df41a2afe, 0x80425f1a2555d18e, 0xbb3207f073253443, 0x104e152687d69ab9 }},
+        {{ 0x1f8f59b2f83b6efe, 0x40ad0e61a1fa61ea, 0x7211a1ffc3cc1e6a, 0x24c6378450556651 }, { 0x2191e8963dbd5a6a, 0x0751e4a16e52a9e3, 0x08b1fea519524ee5, 0x2563e00abf12cabb }},
+        {{ 0x75b171c4cdd526de, 0x3f348de41fc39061, 0x3e37967d3fb642c0, 0x1bb4e53e95ad4886 }, { 0x96fe3b9ebb3498d6, 0xbdd05814660d2e07, 0x8bbed5486e07fe1d, 0x32e5facba4f8baf0 }},
+        {{ 0xbd1150f02f7ab304, 0x93367c460ebd7b20, 0x366fa1d0b67be45a, 0x347db9b53a7ab4e9 }, { 0xfcd695091e9b4f16, 0x3b63e1564b32b7ff, 0xd576d938ba249d5d, 0x03f7d2432a014ed8 }},
+        {{ 0xf935e4af43707cd7, 0xb69ba387e2406c50, 0xbb4c688b391b3b0f, 0x0dafaeca3d89a759 }, { 0x52706e1b3c57fea7, 0x43a58fdfbde2b1c2, 0xde0a3c6d9f3a72e3, 0x2b379d2f7e8c2555 }},
+        {{ 0x8ed7754d5d1e22d6, 0x72065381bc64f2e6, 0xe572a50ef21f0094, 0x01a0835fdabd627c }, { 0x17611261989cee79, 0x1dc1c1dec2c64816, 0xc9997ccbac983b3d, 0x304865ccddaa3858 }},
+        {{ 0x0647b34a7f219d37, 0xc5bc9001e6bb436a, 0x426c4f0625a2d119, 0x35d8b6baa8f4dc20 }, { 0x22c5cbe5f98eec2f, 0x98cfc38de70165f9, 0xe965251bda01d8ac, 0x14d08c23544ca7cf }},
+        {{ 0x566a9b67dba46ade, 0x312e45581a649fdb, 0x691def7a52070d9a, 0x045a0aca4656cadf }, { 0x5a797b62d45bedd5, 0x3dd7e030b899ecf2, 0xe40e2889c7cce4fc, 0x03ac044ff13e7fcd }},
+        {{ 0xdd358c5901190533, 0xe9bbd00d9050b417, 0x0b6f3d9357f3d4dc, 0x1203c689ed8a29cd }, { 0x67576500fc5d2ab1, 0x13a1383c8561f855, 0x9e26cb326695c30f, 0x03570572db90fdad }},
+        {{ 0x0c2e6047a81fc37f, 0x15747000548da273, 0xe0a09a4e63d7c4d0, 0x161b4c94152bc21e }, { 0xac59306f14d96bc3, 0xadf8dd7cefe465a9, 0xd93068ee3bcdb9ae, 0x24ff009e6ebef7cc }},
+        {{ 0x739177808c47df95, 0x02256ced9d1875a1, 0x02faea3d07f4695f, 0x30b3da2db818019c }, { 0x256dd0ee5db5b53a, 0xbdd5e5a86defa71e, 0x35ad7771fa2594a1, 0x3bf3b4abb2eed778 }},
+        {{ 0xcc8b576b410249b4, 0x672fe24767744af2, 0xc59f8e2c13c4de59, 0x2af000e860f0fc00 }, { 0x0db46fd1d76f65ae, 0x487308e0f06abcd1, 0x19d2333dc74537ac, 0x1002dc5cc8de816b }},
+        {{ 0xcd0816f905961aec, 0x496b4bac6d18827e, 0x4696808b9e0a3a03, 0x34298aadd2a5f2ad }, { 0xa872790bcfd23631, 0x861a998ed97e2862, 0xb97c1530cea81e6d, 0x0443467cbd535eb7 }},
+        {{ 0x75a7920fd228a59c, 0xfaada4699e9a2e1c, 0x606cd44f09452cfd, 0x3256dd0828607dfd }, { 0x70cf96785933c756, 0x681d65ed87323af9, 0x4892b2026f5a4a76, 0x0dea9224df0d492b }},
+        {{ 0x603c12d7bf0575df, 0x9bc0c19355c81ac8, 0x2f82d20de20be1cc, 0x25e753b445c0a4f7 }, { 0x3eab35701b81f670, 0xa75a67d079011c8e, 0x1832e23adf4cd4d3, 0x02dcd4892c910b2d }},
+        {{ 0xe541544b00ed7716, 0xdac0ace09ab7d49d, 0xd0f71509db302b20, 0x02516e553299089e }, { 0x2063cf905349c7fe, 0xa55a574a870663ee, 0xbd4901fef1d53fdb, 0x33a3497cae329b26 }},
+        {{ 0xce953a64765578ea, 0x69e806def42e8202, 0x44d76fc2657f2ee4, 0x3c07ca6e6f187963 }, { 0x858b93271da1cafb, 0x466b1ac16715fcbf, 0x9b7c7dff12708432, 0x1f49e5c4fc90b209 }},
+        {{ 0x7bba05f75b76400a, 0x59020bfb65b3bd49, 0x5a74f0153ba17460, 0x16b586a67a639530 }, { 0xdb3edb4a79cbdab5, 0x7a8f97d9871ee20e, 0x6179bf2c16d9e751, 0x1e6f175d2358cb6d }},
+        {{ 0xd91e531953670207, 0xc9c78b48d6bed944, 0xc797736def932870, 0x3f2413563ad98a08 }, { 0xe5305e99a9b24570, 0x748a4fc2fe16b974, 0x42f1aaa086ee4c1c, 0x15147ade48e74ada }},
+        {{ 0x2a96a76772840beb, 0xd7b7bb14183ddae5, 0xd3e46c2da7ecae91, 0x0ea1474c57bab6c7 }, { 0x1b1e717e235859fb, 0x0871f0bb5037fc90, 0x13c8f0fc1968d6f8, 0x097f032f93f1f019 }},
+        {{ 0xf5c2d82cff5eedde, 0xb2f2f1eda405a471, 0xbe104e43c5e9c764, 0x12c972a1d8ca26f4 }, { 0x4ba9742a206b95b4, 0x99450e164351ae33, 0x8b455220aaf7d0b1, 0x06f2e6c222bd903a }},
+        {{ 0x0f760d440d1ff96b, 0xa17c186df9df43a2, 0x503b0a72940e0ceb, 0x1a642b3b53d1cd4c }, { 0xdb111b37a8b395f5, 0x9fb1f837f9699b37, 0xbdaf10535279d34d, 0x1801c67f3b837704 }},
+        {{ 0x8d2041bf4bd1cae2, 0xa702874e90590e3d, 0x145a6ced3c4cea03, 0x0c546eb7b7c272d2 }, { 0xbaaabebb5ab42197, 0x9a80fee1e4713d8c, 0x7f3be5bc51eb2c3d, 0x0ec9717ef01b5cec }},
+        {{ 0xe3c8819086eb966f, 0xbf921a8f79f3f84e, 0xb42d85b4eb53583e, 0x219ab9ab662042a9 }, { 0x0a3eca6e22f6fdd7, 0xfdab3d48fc810ce8, 0x7d426eff06b50f4d, 0x00d73c05c65637b9 }},
+        {{ 0x3eda3c3b69d7f30a, 0xa9c104bbf0902fb4, 0x381c925a8ddc7eec, 0x2a7a5d85504b5d45 }, { 0xebe23a0f146d6f35, 0x1fc62f94f4a8b53f, 0xd3a895be455ca639, 0x0bcebf92d5586327 }},
+        {{ 0x7b0df8b401c09921, 0x096a912f0a302042, 0x60e5a5941161d65f, 0x2529cfd2f1a83e80 }, { 0x87f72a4876008f8a, 0xfc4f29a50fb97276, 0x4832d4a79c006e0e, 0x0440bef4f400902e }},
+        {{ 0x854300f7454927f5, 0x3096b16b614dfb52, 0x3083e8d6ed62c696, 0x02e3c8688c74f6a4 }, { 0x9a752287fe14edb5, 0x315aa306281e97b9, 0x5c5ae2fc46d047a6, 0x1cb715bb4a8c19c1 }},
+        {{ 0x30561b52e64ccdf5, 0x7231e1722aded241, 0x3e205320e3092ba3, 0x31fd6a56a52a7f03 }, { 0x5baffbc941da3eae, 0x865c3ccd8f24ab60, 0x7b495ecea806a735, 0x14652f447a354d3a }},
+        {{ 0xac4ff09dc9b7fb0c, 0x22cfa75046bf2e67, 0xa8df29953afc1618, 0x13647ebd466eef2b }, { 0x094869ba3bf6463c, 0xaa4b4434d2374ebf, 0x962d9900af367c5c, 0x17a2edae80a2d346 }},
+        {{ 0x9b6921cf1ea3cb0e, 0xe57471ed011e6410, 0xd29cc852562ca58d, 0x0a78728e4543974a }, { 0x642fc18f4ead0b54, 0xae5a6cac26a93e9b, 0x02c0cf24e0665445, 0x09668228e5ffe6ac }},
+        {{ 0xff75a4d232b3e0f1, 0x1208c89043b89421, 0x36557a7559be5234, 0x1162c70e3943a4a6 }, { 0xcfbd9612469aa120, 0xaa35d822c2e06b64, 0x77c7fbbae19942e6, 0x24be62ca84706cf9 }},
+        {{ 0x52c75069b89ed5b9, 0x304bc27c9d10834a, 0xac93653d9bc65c15, 0x1aea59d3cf1028c8 }, { 0xf5669aa907c142e0, 0x7bdedfeb90471f95, 0x1581ffbaa1008351, 0x21184175300ef12c }},
+        {{ 0x8485d06cbd118b15, 0x8a83e24d1a4f7b10, 0xb71a1dedc349cf0b, 0x33fa79e8c3019b84 }, { 0xed84cf5e9384533d, 0xff4c821886d7cd71, 0xfeabd6e6078299ce, 0x3f464ecefe4a655b }},
+        {{ 0x5681744a4adfc337, 0xc2caeea27ab9da35, 0x03a5787deedd41bd, 0x19abdde0a8995d47 }, { 0x25d898323a431a58, 0x170e2334a7619dff, 0x0f2395f77da8e3a1, 0x29b659e51c0c72ca }},
+        {{ 0x20fcc29d96cc4737, 0x3c2f7d340495e389, 0x832f56bb62230eb7, 0x18f9be753c4914e7 }, { 0x9e5ca27b2f58823b, 0x443cf05fbb7c9058, 0x020e104d0e0f6cff, 0x323d2f480b998f2f }},
+        {{ 0x6d05ac91119c81a7, 0x1b813880c75bf009, 0x11662bd60f290c52, 0x368cc7cb4564e55c }, { 0xab733e3afb4ee75c, 0x4e886428decf296d, 0x09c5a870ed0b9570, 0x1792c712e6cba43b }},
+        {{ 0x88e11106dcb0caa6, 0xf0962ea668d27ef7, 0xa7217ad84a5e739f, 0x1d5094ccac5a4f48 }, { 0x7916e5a6a0a938fc, 0x32623ab1bb6c2825, 0x0e7ec2261cbb3764, 0x03bd83ac74a704f8 }},
+        {{ 0xf24fb3ee0741e5f0, 0xe9dafc67895fc3fd, 0x26ef328b8ea0864e, 0x018026758bc5c09c }, { 0x6a07211bbd107ae7, 0x8117d92db1c0cda9, 0x4266670a53479acc, 0x3442df6b92915965 }},
+        {{ 0xad608cac6a750ca8, 0x9d7d06764689a726, 0x79fa2dc74ad6bfea, 0x3b2310acd00e9543 }, { 0xdf38e1597b322991, 0xacb8707b3c8e2468, 0x0444b66eb6dde0f4, 0x391bbac94a61cd53 }},
+        {{ 0x649ab0cc97b1b0f2, 0xdb5c48849897d30c, 0x3d35ba809fc3ad85, 0x2df4c928e3d6cbf8 }, { 0x4bb36f50616438ba, 0x856d1b8813d15f6d, 0xc50386b720b9cd52, 0x0a5e19daf9601025 }},
+        {{ 0x719ad496adc0d248, 0x348ac2dbd27bb290, 0xac9adbbe22aed46e, 0x1302f3f118aa13f4 }, { 0x500c467a6ee47280, 0x0fe30a0565845ef7, 0xe782671ed848de3e, 0x153f98303a88c350 }},
+        {{ 0x8a3d6015a5a1223f, 0xcb33ff0a730a4a54, 0xe2cf9356365a0541, 0x34365826fe2d24ad }, { 0x930364a1f4ebeb8d, 0x9680d2eed82be746, 0xe8a610b3551651a3, 0x3e1212a22fe3c3f6 }},
+        {{ 0x9e6a94bc31cb489d, 0xacd18fd4b3c081f7, 0x530cf811cb6732a6, 0x15619b4d7a7839de }, { 0x618863183e7c45d7, 0x7133ac9b10384fc9, 0x8c2c24d617954944, 0x2ec18fe5dc30d410 }},
+        {{ 0x121ce94214a4db1a, 0xa0ca580359e4b2d5, 0xfd9de4f58d777f81, 0x1b90df42b303676e }, { 0xcf2b9485e668ffae, 0x3925c9b103d24e88, 0xb37ba79b74734a1f, 0x114b9cb16e6aaf24 }},
+        {{ 0xf7e5887ccad92a0f, 0x5e0b9cd0c1b07026, 0x10d6bf582c83d808, 0x0859038e2914245f }, { 0x9992cf1cb8664e1d, 0xc16e32fdf30c8caf, 0x4f47bb41f452384c, 0x0a015937ce3d9351 }},
+        {{ 0x3e833367db8d3062, 0xc7b8e37592660eac, 0x74fecb4bb2e46742, 0x3ef1f9deddefcc20 }, { 0x26ca9185eead1594, 0xfe7fddfa95a4ccc8, 0x1d9cff4f097bf295, 0x177c55a8ec915fd5 }},
+        {{ 0xea24b65899c8fe24, 0x841c4fc5005f519f, 0x3baa6f83924f5d55, 0x2557e1219c6b8311 }, { 0x6c4086ca0ea34d86, 0x41bd35ec09d1c3fd, 0x432dbe60a1f4f112, 0x32359fceaad40a54 }},
+        {{ 0xf98be09dfb16b40d, 0x3e88aaf227e75009, 0x4f1479f8fd672994, 0x2e41e61d3e670502 }, { 0xb5ab9351ca2685cf, 0x6c608d3e4571439e, 0x3876edabd1fdd7fb, 0x23d0fc900e18fab9 }},
+        {{ 0x8a0bef20548d18cd, 0x6ab81c557bce8785, 0x13f651ae2f2b9fe3, 0x161221efdc3a1840 }, { 0x506b2c966498a912, 0x7c65970d3e69875d, 0x3ac7e2f81225f785, 0x2bde30032d896700 }},
+        {{ 0xe4c2e7ae19de0da8, 0x0220365ac2b0c074, 0x6d7272067f8a706f, 0x2e6ddd3939025e42 }, { 0x8932c7da5775cbf9, 0xf985760c494df2b4, 0x46be7741fd6ac3e3, 0x1a0f30fc4c4d90ae }},
+        {{ 0xebe0c688e568a304, 0x45404f7306cea0b1, 0x798b638b2dfa84dd, 0x140c8550fb17a252 }, { 0x5045b9d74499ced5, 0x2562d0124607a7f8, 0xbda9406f420c6d30, 0x10e298a046f7b062 }},
+        {{ 0x32c2557cd2b62ddd, 0x5e9b81c07f7af052, 0x828d684d7247e3f5, 0x3bc2466f63c1cf77 }, { 0xf6295c8e8b4fc540, 0xc7fc421457470df1, 0x1121259bbdfbd52e, 0x02c9defb5816e1d1 }},
+        {{ 0xb615d857710bfb7c, 0xb62c0e9b486302b1, 0x4c7d2383a3969a79, 0x2825db37c829d0be }, { 0x354c44257fcb9e8d, 0x4e19343eaad6e32d, 0x2f0c19ed71ea6fe6, 0x2bc77f58fd6c0b0b }},
+        {{ 0x56571338f9b7c72c, 0x1e674c3d926a0c6e, 0x23fef9e22525b71c, 0x2719a1752ecc22c6 }, { 0xccc78ad3dbe8934d, 0xe08a55fd35769a81, 0xa853f475b8be524c, 0x2bc7fcf0e0147831 }},
+        {{ 0xb34c565d13a7c80f, 0x9438aa6b23233eb8, 0x0109649851331643, 0x0d8a9b52cc28be1e }, { 0x408cb9ab3a6256ff, 0x18f89d1d2e9bc9f6, 0xafcf2ee604e59553, 0x0be7d1dd9604a57f }},
+        {{ 0x32498d1ab7833c05, 0x1f90ffbd7d65dc4f, 0x6518b33940f29884, 0x214b51f6f3fb2173 }, { 0xb230361049fd2a1d, 0xe45768934f2c8add, 0xe45f55cfe308f772, 0x15acf9fa1ff827c2 }},
+        {{ 0xd09d4e4cbe3810e8, 0xf4db73c002a2852f, 0xf8afa0d200df8e70, 0x384c64b05b5c3ebb }, { 0xfdd0c6a725a0644e, 0x730e104afc4dc809, 0x7621545c004f99dc, 0x06f841577537c652 }},
+        {{ 0xb2e9645d2bdf2823, 0x21070489ee91240a, 0xd5d9020b3009eb4c, 0x01c7e18270e9ac70 }, { 0x62079ebdbf36e6d5, 0x3fbe031bbd7a7a64, 0x9d11e850281c50fe, 0x12c867fc5970e898 }},
+        {{ 0xb8571ac6df3417d9, 0xe45ca9568595aa9a, 0xe93bc365941fa836, 0x2c561d5cead1c55b }, { 0xeeaf03bb2cdbfd73, 0xf6d3e7d9f7525ce0, 0xa403cba386883458, 0x326007d5f1eebd03 }},
+        {{ 0xd621402614aaf20e, 0x60d8efd9f4a557d6, 0xe2006aa67aa935ab, 0x38c020fd39ff9805 }, { 0x051323457517538b, 0xc492a41f7f5725f5, 0x78d4a0b924aa4245, 0x26aeb2ae175b31dc }},
+        {{ 0x903de8c443b268f8, 0x6d99d98e212436e8, 0x5442a96ff52c1083, 0x0f16c5489b806a1e }, { 0x2fafb71f07fa38e8, 0x178b3efe691050ba, 0x82a68015d5e9b118, 0x27c2253f00ba7fbf }},
+        {{ 0x6ad9e00496378f59, 0x33a9fa5d73b6577d, 0xc7f6c5dc74d10857, 0x1da15be7cf770c77 }, { 0xf99ac279ee528d99, 0x66c872e300f59cca, 0xac609e4a7877b411, 0x380b862ec5c4dfdc }},
+        {{ 0xa9e9a0380d334f63, 0xc4e288f4e0aee0be, 0x4f0ab5311f70215a, 0x2f399f0a1a5da9fb }, { 0x49006bf82178bd34, 0xb46ff2097d948b55, 0x73aee4d07e15543d, 0x388e51771b48cbea }},
+        {{ 0xe7339e2f4ba84ccc, 0xaf2d210fe82051b7, 0x9734eb42c9fc93c4, 0x2056e0e06323ccdc }, { 0x43491bf3b6e9525c, 0xaf5e357f76e39302, 0x52ded157723b5b95, 0x0cfa35ebdd23f7df }},
+        {{ 0xe2182a6632ca1456, 0xf62fc77b46ef4bff, 0x6c5a64a083dc3818, 0x03f35170f0d37749 }, { 0x248e6f5e4b752ef3, 0x050c24341cb2ff0b, 0x808d113426546351, 0x05790abd8f5f6c9b }},
+        {{ 0x6cf821e36804f42c, 0xf333603103773b58, 0xdc5a3a6abc972d37, 0x31ab0875e285ba2d }, { 0xb80aa54f83f14207, 0xc141e162b04ca061, 0xa900fdf7edf7230e, 0x3c4f16103b3762e4 }},
+        {{ 0x2e50d0c399dc5d82, 0xdf4d9abdf4902c57, 0xec723ccbb09b79bc, 0x19e761d767d16920 }, { 0xb044e0272477d0b6, 0x092ef532bf520842, 0xbb2b747e87aa47dd, 0x0bcae762c648db15 }},
+        {{ 0xfba77a9d1714a5dd, 0xc2cd611a7dbcee88, 0xd7baea182d5dd264, 0x285f8e03cdd8487e }, { 0xcc6748166de26ea8, 0x3b9a39729b35c1e5, 0x349ce45ba27b08e2, 0x1d4af3e47f35d079 }},
+        {{ 0x2684432b195d0a07, 0xb168a8679be1a724, 0x90bb62ce25b3a65c, 0x2531cde0509380d5 }, { 0x8b4493bde337e7b9, 0xb11bf264e931b388, 0x6cec42eaee804334, 0x0794a3ffb7cffc6a }},
+        {{ 0x631ba3d5187cc0c1, 0x1f5daeaec3286ea3, 0x81f59924a1a73eaf, 0x35adea18c8d50ef5 }, { 0xcfcbf404edb760d3, 0x53289dc6e8b13b12, 0x6c2e34a0e99cb5b1, 0x332d4158f4d43387 }},
+        {{ 0xc5fe6ceecae12788, 0xd358ad4687a15a30, 0x3e32b925dcac96ad, 0x3b0892bb63e22856 }, { 0x3252ebbea5d8ffb2, 0x2b335a59768863e2, 0xd3b8c8dc67989e4e, 0x08845c7f7f85b962 }},
+        {{ 0x899d8442cfc899d9, 0x2a0c6e72ae6f488f, 0x95d5e20f0a7c4d74, 0x26911203cbd3d7b5 }, { 0x76225d5db6835720, 0x73528cf2ac7800ba, 0x231bd0f32dc277a7, 0x3977a29e96f9c754 }},
+        {{ 0x6b79706fc212173a, 0x2a248519164d8ae9, 0x23c5a2cd180c183d, 0x3933aec2ac7f5778 }, { 0x56b3f7fb96f2bc5e, 0x0017c31ba2d0060d, 0x5df18a7d89fb8e6d, 0x0b68f7e785ab42b9 }},
+        {{ 0x2655fe7ed5d6b12a, 0x48d19a4917478d36, 0x9b5961f4952859bf, 0x2bfcb8a87c240bc4 }, { 0x5762e55881ba2b81, 0xbcb84a0208ed3be1, 0x6068cadb276d477b, 0x27f07dde2a8b31d0 }},
+        {{ 0x0b4bcda3c5f51262, 0xc2ca9446b45274bb, 0x35889f5c5f379456, 0x2634b89779af2265 }, { 0x3012980a0c2632e3, 0x1d970faa1c3da05b, 0xee9e5ce77bb36085, 0x24514a3c2b89b5cf }},
+        {{ 0x0bc04b2867a1bfae, 0x777cd9b9d31a3cfc, 0x2b6b0cf0fab9ba74, 0x135cc352d50557d4 }, { 0xe95e66e26bfd23d1, 0xa7b9cb99401b96ef, 0x3f3408f4fbff61de, 0x26dd34b836f7b0f9 }},
+        {{ 0x9402606355d46127, 0x67d5cdb8dedb5a6a, 0xcd10db78a4ce1861, 0x1f5d08c8558c4103 }, { 0x671ae142ba8367fd, 0x128f6256bdd1c9bd, 0xe6d68e3cc078e3d4, 0x3533277ba30f88a2 }},
+        {{ 0x59ae73cf4960719c, 0x0791b83ca1f0e5b7, 0x332e4e6f2ba9219f, 0x23c19fa71a0e5e07 }, { 0xc9158c98fe9cc9a7, 0xfcb1912a846d545a, 0x5783c0fc5e449305, 0x1eb2311d3d96c035 }},
+        {{ 0x9040e30929d05d41, 0x842814ccb38c2065, 0xa4a4371c194b6221, 0x2e1844fb0f097b78 }, { 0x7df6881556061613, 0x6fbdd2cf77ed5131, 0xf4146d1b211250e4, 0x1555f542c6a6c4fc }},
+        {{ 0x6e180efdc6088f87, 0x7b045f1797ed5a10, 0x76bebe4076951e91, 0x3010766e64b9027d }, { 0x1eec9d0e41a566e1, 0x39d34363d3ab35f2, 0xe25ff02e2bc3ee92, 0x03970abe427305ab }},
+        {{ 0x2887b3059bf94bec, 0xde85d7ed4949f485, 0xbe5a791763a6d4cc, 0x00acf56bb7cf9043 }, { 0x071c151c96524510, 0x205f1f8449d5b614, 0x838b0ec96a06f83f, 0x2b04a4479500085f }},
+        {{ 0x4e34d7645d0d0368, 0x4f2d97c1a87c578d, 0xc19ffb992028b13a, 0x14ebb068f050d4c0 }, { 0x5bf0d140b694ccea, 0x695b45685946e68c, 0xf326ab4f21f0d84f, 0x28facf0dc1af1a26 }},
+        {{ 0xc79120f25f5ffd93, 0xf1278d68f240717f, 0x2f1e6e2eeea3fb8f, 0x2bdf2240d040d446 }, { 0x7766f8d3eef18fea, 0xed146ec4210a9284, 0xd6dca2a7ab2bb88c, 0x27dceb05df18a81f }},
+        {{ 0xa69177eff22fe506, 0x7ea217e2d8d4ff6c, 0xceca7f1503c156c9, 0x228a212bd7cacce8 }, { 0x4be71aea8463b502, 0xa30a96df56abed8b, 0xb6efa7d8a140a836, 0x0193ae235e390fac }},
+        {{ 0x30705255695edecf, 0xbe5c0ccc59f415ea, 0x9a75ecea91f18f08, 0x0af8d69083ec3e04 }, { 0xb40fcc342c416fc9, 0x227e907897f48b71, 0xb882d58026bf41ae, 0x25e808a754f602a6 }},
+        {{ 0x55f4ba4978150e50, 0x715d88deff711238, 0x8a62f19e265980fc, 0x1f8652022a509a2e }, { 0x9cfe259d1267973f, 0xda1eddb941945ee3, 0xeb8041cb7dbcf54c, 0x29137178ee6ac50f }},
+        {{ 0x03ba76d4e22d58cb, 0x40a8a8da7c21f1eb, 0xc942dbc19c9167e3, 0x130474afe38c43dd }, { 0x78b90e05ca015545, 0xf3abb1988376aecb, 0x3f4cf50c9a2c6445, 0x02194b7ca8fa6b81 }},
+        {{ 0x5dbdb6e0e331b394, 0xe20f36894995ae98, 0x7871eafe8e645579, 0x1ccf8366115ac2ff }, { 0x7c14b6253d0e9614, 0xede967c3b7f99fe6, 0x7f88305b716d77a1, 0x358b70e73ac719b7 }},
+        {{ 0xfc736278a0594b85, 0x07fb4d24cd7057eb, 0xf0705b7d599511e4, 0x0fc711322b0c3416 }, { 0x739876d8e4fff84c, 0xec23808cdd8e9ff1, 0x46b78102139a1c00, 0x14e0f4b7c7de2201 }},
+        {{ 0x77579631d5ee44ba, 0x95098e4338075b78, 0x0df278b9feb068ea, 0x3953417b47c7e815 }, { 0x64774aa9d3b70b4d, 0x37c495f0289ccb27, 0x90f01a9f3a4c68da, 0x213d0687e6639ac9 }},
+        {{ 0x8551449993defbf7, 0x9fcc2a2c2470e7e0, 0x745ef3b1b76ad840, 0x3dc0d1236ba6c3ca }, { 0x7e5b2c2afdf4a665, 0xb54a3b035d113fea, 0x96b7691c5d74ebcc, 0x2fec98b83630520b }},
+        {{ 0x2aaffa4feb00b0df, 0x79132de69469170d, 0xeaf3ef16e5958061, 0x3ab6c05629acffda }, { 0xb27b926ca9c81f2f, 0xc58d61d6a08ed9a1, 0xc6e4fb1b69c839db, 0x1c72add8686cbad1 }},
+        {{ 0xcd613387b7d39f7d, 0x500c8c0e29872166, 0x430993275b9d44cc, 0x2ea5aae974dc17ac }, { 0xa7b23a69ab3f3e86, 0xc0eda07ef8329971, 0xe1ca726177bfe356, 0x1638dd5ad7c7013f }},
+        {{ 0x0c6511b94a47c401, 0xbe95c3d8403937da, 0x7058393df45435ea, 0x2c0dea3290c67a78 }, { 0x0ee7cb4e9f4e7080, 0x9f37b8120f7f39a7, 0x849176b3b287dbad, 0x204e1e18a1e30a0c }},
+        {{ 0x3b0ccec3365a35e7, 0xa1d02c1ef7825a15, 0xc736da67d0d10c04, 0x12381d63bcaa348b }, { 0x822c7829ae0cfa19, 0x26a477591d08d0e1, 0x278f995fea28e858, 0x258dec4688dbf172 }},
+        {{ 0x0c2d7c6e176bb0fe, 0xa4839536277c81d5, 0x83dc000f4c7978e7, 0x31542de566d24523 }, { 0x4fec0621e1c9c366, 0xd25db8a19fd24c8f, 0xca09db7fd73377f2, 0x09e2886e08cfaad5 }},
+        {{ 0x8dd790c6e246c7a8, 0xf1ad61b019f9c5a5, 0xc6dd52bdc794adcc, 0x39cbc1b1982dcb4d }, { 0x373dd0776e9025a1, 0x3b3c7eb5900d0eca, 0x168a52fd66cc7142, 0x0fb2eb3c56b5f616 }},
+        {{ 0x1f223ad626c9edac, 0x810b7292c01bca64, 0xe209330f2c850ca3, 0x1b528770d09540d9 }, { 0x26396991499b0ea2, 0xe5a89cea651a870c, 0xd02b1707318e38a9, 0x38fe5a38cbd98b92 }},
+        {{ 0x5fe6ae1ca931507c, 0x7ce2fd485a801b13, 0x2f065a12877596fb, 0x1836c5eec2b77c25 }, { 0x165fabeb1736c2bb, 0xdfbc4f11a4fcb5e2, 0x3d940f36fa2b557d, 0x155ea73937ed118b }},
+        {{ 0xb2cb607c79a58e5e, 0x1d937e6904e00dfc, 0xb4415c071472e134, 0x1b2b8906c083cefc }, { 0xcb0b3e60dde820ce, 0x408a9ff9e73337c9, 0x1b8cd3b0dd128b1e, 0x12dc3717fcbb43dc }},
+        {{ 0x662afe6ce3684953, 0x6caf0489ab513d24, 0xb1a53d0fdbc23850, 0x0f5c0dfd0fe1a979 }, { 0x581eea123415c3da, 0x3a312c6f25bc59a1, 0x01bb2c3f4b477e55, 0x134a58422e6335ff }},
+        {{ 0x03571b146a5e3e84, 0x5f3d280652da32da, 0x0902b5265a1b5064, 0x087369dc8569bde0 }, { 0x7d4fe664f4312fec, 0xfbea84f14e439b2f, 0x8769f3fb647984d9, 0x3f08d2cc2018c2bd }},
+        {{ 0x640dbd8522e9a9ea, 0x8a57a2304d52fc21, 0xc99a30ae6fb6fdeb, 0x1a68888e4b80b1e9 }, { 0x061020c7e274d53d, 0x16b6ca8fafdf2272, 0xc55221f63776b7b5, 0x3313c1f51e22af3c }},
+    },
+    {
+        {{ 0x80bf35c692efc568, 0x3356043b608be65e, 0xb1af0d6988abbb24, 0x06ffeb38336f1ae7 }, { 0xdb488e044b28e2c0, 0xe58fcd39efc0657d, 0xbf9d4729e524e597, 0x357bca9deb687735 }},
+        {{ 0xb76406b6755e9c9a, 0x3b0ef6e42561581e, 0xc20f6bad13dac4fd, 0x18e7700733e68cf1 }, { 0xf833e869bd34fbee, 0x260cc1296327caa6, 0x8cf00f6014a76236, 0x044fb050c4095956 }},
+        {{ 0xec096d108ef4f006, 0xc8071c5861489861, 0x214468e4192854ee, 0x1a203d9e3b446010 }, { 0x2f7a0b747466c4c8, 0xfc30e25e613be013, 0xaaa989cf08419388, 0x2de56ef39cceb04a }},
+        {{ 0x0e1acfe003350149, 0x10f3121e9e19017c, 0x9991944c5ec87c90, 0x377d31d142751327 }, { 0xb1513dfd72105afc, 0x2652726065e127b8, 0x522af18626f29a3d, 0x0480434e79dcefe1 }},
+        {{ 0xa934f4412b527f20, 0xfa89235f99c2ed0c, 0x6bf665c8803d4997, 0x212d2cd8fb92700e }, { 0x8e1f8b083b268689, 0x47916e20e3ed11e6, 0x5413335d359e884c, 0x1ad6f54353ec01c9 }},
+        {{ 0x0a57e09ecb882fc6, 0x4ceb72efeeb2459d, 0xf2f5750b27d0538e, 0x13027024324a0bb5 }, { 0xc2a539764fda9d49, 0x47be412907790ab1, 0x628fb4f569587f61, 0x2494e944ef3ad247 }},
+        {{ 0x7047bd7affc15cda, 0x22e07da7be2b3b66, 0x0a48243fb7c4a0aa, 0x04ab78cb5cd0b061 }, { 0x719809d5837fd28d, 0x140d789cf7b6bd67, 0xdf32c37754b7d59d, 0x27f32cdaa8287acb }},
+        {{ 0x9d55c637247e3083, 0xc7cc2a97f34c1a7b, 0xdd79a862c64200c9, 0x272a9a746768a114 }, { 0xd092fa9ccc9a279a, 0xa6952c08ba8797cb, 0x6c528bc02e57e346, 0x12522b205bba3a57 }},
+        {{ 0xf87417b33caaa9c5, 0x4f2898eeec413b02, 0x53eace91ed7b06c2, 0x12ac5809cb77c3b0 }, { 0x6425fde97b9a5e3d, 0x3c4859519dd36624, 0x67cb3a849d1b7f92, 0x3467e1c8c55dda3b }},
+        {{ 0xc9d319d357ee97fd, 0x29cb3555d6d7854b, 0x73dff86715187702, 0x1f7b18bfe62841a8 }, { 0x09ad7911eb78586d, 0x71dd3a27e53656de, 0xebb76ade667a9bfd, 0x2e6ef9d16f52dab2 }},
+        {{ 0xe1c155b876b2b7d7, 0xaba3d45ee3ca2d7c, 0xbfd056dbe3743987, 0x15ffab7c2d2147b4 }, { 0x3df4f4111605ef96, 0x505c7a88c6e869ed, 0x349f45e7ab294487, 0x378d36da31f93105 }},
+        {{ 0x66661b4aa1e9f435, 0x0318e605ea76a6ff, 0x7fcd428d28eb7cae, 0x0fe0043ced6670d7 }, { 0x203513911972b0d2, 0x3f0dd5544b9556ec, 0x9bb11f4ca41dfb43, 0x22133f1737c532bf }},
+        {{ 0x671a213c4de72ad6, 0x747d106634a7797f, 0x9be5f9af8017ccf5, 0x1532a9a0d6098f8e }, { 0x00fa1d03d0ab2a6f, 0x82b3296a1fbcc0aa, 0x4e8c160328f1b587, 0x180b66b4904befcd }},
+        {{ 0x368b15acf81bc9e6, 0xb9a10d59af3b1219, 0x958e8776b53c12e5, 0x366f73d90ffc12ce }, { 0x8042cd19839b0dcc, 0xaef1a924cf1a9cca, 0x0ad47d24a7dc8c97, 0x175097e26e8f65e0 }},
+        {{ 0xef3588212fa0f0c4, 0x671c374b2718231f, 0x550c69c51323ed10, 0x2afb95e6d0ab62db }, { 0xaa876f6ca939ed04, 0xcd55522aec444ec9, 0x1ad7057d405f7549, 0x12c78823b1cfa6d4 }},
+        {{ 0xe5f4c6d5ef492dad, 0x9b5f8a0fa83e3d44, 0x9ced6f5bd20ea36f, 0x0a50309edeb6025b }, { 0xc2d0884631e1780c, 0x331876990528d7b5, 0x47e57142d6885b60, 0x07f200e5a2eeaf74 }},
+        {{ 0xdb028ce21a3cacbd, 0xecaa3447dcb17cf3, 0x5b406f86d8888c45, 0x140253f908f75671 }, { 0xa2ed65653a57f827, 0x96be93e38f88ce36, 0x7ddeae52dd6b9af7, 0x3cac54bf048934a0 }},
+        {{ 0xcd749e2d95c560a7, 0xd539f75ab47b830a, 0x222ced92d22ea75b, 0x3429fc99c9c7ce9f }, { 0x97e6feec2a2788fd, 0x2b8413114d3983f3, 0x23bbd51b6fb0efe8, 0x2493425517b55457 }},
+        {{ 0xd456303fc08adbe1, 0xa0d6bf38da97cc51, 0xd6757cc2ef38be25, 0x37ac1c55bf89711d }, { 0xe26e69f67b5c4b14, 0x849356177e5b8b3e, 0xb7203057ff471e12, 0x010a3a8514a0e3fb }},
+        {{ 0xddc1a6df0fe03903, 0x2bed874f90e31565, 0xc42efe7a9ef8d9f2, 0x31c480571833b100 }, { 0x6c99a38c0fa96212, 0x10ea1cabecf2f541, 0x5b110c9ce1cc72e6, 0x34bfac78772524a4 }},
+        {{ 0xc8603731340bfbda, 0x1c376ea480fbd28b, 0x00a7e35a20b7ebf2, 0x2682f9989ccddd11 }, { 0x218d3389b5374374, 0xcb041d40e8680a30, 0x83f2418fdff21db8, 0x248136aab43a299b }},
+        {{ 0x2deb8d28559932cd, 0xc0de994baf6564d6, 0x114a81ab3e90b961, 0x3ded2e4026304b14 }, { 0x554480b43abe316b, 0xdc4515dbbe0488a8, 0x09553197686843ae, 0x2aba823a2cbeee99 }},
+        {{ 0xd7cca55967ca25a7, 0x78ebfd22a153abc2, 0xfca6e253753363fc, 0x301884e378162d6e }, { 0x84f82568ee7ad82f, 0x60ee2b493cba6f69, 0x91fc609b1e9b5f7b, 0x3679a983d1b2ed26 }},
+        {{ 0x6f550d4cdf1474c5, 0x3d42e91f9001b694, 0xab994d334f638f2a, 0x10b124b9aa73dcbc }, { 0xfe22e0406971c0b3, 0xcb8b1af5b3a374d8, 0xe5c25b8621316b6b, 0x20aa85b106187bee }},
+        {{ 0xd0d9b16ea7a184df, 0x62f8f95984e5cfc6, 0xe2223732037c2aa3, 0x3a1cd919788e8048 }, { 0x4a22f462c8733c46, 0x77bc16af329a87db, 0x53dc15b0bb88c490, 0x02079998a47c392a }},
+        {{ 0x0dcbaea44b5a1652, 0x76115378ffe6d1bb, 0xad17eb82c7501409, 0x2a8849bd1abc332d }, { 0x6982a71170652c36, 0x0b9c8a29d62395bc, 0x041ae28654099c9f, 0x21ba140df4f81895 }},
+        {{ 0x277cb8a04a598170, 0x69b97b08c9d5ef84, 0x348f13850aa0951e, 0x2c2cf13b3b5aa9ce }, { 0xc882c70569549374, 0x66babd99660495c9, 0x943c6e801d818f3d, 0x154156b6d36a6fcc }},
+        {{ 0xb0e1e7402b56e903, 0x46c9eca98d6bf3b2, 0x780800019133682f, 0x068dbff13e3ac2d7 }, { 0xf73c905cb11bbe9c, 0xc8e29eba082056e9, 0x66222334d44e9ffd, 0x25c0446801625d2f }},
+        {{ 0xd566690511a52c4a, 0x789aa8572f9233dc, 0x06a1faa0ff8ec4e4, 0x2c3a9989f5edc554 }, { 0xeff6dac9cb948be0, 0x142e763acc0248ab, 0xd5b0ca45e4bb24d3, 0x04eab515c7504af8 }},
+        {{ 0x227305d0ea0622e5, 0x75b1635978e48be9, 0xc813d030f5190460, 0x04376ea4beac37f2 }, { 0x3d8eae156dead841, 0x61aacf814c63cc67, 0xa4fce81780ae63cc, 0x3bdbf410c9562b8f }},
+        {{ 0xcd05076b87f2eb59, 0x54e5c3365e5b780e, 0x997dd41c117bb5b6, 0x2bdaf9796f9abccc }, { 0x9b7cfde323497a68, 0xf277455d0ce199ca, 0x53c987b20ed56b1d, 0x1def0d01b44425ed }},
+        {{ 0x2e78ea649e3d9cf1, 0x17dabd20c24407a3, 0x3d58acb0232735c2, 0x39c49354f17d5d3f }, { 0x042e6ce7ad6aa22b, 0xea607f68606c42cc, 0x2f760e7cbcf2c3c6, 0x3872c0c14d0cd3e2 }},
+        {{ 0xa8e953135199f6c3, 0xf99144b67ed70ff1, 0x772a57dcaad4e0e6, 0x3a518ed71ab35b29 }, { 0xdf30a0b2e7bdf491, 0x8f892f69071f17af, 0xc148623fcda86ba9, 0x3a44eaf7b38d8578 }},
+        {{ 0x96fa99f09ecef19d, 0x8751be7e1aebd61d, 0xeca412a9e1aa25bf, 0x16e06cbf22d5d092 }, { 0xaa216203036032c5, 0x79ab3a166bebded8, 0x08e9aedff02d0368, 0x156f1d4ab6027528 }},
+        {{ 0x1fcfbacb6e4e301c, 0xef393941c1e12130, 0x1d7df755a47dc079, 0x1cbed504dd45bd83 }, { 0x9ea4c695ea86a4de, 0x5b31afa281d78acb, 0x36f4c8173cc49832, 0x18f514cb81b64bdf }},
+        {{ 0x113d5667928cd8c5, 0x5f39792cab984243, 0x9c7d2ba84ae634be, 0x15e519b10d578cea }, { 0x3e90b69c5759f455, 0xebd8727e2509d90c, 0xffe4eb31b245e22e, 0x2b042eb2c18f93cb }},
+        {{ 0xbde4a4208a61b21d, 0x7cdea7b89a2fb873, 0x8847026bfb34e8dd, 0x3ba8fe91ac81cb5f }, { 0x8e392c5ba6bbf524, 0xc600d82b71b720d5, 0xfa87e2a95409eaa5, 0x389195c63de4ac7c }},
+        {{ 0x401f5fa2d4df2d2b, 0x421941e46a73dc4e, 0xc9d4527031699929, 0x0ca704d8a06d3314 }, { 0x8efcc076e3b1c1b3, 0x4235bc6f1bf0dfa8, 0x08db74c985961032, 0x0bb7a5bbae8d0115 }},
+        {{ 0x5ef7cdd872ad880e, 0x6f6a2062b8ce76cc, 0x66c56044b4def1f4, 0x22d2ddad352f3334 }, { 0x7c38f460a1207305, 0x429502e8a6adae3b, 0x3552276bad5d4a73, 0x18016c38971a6681 }},
+        {{ 0x9120352e327326ee, 0x5acc0545ae5087ee, 0x015cec90cf598174, 0x19a13f6197d27faf }, { 0xb118046f61f02d79, 0xeca267f2a28d428b, 0xbe8b700ffc4c8122, 0x2ff5aa1fa58bb296 }},
+        {{ 0x89b00ae04e600ba5, 0xd62111950bc74971, 0x6dd3097ceebc24f3, 0x12dd7e479c3dbaec }, { 0xe7d0df1aead1dcb7, 0x338d74f039da4e10, 0x84ace72f577b1351, 0x171d03ca615fec3a }},
+        {{ 0xb513859d5eebf010, 0xc0500489f3587530, 0x65f61900021c5b57, 0x0c14fe0aa590c32f }, { 0x23dccb8438993b1f, 0xc2b753447e102658, 0x47cc0565d26afc43, 0x0f8d26cb5efca878 }},
+        {{ 0xdaed3c41b8561262, 0xd14f6d50cfedb81f, 0xf7cae576a2faf04d, 0x05c5b0ad33fb8299 }, { 0xd2956dd1a1dec7c8, 0x7d8b7b891eb88f9b, 0xa7a29465dd56741e, 0x0deb54ef0cc7c18c }},
+        {{ 0x7d5712a4e5c7426a, 0xfaa5d3069523fe49, 0x64b6401998a8ff73, 0x182ee6c6196a79d1 }, { 0x6c0c1190b087745f, 0x3fcc4bfec7caaddf, 0xf097920d3afea7eb, 0x1130e56b078422aa }},
+        {{ 0xe28e1a09bd079a22, 0xece4282e17a7b9ff, 0xe86746bd9a83d2ec, 0x3eeeb62d773233a5 }, { 0xaf46fe23efde8511, 0xfaf03b97d67edbc5, 0xf9e160ddc0611e83, 0x192a069aa7617abb }},
+        {{ 0x2e8b0eeea878ed2c, 0x6ce1bc3d47b8436f, 0xa795b38228e9be4e, 0x02de5ed82cfc0c9c }, { 0xd3cb4ca5dec586c2, 0xbb312070d3301262, 0x67e218390e0e5343, 0x1e04c76037de384b }},
+        {{ 0x2ff04d9b90d7336a, 0x1469d5a6529c780e, 0x0ba183c70c03f950, 0x1a3be0a5d97c74d4 }, { 0xcbd5813a0571a499, 0x2e602e3622d85832, 0x06467597434baba8, 0x2c6c08c0c4f3bd20 }},
+        {{ 0x603b6715dcabad94, 0xeef35d2b6624154e, 0x063f80dd0fdf2048, 0x082094b59c31f1ba }, { 0x57b83d73cae597be, 0xb34b14e853cc2302, 0x15b7f5c74baa30b8, 0x114a79e68438411b }},
+        {{ 0xbe2d99c0d7e2cd9e, 0xa9bbc4965ff89e41, 0xd5deb7674f47df71, 0x27c118c010af0507 }, { 0x2be6d3369191fbaa, 0xfda2d168c6e3fcdf, 0x32514b658cdfb621, 0x242fc42fe7daca75 }},
+        {{ 0xab5f5428e9ebf838, 0x0ef77a5a5d8aeceb, 0xe59f95906a0a80c8, 0x0779d7856445dc35 }, { 0xc93c55a64fa1809e, 0x794bbd338f4f82cb, 0x04882f97ff5b6e7f, 0x16ccb1a9e0e6d41f }},
+        {{ 0x85a3f35c7a56d9f8, 0xc1b42e59e7da434b, 0x13b63717a6b96d05, 0x250562ab8e203211 }, { 0x5ac6d080291a272b, 0xb4d24e6076ec1672, 0xa7a99b5b7710507d, 0x27a6e0866f15b6cf }},
+        {{ 0x5b914bd2765c63cf, 0xc6e312eb649d9991, 0x5bdef84c2711b85b, 0x129c19bba0dd0e05 }, { 0x11f363673b8483bc, 0x32ee33fd04789607, 0x05de15fba97ebc98, 0x10c7978ae3aeaa6c }},
+        {{ 0x42d4a11aec50ff38, 0x2a385a8cd149fe7b, 0xb95008fe1ad3a569, 0x377a2bdf96970c8a }, { 0x724a3e45db5bdcc4, 0xc1b484a435083bdb, 0x86a157025bdce56d, 0x1d275a09e3234d4b }},
+        {{ 0xe2d2983bb9ad2b5d, 0xb972c337cd756d9e, 0x0776a7b938608367, 0x2600f21bb5af3644 }, { 0xafcd9538ccf61f4d, 0x9072258d729deca5, 0x6ac2d00cd503d856, 0x2fad900bc1e226fb }},
+        {{ 0x00a9a3f3c8ec5372, 0x35d64629e9e94a47, 0x888db5a5af3fb592, 0x13ce246b97765f7e }, { 0x1bf8cf5a996aaf67, 0x0f31e0625ac27c28, 0x5ef22c3db1901e6b, 0x2a4d7d46f723b7df }},
+        {{ 0x8ff85b80e30d54db, 0x8ef426a9bfa72226, 0x9da48aa120692a9e, 0x1cd21d7e9e163aa5 }, { 0x4279ac133db5395a, 0x786f3629cefac468, 0x5d44532b074f7e22, 0x1d6e00042317e738 }},
+        {{ 0x2624b2f823b16991, 0xd694e96be15df080, 0x12e6439c1cb359b7, 0x2c05c9c0c749977a }, { 0x61a67800bd7a050b, 0x1cc6a43163767ff1, 0x18dcc2925ebbce81, 0x374f846bca3e67ca }},
+        {{ 0x3c3683fa7ea5c701, 0xd424fb5d122e3ad6, 0x54d815f12235ec46, 0x3e3eab2aa8301c34 }, { 0x41d22e1df154dde2, 0xd3c92f5d34a397bf, 0x23e5d1821c2153cb, 0x086ef0b84f5f87c4 }},
+        {{ 0x89514d3be27bd8b1, 0x84e65c93dd481000, 0xfa09f2f8cd2b4ee1, 0x26c233ef1964921e }, { 0x428f499e2745cf76, 0xdc1d1920da0bc085, 0x7a1bf3879f381a71, 0x21656509fc0bcb1f }},
+        {{ 0x8b5a064b82abb436, 0xb09906f52b04d45a, 0x432c839e8bb91660, 0x347adfa83930d0b9 }, { 0xb6730065c7dc1014, 0x91011ba6dd5905e0, 0xbce2c70397669e57, 0x1ff815fe27705ce5 }},
+        {{ 0xb021e64dcdedea18, 0x0994957bd9d2d5dc, 0x856e3cb1fcc58ada, 0x0c99d2acd2e51d6e }, { 0xf8f5d7a568c3f21d, 0x56f748510383fd07, 0xd8c81c352e771a28, 0x17194c5aa05f25fb }},
+        {{ 0x085d6ec737b34f13, 0x5b4b0756c1d64920, 0x548bff87e510bda3, 0x04c3b7b7bff4bff1 }, { 0xc7ebcc5fcf54c13d, 0x3c40735ac954e730, 0xc13797bae2c51b8f, 0x29e5bfd03e64f8e3 }},
+        {{ 0xc2d0de0544612dcb, 0x9daae23a9dd4f616, 0x11d0b742b2c9e46b, 0x1a3c132efb45a840 }, { 0x6c84b89c5491a899, 0x9e37ac1ab95ebeab, 0xf229ebd5db21a801, 0x27f9bf17eb49fb44 }},
+        {{ 0xcfe1fb53a361ae1b, 0x2cdf78a0dbcc377d, 0x999df2b8b73d1c47, 0x035a49223ffe64b9 }, { 0x582291932a183d54, 0xe9fcacc2e4c2c1a2, 0x8c104775e5e95372, 0x3d62016620d682dc }},
+        {{ 0xea66d43a99ca5feb, 0x9761bfaff1363b45, 0x8316486124d59225, 0x0c2050d00128998d }, { 0x52d57c681142b33c, 0xb38f1a8281bb7c74, 0xd65df5af7bb14205, 0x2b214f77c76e333a }},
+        {{ 0xc9eb24fec7b34030, 0xd8d65e55a4cf1095, 0x79086867eef52fbe, 0x2175229b86137209 }, { 0xe2fa069f7b7b3283, 0xc5d9cf1530e4da56, 0xfcf4cb0039ea3084, 0x386ab398f1d141fc }},
+        {{ 0x1af24ab38791a975, 0xb68f88091be15264, 0x55b6f5ff716bb811, 0x314f37ee8eb71ba9 }, { 0xd974bb7f1fc19899, 0xb31cf70e5058795d, 0xc0be810f9e27af7a, 0x2f06d203e9d71e94 }},
+        {{ 0xdbc87cbc9ed84333, 0x4dc932f004eec9dd, 0x2553a179b99bd3b0, 0x2c6996a56486bd40 }, { 0x17f27b694902fbb7, 0x306e8068c37b702b, 0x3dedc1bc31bc538e, 0x2f48f54cc0501d5d }},
+        {{ 0x8dd68368f4d3cd81, 0x8f039e5259dac842, 0x0e01efb7994b29e5, 0x0fbf43af18bd2470 }, { 0x8889fa201f6a226f, 0x03b532a07e902e2e, 0x29fd796f92e5ad7b, 0x3839bf5323544b01 }},
+        {{ 0xf2af860ef36944fe, 0xbe1763a6bd42f10c, 0xdf00daa91c16b9e6, 0x3bcdc649c976c962 }, { 0xabcf7204a40a500e, 0x047d04cd443df5ec, 0x18abbaec7dcd299c, 0x0c181ec5b231cff8 }},
+        {{ 0xb0ade5952badcb37, 0x6194a0d03ac8c1cb, 0xf10f006508818deb, 0x1ce20b1c2d105132 }, { 0x2b95c48fc1227b74, 0xd425cdfde91be837, 0xdbc678809b96717b, 0x19a31cffc470b070 }},
+        {{ 0xfbdf2a1ff1f72bef, 0xa0c124b6133dd652, 0xf145a6fffc2158bd, 0x295548cc476d46b4 }, { 0xabc44808666d951b, 0x1a194504b81c4557, 0x57fa8760a59166c4, 0x32596e8a486e8ef1 }},
+        {{ 0xc5611499108573ce, 0x3d29ad4d600e3277, 0x53decbf27649be01, 0x22fb8bc66781c701 }, { 0xa0c7bfd31bbde470, 0x12839b52428de95b, 0x24adf15764a781d2, 0x34274902d50c2c47 }},
+        {{ 0xd49caaec8fc59e8d, 0x26a983e763a3e0db, 0xfe60a31a288b89a3, 0x12fb1dbd821b0d2f }, { 0x219256eab5e81153, 0x7df81de0c0cb3881, 0x48fc6344b1f5db71, 0x0db499116609f7dd }},
+        {{ 0x800845b607ec0779, 0x33a9cb5f01c6b8b4, 0x606ebce9adf00ab3, 0x1dff89f92540254d }, { 0xd878c0a3fe159ebb, 0x274fa199e003cebf, 0x160df9d2a0a3c272, 0x39604d09ad56f474 }},
+        {{ 0x2eb6d357bf1a32db, 0xe02c972395b5ba6f, 0xa75bb8cb810d1503, 0x1197407cf3fcd628 }, { 0x4a425cb45a34d400, 0x63d5390b0bd3e149, 0x1b7e2bcb66958ffe, 0x215cc6fa7f20a08c }},
+        {{ 0x141327aa18301208, 0xa8986a59cf8209b0, 0xb3da01180a55d3e0, 0x0e625d5ace4a1acc }, { 0x425a2d328eba4a3b, 0x484db49d9d2a7bdb, 0x81194fd6cc6a8e5c, 0x1af5a5ce33648c6c }},
+        {{ 0x94feb9e28e310074, 0xd67782abebbef7f6, 0xb4d88d35406965f6, 0x3ba14f1d4006fbf0 }, { 0x5f5de7bf06d77696, 0xc4e68dfe7b91fdcf, 0x1e4ff5f320b4d025, 0x32f140d40806e0e1 }},
+        {{ 0xbcca46fe98131130, 0x6c04b6f9d726af06, 0x2b8c3e68edded8c5, 0x304d1d60f6193c30 }, { 0x8aee844ce3db152a, 0x54a7d19ad83919af, 0xb0252307d2dd1ff2, 0x251cf90682d79b39 }},
+        {{ 0xbdf9a52e3387914a, 0xd9514b58560510d7, 0x58d9fc881dd4a475, 0x3b8892304f66bca9 }, { 0xf18641a49c26114c, 0x0b03e7d2a78393f3, 0x25adad04a42d876b, 0x0f72de185921b2d8 }},
+        {{ 0xeea2e9187adb3be6, 0x90b967c810cd2ef2, 0x9c15729a62ea4323, 0x077e9e9e56b4485a }, { 0xb76ba28b26376812, 0x844fc886d2e6274f, 0xcc45828ada6c5236, 0x22c4c0e081095f05 }},
+        {{ 0x18c92f555afd9080, 0x65db09764109da0f, 0x927ad5d21c94222b, 0x058e443c49077472 }, { 0x3e85ca816f445072, 0xb15c696df5ef3dc3, 0x311fe53eb74bc24e, 0x171f249b2384bbde }},
+        {{ 0x45982b4bfd54c147, 0x68b614bebbc723bc, 0xb1d7a937cec6583b, 0x243b1af32cf90ec2 }, { 0x5949acf43c86747d, 0x4a9495a07bd2071d, 0xc3f2eb2e56d7cec1, 0x031e3c6a58509eee }},
+        {{ 0xe027fe9e58faf776, 0xd2a9767cc05b090b, 0x65c106245bdfec72, 0x1130b83e2ab4bd86 }, { 0xb023af068efdb505, 0x74691bd1152b8fe1, 0xcc0f3d756c58740d, 0x16f15c86037f0c89 }},
+        {{ 0x6613747283d177d0, 0x1c6f9546cfe6dafe, 0xc6cedcb2cd3282b1, 0x100983c83b1601e2 }, { 0xd60ac6501ebe4a6e, 0x1989db2a0f4c1cdf, 0xa57a8f6a6f6c6a67, 0x31d91bdcb6059760 }},
+        {{ 0xff1d53e7000f5730, 0x29609af7374686aa, 0x2654e33026c06887, 0x288e708d057e8fb2 }, { 0xfc9437740c3ccbba, 0xcfb12ad8d86b1bb1, 0x33970df4dff6143f, 0x3d10c81c70d0dc90 }},
+        {{ 0x575c6346d1d5598a, 0x4b2853492ddcf2ad, 0xa67c197a31070a47, 0x017b49c590c96918 }, { 0x71a2baa03227659b, 0x7cb2f894d5aa6846, 0x8947826d1930d789, 0x15fec5be895e945f }},
+        {{ 0xfc7970b8406a449b, 0xef9a61cd2ef712b7, 0xbc9fc3b187dcf652, 0x292fa33a96234b31 }, { 0x8f9b1479dfd5f91d, 0xa8107ad9d2d427a7, 0x19bda9dd1ce401d1, 0x22ab7edc9d53d8c1 }},
+        {{ 0x331ba7c8648a6de8, 0x03affd05fe1074b8, 0x3e520d6ca11e4cf3, 0x0fea886b514e53f4 }, { 0xb6e4faa674c9e8f3, 0x638b4734bf830393, 0x79d7012ba4a4b982, 0x25d8bf05834bc856 }},
+        {{ 0x33ea60ae82871c45, 0x404a708d437b9c30, 0xfbecf2dd505edaea, 0x0ba11bb04c84493c }, { 0xc2f03d2d87ad8912, 0x05618040b0ad51cb, 0x06f25342ca05e4b2, 0x1af15fcaf84e2980 }},
+        {{ 0x3abab2d7ab181f7e, 0x9c71fc477df74d13, 0x31d99dc326dff16b, 0x016e2a2b7bb94506 }, { 0x7f563c7e33e2c62c, 0x60e446feaa527784, 0x1f9710edf3ed4394, 0x276421cdc358e051 }},
+        {{ 0xd0be468999791767, 0x6392b1e6cc2a3fec, 0xdcb86d27acb1b744, 0x35c6f4d4093ab4f6 }, { 0x3e90dfc836a7d2e5, 0xa69155bd2ceb7fb6, 0xbddcb68e4b2df71e, 0x1895cdc771537db2 }},
+        {{ 0xe71934139996fe84, 0x093c32e3917efdd6, 0xabe8e0d4853263fe, 0x2b8f5a10fa01eecf }, { 0x3256759fcc21886d, 0x34393a8ba3f6c595, 0xaf1398ea2dc49f0d, 0x2aba72d9bdf3f1f7 }},
+        {{ 0x5135cf254bed7fd5, 0x7ba084609f5b786a, 0xaa906ee56a276c74, 0x2fcf2e66d15bbbd2 }, { 0x34fae8d19c85b49d, 0xf923e8dface7aecc, 0x8532c3e2c5332477, 0x3282d469d8cc6060 }},
+        {{ 0x84bf25629f92c6b4, 0x7cab387784f26e14, 0xd2273737d61860c9, 0x1427aaa6112e5ef0 }, { 0xeb98db69117671cf, 0xb53c6390016f0c23, 0xe51978bc88e0348f, 0x25c8e0276b5a9c56 }},
+        {{ 0xf570fbf1dfd5192c, 0x51011ee9c497f803, 0x980baa13bde9f0a4, 0x3136357b6cf69588 }, { 0x6fab2af7e1f11577, 0x4a593cf70ad0ee15, 0x295f06366a7b879a, 0x3f14ca9ba0608653 }},
+        {{ 0x62851d8220dba006, 0x5fa65257c515760f, 0x8f4c16859c416d4f, 0x382f21ca95d77bec }, { 0xe52fa9934c098ed7, 0x4f3367a68b2ce536, 0x48d979694d498bdb, 0x09a578d72b93c755 }},
+        {{ 0xd1720d0208201ad6, 0x83d2f3a6194cff30, 0x429f5c455a12dd6d, 0x06b27378192f0372 }, { 0x979165a9ec4ac48d, 0xe7de77e2665ac3b6, 0xf32eabd91fdb4f96, 0x29e1b7a3281e4d85 }},
+        {{ 0xa637ad60963f5a37, 0x8cf51487e1332116, 0xf0fc62d723d9d72f, 0x04bf1a770fc1f042 }, { 0x99cb0d7296a7d536, 0x764b432ed91ccc4f, 0x32749165f3c5ec5f, 0x2bab1a83d98b4496 }},
+        {{ 0x29e55e623c25b3b4, 0x514ad3b123d1f617, 0x11286b8bf38b6bce, 0x17750bc4fe2d8088 }, { 0x289e16e2075107da, 0x8dc6185c43c3eed5, 0xc2009acec2f686f0, 0x27433ce2ccb03542 }},
+        {{ 0xce312071be00b1cc, 0xfb44deee3db94eae, 0xc889c42ad471ee15, 0x1c41ed6fa0ec457d }, { 0x8fa1e3c4cfb23399, 0x35a5490ed51b0d8f, 0xd5e27579b149e142, 0x058c0ccca3c1fbff }},
+        {{ 0x5cc760420032619e, 0x9356c13450e3b247, 0x9b85fb6f5b442e41, 0x2fda3348d75e3b66 }, { 0x511b6897b99e1490, 0xcfed8527c9a95b10, 0xcfbf7ab92554f9a2, 0x3c55eba1e9aac69c }},
+        {{ 0xfa17b0447bb6bfb9, 0xa539f4a3b38dabff, 0x780c69175fbe10ba, 0x3ed0beed76e415d9 }, { 0x8c49060cc21e9419, 0x03c22faf039c95ba, 0xef72203c1bc53ab5, 0x16e350bebe5d3f8c }},
+        {{ 0x50eeed56aee14dec, 0x5bc5a1df0471d84d, 0xb0fffbdcadd80109, 0x22aec50adb8e04be }, { 0x8252e7a18fe36605, 0x564eec2d7a04a802, 0xccede1fc94c2ca51, 0x3c9906ce452dd37d }},
+        {{ 0xc53a7c95933fd294, 0x1d852712be5ebf39, 0xf1f085825b73ab68, 0x081ac62503d2d042 }, { 0x0db0a9477e2f0a27, 0xfd64e6fa633edce0, 0x15e2a13b9c67845a, 0x31c8b60b991538f2 }},
+        {{ 0xdd21b61e14cdbfce, 0xe570a6d8943ef6e1, 0xe83f0c8e882521ed, 0x1c17691b597b011b }, { 0x166def718ac5c484, 0x25ae8b3815649af8, 0x15e28f24eb8feaa8, 0x2958f71aa0769fe6 }},
+        {{ 0xdae3daee0d84dd46, 0xe545eae8db22c603, 0x6fa62414d5a8aaa8, 0x3a0661f6d5141683 }, { 0xddd5256511f0298e, 0x681a8a1848874c5b, 0x280ccb156bc20e40, 0x3d8e54556a008762 }},
+        {{ 0x3de90fb2b428a99f, 0x3d9b7662d873d9f8, 0x8616f207f9ce2033, 0x323c7ad7a8f2b828 }, { 0x95036ba12e3d1909, 0x251090201234bb97, 0x6c5e948c3e3ee264, 0x2301ff9f6d346caf }},
+        {{ 0xe3fa572b4acc0bb4, 0x693ac2f2b91089ea, 0xfcee8e520f9a0582, 0x3c04dc27afb9135c }, { 0x0afec3aede6561b6, 0x18f9879ed920a28d, 0x8ed8198ebdce79d8, 0x0381404243ce0228 }},
+        {{ 0x436e8522c2479ef5, 0xe216b6acf518e602, 0xd71f7ae8413075c4, 0x31b1c38ba552e85e }, { 0xf8ebffa43f1cd8a5, 0xee7b1e44adf19e45, 0xf65dafadb33547d2, 0x2c4771279cdcc4ca }},
+        {{ 0xcea7a4cd41e5e20a, 0x105a35bf7398e725, 0x38f18d464517dd28, 0x052e670f3f67b531 }, { 0xea2e2d508e91c9f1, 0xa195bf296257efd4, 0xc2b4323586635923, 0x2eaa1df686fb4f04 }},
+        {{ 0xbae88b2c1837f429, 0xa9f7a490c03bfba0, 0xb54e3b031c578dd4, 0x16a460ea535e20ae }, { 0x4daa5e2c33a7b746, 0x982c0900006c82ee, 0x3cef48a5c56ed45d, 0x1f156e8477e698ab }},
+        {{ 0xa2b21d05b54737c0, 0x3e98cf8d6c541545, 0xffa9de6b1c372220, 0x356add00ed67f42c }, { 0x9236fe3e4f349515, 0xe83e234ccbab15c8, 0x845b0165ffb9efaa, 0x02d4a2c5169757fe }},
+        {{ 0x6d49a66d2060ab02, 0x22d397f93750d6ce, 0xdf1b2e69908f5dd7, 0x08a4e17d062198ae }, { 0x2e588111c4b81ccc, 0x07716632b6a23104, 0xc0c750990cc26de1, 0x3d7032dd96d78519 }},
+        {{ 0x6089209c18f06208, 0x670aeda36b8704e5, 0xab7f9d429704e660, 0x0089e3939c51a386 }, { 0x6452ad992d2fd36e, 0x9c92bc3597318465, 0x304315a1b6dd3fdd, 0x1f72a423af2e0da0 }},
+        {{ 0x4cdf19f9ec16cd0d, 0xbd1575df0f451f4c, 0xb8ff74a579c50277, 0x362bfa04032599cd }, { 0xfee27ea2d260103a, 0x6a8c05889fe149ab, 0x6a0cdac69351a49b, 0x2ca4e71f3a9d7777 }},
+        {{ 0x88bf4c1920f94050, 0xe60763335cb070aa, 0x29ffb1b42c33aa81, 0x2383f47d7edc6126 }, { 0xfc7fa20490f4f91a, 0x467dcf2da4cd0a36, 0x86e9e59c87eb9423, 0x1deb473e1a134147 }},
+        {{ 0x3e4853024f920f7d, 0xf6393783380995f9, 0x7619d805c23f71f7, 0x1c839fc4551a6457 }, { 0x469170495feeaa2c, 0x49c2ea08e132283a, 0x20039e5e4c865e5e, 0x0797c91c22f70f1d }},
+        {{ 0xfdc5a3db91eb5d00, 0x08d6d59374e56a1e, 0x1cd1b6bca7187015, 0x3a1c8052522c1c73 }, { 0x3742e2a9eba6944a, 0xb44a373c4c1a6b2f, 0x31529948f5692d36, 0x2f3bf77c96ef994a }},
+        {{ 0xeea18a0c07e34af7, 0x8cdec1c244b69f57, 0x9552a8b0d8b03cb1, 0x2778034929f6f8b0 }, { 0x744aa4ac8b6d485a, 0x62d364ffdb5ae0e6, 0x4b5089ea06169d6e, 0x0a57c66994130f26 }},
+        {{ 0xfa00d2ac242420bd, 0x6a050893b883cdb0, 0x6c8b2ec73d416198, 0x13e7bd5400f91de5 }, { 0x8d007b6d51e280ca, 0x35c3187b2d049277, 0x0da52fb912164bf7, 0x2607888c537fbf54 }},
+        {{ 0xdb2cbdc2f6894f38, 0xc3a5d46e33285e43, 0x45de739c76e78def, 0x0b5126d17b03c716 }, { 0xd2e1b9c96badaac2, 0xa42e96ceb4309962, 0x43171a83eb76d477, 0x217875e3fcbacef5 }},
+        {{ 0xb1a4bccb8dc6037e, 0x1226341f238e1e0c, 0xd235a2f0be640aec, 0x1a1692869ff2ec8e }, { 0x258775d426acf720, 0x14319573a2cd62f0, 0x51ec5883efdd72f8, 0x3b26d107b0cf05fd }},
+        {{ 0xbff39247450aa809, 0xd8e6097b4e86d7f5, 0x22bcbefaa9b20005, 0x3578be831aaa6403 }, { 0x4a35affc787092bf, 0x3a0d14a1f26b5b46, 0xa1fa5b6cbeada012, 0x177a97a9ba57422c }},
+        {{ 0xa0df69d94feeacce, 0x88567dc86f897991, 0xbd84fb045ea2d1e3, 0x26f3b15d69bfdb12 }, { 0xa36df49655dcf702, 0x6a7ed35f0778ec04, 0x93d42c8d73b4964a, 0x3f1c9dde30a11ee8 }},
+        {{ 0xdd5a5278b107b2d6, 0x0114858c146c8ed8, 0x258cd3ba8f446b69, 0x0d04c04776e05a85 }, { 0xa1e9276471bcb8db, 0x78cfe89db9585429, 0x78e7cf0c86064cd2, 0x3bfac0a3a0cef420 }},
+        {{ 0x84c86884715a480a, 0x468074496dc43c6f, 0xe9c7a6ac62581cd7, 0x3e40d23dd6baed19 }, { 0xb10c7b73f4a66f61, 0x22eb657b4b35da58, 0x48bc004ef3a039f4, 0x30a9818968748751 }},
+        {{ 0xf1bd89b9495331b0, 0xf7163f03f4698173, 0xb78656b8a309c864, 0x07e262b3267bfd23 }, { 0x728a5050817965d0, 0x3c94974d4c763fdb, 0x45688912737bc202, 0x33e099a29964e7a0 }},
+    },
+    {
+        {{ 0x2ab7dca2fce883b3, 0x3d513f63f7de2a18, 0xfc6af64a1903e3ab, 0x26dba75b55012a25 }, { 0x48deba8b77caff94, 0x3468151f0fa27ccb, 0x3d964265847dd94f, 0x39c715e54b7defe4 }},
+        {{ 0x66afb88d1cb58bc3, 0x9ffdd3f689979197, 0xf6b9645fcc6a927a, 0x07e2663b69faede8 }, { 0xee55ad42f0630bff, 0x3c0787ef43944158, 0xb10f229f0dc021a9, 0x28689ac7ef9dd863 }},
+        {{ 0x5bc809d7ff0dab63, 0x2ee15f72ca9ccfe7, 0xb5acf887ad502e87, 0x0f2b16a44e61d95d }, { 0xaba09d6cde7f9167, 0xa2269bf17c7fa3fd, 0x1d4c6fe073f77bf9, 0x0e5792f9fe2f4db7 }},
+        {{ 0x942f0e69e03f1562, 0xbf4baa6c48a40705, 0xc0483acd07e3a9ca, 0x3d5e83cf94849d70 }, { 0x33a3744c1e0d53ad, 0xb3918706fa37df97, 0x1779c8a376320bfd, 0x13f3a1615538d475 }},
+        {{ 0x94a9ed5829b3c168, 0xeeb5615eec2eeaf9, 0xa26769d36139ae6b, 0x0a4021f68cf13a25 }, { 0x6e5573a5075aa872, 0x266c7a4d1c59741f, 0xbaf97d496755b79a, 0x323b0bdf1f4caf17 }},
+        {{ 0x960f01e5dc2ef471, 0x438d214f4b285612, 0x189f151886c450e1, 0x22d62aac91144978 }, { 0xcce475c2edfe3dfb, 0xc4c780d6bd1e1199, 0xd7f3742d9f0bb457, 0x229ba3a231f0a08d }},
+        {{ 0x2734de4fcf2ec4d3, 0x49fcb9c36d71278b, 0x688933770ddafadf, 0x127c541222bed560 }, { 0x6111f7f2bde72909, 0xcd9d2648ea6ea54f, 0x078ee065b75a983a, 0x30b332b14dbab9a9 }},
+        {{ 0xfd6c893187a1b6f9, 0xe9fe7b6d0d18485f, 0xd9ddad432cbbd121, 0x1a52fd699d31bbd4 }, { 0x525f6a7499570f2c, 0x21d770765dc4cdb7, 0x4cc2ab301faa33bb, 0x10a3b1eeb19ccb2c }},
+        {{ 0xbeceee45772bc9bc, 0x95c78f98a033e74a, 0x34267e0fd277e722, 0x0974f64e87c1414a }, { 0xf69c144f92c0d3df, 0x2700c0cbe5f78271, 0xc299012b5f067ccf, 0x0d232722395e4b11 }},
+        {{ 0x5fcf6e906defc3a5, 0xa9971a186748ff13, 0xc6fc33af13c9c1fb, 0x37467a46ca397155 }, { 0xaf078b05ab4e5ccf, 0x2e156a0387e4e417, 0xb079f28c1997667a, 0x15351ef4818ddff4 }},
+        {{ 0x46340870b6f80004, 0xd8a3d47b8cd9e2e7, 0xa63f364e8cd34798, 0x303122e1d8e33778 }, { 0xa4a5dd956f07fd93, 0x52645e7641b1dadf, 0xfe0b8eff08cbc2e5, 0x196f774ffe6c3821 }},
+        {{ 0xf33c60c8486c09ad, 0x4ccf62e93cca1e40, 0xfd66a1499965f3b5, 0x2e3152e3d432f4ed }, { 0x81deb0811ed377ec, 0xac222880f584aad7, 0xc1cfaadcd02474b0, 0x2ad8f5b1a236de90 }},
+        {{ 0x7c540058191d7dfc, 0x746398f4cd31ebb4, 0xfa23aec3371572c8, 0x17bfbd22ab17a04b }, { 0xd6b437711b6f17fe, 0x072327364018560d, 0x6c819a409e926520, 0x2a3c254e58f275fe }},
+        {{ 0x857d077c127c2104, 0xf17c47bf506a890c, 0x3c495fa9086be65b, 0x36861693f6454d76 }, { 0x6e70ca34aae208ea, 0x35ef40e68c277f14, 0x1a2f2d577550ab46, 0x169fd42db7bfda3e }},
+        {{ 0xd04da642b9a0bb4b, 0x928837938ce2af74, 0xaab9c040000797a4, 0x31575403d60bcfe8 }, { 0xa797233436ce20a0, 0x24a5fd7a69746078, 0xf606a7ad25a8a123, 0x32f9463f20a78c44 }},
+        {{ 0xd9cb4acfc71293e7, 0x026687f63a4893db, 0xb51f9d12c99fdd75, 0x03c1686e401b63af }, { 0xf15a8e5cc5375d3e, 0x53e03bd51fd20027, 0xeeed00104bf97bcb, 0x37f656d17d2edd1e }},
+        {{ 0x0c2aa7df8b950fcb, 0x33934031f1c2c5a3, 0x300e8a4d087dfcd5, 0x2143a632a84b236c }, { 0xfde75457dd6ba805, 0x7fe8ef83301f8dd6, 0xa2e52cd1b2a5b926, 0x214b017710c53ef4 }},
+        {{ 0x6a9d9aa3b277443f, 0xc099c70658bba384, 0xac29f173e8a770bd, 0x1582e1b541214f5b }, { 0xff2e91633513346f, 0xa28bd35509570e35, 0x6868ae4407855cc5, 0x2e04ba7ce16a248f }},
+        {{ 0x7851fc658e5d3082, 0x17a309b715242256, 0x4708975693574fc8, 0x1e7773a3e9feef7b }, { 0xdb37627b5b891921, 0x3b0436a44a10274c, 0x70a1f756f297e959, 0x2aa71fedeecca78f }},
+        {{ 0xb4ea4a7fe6907fc9, 0xdd87b07df97f1cf2, 0xb069699b4eda79b7, 0x05a4ffb340184e68 }, { 0x26791029ab8e321b, 0x9acf7305e2f2274d, 0x7f7214983490ebe2, 0x17ac577a25d05630 }},
+        {{ 0x0c7ffeee2845dfd0, 0xfda8dcac7f6eb36c, 0xdfed888062c8229e, 0x3dfa8f23ba5f14e5 }, { 0x15ec99a307be3089, 0x15504968108bc002, 0x09fe1af497c6452c, 0x3897cd9dcd8845d7 }},
+        {{ 0x6c7090938a78afa2, 0xb0bf0819f746c8a5, 0x6749160c0aef5e32, 0x374520974697199a }, { 0x1f3b561ee56d6d4e, 0x3a87a3d3bced14f0, 0x912fda6ed2ddbfaf, 0x38bf209421fb62c1 }},
+        {{ 0x4b00ad0f848bdbcf, 0x52fd17415fda9ffc, 0xf55ac97b8252ed6b, 0x00a1911b7ac9a7c6 }, { 0x00f0fc0b770c75ee, 0x8c518773948e8520, 0x952805efe5eb0ede, 0x298d7f1b0f76f2d8 }},
+        {{ 0x41017c963917c614, 0x4c5f94f958848fca, 0xada932a0f33d19bc, 0x302ada9639bab9f4 }, { 0xcf1eaa0711abd4a0, 0xe9d47b8d448a5fb7, 0x3fefdbb92c8e955b, 0x0ef0de232f47a1b1 }},
+        {{ 0x19b0a1d167bfd213, 0xd77fc726577bb1b2, 0x09e57e424ce32e53, 0x090ee0c18fa19242 }, { 0x5b653b89d5adbe7e, 0xbbf20719c0d3a956, 0x47340339cecb4504, 0x147d0da7e52af88e }},
+        {{ 0xa3e8516acdd823ee, 0x4cd529f20d493d35, 0xb85f325503810c97, 0x303d7293c20386d7 }, { 0x2859ce6675b979a3, 0xaadb4ce8a16764a8, 0x8aa5d391533a15df, 0x3fd47b451d532303 }},
+        {{ 0x59a8979d2bd9521b, 0x1ba5b9c2d514d755, 0x299d9f5244509e62, 0x0484ec5ed6da5565 }, { 0xce86710590fa4e81, 0xf8b45e4fd180c638, 0xe42cad61e8130687, 0x184ee72e63fc68a5 }},
+        {{ 0x3d3c152b7a134cca, 0x180276ecaf340873, 0x18b807398c0a1dc2, 0x38592585795c7e21 }, { 0xa44dd7c3badea98e, 0x92975d13f773d921, 0x3510584ec01e29d6, 0x112894abace1f9db }},
+        {{ 0xf34283467b1cb66d, 0x21a15ed1ea4af4f9, 0xd855fe199a556aa2, 0x3f5cdc55410409ed }, { 0xfba3486fdf43d188, 0x1a6cbc6bb4d7a35e, 0x4dd2d07a60e9882d, 0x07bcf562532feb2d }},
+        {{ 0xf899a2029974ab55, 0xce31d767d6096e10, 0x473ebd05c05c1790, 0x1f9a58329c993ff3 }, { 0x177e55aff58fe885, 0x16a3e12febf55ef7, 0x5a1cdd3099a95543, 0x12f73231ebb0c1cf }},
+        {{ 0x2103e35bbdefa0ef, 0xcaf659599e34631d, 0x1851e0ab73e0a765, 0x38adb290a8c62994 }, { 0x86b7057682eb7484, 0xe97713eee24d5423, 0x61db6f0cea128976, 0x132efa18ecde93aa }},
+        {{ 0x0c938c0e660d59da, 0x5447433d807ccaad, 0xd9a1220586e0888e, 0x061ff3006bd5cbda }, { 0x16c8f5e7f954b215, 0x9fdb864ff38e8e04, 0x4606fea8e62e6718, 0x144727f2893ca14f }},
+        {{ 0x644e189a5f68df93, 0xe357f7719cca03f2, 0x248256f2babcb034, 0x14be3a66b091e176 }, { 0x2eaa76c46529df20, 0x5b261802284ad0ba, 0x81c81ebb916c590c, 0x0ba674731a4c9814 }},
+        {{ 0x8af2e194a40eb282, 0x85e2e21d48a3014f, 0x49d4335839ce6920, 0x37a36d86e81a3e22 }, { 0x230dead39c3273b3, 0x5cd93401c1f566b4, 0xab3fe0309833c2c7, 0x0f306907ad19ebfb }},
+        {{ 0x4084358c5694b0d9, 0x90ee33c45a6ac091, 0x23e9e841295c213e, 0x2d0ce24c945e9338 }, { 0x4b24140b1090e9f6, 0x16b1e178aa6a2fdd, 0xfa625efced381d6a, 0x2cac73256f5ae89c }},
+        {{ 0x46892d12b2fe9966, 0xc27ebfe3eda6c6ac, 0xf4d4a91e6fc5f741, 0x0f514c7a0d0da0f1 }, { 0xc37f892ca6933c46, 0x764c56679d7455ea, 0xe69cf05b7deef8b8, 0x2a0d65ac0e73cb4e }},
+        {{ 0xee6678fd267db049, 0xfb91424ba01d8077, 0x2a2fad6d2ae0106e, 0x2d0f29849474b57b }, { 0x93686a1fc281cd8f, 0xa220ec041036ff5f, 0x247f86a1b7e96494, 0x25ad1d0ebf35b054 }},
+        {{ 0x7be7b82664befe37, 0xe9b9e7ac6807d3da, 0xb4985ea869273121, 0x1f8abc0ae8802169 }, { 0x9877ee65a2a9894a, 0xa8a83c873b80ba2e, 0xd4d3a5864e582b27, 0x0efef80c8c58b487 }},
+        {{ 0x1d42cf3afd167e3b, 0x7ff766faf29d20a7, 0x836c1887ef95c477, 0x12665657a0b8bf10 }, { 0xbdf52fed801ad5e6, 0xa49bb368752d1144, 0xeffba647688efbb9, 0x03aa378c6a948f0c }},
+        {{ 0xf59a68b070a26a04, 0x6ef5baaef7af5f36, 0x8cd30163a0aaffd0, 0x16126156b2a3b1d8 }, { 0xfac2494d99a87e3b, 0xbcc2d88110b7ac5f, 0x602a15f2d9dee72f, 0x24c76ee6b31687bf }},
+        {{ 0xe13af5945b66c028, 0x7c5a432f09754416, 0x3ad941a716df664e, 0x00dfafe0695802fb }, { 0x3788d6517fd4bb94, 0xabb5fa1b9557c29e, 0xf69cd8246b5d82b9, 0x0504cc8f9ee5366f }},
+        {{ 0x274509fbe3fd7045, 0x7f5577f14f5526e0, 0x5e078dce8b2fd34a, 0x3d04a0415338ae42 }, { 0x9fa8097bec38ac83, 0xa91021aae9c53129, 0x1b1798642b148612, 0x0cc49121e11ccf4e }},
+        {{ 0xcd0e8e22f8dced80, 0xeeeb367d7d05edbd, 0x6a5defbe82b70c1a, 0x20d54ec309a78664 }, { 0x63b834017ada87b1, 0xfc2b4f49278872cb, 0x77c4a29266e53ec2, 0x32347b5e73fd9d59 }},
+        {{ 0x5495fea0ee80784c, 0x24b3bd6949b4c846, 0x61f19a60f7a78b82, 0x1994bf17ee0f3e1e }, { 0xd311aee7a23ffebb, 0x649135209f1fe9fb, 0x156cf1aaf5fe8123, 0x33bb03097eedcb3c }},
+        {{ 0xf61c7f091a35d0b9, 0x80ca8d14489e768b, 0x9ad735d2e89c752e, 0x198ef4687d5b6403 }, { 0x401bef9dece9b8d7, 0x1e97517c68be86e4, 0x419cd427ea9bc5e5, 0x24e5507e4173d265 }},
+        {{ 0xfd0e4dd6d059473b, 0xcea7677c2f7a0560, 0xf0275ae513c99d13, 0x0203683934268a8a }, { 0x8290102d70623bae, 0x05f7667b90db166a, 0xd67d6cfb404aa071, 0x330ef931cccf451b }},
+        {{ 0xfb1a7f4caf3ad2a3, 0x1daf324ad5a68421, 0x3266094e0d17fa34, 0x2f8c2d7c4e53abd7 }, { 0x1c3fdaf7614bb816, 0x0fc81661c333c54a, 0x533666d8732ed09b, 0x3bf46a9a90d39b98 }},
+        {{ 0x4c4127eedf869730, 0xe0b58185bbde265e, 0x220c64ad74131e99, 0x0c365b8181937cf5 }, { 0xb63d8ac092620bd0, 0x119021efacf7d562, 0x8adde289010d4948, 0x11c51a29e653c29c }},
+        {{ 0xa805b5da40be46bf, 0x1098272bd11d1613, 0x3660300d070cd954, 0x3744b1f464193d6e }, { 0xf24c3a3596fd2ba3, 0x502dd9e8fbda0ade, 0xbac5bb9de82b6a6b, 0x27d6648e4c195153 }},
+        {{ 0x46840d12567af6a0, 0x6b612cb479a25a54, 0xa1e63d760487a1ab, 0x105f0e5b10ef5e27 }, { 0xe64ec931576a1407, 0x84443289710a39fc, 0xe2546ad9e5a22ca5, 0x119bad53ed1c90b6 }},
+        {{ 0x38609645e1bf302e, 0x3ecef30ab8024103, 0xcd05b5500ab532d7, 0x2756e14f594fe91e }, { 0xa8c8d01ad12b86a3, 0x80be4ac630d7a772, 0xbd3086eb2a90ca14, 0x3c5f0229769e326d }},
+        {{ 0xfaf6f0341e50f4a4, 0xeb2e8e4e02fbdc62, 0x61af3f58486c700a, 0x1e8abd96c874eeb6 }, { 0x2e0990cec1b49b91, 0x883a9f18daaf46fd, 0xf5cbc89cea76cc0c, 0x1d0d10370061d42e }},
+        {{ 0x58d437d3933281ac, 0xfcdee0ff43584a0a, 0x686c5e483aa1a969, 0x227edce655a4d72a }, { 0xb3eae75a0e800141, 0xc049338f601a088d, 0x10d559b5044a8607, 0x0030edd82e0491a8 }},
+        {{ 0x5c49ef3f085c3cab, 0x8c334b2fa41c260b, 0xc07c5b724137f7ed, 0x04b004946afb4b66 }, { 0x021efd4b865c03af, 0x1293526e8853843b, 0x129619eca4e51286, 0x3611e34f7f9e331a }},
+        {{ 0xe703562269191c18, 0xd876f8ca5bb1f2f9, 0xf0a78d5bcbd461df, 0x21fb08a969ce4dc1 }, { 0x473a78117ef8f999, 0x0330a39fbcf73c4f, 0x2a4565c28b4d3f9f, 0x3220cb267e98f992 }},
+        {{ 0x29df065adbae9781, 0x3dfd77e7f1aaf1d1, 0xb549c10a7c7e6ce2, 0x177e81f5e9b55ab1 }, { 0xdc309012c95f0b87, 0xb640ec02377067da, 0x4b34ab4937442fc3, 0x2bd1fbc55896c332 }},
+        {{ 0xec3ba855069fd607, 0x2f65e0bb35fe368a, 0x4a58350eb4da57e7, 0x3cb5541b2e6afd1b }, { 0x03b15615367866cd, 0xfc48766e00c9a37d, 0xa3f1076206117dd5, 0x0e9a9dd098a634c1 }},
+        {{ 0x743a0939672b8052, 0x8204bfb640c2c21b, 0x62456c7798bd4148, 0x07999c07263a0728 }, { 0xa205cfd32311329e, 0x409ba14e2e264d23, 0x0b0811893af87a39, 0x39d6af26ace60042 }},
+        {{ 0x580e5d0adb76d65a, 0x039d9108f500db83, 0x75a4f8f113931873, 0x0019d760cdb94aa3 }, { 0x328ee5afd08667be, 0xee5dc0b6e6ed6cbf, 0x9c947ed5b789400d, 0x3ae6f7c248ad9e71 }},
+        {{ 0xc5fab394270605ec, 0xd84d37d514e5c940, 0x084c55b3118455d6, 0x320cbfdc5dc898e0 }, { 0xb90e1997dfe095da, 0xcee03fafae9c71c6, 0x01e205ec17e26ed8, 0x2bb158a145fbf34c }},
+        {{ 0x12b8a22e7f7df34d, 0xd8ac63ba6caa4652, 0x380a80a68267d928, 0x05d1a4f28d73109e }, { 0x951d7c2098ffe0a3, 0xfd488606944a5e3c, 0x7f2d3b97ead62451, 0x009048fe112e2808 }},
+        {{ 0xec26f5ca14667d9e, 0xcb412dc12d3875e9, 0x76d38304fee5dc25, 0x35f357b7795d7837 }, { 0xf6843d1fb158acac, 0x61bf4315920157b1, 0xa7d67e1025d80047, 0x0febc07db6d67ca7 }},
+        {{ 0x09e456d813f10656, 0x468d0f996cf2857d, 0x645dc96e4570377b, 0x1086d62c5ea774c6 }, { 0x1ef6e1c14ea5e2f3, 0x2be9d08616332290, 0x0e5e4de7f2f40d42, 0x08dd0fc7f8ea4ac6 }},
+        {{ 0x52957daa54ed9242, 0x2050d431fbe7b742, 0x21f35b3870e2a5be, 0x3bab5d0e8f0d51ba }, { 0xb4ef940a946fd501, 0xd0bd0aa1059c854e, 0x0e8a3ab92fb4054c, 0x32a41e6c67d10b88 }},
+        {{ 0xddc3e8c5564a5748, 0x5edb335cd1e4d598, 0x63a242bbce1736a4, 0x01cc6bfd1efc058f }, { 0x55b1d26b41af2e4d, 0x8c6c6fd78a693dfa, 0x331b5e20a982f217, 0x203d7e6a9c3c6ee8 }},
+        {{ 0x1462d9036fe43b8e, 0xeef9bc8ef8da0b09, 0xf6f787dd41420f50, 0x28f1b14754158b6b }, { 0xcb309ca521189a09, 0xc593c6a610da3f74, 0x42246651500d2ea5, 0x1412ae632e705632 }},
+        {{ 0xdb82fb34017d915e, 0x7d7c47bbb7466cda, 0x75ffe97a68d3a50b, 0x0fb7d7a6ff307884 }, { 0x441e5ef5f66913bc, 0x1886194604de70e4, 0x6b98aeffdbfe564b, 0x3132b3e3e87d7dfd }},
+        {{ 0x06feea22d6aa6462, 0x150fa303b46d7c9e, 0xaa40101ca337c064, 0x0085268e3162466d }, { 0xa66e9e41a038e78e, 0x33f987f42e9c3ebe, 0x6a482c43d7a402ee, 0x33b7df030cf53067 }},
+        {{ 0xad85021711140091, 0x7dfd7b841b918082, 0x9a1422efb74d3675, 0x2da882ed3e869407 }, { 0x73850e11b4c488c6, 0xa165f173179c44a2, 0xf6f6b293fe25aa4d, 0x2d2ed9792378dafb }},
+        {{ 0xcc2cff133c986a88, 0x2bba81f4e355cef8, 0xfaf77ed1a4575be4, 0x2b16f2440486394b }, { 0xb4400ee71ae0f4a9, 0xe0494962d047562d, 0xbd0a4575069dc4cf, 0x277a8c54baf92e1c }},
+        {{ 0xf752c6a0acf809ef, 0xa04aedfd6008a1e2, 0x080077b6ebb79cad, 0x34739ca0732546f8 }, { 0x890ea95bc2cb5b2b, 0x4245690ea6f34b09, 0x6e700d2f42a6edbc, 0x2aeaa8a1599dfca7 }},
+        {{ 0x61f3c56e4e919c4c, 0x007eb7e13cc0a35d, 0xa0ef4a8abf4e57f8, 0x04a824ef415e8c4c }, { 0x506d7f5516b35d3c, 0xe7db86ff4c963ebf, 0xc1009f77965ff377, 0x1fed07ec379b2530 }},
+        {{ 0x178300479f0a4c64, 0xdab368e0bf6a7f50, 0x298c86aaaff47277, 0x21e71e953a6162b3 }, { 0xb7b4adc3538c209e, 0x4a838020fd839d86, 0x13adacb21f8ebcf6, 0x30677c9a90b4a917 }},
+        {{ 0x1fe22816888f72f6, 0x2ed2d980b02c9a7d, 0xb17c132bbe97a025, 0x20157511cc803946 }, { 0x3efce4cab3a7e3c7, 0x619abb29830d2801, 0x8855833c55c3861d, 0x17a60215d8bb5c50 }},
+        {{ 0xed990e9d73e8521d, 0x49f23d0c3ceea232, 0x5e2c56eb819849bb, 0x11293a5e3f9bf330 }, { 0x7abf97f0410efcd8, 0x1cca74f306c11858, 0x7f8b2cb39ea356ce, 0x01b3a6bdaac81a2a }},
+        {{ 0x77519983dcc312b2, 0xded5be9d6efa9371, 0xb2ed71add07cfa39, 0x12bc2383e9765315 }, { 0x067c3bd6e85437fe, 0x2da3b0a730c0b4e8, 0x4764a8dd50b2b3dd, 0x21b63f4e68b8a9fe }},
+        {{ 0xc0da6d24c88ccf4d, 0x90f5c03159c03af8, 0x2be3356693502642, 0x1b2cf680b2bf833b }, { 0xdd8fe4f2f5da557d, 0xcb657a09e05a984b, 0xc31abc16e1e0fe71, 0x35e60c685e804076 }},
+        {{ 0x464cbd30c480f2fa, 0x6857876893aa851a, 0x63bf98559731dd4b, 0x29a111933bac26ea }, { 0xbf41817a1051a98b, 0xdb69e0b8190b92ac, 0x230d61c8ea720136, 0x2f3e39a88c230e3f }},
+        {{ 0x27373eff6bcf9737, 0xdd70e4c66d11096e, 0xd04565ba1ed762ef, 0x08e590101fd25291 }, { 0x45f428e11a1d7fc9, 0x2898984f98e2f2c8, 0xe92f50b8db1020bf, 0x3147c11bcd66c70e }},
+        {{ 0x614dc84c979be25b, 0x7f6127afb9a422ee, 0x4ffff5b7b5ca5186, 0x3f19a47b17d579f1 }, { 0x06e896ad384c4eab, 0xd9666a644c3ade25, 0x94bbbd08d9be7992, 0x125df95d9101957c }},
+        {{ 0x5be3884ecf68c82a, 0x88b99fc6a0e5c916, 0x2654e86a071d5b5a, 0x34f7d547bb46387b }, { 0x1a0aee04b8f06495, 0x66297ef5a7055e12, 0x6ae170e71970dfc0, 0x317c40372f7fc6ae }},
+        {{ 0x30deaf6994afd2ca, 0x537b57ee158ea8d0, 0x1de0d9a57fdd7ed4, 0x352b211f50b5b378 }, { 0x802958708c030904, 0xb144c16a64a9a47e, 0xa9b35926f68ad68e, 0x3a7fd7782f316279 }},
+        {{ 0x9fc10f31d19c3806, 0xdcd67b3c95ed08ae, 0x75fda107b62239bc, 0x01e8a3aa068f13ef }, { 0xc2284514cb0bbb70, 0x9dcb04b05411cc17, 0xa6b08bf03daecff6, 0x07543b2064b7d86d }},
+        {{ 0x0fea5f2d7f38bf66, 0x07faa8cde2a9de97, 0x1ade569595d15d51, 0x30dfedc601e4e82a }, { 0xfb18a00617d3de55, 0x346d210cc2b05907, 0xcb4f8683fc3a49b4, 0x18a368da4e8b0364 }},
+        {{ 0x35ba033bc03fdb7f, 0x6e879f7105a72ad6, 0x79be80a50f643cad, 0x19c6df125b6b8002 }, { 0x51a5f170d1a261b2, 0xbcd056e1fdb80e71, 0x6870d491c9ebbb95, 0x11fa897db583241f }},
+        {{ 0xbe21a0960f304b26, 0x5c4c1c72527693d7, 0x3cc1059fa57bf968, 0x0f9ea5640d60479c }, { 0x1ba4b1b904a26d9b, 0x458377e80cc1c448, 0x369fe27929e6f5f6, 0x26180151aa713249 }},
+        {{ 0x1b800bc2b1fd9388, 0xf6c1e04651a5c695, 0x26509fb14d9caead, 0x2e5a300e90652df0 }, { 0x9f30b095fedc8bca, 0x2fffee6c313a53b0, 0x82e7782ba3f28512, 0x3b74808be7b8bedb }},
+        {{ 0xefa9aca1dabd1adb, 0x1feb5b62ed3eafbf, 0x02f8eb6f56e29d33, 0x27ea1dc007514e22 }, { 0x5ea36ff208f193ca, 0xf11e346fd8dfd768, 0x3bd7f28f2701d1c3, 0x278c887fa9d9a6ac }},
+        {{ 0x5149575a48c3b6bd, 0x02ad00a44ccd5021, 0x47a6d7bfa0f1222f, 0x345f2fc1528c5d96 }, { 0x2071977a92066970, 0x7d84e0215ffc954c, 0x464b49ac3d7a1125, 0x015e2218ffd41fb3 }},
+        {{ 0x124bcf422ad1fb17, 0x72389d0ed8ea9ce6, 0x2513f6d70d242f08, 0x0fac557aca45c127 }, { 0xb1997668cf60fcdb, 0x771c23db21ef7dc7, 0x10601c74a8afe91f, 0x2d8c351fad5b4aa3 }},
+        {{ 0x87cc3b6f82fd4132, 0x832781a691cefe22, 0xf01b57cce99c7b5b, 0x034e2147b5c0515d }, { 0xef2cbf56b66c6a9b, 0x5b0add53d5a3f1f0, 0xbef6677e85022ac0, 0x04286718398720e0 }},
+        {{ 0xfc4fc28beecefedd, 0xfeb8426ff6a3f3de, 0x8f3a14cef8eadfdd, 0x1c0ac6232b2ed900 }, { 0x94241e50e6ac84fa, 0x53cc287779a3ae43, 0x1eadc439fdacf4e6, 0x1d9ba8f07ff1940b }},
+        {{ 0x19ada7f1e54bd30f, 0x9ae28310da6c233e, 0x458791f9bb899042, 0x119336b9a84a19bf }, { 0xdc23b131f413af48, 0xbf49be7e719a43f2, 0x167c39864c523e59, 0x1796f7970ad1d223 }},
+        {{ 0xe53bdbc6576ea395, 0x6ce463bbfbd3dbc6, 0xf196e5bc6de72b70, 0x138151aa371b87fb }, { 0xc3336bc4a98695c4, 0xa747ed23e195ff37, 0x094434f5727b6720, 0x2598bdef6bfb0b66 }},
+        {{ 0x645702a8a22ea52d, 0x3d9a06c9dc2e87e0, 0x4af98393e5e7e34e, 0x2015d1d19ef483bf }, { 0xc0fa06798998d15a, 0x7522a73d30b2a9b0, 0x0fef4c2d86b09a4d, 0x3dd38ceec9457efa }},
+        {{ 0xe13c9a13f20001b4, 0x57a2b0e063083d90, 0xc8a8d6d881078d89, 0x0662e3edbbe155a4 }, { 0x2b2fcd3c7d7d9334, 0xd3251fa5db111c2b, 0x6ec834ce10ed0f16, 0x3988d2ac6a7cc5cb }},
+        {{ 0x1c679a993636c5f5, 0xb7734285f1277075, 0x00d056f25b8b7ff1, 0x3ce010657a43b7b9 }, { 0x3efd93395732a1b5, 0x2eba928f276c6044, 0x6c8305e509e558fa, 0x319ba3f39152e5ba }},
+        {{ 0x2d3d3b8922e53f3a, 0x1f488d94e95a4eec, 0x78acab09e9274877, 0x1898f636822f0185 }, { 0x75a946f9473b10a7, 0xaf9f7f7416125951, 0x59ca6473d37e5ced, 0x1a27336b542460a2 }},
+        {{ 0x67ef04676a6eb8a5, 0x7603b20b4fa34ccc, 0x003c88d7fcb0af40, 0x32b0ed7ef8ee5a3e }, { 0x94a15469253bc719, 0x03bb581978c52676, 0x622ef86815cdd05b, 0x37a72d332378ee7f }},
+        {{ 0x53b75c73ff54fadf, 0xebc3f3a8735cc6bf, 0x319bec832e0e4d0a, 0x0e200146685c4119 }, { 0x6babb91f08fb070c, 0x5852a49213948be7, 0x1f7c5bb04bfbb21c, 0x3031d13fbb044534 }},
+        {{ 0x1aa73cec7b1eeaa9, 0x033782285ba7a3b7, 0x0bba611331db6f1f, 0x03be4349bb1dd6be }, { 0x327765dfc6bb0c04, 0x230cd9e1f9c9a854, 0x2f85db257d288245, 0x2da4ea1c2c1d5f07 }},
+        {{ 0x90c0c7ffc91848b7, 0xb41afe9f2bde299e, 0x34b6092339a56da8, 0x0dc05e4f4105c9df }, { 0x26cb9615f60d3dfe, 0x79592ea45d79e477, 0xff56343fe9196b5d, 0x0dc723a5bae52c23 }},
+        {{ 0x74db6e3c668ba485, 0x506890eff5550ed6, 0x49479c1e456ac7f8, 0x20e7cca75ed3e5a1 }, { 0x412e0306d1b83e04, 0xb3f89cf52af687d0, 0x1e976b7da33e38ed, 0x19b2d1eaf6612c9a }},
+        {{ 0xa605b6c408c5aec7, 0xf17a533b86e81fc0, 0xb1a47ed677b21c2f, 0x2aac1b84e7e7e4ef }, { 0xa15936daa00964c7, 0x99a414fa17ba0c2b, 0x736d6d8f0d260653, 0x160f97d81c17a849 }},
+        {{ 0x50a9c931577d8778, 0x1e3d7da34a2643de, 0xf5a59d4497ed21fb, 0x073551e02bcf2a93 }, { 0x377f21a71f32cee2, 0x2baa417093981ff3, 0x0fb81d04898dde6a, 0x3ec947ac6435641b }},
+        {{ 0xd783277db293801f, 0x88e5029cb627d31d, 0x4f9b2c38a058b3b2, 0x34dce24c773b406a }, { 0x106e35b59d5dcaf5, 0xc3c256c0f648af7f, 0xdd146725cb781d7d, 0x06aab8c12cf80ea7 }},
+        {{ 0x7e6351093e5dc5e9, 0x4418f7ebfe9416d5, 0x8b97029a3bdfaeb0, 0x22e7b84e6b5aa183 }, { 0x73f954d660e93dc0, 0x81a012ee8a273a05, 0xd22b14a03e72c21b, 0x1e51efeba07ad6ef }},
+        {{ 0x0cb02fb038997e2d, 0xc8c81b4b86bf7b0a, 0x4a6808e54d8f766e, 0x16cad61023532420 }, { 0xbb6039b962ca1dd8, 0xe7ddc8a0d0c8d75a, 0xa376b29a71164dfd, 0x183ecea561b678b9 }},
+        {{ 0x58cc10870b7953b8, 0x914e8448281dcafc, 0xf93dfc8621bbf63e, 0x17aa64dd640701b3 }, { 0x7d474db291439515, 0xc3a7b26fbae87829, 0x189be6355bc01ff2, 0x00b2a6759c17dad8 }},
+        {{ 0x8294db684486085e, 0xb0ed9597d29f00fd, 0xe09b8fbe6daa6e61, 0x39519d629da198d8 }, { 0x17eddf46d444c393, 0xf3fe19dcb9606dfb, 0xedbddf9a47cc2d91, 0x054c5809072079e3 }},
+        {{ 0xef874e5326290a3a, 0xa49a6d847c40f088, 0x0a14002700763cd7, 0x3ef9ebb5f2fdc068 }, { 0xc192ef60bfdbdfc4, 0x75725cc27059a5b2, 0x77c951fd0eff0153, 0x11fff99d025cbc55 }},
+        {{ 0x3253323cdbc58647, 0x0a44233b0dacd741, 0x02d644c283e66034, 0x2d768b2deba42b2a }, { 0xc3cf3e510174d7fc, 0x1083f6085658fc57, 0x9c9425a056f78799, 0x0d79eee7e9227787 }},
+        {{ 0xd4a50ae86830cf5f, 0x9736cb380216ef04, 0xd60de35a5863d0f8, 0x1f633bb3bc782239 }, { 0x405a8a430e9cc3bd, 0xaf6350807ac6401e, 0x7580dccc28f04acf, 0x1ffd135c0787e3e8 }},
+        {{ 0x638d4605aab01f35, 0x2e54ce7156255c52, 0xae9a8af910ba26d4, 0x3ad59930d31c61fc }, { 0xc1beea1a0c1817e0, 0x516452fad73a9aea, 0xa14f18cc350efbd1, 0x2923544782b4d2fa }},
+        {{ 0x29949f4535fde73f, 0x88f95c856524b49b, 0xe8f68e175dbdf5e5, 0x2a7ad976adfc6c20 }, { 0xe3192a345a1ff5d0, 0xe949e21fc57b94ba, 0xf30be4c6c169bd37, 0x198d99a59befc9c1 }},
+        {{ 0x343de6e8be07ddb7, 0x7ad1978121f6d64c, 0x1535b1d05eef59b2, 0x2673b01cf150b6d0 }, { 0xde79e627abd94bc0, 0xd69d4ad3122f06cd, 0x803e64047f116155, 0x1db844df0ffb11ae }},
+        {{ 0x05409416f5fd1f47, 0xbf856531cd4a5c40, 0x74edbea105dd6bf6, 0x2cd193e712cd99f8 }, { 0xb99e8396d5ab06f1, 0xd57d82aa09727f5d, 0xa17f3639808d4344, 0x12059b0eb8039d2e }},
+        {{ 0x3440866321707af2, 0xc8fda354d8e1de3d, 0xe2fe7a0d8f0466a5, 0x056f37fd73ea0c95 }, { 0x9f8d75e330acd7f3, 0x4896da51e152b8d7, 0x169c0dfc65906b80, 0x2ebbe04763d773f0 }},
+        {{ 0x6e22d3f36e75e13f, 0x9ff48cd1de30918e, 0xa6d400553f45e903, 0x0c82741cf1f60b04 }, { 0x46389082d0ea6e8b, 0xdd519131f8d29797, 0x0c01ff674afb888b, 0x18b46944956fd76c }},
+        {{ 0x1e128836aba71b7b, 0xf3dca52dfe2a8123, 0x731c4b583ee4bbc1, 0x0293ce3fac10ac6f }, { 0x88c019fb7e8c4691, 0x834d24499cf357b8, 0x803647a14a8d96dd, 0x386bf1e66048c9a6 }},
+        {{ 0xe16d45c94b840386, 0x061c7f3c989fceee, 0xb44c5364e3b09dd1, 0x208be398dd2e8603 }, { 0xb5c150b6c91da89c, 0x372844b6f7f37d3c, 0x12079149210b48cb, 0x045b7ea8313307dc }},
+        {{ 0x2963d72a89cd37eb, 0xa81c3aa338220103, 0x711298ec2b69e959, 0x052e157c30a0e6de }, { 0x357ab6513d3b7a6b, 0xf8034e34559f6193, 0xd73488fa9ece955d, 0x1b1fc696dbfcc94c }},
+        {{ 0x0c2c8feaa0c21442, 0x4689096b937327e9, 0x170c9a8f25a3b98a, 0x3a8774d4d506789b }, { 0xb487a174eddda752, 0x5d753eea91ee6361, 0x2af252c3d2d38840, 0x3cd79134d4a88328 }},
+        {{ 0x2a86ededc56c0d4e, 0x23dc5bc6b963182e, 0x34da25d7024217a6, 0x27614bb279bb1496 }, { 0xe361df54b664561a, 0xddefd645b9093299, 0x3a8708c2dab46462, 0x0e514180c2176567 }},
+        {{ 0xcd941766ab83690a, 0x06645fde5daef1f2, 0x06630217544e2b59, 0x32f702e420467d56 }, { 0xc56414adad4c8288, 0x93b9b4171acdf195, 0xfe5531ca20eccc04, 0x3e78764fa8c0a5b3 }},
+        {{ 0xd9551ba3727e71fe, 0xfcff482e613ffc43, 0x1346ac76997c6b0d, 0x27cbb231a2973c68 }, { 0x7591f9afb8c71e6b, 0x3080232b5c28381a, 0x47d4c529b692a609, 0x3fa27aa8b33b12d1 }},
+        {{ 0xcd8ae6f32986988a, 0xb20a04cdebfd634c, 0xdfeec45c4d369b2c, 0x07a0c68fe26b1de5 }, { 0xd28070cacb8ef4c4, 0xa50f9e952b8f0ad9, 0x63dfcf51cb5e74b3, 0x03f82f53338c6863 }},
+        {{ 0x57c8387d8f24a54c, 0xfa1b949bb47f9755, 0x9642a7c2c96adf34, 0x1f45303fa0de181f }, { 0x4ced448b10cf6db1, 0x970018f1d9319823, 0xdf6e83fd2a8943d5, 0x06e20a1a2b5e7119 }},
+    },
+    {
+        {{ 0xc8bf8d2017986438, 0x0a648d868fc7a07f, 0x2978dbf468feb1cf, 0x3dc59b7c668ae35d }, { 0xac412200c334d515, 0xed7cd8ab8a0ecc1d, 0xfb9f9a2f936167b3, 0x2704d2d442caa55a }},
+        {{ 0x3ac83b4621a0eacc, 0x08aa655c927d7147, 0xfb3aa73b416a6d0a, 0x143d58f984aa54aa }, { 0x0cb04eb75ba6da5b, 0x59d043b2fe695353, 0xecd5148f75354897, 0x36eafae071baafcd }},
+        {{ 0xf44529e19e8b8a10, 0xdbbfbe79d5282d8c, 0x088f32a0695c7c38, 0x28c9c4d8d118c9f7 }, { 0xed2f92f4f763c75d, 0xc2f091a06978013d, 0x7a191c4eeedac10d, 0x2c8093e980b9b45b }},
+        {{ 0x46e6912f4254be7f, 0x5e4f903abd7976ea, 0xa8d250c12116af6d, 0x375eba6d1bf124fb }, { 0x1d6374def46e2468, 0x23580b4481831937, 0xaf20e379fd63fbc5, 0x049d0bd514a76944 }},
+        {{ 0x312d58af3d7d8460, 0xc55fd904b6895605, 0xafe6ae7b58e774fa, 0x133ba1529426eeee }, { 0xedf27da3f62a74df, 0x0877ca2dd4a90d0b, 0x141df7f7df0244a2, 0x15148294771566d4 }},
+        {{ 0x8f4db007cf1c2cc5, 0x53512fc250fc54c5, 0x60288b2c7ca85ad7, 0x3e70af9a6d2071e4 }, { 0xe1f66b7cc54abb9a, 0x868a1d71f2904cea, 0xa223be6a8b7d5b70, 0x29beca86806b3650 }},
+        {{ 0xb7ecc82909caa56f, 0xed7ce3f396e2d4f2, 0x2441de9cb40162d0, 0x189888c3eebc3968 }, { 0x3d0f4beb24208891, 0xe2402b50ee339504, 0x07eb02dbf78581cd, 0x11eaac560fdc39a9 }},
+        {{ 0x036fa2454d9c78c2, 0x2934021f5bf9ed07, 0xdc9b4e44241d6858, 0x05d88b280419f255 }, { 0xa5db480d70dae3cd, 0x894435a692fac4c7, 0x7ed4cffa6f7d2329, 0x2dc38878d479dd7e }},
+        {{ 0x65f597a2479403ab, 0xb04cf799c1231ec4, 0x9c7b75c94fd70d78, 0x236f56c0617b5051 }, { 0x5afc77b2ad91eb83, 0x643370a91d9a1642, 0xb16dd4be16b09b49, 0x2f859345f17cb62c }},
+        {{ 0x482ad45e53aac81f, 0x5e95f43362ae5b14, 0x3b80028fad15eb51, 0x1ad59aed3a3010ba }, { 0x4ef2c5c9a79be74a, 0x5caa55ed7c92c983, 0xe7d1653f352b3319, 0x3cf951a1fb9bc3d7 }},
+        {{ 0x0e2c19afc51977b4, 0xc3932e049cf40f98, 0xb6d1e1e29f30fa5d, 0x2b26f57f007e86f0 }, { 0xf932da7ffe23940f, 0xea3a753dfe36277a, 0x9f620970f67673f4, 0x141b7ccb47a8ab06 }},
+        {{ 0xc551c703134021bb, 0x176edca622e2490f, 0x4ef31e847381957e, 0x240aff88627a6682 }, { 0xcd7bb95603c3d83d, 0x327c779e90170010, 0x34a9989824e47605, 0x24a2bc463b1f831e }},
+        {{ 0xf9d60d1200c95e8a, 0xfeb5f64ae91c461a, 0xbe26b4a2b3225703, 0x2c284158e5f3740e }, { 0x48370cccb485c4d1, 0x6f3100ad0090d6cf, 0x6597f605384a0a26, 0x3d79b8089ce715d6 }},
+        {{ 0x3722798bb74a7fc9, 0xe3d37f77976e314d, 0x3d41a188eacf77f5, 0x37f0155e9a7291b5 }, { 0xb4c813336654bf1a, 0xdb623f03b50acc82, 0x97238162ecb8ecf8, 0x2be66459225e7da6 }},
+        {{ 0x06cad96e88123001, 0xdd66d180c276e188, 0x3e65a8c5163a31fd, 0x00f857a9d2423741 }, { 0x1976e73198c7e8cb, 0xceec74c40f14aab7, 0x7e4085996f72e5aa, 0x1c05e90106b46963 }},
+        {{ 0x0745c27044f89624, 0xf0de19b57ed7fe90, 0x2b670874895402e8, 0x39c8ea9762e8abc6 }, { 0x348f83bd02db9fa5, 0xa25ff93b467cfffc, 0xa71e5413dad941af, 0x25462ee953cfe3e8 }},
+        {{ 0x0189fc580b41417e, 0x6e303c0009cf1d22, 0x2848a5e718e0a9a5, 0x0af300cbbc5dbf11 }, { 0x9e190db8a6b95003, 0xb0ecd4ec0b581ac9, 0xf3334bc88d913a3a, 0x118e7690d9a5ed5b }},
+        {{ 0x8b2b410af12a357e, 0x07577951954d3cb9, 0x4b9d1e6bb8d5b213, 0x0626186f01c4d149 }, { 0x364614cce5228eae, 0x79f0efb5e982de57, 0x4f719fa5cd9806f6, 0x11cf7c0ab8420c51 }},
+        {{ 0xfec7aa25bedec30d, 0x11c09527bae0002f, 0x682c0aa04e361a31, 0x37ed5dbced4e0ebf }, { 0x11c1ad3f3126dfe9, 0x6528b1b127b8a2e9, 0x8dd32b85a0b06443, 0x3e9935ed0c6fd083 }},
+        {{ 0x66b56fb4843200ba, 0xab5ee0453c3979bc, 0xd027f6a1d665bdd0, 0x08088e8d0f194cf5 }, { 0x179db26e6bbe3e51, 0x3e71c2eeb91edc5d, 0xef1a058f9e516d09, 0x2b2cb1a9ac5e39bb }},
+        {{ 0xd5f9127bfd11043e, 0x80c194b0f598012b, 0x797c5bb9af77557c, 0x2b44fa4fe0bd1832 }, { 0x676e70e1a56bb1b6, 0x72cba8e2f473173c, 0x21c4576032316327, 0x0b28a2723db8ab07 }},
+        {{ 0xce4827ce35368c32, 0x6404723818817572, 0x4964cacdb6d83122, 0x30829fe13dd956be }, { 0x28fba8e35c1216c4, 0x859c7e714dd47925, 0x41495bec79c0113f, 0x39627f043559e0d6 }},
+        {{ 0x25a2951df6e7137a, 0xcd45e8c36b340559, 0x98c8eecbd78ffffa, 0x06244fb8e39a3014 }, { 0x99f91c03214fed88, 0x7aecd06b5d96ed4c, 0x265956841d45f99d, 0x0450a3847275557e }},
+        {{ 0xa5b6e674498206a2, 0xa1cb93475d99b9f9, 0xd1aeaa2216929b57, 0x000504926134fc45 }, { 0x55ec1a3580c7d2a7, 0xb4b8b95ec50dff4a, 0xef2e6b9cc3f218af, 0x325414ceaad7c6ea }},
+        {{ 0x00aca09db0f54fc4, 0x88d9cde33d2da82e, 0xb5450cf51e9f4e31, 0x04a94013f4bbf4d4 }, { 0x7db214985c65621c, 0x6fb4e9b356f8c751, 0x1ff8ad4ba795b2e1, 0x1252860f79537500 }},
+        {{ 0x2eb0e5bf087591e7, 0x23f078b9b8b640f7, 0x9445f7f48f510146, 0x03c794a3d1a3dcb8 }, { 0x4f1e7877b340e0c4, 0x9451ac417dc6e922, 0x7a14dd321fe48530, 0x1798b5cc1aa7d237 }},
+        {{ 0x226280d0281bb6bd, 0x32527daccfe472c7, 0x9d7325128cb2dbcb, 0x30c843ae8922e188 }, { 0x4778bf3c112e6ad9, 0xb5a1449213b00fe7, 0xce7f9dc088bb160c, 0x34cf49158f4e9b39 }},
+        {{ 0x8853d6186c5da847, 0xb4239bb21c7f67a9, 0x780222a4e76c65df, 0x39a576bb0d32efa5 }, { 0x18a0af9268e44c16, 0xb45830db1b81f740, 0x8775eb50f578c65b, 0x37364e8c012f76dc }},
+        {{ 0x7f675f4bde3aa067, 0xca1849f22eed0981, 0x29a227d8294556eb, 0x011d7dd159031442 }, { 0x1279646521d5834d, 0xd3b34d6aae101360, 0x4ea2ff67028dc1bb, 0x187e482a93a6bf2c }},
+        {{ 0x1ccd8ef514d32aa2, 0xb6afb6cbde28352a, 0x9efcde9651c9f200, 0x036a494c0c73ed12 }, { 0xf600c0667f38d8b5, 0xb62465e365d6f23a, 0xde76f0be94625ddc, 0x338a1134dcb6933c }},
+        {{ 0xe369bd8454bd40b3, 0xa773c2e16701c90a, 0x4933d8d8b1e963fe, 0x1d48b41b0b114362 }, { 0x0459f7f0ac34335a, 0x1fd853cb520f0a34, 0xbc10cca1a9b8cac2, 0x23f8c09bb1f5ff5e }},
+        {{ 0xcc0bfc32bb404cb0, 0xbc17493157826e89, 0x2f45e593b5ed3b4f, 0x25a2fac4c72d81fa }, { 0xd863b65463451845, 0x588952866e0f105a, 0x982d25056461a52f, 0x198ecddefe60ef79 }},
+        {{ 0x8635ba6043f1bf3e, 0x949de168d3985597, 0x38003fa2f88d1da7, 0x2afd5b41275f9021 }, { 0xfb698b46b20fbce1, 0x4ea2ee2900981b9a, 0x8c25cb87a188401a, 0x1f8b0e31201aa278 }},
+        {{ 0xb063484281710fc1, 0x163440dc54dcc0f2, 0x474852cde80cc690, 0x03286465603aa6b6 }, { 0x72c8063d2ec98357, 0xa5b519e2f4e040f1, 0x9c52adcc8f156b42, 0x1b17b055df4c1082 }},
+        {{ 0x57d4daffecd30480, 0x9a29ffa0f72790a0, 0xc3186b221ea7c1d2, 0x18fca5e8d4a61116 }, { 0x5d963f810ca844c1, 0xb68d05cd541322a2, 0x8d690e86420d2f2e, 0x160eebbf5842fc88 }},
+        {{ 0x06af81c6fe4eef47, 0x46a4e4639b59ed72, 0xf03bb16ac604d794, 0x224a8c2a424533c1 }, { 0x21f53a68814eb1ef, 0x77e2ea8f2f5c7248, 0x051225c4bca24d7f, 0x178860422d0e309a }},
+        {{ 0x1b6263f32ba7e5ca, 0x1f57618caa71d31d, 0x6c3317fdbe0f56a6, 0x13016bfff6833ee1 }, { 0x112efbef0be2bde3, 0x79ea5b4d83cdc34d, 0x3f3c1a077ccf9100, 0x34338777f0992a72 }},
+        {{ 0x3590ee67741b8d6c, 0xee7e3b93c9d39238, 0xa21c1a95276a60c2, 0x3100dca1e64a6569 }, { 0xced9d1a217ac2a4f, 0x9aa8e87a17d9471d, 0x5d4ba44716063835, 0x1fd947adf5836e69 }},
+        {{ 0xe765dc94f299799a, 0xc0de8f30102936f6, 0x7f76ee3d2fe5858b, 0x226c85f292296247 }, { 0x8d679384ce64f5e3, 0x5c029eac5b5be245, 0xf086ca32111021a3, 0x27ca3aa41056892d }},
+        {{ 0xc6b6ebdde29a7650, 0x7bf0051af4ed231a, 0x6ae758d4554ebddd, 0x14b835ecd27849f8 }, { 0x47edf1ed19528a86, 0xc52dc650e236f142, 0x6607206d752a948e, 0x3913b98461d1078a }},
+        {{ 0x0dc9c538e20f6bdd, 0x9147568f83702b06, 0x0180db5f835665e3, 0x0907e416cd9ddd59 }, { 0x35ab263c636de222, 0x3357359b74410486, 0xc332c975105a9b46, 0x040718f3b8affa6c }},
+        {{ 0x98084006f3436097, 0xb9062ecb8eb0ba88, 0x8201bb8f8208ee54, 0x14abbdba276e4989 }, { 0x9ce51404baf5001c, 0xef5f2514e6e56131, 0xd0e23eaf796969a7, 0x1cbc47c64da13a90 }},
+        {{ 0xf9c62a54398bb402, 0xdc16b04a0639b0e3, 0x1512d358f6e1db8e, 0x182f0c09f787f863 }, { 0xcfbbb6407dedc2d7, 0x88d4c85f9c1b6e17, 0xa1d374652fa52cbc, 0x10f5749601be88b2 }},
+        {{ 0x99558bee3ad1a43f, 0x09bf68c0776bf53c, 0xc83f8026d3788d38, 0x029b3a5774beb745 }, { 0xbef5047f8f576495, 0x750954b937aade35, 0x9dc0b107ff791cb2, 0x3b5540a0e2d7e240 }},
+        {{ 0x0510e45f78055279, 0x8f85bd8cfe2ffda5, 0xf912d4d23603fced, 0x307858597042fb7a }, { 0x1f7fc104d6e1b02a, 0xb1e43c6bac78087e, 0xb1b386d6664e2555, 0x3a9ad902af92c99a }},
+        {{ 0x367fb771af5fd16d, 0xc72396273f271573, 0x2c18a373c0866884, 0x2e5b6db31dbe9313 }, { 0xbc86a5998d46e9c9, 0xf04e4e69636f3790, 0xa32a90d87abcccfa, 0x390693a93afdc4ba }},
+        {{ 0xca4072bdda8fb34f, 0xcb0e52f5d976e767, 0x4c8049035a0582f4, 0x03f4a33575307c8f }, { 0xe6421d2a00334a35, 0x80d6cd39a89328bf, 0x752faf1d43d13a8d, 0x0693a0526d0d100a }},
+        {{ 0x1bb5e764c9b81888, 0x98299c8796ae7d89, 0xb74de9ff547a0015, 0x2105ba90fcb603d5 }, { 0x39aedd882eafbccd, 0xa28546de76b72e97, 0x8fe07f7342c703d5, 0x3ce1ea5a294c3eac }},
+        {{ 0x382b12b75780d843, 0x3ff408244d4b424e, 0x1d2601a2493e41a7, 0x0c1246339235d035 }, { 0xa312f5f1ce5ea755, 0xe9b68939e41bcb12, 0xf71d1dd1df0eae10, 0x0efd06dd928377d5 }},
+        {{ 0x43d812f1e9799d22, 0x402965fadd0dd1f5, 0x361e94bc21eb67ae, 0x1e3c8bbc6e7f11b1 }, { 0x58620b2705dfb60f, 0xd6900c29d5fed03a, 0xdc3b450e5ef130c9, 0x39abf1d1e3d490e8 }},
+        {{ 0xcf3ac8eb28c06028, 0x56890f476270d006, 0xdff2bb98260d1bc7, 0x22791236e102de0b }, { 0x90b5c4020ad1f9e9, 0x13ee334d9b18dbd7, 0xc570a640e6fcd3da, 0x3f30c7df31e22533 }},
+        {{ 0xea4f6a2c88c108ba, 0xaaec3449ae228bc0, 0xf4ce1fcc23c7c8cd, 0x0edb74ff1c19a2b7 }, { 0x9ea62ad5224cea67, 0xcefb96e046031431, 0x624a1a825f5223fe, 0x1c2fc289ae3a147d }},
+        {{ 0xd999308792bcf010, 0xc768985f4bc57764, 0xb3da9af1877e7989, 0x37ac9bb095a51b5b }, { 0xb5acc4d30c95148e, 0x33b8baf609954f56, 0xb6a39f6842321d3c, 0x1666e0c9477f00ce }},
+        {{ 0xe2c1deb25267ee9a, 0xb6aa6d73d57c89d9, 0x8b8a5e178a1ba30c, 0x2d1b53fd931d91ac }, { 0x6a2d78d042f49581, 0xec00432b76dd7107, 0x4fe906ee1d82efff, 0x30e3e8cc7420c415 }},
+        {{ 0xf7eb3d146c1194ca, 0xf98b4b9c0536bde6, 0x3bfe5dc37bea15e5, 0x2430fbfe9eb427b0 }, { 0x160a91d6e3152edc, 0xd33bde97cc8c658e, 0x0231152b308a6021, 0x146dd96823219b84 }},
+        {{ 0x03677a56b224d106, 0x626bcb8581cae82d, 0x4039a91750b615e7, 0x02d821894fffee5a }, { 0x70d0b716c15c6597, 0xabbb6ee46c2234fb, 0x358673b12b079b41, 0x31db0e318a4f5a1c }},
+        {{ 0x4ba03274f350ae61, 0xd92caf4c81b7247a, 0x14c02aaf2690ba76, 0x0a1f958efaf48880 }, { 0x6e0075a2b91482ec, 0xe6a10331881106ec, 0x4ab023ad27015dbe, 0x391c4afdf1b98306 }},
+        {{ 0xa7b0581b33ed956a, 0x878127ebe25ec4f4, 0x9ad293a7e05719a0, 0x181dc2946f138413 }, { 0x47a0f57950b0648a, 0x431f9a0c7282275c, 0xfd57b3a5ab233392, 0x3963fd1a5c7e6f57 }},
+        {{ 0xeb0320a18b32d70e, 0x8c0cb9e100d653bd, 0x2a947b067d37266a, 0x220bc132ae1e31f9 }, { 0xde94009c52cdafe4, 0x36e1f0d7b2169013, 0xe8821638d5372b2b, 0x1241b01815d16707 }},
+        {{ 0xf8d3be236a6cdece, 0xbdb8ed4d6dd601f8, 0x22ea77f9091b3310, 0x0f9a673571142215 }, { 0x4bc97381585ac73f, 0x8a6acccc25e308a8, 0xf341cf4716f35254, 0x2e207aed3ccecb46 }},
+        {{ 0x69a2fe0ed7f2e9de, 0x3998e02260025cf8, 0x5f0cb348a7e6b2a9, 0x10536343a9aa8764 }, { 0x56886ee3b1787736, 0xe42ffadf41c0f679, 0x4f9d9a6a57e6b442, 0x26398d753be36098 }},
+        {{ 0x2203b03fe4d9aa0f, 0x896c80434473a1a9, 0x3912bdccda422826, 0x0e2fa1a13d645c7d }, { 0x12527277339f20a3, 0x1b2304d1515614a7, 0xb1f5b3c32b4277ea, 0x0875f7f80fee7615 }},
+        {{ 0x4f6d27a3df0796b2, 0x9c6064e3b5c2884e, 0x4f651d7c7edfa7f1, 0x17d90a9c0401af4e }, { 0x75617bc80b1ac376, 0xed57b77cdf4d8ba1, 0xbd15b67ca8f1e782, 0x2abb9e869439cd66 }},
+        {{ 0x555750ed1cbc9b5f, 0xac0189f2ad07da63, 0x8feeae4330cd5dc7, 0x073ef1f72661869c }, { 0x24aa3dc01d297807, 0x75ce5c88c1f277f7, 0x744c7ac5174dd466, 0x18510f1c436c00e1 }},
+        {{ 0x1864e12b494173f4, 0x6aae964634478e65, 0x09dd0647c222a8d7, 0x1c02056956364a21 }, { 0x34ccad682985a1dc, 0x5a4c994403edda8e, 0xcd5904da05dbcb74, 0x0704c64fbd97c1a5 }},
+        {{ 0xb538d2846ac285f1, 0xf26b6a5fe62557a1, 0x50b5a0070b6df343, 0x3eb247c89fa1e99c }, { 0x41f8ec7c4d7007b1, 0xe56bfcd9bbb016a7, 0xfdb5171d008c3757, 0x31d19d1125c06b27 }},
+        {{ 0xdaa138af26d23405, 0xd88c147f89bb9d6f, 0x4943cebfbb3b510c, 0x0792491d5964151c }, { 0x210ecb6aa24c90e4, 0x1ef98f79cb9893ce, 0x1436aafb80d8454a, 0x3430f348fd25419d }},
+        {{ 0xf65e7199f824d34d, 0x2fdc77e20108859d, 0xfe77d0a2910a51d2, 0x1ed6e4e3477c6bb7 }, { 0xc13accbedf0972cc, 0xb30f805e7730e2e8, 0x7f13257ffbd45e36, 0x3cf2a3d12bdeb055 }},
+        {{ 0xf7d47e1816d6b70c, 0x348f0740922074a5, 0x59a5644a34d63951, 0x2af8777f93221452 }, { 0x3ccfd33cf9a61c4a, 0xb380d924da13d637, 0xaa91df1c047325cc, 0x020e3f143b75dab3 }},
+        {{ 0xb1724589d89751c2, 0xe106da782e148540, 0x427c7da84c488507, 0x2fe7b0f14601ea39 }, { 0xb565f1686a93bf8b, 0x49712e1cd3acb781, 0x4e81fab087e5f802, 0x162cceac35cf31d5 }},
+        {{ 0x9390f7aafce8c655, 0x4b72c42f314479cf, 0xed8a89b59bd636f2, 0x2e23f52845f93458 }, { 0x25af9ef089714973, 0x7784b83d5f2fa3fe, 0x0a293aaf92805211, 0x28b1ef436dbf96ee }},
+        {{ 0x2aa08a0738c3f56a, 0xb0bd13ecbf151533, 0x682e0c5636fe29c5, 0x18d4e4ac67001bc1 }, { 0x26e401d5a04369b2, 0x0ad82e7c2ba320e4, 0x61c63484435c8db8, 0x3369a195866c89c3 }},
+        {{ 0x458e9fd6bb222c18, 0xef4b9fa85d7e2d9c, 0xac785f5a9587e3b3, 0x2ed7e6a8b1d9d37f }, { 0x6f6eea2e7ce77b79, 0xd4b46c2252145083, 0xa98caf7450c87608, 0x1d931cd958400e46 }},
+        {{ 0x036ececfb8eb17bc, 0x07d97daa680d9fc2, 0x5e14b411754ae159, 0x250b0f1ae18fa540 }, { 0x9173e7782f1de740, 0x2acb4616ea774e52, 0xf6662d2f737c48b7, 0x2c30dac7f5c4e979 }},
+        {{ 0xd250924c71f50cea, 0x3ded239dd1504359, 0xe466a2a6c16c0fe6, 0x2cbb1a1cb45db8ed }, { 0xe1e296db9b3ca68b, 0x0e8668194e0ff385, 0x551b6a68e9f4dea2, 0x1d7a70f7e48a0d74 }},
+        {{ 0xeb28d1a820722693, 0x829f4a0b36776a69, 0xa2d37da60a3eed0a, 0x3249650ec2fbc0d6 }, { 0xaf83b05c0980e178, 0x4d2aebaff962ecec, 0x8afb2572b1031322, 0x381a9e1335a9fe5b }},
+        {{ 0x2d385f53385cc93a, 0xde17eb3cdb344cb3, 0x0743af74610e646e, 0x37f5aaad02b82ee7 }, { 0x15cb67ec0d900f1a, 0xfd5c907925ad5b5c, 0xab7e2641ff938ac8, 0x3dab28ad5a5fcd89 }},
+        {{ 0x30e72846f6fba23c, 0x2480dc0008028450, 0x8d41e1df0ec77460, 0x14637c6520add5d3 }, { 0x575056494c8fd89c, 0xaff5b14560e24f97, 0x85eaaad47362edb3, 0x1db28ff17f34e51f }},
+        {{ 0x6947ba277234d162, 0xf4c93eeb2828a271, 0x574ca3dcbe62ae1e, 0x185b5dc8a444d52a }, { 0xc660447f41a5bab6, 0x6ea1296f4e5656f8, 0xc2822cf12a9db3e0, 0x06521e26bb6e7c83 }},
+        {{ 0xb6cbb710b414b44a, 0x7773f2d46bd1899f, 0xdfd76ba6a0244e80, 0x061cdc93819068ad }, { 0xbea6ac99c7a32cbb, 0x65194e0369605435, 0xf56ddc970fe378a7, 0x24bd282c1f8a1e17 }},
+        {{ 0x1e49fc3685aad89f, 0x366101d75036debc, 0x28e20a0bc2a934c9, 0x0fb8b395284c7d54 }, { 0x8d688cc9f5cd7fc7, 0xebbc20d59a82757c, 0x22ade84d6747c82a, 0x10e6bf1e40ea5dbe }},
+        {{ 0xf5dc825a6e58f7ec, 0x88c7ccb3bc5ac45a, 0x68ad517379f52768, 0x2e2d3f7049fa3a45 }, { 0x8fac5f61501bd85d, 0x4beb5a3b1e9f160e, 0x796f85982c993955, 0x0056546d58c9b624 }},
+        {{ 0xbd5ce1abacba206c, 0x9343caea29ab5c4e, 0x4a900960367a891d, 0x0de326640d294871 }, { 0x6a41cefd1d99da73, 0xd3db14391d8b47cf, 0x38a28fbd28d276f1, 0x2ff1be61b0c30b34 }},
+        {{ 0x59a4fc7ee9c70c3d, 0x09544f82f319b765, 0x9a910476fb781f5e, 0x37ecd334b615fbbd }, { 0xe258257c9bdbebb4, 0x5f693ac6a4444953, 0x6b77af6037e31e9e, 0x3d3cdc2b66e178a6 }},
+        {{ 0x9ff2a8201b1815b6, 0xf3387469eb58df41, 0xb0ec78e0e5ad36bc, 0x019424ec479db33c }, { 0xbb1e721de4e2ab2a, 0x53223f48e6abd765, 0x472afcbd948cb761, 0x1574f44645ba3f5f }},
+        {{ 0xbf6745e29e7eda90, 0x460f21b5c77690ab, 0x121665ca69362205, 0x14db6d3bd201ba77 }, { 0x4bb7a2f37658116c, 0x9d5edc3b25994e37, 0x4965137b93afe7c6, 0x2fa02292213735f5 }},
+        {{ 0x5ca686e5998beeb6, 0xccd1f7ef297c7e2f, 0x5c0e89be45499504, 0x3a5d8337fe2482c6 }, { 0x8fbf01795945eeff, 0x63ba59231c918b48, 0x93f068de159bd973, 0x2754709ee2115713 }},
+        {{ 0x5293288367a7965b, 0x7ef84d5c900e2874, 0xb994b6d5b0c7f42a, 0x21b092fe3db45856 }, { 0x977f3b34c62d2c44, 0x1c8eb869e879e4a2, 0x9fa776cdef10ad3c, 0x1c05729009f314a9 }},
+        {{ 0x57435a60b9e48de5, 0xed2d884c3373931e, 0xdf8666f3fde78437, 0x02225dbaf9ba8b7e }, { 0x2e33e5a089b1c381, 0xc628535fa569485e, 0xc46c55a3dd53ec85, 0x25705209a46738fd }},
+        {{ 0x7ab3b0c69f606853, 0x0f5ece1e103aec2f, 0x5a420e0d0a0ee62c, 0x20975c7931141f3c }, { 0xa16e2aafb79d0522, 0x06d80e734a4c7ce3, 0xff11c0a3875ad05c, 0x0803254e0b88bba1 }},
+        {{ 0x2f6fe82bd7718302, 0xb88ff9b5908b223c, 0xa68e05d987455539, 0x0cf0f15e00dddf79 }, { 0x67208a82615c2063, 0x69897719af26f018, 0x61c0edc24fc97056, 0x3f5f03e8bc881a89 }},
+        {{ 0x4269a4b29595b7ac, 0x7b2f71089793aee7, 0x99c75d687506f57f, 0x19318226dcaa59f2 }, { 0x49817b37acf5e70d, 0x39f7f8467fe0651b, 0x46175f2b338cbcbd, 0x1a57f2ff2f9edfe8 }},
+        {{ 0xa99e8ef559c3be65, 0x6b2cbf1ffd488840, 0xb8206fc563679042, 0x1171ffda3efa068d }, { 0xb77774b01648821e, 0x4e456af775c1e857, 0xf563a417fd6939cf, 0x0d0642025eaf6c35 }},
+        {{ 0xf0b230cfadb99351, 0x068e044a88642cc9, 0x61a43c43372e9661, 0x0fa89fc7dc1d7abe }, { 0xee669b03aeaada68, 0xb5d835a974aea6e3, 0xaedbca78afde5dce, 0x1b9ddc139352a5ce }},
+        {{ 0x2976e41d23dfa6bc, 0x961a0cd5ed891533, 0xaca004dc12d9e061, 0x0d21acaccbedc71a }, { 0xa482f274a450de66, 0xcb9dda3b116e449c, 0x667c3e3825fd22d4, 0x3a21dacd9be2a40a }},
+        {{ 0x006c4ea4fe188c1c, 0x463ce52131419bf9, 0x20c257a8e4a4f7c3, 0x06c5e0f25a7570cb }, { 0xe45645debd3b7fd4, 0x84eae22f89469e87, 0x2e69cb61cf355953, 0x3f63da8bc3f5944a }},
+        {{ 0xc00504a0f8538802, 0x93062d1fbbbadd89, 0xda7fdd4a47082c8b, 0x15bd310bc775e06f }, { 0x89d51d6206f7a810, 0xe94daff6b1374a94, 0x32e67132a8fce157, 0x24e0e7290697e049 }},
+        {{ 0x2af08d1c7ddbc575, 0x84c553823d8e83c9, 0x6f5981963a8b9e53, 0x305c3ed35f3259ea }, { 0xf917dea99c2d291f, 0x1a9910028813fc2a, 0x4ed36790f7ae153f, 0x0252d46b1ade55a6 }},
+        {{ 0xe75c8e3a5936d27b, 0xf20ec4353f344ef2, 0x8df2db8e64e600b5, 0x22f447bd061bc78c }, { 0xacbe6101eaec0c37, 0x4912bd48637e4d41, 0xe00aa3ca3d05fc27, 0x29bd26769018451d }},
+        {{ 0x85ce146325eb660a, 0x9633425acaf26a80, 0x235741dc76e346c4, 0x243c3872dde69f84 }, { 0x1e0ede9e3f99f2e4, 0xfc2cb1a285178528, 0x5131bbebdcf53763, 0x3bd68044dccf4347 }},
+        {{ 0x059a9c54e138943f, 0x1b0c0a9a215ba942, 0xbbb99e1b68a9772c, 0x0f389338dfadd4b2 }, { 0x067c6e91d2e198cd, 0x24fad5fc25f05b9b, 0x394198e17cad8ca1, 0x399186d3a0cc2158 }},
+        {{ 0xd695e678859ba0c7, 0x531ead9521c8d91f, 0x2b2e5138970b2d31, 0x3ab7085dac9e510a }, { 0xc9bf15d7f3856c69, 0x9a742e2a60e1797a, 0xc3850993c39f07a4, 0x10917d119973d577 }},
+        {{ 0xb66339b049660b50, 0x43d70320a7244d11, 0xfcf64a35d0abcfdc, 0x3dbe1c28cbbcbf0c }, { 0xc9dfe83ee9a0fa12, 0x0260d36d2619d479, 0x9ce7d1de1dd09cbf, 0x227d6145326371b0 }},
+        {{ 0x1603e25c339efa69, 0x1f8f03851a44aa12, 0x0ba155b0570403b2, 0x19c3c6d6e01ec580 }, { 0x24fd86408db66c06, 0x1dbd4a53e66cea3d, 0xcfff6c7c70682d00, 0x3e5b12dbaa2850fb }},
+        {{ 0xa028133e036d6379, 0xdbe1244b6361f52c, 0x8dc2c50d84d7059c, 0x01a857264b5df4e1 }, { 0x8196c95044bd126f, 0xf2da04d2af3b49d6, 0x7d8fc50f96720827, 0x14dd8f2ff254e518 }},
+        {{ 0xd64d6c29df299e96, 0x83dc443057b10f53, 0xc27fef507e85f30a, 0x2422632b3bac46d9 }, { 0x914104f9e3bc8f46, 0x3aee800824e9b6a2, 0x8426dd68bbaae2b8, 0x2e58f837385e3fc2 }},
+        {{ 0x5222d102d8f56490, 0x1d37ecd39f873996, 0x03de7ca051006874, 0x285948c03823ce26 }, { 0xd70097f330749a3a, 0x78ede31b361456a5, 0xf4b3340c641a75ea, 0x1ccd5823e72781fb }},
+        {{ 0x5f1ff3a05354bcc5, 0x33e518337919f407, 0x42ecbd0482fa6ac5, 0x38c33eecef6905e2 }, { 0x3ac906c3fee5ddd6, 0x232b9700e69856f5, 0xd95847562953103b, 0x254c45c08d124968 }},
+        {{ 0xe0c58e23765b80e0, 0x56ec7c97aa504096, 0x8b3b06d8451ebe42, 0x150c376d7de979cc }, { 0x90347681264f4e39, 0xc0e25fb4a8f3b2c5, 0x6a3f43c04e0f9ee0, 0x0f412aa1bd149b7b }},
+        {{ 0xb0f0cf427d4b6759, 0x0ebf5ffddb45de77, 0xba4d246314a838c5, 0x1fd20f0d4de4629e }, { 0x5c4ee8eef5294634, 0x6ee301376b987d58, 0x1929dc63f6b2fcbd, 0x00705443339538a4 }},
+        {{ 0xedc3fcf66336bdec, 0xfebaa8805c892c2f, 0xa7da1b24c1eeab90, 0x04d85dcb20000871 }, { 0x154473c25849683d, 0x377796c0185fdaa1, 0x31ce4a72aba6e985, 0x0b05add91d2cdcf5 }},
+        {{ 0x13b7468d6ea4d31f, 0x7606d7ad2218ff7c, 0x464f021618c3667c, 0x048b24b1a2ff9d92 }, { 0xccf90a907c33426b, 0xc8c3f2f7f07d2d2f, 0x8c4a9b1469f59781, 0x0793a4198ef2cd37 }},
+        {{ 0x6e4b371bf40a42b7, 0xc16a18e76a318e0b, 0xbf6027c081f69afc, 0x2cace9811398708c }, { 0xa228ee410da7840c, 0xb57901ca48780860, 0x0c2e55a56af43f8c, 0x1880741fda6d0ad8 }},
+        {{ 0x6e5c24d6107ab62f, 0x4b9d5910414631fb, 0x584c33c0c1406216, 0x2d8a05d1a0c8368c }, { 0x42e3904850a0321a, 0x623b3982a7e17400, 0x8477ff7996df47fb, 0x04a28482e34f20c4 }},
+        {{ 0xf5ad4350db79a11e, 0x2bdb20f6dcc7f701, 0x7b444e281fa61333, 0x2efdc5173ac9ae85 }, { 0x75ad85061381e902, 0x6a19b5ccb8b802b4, 0x5b074e0e789cb58d, 0x01258b7e543e7026 }},
+        {{ 0xd13c7221c230ebbf, 0x11f8dbda9183f923, 0xf5114372e1f1e787, 0x25d11ba249d0448e }, { 0x3ffeb97d7e7f47aa, 0xca3663a2d66c7361, 0x15a1f4061a8eb018, 0x125610e80c1cc920 }},
+        {{ 0x3267ed1ab76f306e, 0xd0566ad7d9aadc86, 0x8bff633caeda61de, 0x05a0da2e6c747185 }, { 0x4aa6b3096b300024, 0xfe881bee9d3c18ab, 0xfcc326d21a4bafb0, 0x2b76d1da83fe86e4 }},
+        {{ 0x0476b488cb041851, 0x95ccacbc0805b91a, 0x0a7021239329b842, 0x1eccaaf0d0eb6bd0 }, { 0xf982f1b25fe5173d, 0x00fc633c32e58fab, 0x3b3094ef7d4be3ed, 0x25fec9b81a4c907f }},
+        {{ 0x048ad417a346ae3a, 0xbe3aaf69bfca48eb, 0xebf0621f9dfc85c9, 0x05bf708304be7213 }, { 0x3f4e50d95b8e34e5, 0xe4a8755f3a223bed, 0x79641a43fc0f2296, 0x09baa21b41624fa3 }},
+        {{ 0x2f8942e4558baa17, 0x140d349f87e8aa45, 0x921917d3f17c9a12, 0x27890ec922240654 }, { 0xae960800778d2822, 0x08c1cd1c48f64823, 0xc90e4f27a5ee0808, 0x127d70457ba11ebe }},
+        {{ 0xd8ba44dbfcba0682, 0xcc1d13481ba17f98, 0xdf955935fb2839fc, 0x139eabf3be10ed2a }, { 0x7380c38a609a694e, 0x663e061f8141d1e1, 0x17de1dfc2b032520, 0x0812ab27be2ba8b8 }},
+        {{ 0xfd9328b81cf8ad31, 0x55538389f20abb82, 0xfff814e8b7559f30, 0x1a64cff35a7bfe70 }, { 0xdc9648fa4a4ba9bb, 0x5b518706dff5ee89, 0x9ecb11507c0ffc19, 0x377c0c0f02a1ea43 }},
+        {{ 0xcb2b4e0ae3e4d269, 0x7705163ea6cbebdf, 0x1ba59f78914af0db, 0x2446d9c4416f235d }, { 0x7c45d33db096fbad, 0x7e54120c51013404, 0x0346622c0d855775, 0x2fdfd0ba2ec6bb5f }},
+        {{ 0x47c14e1a64ebc8d0, 0xc2d08d307e11ac72, 0xecf5709c3f1c539a, 0x1d2e6fc0ad9b0915 }, { 0x8787ad345465bd58, 0xd3402ae706922a45, 0xefbe65bc5f30dafc, 0x247c85d971170640 }},
+        {{ 0xa4ec4a52e8c363ee, 0x607e5e7cb72c293a, 0xe25859bd502effa6, 0x0803bcbe365229d5 }, { 0xa9c6556d73b60662, 0xbccf653ec93a0e47, 0xf4d6cd0997ea0b53, 0x3578fdfe05beb992 }},
+        {{ 0x24913a2ddad9a6c3, 0x9fba6599d1418c8a, 0x20c8ef156f1b3802, 0x07d33b8ee7c195fe }, { 0x94b133fad87c361e, 0xda154bdb1ecef829, 0x29bae329d1de3a60, 0x2117153f896e82ae }},
+        {{ 0xad3ea2255b5dc2bf, 0x8242c7a6204c91c5, 0x945ee680a74dc1c1, 0x070b6750cec2a775 }, { 0x046b859687477cba, 0x72bbf53c287e071a, 0xb26574d372a65b75, 0x15858b84da8108dc }},
+        {{ 0xfa4cb9e1576de38d, 0x49bc88908f82429b, 0x81ac4298aab9ffac, 0x371e8e29458d6d08 }, { 0xd4e680f8594d6740, 0x2ce7e6a222853c3c, 0xce501d006fce68cc, 0x006079107adc3029 }},
+    },
+    {
+        {{ 0x8b569e79f132af4f, 0x7e02fcac2b09b973, 0xe8ddc1b1be6a31a1, 0x169d51132c191ae8 }, { 0x050e23ba73cfa57e, 0x16804339dcd5cb3c, 0xdd53a79de42a024f, 0x0b1735f540097998 }},
+        {{ 0xb2b1fc9651b23276, 0x1b322f70daf52136, 0x5a113f31f0ee8ac0, 0x1010a19ce337841b }, { 0xcd933069f1c0c38c, 0x2af9ce597ecc9c1c, 0x54dd4313b946e10d, 0x01827403e572f35e }},
+        {{ 0x8a98e9b459dfc557, 0xc550aa6d3179b931, 0xe6c17488faedb0e1, 0x23f3b2a29b1bdfb7 }, { 0x0fd7b1c3f6a87a24, 0xebe75c17ce8ce651, 0x125870ac498ab3de, 0x06e9877faf57c548 }},
+        {{ 0x768bee874e98fce0, 0x968a09c775207ee1, 0xbe910c7d8bba0514, 0x21bd5b9e9f12f76f }, { 0xdcd374f11976c822, 0x2a0e5a45c3495b87, 0xc74b3c04b11c0443, 0x20d7c1658ca61943 }},
+        {{ 0xceef1b8749466747, 0x345294de8af21bd6, 0xeed3078586626909, 0x2fce7eb4a612f819 }, { 0xce3478c629b1fa82, 0xd7adc5fce2722f02, 0x36947aaecde5660f, 0x30ceca4b93c4c610 }},
+        {{ 0x97ade78e26abdb8f, 0x7efe7e4ccbf3ecd9, 0xe16ff1f008f70739, 0x3c245ec28297963b }, { 0x7afd8bbbe8a46ac0, 0x95ddd75b010e9771, 0x4ed924dfe51445a2, 0x3654efb6e668df95 }},
+        {{ 0xe392c4456fbedb1f, 0xfc4063f084a0251b, 0x374c04276d2facc7, 0x2a8b7b0f0226d27f }, { 0x37d946c2d7f35efa, 0x673b41a3e0c4a84d, 0x0c2ae86b45ca27bd, 0x0b9dbb384ff55a3d }},
+        {{ 0x9a88691e8d7109ad, 0xa9256956bbdd62b7, 0x127d4af96ed2255e, 0x3cea6b8e1b0fb0fb }, { 0xb7c62fcb14935993, 0xe8bfd4be3f456b3e, 0x7b6814c8b2f5acc5, 0x30c4c2a9f8d78091 }},
+        {{ 0x58c91706acf83065, 0xa26b198358e1db23, 0x048ff086477b7937, 0x16b5a3649eadde45 }, { 0xcf88d34484b4a135, 0x08de0aa92a7951ce, 0xbe93d98891131a3d, 0x1b296a87956ea220 }},
+        {{ 0x7b3917cde71a16ed, 0x084782bc6d03dc93, 0x2b46545ff916736c, 0x345709febba14a01 }, { 0xbc530a462b411965, 0x5d54cf04ca045e1d, 0x59d72f5de59c8346, 0x2ea3e3b0465e6829 }},
+        {{ 0xf85bfe004b84844a, 0x407858f429b8bb48, 0x75b147105ee92a68, 0x232843252e0a9dfb }, { 0xe18934529e082a45, 0xb83a6c18190f21e7, 0xd5b385caed6c449f, 0x1fd5056b1651d6c1 }},
+        {{ 0x886c3ac4f05f92c8, 0x43bc3d0c37b7dfcb, 0x13e20649a38e2386, 0x02b210a9a9752277 }, { 0x0e375aa87a1e07ef, 0xb824de9d9dd3f9fd, 0xdfd7e458705458e0, 0x32bf6cf1690d5c82 }},
+        {{ 0x731f9953f57cf7dd, 0xceda5a1c9f81b86c, 0x5de397c970a61721, 0x0ffe368ed52ceb30 }, { 0x1948e2c2b16ed95f, 0xeb4bd2f70cc237e0, 0xfdf29c909fc508ba, 0x3d005e693a6e3dfa }},
+        {{ 0x48f9b14a866910f6, 0xde67fe5759e00e10, 0x7919410d5e264868, 0x26cc61c234b7a765 }, { 0xaf7f823c167f0243, 0x5f7158ffcc1f0b60, 0x61d018a7caf43784, 0x3b053dcf959a29aa }},
+        {{ 0x2e35accec9fd4262, 0x79d850b8b52a5696, 0xf3c8dc9ee13e765c, 0x13a69c8b4f33929b }, { 0x70ee453590563e61, 0x26dfff5026e4db25, 0x20441bf951691e22, 0x3697434eec9fecfe }},
+        {{ 0xefce2326251b026c, 0x5597d5020eb82939, 0x77d40de27d379b79, 0x3bf388849488d361 }, { 0x17b72fcca6cb2dd2, 0x96b7c46694ed3245, 0x91a8233032e27ab9, 0x174dc3175818b9fa }},
+        {{ 0x7cddc6d6c65e0a19, 0xfefb90af4b5b50f3, 0x0281adf6896f45cb, 0x12015a2648758113 }, { 0x282b37cb75ecdf10, 0x4d12fb4967e90387, 0x4125c700a980c1d5, 0x0d2e6c889b2215ac }},
+        {{ 0x355455b3e91ef0df, 0xbe95fcfaaebf857e, 0xaf5e469147a3e1cc, 0x3b54f8e62c7f78c1 }, { 0xcfe64780476bf551, 0xf5284d419ea31cc0, 0xe50b966ae4aa164c, 0x3f4248e1a3345844 }},
+        {{ 0xa0a51615000adcca, 0x77d2e550f95e9a9f, 0xc5959f8b6cefc812, 0x1526ff7cd0178b08 }, { 0xd6ba5bad977ddc19, 0xc99c07c926eca6ed, 0xd7301eceaea761b5, 0x3b0f79acc477a14a }},
+        {{ 0xa31bdad28ae6a90e, 0x2cab70d7f9788cdf, 0x802e9ea0dbd737c9, 0x19c1ca3764ba5984 }, { 0x27b05283bd0f17e0, 0xbc95b9bc84e7ebc6, 0xc518771233fcb6c6, 0x1d5faa6d41153666 }},
+        {{ 0x1c2b76288ae4dc3e, 0x9fa58a57387cfa1f, 0x978619d0ec6efcb7, 0x3468109da4e6fc13 }, { 0x2c6ff621c38ff4ee, 0x439a4813d668483c, 0x8dfeea6c2e7ffc1b, 0x121e70579263dc01 }},
+        {{ 0x3cb993f3a34e52a4, 0x19ed32215e4c461d, 0xaae8a735fc453846, 0x2fc516350cd475ab }, { 0xf9c20d8fc3dda196, 0xa95b0335d7d93e1c, 0x276d93e44ff80ba5, 0x1a8e30a2e726e187 }},
+        {{ 0x122c7686f1b39fc6, 0x79f5a1f39d56ac2e, 0x04f6a97b3e2cb4fc, 0x38e6e5d9de829a9f }, { 0x56b9cd3a9ef45f24, 0x1a06be7ebfefd4c3, 0x062010c616e0d98a, 0x018d0e7138d2fa3c }},
+        {{ 0xadd15ae5369ad86c, 0x3c8d09e081fcb94f, 0xc5fd82e558bcfb7c, 0x33a388059ecb7645 }, { 0xe376f93eee0d4c92, 0x1ee065e621f90baa, 0xdbd1cc42d4337097, 0x1bdada2b88e06c55 }},
+        {{ 0xfebf3edbef83c6cb, 0x86a9725a5ce5e98e, 0x75ee74fdce8fcf84, 0x3cda5a604757cf1e }, { 0x9acf5fd4013bfd27, 0x3cbced1716a2e516, 0xb5915455b9e155a3, 0x14a66f3679b6dfdb }},
+        {{ 0x7222126a61b7499d, 0x7648ef874bd06b16, 0x137d4f90ac0e4133, 0x1f78c5763389cc9e }, { 0x1fb7ef2fd79ccf54, 0xa7ba0c4d90b71d4e, 0x9259e8fe2b43ad05, 0x1dce0cb9f7a8df01 }},
+        {{ 0x42d6de1617d646ae, 0x8e781959f6fdf4e5, 0x5e5ff95ad5f8253e, 0x04142ed9d9d5b7fd }, { 0xfda79d67aaaaebde, 0xf64a92463c6c97bf, 0x8a65a0b4a206d2b5, 0x37c128c1527491ca }},
+        {{ 0xa23ba170fe88fa67, 0x62333a04d6e9dd49, 0xfdd4c76ba22e9012, 0x26e2c0ed5c8be146 }, { 0xf18df3a5cb98eb1d, 0x5641806dc2966dd3, 0xc81331e9f2fd049c, 0x306bb09631d7dc6a }},
+        {{ 0x5eca7ab6075fcdf1, 0x1fff259025789c24, 0xcd068c39f2a85278, 0x1721f3397e912e08 }, { 0x485f73a37a400ea0, 0x2dd4453048221f80, 0x0b88c1cb547b6f59, 0x3c46d66aea6eaee6 }},
+        {{ 0xb13db8ab14821626, 0xa0895c8716972e22, 0x87dafc714ecae0d6, 0x2961b42171f63a05 }, { 0xdaa00f4c043b30e5, 0x6b1153e9225be50d, 0x3a644bd0b9938fc1, 0x0aecaa533f96130c }},
+        {{ 0x75536d29392d4010, 0x6eb1e007539a5b70, 0xc684adae6d08c00b, 0x14ed0d9d96af6745 }, { 0x80db4fbf3548c9f0, 0x1ec5a41b24889079, 0x11196e9da2d150f3, 0x2a9b0d302ba7b725 }},
+        {{ 0xd7a7cdcfeaa5e826, 0x5b2eb69d6ebc1a06, 0x4a01ceafbf174f6e, 0x2a769b3076987894 }, { 0x8a5ad0804afa14f5, 0xc6416fb54c57e6e3, 0x1b46fe4936c84534, 0x0251b6679fedb366 }},
+        {{ 0xeb5e0582dbeab147, 0x55d7863cde85b641, 0x34fc6d56d4fd92cd, 0x22bd8adb32f53af2 }, { 0xa690af55092b6d11, 0x48cde1ef1c8ad732, 0x7bd71f1e8d2e16cb, 0x32aefa47c57e4f5b }},
+        {{ 0x2505749a817ca87f, 0xb3813d135be015f4, 0x4c2edd416b837302, 0x326e635ba2e7e599 }, { 0xa79adf66730092f6, 0xdedab39f71308f83, 0xe694942369c24bf5, 0x0fd9b00ae4db25d4 }},
+        {{ 0x9656b375b49ac3d7, 0x98b32da3da10a238, 0x2cf653a3ac8cffc5, 0x14c1dfc595c40094 }, { 0xdf582dbb40c66f3a, 0x625ac36a0c4b518e, 0x7d0d4faa357cd6e0, 0x20f911a3b3320624 }},
+        {{ 0xad9045d8d98d1007, 0x2027f7da7dc049f6, 0xbd9b19e1398d8892, 0x3e25fbfc83fee252 }, { 0x2bb000884550d292, 0x6862d61d309b80c1, 0xbf42ac3896f3bdb1, 0x0daf68ce80e7459c }},
+        {{ 0x5d42fe946ff47877, 0xda9cb63c452a0eae, 0x7fe0732dc8d56040, 0x3d74273a5dd570c8 }, { 0xa16361e16b55a9b6, 0xc8e0605fbcf5d9b4, 0x89b6e733e653a346, 0x314cc42d4973d411 }},
+        {{ 0x4b044030f11a4a29, 0x1ebd35d0909feb27, 0xddfea39f434c05d2, 0x0896defbee86eceb }, { 0x750d5b561841688c, 0x0dcc04c3fe782378, 0x3b941b2960422d57, 0x28c9752d9b706290 }},
+        {{ 0xbb96f2997df29b14, 0x30a620b627da9e4b, 0x589da4a49e9f12e1, 0x17c48c2fc71f5dd4 }, { 0x9ab262013e4e8dcc, 0x1a6f53cf0f105895, 0x2ea2cfc12ee6ad31, 0x2c8d4acda435fbfe }},
+        {{ 0x2727a4e0b59c05ce, 0x11bc9a600e9a84e6, 0xd8329aa3a857d1e8, 0x0cb3d861589d5162 }, { 0x31f2ecb15161b1c6, 0x407c7887d9db6062, 0xf9b118108eac6485, 0x0ed7cde19a1217b9 }},
+        {{ 0x7725ec6105f39f1a, 0x65f1f6a99da46f18, 0x2621c0dc95a8ed81, 0x00fcf90dfd1b24c5 }, { 0xab0250e579d15a8d, 0x9d2d03c79fed8b0b, 0xa6ec0ab85dfd8c88, 0x3c135a61e8f11fef }},
+        {{ 0xf2b9d30941ddd7c3, 0xf7294ede6ffa455b, 0x7714a1d0ecd6f941, 0x190070312e75c632 }, { 0x99c8ce7e56fe00e7, 0xa1109b7fb2553034, 0xfe7ec8fa3e5f8394, 0x21d2a2179356ea15 }},
+        {{ 0x940708b435463e6b, 0xac7d192cbc8d0513, 0x418603ab8dc9688c, 0x1d7ddd6e1f5fd2a4 }, { 0x5b3e7884b617d94a, 0x7e4626c133008a9a, 0xcd149433435fb9eb, 0x2f88ecab455f49eb }},
+        {{ 0x151c1570da6b2ebb, 0xac99233b505976d3, 0x2dae3564bf8c29d3, 0x197d7a79799238ef }, { 0xc04b6b52f48c7e22, 0xfcb9bf52bcfe224d, 0x498194d0a4f93d46, 0x296d25fda882d9ae }},
+        {{ 0x199595f15dc1d607, 0x37d1c37f634f894d, 0x0b2666f4a8663d71, 0x38da9936211b496c }, { 0x3cc58ef3e14d3119, 0xb2fae9263a6e7a80, 0x2ea50d3cd6acb4f8, 0x21efdffbe5180371 }},
+        {{ 0x18f56a30c8a35dde, 0x1a6c6652289fd90c, 0xcd1d0da76a8103c5, 0x201c7805e35f6c97 }, { 0x9fbe8b18b4e5b346, 0xa84c82a0a6ddd57d, 0x33b496d10ee09609, 0x2c00b9365d7cb1a1 }},
+        {{ 0xd39fbde04f15b8cc, 0x0074c0c5b1d7da9b, 0xae6ebb30adc96fe9, 0x078ff0946142a451 }, { 0x0a48dd7ff8311aca, 0x34b233a6c36d457e, 0xa242207d26d5d0e5, 0x2e7a2cb0ba1db9b2 }},
+        {{ 0xc8bffa19de6c4a3b, 0x547bff4534814859, 0x84ac159f9ae1c547, 0x398d915ad85ebca6 }, { 0x1ae14ad87b8bb064, 0xd944ff62bd09191d, 0x78e64ab677906f5c, 0x380631533546cd37 }},
+        {{ 0xd83742c523832888, 0x39b6ea15e1aa68f3, 0x60efa893fb560c08, 0x08f6551f30d46a72 }, { 0x61c69fc8763148de, 0xb6ca23d37613b2e8, 0x7610d5493ef8cef2, 0x2aa287ae2d262b69 }},
+        {{ 0xd409882fa7de034d, 0xa812d00e6e76d6d9, 0x8fc27eef67e4367e, 0x0b6dbf3a090b5b32 }, { 0xa1578a733d8a5386, 0x4af3b313194132d1, 0xa126bd120c6007de, 0x30881d6f8ca33ecf }},
+        {{ 0xd7e98aac5cb3593e, 0x3190722bd02baf80, 0x2c26f6971ce88689, 0x3f32ce3123045c98 }, { 0x5c6e074e0db9e00c, 0xc4d63ece179528b2, 0xf71d2b875d48189b, 0x19e64d25dbb7c405 }},
+        {{ 0xebb876918ab92d05, 0x4d7587e690a2a14e, 0xcec905389f64597c, 0x25efd0f7e577cfdb }, { 0x205f60df3fd85746, 0x970b6b3f21c30eb8, 0x4e452a3f785cf53e, 0x3576a12890e787b1 }},
+        {{ 0xc6acd18c0e4d00e4, 0x9e6c28447ccf0f3f, 0xc8ffea8518537bc4, 0x032b070f63adcce9 }, { 0xf9020eb36352e124, 0xe60495f120e4464f, 0x59da0d1d6ad3c686, 0x2cec92e5f7ccc5ea }},
+        {{ 0x56f0b363ac3a2da8, 0x9a3ea19add3acad8, 0xe1bcc097da41751e, 0x2723f87e205ff030 }, { 0xab73ff178a936e0f, 0xf8c47cc3096feef1, 0x345d2b06e083b43b, 0x269929f162367709 }},
+        {{ 0xb97e486b7fee8428, 0x1ca7815c3da2772d, 0xb82e2bbbc92167eb, 0x0a84971b60799c2a }, { 0x7086b307a69683ed, 0xe849ad3d2d3277da, 0x83a3448ce6ecc0d4, 0x3297d7a29ec64d56 }},
+        {{ 0xc1d865aae061863d, 0x57593490b56db82f, 0x214b8f3947ee7878, 0x2710723ea207ada4 }, { 0x6a9cd3c3917122dd, 0xd187c3e504448dd5, 0x0d2d0302e44bb593, 0x32d54c2a6a440cdc }},
+        {{ 0x04ba7d7d5c18ff56, 0xafdc52b997616959, 0xf36d024822b63379, 0x1f08d7c8d471ec69 }, { 0xd3eafe464654acc3, 0x4aecadfa7d57c4d2, 0xf251e5929b73e4b1, 0x2bd69994fc754fdc }},
+        {{ 0x74ee5889e9af3606, 0x11a3202666792dc7, 0xf2318b0667550168, 0x2c65c760e25cf016 }, { 0x03a51f9ba61de4f5, 0x37558307b49f4eb8, 0xee93ea9a22d632f7, 0x2dd2793a4531ff21 }},
+        {{ 0x39741361fab2ac92, 0x6a2133b536316c59, 0x99bf3e1594dcd1f2, 0x2d72df0071ec930e }, { 0x7603473234c6667b, 0xad234e9b88a12dfd, 0x62150b4eb3b8e8e8, 0x23990190285a02a1 }},
+        {{ 0x07b93c17882bfed5, 0xa29c0769771eb0cd, 0xc3e4afc66b7b5c93, 0x0fb10dd9f715e46c }, { 0x6d88ec7f5687f52f, 0x2b6124b6635c00e9, 0x5f903ee9f4f3ff47, 0x23edb4bfbdc031f2 }},
+        {{ 0x2a68e1e4c72d283e, 0x0e1174502af2624c, 0x114c3b6405ebce9c, 0x185830a19f077b74 }, { 0xb19ed0276c1e0e64, 0x44bc58f0ebdfb4a7, 0x3fdd74f950e98768, 0x2a9af3a09dbb0477 }},
+        {{ 0x613571fadf66f66b, 0x76cd34f464702bc6, 0xfdad8813449211cd, 0x03d24eff280eb3b2 }, { 0xdc090a1f7dd5ad5a, 0xd63c1e5202c6a0dd, 0xb68a3fc32f2aced0, 0x19ad62b95ff1bb33 }},
+        {{ 0xa7a5d752f07113ee, 0x916e0894d701a696, 0x799b2d10dfa38c13, 0x2d7e4565fcc01489 }, { 0xb5dfe30191a0ff7a, 0x83450b16a794a6c1, 0xcf79f4a44d142488, 0x2b511be3ee19c0ae }},
+        {{ 0x06d152c75e120236, 0x51384127a939a05d, 0xe239345d6290a143, 0x22590ed7f6098d9b }, { 0x7533d76f48c8bbfa, 0x0f081dd568202697, 0x26a7c059e1fdb3bf, 0x0d748e7274ba2157 }},
+        {{ 0xa085a15b3e8393ba, 0xf14f34203bbe9e3b, 0x77f8ec964788cd94, 0x11e8facfaa394dd1 }, { 0x01bc2ad7199e3871, 0xbde7f1178a73170c, 0xa76e7bf4c0b24f15, 0x394eeaf2e4c4d01e }},
+        {{ 0x49ac5c4e92f70ff7, 0x259d9c5a4d1b903b, 0xcd1f0d58fb48b768, 0x254ce9eb962319f2 }, { 0x21356f6a4ed28949, 0x211371dd5069b0f1, 0x8b2dfb67ef26cccb, 0x01ac7c23ded5b72a }},
+        {{ 0xbbe2b5b49dc3cd47, 0xdabade0c35341b62, 0xc7ff166fb4a79103, 0x1a07dcd56feb66d6 }, { 0x71eecc83b19f5880, 0x4ca837c3ddc09129, 0xd006f08af4f7520e, 0x1e2599425689b8e4 }},
+        {{ 0xcb13ad142a0ba4fb, 0xf651d7ee8ccd9cb5, 0xef9eec03c70a6d03, 0x38c86e6561695241 }, { 0xf88d227c818271b5, 0x0e1c5ff2b29730b7, 0x8d2c17ad06a983a4, 0x1ffe6c4238036b45 }},
+        {{ 0x83294596b8b9d706, 0x5f0ff2ff0cccc0f6, 0x75f8173a91bc305b, 0x0f01b44ff74a87f7 }, { 0xcc9b9729c8c75342, 0x86d66eb41a12d169, 0x6edc0cf1d487424c, 0x15ea2dac64d4e4ff }},
+        {{ 0x2dbcbe4edddabc7b, 0x3a6fe2fc23629c63, 0x1e5021aeda213824, 0x23c3e85420e9fb82 }, { 0x0e99727063a49a3c, 0xf5b470ed4eeaabc2, 0x23e5fed5ab74ddac, 0x398a5603c0c567eb }},
+        {{ 0x690ebb5831d42b58, 0x94d0cdba576805a9, 0x35fcb198467a04c1, 0x28e505611cfa1c37 }, { 0x1882e9d63fc572ee, 0x13a3740963abec43, 0xe92d0f0e507728f4, 0x2dea74b18b94c5ac }},
+        {{ 0x130a1ee875310f55, 0x01f1a3722db8d922, 0x4199f43ca21ca2c6, 0x158c6d609ff3fb41 }, { 0x7fa7644640773d84, 0xbc4275ec7ecdcd4e, 0xad3504ec6ebe8ca8, 0x165f53776fdf737b }},
+        {{ 0x9a65be6f31c0f1b9, 0x0915b649e5e4e68a, 0x2d96dff5cfa7e697, 0x318b2a68bb99a20b }, { 0xf88ad360c4f65cf0, 0xc90200d5e50f6688, 0x86c793c31fd13336, 0x014c20dcbdbb37af }},
+        {{ 0xe52e638ac4183e74, 0x3a14ee358acf5760, 0x8d4e60a9bcbbeda7, 0x039fe627984a01e4 }, { 0x52ac2411c7c315b7, 0xf5df0f8673ec8c0d, 0x83449e8bc6fcda86, 0x27cfd55c7d3c55f2 }},
+        {{ 0xd036b664640c9392, 0xe16e18b7c1cbdddb, 0xc91a2c8e7b8c42e5, 0x29cd2dbb048049d3 }, { 0x8df03e35ce89cf0c, 0x62884b9b64eb5348, 0x03fb2d3c50ab4046, 0x13248e56ddb1327f }},
+        {{ 0x92423fbee68155af, 0x8e0089ead11835a3, 0x258d2fa5d5bb9202, 0x1d213f634d5a64bd }, { 0xae90bce3b314a18d, 0xa3e74965eb3ceffa, 0x6eef527dfa668f89, 0x1ed96544d008f964 }},
+        {{ 0x915ba5a47de675e3, 0xe9d916193f6c7e6b, 0x2d1f22d7e94c1b76, 0x3270c02f893c13e7 }, { 0x4cc399063bbd867c, 0xac1b43af21026295, 0x12240f26fee0e152, 0x37a5fa3390e985b3 }},
+        {{ 0xe3b5bbc97743c73c, 0xcec774b8bc3ed1eb, 0xc6542b3a79fa8533, 0x1a5bbacba9384aa8 }, { 0x15708b480ce3a07a, 0xc7619bea138b49c6, 0xae30c39225a28c29, 0x03b2b3361a054f87 }},
+        {{ 0x5c99ccd51b5a385c, 0xcab7d34d65eacbdc, 0x2ae33541d98cb8ee, 0x1c2e7a55addf9438 }, { 0x5e62b1bf9a49f22b, 0x0899840cbd9d73b0, 0xf5833bdfa46054c3, 0x059f19e062bd11fe }},
+        {{ 0x8e7cdc839290aa82, 0x394bf27eb45de1a9, 0xd39a5adcff940e51, 0x1dfa2b04a8911041 }, { 0x26423425a009f7de, 0x13c159d975e83183, 0x32f2375b38e26f95, 0x26e3b50342d3a9a8 }},
+        {{ 0xe9856f9bc04adead, 0x13d9a8d7b1215e3e, 0xf0a71e797100748b, 0x173c9eb2a346c1d2 }, { 0x1081a8f61534ab32, 0xfad3d18390496a57, 0x999b82a3a8092f74, 0x021299f226d643da }},
+        {{ 0xaa8678bdb61de601, 0x3367aa8ac77ddfb5, 0x4548901ca4b7a9f8, 0x121206b9f3570493 }, { 0xc04ed0d33592a6dd, 0xb113db504c049965, 0x135606aefbd0b3fc, 0x03862ad02ee165ae }},
+        {{ 0x2e9f46475c0074e4, 0xa217e9b916e783c1, 0x2881748e77337f84, 0x355900a400a251a7 }, { 0xd37b7f63e6084a1b, 0x3c53bc403b1c8574, 0xc60817fff008592a, 0x0bcfb87fdba33e74 }},
+        {{ 0x6901a41253ceeec0, 0xa68e1b6f56ecaf3f, 0x29f8ae408199ea3e, 0x1c1bc8d98666641f }, { 0x767f37728e5aedc3, 0x61c58fcfa659cf99, 0xb19a075359ae18f3, 0x224c7f2daf7162ff }},
+        {{ 0x8aa45478e1a0ab3b, 0x62df0e1b35515228, 0xf14c301fa18878e2, 0x0fe6167722537e89 }, { 0x5bbdb207124bf5d8, 0xb94279e238e4e012, 0x3ff1b0c01bfcabee, 0x3945085cabf19d18 }},
+        {{ 0x41653d27a1070519, 0xa16af56fbdcace2b, 0xe5806b918e5e9b59, 0x2a9ba6499216d62f }, { 0xf64d2af4503ac238, 0x82d625729c28580c, 0x52c43f50f1e20371, 0x3a2df21d532c4bb3 }},
+        {{ 0xdf863f69436ecb5d, 0x8cdf555310127229, 0x6e455d8b6e03d41e, 0x0369f4f3c1fc85f8 }, { 0x78f88205a921a8ec, 0xbcd6e0d39883d67b, 0x4a5feccb4519a1e9, 0x3e7b1a5588c5268a }},
+        {{ 0x33f4df2542168a4f, 0x388c4edec618a072, 0x784f0affb2990d0b, 0x00ddc587342ae801 }, { 0xb223fa2452d9e936, 0xef310c09322693cd, 0x458e9f4cc145c0b0, 0x3aa903e2c1174b56 }},
+        {{ 0x0b39d51973b39d84, 0x0d5ae0981c4786ca, 0x98fb777bed4d2cda, 0x0e3cc61fb855a1e6 }, { 0x2c46192040ca9fae, 0x78edf7c432eb61af, 0x7bd0d26100b6769f, 0x166912062cbcf99f }},
+        {{ 0xd4a196f873e619ca, 0x3ff8f25cb114dc1e, 0xadd9ded95a40bb5e, 0x249fec4e8c4015c3 }, { 0x0490ccfbb9e753bf, 0x1053dd5ea882e1de, 0x2f04fbd29a979e0b, 0x2d93c2abbfe4a043 }},
+        {{ 0xe320437768386fb1, 0x7c117bc2094bdcf1, 0x60c447f997f44d5d, 0x2e8fdd9979098ca5 }, { 0x295c3692460843cf, 0x6d89b3fb43258c1f, 0x78cb12d5a8bdda78, 0x05777e7cc1bf0efd }},
+        {{ 0x792efe572d64a6db, 0xd0b57e9e90e26ac9, 0x7ec202e7b5dca861, 0x1327643f8002a4f6 }, { 0x05881d01545acfb4, 0x6e3e272bdbafcb64, 0xa4f7a89dbce2557e, 0x2ee459cfd8bde401 }},
+        {{ 0x081babbb2a8c1811, 0xed6f67b2b712aef2, 0xe62379a2235c4135, 0x0cb303c8a79ab30b }, { 0xa8dbdd96fb511ea0, 0x58d45a86b4a72b82, 0x0cf62c4c81a36f65, 0x2da800d921c4deba }},
+        {{ 0xd86710ecaf17f19f, 0x0275aa8b404e0fe6, 0xe7bf999bdf443441, 0x001655cf95fb7aca }, { 0xbd80ca6ec0bf4c4a, 0x9d2982df4383cb3a, 0x01b094dc9c2fefa2, 0x3ce09193c847fc97 }},
+        {{ 0x4886c6ee10415c25, 0x1b868df9196811fe, 0xc0bb54f66efefd87, 0x3d6990cc8cee1c6d }, { 0x6c8c2cf94f3d931c, 0x67ce8286fc62a44d, 0x6a0ab698dac0ba6c, 0x32ecc2964f371f2d }},
+        {{ 0x1599dd520f631334, 0x156854499ea0ce97, 0x0bd29086f6099893, 0x3cabb2e79b892fa2 }, { 0x7af9957ff370108f, 0xc7bd038a7543a34d, 0xa56bc68bdbcc6fc2, 0x1dfca993aa0180b0 }},
+        {{ 0x1864d2766fdd8518, 0x379e06edbcb5ee14, 0x7cd299fb2715910f, 0x00732c105d6016db }, { 0x2a74fa5f7c206fcb, 0xd451fa5a646ec13c, 0xedb3adc071b882db, 0x327e7d1de5175e0d }},
+        {{ 0xa94ebabd2bb2def1, 0x08d1b37896dfc349, 0xcbea9afd75a10f18, 0x0b88bf858699fd0e }, { 0xcb5ba63ddfda990a, 0xfda547779ed55cea, 0xd2940e7a41462323, 0x2570fbd55c16a2e9 }},
+        {{ 0x77498de92f014ef0, 0x93031979e6fc17c2, 0x6ad877f164941aeb, 0x2fb68e42423c413f }, { 0x67fbfb56e5fc21c7, 0x6d45a0c17b9ca1ff, 0x6ffeef9c0fdba0ef, 0x13857770160cd0cc }},
+        {{ 0x538d31c7e0201f8d, 0x73f3c2efc7b2c4e7, 0x45d341b7575775b1, 0x22b7f6d368d05085 }, { 0x1f905d3bc7cc50bc, 0x7f52584194762826, 0x32eae5365ade733d, 0x1890d2471352cf91 }},
+        {{ 0xad8808e080c144ce, 0x6b14d5ce2bd421b2, 0xbaf641f48d823cc6, 0x2f27f082de9e7c0f }, { 0x6c2ffe1596522db4, 0x6c6a461f9f03c1c0, 0xa3562fed79e2a115, 0x0460a0feba54748c }},
+        {{ 0x7c85bcc4adf118a2, 0x11f85be9d46f20fc, 0x9172bd97923dc22e, 0x01e2e31d2959f354 }, { 0xbb623b3326518ed7, 0x32cd50bb27036b36, 0x275149646f56c4ed, 0x0f7f13f398ee307b }},
+        {{ 0x44703374fa13411e, 0xc44b03c2c39d4a31, 0x2a01a2d2d0817906, 0x1524417303a2aa75 }, { 0xcca298c087c6e9fb, 0xd21f7c9d9514fab8, 0x25b790b13b2ead57, 0x1e8b3988de4be9e8 }},
+        {{ 0x0cbfb0ca52352239, 0x7f5bd1382cd0fc83, 0x08fc7190e2d273d9, 0x103c7681ab36d387 }, { 0x4e674e060743cd73, 0xd2d92f6d6642d75a, 0x540724ee83cdd187, 0x2ec7e8e9b0e6a086 }},
+        {{ 0x7fb0dc6b9beaeeef, 0xeda192ae5d616838, 0x009d167a3613447e, 0x39105efa7555d5bb }, { 0x27e348f80154ccff, 0x4ebe1fdb6df2f95b, 0x0a6c0a792ef09761, 0x1f4c3c55834bb2f3 }},
+        {{ 0x56609e1a00d632be, 0xf78a95e63d7e1dfd, 0xe4875382eaa602e1, 0x14feb4575d81338d }, { 0xdb39153c400b6573, 0x126e62ff5f2b0151, 0x7314894493056dce, 0x0ab70e9d80bda186 }},
+        {{ 0x47eb6772119eb343, 0xddf13a3c1e945276, 0xce60c449e1a80869, 0x2e639109a61bea92 }, { 0x9591b8249f780b18, 0x4bac4693ebffe8bf, 0x26c3ccb6088222d9, 0x2b0c7c44c115df18 }},
+        {{ 0x159861a7c5b1df6f, 0x422578eca989fefc, 0x2b961081b0e1cfb4, 0x133f8afc35ffdb80 }, { 0xf0471e8693503f24, 0x4c1feda9169eeb9e, 0x2cc46a428ac61a3c, 0x290de5d22fe53c22 }},
+        {{ 0xeff2e29e98a99de5, 0x4fd0719b696b3574, 0x6bb40ad55c14e5f0, 0x181bb6e5198a6362 }, { 0xe05da472118613f9, 0xd2b345e5ea9c8c07, 0x9fa507d8fe6d4a43, 0x3d893636b79e4c2f }},
+        {{ 0xdc6c857b775b260b, 0xa4a12d95fbf369aa, 0x9f0f236a9188fa92, 0x3110ecc59815e904 }, { 0xaaca2d0dfbef3a33, 0xf4f2a8a9254e619c, 0x4fa53e084b6a6f32, 0x049a655f2e2f1091 }},
+        {{ 0x766f782b1c718457, 0xcd2ef3ebbf04bfe4, 0xbac3ddad3f123200, 0x1ad65ee4c9fc46a1 }, { 0xc4f6419598a44183, 0x366c6dc330f6f431, 0x0ce196ad197612ff, 0x3c90cb0b192300d8 }},
+        {{ 0x01c3dd8b4f6f58fb, 0xa54189b7a5ba821b, 0x8791e6c6d7c315cf, 0x157bc3510af05a94 }, { 0x06d10e9d55f0bd39, 0xcf3a8df497ce67da, 0x92750236676f0926, 0x1db4178a6db69206 }},
+        {{ 0x404c8cdbd87bf6b4, 0x63f2d16133688c35, 0x9cb65ba395fa1bd7, 0x395338c63e81c55a }, { 0x09c6c7113735b711, 0x4dff3b2f7faa5f99, 0x39e424a30dec4701, 0x239cdf7f07a0aadb }},
+        {{ 0x67a5129e02c417a6, 0xdc2239ac9f58ab77, 0xc59017ad1d00de20, 0x19d44322e283475e }, { 0x6e717eff4963cdb3, 0x78fa2ae5302bfd0b, 0x994bc2701961c617, 0x02f78e58e0e90915 }},
+        {{ 0x20a8187c0d9ad9ad, 0x028c544670b298dc, 0xda6fbd9625159b43, 0x3db128b799cd7c61 }, { 0xa2e942225ea6cf73, 0x31d2852f60d645bf, 0xaeef92b140ad8855, 0x26198207c0960ffb }},
+        {{ 0x2654b2103af058fc, 0xbff418d0d0931d3e, 0x16278e851a6ec078, 0x325ff6d589d7ef05 }, { 0xb7817981f5191312, 0x873cc57b90106089, 0x8b4743385cf8cd13, 0x17ac336593b37f7a }},
+        {{ 0xf721128782d21523, 0x346cc8676787dd08, 0x95843f7d23831fcc, 0x075d7c6d58fe4ba4 }, { 0x3f3ab472e7226f4d, 0x6759b1f57f6b3b6b, 0xc6a012dc4d68be0e, 0x22f2c16d6495aa54 }},
+        {{ 0x3c6e3104b50af797, 0x58c42d4844ecb1f4, 0xf4d44bd48c388c48, 0x11a0970e8cab02aa }, { 0x13f448da1aa620b1, 0xdb2460fc7c2467fd, 0x4ca15a01a94a6f09, 0x26368c8f4db0fa9e }},
+        {{ 0xb4e39b24fefa17b9, 0xc2a582841a6fe967, 0xaa53b1462afeaea3, 0x16e02bd9ac201bf7 }, { 0xa9a1ea5f2ed4196d, 0x888081819fc01b5d, 0x55d228b06f92dd03, 0x0f004464ac92ded1 }},
+        {{ 0x506758fd4184aabc, 0x03d6553722853944, 0x2065e0f793e92353, 0x09ba434cee46a47a }, { 0xb5ad15a75dfaef8d, 0x332fe0f0f7932c45, 0x3a15962fdaf835de, 0x38be76e07cd9612f }},
+        {{ 0xa3900ece13908873, 0x65fb1ddebff670fe, 0x49e7649732bbe8f7, 0x0f764efcc99427f1 }, { 0x1f010b506264dfe0, 0xa1c624f7db85c82a, 0xac81ec115ae2ac36, 0x04afdf5a3f9910e4 }},
+        {{ 0x64ed707aa8839b3d, 0x545d59ad6f59b48b, 0x795dc532ee34b867, 0x188c4e02c2b105dd }, { 0x0d7d768062bd0319, 0x076d17c5ae7d6720, 0x9f042a5badcc8f8f, 0x15ebdf1836874fb8 }},
+        {{ 0x0c9d08176f635aa3, 0xbcf12703b3e28f63, 0xa9295defad7dc73d, 0x09c4dde286a0c954 }, { 0x3db94f72aea240ff, 0x115c34fbea98ccd1, 0x52e57ca677910229, 0x15afbfca35eae4bf }},
+        {{ 0xfcb0b74ebea2236d, 0x409eb0dc2ff8092c, 0xba00924f0bba1429, 0x3992571c58add558 }, { 0xc4e97198174db0f8, 0x4476e9e143457e20, 0x09388119e8d20bc6, 0x3ebe382c04c53142 }},
+        {{ 0x650f7dd6e9929dbf, 0x04a21d89d24f2911, 0x8c670368c15fc9da, 0x2139ec0a0f1d3549 }, { 0x9a9dfcfa07fe830b, 0x9d4c06fb64f8c315, 0x5d288ce2976667ed, 0x2b7c351b3da506e7 }},
+        {{ 0x8080d0be832895cd, 0x5aeaaa14d4b1f1c5, 0xa9560d4e4645bca7, 0x00cfe3e6980a431c }, { 0xf2de9a227bc6eddd, 0x19d2dfab80e79890, 0x1db1d87d0068bf46, 0x1e57f9d6d158889f }},
+        {{ 0xa23222aadbe27de0, 0xbad4cffd2847ac38, 0xb20f2cf9a827c39c, 0x1b1b1fff8ed017f7 }, { 0x36a449f9db12c259, 0x5d89dcfcfd4711d7, 0x964b8d58ddc73891, 0x2a93a3cf2615ac70 }},
+        {{ 0x3722d48dbf52492b, 0x73990bcb154076c3, 0x70409cb3b2e0d591, 0x2c4965a346d6377b }, { 0xc790bd8ad91408e3, 0xb1a7671821320ec5, 0x3650c41bceac9b0e, 0x2180784a5db9192a }},
+    },
+    {
+        {{ 0x913e83bba2f80afe, 0x0a309bd7c5887ff1, 0xc2d2d56fefd10b9a, 0x0e87ede5e0d567b8 }, { 0xed209a5ea4595cad, 0x81ca07a994d86db8, 0x8372647c6686a573, 0x13b2c3a341ae512b }},
+        {{ 0xe5844bd7e4590ecf, 0x25901a3e90966ee1, 0xee3b7db9cb46fb1b, 0x0c95c41f821399b2 }, { 0x6ca6066d4bc46a4f, 0x1b8764e2c5cc45ed, 0xb3165e744257dee9, 0x0c64c69ba35a5434 }},
+        {{ 0x15892eb9523f2623, 0x463f8fc7629a1756, 0x7a87f1c39913acbf, 0x298818dd17ae3069 }, { 0xe0456bd5c6b772ae, 0x8d4ccb2b7611947b, 0x6e5dcc8165926958, 0x1996f24a3d415ed0 }},
+        {{ 0x19dc38277bcd4b5b, 0xa2b540a634ff66a3, 0x485fffe05269fc82, 0x16cd9bf0635e06e3 }, { 0x382b60c89a3abbec, 0x952bde234e826965, 0x438e57a28ec58f6c, 0x0066dd3d9e44496a }},
+        {{ 0xfa2ccdcf94bb6629, 0x8185ae387e407f39, 0x895866b54fa5c4e4, 0x08db1aa2a8d034c9 }, { 0x4014789a10fea637, 0x34023b11425a76ad, 0x6bb7a15a339605a6, 0x0721d83129aced57 }},
+        {{ 0xe087c6c3e05d925d, 0xe33f79f54ac62057, 0xc15ca81d606986f7, 0x0cd9a3010ee28361 }, { 0x281f1939a83be049, 0xa5139e4204e9ff92, 0xce3afd6c8fb66b87, 0x0f4826f3b29b1cad }},
+        {{ 0x9c87dadc9b84f7c3, 0x08a38302a50352e1, 0x9bcea09e94102697, 0x3d4bb60c22370915 }, { 0x451e6bdf35bf2898, 0xf548a5853e6a2351, 0x4b8a0e325e76ec58, 0x224c99e3f6ddd30f }},
+        {{ 0x89c52056dd81d32c, 0xe4a2e88a15bcff4a, 0xbe7aba2121d2e5aa, 0x14eca0597418bb41 }, { 0x49541e776fee32b7, 0x50230ce2781bb040, 0xea35c0cb6dcf84ce, 0x1befcf8464e561e4 }},
+        {{ 0x7f244926b0dc5060, 0x7ba32e12d5f78a19, 0xe7eaaf485d4526e4, 0x234e52bf9907274f }, { 0x1aeffa243527f366, 0x12edc3635e92074e, 0xd452fb5e15c8d3c6, 0x3df061401cc32602 }},
+        {{ 0x8900f4954d5074de, 0xfd887334b4c16592, 0x1df8370bfb16fd10, 0x215a7e81275652ba }, { 0x94aa4dd5b95d2c89, 0xfb0d0b50c580c946, 0x696d2c2f58d84548, 0x2b3a8536dbd77a3a }},
+        {{ 0x8ca988e207a0a1f2, 0x5efbeda69cb6870a, 0xf64548395661ae93, 0x17dafa8956856c8b }, { 0x3fea35ad292570ab, 0x3b134d419312f225, 0xf68036ccae45260d, 0x3ba7e946445691ed }},
+        {{ 0xbca097f22467260e, 0x81e00484c7958df4, 0xda85fd74e6b5f36e, 0x2d3e568a3bfd9e17 }, { 0x769a0eb556cf5525, 0xe2151c189476cfa6, 0x437d65c132710ad6, 0x33d65261b831eb63 }},
+        {{ 0x4c4e51e4fb5e9102, 0xaaf3b4ab5ba26602, 0x22004fecaf86526e, 0x2b2430fd7811287d }, { 0xafc58ba16ffe57a3, 0xbb19e1ecf47eba0c, 0xb8a22e85cbe489eb, 0x129175dde34c21fe }},
+        {{ 0x61c2be63e67fdd17, 0x22554c883ad9f141, 0x7f5bfc24708f8ab6, 0x114dba0c10b8d367 }, { 0x0c7cfd11b2a1d913, 0x0d59f6aad26a07c2, 0x3c3d49e8756b6751, 0x20c2ca1ee4892bc1 }},
+        {{ 0x20d00486ade5aed1, 0x22bd23f40773137b, 0x5e9ea0e693838d00, 0x31ec8e1126bac268 }, { 0x57af43742bd74b1a, 0xf4a23a842d632618, 0x95eb947b4767a905, 0x2c677d18a837b27f }},
+        {{ 0xa882b69813066976, 0x0eed2f464d165451, 0x75c1da05e0adec3b, 0x25dc51ff5b3e9272 }, { 0x3c3cbdc8f1e1d8e4, 0xd8621c580fb2d335, 0xc29a64cec692d0e7, 0x2ca89549dd6c6756 }},
+        {{ 0xe2244ad4b8abf034, 0x1fa6ef877353f8fb, 0x1eb717e06e3635a2, 0x35a3849283800442 }, { 0x852c701c18fc1777, 0xd2fe3be8c6bbc3fd, 0x790fe1eee6369310, 0x09a881191d132ce0 }},
+        {{ 0xf4259cd1023b7da7, 0xfd16e60363a1859f, 0x28339546770399bb, 0x168de10b1d101077 }, { 0xb0cf47e09a6ad680, 0xbc501ee02e57201f, 0x575f2bb73bcc1168, 0x3268745cff2f9cbe }},
+        {{ 0x0ce0ad031fd753ee, 0xf2f375ba1a8be8de, 0xec96fc71f581ab63, 0x366d299df089fe4b }, { 0x749640966e824430, 0xb58983b75ed68e1d, 0x3e12d1ac36c7a7f6, 0x34639457f39c9a55 }},
+        {{ 0x28d9e43ddfb25a59, 0xdd10ef3f9db2d834, 0x565346742fce3355, 0x17921398098037a8 }, { 0xe692bd3d15502e2d, 0xf886a516a8283961, 0xadaab7f50129c54c, 0x03fde55fe09bb6a3 }},
+        {{ 0x9f0bc99ede4cfb18, 0x98429f2d823978b5, 0x25583d7eda16b83f, 0x0f2e5c9b90fa1338 }, { 0x178fbecd3255838b, 0x16c020672e40976f, 0x2cf21852cc7a2011, 0x25ade806c3594022 }},
+        {{ 0x7348b8e8c93f85c0, 0x8a13b6e9e813ec36, 0xd2b547e4199be8ca, 0x2d5f3d76c5de1f3b }, { 0x99eafc21c354d3a4, 0x52d73c5c366f8d63, 0xa64e8770bf3143b5, 0x16d53695aa24c463 }},
+        {{ 0x7472361e578add2d, 0x6ecbca63f6ac140e, 0xd98e3a3f64961294, 0x02a990ed62f3e103 }, { 0x04f61fbd049813bb, 0x6e45843116e4f4f7, 0x726590d22337e2a7, 0x00f3eb252513afed }},
+        {{ 0x5e5e4205430ca055, 0x926ccc9b31626d56, 0x608946efb3639b69, 0x22594212ab0c538e }, { 0x43a6209d1734a682, 0x71fa0827b6e568cb, 0xd6228e984bafa4c4, 0x27bacd55e16181e6 }},
+        {{ 0x17be7365215895d1, 0xf714dca03e2fb493, 0x183103a43caa8af5, 0x108bf41a0adbf10c }, { 0xeeaf5c5b803683c1, 0x36bb15dceeb154a5, 0x3b964c06f56fde61, 0x17d63eb5332e49ac }},
+        {{ 0xe42116c9e775ccba, 0xd461a862124b43e7, 0x4e5b6acf4fd22154, 0x3773f83db77a83a4 }, { 0x147608d743448517, 0xaf1c01a18434554b, 0x2af28ce8d437786d, 0x20a763e213014682 }},
+        {{ 0xdeb7204863063c60, 0x6351beb68bf8fd6b, 0x31db98842502ab48, 0x13a186a14b978c72 }, { 0xcdf3fedf14c332a3, 0x0564e1cafac4af3b, 0xd35aea65279e0d3c, 0x29ccb96ded5117f8 }},
+        {{ 0xcfefdfe51c636fc0, 0x104d465708c79054, 0x5047437329283171, 0x345e147025d6e0a9 }, { 0x7462a0ec0093ebe9, 0x7db6b53a2c48d79d, 0x7f0b8034a7e66979, 0x3641fd678346f2e6 }},
+        {{ 0x7a850046ed65b5f4, 0xe0a27ad356cf3030, 0x8a39af222823fc52, 0x230fd6e211f7ebb7 }, { 0xdda570f89b10a0b6, 0xe6a7139a8d5fc5a7, 0xec51c7746ab8b73d, 0x035ad261754d6e69 }},
+        {{ 0xd1cf3e8d1edb9c41, 0x549501f7aef7303c, 0x216a3692903c15ce, 0x09725d3340ecf929 }, { 0xa7f961fce51c6f0f, 0x65db84a65619245f, 0x3f686fa50e719bf7, 0x02fe4e123fbd8867 }},
+        {{ 0x182f08ce908cf97a, 0xc19cc5a7f44c4321, 0x338a49419558eb21, 0x1b59a4edbef67c16 }, { 0x936db7d737aca691, 0x11d23e1fa03f266b, 0x10ab2b7f21e0045c, 0x1ba6c8d425a601e3 }},
+        {{ 0x618eb7771ae451f6, 0x34b0128441ab4294, 0x0fed8e7bef6a56cf, 0x3d7d362468b0884c }, { 0x42d8797fbe77a0ce, 0xd3ebe6a4cb8e3818, 0xe10ec19f7622f735, 0x0097572a2cc5a856 }},
+        {{ 0x6f8050bdfd8419e8, 0x8c7b209c6e5cac0d, 0x507c558c7be64547, 0x214e44f439460c13 }, { 0xaf24e769fdcd5501, 0x879364163e67b516, 0xa85c01a5edf4fe68, 0x248cad9c25c6bed3 }},
+        {{ 0xbb13b2676848570a, 0x6ff8c787b103f4f7, 0x4f47fdf0411e1204, 0x1884774d51afb22c }, { 0x21e0811a6e08a971, 0x87e4ffb2f531e4e9, 0x4c91af85809b6e64, 0x2c2062d4b8c411b0 }},
+        {{ 0x9c86a2789c874e5f, 0x12709355f85976fd, 0xdeb0c76da3623f09, 0x2e03be5728591880 }, { 0xc59aafb9dcd94c4e, 0xedc07cc5b60508a1, 0x734d57442e728556, 0x1565ddff3c3c455a }},
+        {{ 0x9960c7c7fc88f6f9, 0xdb9af02bc23d426b, 0xde0a3b7d6e32632f, 0x297eeace42f05457 }, { 0x7abc5a4a61a23612, 0xa0b77138ef905738, 0x2c66ac1c4afdf0e1, 0x1332956ec507ed29 }},
+        {{ 0xbe398241e46edf58, 0x6779d19d48bae71d, 0x257c5e26abe21034, 0x15ac376448bbf597 }, { 0x4997018fdb410ea4, 0x4ca4c29154a36f75, 0x09ebe14d7bc3aa1d, 0x25b0ab8a8127d3fc }},
+        {{ 0xb55d2d4a3660bd34, 0x66475b192fc81a76, 0xbddf646d16ca8590, 0x3e8fba519be82c4a }, { 0xf224331e15024fa3, 0x53d7326a59c86592, 0x7042540bbf47b155, 0x0050fe4084f74af7 }},
+        {{ 0xb6dc46795811d891, 0x126a6c7c6d2a799a, 0x4562d1b8cac88f51, 0x0a48114da11a2806 }, { 0xf9aec6a406932710, 0xa39332fe16cb7145, 0x619a018da2e73fd0, 0x0dbe0b1e1bd75764 }},
+        {{ 0x988de4ff015d72f5, 0x6194c28d27fc6886, 0x0efcf3bc6ba787bd, 0x3d570196982cb69f }, { 0x696ea5c218272510, 0x5b0dc0e0a0bce885, 0x2e1912e6cab850bb, 0x02bf2f222b4addb1 }},
+        {{ 0xa5401af81e1d3895, 0x1fedb9cd89855b80, 0xd132ebf181391784, 0x0f4d06e381ee4a21 }, { 0xe48c5ed5d66bbbe2, 0xd779a3ab08b15903, 0x5445905b166c0132, 0x345a5955978f7ed1 }},
+        {{ 0x746cf82f58c913cf, 0xb8f948098d2b6a50, 0x1f37be3c69ee6468, 0x2a10724a5380021a }, { 0x1021221101e94fdd, 0x24bc4497d08ad603, 0xf1df13f882145cfe, 0x3c806efc22063402 }},
+        {{ 0x1ae9e536dae31b71, 0xe6f2379172b7a686, 0x54c040314f0dc764, 0x1c88444dce96ed81 }, { 0x0f8a22548060244b, 0x28a138eebcfc46a4, 0xa7225ad1c36ff8b2, 0x0f3aea6774e6fc9e }},
+        {{ 0x23bebf15492ffa0d, 0xc5374888a6a626a7, 0x1e9eeda2695cc136, 0x148d3289c540b2b4 }, { 0x29431cee184c8620, 0x2db1cd09e469faa2, 0xa3b7aea9afb2f51d, 0x14ae84afcdf62638 }},
+        {{ 0x91d3cd1415cf13f5, 0xcc4dccb7ccfd61b3, 0xcbdd3ace37cb27e4, 0x334a8d4521731140 }, { 0xc034ba571c1f96ed, 0x401bc07ee777dadd, 0x9abb7279be46480a, 0x3a17aec6bd971f2b }},
+        {{ 0xc0ad542301d4fb87, 0xfa392a5bdea8ce71, 0x778c2ae04c9fe099, 0x0d2e8ef6e0c52537 }, { 0x9d0f4047874bf202, 0xa71f2ebf1b457e44, 0x314d60a1e0a82d42, 0x1b417f9034dd69ca }},
+        {{ 0x2af5ac95b254a5fb, 0x1d8e16aac224fd6a, 0x37ab4068637b8eac, 0x2f4e711d6feaceaf }, { 0x7a7fc30741c5a67c, 0x8459c37466c4e385, 0xf98775c2d23e01e1, 0x1ae8f9b88138e036 }},
+        {{ 0x5fa50cf961fc133b, 0xb552c061203dfbcb, 0x904baf5d315d0948, 0x09df2c60f5d63124 }, { 0x052a4883128890cf, 0x3f3a5dce5b068dc3, 0x998b8355b35a85d6, 0x3b22cf7464f72f86 }},
+        {{ 0xb7ecd7fb7c99a4cc, 0x77fdb2b27d05a7bf, 0xf627e35c532a85ad, 0x37bf40c465807637 }, { 0x0489822f01bcb25b, 0x8221e9d010e640db, 0x9f02be402160e7e4, 0x39970f635b15f78a }},
+        {{ 0x6dc87e0aa9b5892c, 0x0a39b8c9df5c1980, 0x3648421a6adcea93, 0x2dedc21bb76f8abe }, { 0x16e7c0ee89012aa7, 0x961f516546089a7d, 0x0a9ce05ac5810774, 0x37c995375b642a05 }},
+        {{ 0x7eaf871a5672d87c, 0xd07d57452f169c36, 0xb244123861f15ec1, 0x02ee989d7bb58156 }, { 0x8f86f509ce155b2d, 0x6f69e1270e30a7ef, 0x8c191f01bc467ed5, 0x10525d9e81fc591b }},
+        {{ 0x6a1e287ad6e93307, 0x8de3a1d25a9b823c, 0xdcea59e884d2bd2f, 0x2ce3ade45677f91f }, { 0xa58a50dde6afb7f6, 0xc6e554c5460ee38d, 0xa8ec5fef6855f90a, 0x1c0c181eeac1d116 }},
+        {{ 0x9ae1661e9609c39e, 0x352a7ad5ebfb24f6, 0x7583283a2ea79484, 0x0e87e979ec6434de }, { 0x6d454e7ec1557a27, 0x5b895dad9d495b2e, 0xbf7e87be8438944c, 0x28216549efd105b1 }},
+        {{ 0x0a2a2544881e2be1, 0xd7e1465c9d66075d, 0x086b7bcc9452a2ed, 0x18e62bd25a651c7f }, { 0x5fcc9c194ad63867, 0xf71da9ca2bc8c143, 0x0af79d7fff8dabe1, 0x27873bf5023ebb3b }},
+        {{ 0x8107ed94c0e29a95, 0xd8ec35d5a5c3ea27, 0xb2dc3e2ff46177e1, 0x23fd023b1b0dacd3 }, { 0xef7050c44d3f3b50, 0x5ac6aa1f574af68a, 0xcf8f4db53f6a990e, 0x2be46aa9f0a67455 }},
+        {{ 0x57dafdba1a8b202e, 0x0a25835a6d622ed9, 0x02fef865f8c783d9, 0x2bdc4ad4456c9ecd }, { 0x3e46f388852d62de, 0x58e3f343d3c75de6, 0x415836967b5b9067, 0x1015038a2809db0b }},
+        {{ 0xf782dc7b528e005c, 0x5cde6c56538cf1f7, 0xfc10fd74c1d573b1, 0x26dc45f57bb09d83 }, { 0x345f7ac8fbb3c002, 0x87b13ee964fa109e, 0x80a10a23dede5277, 0x060111cb5627da15 }},
+        {{ 0x89c06226a81bfa29, 0x7d49ec45c40c3cf5, 0x883df0f3f69aa3d9, 0x2cdaaf8187713a33 }, { 0x8b2450e505bd6e2f, 0x65b95ac8d388c3fe, 0x4187cb9adc9e0bd0, 0x1dbe6c9ea00b7c34 }},
+        {{ 0x156cadd5a0fc0d6a, 0xe01bbed56e44c3b8, 0xe9509065f965293a, 0x2cadcf3ccb45c029 }, { 0xfb774c9aeeacd0ba, 0xfb5ff2e5f1b415f0, 0x5cb5e49bed8e2a41, 0x1c4b4e785b96c1c0 }},
+        {{ 0xc263d01b7c385c21, 0x138e4f14f0f3a686, 0x5538d76f0598814c, 0x272f4594de5c4f66 }, { 0x1b9e5bbe0c86a596, 0x8c16434885c92ec5, 0xc16fc7197de22628, 0x3720b61ace0b9ae4 }},
+        {{ 0xe473a46df1b28534, 0xd6c1289d4e5c3ea7, 0xdc5a6f5d56415682, 0x3c3b9acdcb4a42ca }, { 0xfe086799ada3fffe, 0x5892bf22c2867f41, 0xa3bac7af6ce5468e, 0x3888c54f8e63abe5 }},
+        {{ 0x5d88afcfd82ab0f2, 0x8ddc2a23d637fb68, 0xb78182706be56076, 0x1d12fecd35dc0da5 }, { 0x39a4fbe97b0f9daa, 0xfed1f039e3a51f3f, 0xceb7b26e4517fee3, 0x39224a97b1c34059 }},
+        {{ 0x6bb55217c086721b, 0xa0c996014c1197c8, 0x8c99e3ca25ab405c, 0x2870a99fb597c126 }, { 0x7ee23261dff86feb, 0x0505e65653c4803b, 0xa8c333460ca8855c, 0x34e137ec9028f0e1 }},
+        {{ 0x3204fdd779ad0854, 0xfe97be267ed6e525, 0x7977183fa07643de, 0x3732d263a3b24e25 }, { 0x237b86f5e9548190, 0xd79110d71efbc77f, 0xe8d602bfc22a79be, 0x0dc54f893aa02d5b }},
+        {{ 0xae0c8397b5cf5d04, 0x6622ff962db7772e, 0x4c999b53e190d11f, 0x3b2db5062e8e009b }, { 0x3184b4d9e38aaed3, 0x2e198ef2278e4e52, 0x26845f5636f13222, 0x2d1e8a02cfdcfb22 }},
+        {{ 0x2e9c29748c82f685, 0xe28b92f0f0b531a3, 0x494da8661c23a9c4, 0x098ddc6358d688c6 }, { 0xaa3d568d37d99167, 0xc55367704f26fee0, 0x6eaf483ca4cf634d, 0x316fbd49f06aaa77 }},
+        {{ 0x6d8f384ca32592b7, 0xcbe3434d4bb7d5db, 0xb7e36363d858ee1f, 0x0a6d4fde6b8c393d }, { 0x971ca7c72836f14c, 0xa4747ca9da0845ba, 0x2dcc5aa511c91575, 0x1446e792b2cf5f6c }},
+        {{ 0x2258e76b0d216b6e, 0xb8bb944fae85512b, 0x58c38d13628773ac, 0x13f33e699876688c }, { 0x0d153d16acffa5f2, 0x360b9b2044ca3695, 0xf1a6755c71b94b01, 0x2565088e34f4947f }},
+        {{ 0x44b0fdacd9f3eeab, 0xec0288be9fe6e4c7, 0xca0c81549de7b0fa, 0x3c400a9de3cb5b95 }, { 0x12e050b53e8663ab, 0x947b8b3a6747ef3b, 0x5ecf68500f8e67a3, 0x35f75905f17e1e46 }},
+        {{ 0xeb708d2d5548b5dd, 0x40792b3a89278559, 0x943dd4743d793738, 0x3dc0ee323637c62a }, { 0xd379aa06c5c70257, 0xac364ee580817632, 0xf1a0b9c0ef5cf50d, 0x359708ab495339d8 }},
+        {{ 0xd1c49ea310fde805, 0xd134da041e8b552c, 0xf76fed197f888972, 0x23f04a6b6323f9a1 }, { 0x505bc1fdc3b91937, 0x84be63c45daa9d2c, 0xbd2a931a08c7b8a2, 0x1cea3675bed33b35 }},
+        {{ 0x367264904670f70d, 0x8c7a565afaff709d, 0x590b5737794fbb63, 0x10f29df3404cbe7a }, { 0x44c54d795ba7deb1, 0xa5faca71c7f59caa, 0xcef3f841afeb91d7, 0x29d753d614eed7b1 }},
+        {{ 0xab74695025bd591f, 0xfb625e80d715004c, 0xbedff8ce146ade21, 0x0cffd11e3c725019 }, { 0x6e6b910293f640fb, 0xaaabae0849d66309, 0xec8274a696f40ba3, 0x2ace78b599be8a4c }},
+        {{ 0x9a073e9a5378bd75, 0x91497cd1f5e58f6b, 0xbd2ac61b2bbe356e, 0x3785ffc5e6067f0a }, { 0xecbe7f4d0fe85edb, 0x9543ba73665cdd8e, 0xdd1e6877153ff667, 0x2888603fb297fb15 }},
+        {{ 0x040a2db099342462, 0xc691b9c0816fcb16, 0x324226ca41f965d6, 0x2d15e4f0362f3be3 }, { 0x655aa5bbda3f1e08, 0xc1c662ea2037a6eb, 0x6cd5cb15bfc062fc, 0x13245f131481f883 }},
+        {{ 0xbcbd6c74d7d6778b, 0x9a8c1c944b8206e7, 0x61502d0118e7d01a, 0x365f15bf83607d7b }, { 0xa1ed34ed29799105, 0x18402e4d1c67d77a, 0xaeec72ffe6a1bb3b, 0x1d6efbccee55366b }},
+        {{ 0xc4fc4eb627ee85dc, 0xd152bd845d514b40, 0x9452041f42edca73, 0x37e6110db05be959 }, { 0x56a8bcdf8658bf45, 0x2053de02ca7ed907, 0x1c9c34949634ce79, 0x2a99e34e18dc85c8 }},
+        {{ 0x29ba584e62976eb1, 0x51e7ac8dc2e48869, 0xf950f50c28d857c5, 0x0ec0438d9a211f71 }, { 0x6cfa899e7b83918a, 0x37556d68f4d0105f, 0x63c8ca399be1e822, 0x06eac62f405b99e8 }},
+        {{ 0x47ea4206ba8044d3, 0xf675a070f9dc7eb0, 0x4b62916970f8e94a, 0x34e4659041494ce8 }, { 0xac92eb36da8c9eb3, 0xfc485ed0714e6a8d, 0xff213c2adff81de3, 0x06a2360905a33d4e }},
+        {{ 0x8133584047fd01e9, 0x17839f408d155b75, 0x038114abd5db2942, 0x2a8b4838e8156ba3 }, { 0xb5b0a1b20d98a564, 0x82d21ca164f347e2, 0x2a3733917a671748, 0x1b2b3034beab759a }},
+        {{ 0x9872d840b038a5dd, 0x565002c933d9416d, 0x442279b145a9c79e, 0x3479a00fec85672a }, { 0xaea567f23d41865d, 0x52a6e5fdbf6693ce, 0x5002e784f826b989, 0x0414cdd80d8ab529 }},
+        {{ 0xf0f3a113fb448d74, 0x4d91ec153db61bda, 0x588a501a7fd08f23, 0x19d2c560271c2b8a }, { 0x7eea6cbd759f0754, 0x3a8053c77faf3e62, 0x96dd2789b0b3dc01, 0x223db774423dd716 }},
+        {{ 0x1c0f70954e3c47f2, 0xcdde39626f0ed681, 0x121a1014ee0f32f3, 0x0589071ca8e65783 }, { 0xe06ae94ed0762707, 0x98bd2a518211822b, 0xc3391a0198a444f4, 0x052db59574f406e3 }},
+        {{ 0x6328f181c684ca8e, 0x3c2c0cea66aa028c, 0x96fdc39406ec80d1, 0x00aed8a9aac0a3f1 }, { 0xa493b707557d942d, 0x8cb506660461a9b8, 0x21c77a97792b8b4d, 0x3a8ddf2836b4dad1 }},
+        {{ 0xf25ab75b582cb3b5, 0x634b04b9b0691cb9, 0xa378e0abc8b93ceb, 0x32699c187ef407ec }, { 0x5fba1482f11479ef, 0x4baea1b7478a8ead, 0xe3b075f6ce226861, 0x0041117ea8e406b3 }},
+        {{ 0x136fc319d73046e7, 0x375cd9023d5a6e60, 0xe046700109dd9f67, 0x2dded203344f5b7f }, { 0x774c23e4ee0059ab, 0x24cd0e0a49db6127, 0x20ec1e31b9d7773c, 0x14b8438677a52857 }},
+        {{ 0x3f7e170df4298423, 0x42eae538f70e2cec, 0xe5dd9d6ee8e6dbf6, 0x0265434efe70775a }, { 0x0029a5c1546c8632, 0x955c472c461b1111, 0x94a754c4d8f8f333, 0x3c60ee5c27812300 }},
+        {{ 0x1081463004a7d74d, 0xe1b3408956edc1a8, 0x30e3c29a3e65db75, 0x3a60d99a75fdddbc }, { 0x0ea6dc9ee1585d2c, 0x26d3a66aaa076505, 0x6e1ae46c8a52796a, 0x07c78e055f3b24c3 }},
+        {{ 0xb499ecc75e443058, 0x93147a0b593f17cc, 0x06f13c549bdb6fe1, 0x13289ea75f48dc79 }, { 0x915131d3af4124a0, 0x3374aa5c2931696b, 0xc6b40fbe9d6ef750, 0x156279301aff06e3 }},
+        {{ 0x3f1bdab8d895021a, 0x467796fa31d457a8, 0x18d20e8d8820e7de, 0x0f5fbfb240ba427a }, { 0x294391b660e88e02, 0x6857e7552f3725c2, 0xa7715270f9484788, 0x1e270021bffcc210 }},
+        {{ 0x46434bc2da63ee8c, 0x8f1cec8417c4ef2a, 0x1df96d2667f38912, 0x3a10f8c6c54e3890 }, { 0xb911a4e31b99335c, 0x10c0569294438d15, 0x52d58d308a9b58a2, 0x361150d74746a297 }},
+        {{ 0x06b87aadf4cefba2, 0x40eb5e525302d094, 0xc877d2ce245b6de9, 0x1d1feaaa542ed93f }, { 0x4ec3d1cdb8dcbcc3, 0xdd062d4943cc596a, 0xbd4cecf7c64d9584, 0x0b25f44c72743e8b }},
+        {{ 0x941c511b4883f650, 0x4fb4f5672b80b01c, 0x4e0a4a35b847cf68, 0x3f2c5f16b57d600a }, { 0x57a04636d4abba62, 0x64a848743ec83d93, 0xcc25325cf8a89c4f, 0x032a023d8480efc2 }},
+        {{ 0xa0bdfeb914477ffd, 0x978ee592e549fb8c, 0xa393a8b8808be704, 0x2203e3f80f0cb3e1 }, { 0x4adf25aca61f1bc4, 0xc8072ea871453076, 0xbc666a13171e789f, 0x263c614d776ff76b }},
+        {{ 0xf17c386f6760b7c5, 0x29318db9b7847f76, 0x4c63e23a47de83a9, 0x2c805452f0c5d2a0 }, { 0x1977031741ed654b, 0x5a33ba04ef50570b, 0x223af661915d4e3e, 0x3751b44d3515923d }},
+        {{ 0x854cceb1bedaeca3, 0x3de8755032f44744, 0x52130f95762c70e6, 0x0c1ab3846b0bd3cb }, { 0xf41a18a8446c9516, 0x2475ac7ded4f2984, 0xd71eef5d109e143c, 0x19d961bf4fce9b0b }},
+        {{ 0xf18b4741385025db, 0xcf83c037951e239d, 0x19e635ee4d99cd01, 0x07d129a433a6c1c7 }, { 0xc1679ff9648c7d5c, 0x05d64121edcbb724, 0x6ce883d9c76e84dc, 0x2954481857370011 }},
+        {{ 0x128f3df960137eeb, 0x177bdafd950b341b, 0x011cb4c2800a9a45, 0x3e3e008beb4a453c }, { 0x87c3db1cbfa467e2, 0xca7a964dcd2e0871, 0x6d269cfac87b4c59, 0x001be3136db44c56 }},
+        {{ 0x1c9ec343ddd7f95c, 0x5f6f6301aba4e67c, 0x131ecbb3d9671c6d, 0x120901b79f9681f1 }, { 0x36d3d386ce8f1480, 0x4619ad00ba4c2bf4, 0xf1304237d1cd4620, 0x309842645dfab1f5 }},
+        {{ 0x4edca92c879ca1b6, 0x7f877935169bc0cc, 0xc88ce1b5171438c3, 0x264408b666bcdb21 }, { 0x20921ed8ff589a2d, 0xefb98e1f15e3e49d, 0x204ee02f670b91a6, 0x06a686a5d4be2e57 }},
+        {{ 0x66e40f75bf86725c, 0x03af39a55dcbefc7, 0xcb219c8f370a012f, 0x24ee7a21b822a2df }, { 0x6586538258072a11, 0x499a17b041cf4188, 0x7b0ad402586a1b6a, 0x0f076d37d2852d0f }},
+        {{ 0x212a71c6ad30e224, 0xa1e781756fcdf919, 0x1185984e86405a84, 0x3eb0e4f4cb599f7e }, { 0x9c06c9e18255c719, 0x3dee107be29abab0, 0x71f6c604245db56d, 0x3b404b4b6ea29314 }},
+        {{ 0xa660502e4333583b, 0x66d55af242066a8b, 0x750f72daddf454b3, 0x30a0c80911e145a9 }, { 0x40cbc7518c956f7f, 0x0a4055fa39e2e397, 0xcdebeba86f767e2a, 0x329cc2bbe77ffffd }},
+        {{ 0x8301ed8a02c6cc8b, 0xd2c3d1a4b7bbbef4, 0x358f41d810f978ce, 0x11f9f00739af0283 }, { 0x3c40c44a029a3839, 0xd9f7c28008846753, 0x89d3d855ee069420, 0x3ac1240fca2aae8d }},
+        {{ 0x2aa323f6782d431d, 0x982978fef594b1bb, 0x8fa1c41bbdf11b26, 0x247cfac1812807a6 }, { 0x5c1e863c6ea87629, 0x6dc945d9a7587909, 0x9fb25021368d6cc7, 0x3f816ed95076cc17 }},
+        {{ 0xd010b6e0196f8e9e, 0xada7c90036d698a5, 0x9042d9948a02556f, 0x026275e9acbedd6f }, { 0x383337a9d8dbc321, 0xfcf67922ca164a00, 0xd60fa9b9ee98d803, 0x1fd8f7add6bdb9be }},
+        {{ 0xe7089c14b0069551, 0xefe86f7f7e819b43, 0x97a3ab42625e0c0e, 0x32d13e5e71a33289 }, { 0x58233716d63ee7ac, 0xec205d08ab15e960, 0x02127c0d0e8e6a18, 0x1e07dd23099aeb30 }},
+        {{ 0x25b8950bfc229ba3, 0x886e56c802ce1aa1, 0x1c9eef9aa9f8baa3, 0x3241617f0f1e3916 }, { 0x95a88232e5371c60, 0x8c19c88376317b84, 0x7a57f5d6647aee41, 0x22f5ee1bc5c87767 }},
+        {{ 0xd0b395b7f5e9c619, 0x0fe9600b91953f7d, 0xca77464733aa7516, 0x062a7c62e55db37f }, { 0xe8e7b16ef7ed157f, 0x5803e94581d0ad9d, 0x19b33d23b45cc491, 0x1ffffd9fc256de33 }},
+        {{ 0xb938121e8c6f121c, 0x55c8b81c93dc35a8, 0x4f6384b5dc713d40, 0x2ed7a78b5106ff5b }, { 0x0278918a0482f8ff, 0xa4cb4f1b7d42c801, 0xb50ac96f25217fa6, 0x38c107ac72a66b39 }},
+        {{ 0x06fa0a4cfa5eb7f3, 0x4ef028a8217f3733, 0x3cad61ada62181fa, 0x14f3a88868d0dc00 }, { 0x62b034adadf1aa50, 0xe70d2c0454295ab0, 0x595c59d27464add4, 0x04604e45e6f9bf90 }},
+        {{ 0xac5ce8729f962540, 0x7bacdb1d807da2f8, 0xa022c4baeac01dc6, 0x054a1c2f058e819f }, { 0xf74d1ad18d454cba, 0x3834630b768edcde, 0xa2d6a7f749f9aadc, 0x189f5b3531c944cb }},
+        {{ 0xe51a232c8305da0d, 0xe3f0a96dd66396d4, 0x2415b7287c9be2c9, 0x0f83ae0ee55cb99a }, { 0x639228cb2f389ee6, 0xcb44392369f898cd, 0x0393e092f35c37c0, 0x3ea9cec2e68cf363 }},
+        {{ 0xa7b98bab808113fe, 0xe375b0e8539196aa, 0x5d92564bcd47e57a, 0x1a14d907231e4c0c }, { 0xd779641a1008ccae, 0x5c8c155d4c875a6e, 0x03f7ed09ede20079, 0x36d660d29e4cd2f9 }},
+        {{ 0xe8de8bac727adcb0, 0xc056c0999184b3a7, 0x77e475b80e6050dd, 0x18d7cf7c7b7fe26c }, { 0x747a7a89f98500b0, 0x08b581bd88352655, 0x4649fec7005ed8bd, 0x29f7b95f2599dd4e }},
+        {{ 0x34a9a28d85775133, 0x35cb93118a280ee9, 0xff5f1dbcc8ec12aa, 0x1c8441c1e073bdbc }, { 0x11ef6db980c9db91, 0x96ef0ea7ec554413, 0x5157f10bb64186aa, 0x0bd6b686dcd39490 }},
+        {{ 0xd7142f4ca11f414c, 0x4a66d9535f783262, 0x98c466fb21eb9228, 0x3c63e1d0abfc7e97 }, { 0x38c0ec635d2b6dab, 0x32cb4af9c00b867f, 0x063b229555861362, 0x0fad3d01093f5735 }},
+        {{ 0x411271c58b7b605e, 0x31bd59ba4a15d1b8, 0x063afa0e15e1eed9, 0x1beff8d46c1db02c }, { 0x1e89d5f9f53880ca, 0x60ab35238aee7f3c, 0x4946e64d47da790c, 0x36333a3b0344b691 }},
+        {{ 0x8161ba58f1c4fa19, 0xe9da1ea8569bcee0, 0x9d7b5ff6740add8d, 0x3d9a699df4705741 }, { 0xbf56d2cd9e66068d, 0xd02d6b5f272c642c, 0x317bf0c59adef9ff, 0x2b31fd4296ad21b9 }},
+        {{ 0x517b75b873542b7d, 0x1aabdc828b5193aa, 0x486a8ea6dd2aa1af, 0x384c5d57713014f8 }, { 0x1d76ef4f52adce48, 0x6299d1c5b444e9b4, 0xbff30a271b61468e, 0x3df2cd83df933d52 }},
+        {{ 0x3c8b8815893f1e42, 0xa0dd8846d10e64f7, 0x07a4e00370e5fdee, 0x12a27fe071301576 }, { 0xb19adabd3793eaef, 0x46f2f5ec494a99fc, 0x6097e740058092c1, 0x055c648fd3c79287 }},
+        {{ 0x7fff6e8f0c0aab59, 0xb2afbf45d79544b7, 0x7c1cf5c9b34b3138, 0x2aa6bd7116515e52 }, { 0x0d3ca3e5ab03aa73, 0xbf56e080d11656e6, 0xab0238fa4f815441, 0x004b86b2ec192832 }},
+        {{ 0xda835e4f9edb5396, 0xcfca982dd7c37663, 0x5ace7a252f9227f5, 0x2a587914ab0d774d }, { 0xb7d38f349b6058f9, 0xb0ef213346b5be2f, 0x44c4c6f5585b88d8, 0x211a65251747a416 }},
+        {{ 0xbbc0486dc09716f3, 0x7a53d61cc322a775, 0x5863aa4cbab6b4c6, 0x3f0676a5a5835f09 }, { 0x7084c84b72ec86c0, 0x4d50f83fa1d10a29, 0x037e9acefb5fb93a, 0x04adc2bdb0cbf392 }},
+        {{ 0x1068901a73a4324c, 0x2c68be34c40167a9, 0xecbbac09c77854c9, 0x0fa0a573eaf65976 }, { 0x7373a3dd0431f334, 0xefffb6dd47453613, 0x89b038a74360ac22, 0x345e234be89d798b }},
+        {{ 0x51c14b1e99393ce0, 0x5d92118a0858441a, 0x72cd112c9be884ce, 0x1402f15a3b0d7d5f }, { 0x2dc9936c2fb32473, 0x928559ac85ada851, 0xf754101f6f2008a9, 0x266923f1d195aa6d }},
+        {{ 0x3631574ee2c63aa7, 0x811c8a6e04bf29fc, 0x7c98b07d8aab1b72, 0x13b7569811612cca }, { 0x5ce395afc54295c8, 0x97ad64059cb54f27, 0xb3b37a9576efca40, 0x1b91fc06dfa398d9 }},
+        {{ 0xe532c73407adce87, 0x5a501651ad1104a8, 0x09bcc14904bf478e, 0x198951252ff1acc5 }, { 0xaac009563aa4bdb3, 0x145f81282acbfa91, 0xb0d62641ecacebaa, 0x374bc8eb1eef0d74 }},
+    },
+    {
+        {{ 0x06776ca29b08e614, 0x85315f09189431f0, 0xc3e59dc9b2c90f7f, 0x359cf34abd63fc02 }, { 0xa847456eb7eb90d4, 0xd464a149dae12de0, 0xf9a186ebb8f49aa0, 0x1457b28a1d8ed4cd }},
+        {{ 0x0053a3429402c3ba, 0x5a843215f94b1377, 0xc7f801d470a88f98, 0x24f20d2c38298f35 }, { 0xbed46a90b514db64, 0xa6273d6ede2dcdf7, 0xebf279b5562faf54, 0x2f3e4c22ebedf231 }},
+        {{ 0xda5c13d3a4831901, 0x8146284c3bdfbb4b, 0x1e9d06c188e742dd, 0x3e5e0885987ecf0d }, { 0x61daae2c817d1c66, 0x647ad30c2167d45c, 0x5c7e5e08e20d6946, 0x10bb66f8fdec3730 }},
+        {{ 0x08c901b91a70e12c, 0xe2204b46d169440e, 0xd50ce27ef3d08d31, 0x2a2700291358f92e }, { 0x5ffc048612b5df99, 0xb2dbf46e0f335154, 0x09cc2cd8a73a54d9, 0x2f92e562d057ab57 }},
+        {{ 0x5e06d4eda3b97794, 0xbc5bf18e71e34e1b, 0xfa9469d017d7dacb, 0x391eb45fa862488c }, { 0xa2c5da6f4c945e3b, 0xf5caab4e0c4ff111, 0xe15cad47691179a5, 0x35b368df04be3cd0 }},
+        {{ 0x1f04e166e904f7d3, 0x30fbb4996b1b5efb, 0xcb7be70a145c11ae, 0x1695318a0f3681f9 }, { 0xf953555cecc0b941, 0xff60f7a21a6f30f1, 0x2811d9fba26a59df, 0x38d80026bac648ad }},
+        {{ 0x8dc8e19869754217, 0x26d36990865115db, 0xfcfc88a577b37a09, 0x23f1747a9c42adf1 }, { 0xebcdfaf2d7439724, 0xe0cd49e1ec7e5f16, 0x670c04ff34e5863a, 0x166565a2ba0b414a }},
+        {{ 0xfd27aaf3911ef4c3, 0x057d1355c72f7c6e, 0x39ee1b05b997a29a, 0x279f3ef33d76ac45 }, { 0xed946f6e6149ae34, 0x82381b59c5f5b261, 0x91059b563cdcaf06, 0x2cf4c538268921be }},
+        {{ 0x65bfb948afd6579b, 0xcc3e6afbf77d163a, 0xf0baa82e62b6756d, 0x35823e21affac753 }, { 0x850157dc857304ff, 0x264de1e7b93cb0b5, 0x9e1d8e52e48f1011, 0x22c37e498e78f9c4 }},
+        {{ 0xcc36ce95eaa58513, 0x0010250dc64d6efd, 0x35bfed95809770d5, 0x31caa6a37841dbcd }, { 0xc42fab3f67a05462, 0xed9f35d20bcdadc6, 0xcff480f9dab028b4, 0x11449544b1cfcddf }},
+        {{ 0x154c3c1d18b58cc6, 0x969b97adec1276a9, 0xad7b7cadaa275225, 0x2e139882ea5a4564 }, { 0xa3858673f1364209, 0x51e8fe6208898293, 0x3cffb4f3922c551d, 0x2933857c633611a5 }},
+        {{ 0x44095afaee27e27a, 0x60b6aca2165d02ce, 0x99a94df713a187fb, 0x24f5ae8335e110c7 }, { 0xaa8a329ec29fff6c, 0x0ee3a19aa37340f1, 0xfa9c02d0b764270b, 0x3546eefec7efd488 }},
+        {{ 0x65e69817545efe95, 0xdc17cf7cfe517739, 0xe68eec7ccf6927ac, 0x05d5cf25c7cad1d4 }, { 0xf78dfc5adcbc9165, 0xcc44c6e415c961a3, 0x38647256b6f3178b, 0x220ba927fad69d35 }},
+        {{ 0xd4ae32727c54a978, 0xf6f90b4962e1dd0e, 0x385c9ad548c1a404, 0x25909a612078cf99 }, { 0x7232fe5c2df81d48, 0xa037aee506a61682, 0xd53f6aed4681ea4f, 0x12b53e8335d2821f }},
+        {{ 0x5f1a02d438b6ebcb, 0xd54855647c812320, 0x5caaf3b5d85ed4a1, 0x1973d9e6e1b077c3 }, { 0x24cf5b921c168a83, 0xcd2d438bffef4c24, 0xabc3e44ff0e01604, 0x3e0c5763ed549cbc }},
+        {{ 0x33f65dedaa68b253, 0x48b02c1e2bfaca47, 0x5ef3bc7364e0623a, 0x3e93bedc67bb34b5 }, { 0x5220fb3406ab5f27, 0x1c49def6a0c5c1fd, 0x2c72e336ddc79bea, 0x3465c3148fab6349 }},
+        {{ 0xd6872da5bcb0a868, 0x0fd3008e32032b9f, 0xfc83051d0797a2ce, 0x05b0de30ffcb77eb }, { 0xf459c56f9a034541, 0xd39f70bd203bee9b, 0xafae05c38f298ca5, 0x22f4673150f091e6 }},
+        {{ 0x4b9ab4e792cf0e8b, 0xee1d5fba5bb7a3b0, 0x9219bcee7e24a824, 0x3b56961fc573c123 }, { 0x3fbb5fe0c03993e8, 0xe04fbcfa67df366b, 0x96ed4cc799210217, 0x04a7269e260d2bfe }},
+        {{ 0xaff983b44b5ae5dd, 0xf818bf67436cb9cd, 0xc02dea857cd3736c, 0x059695b524811682 }, { 0x4c1888fc456fbdb0, 0x765edb99d5cb93ca, 0x8888cebfed578be8, 0x2e987797f69b0b2f }},
+        {{ 0xde39957e04a68d94, 0x565fca123ea2772d, 0xe535fa061964775b, 0x163c79b86e84bea7 }, { 0x8d27b7ffccdfaa4b, 0xc8b5e63c42d5d827, 0x4fade75bbdec1fb1, 0x3162419d1d96cb7d }},
+        {{ 0x8277fe23c8243553, 0xdb78176f9055bf90, 0x1747f36441a05617, 0x3aabef7cc16e972c }, { 0x740e9586bbab577d, 0x16a5d5b5613fffdf, 0x5531e8745cd7072d, 0x134aed812ab249b1 }},
+        {{ 0xf415a781677a4f21, 0xefaea620efe441d7, 0xce21337ac835cb01, 0x28b344e0a6bab89f }, { 0xe4bb36bc1a628ba1, 0xe193dcc46dca3442, 0x4e7b06dd4802826e, 0x244ad377dcb0e101 }},
+        {{ 0xc21176ee77b4283a, 0x3bbe8e986807efca, 0xad265054cc3001d8, 0x0fff4a9c0ba62660 }, { 0x06d8e3ecb692dd8e, 0x7aafb601a4140dbc, 0x73d3f0a31783e039, 0x1a96dc27ac319bf7 }},
+        {{ 0xd85922caf041a0b5, 0xf2355231928bae72, 0xb8ab3a0346e7aba3, 0x2ad7935cbbe1ae85 }, { 0xc5997b42eadaeb6a, 0x7653c35353561003, 0xf503caf514ab086b, 0x0cdf47aa68bf8ba8 }},
+        {{ 0x5c089bb4ac36290b, 0x42598a2eace3b23c, 0xdc71622be9c51d00, 0x1797a4eb492f2336 }, { 0x76c47afc6a0895f5, 0xff7967bc83cce981, 0x1ba2cce84ef2c67e, 0x036bfa372e48c315 }},
+        {{ 0x8777142a808f4be3, 0x856768748f2bbe3b, 0xb98ab60f8e57219e, 0x1d14bd331066e967 }, { 0x950785936a41f086, 0xb18d45de41e02f04, 0x8fed9108b7a27bad, 0x36ff4be016d01fef }},
+        {{ 0xa3f069a1cb20fd34, 0x66a1a44a9aff046c, 0xf5380b2fc1a5c73b, 0x020c1e59aec68850 }, { 0xe03be130757b9e50, 0xa3acd6c4f13a461b, 0x518a9f232e681cd5, 0x1ac460612c5b929f }},
+        {{ 0x43465d535404f228, 0x8dd0379ffb597890, 0xe14f5bfbc3035192, 0x1ea214a49097fbfa }, { 0xbe146f1a285743bc, 0x1990564007277ea5, 0x32d0f92889eb4665, 0x3236245801d9a3ab }},
+        {{ 0x118234835a0a8758, 0x03d9213b83e78725, 0x8dd98765ff400ad6, 0x0757d08742f53b04 }, { 0x4d4385c3c3f3e817, 0x495d2e6dc739422a, 0x22c32bb931c2220b, 0x20a6e5baa414c6d4 }},
+        {{ 0x6ac00e5cda794a7e, 0x8bd2f86b4a21e850, 0x769ca9b4ffb60314, 0x2f45d2eea53f44d8 }, { 0x8e507ff5965e87e4, 0x5354e06769484a01, 0x5b2039eed24ccfa9, 0x25f24a977a2bd10f }},
+        {{ 0xdbe3728ae18db15f, 0x611d9509fa8e00e3, 0x2269b551e6898764, 0x3c7410b5b50dd019 }, { 0x0f0fef77bde4a6fe, 0x56d76aed3cd72366, 0x40ea9d13981cbc17, 0x2050fd7674b1dd1a }},
+        {{ 0x42d271205da5356f, 0x69f89cc048a85d7b, 0x017476fc3337542c, 0x3357c1037f69fef6 }, { 0xb6c1b54013476ffb, 0x01a0a7526f027f90, 0xbd4f4b2e8de6e9e3, 0x385183e5bdb31f25 }},
+        {{ 0x16cedab0d6d3453d, 0xff7da0bb88d29f62, 0x1053aa40321a8bc4, 0x1a1ca4e93f419832 }, { 0xc19bbb806188504e, 0x547a34bcdb9b7499, 0xeb49a4924c1726e5, 0x199e4dcacd60bc37 }},
+        {{ 0xfea0239cf2a77961, 0xcb2ad057f1e78ca0, 0x872070f01fe50071, 0x2839f39b5470478b }, { 0xf02eb16e75622d29, 0x89e0e192ded9e3db, 0x676c59683dbdc7de, 0x0dbe6a294ac5dc66 }},
+        {{ 0xdae81191246dd6f2, 0x5449eb35c925f12c, 0x5cd0aea6ded7cc38, 0x29074c0542383e88 }, { 0xc5d4638818fa5f63, 0xe4c2a209b45b51ba, 0x1f6cc44552634bf0, 0x10be97bdc504c402 }},
+        {{ 0x3a23ef6f5c3c1850, 0x29c3be04ec011b15, 0xc11e7331964eedd3, 0x11794762e054274c }, { 0xde00e231c2d43258, 0xaf6cdf0357c27d9b, 0xe332d12ddc9e20db, 0x108e0707f9a3e1f1 }},
+        {{ 0xeac681f1155c7743, 0x5acbc848b50731ca, 0xecbe9cd637e73235, 0x30e7d216e66ce9f9 }, { 0x2a8f576ad5b59503, 0xda383091d6b0fbd2, 0x800d974795e741c8, 0x27367747c4457828 }},
+        {{ 0x914e60c18ebc03f2, 0x89fd6c8db61eaf4a, 0x539c6e58f7d969e7, 0x035e2fbebd14fdd8 }, { 0x9ac8f5e907b5943c, 0xe5de125a05e5a99c, 0xe8b1baefbc472ce9, 0x3bbb5e73162d45d5 }},
+        {{ 0x2d5d0fde0baa846b, 0xae6066c5e6ceac4d, 0x6ae3c027a2cbc5d4, 0x10be57ca30db706d }, { 0x4c7a65a2a575c84b, 0x630baabb918e7afb, 0x7d8af4c6c0450f20, 0x3de10a7600885578 }},
+        {{ 0x72a5dce3cae28242, 0xff773d6327f4cf9c, 0x1edf42a5d2c64e0a, 0x21deaea2eb153d40 }, { 0x57913acaed81880f, 0x107f8e80fbb406e6, 0xc3d34f3d05bc84a6, 0x1d60129844bf95f9 }},
+        {{ 0x2f10d797019c243a, 0x91594dccb2c163de, 0xaf9e99bc6f34bb57, 0x1a3baafada05c981 }, { 0x272b7f79a996a586, 0x0dc875e440cb1668, 0xef3f6fbd57f501da, 0x31027038dfcaaeb1 }},
+        {{ 0x823af75b2416e74a, 0x0999e10b768eda17, 0x865c0be1d5329a28, 0x0a7b3290a761a4ce }, { 0x6a2224afcd156cbf, 0x12c6418bd79e5901, 0x32d64cd2566a0141, 0x0cd613dd9efdb77c }},
+        {{ 0xd75b0485f16d1b15, 0x5d1be0e097c80b54, 0xe4b9a51c9fd828ab, 0x34a58cea864821c6 }, { 0x20402cb1992453c5, 0xa91d201bf9b82a1f, 0xc5a5f3ed374c02f9, 0x26d693cc0541fa37 }},
+        {{ 0x1d3377a94acabb45, 0xc3b2d3f20bbf29a7, 0x929a609ab5331baa, 0x2c4315a11f5d2527 }, { 0xbef6cf7d479eb425, 0x80058aa22694cc48, 0xc156bf429f783b31, 0x308898960e5a2241 }},
+        {{ 0x055da8c1d7b7e203, 0x597c67aad4662207, 0x0a7283a8abd5a61f, 0x03cc4aaa763d303d }, { 0xc6c3901876701dec, 0x0263b6acd35f96b4, 0xb9984bef98b8cb54, 0x310b3ad2b8b01bb5 }},
+        {{ 0xf73bd4f4012847da, 0x42f4c38af6e8d68d, 0x9baf8fc14e1113e6, 0x12d0d6fdbeb33a4f }, { 0xdff3606deabada7b, 0xaf2f4f0b1b202797, 0x8b979ddab196c1ec, 0x3783970c53c88d26 }},
+        {{ 0x4482c509c65e2796, 0xdd5743ef63e4cca4, 0xfd83b8623cb8e1aa, 0x3e2b7ff124ab8537 }, { 0x670d6fb4e7a02909, 0xfec32ee4dd37048e, 0xce6994fe62360624, 0x2487ad0825e6de81 }},
+        {{ 0x9e465479dfeec735, 0x28adef42423eec37, 0x0d1cb762d157b559, 0x2faf4972f697fffa }, { 0x2b43aaa471f892ad, 0x2c895cc7b9557f9e, 0x4da0f951cb5ea78a, 0x231abf865395b379 }},
+        {{ 0xfed1236b52138db7, 0xc90922e5e351e9e3, 0xa93bfcf6df1ae621, 0x2168ef0631b3742e }, { 0x0bd643f1f4589c20, 0x27ee258c214aa754, 0x0f8aefb7bfd73cfc, 0x21083d6dbb2c7af5 }},
+        {{ 0xf7b93e2a5fbd53c1, 0xe8673be7bcc59cea, 0x5eba45621418d586, 0x16be6e2001888e4a }, { 0xd8222c9e435235f8, 0x6ef35c7e0cd47998, 0x09d336edb391b99c, 0x2a289a4ea942e552 }},
+        {{ 0x21b6b50ee28ffde6, 0xa4ebdc5597127dd9, 0x661a6f0c43c6bdf6, 0x18f383a54fad79f3 }, { 0x04deb3142cac0c91, 0xc1ef371a831609c6, 0x988e011374c6e00d, 0x34d559a6959901e4 }},
+        {{ 0xbb44e77011cfeb55, 0x26b5866b523ad9f1, 0x70780176303d7d73, 0x27e04558c85dbea8 }, { 0xe4c47dd62dcedd33, 0x64fa7793ae39fd9e, 0xb99044551f1ae4d1, 0x08c5c15ed6a2935b }},
+        {{ 0x6701594a51023cc2, 0x35eea5937ab37f22, 0xdc48fbf510295b9a, 0x2dcecb3832d80433 }, { 0x87c812e1037f0799, 0x4b6fc83b0da00b7b, 0xb75a5fb926ba9bce, 0x3696de9c3666d659 }},
+        {{ 0x298b3465ddec3e81, 0xae7608063946fc2f, 0x6146ebaa508e4f83, 0x392e8f4dca5d22c0 }, { 0x72bada5f3493697f, 0xcd65b75e7283d921, 0xfab4c6c79524a54a, 0x0796cf7f3fda7510 }},
+        {{ 0x78aa2a1fdc4a383b, 0xaaeb0a742423218a, 0xe998b39b30a01c2c, 0x0cdf3bb6192ba500 }, { 0x5fd14a1a0dc3e786, 0x08c50f9a86ed7daf, 0x3620cb24e030eddd, 0x3516b4a55b665424 }},
+        {{ 0xad30f37c55754ec6, 0xc3f2d90d72a1ba9d, 0x0e47852fbcc27ede, 0x2cf4b2214f7f05e7 }, { 0x17c24f1a1ba229ac, 0x92fe57d30f454a77, 0x9ac367e7c4b50ce1, 0x0f374531b614d57e }},
+        {{ 0x9f9586532ede4381, 0xbe1fcd88036d3942, 0xa4e50bf5ba457fa1, 0x3bafcb3287f0c520 }, { 0xdf8765e72b8d86b6, 0xd7eaddeaf0601566, 0x179f165994aa4157, 0x1a2a951affb6e573 }},
+        {{ 0x26e2b322242c46a0, 0x8e498444796e24a5, 0xf1de31b82676dcdf, 0x05a759eaf4144d30 }, { 0xe729d71f20bc3725, 0x7c56bbbc5cb389df, 0x072bf66b4a75b04c, 0x17c8b63034e7db7d }},
+        {{ 0x44d9a729004c51ce, 0x169714787fc3bb57, 0xa09325199dd61db4, 0x3a7e554eb6d32365 }, { 0x9c6ced5986d8afe8, 0x5b543118584bd46d, 0x142e630453f56c83, 0x3d6779872571164d }},
+        {{ 0xa688cc53b2e18000, 0x828c523444e29f9f, 0x101664c257eb3746, 0x18186f8ce3a0139e }, { 0xfc82d5e4aaf701d0, 0x29f22487bd244760, 0x05cc604f78a1c0aa, 0x32512920ab07376f }},
+        {{ 0x0b0b3db195c0bb1b, 0x8873b358bd7567ea, 0x4306bcaaba867eb8, 0x2685e6dc319ad0f5 }, { 0xe26c23c86c2c58fe, 0x687ae22737d0c20b, 0xec25e96826fa1829, 0x07ed84e495a78f8d }},
+        {{ 0x2392a8c89c6f7161, 0x88c4a237d6168476, 0x08ed58e54bed6247, 0x2413f3c9f8991e6c }, { 0xedede08b4ea3f780, 0xe178afa8068c984e, 0xa4f3718c0b190771, 0x3146a4af7d647756 }},
+        {{ 0x66afeb81ea74ab8d, 0x1076fb0a711971fb, 0xa9a0b8a010bc4f19, 0x1d9bc38d9ffeed64 }, { 0x08c6c55a34bbc591, 0x98bea5bf4fc2c867, 0x4ca5fdff5a78548d, 0x298daccc118b6c6c }},
+        {{ 0x9d1634ab24d80db2, 0x53d5fba6fcd25da3, 0xa67f228b3fd422f0, 0x127a1c55da7fb228 }, { 0x57b34a22c6b2f0be, 0x0aa2c8be498c4b22, 0x810ed33c675ce842, 0x248654404436b0b4 }},
+        {{ 0xef87a3e435d0f458, 0x85f2249060947109, 0x66f15b1ab412af39, 0x223880ccb06085ac }, { 0x9254f24915a31988, 0x1702387e760f7a96, 0xe2b43958d55a0fbb, 0x21a0cfddeb2866dd }},
+        {{ 0x52a25ba553876762, 0xa06e0143f70ea2b9, 0x357d7b7dd9657648, 0x044cb78a631f18d3 }, { 0xc4a8d788d718318a, 0x60474ad3a1aca07a, 0xe54d32b506bf81a9, 0x34f769129357dfce }},
+        {{ 0x81b275a73b3bffda, 0xf487f87a20092858, 0x04e46ab09b2a1c71, 0x2a9fe89a03771933 }, { 0xbbaf354b986e42fe, 0x195c40048479a29f, 0xbcef4a9d4402390f, 0x3523591a98e0cc4b }},
+        {{ 0xcff65b878fadb1f1, 0x0fcb60695fc180ea, 0x885eec094aabbc05, 0x1f91944ab09669b9 }, { 0x2c7bb8846d96dab0, 0x6981da22a3f8f4ef, 0x3c4dabe0f685cded, 0x3fdadb42e0e03393 }},
+        {{ 0x0ad381536f767c8e, 0xadd14df94212875f, 0xc6a7d55343306640, 0x0e2cb65393cccebf }, { 0xadb5582891266996, 0xedb8618f68cc6da5, 0x3dee7cd4a78c5a15, 0x3084eb7c3ffc2be4 }},
+        {{ 0x8c457c892c832ce1, 0x9e85336da9ecbf49, 0x8e42d6c34e6e3928, 0x2ce8399bad88c656 }, { 0x1a8b82aae1c7011a, 0x9944d585e0148f83, 0x69b365828242c4af, 0x1e6ad2c60b63dd58 }},
+        {{ 0x556863b4509b05d9, 0x679259cbfcbf1408, 0xf1aa96fef0bd4f49, 0x0f82ed4d82e92a2c }, { 0x0dc979ddfa3be767, 0xe5a0f11538e3d623, 0x0135dd53b039d558, 0x275e00eb648e52c1 }},
+        {{ 0x79cef2f98de38e7f, 0xc1383a68760f8b9b, 0x7a6188dffba9de20, 0x04e30e35f8e11d82 }, { 0xa4ff7bcdebab39a8, 0x2f431b8b16300f2c, 0x895f6f3331cc20d3, 0x2f877c9e296247f7 }},
+        {{ 0x2fd0ac6946e6c7b5, 0x22c5666a1e746e7c, 0x215e27359da05be0, 0x2aab054393ad9512 }, { 0xe75a11d0ce0f1fc1, 0x8a756b5e8a143dae, 0x4dc9880ed765b203, 0x1c98c279d4dbfa1f }},
+        {{ 0xee405b6885c3d3be, 0x8b087ef57f12cde7, 0x3ac27198a7e044f8, 0x34d5ddb2fee5ab16 }, { 0x5706b91133149257, 0x9d23062672053cb8, 0x6ca73bd4bb5dbb27, 0x127227e542d302e7 }},
+        {{ 0x5739874e792fd3c4, 0xe37c8d333aca1bfb, 0xa0c094ef5a6ff14c, 0x26976de8f933a759 }, { 0x6b21d3d9e40efc24, 0x667bb0f591b8ea4a, 0x20b246bf08da70b5, 0x27629851dd28be65 }},
+        {{ 0xe851fc09aad03171, 0x331752b8e9e6aaf3, 0xd21bb79338b76d32, 0x17aa2e664c9cfff2 }, { 0xd958d02f46dfc661, 0x2c1a162b72047519, 0x917fbe756924ddf0, 0x0a0239ae33c384cd }},
+        {{ 0x4a16ef84a0cdaf31, 0xe8aec4fbf70b21a9, 0x28b152c2b8d5dbed, 0x0c9b553170bf52bc }, { 0xf533524ac379570a, 0x24622c27aab75dc3, 0xeaa16c6b24131111, 0x19cb1ac72472fc39 }},
+        {{ 0x71b335963ff15d65, 0xfda9e23c43995266, 0x7e8ea0f109b77c39, 0x0b257d1ac277c5c9 }, { 0x52921e14eb9b762e, 0x7ce5754a8a7ba8f3, 0x3f5ad90544943d9d, 0x162a7a0ef4ed3dfc }},
+        {{ 0x3eb25dc5b7c1a275, 0x7730b022f4a61e41, 0x9c6afb3fa450910b, 0x21be444679450037 }, { 0xd0bb97a1d0283168, 0x2e912c9b8ee87984, 0x66d808d64bc7a485, 0x2d5af6e58abc5182 }},
+        {{ 0x5aa03727fc51d488, 0xd39c4831fc609fb5, 0x45915d913120d0b8, 0x0f29b7a5943465d1 }, { 0xe25feb64c43daedb, 0xaa941c7535fe5b19, 0x102bcfe78f5a5a50, 0x3fd1b3a7f3bd9c7d }},
+        {{ 0x931e2da6ffd4653c, 0x2b3ae08a3f0a9c17, 0x255eddf50342d1b6, 0x255ec2f4507ba133 }, { 0xc5f0c6aaebde4f79, 0x715948aab4b9acc8, 0xe83f51471655708c, 0x07b806ae67d47e16 }},
+        {{ 0x8d0f1d1b22737da1, 0xfbd4ff0dfd04658f, 0x53ffeb6fd8a24aa4, 0x2c2f4989c7a0fb96 }, { 0x84ad259a459f3015, 0x061254a984dc96ca, 0x9069dc7100f84de7, 0x392b5bb9e4f46e5d }},
+        {{ 0x4faeb6bc79230627, 0x523db0b164cf553d, 0xf3c6c33501fcac4c, 0x38f6d29d7511c571 }, { 0xaae2e82c85a17d34, 0x2f9cf06ffdb7ce5a, 0x5c7a37854bb88c1e, 0x39add6b68161eac0 }},
+        {{ 0xc56538d724db6889, 0xd9854cae9b58df50, 0x08068a58c1d04955, 0x1e4f5bdaa5e6dea4 }, { 0x5e635a40f676e5b5, 0xf196d4945fb56941, 0x17df414a18ccd855, 0x3500d8f3d98f007f }},
+        {{ 0xf74ab7a04af60295, 0xb90b41d15a6b7b0e, 0x709537fc952052e3, 0x0b39d4b1e7d398ec }, { 0x78891cb4adbe30c5, 0x205ade79dc6b69d9, 0x140b2b92bf31fd34, 0x1af530bbdaff1d14 }},
+        {{ 0xe5b57f2897075977, 0xf47b4751d581dc01, 0xfb66c040e0ae586f, 0x0a9fb2ad258aaad9 }, { 0x1a9051687f954863, 0x1e152b8bb8b6e222, 0xae2ada14a7f8efca, 0x3823011f7636c866 }},
+        {{ 0x0eb881f35758a368, 0x09f4a5596f1dcba2, 0x51f4debd634b91de, 0x2f0800d3f3b59e97 }, { 0x5ebad26a59aa13df, 0x07cd4dc4c81e8b59, 0x09e6cd24298e016d, 0x37c2214b84e82067 }},
+        {{ 0x9661a1c2adcf5064, 0xb69cc631761274f3, 0x87ae63a267cce740, 0x14b8776364ff4a7d }, { 0x93d319ab982f5117, 0x1025e44e889dddc1, 0x16714c506a785879, 0x1e844cd6c532b359 }},
+        {{ 0x8ad87e75a955b460, 0x5f5c89d4f9fa410a, 0xa92150578483a442, 0x03523c115db7c0b8 }, { 0x8114e6b2ad37042b, 0x72114648b8c094be, 0xa2d0acdd1481a5d5, 0x14991f8ee40f0de0 }},
+        {{ 0x33d56cf55e2a13ec, 0x5e55815b7f14095a, 0x3e185359bed727d9, 0x3a33ac2c1bd40725 }, { 0xb4da28c5b8c2102d, 0x719cbb6517a7aa42, 0x973846dbf00bc590, 0x193a10c3651fe00f }},
+        {{ 0xcd3913bdf0fe42b5, 0xda72e66f3d13607f, 0x8bd0826abcbbe85f, 0x19742b0587207cdd }, { 0x9dfa7014107a617c, 0x9ff7f1b1ee04750c, 0x40d275b4197eb149, 0x2e8d8770f8ecd316 }},
+        {{ 0x9f6bfbd88a3dced8, 0xe3ececa1fbfba63d, 0x437941381e6e16ea, 0x0b17dc2544bb3893 }, { 0x95da57921575ea0c, 0xde1a7920efe1a962, 0xfcc7b2319a652e60, 0x1df1321635631bae }},
+        {{ 0xa4119e03c43fa980, 0x176e3000d39ae643, 0x6679faa2f13c51a7, 0x1ec5cd425343bfa6 }, { 0x790b085126e8d7a6, 0xf03213e3cb8d9710, 0xa06f45c42d842d5d, 0x1dcb409ec1b96e56 }},
+        {{ 0x3f73e3d494d06789, 0xd0400fffe27c0818, 0xbd7466fabe47535f, 0x0cbf4f88f34f539a }, { 0x31fec4eecab7e2dd, 0x4cb318f58de92d2b, 0x7998b6cb79614abf, 0x349dccfbd9837fd1 }},
+        {{ 0x8ae995596557a284, 0xab80d783f1764eae, 0xf5d7d7634f896089, 0x2682bb808790aab5 }, { 0xff0d5ecfdca6a8f4, 0x9687b24a16599111, 0x6dc39c88d6165f8f, 0x2627608d5b4fa554 }},
+        {{ 0x9abfd8e43ea87243, 0x3202c0885ff4715e, 0xe140e0cfbc36eb93, 0x1843101484c9ab71 }, { 0x160b7d088414cf55, 0x70bf0d38ac3f720a, 0x3f433ce2791cdce0, 0x3261b177751ea81b }},
+        {{ 0xdcc4c957a498b84a, 0x84ca5d5b42b28a91, 0x035c3ec0443c97b3, 0x22851dc3cffdda16 }, { 0x05aeadba566728a5, 0xdc625ee2a74a39fe, 0xccb4a9d78baedfb5, 0x14025c719eb00129 }},
+        {{ 0x5dc9fcfac7e70f40, 0xf0400d901b98c0cb, 0x946accedd65ecb89, 0x3eb62505847a7aeb }, { 0xabb0215fdcc2d1ff, 0x431c04ab5517847b, 0x82c85bbe8e2941fc, 0x23005c805ffb970b }},
+        {{ 0x722b2593af27cccc, 0x04ee1e806d1cae6a, 0xd9a5a2da2ba5e341, 0x31654ac98a0ad90a }, { 0xd8a9736f50457fbe, 0xedf0c7affd6ee2d0, 0x1066e4f90487d6ab, 0x1e7a301f7f9ee041 }},
+        {{ 0xdef7648b824b334e, 0xd9aef5f21b9cf2a9, 0x3a16310d6ae0ab08, 0x1bb4135f104da9d3 }, { 0xdad8920f3a4dfa33, 0xb8623bba6e583379, 0x9f0eced95179bdfb, 0x25441ffa89c75bdf }},
+        {{ 0xd5d8497c895c48ac, 0xa10be4b596a14b7a, 0xef9c2167aa49c222, 0x350b95b580c85558 }, { 0x10c30009db431f4b, 0xb87823d1a81389ba, 0x6376cbc4d04dc774, 0x17f9d00e031a8651 }},
+        {{ 0x89c02bd12c94fd54, 0x95497c8bcf47e4c0, 0x0861475f261e707d, 0x2d5b8123fea44492 }, { 0x3844f7f08287efde, 0xc57f45de7eaa49ea, 0x5d2205aa1613afd8, 0x2ecb363d62908265 }},
+        {{ 0xd45f356b032300cb, 0xd80b606bfd520d2b, 0xca3a96dca1fb74c7, 0x3dada4f3a071edee }, { 0xd5872b23b9e855fa, 0x75b01356ff87ad9b, 0x5a7918eb9742ded5, 0x298c9585434110ee }},
+        {{ 0x83e23956b82c245f, 0x8c0770a3b5c05661, 0x6409ae49a3f44a87, 0x275c17fa2df0422d }, { 0xfe9e7fa44b4b0cf7, 0x3f1542d30c86519c, 0xb8c896d8ce9b993e, 0x12069bb2b776aef7 }},
+        {{ 0x9adc284779abbe2c, 0xe39c5de7a36528c5, 0xae91dd68a6529254, 0x290b4b2f464f3d06 }, { 0x65319d289e5f083d, 0x771540a193783c3c, 0x945ec7b0cbff53a2, 0x23dab6267c7fccb4 }},
+        {{ 0xe2aa57a7b38e5c82, 0x26d2fccb538d158d, 0x1754958b8864a48f, 0x082e0c8118b29ce7 }, { 0x492b6a6f9cd47f94, 0xbfcc17f46520568b, 0xb7d19f0f1548cea6, 0x2928fad7d9c067f5 }},
+        {{ 0x50640abd7f762a0f, 0x227e60118cbaf7b7, 0x02b645e81a5bb6d6, 0x3eac5100ca1382d0 }, { 0x89afb0da6eaa748e, 0xb759187069344a77, 0xa7ccc2ccb6ad921d, 0x0728e907c8a8bf3b }},
+        {{ 0xcf7386426a2ee177, 0xa2c1dfb4323f68da, 0xa9c7572f5ef7eaeb, 0x36df33885b1dd989 }, { 0x7b50dc8a315a677a, 0x0b98d0319efebcc6, 0xe5f62fdf90d1796f, 0x25024c952d9aeccc }},
+        {{ 0x15b2c38f0c6688de, 0xde5eba76752d4e14, 0xbae50274b00843c9, 0x276c03959e13a5f4 }, { 0x3a3dcf62e0acc405, 0xcb2d258bc55470c2, 0x67cbfd14fe8b83c0, 0x3a7c9b2dbf48820f }},
+        {{ 0x6d9f840845a90855, 0xae506816c395462e, 0x3147e2dd043b3670, 0x0f2184ef326b59c8 }, { 0x13fdc55abc6a6503, 0x6b95f359ee94133e, 0x639abc114ce37611, 0x3107b77f6b598284 }},
+        {{ 0x51c2bb5810ca9906, 0x79555fde5785c52f, 0x36598f0a1be8846e, 0x2cb99f26dadab95a }, { 0xaabdf2229c8fe63a, 0xd7d39ad704510213, 0x28a6dd662cb09556, 0x2129f4cb2d72de3b }},
+        {{ 0x34450b16f54a5358, 0xcb8509a69aef7f9e, 0x9694dd74ec9d74a1, 0x3d788dd91de03dca }, { 0xd0132aafa907e9a5, 0xc2a387a1ef39b03f, 0x7c91d8c1a1b4a67e, 0x15111983c1d1dfb9 }},
+        {{ 0x9e1d8b505a09b839, 0x4aa357e312cdc4e5, 0xc12efce2654c2560, 0x37e497749e2f6f14 }, { 0x3682f0c3da82aeb8, 0x6357ccd395a35efb, 0x95d7f81d78ba3c66, 0x10af699fe0e63fac }},
+        {{ 0x4759b81dbba66c96, 0xe6b11db56c1ffe24, 0xba4a644a7057684d, 0x07e32baef941d501 }, { 0xa4f975dc4a0129ea, 0xd78ed586c3a939a9, 0x7e84d4f59b65c1a1, 0x2a34d24587943d79 }},
+        {{ 0x81fe98be89b6ad5b, 0x346938ff14a91f25, 0xb1dbe1c043c682d7, 0x1a56a4d05ef76da3 }, { 0x8bd88084c7ac11de, 0x0df64dfea4ad91a0, 0xbaa15eb61321b6b7, 0x1540bf48eb0e46ac }},
+        {{ 0xe259e4aef83b6f8d, 0x0d433448d219798b, 0x1c56e1e4299a8f38, 0x225a7878e0454211 }, { 0x315c1d208964f1aa, 0x61b7eac017500f04, 0x6e2978c1137c8686, 0x3224d819a3036d53 }},
+        {{ 0xccaf1e8f14410608, 0x2f1c1389d06691b9, 0x43ba3abb7ed0e014, 0x1529f87aba8c05d2 }, { 0xbfae78ce3ac62a09, 0xbfadc00bd0e82d50, 0x7add6be697d23b07, 0x3a0c2497c44f70f4 }},
+        {{ 0xa163dbb6bbc7ee86, 0x3794284f0eeefaa8, 0xdb33fecd4f1320b2, 0x3dce0b4b3dc0dd77 }, { 0x349f9667d779be23, 0x298d66fc21485fe6, 0xf0354a1075ed8017, 0x14c3652ce44ee59e }},
+        {{ 0x9947fc91b4cf1571, 0x44d89caa70a0851f, 0xb36d96e97fa37078, 0x182f292edb75a36e }, { 0xd75790c6156259f1, 0xf2e93c0c113ee33f, 0x8c138df55d3f177f, 0x1bcd19fb5d113464 }},
+        {{ 0x469455e2e64d9913, 0x50aa5eb92a415994, 0x409e361d53f08692, 0x15df251220e94f1a }, { 0x3b71ac6f022f8ef8, 0xce99bf7e79d15a09, 0x617ef70bb2f1b06c, 0x0ad47f3e60d18228 }},
+        {{ 0x919afbee85f60911, 0x5cad9f68ebc189f2, 0x2a4585887a5d04a0, 0x2a920cc44ab3370e }, { 0x862b87248896b530, 0x004fa7ecd457f371, 0x4149f96bc3cbae56, 0x09544669178bdb96 }},
+        {{ 0xce7748bdcc44f123, 0x654203074475ff91, 0x5e9b5a5c4feef676, 0x0fe3e4cf8b8effc8 }, { 0x28fb293f36103bbe, 0x56bcd49b6b63c774, 0x1a50de40e6b24e60, 0x090c9c7e594b677a }},
+        {{ 0x6a6ea77ca9c396a2, 0x6a313bbf26480bad, 0xb507eccc525a6b54, 0x37f2542e62bd2f4f }, { 0x216649141bec2621, 0x2ce96e2d26e8be38, 0x968cbb4d43741b21, 0x1b12551e841e7a3d }},
+        {{ 0x2d59244204e3893e, 0xad436f74cc08fd0d, 0x55ee8fe69dbe7eb4, 0x0d95202ee986927a }, { 0x2ec030f58d931022, 0x6e73e9dbb7a823bb, 0x82dd4f1600fdb6d1, 0x36821408e46f30d6 }},
+        {{ 0x97750d9cc9bfa206, 0x28a6e63bce681e13, 0x72238db095f89337, 0x2d350559552a6880 }, { 0x659c1fa3890c57a5, 0xffd80da8e8ab7d4a, 0x2280d0e0c9a008eb, 0x2ac8f39a2764f28f }},
+        {{ 0x492328d70740e21c, 0x8cfda020e4690a5e, 0x488f7ffcc0f675b8, 0x00bbbe255e192015 }, { 0x9efb5e835e6969a4, 0xf2dbbbb1cfa707d9, 0x96d8b89d2095d11f, 0x1398edb50b915d7c }},
+        {{ 0xa9bee9d893fbe5d2, 0x44478397776ab390, 0x3f7cbf0afc659923, 0x256839ae6c8168dc }, { 0xd82af4bd480fdb26, 0x1a460a17d8876232, 0xcc4fba19d884842d, 0x1064aa7fddc7ebaa }},
+        {{ 0x0e01d134a9465326, 0xd31fbefd2bf836d9, 0xc245765e0c350f5d, 0x0abce46a3e07be06 }, { 0x1e9f0cd6b8315a7c, 0xe14b586aa8207075, 0xd8dfd4c3f35f4caf, 0x230aa8f64c3440fd }},
+    },
+};
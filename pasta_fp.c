@@ -20,6 +20,8 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "pasta_fp_sqrt_tables.h"
+
 typedef unsigned char fiat_pasta_fp_uint1;
 typedef signed char fiat_pasta_fp_int1;
 
@@ -27,9 +29,15 @@ typedef signed char fiat_pasta_fp_int1;
 #error "This code only works on a two's complement system"
 #endif
 
-// x^{(p - 1) / 2}
-const bool P_MINUS_1_OVER_2[] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-const size_t P_MINUS_1_OVER_2_LEN = 254;
+// (p - 1) / 2
+static const uint64_t P_MINUS_1_OVER_2[4] = {
+  0xcc96987680000000, 0x11234c7e04a67c8d, 0x0000000000000000, 0x2000000000000000
+};
+
+// (t - 1) / 2, where t = (p - 1) / 2^32
+static const uint64_t T_MINUS_1_OVER_2[4] = {
+  0x04a67c8dcc969876, 0x0000000011234c7e, 0x0000000000000000, 0x0000000020000000
+};
 
 /*
  * The function fiat_pasta_fp_addcarryx_u64 is an addition with carry.
@@ -2050,31 +2058,103 @@ void fiat_pasta_fp_copy(uint64_t out[4], const uint64_t value[4]) {
     for (size_t j = 0; j < 4; ++j) { out[j] = value[j]; }
 }
 
-void fiat_pasta_fp_pow(uint64_t out1[4], const uint64_t arg1[4], const bool* msb_bits, const size_t bits_len) {
+// Sliding window exponentiation with a precomputed table of the odd powers
+// arg1^1, arg1^3, ..., arg1^(2^w - 1).  The exponent is a little-endian
+// 256-bit integer and is treated as public (the window schedule depends on it).
+#define FIAT_PASTA_FP_POW_WINDOW 4
+
+void fiat_pasta_fp_pow(uint64_t out1[4], const uint64_t arg1[4], const uint64_t exponent[4]) {
+  uint64_t table[1 << (FIAT_PASTA_FP_POW_WINDOW - 1)][4];
+  uint64_t arg1_sq[4];
+
+  fiat_pasta_fp_copy(table[0], arg1);
+  fiat_pasta_fp_square(arg1_sq, arg1);
+  for (size_t i = 1; i < (1 << (FIAT_PASTA_FP_POW_WINDOW - 1)); ++i) {
+    fiat_pasta_fp_mul(table[i], table[i - 1], arg1_sq);
+  }
+
   fiat_pasta_fp_set_one(out1);
+  bool started = false;
+
+  #define EXP_BIT(j) ((exponent[(j) / 64] >> ((j) % 64)) & 1)
+  for (int i = 255; i >= 0; ) {
+    if (!EXP_BIT(i)) {
+      if (started) {
+        fiat_pasta_fp_square(out1, out1);
+      }
+      --i;
+      continue;
+    }
 
-  uint64_t tmp[4];
+    // longest window exponent[i..j] of at most w bits that ends in a one
+    int j = i - FIAT_PASTA_FP_POW_WINDOW + 1;
+    if (j < 0) {
+      j = 0;
+    }
+    while (!EXP_BIT(j)) {
+      ++j;
+    }
 
-  // square and multiply
-  for (size_t i = 0; i < bits_len; ++i) {
-    // out1 = out1 * out1
-    fiat_pasta_fp_copy(tmp, out1);
-    fiat_pasta_fp_square(out1, tmp);
+    size_t window = 0;
+    for (int k = i; k >= j; --k) {
+      window = (window << 1) | EXP_BIT(k);
+      if (started) {
+        fiat_pasta_fp_square(out1, out1);
+      }
+    }
 
-    if (msb_bits[i]) {
-      // out1 = out1 * arg1
-      fiat_pasta_fp_copy(tmp, out1);
-      fiat_pasta_fp_mul(out1, tmp, arg1);
+    if (started) {
+      fiat_pasta_fp_mul(out1, out1, table[window >> 1]);
+    } else {
+      fiat_pasta_fp_copy(out1, table[window >> 1]);
+      started = true;
     }
+    i = j - 1;
   }
+  #undef EXP_BIT
 }
 
+// Number of divsteps needed by Bernstein-Yang inversion for a 255-bit
+// modulus: floor((49 * 255 + 57) / 17)
+#define FIAT_PASTA_FP_DIVSTEP_ITERATIONS 738
+
 void fiat_pasta_fp_inv(uint64_t out1[4], const uint64_t arg1[4]) {
-  // invert by Fermat's little theorem:
-  // x^{p - 2} * x = 1
+  // constant-time inversion by safegcd (Bernstein-Yang divsteps)
+  //
+  // Starting from f = m, g = x, v = 0, r = 1 every divstep maintains
+  //     f = v * x / 2^i and g = r * x / 2^i (mod m)
+  // so once g has been driven to zero f = +-1 and x^{-1} = +-v / 2^i.
+
+  uint64_t precomp[4];
+  fiat_pasta_fp_divstep_precomp(precomp); // 2^{-738}
+
+  uint64_t d = 1;
+  uint64_t f[5];
+  uint64_t g[5];
+  uint64_t v[4] = { 0, 0, 0, 0 };
+  uint64_t r[4];
+  uint64_t out1_d;
+  uint64_t out2[5], out3[5], out4[4], out5[4];
+
+  fiat_pasta_fp_msat(f);
+  fiat_pasta_fp_set_one(r);
+
+  // divsteps operate on the plain (non-montgomery) value of x
+  fiat_pasta_fp_from_montgomery(g, arg1);
+  g[4] = 0;
+
+  for (size_t i = 0; i < FIAT_PASTA_FP_DIVSTEP_ITERATIONS; i += 2) {
+    fiat_pasta_fp_divstep(&out1_d, out2, out3, out4, out5, d, f, g, v, r);
+    fiat_pasta_fp_divstep(&d, f, g, v, r, out1_d, out2, out3, out4, out5);
+  }
 
-  const bool P_MINUS_2[] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
-  fiat_pasta_fp_pow(out1, arg1, P_MINUS_2, 255);
+  // fix the sign of f = +-1
+  uint64_t h[4];
+  fiat_pasta_fp_opp(h, v);
+  fiat_pasta_fp_selectznz(v, f[4] >> 63, v, h);
+
+  // remove the 2^738 accumulated by the divsteps
+  fiat_pasta_fp_mul(out1, v, precomp);
 }
 
 bool fiat_pasta_fp_equals(const uint64_t x[4], const uint64_t y[4]) {
@@ -2116,22 +2196,169 @@ bool fiat_pasta_fp_equals_one(const uint64_t x[4]) {
   }
 }
 
-int fiat_pasta_fp_legendre(const uint64_t arg1[4]) {
-  uint64_t tmp[4];
+// Legendre symbol by Pornin's optimized binary GCD
+// (https://eprint.iacr.org/2020/972)
+//
+//     Runs the binary GCD on a (canonical) and p, tracking the symbol in
+//     bit 1 of ls: quadratic reciprocity flips it when an odd a < b is
+//     swapped with a = b = 3 mod 4, and each halving of a flips it when
+//     b = 3, 5 mod 8.  The inner loop works on 64-bit approximations
+//     (top 33 and low 31 bits) with packed update factors and applies
+//     them to the full values every 31 steps; its first 29 steps read the
+//     low bits from the approximations (still exact) and the last two
+//     from recomputed low words.  Not constant time.
+
+#define LEGENDRE_FG_OFFSET 0x7FFFFFFF7FFFFFFF
+
+// Unpack f + 2^32 g, with f, g in [-2^31, 2^31), to signed words
+static void legendre_unpack(uint64_t *f, uint64_t *g, uint64_t fg) {
+  fg += LEGENDRE_FG_OFFSET;
+  *f = (fg & 0xFFFFFFFF) - 0x7FFFFFFF;
+  *g = (fg >> 32) - 0x7FFFFFFF;
+}
 
-  fiat_pasta_fp_pow(tmp, arg1, P_MINUS_1_OVER_2, 254);
+// out = |a|.m as 5 words, for m <= 2^31
+static void legendre_mul_small(uint64_t out[5], const uint64_t a[4], const uint64_t m) {
+  uint64_t carry = 0;
+  for (size_t i = 0; i < 4; i++) {
+    const uint64_t lo = (a[i] & 0xFFFFFFFF) * m;
+    const uint64_t hi = (a[i] >> 32) * m;
+    const uint64_t t = lo + carry;
+    const uint64_t u = t + (hi << 32);
+    carry = (hi >> 32) + (t < lo) + (u < t);
+    out[i] = u;
+  }
+  out[4] = carry;
+}
 
-  uint64_t input_non_zero;
-  fiat_pasta_fp_nonzero(&input_non_zero, arg1);
-  if (input_non_zero) {
-    if (fiat_pasta_fp_equals_one(tmp)) {
-      return 1;
+// out = |(a.f + b.g) / 2^31| for signed f, g; returns 1 if it was negative
+static uint64_t legendre_lindiv31abs(uint64_t out[4], const uint64_t a[4], const uint64_t b[4],
+                                     const uint64_t f, const uint64_t g) {
+  const uint64_t fneg = f >> 63, gneg = g >> 63;
+  uint64_t af[5], bg[5], t[5];
+  legendre_mul_small(af, a, fneg ? 0 - f : f);
+  legendre_mul_small(bg, b, gneg ? 0 - g : g);
+
+  // t = (-1)^fneg af + (-1)^gneg bg (mod 2^320)
+  uint64_t carry = fneg, borrow = gneg;
+  for (size_t i = 0; i < 5; i++) {
+    const uint64_t x = (af[i] ^ (0 - fneg)) + carry;
+    carry = (x < carry);
+    const uint64_t y = (bg[i] ^ (0 - gneg)) + borrow;
+    borrow = (y < borrow);
+    t[i] = x + y;
+    carry += (t[i] < x);
+  }
+
+  // Arithmetic shift right by 31, then absolute value
+  const uint64_t neg = t[4] >> 63;
+  uint64_t c = neg;
+  for (size_t i = 0; i < 4; i++) {
+    const uint64_t w = ((t[i] >> 31) | (t[i + 1] << 33)) ^ (0 - neg);
+    out[i] = w + c;
+    c = (out[i] < c);
+  }
+  return neg;
+}
+
+// One binary GCD step: the decisions come from (xa, xb), the symbol
+// updates from the exact low words (la, lb), which are updated alongside
+#define LEGENDRE_STEP(xa, xb, fg0, fg1, la, lb, ls)       \
+  do {                                                    \
+    const uint64_t a_odd = 0 - ((xa) & 1);                \
+    const uint64_t swap = a_odd & (0 - (uint64_t)((xa) < (xb))); \
+    uint64_t t;                                           \
+    (ls) ^= swap & (la) & (lb);                           \
+    t = swap & ((xa) ^ (xb)); (xa) ^= t; (xb) ^= t;       \
+    t = swap & ((fg0) ^ (fg1)); (fg0) ^= t; (fg1) ^= t;   \
+    t = swap & ((la) ^ (lb)); (la) ^= t; (lb) ^= t;       \
+    (xa) -= a_odd & (xb);                                 \
+    (fg0) -= a_odd & (fg1);                               \
+    (la) -= a_odd & (lb);                                 \
+    (xa) >>= 1;                                           \
+    (fg1) <<= 1;                                          \
+    (la) >>= 1;                                           \
+    (ls) ^= ((lb) + 2) >> 1;                              \
+  } while (0)
+
+int fiat_pasta_fp_legendre(const uint64_t arg1[4]) {
+  uint64_t a[4], b[4];
+  fiat_pasta_fp_from_montgomery(a, arg1);
+  if ((a[0] | a[1] | a[2] | a[3]) == 0) {
+    return 0;
+  }
+  b[0] = UINT64_C(0x992d30ed00000001);
+  b[1] = UINT64_C(0x224698fc094cf91b);
+  b[2] = 0;
+  b[3] = UINT64_C(0x4000000000000000);
+
+  // len(a) + len(b) <= 2 * 255 drops by at least 31 per outer iteration
+  uint64_t ls = 0;
+  for (size_t outer = 0; outer < 15; outer++) {
+    // Approximations: exact if both fit in a word, otherwise the top 33
+    // bits (at the common length) and the low 31 bits
+    uint64_t xa, xb;
+    size_t k = 3;
+    while (k > 0 && (a[k] | b[k]) == 0) {
+      k--;
+    }
+    if (k == 0) {
+      xa = a[0];
+      xb = b[0];
     } else {
-      return -1;
+      const uint64_t top = a[k] | b[k];
+      size_t s = 0;
+      while (!(top & (UINT64_C(1) << (63 - s)))) {
+        s++;
+      }
+      uint64_t ta = a[k], tb = b[k];
+      if (s > 0) {
+        ta = (ta << s) | (a[k - 1] >> (64 - s));
+        tb = (tb << s) | (b[k - 1] >> (64 - s));
+      }
+      xa = (ta & 0xFFFFFFFF80000000) | (a[0] & 0x7FFFFFFF);
+      xb = (tb & 0xFFFFFFFF80000000) | (b[0] & 0x7FFFFFFF);
     }
-  } else {
-    return 0;
+
+    // fg0 = f0 + 2^32 g0 = 1, fg1 = f1 + 2^32 g1 = 2^32
+    uint64_t fg0 = 1, fg1 = UINT64_C(1) << 32;
+    for (size_t i = 0; i < 29; i++) {
+      uint64_t la = xa, lb = xb;
+      LEGENDRE_STEP(xa, xb, fg0, fg1, la, lb, ls);
+    }
+
+    // Exact low words for the last two steps
+    uint64_t f0, g0, f1, g1;
+    legendre_unpack(&f0, &g0, fg0);
+    legendre_unpack(&f1, &g1, fg1);
+    uint64_t a0 = (a[0] * f0 + b[0] * g0) >> 29;
+    uint64_t b0 = (a[0] * f1 + b[0] * g1) >> 29;
+    for (size_t i = 0; i < 2; i++) {
+      LEGENDRE_STEP(xa, xb, fg0, fg1, a0, b0, ls);
+    }
+
+    legendre_unpack(&f0, &g0, fg0);
+    legendre_unpack(&f1, &g1, fg1);
+    uint64_t na[4], nb[4];
+    const uint64_t nega = legendre_lindiv31abs(na, a, b, f0, g0);
+    // b very rarely comes out negative; only its absolute value is kept
+    legendre_lindiv31abs(nb, a, b, f1, g1);
+    // (-a/b) = (a/b) * (-1)^((b - 1)/2)
+    ls ^= (0 - nega) & nb[0];
+    for (size_t i = 0; i < 4; i++) {
+      a[i] = na[i];
+      b[i] = nb[i];
+    }
+  }
+
+  // Both values now fit in 45 bits: finish on single words
+  uint64_t xa = a[0], xb = b[0], fg0 = 0, fg1 = 0;
+  for (size_t i = 0; i < 53; i++) {
+    uint64_t la = xa, lb = xb;
+    LEGENDRE_STEP(xa, xb, fg0, fg1, la, lb, ls);
   }
+
+  return (ls & 2) ? -1 : 1;
 }
 
 #include <stdio.h>
@@ -2144,7 +2371,9 @@ void fiat_pasta_fp_print(const uint64_t x[4]) {
     printf("] \n");
 }
 
-bool fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]) {
+// Reference square root: Euler's criterion followed by classic
+// Tonelli-Shanks.  Kept for testing and benchmarking fiat_pasta_fp_sqrt.
+bool fiat_pasta_fp_sqrt_ts(uint64_t x[4], const uint64_t value[4]) {
     // A few assertions to make sure s, t, and nqr are initialized.
 
     if (fiat_pasta_fp_equals_zero(value)) {
@@ -2153,7 +2382,7 @@ bool fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]) {
     }
 
     uint64_t check[4];
-    fiat_pasta_fp_pow(check, value, P_MINUS_1_OVER_2, P_MINUS_1_OVER_2_LEN);
+    fiat_pasta_fp_pow(check, value, P_MINUS_1_OVER_2);
     if (!fiat_pasta_fp_equals_one(check)) {
       return false;
     }
@@ -2166,14 +2395,11 @@ bool fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]) {
     // z = 5^( (p - 1)/2^32 )
     uint64_t z[4] = { 0xa28db849bad6dbf0, 0x9083cd03d3b539df, 0xfba6b9ca9dc8448e, 0x3ec928747b89c6da };
 
-    const bool T_MINUS_ONE_DIV_TWO[] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0};
-    const size_t T_MINUS_ONE_DIV_TWO_LEN = 222;
-
     // w = value^((t - 1) / 2)
     // where
     // t = (p - 1) / 2^32
     uint64_t w[4];
-    fiat_pasta_fp_pow(w, value, T_MINUS_ONE_DIV_TWO, T_MINUS_ONE_DIV_TWO_LEN);
+    fiat_pasta_fp_pow(w, value, T_MINUS_1_OVER_2);
 
     fiat_pasta_fp_mul(x, value, w);
 
@@ -2184,7 +2410,6 @@ bool fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]) {
     // (does not terminate if not a square!)
 
     uint64_t b2m[4];
-    uint64_t tmp[4];
 
     while (! fiat_pasta_fp_equals_one(b))
     {
@@ -2195,8 +2420,7 @@ bool fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]) {
         {
           // looping here
           // b2m = b2m * b2m
-            fiat_pasta_fp_copy(tmp, b2m);
-            fiat_pasta_fp_square(b2m, tmp);
+            fiat_pasta_fp_square(b2m, b2m);
 
             /* invariant: b2m = b^(2^m) after entering this loop */
             m += 1;
@@ -2207,21 +2431,159 @@ bool fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]) {
 
         while (j > 0)
         {
-            fiat_pasta_fp_copy(tmp, w);
-            fiat_pasta_fp_square(w, tmp);
+            fiat_pasta_fp_square(w, w);
             --j;
         } // w = z^2^(v-m-1)
 
         fiat_pasta_fp_square(z, w);
 
-        fiat_pasta_fp_copy(tmp, b);
-        fiat_pasta_fp_mul(b, tmp, z);
-
-        fiat_pasta_fp_copy(tmp, x);
-        fiat_pasta_fp_mul(x, tmp, w);
+        fiat_pasta_fp_mul(b, b, z);
+        fiat_pasta_fp_mul(x, x, w);
 
         v = m;
     }
 
     return true;
 }
+
+// Table-driven square root (Sarkar, https://eprint.iacr.org/2020/1407)
+//
+//     With t = (p - 1) / 2^32 and w = 5^t, u^t lies in the subgroup <w> of
+//     2^32-th roots of unity, say u^t = w^e.  u is a square iff e is even,
+//     and then u^((t + 1) / 2) * w^(-e/2) is a square root.  e is found
+//     8 bits at a time from u^(t * 2^24), u^(t * 2^16), u^(t * 2^8) and
+//     u^t, each first stripped of the digits already known, by looking up
+//     a 2^8-th root of unity (pasta_fp_sqrt_tables.h).  One exponentiation
+//     by (t - 1) / 2 thus replaces Euler's criterion and Tonelli-Shanks.
+//
+//     The constant time variant scans whole tables instead of hashing and
+//     does not return early; the exponent schedule of fiat_pasta_fp_pow
+//     depends only on the (public) exponent.
+
+#define SQRT_DLOG_MASK ((1 << SQRT_DLOG_BITS) - 1)
+
+// k such that y = g^k (g = w^(2^24)); sets *found to 0 if there is none
+static uint32_t sqrt_dlog(uint64_t *found, const uint64_t y[4], const bool constant_time) {
+  if (!constant_time) {
+    size_t h = (size_t)((y[0] * SQRT_DLOG_HASH) >> (64 - SQRT_DLOG_BITS));
+    for (size_t n = 0; n <= SQRT_DLOG_MASK; n++) {
+      const uint16_t k = SQRT_DLOG_INDEX[h];
+      if (k == 0xffff) {
+        break;
+      }
+      if (fiat_pasta_fp_equals(y, SQRT_TABLE[3][(256 - k) & 0xff])) {
+        *found = 1;
+        return k;
+      }
+      h = (h + 1) & SQRT_DLOG_MASK;
+    }
+    *found = 0;
+    return 0;
+  }
+
+  uint64_t k = 0, any = 0;
+  for (uint64_t j = 0; j < 256; j++) {
+    const uint64_t *g = SQRT_TABLE[3][(256 - j) & 0xff];
+    const uint64_t diff = (y[0] ^ g[0]) | (y[1] ^ g[1]) | (y[2] ^ g[2]) | (y[3] ^ g[3]);
+    // mask is all ones iff diff == 0
+    const uint64_t mask = 0 - (((diff | (0 - diff)) >> 63) ^ 1);
+    k |= j & mask;
+    any |= mask & 1;
+  }
+  *found = any;
+  return (uint32_t)k;
+}
+
+// out = SQRT_TABLE[i][k]
+static void sqrt_table_get(uint64_t out[4], const size_t i, const uint32_t k, const bool constant_time) {
+  if (!constant_time) {
+    fiat_pasta_fp_copy(out, SQRT_TABLE[i][k]);
+    return;
+  }
+
+  out[0] = out[1] = out[2] = out[3] = 0;
+  for (uint32_t j = 0; j < 256; j++) {
+    const uint64_t mask = 0 - ((((uint64_t)(j ^ k)) - 1) >> 63);
+    for (size_t l = 0; l < 4; l++) {
+      out[l] |= SQRT_TABLE[i][j][l] & mask;
+    }
+  }
+}
+
+// out = out * SQRT_TABLE[i][k]
+static void sqrt_table_mul(uint64_t out[4], const size_t i, const uint32_t k, const bool constant_time) {
+  uint64_t g[4];
+  sqrt_table_get(g, i, k, constant_time);
+  fiat_pasta_fp_mul(out, out, g);
+}
+
+static bool sqrt_tables(uint64_t x[4], const uint64_t value[4], const bool constant_time) {
+  uint64_t nonzero;
+  fiat_pasta_fp_nonzero(&nonzero, value);
+  if (!constant_time && !nonzero) {
+    x[0] = x[1] = x[2] = x[3] = 0;
+    return true;
+  }
+
+  // v = u^((t - 1)/2), r = u^((t + 1)/2), x3 = u^t, x2 = x3^(2^8), ...
+  uint64_t v[4], r[4], x3[4], x2[4], x1[4], x0[4];
+  fiat_pasta_fp_pow(v, value, T_MINUS_1_OVER_2);
+  fiat_pasta_fp_mul(r, value, v);
+  fiat_pasta_fp_mul(x3, r, v);
+  fiat_pasta_fp_copy(x2, x3);
+  for (size_t i = 0; i < 8; i++) {
+    fiat_pasta_fp_square(x2, x2);
+  }
+  fiat_pasta_fp_copy(x1, x2);
+  for (size_t i = 0; i < 8; i++) {
+    fiat_pasta_fp_square(x1, x1);
+  }
+  fiat_pasta_fp_copy(x0, x1);
+  for (size_t i = 0; i < 8; i++) {
+    fiat_pasta_fp_square(x0, x0);
+  }
+
+  // u^t = w^e with e = e0 + e1 2^8 + e2 2^16 + e3 2^24
+  uint64_t ok, found;
+  const uint32_t e0 = sqrt_dlog(&found, x0, constant_time);
+  ok = found & ((e0 & 1) ^ 1);   // u is a square iff e is even
+  if (!constant_time && !ok) {
+    return false;
+  }
+
+  sqrt_table_mul(x1, 2, e0, constant_time);
+  const uint32_t e1 = sqrt_dlog(&found, x1, constant_time);
+  ok &= found;
+
+  sqrt_table_mul(x2, 1, e0, constant_time);
+  sqrt_table_mul(x2, 2, e1, constant_time);
+  const uint32_t e2 = sqrt_dlog(&found, x2, constant_time);
+  ok &= found;
+
+  sqrt_table_mul(x3, 0, e0, constant_time);
+  sqrt_table_mul(x3, 1, e1, constant_time);
+  sqrt_table_mul(x3, 2, e2, constant_time);
+  const uint32_t e3 = sqrt_dlog(&found, x3, constant_time);
+  ok &= found;
+
+  // x = u^((t + 1)/2) * w^(-e/2)
+  const uint32_t h = (e0 | (e1 << 8) | (e2 << 16) | (e3 << 24)) >> 1;
+  sqrt_table_mul(r, 0, h & 0xff, constant_time);
+  sqrt_table_mul(r, 1, (h >> 8) & 0xff, constant_time);
+  sqrt_table_mul(r, 2, (h >> 16) & 0xff, constant_time);
+  sqrt_table_mul(r, 3, h >> 24, constant_time);
+  fiat_pasta_fp_copy(x, r);
+
+  // zero is a square (and r = 0)
+  return (ok | (((nonzero | (0 - nonzero)) >> 63) ^ 1)) != 0;
+}
+
+// x = sqrt(value); returns false (x unspecified) if value is not a square
+bool fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]) {
+  return sqrt_tables(x, value, false);
+}
+
+// As fiat_pasta_fp_sqrt, in time independent of value
+bool fiat_pasta_fp_sqrt_ct(uint64_t x[4], const uint64_t value[4]) {
+  return sqrt_tables(x, value, true);
+}
@@ -0,0 +1,1111 @@
+// pasta_fp_sqrt_tables.c - roots of unity for the table-driven Fp square root
+//
+//    These constants were generated by sqrt_tables_gen.c
+//    Generate: make sqrt_tables
+//    Do not edit this file
+//
+//    Longest probe sequence of SQRT_DLOG_INDEX: 7
+
+#include "pasta_fp_sqrt_tables.h"
+
+const uint64_t SQRT_TABLE[4][256][4] = {
+    {
+        { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+        { 0x5cfe5f67cb155442, 0x176460c2734c4621, 0xdf81001645214110, 0x18047fb9f91068bc },
+        { 0x39ae11c799b36804, 0x5ada0798d938cab2, 0x8f16455f3116ae8e, 0x01d36527da74de40 },
+        { 0xb8b5e728c85f6490, 0x385c9bc8c19ca21b, 0xad3665038889aba9, 0x1d22781a637a3518 },
+        { 0xbfa8482d7f4f7bc6, 0x79a15ad32a10a3b9, 0x724636160e332ebf, 0x02bdac2fc039aefb },
+        { 0x135cefaba2ff266c, 0x6c417cf6bc0fe551, 0xa654461290ccf6c6, 0x2afde1d50d6a720c },
+        { 0x61fa6ee2317bd716, 0x08d6e8dcebb09b2b, 0x6b6571bd60e0dd19, 0x30a11e17b28881f7 },
+        { 0xf2e0dca121e977f9, 0x12f577094151e612, 0x02447f37798186c7, 0x1990be429ea720b2 },
+        { 0x00571ac525be8d97, 0x4363960a6c2ab600, 0xef8565113262de6d, 0x3bbb2f06f5e05bc5 },
+        { 0x6ff9d9151580fa84, 0xa09547bb827b69e4, 0x2a8d21921171174c, 0x35b363f07f7a52e3 },
+        { 0xdf7ff875167169b3, 0x3e15f2547c09046d, 0x7852e821b5e702f6, 0x214b183c9d66f8db },
+        { 0x01ddb327197b6bc7, 0xaf0e87e51de71f74, 0x65e1a34a6e2fe1af, 0x10e2ee310e0fbd85 },
+        { 0x66eb9858531f05e3, 0x808f69ba731480d9, 0x411c23542633342b, 0x23142ea047a74736 },
+        { 0x6adea6b08f4dcb9a, 0xc2a4bced1f49e2af, 0x9414dc5d66125734, 0x3659ca11a5605582 },
+        { 0xa9204c771e457f8b, 0x57b3c80c93626362, 0xcd7d96129b118495, 0x113aaec928a2b3da },
+        { 0xc4ed6098b9558f50, 0xa969906a0c5fd273, 0xee7b7076902d73aa, 0x363273ead2e6cb51 },
+        { 0xd020fa666ff53916, 0x0340cdd6acffbdbd, 0x055bf888f38bb742, 0x1c6ac32cbcf9e95f },
+        { 0xed94acf3b92255d1, 0xda27b413b21e1d37, 0x9eabc0eea78b6ea7, 0x32313bf989a3fe88 },
+        { 0x772cec1a40d739a4, 0xf494fca00b04de45, 0x5006513954d0a1fd, 0x201d05b3194c5931 },
+        { 0xdc4ab5a9a227e3dd, 0x8980769b849d2e02, 0xa756d8f453e7196e, 0x372288e21273ddb5 },
+        { 0xb95f03f29dbb8569, 0x5b8aff3f2c1c3f67, 0xbf4e2122fd5f5553, 0x1b95c6bae8798c94 },
+        { 0x757eff28e53d02b0, 0x1718155876ea7a39, 0x1b33573a43795459, 0x05e7afdaa1694c8d },
+        { 0x5c57b70baf47105e, 0x27645c1f47923656, 0xeda028aad8142a27, 0x36601be3cd57b462 },
+        { 0x6b6c00826ff66b5b, 0x2f3da91424b54a74, 0xcd94702e6091291e, 0x0c3074ab775dcf31 },
+        { 0x7c0ec13df0dc8855, 0xe3e2dea65db1a859, 0xda2611108556538a, 0x106f3488a3961971 },
+        { 0x9024d5db2dc4b638, 0x2f56685323fbd458, 0xea42ba342cc01554, 0x1927f05c1af5a886 },
+        { 0x079ee20249c0191a, 0xcedc0c80901aef6e, 0x21948db5f9239a69, 0x0eb35f10bc072ede },
+        { 0x60042b8f068396df, 0xcc36cb7f1d42e41e, 0xbfa77f1e188881c0, 0x280999136e37a147 },
+        { 0xf1c411d28d07cf74, 0xe7e516ab88956931, 0x3f52e7238d8d1b8c, 0x1fa0632292e84dc0 },
+        { 0x618b5d347b905b9e, 0x1c31ea9d51f2b01f, 0x8eab407f5962c4bb, 0x049b7245f66c83f5 },
+        { 0xc60cf7f1f6016b0b, 0x1185a228ed147f99, 0x650f1f97f3deb30f, 0x1e7c536689ff7f2d },
+        { 0x6c76682615fa04a9, 0xcf676e3dc32a2ce6, 0x55248687ee72d811, 0x2daf009e97544def },
+        { 0xa79987b9f64ac99f, 0x9220f0a4645760fc, 0x0b72c1b6797419ad, 0x0a69932addf80267 },
+        { 0x36f5cb26459b010a, 0xb71587752805b827, 0xba14a36e58256a4e, 0x3c2dbb675a34935d },
+        { 0xbd24f15eda5ecb79, 0x2ece51881f5300af, 0x88b201255a81924e, 0x1f36674180b9c76d },
+        { 0x1072e48dabd4744c, 0x229eae558b16d457, 0x9c62ac990a065680, 0x38959219adab2742 },
+        { 0xeb29c56e09a5d08c, 0x745e42e897086853, 0xe42ea60cb38d9252, 0x27be47d95fd792a5 },
+        { 0x8afd3f637eb07266, 0x61b3b3eaa3ec8512, 0x2bb42c19caff4858, 0x1e69f1d171325388 },
+        { 0x776664826c6933d0, 0x8ad10a600f50d42c, 0xbb0cd948dd761447, 0x1c5c83a0ea413a86 },
+        { 0xe4a98188e1622f99, 0xa084ec5bf2d69a5a, 0x4476c04c9a9a67b1, 0x144efec97173597c },
+        { 0x21f3bb99b654920b, 0x4ded366f3bcbf89c, 0x91ebc2c7b3897f4a, 0x3b86d4ae330ddcde },
+        { 0xfe52fef3eaa56e64, 0x971768a7fc416071, 0xd02023a906b4a8ef, 0x238e734bc5559ee9 },
+        { 0xf7963212bda0b600, 0x99747fd432bee02a, 0xe7ab893829e54bf1, 0x3c752df6638c22d9 },
+        { 0xbccb9d1af88b8497, 0xa87905198dd048be, 0x0adf5b320a5ed062, 0x2cb563f35a7d3805 },
+        { 0x128fc181a6564801, 0x7d1dd32f53f67249, 0x86c9d3db174ac187, 0x2abfddcb4c2541fb },
+        { 0x5deaae121cbca937, 0xb7466801f5ba0381, 0x79b0348e469baccf, 0x25735bdfd935edf0 },
+        { 0xece06339fc494ad2, 0x1f39d31285055dfd, 0xcd1fc22704108643, 0x12e9204d5738dc20 },
+        { 0x96ce24493aef8a9f, 0x48d3058fb82329c8, 0xdafea5f9a0066542, 0x0769e0038c87407e },
+        { 0x6919bf3460cd937f, 0x7a73df9f163e8829, 0x529ad87b7ea92f48, 0x1ba3d8c6f0c40d4a },
+        { 0xf1e0ae1a4ccb59a8, 0x8bc9c4807dd2500c, 0x6791c925abbe8915, 0x15faf7c0516cd591 },
+        { 0x66419285fc29d7e4, 0x25dfb7bc4795bb39, 0x27c4ce5ccd8c38e2, 0x274e2c02c875c4f4 },
+        { 0xf9b9cd6b00f428f7, 0x7602041ffd44e076, 0x6dd4444379c69a00, 0x318dfd6bb99e9b1c },
+        { 0x247026ff73f08791, 0x76768af696830eaf, 0x96934b1e264774c3, 0x1ad8484147d804b3 },
+        { 0xedc0888bcc338c63, 0x87271b68e6635083, 0x24ea244bef0d938b, 0x38e9682553611058 },
+        { 0x32fba19d895e8202, 0xc14e77a6a6232b90, 0xe37da65768a77a10, 0x23976db12794e323 },
+        { 0xb1302a1e1c8b0f37, 0xa6fcb84954cfb6d6, 0xe74e2c6bce898da5, 0x035061cf9700362c },
+        { 0x7e2c9db24338c125, 0xd01abe3c6f406132, 0x97565909ebf8181b, 0x07d330db8fa18f93 },
+        { 0x209e6e2e1d7930f3, 0xd98963b224ae1c4b, 0x43c4fdb5a0afc6fc, 0x016637f6dad74e14 },
+        { 0xc3700ee15600ce4c, 0xf46001a056091dc3, 0x656f562bfe938b50, 0x3ace83f3184b8ac7 },
+        { 0x3e2988f2136b8111, 0xdbe2f9146d54a3a2, 0xd8daa3cdbbe331e0, 0x0bce7dd11e3929e6 },
+        { 0xc48af3886f6a61fe, 0x6a39fe4892ef34d6, 0xb15966d307fea62a, 0x1f51c571cf208327 },
+        { 0x597e7504d2aa3d89, 0x599b44bdd0a49141, 0xaac8d132303c44a6, 0x1b0d58030c16461e },
+        { 0x03a3cd07ee31fb02, 0xebdb942f5fa62e78, 0xa29f37309f2f6722, 0x337d31b79a4da99e },
+        { 0x5bfa13764f1ccb2f, 0x9dd71aed71fd270d, 0x4083f14528bf9855, 0x290909da179f5630 },
+        { 0x58f143c945f74cfe, 0xdda26b6b8eb66b9a, 0x070b3c12119f4f70, 0x32ed3eb2b92f5667 },
+        { 0x967d01c7e4e49334, 0xcf47cbb102d11b15, 0xfd1f966b352516e0, 0x1ed9f5f53892fe5d },
+        { 0xa01d1d415dbd607d, 0x4ab4366e9b7b7788, 0xa0c2278937ec56d3, 0x22fa7433798b48e0 },
+        { 0xf4b64b9fbc154f9f, 0x4e95a7883df5e870, 0x86d6c2db296322f0, 0x092ca1804284394c },
+        { 0x4a97766895f7359e, 0x2226eb54e40108f0, 0xfd898afda1886ca9, 0x39f54932eadb31d6 },
+        { 0x76e6fbeb15b7ec4a, 0xce85a9a34ecef429, 0x9f86c9d6cccec42a, 0x3fe16ebdb63caf15 },
+        { 0xbaf0fdd97e96f67a, 0x8afd426015a5fbea, 0x92e685202e729902, 0x06ff70878d7b10aa },
+        { 0xcc7567585fa9e22c, 0x94f680683fef6e66, 0x1ef7cde822e60259, 0x0c40bcfec04eeee6 },
+        { 0xc5f7b934dfdb7c3c, 0xd4adee79fde19724, 0xb6c361b18e9f270e, 0x29d5abed9eeedf2e },
+        { 0xcce2e71c0bf3f316, 0xbb369e55029e74b2, 0xded6ec71ba4c99ca, 0x1eec89a6ca6bdeef },
+        { 0x6572d598ac309b33, 0x42a4d3c0adaf4a33, 0x1341b81db9d4c68c, 0x3f5f1b154e8788a7 },
+        { 0xb724d8023f2f275c, 0x8760a9383e9356fd, 0xdac40ed357cb81ab, 0x02284ec0a78fe8b2 },
+        { 0x62c6a81fd90c8a63, 0xa7293ac87f950dd7, 0xc46e182091662dd2, 0x22a01c0f27f6665b },
+        { 0xc20fdd10d79c8062, 0xa79db4ee17bc0d2a, 0x407537b1704079a9, 0x0eb0c891686d76ef },
+        { 0x4c727b911b750e70, 0xd6d5c9a7210a4f89, 0x7d7f76d6e8c3c115, 0x013466329f9c98b5 },
+        { 0x1c3a848c445bdeb4, 0xf8b2bc23862ddce4, 0x4113a444a9087268, 0x24bcc0e82df5a30f },
+        { 0x6f7b0cdfe93f4d8f, 0x7216d8fe2914eb94, 0x94e45b78c1838943, 0x06fd76d1ab4c434d },
+        { 0xc454fb940fb46459, 0x2d0b305f9833982d, 0x49933a1d3c263b22, 0x157d2b9e01baf7af },
+        { 0x9630ad84da26f490, 0xfa5bfb1a91fc3542, 0x4aa4ede92e102c19, 0x152b70cc7e34d36d },
+        { 0x3d8229f5f5fadd19, 0xfe248392c1e81d37, 0xe17e517aee1d413b, 0x29e6c0398a510065 },
+        { 0x34e0abd63a078f56, 0xae56edbcf59183d3, 0x8a339a3dba47d8c3, 0x007248cee9e6b241 },
+        { 0xce60edb630ab8f47, 0x6e2af1a715f749dd, 0xd8731d9a3b17cdf4, 0x34b67d5491fe4f3c },
+        { 0x4a859f5239b7e16d, 0xf3c53d3e64a81465, 0xc9eb0e92bc255ff9, 0x3eb38db279fabea2 },
+        { 0x2dae0ad9bf75f402, 0x963b28a0a3628d0c, 0x2664933103dd5f55, 0x136a6bc65a0afb60 },
+        { 0x50130b9ce9948312, 0x90616b16f48600ee, 0x94ef0bb603270497, 0x00e886e9420166f1 },
+        { 0xfc7b9152870e3cdb, 0xb68d4fa2407214e4, 0x3b37860906236493, 0x3b0cdb5fa7ae6402 },
+        { 0x99f596906b4a4b96, 0x997e801c3a231e24, 0xde4872e2493ff4ea, 0x10b6239c3b32370c },
+        { 0x2f4a51bd995e0aaa, 0xbaad361493bf5506, 0x4710063ec99c0d3b, 0x150b5f750bcf88b8 },
+        { 0xd136af5d8d30dcfa, 0x516ca1a27d6fcc72, 0xb90a9ae5612e4b68, 0x3f6b449942005137 },
+        { 0x6fada0d06d446a86, 0x25796d064aa90b71, 0x179ba9f4e28f4d63, 0x19ec0f7b81d97107 },
+        { 0x7cf125374772bc47, 0x5cf7abead6d85694, 0xcb45c91c8c4a1620, 0x365396d90225da9f },
+        { 0x90234af2820b155d, 0xb7bf86ea844a918f, 0xc51e94a3720d158b, 0x175662cfc530dce3 },
+        { 0xa29ea76e8ce31401, 0x75522b75ab4fc90d, 0x29807ff962cff7c5, 0x3b441dc4b716f12a },
+        { 0xfb480dcec1efcca2, 0x2da148381b025362, 0xabf008f809c64c6b, 0x38eb221cbc88c156 },
+        { 0xffd36840437a4efc, 0x926bd1f44bfabc60, 0xf7a7f6850e57c672, 0x146ef90cb60a7269 },
+        { 0xe9cf1df4276c1114, 0xc6dc325b1f0a50f3, 0x262e49aba15b2c17, 0x140e7742b00046ff },
+        { 0x34d05b8e3f466c08, 0xb818999d4969f15f, 0x1a1004efe6037555, 0x04749327976c556f },
+        { 0xe33af26d7184f729, 0xbb5d3cf09e8a9c35, 0x3250d7614b375922, 0x10787ba85eaeb777 },
+        { 0x097ad8a2ab8e4138, 0x33b78842725bdde1, 0x883f9c212b510240, 0x36e5fec888f86fc4 },
+        { 0x5a8bbb75ca7959c7, 0x278c2614248a0923, 0x8423c3e480df3cc4, 0x21fc9eb946db5f8b },
+        { 0x05cb2d5827e5b096, 0x348459ef51eec69f, 0xcd42041cf3ce3076, 0x0d4fcc02b2fa1c6b },
+        { 0x62dec484cb3773df, 0x22660c4e774a45b0, 0x2fe1536c21fbf134, 0x1c0a64024257d806 },
+        { 0xbac7843566c48418, 0x08ece718a688b88c, 0xcaf2ab6fff58dd95, 0x2372fcaddc187dfb },
+        { 0x57e468ac0e567522, 0xc0f6163b86de68e8, 0xeb6dbaf028955dd0, 0x0f19c3dfab213da2 },
+        { 0xf1e31f0eb4f40d12, 0xab7367a62c48d560, 0x9e5b2a6d50597d30, 0x2df4b7e2cbb5e8bd },
+        { 0x9e76c93376a8e3da, 0xe61d8f10be9919bf, 0xf351dbef44eeac76, 0x162f1bd3e25fc235 },
+        { 0x653cce4671a31a25, 0x32e0b8dd1c2c84b5, 0x84dde3b7d3343eb1, 0x2743def532568fa9 },
+        { 0x3686789bd31ad802, 0xa20df941dc4fb2bf, 0x107f7095f896997a, 0x37538662fce293ff },
+        { 0xc28a364e3006c70b, 0x2405fb40b6e87603, 0xfe46e81e76d41058, 0x1661741cd14a6d73 },
+        { 0x4c76f31c53e33bba, 0xc84a531ca45eb032, 0x8438e386eda54e48, 0x26c0968a31b20b5c },
+        { 0x137468ea335d44e3, 0x628bbc3c57f361ff, 0xa585fe100efe7396, 0x019b3cd34462ee59 },
+        { 0x9d85cfd7df715524, 0x12b1aebeca767417, 0x33f4fec601e30d1b, 0x0b28e6872bb513bc },
+        { 0xaf5fee7ff5675f4d, 0x478c2b8e90293213, 0x82857bc62763c528, 0x3adc188532002fa6 },
+        { 0x89a1e07ab6ff3016, 0x6a262666cc3a088c, 0xa9e0c3061ad4137a, 0x0cee09cda2ed60a2 },
+        { 0x5cd375ded8d3b78d, 0x5845f6f307e32b2f, 0x0f8230c9da5b1e7f, 0x2d759ab21782b3fc },
+        { 0x088fca9c2f2adb23, 0x359f0572ee14fb2b, 0x42bd434452ae7e67, 0x364ec1c9de0bb529 },
+        { 0x9d44da0944f74819, 0x1c7e8d01b0a3e811, 0xb6c5515b71ab80f7, 0x0c26a6de9f782d1c },
+        { 0x59c47a8cedd3aec5, 0x466bd619dbd7fb0d, 0xd0bde6af8728d96a, 0x0fc59b8d758763b0 },
+        { 0x05221ffebce48546, 0x09234469cdf460ac, 0xb61dc5a34e551be4, 0x0893d7ec2c1149c7 },
+        { 0xce8a819dd5554b3f, 0xeff6b61b93db1033, 0x7d26ac444a6e46de, 0x0965eda4b74c803a },
+        { 0x14292037dd06f178, 0x140cda5f5f28c498, 0x750bae9b29bd81d7, 0x1ae0306ecd838e62 },
+        { 0x4e32af7002a57955, 0x71841b5db88a11a5, 0xa229ff96245e5bdc, 0x3447a3974d53c8f9 },
+        { 0xf010df1c21eb9ba1, 0xf6a733dae3e07b2a, 0x3ce34d903879c585, 0x352a962d444c5b07 },
+        { 0x4b39544b1e29f8f4, 0x6c05fcad481364ee, 0x2562154bcd3edaf5, 0x0c7fc12f3ce179c5 },
+        { 0x5201c47cb901fd70, 0x9a2a69e40cb56518, 0x04f91ba827baf510, 0x2a2fb12100e13050 },
+        { 0x2caad2a3cf7db49f, 0x1edc50249c05f1e5, 0x27f685e274d2da28, 0x11df97bd8278f134 },
+        { 0x92c4c134b1d62357, 0xcdf2e9f080b21de7, 0x964a703e955d4c88, 0x14937d7c81a9e73c },
+        { 0x6007d684937962d1, 0x8f980854889c4f88, 0xe52ce2171f01fada, 0x18f1cfa10aec970d },
+        { 0x0f26beac6f23e4c3, 0xa180544c2444a7e1, 0x536d78e948043430, 0x2734f42424a16275 },
+        { 0xa9834a28948b3e48, 0xa256c0188d4f3c1c, 0x8f395cfecb14faac, 0x1d922eac35f61670 },
+        { 0xa270aaf1bddc3596, 0x305bdfaef05bc409, 0xac9a836a16178fc5, 0x1f42c9ce2408bf24 },
+        { 0x512810e907a254dd, 0x4b23912e7d5397fe, 0xf910b59a3d0afc40, 0x2aae0fa8caf05a58 },
+        { 0x3648a547bd1a69f2, 0xd7d7f2e2f66461af, 0x2285a6640451e1c6, 0x0ac801259074a80e },
+        { 0x1413725024fbdd61, 0xbe253727fe7be3d1, 0x390d99f758926e9d, 0x3c78849c15b5dd90 },
+        { 0xa28d00bedf2ff893, 0x66109664885178c9, 0xd6bd5d6aca94bb3f, 0x0786d34fc51e1ca6 },
+        { 0xf296fd9b0824e791, 0xcbb313049d48d775, 0x0dbc02cf0c9e2396, 0x2c2a961569e30f8f },
+        { 0x67d7cd1279bcce27, 0xb2b0ff68ddd19832, 0x932e8101a4826801, 0x2ade00bfa54c8571 },
+        { 0x80345c04b098e07f, 0xecafad2ba4c92a12, 0xbe4000f39ec0e867, 0x1f0ba4d2f82ebd62 },
+        { 0x41879a413d22e186, 0x2d4589d6af8b1c88, 0xc88077f3f354fea1, 0x1b4d056b824ab5f1 },
+        { 0xc6cd067f6a56874c, 0x87beba0adb92d4b2, 0xf7fde9fea0738927, 0x083b5b1e3d3e5a8b },
+        { 0xc82be7621fb45800, 0xabedf9fb3769235d, 0xf4f0a3d8aefbc003, 0x3ceb8815d3e81af7 },
+        { 0x849a957a124f8b46, 0xbbd5459300924cc9, 0x02edf45012d219fc, 0x3a241fe6943bfd80 },
+        { 0x4a3c4a15655c9a25, 0x6387ce9c2d7ab859, 0x72181d182950399f, 0x15e68dac39bd5390 },
+        { 0x406979d025d64dc2, 0x0dda2614ad0d42fd, 0xfded8469f3e33c3a, 0x3a185acbcaa50de8 },
+        { 0x285e05c8726525b7, 0x21be87e6a6a703cf, 0x913aa5e84bd0572a, 0x065debf683d431ab },
+        { 0xad3bc1fd8cc8ef84, 0xb97db0558b4610bd, 0x37a2f949d7a52cb1, 0x2fb5288185a25e03 },
+        { 0x8d93ca9d1737a12a, 0xd8aaf81ec27577d7, 0x856d286818f92f08, 0x07365cdc9c9882bf },
+        { 0xf04adc2c07d26759, 0x14ed7373019c3e3c, 0x9910a2df2ce47872, 0x305ae15a98e6baaf },
+        { 0xfef661ac8cc1ef8e, 0x09e838b1ce1c47e8, 0x298de167766f7bac, 0x2de719ae6db60d6a },
+        { 0x744a0e7c897808d9, 0x5387d9f22b8b3b03, 0xbe035b7409286163, 0x2a2ac6c691ae9985 },
+        { 0xeb581195a8ffd7cf, 0xd7cf915bf3181c03, 0xa5c95b11c03b26ae, 0x276ab92d1f6e1f52 },
+        { 0x1349a605dfe11bc8, 0xf230d514b5009841, 0x8a5da5fb206b84fa, 0x0a2051016c0e92f8 },
+        { 0xf068e7caa26be3cf, 0x05f14ef4fb222ba7, 0x5cdf2cf1821c26fd, 0x13d6d7fdb8429a79 },
+        { 0x1f59ee9972f1692b, 0xecf77c6eba5b839d, 0x4a4621a3fadd2530, 0x17e8a89fb65b690b },
+        { 0x0ec742504ffd74df, 0xb0b44ca328acf028, 0xfc63c5696b890991, 0x0ed2b09d1eaa8dfe },
+        { 0xa1c1853d315c3294, 0xfcb5b8a722981acc, 0x8b4ad4482492526c, 0x163cf7ea21c8f872 },
+        { 0x67a2e87fbdba265b, 0x60dcf7675556f2d0, 0xa02ae8e7a336d33f, 0x3c4701fe9594f62f },
+        { 0xb445680b8de999e0, 0x3b207f0824038663, 0x99aa61073a424b2b, 0x375508063ffe5752 },
+        { 0xe4d9a637e1dc30da, 0xd5278aff91fb13ea, 0xb076706f6eaee10a, 0x2e068ac2dcb8e1a6 },
+        { 0xce6430426b4fc9a2, 0xe219a11b0f4b4b0a, 0x5d470c32d0c8ec13, 0x1c93f63b3c1d080c },
+        { 0xa73918078979e997, 0xfae793fdd9c39f88, 0xad6a044a08087ecd, 0x0a2b52259f2ade8e },
+        { 0x78c1afcdb6f16467, 0x2e5948071262126d, 0xa8713639ad805a30, 0x2c67ca078439a695 },
+        { 0x5969c2266d51735d, 0x1016c1ccc00c354e, 0x3197ace158c473cc, 0x0fe063e08de932d5 },
+        { 0xc7d870646fbb99c7, 0x3e656a22f5c3f0e7, 0x063940ce07b77352, 0x0f622be4067ce8d8 },
+        { 0xa402e7057a94cf9b, 0x82893678e888db8e, 0xf8942c77a7097daa, 0x1a826378aac94b75 },
+        { 0xef842aaa536aa648, 0xe6c6f4e182926bb6, 0x2cb77a4901b1f261, 0x15d3fd4c8c763bbd },
+        { 0x05d348654d05ed06, 0x1c2242963b1dd40f, 0xd1527202b571c0f5, 0x2e67222fe3bcc783 },
+        { 0x15da83eb58e97ae5, 0xc98617bbc3b6ee29, 0xac22b6375afe4377, 0x2446bea584ab34ec },
+        { 0x7092fc13f6f0358b, 0xd3742f385ccb5ecf, 0xb3f48985ce094af3, 0x146e96438e90ab0c },
+        { 0xa238d73db152a35d, 0x85c5a2e07ecf04c9, 0x714c11a6e49adc9f, 0x15c388f9b503862e },
+        { 0x82d0f027ff47338c, 0x98381c7e3e63dfa8, 0x426411510837a468, 0x29ce01d5c1f9af8e },
+        { 0x2a97daab1d7d0ae3, 0x5f330384a9703d56, 0x2f6434613c65f401, 0x17472bfc08a1c194 },
+        { 0x400aab2d22c500f4, 0x31797a5b1b84b322, 0xdbf6c3e34961de00, 0x070bea4ff7a17738 },
+        { 0x65ce5cc75572aa75, 0xa6c538384a2ac4bd, 0x4ae899ac836adb6b, 0x2879704be129a7d7 },
+        { 0xff0bf4189c6e6f33, 0xbf71d4258f352fce, 0xae2946d388bade05, 0x1da5c48a8c76f521 },
+        { 0xdc11186fdd871ffd, 0x932cbe6babe8cab2, 0xf1236e679ff3f58f, 0x0f0edf48f5a6dc03 },
+        { 0x489a12d4af5aeb10, 0xb1308e04f3b0f7a1, 0xbb62264aea62aa6c, 0x2be3d78ae8b29b7b },
+        { 0x15fde41535e9c14d, 0xc06229d812494f1e, 0x73c59ca6bb495d8d, 0x17dc0f981b76b2c8 },
+        { 0x24700de2a6e0ed5c, 0x44ba87a5185c224e, 0x2bfb3601d64c9f54, 0x0ea8f3009e9d3b9b },
+        { 0x40cd5eb18f226dfa, 0x3ed32ae5fb0c7fe4, 0x878eb4e425c66ae0, 0x14f0fcc30c0db9a4 },
+        { 0x28a9fa2e31fe962e, 0x746b023c7e4212aa, 0x6b26d211af6dca7a, 0x33a829374aa38f65 },
+        { 0xd44e345e5e7a4b42, 0xf23b7512d59592c3, 0x40b9b3983344f37c, 0x34846a3628775406 },
+        { 0x9c5c00db5eb7da81, 0x3576298e9703e3ff, 0x0b8ef43f9ee60d37, 0x096729d490f7dfc3 },
+        { 0xe2f67f4656911cdb, 0x290e4111c1bcdde6, 0x949e50b6dbfc33c0, 0x31338ef47da79001 },
+        { 0x2c75affbd6d96995, 0x553744f687651e3c, 0xec272f5f0605248f, 0x2894528178756653 },
+        { 0x7fdfa8240628a50e, 0x37e4b7fb6c765d81, 0x46ecd59ef1b46915, 0x1079f9040fc8021e },
+        { 0x575bd28fc066082f, 0xc1ebac66d290408a, 0xb8c8a9e3e0dd8217, 0x00c9212d77e04704 },
+        { 0xe14889c9c5b1155c, 0x1d5918438763ce0b, 0xce77aa1f7e638e40, 0x2dc46a9237fe4b1d },
+        { 0xba7f8b14484872d8, 0x018652cf27a662d2, 0x3cd1c7e952d8fe73, 0x027cb60a9dae12f4 },
+        { 0xe43250f7e31537b4, 0x5622a78ed57764a3, 0x8e11b67523c2b708, 0x05d84e8ed4d87834 },
+        { 0xf32c5f5e3a7d57e0, 0xa25fa963cff33d06, 0x5aff28c2e1637648, 0x157e4bbdec228580 },
+        { 0x2cd756e12e00298a, 0xaf9d4db3430e4300, 0x22b6fd9425b131b8, 0x2308835cf59361a7 },
+        { 0x32669dd4dace29fe, 0xca1db026a1d1367b, 0xc2a5648c149bc276, 0x0576c3279b2ac18b },
+        { 0xabe37e7dc8d5301c, 0x2d0d7fad14241d3a, 0xa165621e3f711ba3, 0x227f35c772939b31 },
+        { 0x1c3931d614d6ed7e, 0xd1c1759c9f6b43ef, 0x6a5e3bed29219883, 0x24d81916c076ef7d },
+        { 0xecc48768ea3f68cb, 0x80a9ffaf76b8720a, 0x5ec09a51e8e1bc99, 0x099cf0049720583b },
+        { 0x0c92b3c4465fbdfe, 0x329c5352490f4ff6, 0x7d2029dab7c69c93, 0x0818a6ea58374ddb },
+        { 0xff91dd3df2759f7c, 0x9269bfbbb40b3023, 0x6fb5fdbba2cf6f56, 0x03084804d93d08ca },
+        { 0x77f6a5b0718cfaa0, 0xc6bb4ec6c2ba3ca9, 0x4b364c57425826d0, 0x011e9111115df908 },
+        { 0x789c235ae34c4ab8, 0xb12f68d42db79e9c, 0x4ffc9b0974604563, 0x307bedee014de6db },
+        { 0x2686c7698c46de26, 0x7792f12533062a02, 0xd38596c7a626b8b0, 0x1a57cf775af0f30c },
+        { 0x3cc2c094ef31dec1, 0x290d252de2a2482b, 0x38cb839b9ed36480, 0x058b1b2605c75e4e },
+        { 0xcb527dfeedce7bd5, 0xc1e82081da02ae5f, 0x6fb019f9d0e701fd, 0x0d44afed39df1aef },
+        { 0xf4326d03907cc2f7, 0x6ff9b4f49ce6b875, 0x336c647dba81a645, 0x13d43f4a7a4e70f6 },
+        { 0x7729c8e04ef228aa, 0x08a8268b4265af99, 0x2c8d1f2090197e45, 0x0c71db06c8afef81 },
+        { 0x44a1908281bcdaa6, 0x8f0844d6198c4016, 0x5edb1b175c894250, 0x3429005b85626b49 },
+        { 0x3a3524ed4480f58b, 0xbcd4a180e74d24aa, 0xbc90beaed6dc3863, 0x21ae93da7ca6f3c9 },
+        { 0x4b1036e2e1cfc1f3, 0xc791d6f2b4d87d27, 0xa2185fa398c237f0, 0x08dcea5053771ff6 },
+        { 0x4672d3a9e6132fe6, 0x5a90974b2ddc8a38, 0x4b9d1b5a83a92496, 0x1fd6fa10f2636c71 },
+        { 0x880a52e4fc06b36e, 0xdd09e05f9c46793c, 0x423a6117fe78ac62, 0x0dea9fb721d7adf3 },
+        { 0x514f538678b376d8, 0xbf9b79fb28a1b78b, 0xf6eab88f5338d666, 0x0db0ba754849ee0c },
+        { 0x2c5d9f2a3d03dce8, 0x8ca64c93ba4ee4ca, 0xeeb4f93bef7f94f9, 0x2974a55cabe21c27 },
+        { 0x9b44d0d277fce85e, 0x9153edc4741afc38, 0x3198c7d2ad24357a, 0x1c6946225d8d79d1 },
+        { 0x4724084653e079e2, 0x06105f2ef5f16e73, 0xa1445650d9c3d00a, 0x2a9057c9ec6cf951 },
+        { 0x8367c612757243f6, 0x92e14c7c30c9fe65, 0x9d0da7d654bb8719, 0x0b8b12d964eeeede },
+        { 0x8b84a9bcac6ddd8c, 0xcbdc8ce94aea15cf, 0x40220fde97445993, 0x267fa4fdbfc97c86 },
+        { 0xc907b4e68a6c1ae8, 0x73a48404d308de39, 0xd965f5487e1ded7e, 0x3f111defc1df8d41 },
+        { 0xf5acb2422eaba54d, 0x5177b089c98398d0, 0xc12cf8dd734a0f8d, 0x3de9aeb0ad56e1b7 },
+        { 0x4f348aba3fc596c9, 0xfe45459121830dea, 0x17e2b6a54f8fce55, 0x3e995f2352564106 },
+        { 0x06e2ec22fff5cacb, 0x4dabb9cdb4fdc094, 0x04a3e327e6dcbdcb, 0x093d7e0ef341b1fc },
+        { 0x9601adfb47dc3064, 0xc511fcc075df0302, 0x421107b8bf05a54d, 0x08c80086ae249aad },
+        { 0x12ad90071605fb5d, 0xfc823c13fe201170, 0x67cdcae77d4a16c5, 0x048070c602caf469 },
+        { 0x1ea5bdc0dae696c8, 0xcd67c46beb870b35, 0x1cb5416f15cddeaa, 0x3f9312a306c60298 },
+        { 0x283e47619c597cd4, 0x30732dcdd00f1b86, 0xc829cd9e664bc220, 0x2e10362907c3a5f4 },
+        { 0x1c29d6c706d1f25e, 0x4a78427e22cdd372, 0xabee3715c0cc4557, 0x2482cfb772186578 },
+        { 0xcf93b475ef3f4fd7, 0xc1011f57a6cbca72, 0x6c4936bc136afd76, 0x3cfc80fe76751e6e },
+        { 0x8b9cc27dfef5dce6, 0x984d0eb558245d29, 0x5ca3a0f6f84bec7a, 0x38c2607b9e2ff93c },
+        { 0xae95edc7c5da9fd2, 0x279433cb0132ff2b, 0x9c082ace35fe1b4d, 0x39fe7eed397d2397 },
+        { 0xe16c1461b6ab8e1e, 0xc67b2826b87931f9, 0x6d814ca5468582d3, 0x18838f5e4d60711b },
+        { 0x79afcb0887e490d9, 0x0c274514e3621c59, 0x628e5e635dbf07d4, 0x214ba39173af448b },
+        { 0x5d525a7be12d5ebd, 0x193dbbaff418da58, 0xf33339a58d95fa80, 0x335115803e9ccdfb },
+        { 0x861d720f6fa2b30d, 0x35a4cedaf593e10a, 0x49a9c9b2439c65dc, 0x09f24a08d5cd29df },
+        { 0xa12d9da954613ff5, 0x955d3a02d93d7339, 0x33817cb0445f5606, 0x13dc18371a05de2d },
+        { 0x31fc5702f98ac83e, 0x9b890e3e23d0c8e2, 0xfa8b029d11f22bbd, 0x007593f51070fc82 },
+        { 0xaabe5fb67a949dc3, 0xfa3804ea7fe930af, 0x56e81351376ed4f9, 0x12f77f5e4fcedb88 },
+        { 0xa0864dba064bc470, 0x25ddc61aef678b32, 0xf298b2f565670af7, 0x21b0d11ef10cda87 },
+        { 0x107dc587a46312f6, 0x5892cd1b5900e4d2, 0x29594cfb5c203cba, 0x374617ecc1187117 },
+        { 0x2b5e6c20d885f73a, 0x2c6bd486df05950b, 0xfe43a907f93b1ed5, 0x2fb129ac2ccb50e0 },
+        { 0xf137577b34dcd7d7, 0x0c3c931c8f12bfad, 0x6ae36bef9ddf7267, 0x3d1d716879c3e23e },
+        { 0xa08f99f0d90486d5, 0x5482f75caff508d8, 0x6c57a36d0f8e0e26, 0x20ddbd0b1959af09 },
+        { 0x7e910c83da45370c, 0xc10959c20510831d, 0x8a15e5fff0651839, 0x1bdaee342ba7cf63 },
+        { 0x4451c0748691d468, 0x2ebdfe57c9236f9e, 0x393a325f2df964e8, 0x17a14703b1cbf281 },
+        { 0xe178f2decc4425eb, 0x06b2dfd4a034592d, 0x977fa9405847e138, 0x0963d30dcd0893aa },
+        { 0x5bd90292e41d9751, 0xfb84f48716952e49, 0xaec7d0ba21011969, 0x208fed8acfe67134 },
+        { 0xbcc3665f0a06debd, 0x7c60426840604b54, 0x98ea0d21d4aad6b9, 0x053aabc47c2e522f },
+        { 0xe5b215b45cb95d6b, 0x7410d44fd7673506, 0xa21cb18d78f74114, 0x2d76ecc48980be16 },
+        { 0x27a127e72adad037, 0x7ce5ce9d4337f983, 0x8da77d5a89012daf, 0x2380ac267a47a092 },
+        { 0xb372d501de057440, 0x5812b124a2344ef4, 0x2b5726999f679048, 0x1a08049449f34f1a },
+        { 0x49235a4b087a8a83, 0x610e0a55663c9550, 0x04ebfd4ed252c527, 0x39db06729aacfa4f },
+        { 0x60636b56a9b1a90d, 0xe744cd4a9d9aaf1a, 0xcd3aa7481b1caab4, 0x29d1c6e136c97ed4 },
+        { 0xd5c0c7c28d7f0c50, 0xc8f252ac3cdb690d, 0x863777abfbe28d98, 0x16535a243b478f6d },
+        { 0x1ac79f320d3f9bbc, 0x5d1e7fb06cd0074a, 0x06a184883ff38b99, 0x1bb818680933f0ca },
+    },
+    {
+        { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+        { 0x281d7e00e5d18518, 0x1c54c47b0ff85914, 0x42f0f80bd49c7cf0, 0x0c48c6ec0abb7a66 },
+        { 0x23490ab3310cf5ad, 0x9adf07709f93e6a2, 0x4c1c4bb1e7d4945e, 0x35c451a6d1eac3eb },
+        { 0xc543fcc813a8b28a, 0xe3402adc15c51cdf, 0x2d3ee8613a1d9800, 0x3bfa2b3af66ba0b7 },
+        { 0xf960847dd17e4718, 0xc563ae311df001c0, 0xcab7569702fd177d, 0x373415759b76cb44 },
+        { 0xc1a9a53ca65d6e11, 0x85fd931186b7e753, 0x88b6e05a67db1558, 0x3b06a91a746e1c47 },
+        { 0x5b50975f3baa61dc, 0xc745cb838265611e, 0x0fde404693938ce4, 0x2607b85cae41d308 },
+        { 0x5079c2221d909812, 0xf889d7ee9e0e8fb3, 0xc989f910c9926bdf, 0x372a1a6d77146353 },
+        { 0x502d922a860e0248, 0x9aede8c2164e94ae, 0xc5413491910138a4, 0x05cfd8e66c406bcf },
+        { 0x0b13acd2dedb684a, 0xb5891f8236cd4322, 0x2d5eff28571f0fe1, 0x023b260691ee5070 },
+        { 0x491c8fab5995fdde, 0xe7a6bf78a25a7c26, 0xd8deebc3211f82be, 0x108273e6a09c96a0 },
+        { 0x2fde87801b92a22e, 0x8f82353939c32547, 0x8408d67caf458383, 0x144f65c67444dfa5 },
+        { 0x91cf935894305fb1, 0xb1ed39c7fafae84c, 0x6123af040b493202, 0x38bbfdd4eb8d721e },
+        { 0x9d0e2acf7cdf9f2f, 0xccc51a6edb7d010d, 0x5db303c07b9f057e, 0x03bd55352209a8b2 },
+        { 0x022bacbc911fdb8e, 0xaca631367e4d85a9, 0x3da79c18527f63f6, 0x1d53a26c68ac1e41 },
+        { 0xdb86498671ff3727, 0x99b2243ec7659f1b, 0xb4203c1a1f124747, 0x2695bdaefa0fb0f1 },
+        { 0x5197df495903edd6, 0x4cd4032ca9fbc7cc, 0xe4f26df7f8ab0371, 0x31ea15f1acd46e73 },
+        { 0x113982991ac2fbe7, 0xef752f6b5be1f451, 0x16ef0ffb2eb81374, 0x2949415c3d30d6fe },
+        { 0x181d1ea01739ba66, 0xddee9e63460ea792, 0x07a0085019055bfd, 0x17db4c0042147476 },
+        { 0xd5d67db345db7b95, 0x83bcaed9b61f1525, 0x19acff6302022a4a, 0x139880b51e1a7c01 },
+        { 0x16766310e9daf1f5, 0xb030bce0698e41fe, 0x1140efa6f9aa9ae7, 0x3cb3353a33903e11 },
+        { 0x5e6aa9316b373fb7, 0x005cbbf28d6be945, 0xba211f3f99b9e68e, 0x3d548eadf102e853 },
+        { 0x18612f175ac4917a, 0x08f959ef1a3e3e6c, 0x8dae5400700e1395, 0x1b684a4e47c8ecb6 },
+        { 0x7f2b3ae765825f73, 0x7c43ca2d4b5ed848, 0x1c3e60adf4665911, 0x053aba68abc86b71 },
+        { 0x6730b525edbe8e1b, 0x3cca1e21a48ef89f, 0x6e3dd32ac0a4e686, 0x0ac8d9e2ffdeff0c },
+        { 0xa264b8b576038e82, 0xad625ae6374d31be, 0x3c4adfe1c4d6c092, 0x1265bcd26ac3cdb9 },
+        { 0xdcc3543ddc2b25e7, 0x883323865591eb84, 0x8b02e1fdb2875c3c, 0x2d4aebff2807fe38 },
+        { 0x33b58a519e1e2353, 0xd2172925f5646d20, 0x036f1764aded97c3, 0x09a204db0c31eaba },
+        { 0x5278f9a9fb80de2e, 0x5e9465c8cb469a19, 0x3bfce83881bf194f, 0x09468f758b383e3d },
+        { 0xdca20875f2a53379, 0x983c06091379403e, 0x559053a225690c3b, 0x314ff52722a88771 },
+        { 0x9110dddc4e9360f6, 0x9fb61d0904ade150, 0x1413a74f81372a05, 0x38733880fbd828d9 },
+        { 0x10e55144952341c8, 0x85fafb0ded23c4c8, 0x6176be7406994170, 0x3f429e5fd4e23792 },
+        { 0x89990be10d94140e, 0x2308171169a21f4e, 0xbf9492adb949c6e6, 0x3c7978e8b41f50d3 },
+        { 0xddf0e4ef8165d0d9, 0xf075ee0b1359db07, 0x1549b27ceae33560, 0x13ed5c9f88fcd3a0 },
+        { 0x3676b5255be048ff, 0x3e5fe09db43a430b, 0x0a3b10004cb20cb9, 0x0697ce413b4dd4e6 },
+        { 0x2249801d835d4f5a, 0x2dd0839db23c91e4, 0x9ec7b3835bac27b8, 0x1ffc05873d976ab5 },
+        { 0xafb39d5c28a73852, 0x8ccdeb67a35df93e, 0x248a1cf238fe137c, 0x039ddaa4a5428365 },
+        { 0x8b7ee3d02c68b7e3, 0x2dcbb8cad968562e, 0xd354a6f798112cbd, 0x1c5adea377a8481b },
+        { 0x06b6f5d0e5428ee0, 0x4bc81a8c5ee93a18, 0x1688cbe3ef9bbcc1, 0x2c5b2b55da0b5ffa },
+        { 0x0c463480482cd338, 0x0401c96f131bd06d, 0x84bce3b8af9d9139, 0x00f2e4ebdd806a68 },
+        { 0x38c78adbf98d42ac, 0x3569f55d7a327483, 0xce290fad84d660a2, 0x20f051ee21377199 },
+        { 0x3584cf001c7557d5, 0xd8fd2e3fb9df6187, 0x5342b2f0abefe6fc, 0x394498057657708e },
+        { 0x34e10ad38156d1de, 0xb3999fed3952fd1f, 0x75a2fb9ac04f219f, 0x2159e37f13e24fa7 },
+        { 0x3fb9ecd7edeba610, 0x8750a563590ded0e, 0xc77861556c0a58fa, 0x12a5809ea10a14b7 },
+        { 0x30c5639fabd32692, 0xdc061e46eb6fd8eb, 0x97bbb5c4bb5b9333, 0x30ee0f7a63e0e80c },
+        { 0x5891df309e90060b, 0x7689cb953497b53d, 0x63f84cbe23cc65a4, 0x1c1aa044e58a9c8f },
+        { 0x20382461c66f1061, 0x807807c463db4c95, 0x4dbb0f352debf855, 0x152a743a73ab6268 },
+        { 0xa6e009893c9303cd, 0x647a36f77e8abd5b, 0x9aabf83fdd89923e, 0x033129fdc7349350 },
+        { 0x76ade67bf2e35d07, 0x357047f6279c1055, 0x376228b1de6e7e3d, 0x12cb3fbb95a55851 },
+        { 0x9f2779c584fdaa28, 0x3e82be72efd1e319, 0x6746283e310cda86, 0x1d3c33432768807b },
+        { 0x99e34c7a60e15aaf, 0x4ac12a7470fa90cb, 0xd55b20060e8de306, 0x0124bd3206ca047c },
+        { 0x2472f1bfd5eeee88, 0xdbefd89ce0e5419c, 0xd946b704eee3d735, 0x0fe4aa50c6abff90 },
+        { 0xebe38e830fa642f0, 0x55a7b97678d439b7, 0x937103da1b031057, 0x2d457d81c0b134f0 },
+        { 0xcebcd5d7ef0d34e2, 0x4aac567a54c6b296, 0x207fe1f7fb8d1ab1, 0x16125999c37672f4 },
+        { 0x43810aa46834ba08, 0x86bd05d2213ef935, 0xdea954bd5de1de30, 0x365a73e281527b2b },
+        { 0x828bafde66f02cb9, 0xdd52107b8c20c2dd, 0x67fb251d573b6545, 0x2a1e4f9237bf797c },
+        { 0x5cc6d61a134655c3, 0xbffb7b80c5e4815e, 0x473b6b8cc67e4aa6, 0x0bb0591bca82270d },
+        { 0xfad8b8096c1f8fda, 0xca2920ea02788253, 0xbfd8f504cefc6482, 0x08c6b0b18ebff2c7 },
+        { 0xf5c8cf496c8410d0, 0x9f637b5cf21d3781, 0x2ed202010d0e90aa, 0x17f0994d3944fc9a },
+        { 0x29495535794fb0e6, 0xa292ddd449a09cfc, 0xbf446706ea0e89bb, 0x1722ae8306ca89b1 },
+        { 0x4dd58f5ec3cf46d0, 0x9ffe95d4d776c01b, 0x55be33e28dd84a0a, 0x34af31d2b44d1478 },
+        { 0x563c8133696d2ff5, 0x6bc47f731ee056cf, 0xb556d5af78b244c1, 0x006bbb5d68934031 },
+        { 0xa204850be6b0971b, 0x78e4c623bcfda3ee, 0x184953d622ac00bf, 0x350074566c0e264a },
+        { 0xfa162886ee56d68b, 0x7e6f579d284f70be, 0xc1bc09fc08a02b37, 0x0affd72e668e679b },
+        { 0x10802190c35fbc24, 0x7a4d3a764126bd02, 0xe4bc421e6de64119, 0x0b69c128ef08db88 },
+        { 0xd5d6a2df387c7309, 0x433a8b244d0e6443, 0x11c049584aacb607, 0x2a669900e97b7304 },
+        { 0x57abeed6542139ce, 0xbf0614d5aa5c0299, 0x733659dd5e8f08fd, 0x2a2ed8fd37aa924f },
+        { 0x32f169e2333f83ea, 0x81c2ce40804ebf62, 0x54e6869501493c09, 0x2fdbf2af5e40bc41 },
+        { 0x52e3661f627189bc, 0x3c05454c002b1214, 0xe0a8ad0e69afce0c, 0x1e352c13e4307dfb },
+        { 0xe4259695ca8fc1bf, 0x43962032844da513, 0x565eea6918ee3c50, 0x0c4b7d4e37241eaa },
+        { 0xa06df3dc7465fc9a, 0x3de23719fce95a76, 0x28af49c6fe000d75, 0x11650d12ae1b3c2d },
+        { 0x9b6d5203b93a2097, 0x718728e0c36eecc1, 0x057055a4f8b7b114, 0x13af4df2de9b0cc9 },
+        { 0xe803d115c66af950, 0x8dd8a881eb38bb1a, 0x882e2455129125d0, 0x16800725cf521a6f },
+        { 0xa70a916cdc97bbbf, 0xd8c8de3a0d7ae576, 0xcc78e1e07a40c8f3, 0x0f20bbcc5d0793b1 },
+        { 0xdb48b4c4c88c7bf6, 0x6780b9da6b80a9ac, 0xbdfc0ccbcceabdcc, 0x297dea1cf78faac4 },
+        { 0x4c37b298765c93ce, 0x10a279d01b3566c6, 0xb7a1e33a9a2a3f63, 0x2c495480f01aee46 },
+        { 0x92eefd4199576f59, 0xb52688a1d4ce514b, 0x393ea362b01f8fb7, 0x2c0833e1dbbf3f8b },
+        { 0xb7bcfdd4b5b60ff8, 0x667c28804a0b4ff6, 0x86666dbf097c3ddd, 0x3c650cbfa4b46b03 },
+        { 0xe460c6dc3c77fc41, 0x750bda50150c1503, 0xba7c58a40b96036d, 0x17fa00ab78600775 },
+        { 0x3bd8fe560bd0095e, 0x8803f65431a7449e, 0xc29d3d324b2c9e33, 0x17ff97d0c9f068a3 },
+        { 0x6ad56301def0c5f1, 0x376fd81b9357cf63, 0x38c35bee137995ca, 0x1554ed92e2537878 },
+        { 0xab40583d69bb7ee2, 0x3dd37733bb0c0668, 0xeb45ba17e552eaa3, 0x242ddc0bbb2b0379 },
+        { 0x9cf3ca302373ba52, 0xfe2d8caacd44f6b5, 0x177fbabc7ca58229, 0x3526b7cf05ddcab6 },
+        { 0x7ffcfb5d0cc00142, 0x0f8d3709ac029914, 0xcecea524e3881483, 0x3c16b750a9aafa57 },
+        { 0xbf1f61cc8376a15f, 0x73525f223ca4fd57, 0xe2760933d1591489, 0x05bd26279e3e760f },
+        { 0xd91cc0a6cb0b6f25, 0xea87ea0ab1f5b829, 0x62603ec750b39145, 0x0ba7d10dc7afb139 },
+        { 0x7ef20492025fd958, 0x58163b5b8a457ca1, 0xee2992ba1089adca, 0x30748194a1392401 },
+        { 0xe49df6737cb82912, 0x80f01c44b5af4b31, 0x7cb7fbaccd0f7d57, 0x15490392728a5ba8 },
+        { 0x922f49414fe174e1, 0x4568fe949ea6eff1, 0x99ff82d0bb5453c8, 0x0b61fc5d9e3aefd3 },
+        { 0x5af1b229b50f9bbd, 0xb10cec8feeaeb4f2, 0xbc6196f04b3d6f9f, 0x0b57ecb865f4f3c1 },
+        { 0xdc9fab9516fe84f4, 0x7d303d9144a92d90, 0xc09a36f72e1d75fe, 0x1371167fc177c98e },
+        { 0xf65dd79db2692ae3, 0x9c8b73b38ea39204, 0x73f05a5228b6a1e8, 0x15470d0e3b6e48b9 },
+        { 0x213c3b7cc623d2fb, 0x7df5af849604361e, 0x270a1b0dd09b5ead, 0x3b3a0239348a5e6e },
+        { 0x5971970de261622c, 0x7c3e8337afbbf181, 0xd2b3fa343eccefb7, 0x3b863b46c82f6d28 },
+        { 0xf73de614b70cd2ca, 0xaf4154656d447c94, 0x9192bca3def6ebe7, 0x31d86e5936ef743e },
+        { 0xcff303713a6e6be3, 0xe1cdd1d634f4fcf2, 0x25d60a63d4416ae1, 0x24cfb04e5000599e },
+        { 0x741550deccf66484, 0x42186a71b5bbca71, 0xa02e699aa9071e53, 0x179ba3fbb7ae6412 },
+        { 0x8c2313bee8588b45, 0xbb7e5bd6ed2e794e, 0x57c11b727d915dec, 0x0c3049a22029b2df },
+        { 0x085583637d4abbd5, 0x3780ccc5542b9d94, 0x6b965ec52602e846, 0x115557b62a38d7d2 },
+        { 0x1ab18745bda2e787, 0xe0287bc9f364949e, 0x5acb4911f3375663, 0x1fcc49329d95de2c },
+        { 0x126a24f438818a50, 0xd756dfef289eb773, 0x7a26da3bbb42f0a7, 0x31afd116552ff0f7 },
+        { 0xffcf028d381d413d, 0x86e4099093888233, 0xbc74c00194923088, 0x10b7580c14963156 },
+        { 0x4905d71194bbff3d, 0xb53388e191a1a3cf, 0x9e67eacd7c078906, 0x257d00a549ad9524 },
+        { 0xc936b0fdf776a501, 0x684eae275723844d, 0x7d13b21d3a84484f, 0x09f918fb41c32572 },
+        { 0xfd0cf4a10c6cb1eb, 0x476d949e3a956fc3, 0x6382d26a9a92f432, 0x02f1fdbce0d5a6ea },
+        { 0xc9ac6a8149ac27b5, 0x3ad66bc5f60c890e, 0x5708d2a7b25c9feb, 0x14aeb6cd946e35d5 },
+        { 0x8760945aa3b08eea, 0x4fe6e6f28bc56db9, 0x0ae0055b243ffdd7, 0x3c4a402a242d2b50 },
+        { 0x57a8f0916a79174f, 0x19cc8bb438078a8d, 0x44f7f214f7e3b25f, 0x3ab82f7f603981b6 },
+        { 0xb8ed2c552f547c12, 0xedcb7438d7e5b959, 0x03d47a852a0cd798, 0x30dffca9ec6fcb8b },
+        { 0xe2ca4baad692ceaa, 0x652ac6ebcf7ee98d, 0xe8dcda21cba5ff4f, 0x307d5d9f0b34e7c6 },
+        { 0xa05966484287db25, 0x2bdae62f818ceb93, 0xb1b35b82677d50a9, 0x07c7666d1a96de76 },
+        { 0xd582a1aa9193a95c, 0xdf0bed3c47a66c05, 0x06e3d0a321b9bf39, 0x1ca6044d4db9ca51 },
+        { 0x893fc24db0d51f47, 0xe9deea48476a2d94, 0x88dfa6d13f3e8d0a, 0x0434ab74be7af235 },
+        { 0x91f61a2c714452a7, 0x00421f9093f558b1, 0xeb49e57a69b51a92, 0x21a23ceaf6e09af6 },
+        { 0x0afe222e652edf64, 0xd2f148b41a0e738e, 0xd35a126d9132294b, 0x1c837467ce98f83f },
+        { 0x5baa4ad014358572, 0x793461667bed808a, 0x6af842d250a7dbe3, 0x0493b593ccfc5736 },
+        { 0x536127acbd289cce, 0x450fcc5e8b0e08a7, 0xba2682a2b8c1f199, 0x03a967a7ed20ea32 },
+        { 0x5777128878f07bc7, 0x5de279719acc3f11, 0x74ce761d59b59e4c, 0x09efef129563139a },
+        { 0x90894f5f64ee6079, 0x39899a13897e2aab, 0x09dbd00890b159c5, 0x3c208c108394fd86 },
+        { 0x53aa57442d9b92b7, 0x5a5ce8373c40987e, 0x903c28ee9457e6a4, 0x05fb04163d094055 },
+        { 0x62445e7a1b3927f7, 0xd0d14f98baf3e4e7, 0x7e09c64bba7071dc, 0x22de5afa17df0f8f },
+        { 0xc21181cd57d0ee14, 0x0113aa5124418c3a, 0xebfbb2dc1ebea092, 0x39d4689b427a86ca },
+        { 0xb86a437d1893dca8, 0x314f26bfe565894d, 0x9f9aecae391411c3, 0x0d6a5460db92848e },
+        { 0x59468441112f94d0, 0x0a32b1ea97786e7d, 0x11d9271cc3f6b358, 0x39195308da202b48 },
+        { 0x2c30929d137d0fe5, 0x8c3d49512192b906, 0x1df3cd8b8fb21d47, 0x094389a0023aae71 },
+        { 0xe87a2a0974ecc7ff, 0x6ede665c2c1f4922, 0x4bc27c5eaf8670a1, 0x2348b487c1d97109 },
+        { 0xdfbcfc2f80729e7f, 0xe96122ed9996ffec, 0x77dfa2fa105cd023, 0x2f580ebabd4e8746 },
+        { 0xd8bb5b2c75519f1e, 0xcb5589d385e93147, 0x4b1c6e7e4b58926f, 0x26d275fc1f52be9c },
+        { 0x76c96791711e794f, 0x92a564081f65413a, 0xd0495ba4620a60dd, 0x25b6de6c627103cc },
+        { 0x27b30405230bbfda, 0xff387280d31d7bf7, 0xfffcc044cefcabae, 0x1e9f35fd1df075ae },
+        { 0x1e0a825c0d76e91f, 0x197224125ee0edf4, 0xecf4a608eea56970, 0x0888a33739e3be0a },
+        { 0xb5505efaed3c36c8, 0x2d1d3143c47febef, 0x6cbef87fbf8778c4, 0x3a35dd7bc07af2c4 },
+        { 0xcda9ef63d25996cf, 0x8ad32755b7cfc265, 0x527c663e6fdc6397, 0x25508c995be7b04e },
+        { 0x1c70160ab29c49fe, 0xbd3edac3a48706bd, 0xded0e79674dd3ade, 0x3449f852e1c19fac },
+        { 0x6df94ffd51bbf30e, 0xe7e29025fb5ff132, 0x7a3907db17b11043, 0x03120d129c11bea8 },
+        { 0xe8ea83a9f9703f0f, 0x66cca0e2d4f03e33, 0x71b102cde9f69dfb, 0x0de5081e3cabdca8 },
+        { 0xa81bf93849d41580, 0x2b5dafe49522dc63, 0xa563469d1635bd3f, 0x3e5818ed2b670a70 },
+        { 0xa15c46b52e71cbf5, 0x7c8cb9cae2f0a6a4, 0xc54771ec81772a17, 0x29c09d55794d0afe },
+        { 0x422847a6d2e390a2, 0x67cc3299f6a88229, 0x6758c0df26799d2a, 0x08a70e7200793b32 },
+        { 0xf4089a67e7c337f7, 0x85076f74c9041ef1, 0x165ae002543ffdea, 0x1077b4c6709ef3e5 },
+        { 0x6ab7bc5c916d2871, 0x432d5742f09ba261, 0xa60dce480e819e01, 0x014fb9d86200abb1 },
+        { 0xb4781bb44ebcc277, 0x6cf6f2e83cf2c997, 0xee336aa409f42451, 0x311749859182ddd0 },
+        { 0xd39e9dd93b4d5247, 0xbfed1c7c847dce68, 0x696c23796d7a85bc, 0x30d8ffcdeb3dc106 },
+        { 0xfb5d0384d17df970, 0x459445f384b828b8, 0x7368a9d935a0ff5c, 0x3dec6e300af55c67 },
+        { 0x888e891faf7ac09d, 0x79add3071770c6a5, 0xfbf6090a1e1ab460, 0x26d9b83b46382222 },
+        { 0x3817aa0828ec5a0a, 0x5e6417c34950146e, 0x232d2757663cf43e, 0x3a9b222b05e15f4c },
+        { 0x0f70f4049c1b23b6, 0x65859116e8dc939a, 0xf95b63b609a21db8, 0x32acada7e0cdc6d4 },
+        { 0xdb26a77cb9a63f8e, 0xbb74e690f59a92ea, 0xb10bf67fe0c2bb9f, 0x3ab3a672ad2ab115 },
+        { 0xcf265938b2105f12, 0xad2ea4e803713bb3, 0x6d140c068a802dca, 0x1d25a4c690d7a8fe },
+        { 0xd7a0ef8cb7a963e7, 0xbd039fed30a68f02, 0xb81689c06ccd9125, 0x38fb980fa88aa5bf },
+        { 0x712ca5067826119d, 0x0ea6b57f23c350a0, 0x7a87cc993cd0e5c3, 0x18af867d973fbf6f },
+        { 0x2f8d57216b431a6f, 0xd332cf87f1c27465, 0xf5d2bdb336910441, 0x31eb41d93647c53d },
+        { 0x919efa32ed1327f2, 0xa5f31dbc1a78b519, 0x49ea23a53292f6d6, 0x0b776efd2484d82d },
+        { 0xfe39b588b73b9cc1, 0x59ac4fb02d3cbb0d, 0x9af9ae499c8f294c, 0x3224b93b395e9a6e },
+        { 0x505d0466d6da7502, 0xbd5580b6ef5c6773, 0xa7e6b7a86a4f5167, 0x311fac1663e9b8f4 },
+        { 0x74d5719c5ed4530d, 0x8ff7d2771422174d, 0x23ecc302869b76bc, 0x34b87ffd7c2a3b0c },
+        { 0x3a32f89f517883ce, 0x526eb33256016f6e, 0x0c02a432cec939c9, 0x338feea76f324757 },
+        { 0x5e30dd2c01ffc07d, 0x02ac0b611a053dc9, 0xb21d2e40bd6075e7, 0x16378023d2c940e5 },
+        { 0xa5925bd72df88857, 0x2923e1ea95504119, 0x1343330eea48030e, 0x21156f897325b140 },
+        { 0x65e92c72da44f7c7, 0x5a15582dfd53cb10, 0x959dec9f3ae9f4ee, 0x2c650d8674ca6bd2 },
+        { 0x91257e546c96ca38, 0x43a929655b908727, 0x394a14d149648abb, 0x01611926d5285edd },
+        { 0x9070a4fdc0ee8554, 0x6a7f5c56cbb73342, 0xbec9407cf28826a7, 0x37975acb575c7b76 },
+        { 0xa05f257fbe003b64, 0x29e8943468a5f39d, 0x3245a9c2df8feb40, 0x1cb245950ee9ba5b },
+        { 0x2b6884d3ce29f278, 0x5fe0c47332db3148, 0xbd69745da967fb2f, 0x173d6c25da8c1bca },
+        { 0x065d5e7894722a6e, 0xbd0561ee4384bdbb, 0x77e693d693502a75, 0x1cac000d11ff5a58 },
+        { 0x1439d7d0d869f315, 0xe2009b6dcbd87f73, 0x2df841ace705f70e, 0x1be71a45e99805ab },
+        { 0x1d9310731cf8f9ff, 0x88f4dc8b2e2e7726, 0xa30b1df1e24676f9, 0x210cac85620e482e },
+        { 0x72434674617a10b7, 0xf1b34478a8d89fae, 0x21bca0b265672369, 0x14b8de71152f7e7f },
+        { 0x50a8407527e27249, 0xeb3247145ff04e07, 0xba9b22d5e2b3f74b, 0x387b4feaf1585de4 },
+        { 0x3a4541f52bbb95c3, 0x2b2f7b371ccb349d, 0xa575b17a4924a366, 0x13889fd0ce258e04 },
+        { 0x7bea78b2651de0b3, 0x181c6d6b91196d7d, 0x13dc222bbb13e289, 0x3b06ac6a7e6d7e1a },
+        { 0x514e987fa6ad260b, 0x0d61b44315420420, 0x141dff8397d68b28, 0x3c331630ba5c5807 },
+        { 0x6f7f25083067f2ea, 0x88e39f85a6b6e896, 0x2017f92ffb48d2fd, 0x0075a4de950d53f8 },
+        { 0x4ec6fd4047da85f5, 0xf207b5af31a9dd3d, 0x28dc0cb9e963da2f, 0x044512134a8e70a8 },
+        { 0xcd88e70cb96bacb3, 0xbdd1349562de648f, 0x59ba5c63c16545b4, 0x14e84be305c42225 },
+        { 0xeeb5d7ee6630387b, 0x3f67450ec8255256, 0xefa48f2b07d55080, 0x0d33199a21da58c9 },
+        { 0x67d4b73fc0f7ceac, 0x555d861e23f43aa5, 0x1daf224a342ac667, 0x3cd692b6a65648ca },
+        { 0x0330f5f028690b4a, 0xc42111075009f9db, 0xd1f12a068e63cae6, 0x0ebcc3be05bdfb3a },
+        { 0xb403f7fd82543502, 0x081448372f062745, 0xd6fec9817ba8078f, 0x0b570d054ca67027 },
+        { 0x4490eac78df3891b, 0x1f91326d0430adc3, 0x54919d2c802fc972, 0x25b06d2059826adb },
+        { 0xcb9d6bd08723fbac, 0x02ccbf9f91eccfd1, 0xffe8c7dfbf47b84a, 0x323c273ce59489b5 },
+        { 0xba0d65db416f05fb, 0xde2c43429030af2f, 0x36508dd53bd88ae6, 0x211c6365d1b7e270 },
+        { 0x9b61e5e9a765d3ba, 0x5eec7c0eaa553e3c, 0xeeb20a634273aa5f, 0x19e721aecc645537 },
+        { 0x15be78e60a172e32, 0xd39c1b6517d917ed, 0x33a13a210509a3b0, 0x0415e79878097b88 },
+        { 0xea031c72b23b6b7b, 0x0dfb333694dbd333, 0xab835660f47b31b9, 0x2aa8d2c1e7df397f },
+        { 0x4f60ae05649998af, 0x7407720b60a08ac3, 0xcb1cdc0b919f71cb, 0x225df15ec5a85894 },
+        { 0xec1d78992d91c0bf, 0x03807f01fe6ac69e, 0xd95ab0b8dc404208, 0x16d6cc8a8e71fe6f },
+        { 0x2757c8e96ec1f110, 0x3464be0d9f92b802, 0x3b6d0a9631ae35df, 0x1b27ee9818b16db3 },
+        { 0x512797272bcbf20a, 0x02583129e8e65b3b, 0xefd74156f107c38b, 0x2d73839ddfb6bd47 },
+        { 0x6626ceeaa75334f7, 0xf0e108f209821f4e, 0x10d37e7f099927b2, 0x2ffd1a651ba89648 },
+        { 0x714fda22e7b30d40, 0x5e23aabcdab6b237, 0xcd211e37b8379174, 0x368ca4d07ccb68da },
+        { 0x53cbc0c910d03b91, 0x0076116fa4c42dde, 0xcdc661ac9b56d571, 0x39ec52811756dd6b },
+        { 0x6866017257575ada, 0x193923bfe0221fb1, 0x39a3032d136df87f, 0x23fc6df0819bec66 },
+        { 0x24d67f370fa5bbb5, 0x70f46c2ad9228acc, 0xc087267ca10ab121, 0x0e7972eddf3c2b17 },
+        { 0xc39d8ae4d698637a, 0x7757be90e6f77377, 0x27c51b24b775f773, 0x18aa71f5c3eef085 },
+        { 0x73b732d2a20d98dc, 0x9d4cfbaffb7cd073, 0x4397eeb17ebd4689, 0x08f0ea87388568f2 },
+        { 0xf6d440d948dfd15a, 0xb0d465076046229d, 0x0b50cf4635c09a66, 0x2c03003714724b7a },
+        { 0x38a58115911e2630, 0x09c7d910f81b602e, 0x6907adc4a7628054, 0x152cddd75fe89955 },
+        { 0x6bab65774f64da0a, 0xb4561ef4e72f80a8, 0x7de9f32449c7a56b, 0x251111b2841d7e29 },
+        { 0xeea81cb01a7182d3, 0x15bce73308855492, 0xa5eb29006d8c438c, 0x0934831b9cbe08f2 },
+        { 0x43e6184566c46164, 0xe14e89523baf1ad1, 0x01afab1d1f52fc0b, 0x2d8806a75f2a4cde },
+        { 0x70d24ae9470341cb, 0xe601ce39e2a43e14, 0x506fc289344e880e, 0x11fc895c04045dce },
+        { 0x8f97b3ced5c19f55, 0x3eb356a3361e2bbc, 0xe95b21765951505f, 0x0f4acbf9ba79c053 },
+        { 0xc4d425ec1bb6dd2d, 0xe4c293de5e1bda35, 0x21e57ecbb258c350, 0x1d41aedcfe856700 },
+        { 0xf907b9244861a3ff, 0xc19f5a2c1dd1bd58, 0x6f017c50ccb5f691, 0x13d336da74e4d67b },
+        { 0x2305527504705e04, 0x54805e13b7130d1d, 0xd830e2f1cb48e0a0, 0x2d1583db51b0db76 },
+        { 0x3fb27ea6afc22436, 0x3baade122c6f7a61, 0x42e170fd72faef4a, 0x2e27069097e06417 },
+        { 0x7817593b83566c54, 0x08733c1e23d9617b, 0x341f8d621a6f847a, 0x25e2c086b893f30e },
+        { 0xd20a0fc4fd30b57c, 0x4114726c59154ac5, 0x61d41a9de583f010, 0x08a20b591e1f7c98 },
+        { 0xf8d900a82581c7f1, 0xf9b446cb9ad601e7, 0x00500d1b5290ff70, 0x1865bec14d96bee3 },
+        { 0xa97b4412e32b14e6, 0x75dd2f799f06debf, 0xef3db522913c1bae, 0x00b13fefbd3a73fa },
+        { 0xe47487cc4315fe17, 0x08ed2749b9dddb00, 0xa3a4f46b13402ea0, 0x22a4ae76f8229dab },
+        { 0xe1cd631f7e20f122, 0x6bc147ad3d11b620, 0xb4f6fb766cb0106c, 0x2b28f60a931328ab },
+        { 0x81d3a01dd6d8cd5e, 0x3e782405e7b466bf, 0x9ae7ac340656678d, 0x3b68289ab03bbd7d },
+        { 0x19ebc83f6ada08dc, 0x251a5e9ef4a8e51a, 0xe7981a856f072eb7, 0x0c2c1a02df8568b9 },
+        { 0xed5eae1f8b4f37c9, 0xadfdbb09c0d8f34c, 0x75c7bf2eeaee1932, 0x1cdc494c95a80728 },
+        { 0x50add213f11718b4, 0x97d28628e1fc7bf2, 0x3cecdad9c0ce46ac, 0x3370a017561bfa71 },
+        { 0x8547137ce6963a48, 0x2b9d1f266c50ece9, 0xcabdd558cd207bef, 0x2ef7246d82f55d96 },
+        { 0x7436995ee333fdbd, 0x98c96de6d4742997, 0xed938a1bc32cbd41, 0x392132a877c26634 },
+        { 0x16c25486bfe88c31, 0x0cf6247e9d0096aa, 0xcd1b194b41c59974, 0x3f4b0d934d8856c5 },
+        { 0x8e626c262adf96b4, 0x62f0e94037e717bf, 0x49b091b16c5d478f, 0x18be79ff9850c777 },
+        { 0x2786abab1dfe8e13, 0x25ad4df0cee2e0a6, 0x890953c3b0fb0b9d, 0x28d8b32c78bc3257 },
+        { 0xcec6b4c2244906a8, 0x29830aa30909acda, 0x78e6b4f1e184975e, 0x0797f9cf28e5c107 },
+        { 0xa540157471b3b1f3, 0xe7d312d6e088121f, 0x9ab2bc2e0c83a8da, 0x31243c059e38e4d8 },
+        { 0x35b3895777b77cf7, 0x673f4f95ddc6e6b5, 0x8facf1ef51418807, 0x27fa6aee240794c8 },
+        { 0x48f188edc8756396, 0x6156fbaff9fe7f03, 0xcbadbc47acfc7f3d, 0x257b31bddb6dae17 },
+        { 0x9a8f53585f474481, 0x76cb1aa373307e23, 0x518996e170ffb13b, 0x122d560e71b5df42 },
+        { 0x3152c95be201c82b, 0xc83df34c4f92fb95, 0x13ddfbc1d88fe58b, 0x0ac352d01d82cf85 },
+        { 0x8a58196ffcaca926, 0x694faebaf1e76956, 0xf111ecd8e8e9ee87, 0x0db50a424dff9c5f },
+        { 0xbeef7b1687f81593, 0x181ec73460703aba, 0x60ae17497bd4a220, 0x32b72e30eefc8a04 },
+        { 0x72fcd604b5a71c6b, 0x396302c12572a7bf, 0xf6fb2ab7bd402661, 0x19b7382668b54a48 },
+        { 0x294350f56f74a5a8, 0x6f5dd5ec508210ec, 0x04ef6fc6042afa9d, 0x3e3f6418c9713a56 },
+        { 0x46a85a1bd627fc32, 0xe7145ad5179e1a39, 0xc51553df8928662a, 0x0211208dc973d51b },
+        { 0xd47570899498256d, 0x0f7bf7ff24bb73aa, 0xacaa35b50c305eaa, 0x10ef12c7b122baff },
+        { 0x0a32b3c835234075, 0x204da20d74ceda49, 0xb7d6e73cf338948a, 0x0833ebd55d01305c },
+        { 0xc782da4313a3d94d, 0xcc9373784991dff9, 0x5df699c3579c93e0, 0x2727a7154652b160 },
+        { 0x7382ab00a2968913, 0xbd0021fdb8326270, 0x2aea324e519eb6f6, 0x0ccbdce420a5ff67 },
+        { 0x04b35250d5e4a1f8, 0x661967f2a6c047d3, 0x3a9619c6871add53, 0x3925125e492274f2 },
+        { 0xff5bf27833b95c29, 0x60cc9de90c89a676, 0xd4faa7e61e1f62ff, 0x05690f41549f67a7 },
+        { 0x79fefb886f0203a4, 0xb1a88cba1560bfb1, 0xfec246b2997844fa, 0x09f758a89505492b },
+        { 0x1addac82a0d4a7f5, 0x4d6a50fd781c34e0, 0x7c6f89a8f5b1e1c5, 0x389ab30f6dbde180 },
+        { 0xbeb8f6b121c15ed9, 0x0a0e7223c5ab31cf, 0x86cfead1e51f9c92, 0x111bb1eaa1188ed8 },
+        { 0x909eacf4588a9a94, 0xa99bbcf9b33743e3, 0xc3b4ac99a2a86c45, 0x1fd7d93177bb4612 },
+        { 0xa7aeb65cede432cd, 0xe26fb01ee8df1753, 0xac91f17be4d0905c, 0x03b0f3307567080e },
+        { 0x33ff7326efb082a8, 0xac70967c34df3f0f, 0x3dda9635594ff57a, 0x108fd7736c888923 },
+        { 0x10d0232538971b75, 0x9690f6d4a4cb7092, 0xc7fd0bf0e6c94cf3, 0x1a6b6541299adc71 },
+        { 0x079d96ce889c6577, 0x21a2da794f6620fd, 0xfea83775c0cfc20c, 0x3ff7cd0a6fd46426 },
+        { 0xfd1ff700aac824ca, 0x84f59eff8776f7a9, 0xbbea0a5e45fbb795, 0x37d7575b3de64803 },
+        { 0x77ac906b92279ba1, 0x379aabcce4d31af6, 0x718f7972f363b081, 0x255c8f4bc4eb983b },
+        { 0x7edde487c72b308b, 0xc8dec809c8204adb, 0x8921c3c4613de720, 0x1703daad1ef7e07d },
+        { 0x198286a2a3936d70, 0x943118272a318dc0, 0xa058cd921ac91ae9, 0x3db4ef6456e4a522 },
+        { 0x679ecacbec7166fc, 0x207d93f6455594e6, 0x677df709cd189c06, 0x28034390a87b6156 },
+        { 0x60caa89ebdc5212c, 0x1df68f022b7b7caa, 0xe6bab36f880c8ad3, 0x15c99e9d483bdb49 },
+        { 0x54582134c880334d, 0xa3e030aa8ba16556, 0xdf10066184d19370, 0x2c5f515a96927da2 },
+        { 0x4b98488cc4ce72db, 0xe8ef1579f958ffda, 0x424b62a75895375b, 0x01e0d42cb7b5cbed },
+        { 0x013467f176a3a462, 0xe693a11f223e9570, 0xcbeb4126a0dc230c, 0x165ec5675490ebd3 },
+    },
+    {
+        { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+        { 0x16455dabaeb15b15, 0xbdd1596390bcb45e, 0xbe7b3b2b6a164e05, 0x17ccf4947f478856 },
+        { 0x5db80c23c8b793e2, 0x0ee0414e8f23e8dc, 0x00493dba0d9920fc, 0x32460ec6b78ff358 },
+        { 0xcecceec7dab551a7, 0x9c94ad51d5d80ca1, 0xade7eeaa07dc9841, 0x0028222039cf553e },
+        { 0xbead0341103e86ff, 0x94b6bae19f3132d0, 0x42c64966764060e7, 0x247879d7b6a8d6a6 },
+        { 0x0aaa024ba7de6e76, 0x7d7f69eb962d42bd, 0xcde70364b6d8ca7d, 0x1cb80e6a59c4ca43 },
+        { 0x0d6c5216c41c498a, 0x8af403b29446b236, 0xe87619916b9c9280, 0x1f18ba9ac2c806d1 },
+        { 0x0cd84eb733aa1294, 0xbdf91c1381d602b0, 0x2a2fee0d80cdd8d7, 0x230bf29ff6e63046 },
+        { 0xed9acaac3b3feafb, 0x3199ce25e6fd3e72, 0xbd99288dd8f43737, 0x0d5414922eff660d },
+        { 0xd3d4884f337a0fa7, 0x8d93a9fc5b6b52df, 0x9a2feaa8664a24b4, 0x0f5885cc922dc633 },
+        { 0x483f152e5afe2af9, 0x871a0299d2b8d390, 0x70b8a11a95987ba9, 0x01ce76be3ac22ae9 },
+        { 0x0ad1b6e5e56025da, 0xe0c6928068ab46b4, 0x709cfaf876b1828b, 0x0b1ba55f8881c308 },
+        { 0xc46d1e3cc82eaca3, 0xf102790b354c9c01, 0x1e5ed8f80c41ec80, 0x0fbe0517b8e08a54 },
+        { 0x71f22f93f8b3f71d, 0xddedd23d0a3db6b7, 0x6fba4af339fc5f9c, 0x07d635441f6973ad },
+        { 0x5f87bd64b90456d1, 0x85cde9dc5ae479a0, 0xf1438fd20f812b0f, 0x32db272c3dc9c455 },
+        { 0x8f619c2d07361d2a, 0x5efb340c7b79d98a, 0x1cbb688a3906ae68, 0x2e1d3005f3134802 },
+        { 0x4e9f8af797eb8684, 0xe192715a106841c4, 0x4e29f77e8d0c2902, 0x2f5e372ea49e457c },
+        { 0xd63a439f8d63627b, 0x6c3d6e767fe3346d, 0x7d85a5836f0586bb, 0x16321bca4ea6d5d5 },
+        { 0x3c00c6781ba8c5bc, 0x607b34e847b852f9, 0xe791c3b88aab4d66, 0x2fa632d9a6938f24 },
+        { 0x66d7fac3d60aa88c, 0x2ff668f0f7bcb46b, 0xf83dbe6a3ab64d8f, 0x2a2554908e7d1001 },
+        { 0x7f9d74466498894e, 0xd5864cd0ab715300, 0x4fde65c66084f0ec, 0x2db54438a78d6a72 },
+        { 0x546601134aba2c91, 0x4109cbde359f75c6, 0x33d0b53c32706e78, 0x157f1bda33c8851b },
+        { 0xc3caf21455cb299c, 0x63f21b4955f67d6b, 0x7d21baca8bf6804c, 0x1789d8b6845c9811 },
+        { 0x1fa2e4e1db4019c5, 0xedc4863fa85f2cc3, 0xfde0b6da04d7dac3, 0x1f63fe23470f2724 },
+        { 0x81460b01eb9a1afc, 0x0091b75e43be4679, 0x85b34579eed923d7, 0x016ac385aa3a0f1e },
+        { 0x97ac20d1fe28dad4, 0x571fee248ca82def, 0x1d1a4a4afbc5db17, 0x039d9ef1367e33e7 },
+        { 0x44e2cdbdc4cac869, 0x3ed3ce3babaa46d8, 0x2023f96c9b97a75f, 0x1699140d7056b430 },
+        { 0x227d510d1aabd60a, 0x3a6dcc918a4c0987, 0xe333752cd47635df, 0x3011c7e33effc74d },
+        { 0x868b65e5250aea9d, 0xa9e68456d6bf466b, 0xe53cf9e92b82e391, 0x1255afd93627f658 },
+        { 0xf2417137bd1cb667, 0x8583751f9e02295c, 0x30565d4c42be0b68, 0x0185ffdecece8488 },
+        { 0x4dd1be2243284d70, 0x0bbc856b6f6c60fa, 0xce4506f8bb574384, 0x2f44c7c831d43609 },
+        { 0xc60e30439b819626, 0x0df25b882793f26b, 0x4c2c96d8f6e74c31, 0x31adc216559a79d0 },
+        { 0x2e8d8b45723ff480, 0xd1b4d0449c38e955, 0x73dde41876ef358f, 0x0448616b3506a7bb },
+        { 0x2ea8babdd35308ff, 0x922cbf1aae8e4ab3, 0x2ec8c3ca06acbc2f, 0x1d0f63146276ad29 },
+        { 0xb2f3a8224381f9f8, 0x465535abc5162892, 0xbd82558d1321c39e, 0x0b31a7a10776a52a },
+        { 0x4932c933feb7e22e, 0xa13457ac7631a915, 0xf1c50f579e9f0435, 0x29d3777d26ee8962 },
+        { 0x06c8035d07825142, 0x35e2a6c48bca3f8d, 0x730290652ee4c2ee, 0x18fc9491a0d4243d },
+        { 0xe1ec04749fe2e2e6, 0x05309b7e5bb2b5d6, 0x3883cd44f84fa3d9, 0x111abd7572c09110 },
+        { 0xd5d2f31fdb30e0a5, 0xdf678d2edf509bb6, 0xff090b270b67551e, 0x37ab877a1e7613fa },
+        { 0x6519197f220671cf, 0x4f61684e9f9a80cb, 0x536111e96ebe4cd4, 0x2fecbabb146add28 },
+        { 0xef9608e28f0127b6, 0x0993019d5eef2987, 0x05461f21eca3eebb, 0x3101ff5696b4e737 },
+        { 0x13547b9d33710473, 0xcce379889ca6d9dd, 0x0806e7084864b2e1, 0x3de70fe0c43c61c3 },
+        { 0xc4b1477a8f1bcc9c, 0x6eaa01fbb6b93777, 0xa7dbeb76b0be7ae8, 0x000bcacfe8a237ca },
+        { 0xa7636c7f8a708e26, 0x1e386f81c09a00bf, 0xcc509525c479d090, 0x31bf3fbbb28a3841 },
+        { 0x06cc1854e9075670, 0x4ce5df113a88c840, 0x5f69dd580c53d105, 0x3c4282689be35250 },
+        { 0x209362f5a2516d84, 0x76893b16a6906512, 0x2081edfebe2c537b, 0x1aaf478ee4e5dd2e },
+        { 0x3ec2fa847a488a57, 0xcb434d8ea8e91cc7, 0x848a121cb4610ee2, 0x1bc433e8e9d4076c },
+        { 0xc47176809266d171, 0xd0e45e5e0e5a550f, 0xaa976de382484a3e, 0x2b0c161a657e3185 },
+        { 0x3b9f405110e8e97b, 0x009f6786496b56bd, 0x7767a1d005509eb8, 0x2d5b2848747802bd },
+        { 0x097ae0ca15cbf855, 0x266a46d3237b2dae, 0x8acad51bc539bf0b, 0x0e65021422a75fef },
+        { 0x3f0efaef2b7e7a94, 0x95e9a32003b41e1a, 0xa8fc16970050de18, 0x34778bf73644ae1d },
+        { 0x34adc56bbfb3ee55, 0x035be41bc446b0b6, 0x274bb3b938948a1a, 0x17257ef52cd00663 },
+        { 0xf224742d7e9cbd08, 0x08cdebab68684515, 0x23661214f405483b, 0x2360688f810accaf },
+        { 0x89cecef6901c4098, 0x2b23bae1070bc3ab, 0x871c04f755380d22, 0x274227af7f11b1b5 },
+        { 0x267881ee279dea1a, 0x9d4697b7883f0f7f, 0x299810c34421cdc8, 0x2b76a04d50d2d94c },
+        { 0xda3d01fab5bf4169, 0xbdfa80a36af9dd57, 0xdb4bd6dd270cf567, 0x21410dbf6461c60f },
+        { 0x3135e57f24b2cb0d, 0x789ab138d9ac4ba3, 0x3136165b751450cd, 0x3d52e102bf469de1 },
+        { 0xdd157553c511d430, 0x4a9b8879cb515310, 0x18cdf9bc0783830b, 0x11bd78819c2eff24 },
+        { 0xbfa71f3b21c83889, 0xedac5347f9ab289c, 0xb2fc8bf648d833c0, 0x1cf26d589aebf9b4 },
+        { 0xe4079a4b2eaef21b, 0x429b9ddefe84f669, 0xfb3d84f260d449d7, 0x09aa1e8a1204f804 },
+        { 0x5cb22df26f3d7515, 0x42f6e4fa8745c1e5, 0x287c5dd8566ce97f, 0x2684a2370139b7cd },
+        { 0x2fb73eaa1d18f089, 0xb6c2727c70f4effb, 0x4d3351a6d3a264e3, 0x3623f4afdfe0b577 },
+        { 0xb1d00baf70b53f2a, 0x3ede5f7150e5156d, 0x68fa04f0798fe551, 0x30682c9819c8bded },
+        { 0x4e6fd1134d6147ed, 0x926c4bedbb2b55a3, 0xe502b7c5d99ce1d0, 0x3fc78e03e125eed6 },
+        { 0x65a48ffd9908f633, 0x8be3d33c2f034ad4, 0xe8ea04f25d93cf27, 0x1218a277a2bde0a2 },
+        { 0x28ef8f950e3f47ca, 0xc3442f248e6e0007, 0xeb9bedddd071b5fc, 0x171bacf1840aa897 },
+        { 0x210f1e260f9635ce, 0x8ccd3f2cef43223d, 0xc0d90d265bd2b58f, 0x24d03aa032d8c666 },
+        { 0x50e8b77fa5b2a757, 0x2fdfcc2a834ae67c, 0xe29ea40724a6dc68, 0x2adf2a6a921b915f },
+        { 0x84c7dd6505da211e, 0x575e772d20631ddf, 0x905fed48415d4b0a, 0x11e50b6a998de30a },
+        { 0x366c2822daf5c5fe, 0xbf9762ac009d6bdf, 0x4ac892b7f2d5da17, 0x0296b6324361d57b },
+        { 0xca0c68290060eff9, 0x30c38fd23cb1aaa3, 0x406eac90f9ec0e49, 0x3da267a3ad613dd3 },
+        { 0x0c553fe98d807664, 0x6718cc6397288fe3, 0x38d73db677f3ff7c, 0x21ec5311cc6afe63 },
+        { 0xf233c26d67c2d8a8, 0x4f305f250416e4d4, 0x4d751439b72a7452, 0x35a7e3dbc8a0c5ec },
+        { 0x25cb6894e72d1f0d, 0x9819f2a581d445b8, 0xa7f125b33b3c2ad3, 0x0a83afdc91610ae4 },
+        { 0xccfde9effae4ee22, 0x3ab2930a8c09ca2c, 0x19c422c214d66b0a, 0x2f414b6fb24318ce },
+        { 0x01256b9f5b676f4d, 0xf0818ec2a78a796b, 0x7eb4f420fcb381e1, 0x31cd65232ba81a27 },
+        { 0x12a0b2b972d039e7, 0x4edd7d652d3d5edd, 0xbd23a5dce551b7b6, 0x2f1a8d770538027b },
+        { 0x7f7344807bd07590, 0x92bef3dedbcf4f47, 0x1805d754129592f8, 0x1e1c5b1f50c5aab3 },
+        { 0xa2a4359f0105edad, 0xf830650904e41b42, 0xb6fabafcaf6e0e64, 0x1dca573f437bbce1 },
+        { 0x59b19e444193c7be, 0xd91aea9e94ee36bf, 0xfd9693a25d170c8b, 0x3e5ef7cb5f3233b7 },
+        { 0xb176cd90f42d3091, 0xf42332b25ae71c2f, 0x1c117bb2314c3be4, 0x315bdbd9138291b1 },
+        { 0x7f9e8d44f8b74610, 0xac07886e7a9c98b0, 0x624919340f65e825, 0x06dff8c2e88965fe },
+        { 0xd0614cb5d0aff490, 0xd930c9329e32e3a5, 0x3bf9173aaa4c379e, 0x28753512126c0962 },
+        { 0x51538c2a21d9d19e, 0xd21a0328dedd25fc, 0xb9a17056d5829bc2, 0x37b343831b817a7a },
+        { 0x900b3ada0e230536, 0x91f80dfcbcc29ecc, 0xee174830b2c664f2, 0x39c4cb189ae1dd6f },
+        { 0xc7adfec2d103c031, 0x8c848f8877808853, 0x752b38222c65caae, 0x006fa7c76696f70c },
+        { 0x69bf678bbd7e9112, 0xcbadc6e6ef547972, 0xa0921be0a99d7329, 0x301b7f8b68bbd439 },
+        { 0x6a0454424810734d, 0x0cb567fa79e8abb3, 0xcd1e19b657dad111, 0x1d00cc6c213a6848 },
+        { 0x54b062f4c07a2950, 0x4c61761bd4932599, 0xfd4f0bb564a4ad22, 0x042ad7147dce5716 },
+        { 0xffbdd6af34131c65, 0xf9aa627b85c0a231, 0xc2bc4866f541d973, 0x0eb093f731e64151 },
+        { 0x7ad1acdf6b620e3f, 0x6448dfb8fdde7c75, 0xd0e45a4e67e44d3d, 0x0b3af5519ff46453 },
+        { 0xe9e03722c31f24c5, 0xcc469e0c5d9384c4, 0x007750739f336262, 0x006bae36811dfb2f },
+        { 0xefeb89e747c7f5ca, 0xf8eb4f73de3657af, 0xd7adb6168cb630d6, 0x29112f2cc194d1a3 },
+        { 0x5d689a9971b0cc5d, 0xd70b4ccae9e0dd0f, 0xc1b783ac3799f7a1, 0x2739ef9cbc192a69 },
+        { 0x959bd6a111866e9f, 0x009638f48d1684bd, 0xd8ef68a0f4a2190b, 0x2c377d0e31e5afbf },
+        { 0x59dfa5f5f03b1883, 0x034417d591e7eeb0, 0xbf9ffaa747288649, 0x0ab1c08500885427 },
+        { 0x5191baf535f5321a, 0xcb853047ab8fe3d5, 0x0d62d6beaae32c8c, 0x0e8a794ade3d342d },
+        { 0xc58148874e24d478, 0x15fda58157aa8b09, 0x7a01982da130b60d, 0x2b34b2ff53e47eaf },
+        { 0x291bc213d82e307b, 0x8d64347fd43cb9dd, 0x35232a2dfcb1cc89, 0x28f3a2f6893e2dcb },
+        { 0x9d6784df53db6c92, 0x105dddc995091184, 0x798603207a2de294, 0x2e64d16e1ec3d3f1 },
+        { 0x33d40a75d46b31b0, 0xa84edebb3b9a809b, 0xcec9908e8d548159, 0x1b75071b27200381 },
+        { 0xf7c4e51ad3f63d5a, 0x0fe51fbe828aa8c3, 0x097689c0fd70ebb6, 0x297ae12959c3edd8 },
+        { 0x99575ba36ba10622, 0x520c4774a4af0ae0, 0x4e1c61d45d7fac15, 0x0429642c99183fcc },
+        { 0x9a4b5c7e5703d3f2, 0x06a61d7d35a8c75a, 0xa5bf38d0cf9f9045, 0x30fc24e8f1f5d995 },
+        { 0x01dd5b08ac0d9e5e, 0x284203cacdfec948, 0xb31ca2dfeec90ad7, 0x31b2d1aba3da8a21 },
+        { 0xc813e48839de07a4, 0xf01c0cdb46cd1f38, 0x0be4e49e75ad8430, 0x098aefb285a1cbe1 },
+        { 0xb602f4fca98b8963, 0x131007c39eb29554, 0x17896389aba2d14c, 0x0fd6f4c9a38ad275 },
+        { 0xa89f2fa10609db00, 0xbbfe275d61f21a52, 0x2b68de1acdb16d6c, 0x0d63b219c8965c68 },
+        { 0x6b3dd43fa9470b4f, 0x67a2eabb23d86cb7, 0xbdb7d9d086af4fb3, 0x31b17120a190f457 },
+        { 0x168a2e0cb2885548, 0xaf79012c37f8172e, 0xd935f20155798410, 0x2b588044dbe591dc },
+        { 0x12066ceda9fac9c2, 0x72c288725ed246b1, 0xa213a46da780bdfd, 0x0153080c7c4784b7 },
+        { 0x449155896ec48552, 0xd270194ea0f5293d, 0x57cae762fa448130, 0x02713f071af366f8 },
+        { 0x14945b82811b94bb, 0x54a0c7b9b83a385e, 0xe3e2a2500bec654d, 0x178666ce0a2969b4 },
+        { 0x6f4da3a1c72bdc81, 0x81ef22f025ea0152, 0x4521b6e8a5211943, 0x350c559c6c1af9db },
+        { 0x6bef5839803758a0, 0x7a1e690faaa999a0, 0x82a49f325d6748a4, 0x120ba3f69e9d3464 },
+        { 0x9113a26e91d11b4c, 0x3035680c5fce84be, 0xd5768fe6a06619f8, 0x201d15a418d78b1d },
+        { 0xe0e2e441f5f874fc, 0x4bb4c050d2e0228d, 0xe0385427a85a8455, 0x06daf5da8dd5c524 },
+        { 0x125320cae48c6465, 0x8c21ff84a22c0ae8, 0x443f732bac5963ca, 0x01fdb32b86206078 },
+        { 0x24628a227647da24, 0x885bb7178e8e291a, 0x77006baaa6597bf3, 0x2844c50323506cb2 },
+        { 0x3184fc5d60bb9bf9, 0x9648cd44d9981358, 0xdf8a3e153d992ce1, 0x1346169d116c1133 },
+        { 0x2956ab1cf99dc00f, 0x431770c22d2bafb2, 0x36448102f8abf719, 0x2db1750cdaf0cee9 },
+        { 0x4c8a43e8180ae752, 0x48b7836693faeedd, 0xa0b1ca3bfc6e43c8, 0x028320ad1fe71bf4 },
+        { 0xbe093c18e7b855a6, 0x03645133b5194020, 0x22bfb377a4ecbf74, 0x144d8dedaf31ae6b },
+        { 0xdf3dfa2e134f6b08, 0xbadb18fc37c88f48, 0xa2541029b1b68e77, 0x1e67abb4578df441 },
+        { 0x3b800374cb755095, 0x425de5c1c3be1c79, 0x4850a86bd05d776b, 0x1d6b28b2fe2ccf72 },
+        { 0x537c66a87d65d56f, 0x95e4857a9a710df6, 0x0aa6bb4298422320, 0x07d6e95632e4e638 },
+        { 0x6672d4749cfd3a00, 0x386d945b1ec1d0cb, 0xa56516b624a208c0, 0x02b250d4be479952 },
+        { 0xd350f4231d6c93dd, 0x12b36427e8b2d0f3, 0x0d06ff92bd8822d2, 0x33af4ce005bf45f2 },
+        { 0x0cd7507eb7b55bc5, 0xa263e797e6c2c902, 0x18ace1b6ccf172f8, 0x241db4ca8027ab61 },
+        { 0x3f502d8bd60a658c, 0xdee72f391f2a8af6, 0x6347363dbdaad799, 0x0b06977a1843472b },
+        { 0x7df2b48d2ba4e3f9, 0x86734a68a73a503a, 0x967c8420baecfefd, 0x17f7623c1e40a530 },
+        { 0x1bfa56fb4aaabae8, 0xaff93163ca29073a, 0xc7b72768fe61a5bf, 0x04d6d5c44e43079e },
+        { 0x7eabc06df9e4c911, 0x1ed954e2f83a6fa7, 0x4c5d50abef4336d9, 0x1f51ffd150a7f153 },
+        { 0xcc3c13473f78b062, 0x46c6f85e812d402b, 0x5757f301ad1c5dfd, 0x32084ce077c544d3 },
+        { 0xc94f48a493f8fe0e, 0x96d6da03fbb6ae61, 0x0c9a98327b122043, 0x0728d91736275805 },
+        { 0x603b6ecb81de5cef, 0xdc1bb50cd23c9a0e, 0x2297fa371def7d35, 0x09cb9fec9ef0b8f3 },
+        { 0x2b80a1d30a9dd6a1, 0x8d382980411701d2, 0xd2468c4cb3fd087d, 0x0e167d69351a7c5c },
+        { 0x68fc847d59813715, 0x6a8e3970fda1d28b, 0x662ad7e40e6d1bc8, 0x2325b6a51f3c267a },
+        { 0xe33310f79ca44bd9, 0x552002731d4a47d2, 0x97c0b9adfaad9ca3, 0x369da36dfbe7c978 },
+        { 0x4a50a6fc4e3c8662, 0x7db86ddb9b045b0f, 0x56d94fe203e9043e, 0x1033d99e56dbd8ed },
+        { 0x7e44b8d73a786892, 0xa5d5cd16e481d533, 0xc3085ab6c91169e7, 0x20e9ef6e2af5a507 },
+        { 0x3964a14b0cb4c031, 0x4d34f2cf1ce70d3a, 0xf38f2ed424fe6770, 0x2d42692d3a518849 },
+        { 0xd21ea79600f788f2, 0x4b2aecb7caed7cb3, 0xb2bc6f7c99beccfe, 0x0cd1e1d78aefc17d },
+        { 0x26fe0fe86209cea0, 0xbd5174c4783ec98e, 0x852ec447c38126f8, 0x34d7163b6c92d8aa },
+        { 0x40a2e6215c3ad9af, 0xdeff3358c1619a5e, 0xbd4c539dfc81a9e4, 0x1690484391b881f6 },
+        { 0x93786d0945d6f1e8, 0xdca475eb5c1015f2, 0xac0b3137e50f8654, 0x2600a50dc11d39fe },
+        { 0x8b820efaff2ba76c, 0x2c5b92011b557d36, 0x91744383d38f9890, 0x2e32d4e725f653e4 },
+        { 0x5df53088dcbdff5d, 0x96af975a50ee84ec, 0x3e35922beaf5d63e, 0x321cb9f56d99afb6 },
+        { 0xc9e50b56335d565c, 0x074fcbe5096a2b30, 0xecd8386297119c02, 0x189c588fea94f270 },
+        { 0xe301f2b9baf76cdf, 0xfce5e803ba852389, 0xe6d7cfa2d92e1522, 0x13e773e1789d3333 },
+        { 0x6d39f465b033a52e, 0x3f758d9dc6d53f72, 0x8c388dd62614530d, 0x060ee44fe0835ef1 },
+        { 0xfd4310499fcbedc1, 0x7d53dc190a790ec1, 0x4ae7b9a65a618bb9, 0x1a282a83f53f3f7b },
+        { 0x7f1bec4c0db107fb, 0x2775e9b0addc0c21, 0x4dcae35c0300b7ef, 0x098edc68987927cb },
+        { 0xdcbd90621cf1469c, 0x9dcb672f7a9e17b0, 0x1935ca2aca0332e4, 0x3a7084a709bd5fce },
+        { 0x57702dea046ece58, 0x67fc35ff8f6ec89f, 0xe9f7a55df3d72942, 0x2ac147a8b535cd20 },
+        { 0xf0fbe984e6275bdd, 0x2d8c87297981505a, 0x7c6a521771f4fa9e, 0x1d07fff53b61e791 },
+        { 0xbe966050647b09f0, 0x6bb488072d1bd3fa, 0x1331783459fa0963, 0x114046fc9eeca544 },
+        { 0x8a7e379f0b5fa8b4, 0x70e6b0e9a11613f1, 0xcac684d57ced4777, 0x3b2e462a4e1c10e5 },
+        { 0x54fec22d7e688c65, 0xbf76eb5bb8d63bf7, 0xe71743839a99c054, 0x30ee499d2c820066 },
+        { 0xa4b0f12ea958d60b, 0x6ba0792b96e0acb8, 0xf4736e003babb07e, 0x1b3857157eeeccdf },
+        { 0x7459d1c946c5c2c2, 0xf79e22e0a29d0077, 0x2aa1798f3fe85096, 0x329edbd1f702db95 },
+        { 0x907fe2f57dc59050, 0x40f40997c285aa1e, 0xbcb7ef86c9fdee5c, 0x063726b54d30c4c1 },
+        { 0x2b0dba58d79db0d0, 0x2ebc2b9e7b908dbe, 0xbde9162b7dafccb8, 0x1895486f6172da3d },
+        { 0xe350f07da3e273b3, 0xe30cda43013b3c2a, 0x2b39f9bc273709c4, 0x16b0cd8fd4b68fcd },
+        { 0x729c8af4a046ea4a, 0xcc0efbe96d009c66, 0xcf2ad68ae06bca54, 0x3ec11a462b2c32b7 },
+        { 0x0ff1ec7768acc9ef, 0x9c1f89b24c5cfde1, 0x86dab631a85505dc, 0x0b5de632960590ff },
+        { 0x2e3e009be74084fb, 0x9c1bec81028a7d77, 0xfc3f2c9dce8e239a, 0x386387cde4f9ff7c },
+        { 0x8ed5c19a6573d90e, 0x73cd560a34ead1a2, 0x89b5eceb48a32a94, 0x13548b95cc934d25 },
+        { 0x88722e0837ff1ddf, 0xc7d68d31497933bc, 0xaeddb8d0d1e0e48e, 0x3ec45de660e4ea65 },
+        { 0xfe3817b9c984dcbc, 0x9c6927507a64ffd9, 0xb5647579cc4599bb, 0x3530e43cc74933c9 },
+        { 0x18219b91a9a19db7, 0x83f84db029240366, 0x838090daeababb07, 0x1573cd891a00656f },
+        { 0xc50f2ef90f54caae, 0xe69cd8e3f6271693, 0x5edb366c0aa51e50, 0x05ac068007099ee6 },
+        { 0x3e9bfd76b2de91a9, 0x26e31af6ddd5a8f8, 0x8cab68f10cd1dc61, 0x0058d7f36b1b4ce1 },
+        { 0x95a009a708442ca6, 0x87fd620026266b7f, 0x78574d3e560692c2, 0x23d37c4f4ef7ae7a },
+        { 0xeb108d7749c2073f, 0x5f8c364e5df721b0, 0x330b5fcb1662c773, 0x0a81384ea24346aa },
+        { 0xc487b89c76ddc4f5, 0xa73adc3e7bacea41, 0x962e171baa04baea, 0x0ebddc11b1eacca5 },
+        { 0x43f37d722720b311, 0x8dd00b8d8832d9e2, 0x969b703934d6ba66, 0x21180adc47321c35 },
+        { 0x2aa3f001a76f29a4, 0x718b035e96ae28c6, 0x58c45a9dce108f46, 0x163f2b0b40fbcef4 },
+        { 0x72be9c5138f11917, 0x39b7a24af113a7a2, 0x5b7a0a9c3348e70b, 0x2e9f267f5328dc4a },
+        { 0xe1240ac0abae9f73, 0x8b92a1def51c9797, 0x60e9dcbbac66d897, 0x06038b23befdf743 },
+        { 0x81f3f4bd83053ff1, 0xaec8415f2e00008b, 0x1a01e1b64daff163, 0x2bed6f27a269379b },
+        { 0x1c901151cf41ef66, 0x7a6f9ee8b1e41d22, 0xcc833ed212fb6f00, 0x39e9c40d9d0e895b },
+        { 0x1e032c346ba26ec0, 0x64ab8db9d3482c11, 0xce0ed7588b228a7d, 0x2e14238ea7e1e308 },
+        { 0xbe940f378a8806c8, 0x90c287e0ec759aad, 0x5c0594402a0d3a83, 0x063a5f12d98641d2 },
+        { 0x499bebe70eedafb8, 0x751b09617286987f, 0xce3f2b42b08b301a, 0x1f2a5ebeea10dbac },
+        { 0x927bb525aee19138, 0x6bf0805513e852ac, 0xd055c9f67a13f1d5, 0x0967f3f68b6269fc },
+        { 0xf45735aafc3355a7, 0x4bc4eb7bd9609e09, 0x424f5b493df35634, 0x2802247f49d90443 },
+        { 0xdea250b55c677fc1, 0x3e4b19373ea97f14, 0x5634025e71c0e651, 0x0be583cf68657982 },
+        { 0x3efa90a0623428c5, 0x5fc4e0f19a89f05a, 0x3261b16160833db3, 0x2d52ef6790caf9e5 },
+        { 0xd0cb8b34d9e4ef28, 0xef1a940812309f80, 0x4f97d726dc9b8c09, 0x2b6e83948a660fb9 },
+        { 0xc5a0bdbb5230f5ae, 0xf217904e188b1cf0, 0xb0c1a7e12c9a7c54, 0x0ba55560ff2b4993 },
+        { 0x052830b29d8aa445, 0x2d535fedc627ad54, 0xd37503330a44070a, 0x153190f4233e8839 },
+        { 0xe8d8c7738a7ac81d, 0x0a93e47c7fc75e11, 0x44b36ada9d7d223c, 0x09f417eb431aa237 },
+        { 0xa3ca538d9094b251, 0x46f08e5e8a0d2c09, 0xc735fd6f83ddc4e7, 0x18170c329f62063a },
+        { 0x6b7d22454fb7214c, 0x67587205d7d7a575, 0x80157dec45f46581, 0x3ccfbd07b7a0ff57 },
+        { 0x1e8d11841db6fee9, 0xff6c42c7e6a69297, 0x0e5293da1938455e, 0x33340076864964e2 },
+        { 0x1fb2141f79c5bed7, 0x3ce07f32269e076b, 0xa5db6b52d67fd1a5, 0x13cc2c2f8bcf4c6e },
+        { 0xacd17b4113622450, 0x9c4a048e829a7b2a, 0x96f51f764ba0d0c9, 0x17dcae1dc569f514 },
+        { 0x168c8cb01fd0260f, 0x396fcdfbb8bd3c37, 0xcbbadb2898f3b53e, 0x0e389173a103c388 },
+        { 0x477580b17b775ead, 0x10c02c390187830e, 0x874970ab5a995966, 0x392b8ae93cfdaefc },
+        { 0x4eaf20cb854f7122, 0x1bb4dd0286a88012, 0x92b8079cb94bdba2, 0x269dfc3099ed62b5 },
+        { 0xf04a8e6d0f502448, 0x122577e79c9eff5e, 0xdcd733992bbb06bf, 0x07d3879ed0e727b1 },
+        { 0xf302fb2af240b124, 0x05acb977b994a811, 0x319ca3fb026c638a, 0x0061c4b15ddfe784 },
+        { 0x5869aeace39a1df9, 0x64e5c86cd6d0b4af, 0x3427a11e40e42cef, 0x38fcfd6c4cae791b },
+        { 0x3b352f26c614e29b, 0x6e7b714d58e5fb6d, 0x095b2c1f2a059798, 0x010b186e9a2bfc90 },
+        { 0xce942f6db427489a, 0xc87673c598424fde, 0x0d5aa5a082e7fb37, 0x2a09aebdd1930fb4 },
+        { 0x32657516043f45e0, 0x4006f29fee77e428, 0x8033c929c7fae6d4, 0x28dd1d625e4d16ea },
+        { 0x38ff212a74aac49e, 0x92ba6949de6a06e5, 0x96d08be83e2557bb, 0x0e6cccdcd0e4afdc },
+        { 0xa9f77c485464f9cf, 0xd58e9dffa1c9e962, 0x2ad11698b4a645e1, 0x05d2d492546d1c57 },
+        { 0x3aa381859f350a51, 0x750dba5f2c295ad3, 0x4a7d43a277a7c43d, 0x32bd5f2fcefca309 },
+        { 0xaf1472a7d4b83662, 0x1e0113c7a4e6a6d4, 0xf34b8424b72fc1e3, 0x0ad5c0ec251505da },
+        { 0x33482b5e09388a17, 0x1b339aca859a2a33, 0x987e75f47eb3c071, 0x03f625fbccc6a147 },
+        { 0xf4749253735d8d74, 0xa5e38bccfea5f5bd, 0xbde030216c4316ec, 0x36ffd53abeb17c14 },
+        { 0x733ddae585702efd, 0xfef10d8d54e1ebdf, 0xbd7cf337dbc4108c, 0x3c41a8112aec7ea0 },
+        { 0xa0b69d23ed6a3a55, 0x08a8d06ba0f535de, 0x2d486cffd3efe072, 0x1e00aba38e4e36d3 },
+        { 0x34bbacf688189a05, 0xd14e73349c70287d, 0x7ffa6de0f36ff721, 0x22528de8c498fdd9 },
+        { 0x3b7efdb92be5cf67, 0xe68995059fdd020a, 0x6c96cc4451316d37, 0x0fb82601920fb679 },
+        { 0xd53d17ab5f0401be, 0xdc4cc9f792cbb654, 0xb31262b04ee50e4a, 0x0a1f6cff0d7b266d },
+        { 0x4e1c0d3d8e36de9d, 0xffc8136f954ea0f0, 0x9810d2df1254317a, 0x28906006076a3574 },
+        { 0xf8f02394b84cdae8, 0xa215e3d2d9b6a13a, 0x78dfce88d2807068, 0x2b7a09e0ab127d3c },
+        { 0x1ec6e03d324d248f, 0xda0b2948488fc912, 0x4585d9718f080727, 0x24e860287129cc5f },
+        { 0x859d2d2c75a80d9d, 0x92b53aec94d64c2a, 0xc10aeb559e00dbdb, 0x124f2d64f4a223f3 },
+        { 0xe867c4dbe677c170, 0x19bde0fbebf5256b, 0x8ffc72c751431639, 0x0b99d3e4bcd697c9 },
+        { 0x13c0db4c91a044ba, 0x078b8a890bbea236, 0x7630f615963911eb, 0x12f3b7c032d13163 },
+        { 0x510ac2a394814913, 0xeeb814329a6a2b5a, 0x9f9db71c12b9f83f, 0x14c8f8b365576e48 },
+        { 0xff7ef7faaa6a166b, 0x5b98d4650d648c25, 0xcdbfb5aa9296b301, 0x268905e5bf703b3a },
+        { 0x2aaee3b5faba8641, 0x22ea4bae41eb6d91, 0xc386f89ba0576481, 0x3e5eb63d539189e9 },
+        { 0xcf8c1eeab5752831, 0x8126c27cd690b9b9, 0xc51b0ce2f7b9f57e, 0x2e4634a3bc868377 },
+        { 0x47b6d53f29cd2ce9, 0x5773980b302aa88c, 0x03b88503186e1c6c, 0x38ed77c5753270f5 },
+        { 0xfc0a19b9d5c99da9, 0x9d29499f033d8e03, 0xda50d4b2219fe9a3, 0x10a950fd08b43b6b },
+        { 0x9524664766ae2f12, 0x406244e3c26ec2d1, 0x8a60941e0777e1eb, 0x33c24690ebae0ab3 },
+        { 0x555eede21df5f63b, 0xda9e2ced779b2b81, 0x349b487dfe041ebc, 0x24781d33aa03fc0e },
+        { 0x76c5ed571697dea6, 0xeec6264682aaca17, 0x41532b0c48e22ca0, 0x2def22d0812abaa6 },
+        { 0xa5484ed21da8dec2, 0x6cb66c9ab6ba75fa, 0x892799c32bcf58c5, 0x040fb4653e4c18d5 },
+        { 0xb0c6b53be7ffa7cd, 0xdedbff861d53af81, 0x04edd2ed05609dde, 0x30c311853e7859d0 },
+        { 0x83d4e75beac4eb84, 0xb2e3ee919ffe9176, 0xb804bf4d9ccf2af3, 0x3835f8f8c015db81 },
+        { 0x9df9fe67c813469f, 0x4159bee1399990df, 0x3abfcbddc887d0bc, 0x259eeb9a73cafc7e },
+        { 0x044fee1425c5abe4, 0xbec4b23d9213dfeb, 0x7059ceb89a438bfb, 0x178e13bf2878840b },
+        { 0x107cdf5a9811192a, 0xcc1cca83591d372f, 0xbe42ed08eef40fc7, 0x05adce5c56b2b002 },
+        { 0xb90c43b6aed5528b, 0xa3c18182087588f4, 0x4f2ca0484de9b9b7, 0x207aeba6c49441a3 },
+        { 0x8e564268b170ed40, 0x5da1e3ca07c4b725, 0xb53f1a005258de4a, 0x0d468d7a4d5ecce0 },
+        { 0x02ee284aa1a8ab02, 0xca0fb1b53258a76a, 0xdb775081a8fef2b9, 0x229ed8dc053a6340 },
+        { 0xb7402a30e16bd01e, 0xef5702ab82cf26be, 0xd8cd39d8e48e2bee, 0x24df72a8df192fca },
+        { 0x1ad812cbc45c89c5, 0x1d2f14dab419ef03, 0x82728ba077be588e, 0x2a4979935a41843d },
+        { 0xd3c213e233f7c37c, 0x68826b105299246a, 0xe6a40b77b73a8194, 0x0166b36931c13b62 },
+        { 0xcd6e6764852c077c, 0xe2974ae1a9331f98, 0x83c6a633d15d95a7, 0x2611085ad2258807 },
+        { 0x40dca2ae928c320e, 0xf146eb8677bd7cf2, 0xc68901ad27f5a325, 0x0c38a19d32e8b293 },
+        { 0x82e212783bbeeb94, 0x39a030bd965d2c66, 0x9225c8847e8df27b, 0x0448be1c71243d61 },
+        { 0xa6a63daa39cd43b3, 0x798aaff4f42691e3, 0xab63e475c72762ad, 0x028389f18c2d1046 },
+        { 0x1a0b839bbb811476, 0x39c6326fd03ca25b, 0x87dd476b33a8ff14, 0x2f44cc09099bd3d1 },
+        { 0x722f239642374b8a, 0x0092a7478f7cff4b, 0x32844d2207a1686e, 0x1d05da84f7a9aeb4 },
+        { 0x6375ff75ded8e1f4, 0x19a424043337bf8f, 0x06040341133802d6, 0x3dad70b70f00d85a },
+        { 0x8b762d0d1e9332c8, 0x37efecd671c866fa, 0x8fbd5a842a61e83e, 0x299a59635be14c79 },
+        { 0xfdae7fb22432488e, 0x2c587668d7640275, 0xf52f3f73d9b5cd36, 0x32edf6f49030d245 },
+        { 0x501741019db3a03c, 0x388031d5b7afc441, 0x49bad278927307da, 0x1166f5b64e1484eb },
+        { 0xbea9cd705a8bd0d3, 0xf41eac9369e389fd, 0x066875334bd1e9e9, 0x2b1dcc18874f7f28 },
+    },
+    {
+        { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+        { 0x3f4b89667f4200a0, 0x99fe6ed9ac8c9a8b, 0xfabcff5a5a833bdc, 0x2b90f10730dea533 },
+        { 0x5ce10b11994471db, 0x27cfdb4356c5a334, 0x653e9ee6655ec9ca, 0x270994be59ee1688 },
+        { 0x18f10e20291c5308, 0x4a6d3f5b502943ab, 0x2276dd3ec67f9891, 0x3d9be9ab3dd536b9 },
+        { 0xb45bc2aaba470234, 0x088caab990e6fcd7, 0x3d875ad5f8e62078, 0x334afd132487ec24 },
+        { 0x470a0ed37e9114ae, 0x0c3e81aabccff03d, 0xcd1987c476c7767d, 0x1ea92ffa85468fe0 },
+        { 0x91fde2f7df658065, 0x2afccecd85317bf4, 0x796fe5906f112187, 0x19b3abc5803346e9 },
+        { 0x08571a6129221b0e, 0x7228d981c375bb6d, 0xdf6a1dd7b95f9ae0, 0x1a0ca8592b65bf06 },
+        { 0xed015766aff08680, 0x2b8b67f06ff5e5ec, 0xfc1988e68a9f75e0, 0x3cf52321d4f161d3 },
+        { 0x82757b6f12eb4828, 0x816a545a5feeae83, 0x42225bd91dfec68f, 0x28de7026b18681e6 },
+        { 0xd2ac97a2815ddc9b, 0xa736f425a1d31759, 0x5ac9e2129efacede, 0x2a4e25fc31815723 },
+        { 0x52fdbc0963610dcc, 0x9ce3cbcc12e643f1, 0x38bd2a7d1a78296d, 0x3a3a04a01f4344ed },
+        { 0x2edda87a8c417156, 0x8995ef4db87e01b8, 0x2023cfeec0f4476d, 0x16384c253982f2f8 },
+        { 0x3789233c6ae99ace, 0x7fd91beafc9af27e, 0x220884b285ab2efc, 0x0bc068d33336982a },
+        { 0xa99bada560a9c489, 0xc7290faa4212f5b4, 0xe6614a2cd9f3bd13, 0x00ffaf7099dcd6af },
+        { 0x35540a8f807ce222, 0x81b0de7052b07eaf, 0xfc74c04f5057723f, 0x26573a0f14273e81 },
+        { 0x9f91fe66f2205343, 0xfeca29bcce5ad423, 0x1a2dc566c531877d, 0x14cc054cda06fd17 },
+        { 0x9da1b2f02cbadf75, 0xb5b3ed61f1560694, 0xcae47e42d79c40d3, 0x12598e1e887158ec },
+        { 0x2c66ac16ae70110e, 0xa5eda03081973328, 0x57fb04055061ac47, 0x3b2f8fc22f7063f5 },
+        { 0x093f0d6c558a093a, 0x13e5da07cb66e926, 0x28c31786c1f815af, 0x05c61781cce65b8c },
+        { 0xf360f3eddb77f541, 0xbd18c563de2357b6, 0xe5acfc51f5872ff3, 0x00fe0599f4f8fca0 },
+        { 0xac7a68cc0da52fcb, 0x6e2036eefeadbf43, 0x98ef817899035ea0, 0x396a983613e7c3bf },
+        { 0x5fbdbc2a65ea2317, 0x2f2e1750359781fb, 0xa3b3516ccc0d400f, 0x0ffa852ef810fabe },
+        { 0xb111c4a0f86a8238, 0xb2dee1c0cf5a02e8, 0x65f59198645bbd94, 0x09c63c3ff882649b },
+        { 0x59a4835107913f56, 0xd49f1f79a5784eb9, 0x0a608357d6b4f355, 0x1667845d9fd4ed90 },
+        { 0x1dc223f64e2d9057, 0x95ec2cc0ff7f6846, 0x982280261bfb70b1, 0x058a13ee151c220b },
+        { 0x741159aab8983ec2, 0x3b9ef5cfeba12f92, 0x52b2abcd4880fc74, 0x2a9401762fb529b2 },
+        { 0xd0230479ccd0f017, 0xba252eb3d34e96f0, 0x9f2b0c5c1351bb35, 0x2e07c0a1682f44f6 },
+        { 0xf6b2fbf1682e3626, 0x06a20dd82b66a7fb, 0xbcde76fbf83f1eef, 0x3faaf580ec1abe2c },
+        { 0xcf1bd5180eb6c09c, 0xb579bd5ea8526e03, 0x2ab7dac85ad26367, 0x17eb2e97f565f843 },
+        { 0xc2b08580765354e2, 0x60044e226bef2fc1, 0x1e6fabb6e31bbeb7, 0x07fc1d14bc09f095 },
+        { 0x79848b3f39dc24c9, 0xb9ff13f4465eb6c2, 0xfff048b4b2393610, 0x24fbd5025bdcb466 },
+        { 0xe633f8bb035949c8, 0x218023c7703f86af, 0x792cf89e6c9e7197, 0x20c7f44ddf560f7b },
+        { 0x0ae4a1e379037e82, 0xb22af2b8a8bb1c93, 0xa26b4e68c7a977b4, 0x26b58bd08045f402 },
+        { 0x9826eb9c13a21203, 0x8cdc5ea06ee1d4ac, 0x9a2b7dbbf5faf595, 0x2b215aa2e8899277 },
+        { 0x2e4fdded67dad1c2, 0xbf75f3d274235bca, 0x9966609d1f7ef5f1, 0x2541d7cca45bc62a },
+        { 0xcc43f1f8e8878f1c, 0xd9daf4ed75e858ac, 0x883af7c742580344, 0x165a53e0033a3398 },
+        { 0x2b21c076a961e752, 0xe84f46cf587d5e11, 0xfe6a78e7b50bcf88, 0x0841f96dff67e0fe },
+        { 0x7b20099dec3a86ce, 0xa82408a763641648, 0x882de935a8a58ef1, 0x29dd360fec2ac861 },
+        { 0x94cba12d6e13dd66, 0xdd2cdc2103cbe119, 0xd2f5dea12130feb5, 0x39667642798d0b49 },
+        { 0xd42d8b665f2e34a0, 0x0682d973e9b2ab4c, 0xa7e3932fbe770bd4, 0x03e446e101856195 },
+        { 0xda30185db7438d7d, 0x60a92726fbeb187c, 0x1dc351e9e3da0a0b, 0x378e8c30ad47e768 },
+        { 0xd61b5414d37c60bf, 0xc3721868631aff64, 0x0570b4faf5028e78, 0x0bc90acfb39d3d6b },
+        { 0xce9c1fb8829d1ee2, 0x22cae41b328462af, 0x3df93caf254e4af0, 0x06903cb5f0a4de3a },
+        { 0xc36798adfb60f45a, 0xd1e318632ec722dc, 0x192b0904079cc89a, 0x2b0fcf848f478aa0 },
+        { 0x369f417a37d50c7e, 0x28454db8772a1d80, 0xbe57604489f80d7b, 0x2631cb942f44ef8b },
+        { 0x69c9a223b20bc7b4, 0x6164c3cb2b807561, 0xd12a3884d8234250, 0x01b8cce784d66ef6 },
+        { 0x9dda57209f153728, 0xd1c49f7235b196f3, 0xc555fa90404c6480, 0x0357151c93ec6eab },
+        { 0x506f821410e8d121, 0x359b533e41aa6ab7, 0xc74ab09763bc091e, 0x11a0edd8ebf763f4 },
+        { 0xd18cfa354d2c3f5f, 0x27a18bacba24b335, 0xb56af58b4549c264, 0x2e72f2771b745652 },
+        { 0xd878e9485c687454, 0x1b73c1ba2637c15c, 0x1daa9343c61cc897, 0x174700795e2bbef8 },
+        { 0x6976058d5da82588, 0xaf3e4b0c35b4da7f, 0x5e6540319d9128d2, 0x195e61ceef6dfcac },
+        { 0x5120fcd05a363344, 0xe73dd4221f571ded, 0xdb68fe0421c07876, 0x2e650d525982bc76 },
+        { 0xc411111e5ddec77a, 0xf7d03628b494564a, 0xe8211ef57bc5bc27, 0x3b87d6e857b9a100 },
+        { 0xaab6712e6b004807, 0x9aa63440abec0950, 0x5842def1e14cfbd5, 0x350ed3bfbbfd75c1 },
+        { 0x449714a8e2fde1f9, 0xf377eb17120aa236, 0x9c1ecfd058fb967d, 0x2797ee3cebf1ee6d },
+        { 0x867854e5a0fe4964, 0x1c6f10b2dc848e10, 0xf705dffa5db86f0e, 0x09b618547283621e },
+        { 0xe83d0fd87d73fd6f, 0xbd0ec646bf3f0e14, 0x11cb9b8b774c41f0, 0x383893514317a005 },
+        { 0xff80637de34052f4, 0xc246f2cf5b9871ed, 0x722799f87ff1440a, 0x1de7bf2a6a556657 },
+        { 0x1c9dc21945a900d5, 0xd4a73ad4badd2362, 0x68a174e2f6b3eade, 0x208a244dc773873e },
+        { 0xa7cbbce8c29ea06b, 0x771855c429c5250f, 0xc5454372c14393dc, 0x2e0979ec73156494 },
+        { 0x80f7d13976058b9d, 0x4442bcc6922b80da, 0x7ac3eae6a261b67b, 0x04751111cb131d65 },
+        { 0xeadeb92ad84b5bf3, 0x80fec34cfb06362e, 0x480485c40993d370, 0x117f82a639b0ea04 },
+        { 0x96b12caf46e32d55, 0xe829453f1e792cc8, 0x856fb048ccde3797, 0x142295559d70946d },
+        { 0xaf57498aeb21417f, 0xad111b9857b84020, 0xb33940ace578f046, 0x21a8a87d7d902ba3 },
+        { 0xaadc8fd726ca0b45, 0x66a2f077600acb6e, 0x8395fa207328adcf, 0x2c010533e408e8a6 },
+        { 0x232fcf34b4d12d8b, 0xef7d2dccb25a26ac, 0x08e5f827552662f2, 0x3c5b954c6aad4a46 },
+        { 0xb2507f08c9a1f5c0, 0x4e40832d9e90c4b0, 0xce62f3d2fb7f418b, 0x3cbbb10a66e33ae3 },
+        { 0x63543181417b4365, 0x536dd991ad3cdebd, 0x1756258e91972387, 0x2a19584cc3db3710 },
+        { 0xd6c97e430bbc6fe6, 0x3d5fea8c34c4ab80, 0x6e5e8d44e7ec42fe, 0x3ff19e350a1757c9 },
+        { 0x2fe1b80894e433f8, 0xe778353a70e9e8ee, 0xd26b3ed9acbe085c, 0x03e6c980b256ea1f },
+        { 0x78c9d00619fa3804, 0xced4b65a3aa48975, 0x4046c319737301f6, 0x1206d137ea73b9ed },
+        { 0x78eab1be90f7f5a0, 0xedff969ecfe67eaf, 0x67095479016b996e, 0x3760122eb8bf2929 },
+        { 0x6521fb1e181baa7c, 0x06c452062dba4b39, 0xbde4c4522cd35921, 0x39fca520dc61fc69 },
+        { 0xfeb618ee9a449080, 0x4733e5b33a201f6b, 0x0a0ed65a5d43c78e, 0x011845ae8146399a },
+        { 0x72285313324b68d9, 0xbfad3e6ee8a95e23, 0xcff5b7b4a739e877, 0x195d4d21b9626ebe },
+        { 0xfc61fff63dd8dbbc, 0x1ba6dd6dcad5f496, 0x7b879cd83510220e, 0x3aa0b0e35430866c },
+        { 0x89c56d5e88ec9dc4, 0x69e891563fa6cb03, 0x8679bd9e5c743acf, 0x25063eefa5bf245e },
+        { 0xbde90966d6fa2d16, 0x096fd2aadad20d2f, 0x7a47d26771e83ac0, 0x1bf5e226af7f6374 },
+        { 0x27474a29f5766af7, 0xc84ca2827beb6c42, 0x9195135a7fb8aa84, 0x015432c77605d54d },
+        { 0x4bd4ea62256527f1, 0x996a49e10e2ca0c0, 0x95ad8d79b51f187f, 0x1e75bae856a7f0aa },
+        { 0xcba3b9e6b69a6838, 0x3f306312a15b1fec, 0x34e25f0d5db8a7de, 0x1c076806093a9039 },
+        { 0x0e39431641b66fcc, 0xf3a684f40a4d82d8, 0x5b0047150f164c9d, 0x098febb2543894bb },
+        { 0xe468758151d5c459, 0xdababbe79c9eaa2b, 0xaeb1daae65d54c9a, 0x19f5af5b49abe334 },
+        { 0x061afc359070180f, 0x2f36b0f8f605312b, 0xe5f8bbeb9300397f, 0x175feeafd5c774c6 },
+        { 0x716cdc8082b361f2, 0x8ec51bbd8aa0ab90, 0x2b1e662c39ac81ae, 0x309dbd15844f3521 },
+        { 0xdf948a96ae650272, 0x0bc1e7cae8dbdda9, 0x2e1ceed663b631e7, 0x03c92b2d307d6130 },
+        { 0xcb45321084d21c4b, 0xb0f6c7ec04957227, 0x4e5a2d2f824d8a6a, 0x098114aa49aa252d },
+        { 0x2a384076680ee644, 0x82562a7a7ac3bec0, 0x2cfca6700b8e544e, 0x10fc11d22202de06 },
+        { 0x2639f4446e1c698d, 0x9480b6c520e91c1d, 0x97170d03aa46e5b4, 0x04d0432b8a31374e },
+        { 0x000388d066cbce27, 0x410be24003e7a840, 0x85e5d2dfcf61bf38, 0x18fcab45cdd79f5f },
+        { 0x3dc855d7c01b6238, 0x7d9430d846848b37, 0x3a350da45c9de4e0, 0x3ec247fa603ee4c6 },
+        { 0x52123dd033d63808, 0x975423cf65fa3be5, 0x15fd40cdef61885f, 0x0142c1a582c9b895 },
+        { 0x98084866a6074816, 0x83e678eb98392e8e, 0xde7fc88b597d8f58, 0x011680e19ea039ca },
+        { 0x66fef68b6a13fded, 0x6f55fa9051d67228, 0xe5906c722b779f79, 0x3b7a2ce265e04d4a },
+        { 0x6ba435dce9be9ee0, 0x741b80917fc0315a, 0xbc95207ba813bf97, 0x21ac70b744d172cc },
+        { 0x2badb8769bc8bc8d, 0x721b2b19962451e5, 0xed122670c857ec3a, 0x087e51b5d5b60f18 },
+        { 0x9ef64d5baf183970, 0x2e00b75551374f4e, 0xd126bd64a4f2cc2c, 0x3475143766648b02 },
+        { 0xad1dd62c04770c5f, 0x69224bf379521405, 0xe067b55d489486e4, 0x34dcec05cd4c1d7d },
+        { 0x636a37c18e5a1d60, 0xa0b211836be72f2b, 0x6559feddc1ae436a, 0x110009784394bd96 },
+        { 0x0e299145bd2afc98, 0xd4485056d86686e6, 0xd31f4577aeffbad2, 0x2257c3cc150a1c65 },
+        { 0xe6b29a73453749cb, 0x5bb1bedb5319ee21, 0x1be94b348d769cc7, 0x21c3613fff02866f },
+        { 0xddf74c097f74faf5, 0xead9e254cfbf0227, 0x333d60371e263f67, 0x3f52bf4cc60ad400 },
+        { 0x864cafd3ca004119, 0x4e9696e811c32573, 0x9555836e0dd62023, 0x187646a39c7873df },
+        { 0x0e392e2cff36eee3, 0x3661a9bdb17d777a, 0x806c7a6239698613, 0x0961b39ee3d536ee },
+        { 0x9da7d28f79527192, 0x5975ea1b7d19bb1e, 0xaacd263d5d9c5c2e, 0x2d0ba6822ce0918c },
+        { 0x4159cec258a6688a, 0x41354feb7b38a9f5, 0xd2f9bcf20a3e2076, 0x28769cbb69c758bf },
+        { 0x4f020725fb285b19, 0x46ce503d27861669, 0x36a41e3b017c7649, 0x2369bbdbcdde2b8a },
+        { 0x3c40cf3df909a524, 0x466ef4bec56d5769, 0x5117e9515d5671cc, 0x0f4e82203c1b0238 },
+        { 0xd5b9324c37c7f130, 0x833bb085b5753126, 0x7ad778e2a86038aa, 0x209a96e98915e0de },
+        { 0xe355fcad5c583b80, 0x94169095585ebbb6, 0x8872dfe56fe2258a, 0x1839947b9c482a97 },
+        { 0xe1ac6b001537ea6c, 0xec665df9b8128b43, 0xfe0c2ddd83056981, 0x3fa8420b9ee06adc },
+        { 0x0790536599e10f7a, 0x907c87bc71752ed7, 0xc4522a1fc3a2af35, 0x2c435f830802d475 },
+        { 0xbc48acacb1c9f794, 0xff552a221a1344ad, 0xdb9be045178b55e8, 0x28f841a2aa5fb96c },
+        { 0x202e075dbc14011a, 0x88379388a808bb1b, 0xaf8d181ab68ba735, 0x1a300286e3b68d88 },
+        { 0x9f8ac7b20ba7b28c, 0x2694a045b6fa0cfa, 0x05bbfb25954f7be4, 0x055a8848de0e5531 },
+        { 0x3d6ad96deac82367, 0x7b067bc21696b97f, 0xb4a740bf2c1c532f, 0x28e4f627eafae099 },
+        { 0x58a99f22adf15f91, 0x35185a03dfddd43b, 0xdaefab59c7934ed7, 0x020d57305e5ad6b7 },
+        { 0x5fbc94069346bfb3, 0x04086dbf193cc3a5, 0x77175720e5cdeaec, 0x118bb3df6a106a37 },
+        { 0x473dc83bcfec1e73, 0x88f6c5e5951e3791, 0x95af330483bdb267, 0x2af79f93a7a2687d },
+        { 0x07672dd5bc9b993f, 0x809030a67122c717, 0x4d2f790e6cbcc14c, 0x00ef85c1f665624a },
+        { 0x0ce88a5acf3022a2, 0x6b00c33af660ffc4, 0x15dfd963c59ef088, 0x1b0fdf3460b7cb78 },
+        { 0x0e3bdb6eba07d287, 0x4d4f19d105e261b4, 0xf6ec42d5cb779e2d, 0x1f484801725afcad },
+        { 0xb777f4580a7b0e3b, 0xa2fe36930c80e44f, 0x31e6374bdb8a3dda, 0x05de3689fd2d93c3 },
+        { 0x35a0e01101e17de4, 0x71b085a24aba4bde, 0x82067f001e98e920, 0x2fe73aca64b133ec },
+        { 0x13da60ec848a8aa0, 0x30e271988fd0404f, 0x65e948518cdabced, 0x189d6d3880c61132 },
+        { 0xd0723fea38d0e902, 0xf75155a9d88bfb4a, 0x3e52d70f985aca24, 0x185ba658b84055ca },
+        { 0x851755dc4d6e5204, 0x004c4e558d6dbfb6, 0x6865182a55a017d8, 0x2597a06022d48281 },
+        { 0x64b4c3b400000004, 0x891a63f02533e46e, 0x0000000000000000, 0x0000000000000000 },
+        { 0x59e1a78680bdff61, 0x88482a225cc05e90, 0x054300a5a57cc423, 0x146f0ef8cf215acc },
+        { 0x3c4c25db66bb8e26, 0xfa76bdb8b28755e7, 0x9ac161199aa13635, 0x18f66b41a611e977 },
+        { 0x803c22ccd6e3acf9, 0xd7d959a0b923b570, 0xdd8922c13980676e, 0x02641654c22ac946 },
+        { 0xe4d16e4245b8fdcd, 0x19b9ee427865fc43, 0xc278a52a0719df88, 0x0cb502ecdb7813db },
+        { 0x52232219816eeb53, 0x160817514c7d08de, 0x32e6783b89388983, 0x2156d0057ab9701f },
+        { 0x072f4df5209a7f9c, 0xf749ca2e841b7d27, 0x86901a6f90eede78, 0x264c543a7fccb916 },
+        { 0x90d6168bd6dde4f3, 0xb01dbf7a45d73dae, 0x2095e22846a0651f, 0x25f357a6d49a40f9 },
+        { 0xac2bd986500f7981, 0xf6bb310b9957132e, 0x03e6771975608a1f, 0x030adcde2b0e9e2c },
+        { 0x16b7b57ded14b7d9, 0xa0dc44a1a95e4a98, 0xbddda426e2013970, 0x17218fd94e797e19 },
+        { 0xc680994a7ea22366, 0x7b0fa4d66779e1c1, 0xa5361ded61053121, 0x15b1da03ce7ea8dc },
+        { 0x462f74e39c9ef235, 0x8562cd2ff666b52a, 0xc742d582e587d692, 0x05c5fb5fe0bcbb12 },
+        { 0x6a4f887273be8eab, 0x98b0a9ae50cef763, 0xdfdc30113f0bb892, 0x29c7b3dac67d0d07 },
+        { 0x61a40db095166533, 0xa26d7d110cb2069d, 0xddf77b4d7a54d103, 0x343f972cccc967d5 },
+        { 0xef9183479f563b78, 0x5b1d8951c73a0366, 0x199eb5d3260c42ec, 0x3f00508f66232950 },
+        { 0x63d9265d7f831ddf, 0xa095ba8bb69c7a6c, 0x038b3fb0afa88dc0, 0x19a8c5f0ebd8c17e },
+        { 0xf99b32860ddfacbe, 0x237c6f3f3af224f7, 0xe5d23a993ace7882, 0x2b33fab325f902e8 },
+        { 0xfb8b7dfcd345208c, 0x6c92ab9a17f6f286, 0x351b81bd2863bf2c, 0x2da671e1778ea713 },
+        { 0x6cc684d6518feef3, 0x7c58f8cb87b5c5f3, 0xa804fbfaaf9e53b8, 0x04d0703dd08f9c0a },
+        { 0x8fee2380aa75f6c7, 0x0e60bef43de60ff5, 0xd73ce8793e07ea51, 0x3a39e87e3319a473 },
+        { 0xa5cc3cff24880ac0, 0x652dd3982b29a164, 0x1a5303ae0a78d00c, 0x3f01fa660b07035f },
+        { 0xecb2c820f25ad036, 0xb426620d0a9f39d7, 0x67107e8766fca15f, 0x069567c9ec183c40 },
+        { 0x396f74c29a15dcea, 0xf31881abd3b57720, 0x5c4cae9333f2bff0, 0x30057ad107ef0541 },
+        { 0xe81b6c4c07957dc9, 0x6f67b73b39f2f632, 0x9a0a6e679ba4426b, 0x3639c3c0077d9b64 },
+        { 0x3f88ad9bf86ec0ab, 0x4da7798263d4aa62, 0xf59f7ca8294b0caa, 0x29987ba2602b126f },
+        { 0x7b6b0cf6b1d26faa, 0x8c5a6c3b09cd90d5, 0x67dd7fd9e4048f4e, 0x3a75ec11eae3ddf4 },
+        { 0x251bd7424767c13f, 0xe6a7a32c1dabc989, 0xad4d5432b77f038b, 0x156bfe89d04ad64d },
+        { 0xc90a2c73332f0fea, 0x68216a4835fe622a, 0x60d4f3a3ecae44ca, 0x11f83f5e97d0bb09 },
+        { 0xa27a34fb97d1c9db, 0x1ba48b23dde6511f, 0x4321890407c0e111, 0x00550a7f13e541d3 },
+        { 0xca115bd4f1493f65, 0x6cccdb9d60fa8b17, 0xd5482537a52d9c98, 0x2814d1680a9a07bc },
+        { 0xd67cab6c89acab1f, 0xc2424ad99d5dc959, 0xe19054491ce44148, 0x3803e2eb43f60f6a },
+        { 0x1fa8a5adc623db38, 0x68478507c2ee4259, 0x000fb74b4dc6c9ef, 0x1b042afda4234b99 },
+        { 0xb2f93831fca6b639, 0x00c67534990d726b, 0x86d3076193618e69, 0x1f380bb220a9f084 },
+        { 0x8e488f0986fc817f, 0x701ba6436091dc88, 0x5d94b1973856884b, 0x194a742f7fba0bfd },
+        { 0x01064550ec5dedfe, 0x956a3a5b9a6b246f, 0x65d482440a050a6a, 0x14dea55d17766d88 },
+        { 0x6add52ff98252e3f, 0x62d0a52995299d51, 0x66999f62e0810a0e, 0x1abe28335ba439d5 },
+        { 0xcce93ef4177870e5, 0x486ba40e9364a06e, 0x77c50838bda7fcbb, 0x29a5ac1ffcc5cc67 },
+        { 0x6e0b7076569e18af, 0x39f7522cb0cf9b0a, 0x019587184af43077, 0x37be069200981f01 },
+        { 0x1e0d274f13c57933, 0x7a229054a5e8e2d3, 0x77d216ca575a710e, 0x1622c9f013d5379e },
+        { 0x04618fbf91ec229b, 0x4519bcdb05811802, 0x2d0a215edecf014a, 0x069989bd8672f4b6 },
+        { 0xc4ffa586a0d1cb61, 0x1bc3bf881f9a4dce, 0x581c6cd04188f42c, 0x3c1bb91efe7a9e6a },
+        { 0xbefd188f48bc7284, 0xc19d71d50d61e09e, 0xe23cae161c25f5f4, 0x087173cf52b81897 },
+        { 0xc311dcd82c839f42, 0x5ed48093a631f9b6, 0xfa8f4b050afd7187, 0x3436f5304c62c294 },
+        { 0xca9111347d62e11f, 0xff7bb4e0d6c8966b, 0xc206c350dab1b50f, 0x396fc34a0f5b21c5 },
+        { 0xd5c5983f049f0ba7, 0x50638098da85d63e, 0xe6d4f6fbf8633765, 0x14f0307b70b8755f },
+        { 0x628def72c82af383, 0xfa014b439222db9b, 0x41a89fbb7607f284, 0x19ce346bd0bb1074 },
+        { 0x2f638ec94df4384d, 0xc0e1d530ddcc83ba, 0x2ed5c77b27dcbdaf, 0x3e4733187b299109 },
+        { 0xfb52d9cc60eac8d9, 0x5081f989d39b6227, 0x3aaa056fbfb39b7f, 0x3ca8eae36c139154 },
+        { 0x48bdaed8ef172ee0, 0xecab45bdc7a28e64, 0x38b54f689c43f6e1, 0x2e5f122714089c0b },
+        { 0xc7a036b7b2d3c0a2, 0xfaa50d4f4f2845e5, 0x4a950a74bab63d9b, 0x118d0d88e48ba9ad },
+        { 0xc0b447a4a3978bad, 0x06d2d741e31537be, 0xe2556cbc39e33769, 0x28b8ff86a1d44107 },
+        { 0x2fb72b5fa257da79, 0x73084defd3981e9c, 0xa19abfce626ed72d, 0x26a19e3110920353 },
+        { 0x480c341ca5c9ccbd, 0x3b08c4d9e9f5db2e, 0x249701fbde3f8789, 0x119af2ada67d4389 },
+        { 0xd51c1fcea2213887, 0x2a7662d354b8a2d0, 0x17dee10a843a43d8, 0x04782917a8465eff },
+        { 0xee76bfbe94ffb7fa, 0x87a064bb5d60efca, 0xa7bd210e1eb3042a, 0x0af12c4044028a3e },
+        { 0x54961c441d021e08, 0x2eceade4f74256e5, 0x63e1302fa7046982, 0x186811c3140e1192 },
+        { 0x12b4dc075f01b69d, 0x05d788492cc86b0b, 0x08fa2005a24790f2, 0x3649e7ab8d7c9de1 },
+        { 0xb0f02114828c0292, 0x6537d2b54a0deb06, 0xee34647488b3be0f, 0x07c76caebce85ffa },
+        { 0x99accd6f1cbfad0d, 0x5fffa62cadb4872d, 0x8dd86607800ebbf5, 0x221840d595aa99a8 },
+        { 0x7c8f6ed3ba56ff2c, 0x4d9f5e274e6fd5b9, 0x975e8b1d094c1521, 0x1f75dbb2388c78c1 },
+        { 0xf16174043d615f96, 0xab2e4337df87d40b, 0x3ababc8d3ebc6c23, 0x11f686138cea9b6b },
+        { 0x18355fb389fa7464, 0xde03dc3577217841, 0x853c15195d9e4984, 0x3b8aeeee34ece29a },
+        { 0xae4e77c227b4a40e, 0xa147d5af0e46c2ec, 0xb7fb7a3bf66c2c8f, 0x2e807d59c64f15fb },
+        { 0x027c043db91cd2ac, 0x3a1d53bcead3cc53, 0x7a904fb73321c868, 0x2bdd6aaa628f6b92 },
+        { 0xe9d5e76214debe82, 0x75357d63b194b8fa, 0x4cc6bf531a870fb9, 0x1e575782826fd45c },
+        { 0xee50a115d935f4bc, 0xbba3a884a9422dac, 0x7c6a05df8cd75230, 0x13fefacc1bf71759 },
+        { 0x75fd61b84b2ed276, 0x32c96b2f56f2d26f, 0xf71a07d8aad99d0d, 0x03a46ab39552b5b9 },
+        { 0xe6dcb1e4365e0a41, 0xd40615ce6abc346a, 0x319d0c2d0480be74, 0x03444ef5991cc51c },
+        { 0x35d8ff6bbe84bc9c, 0xced8bf6a5c101a5e, 0xe8a9da716e68dc78, 0x15e6a7b33c24c8ef },
+        { 0xc263b2a9f443901b, 0xe4e6ae6fd4884d9a, 0x91a172bb1813bd01, 0x000e61caf5e8a836 },
+        { 0x694b78e46b1bcc09, 0x3ace63c19863102d, 0x2d94c1265341f7a3, 0x3c19367f4da915e0 },
+        { 0x206360e6e605c7fd, 0x5371e2a1cea86fa6, 0xbfb93ce68c8cfe09, 0x2df92ec8158c4612 },
+        { 0x20427f2e6f080a61, 0x3447025d39667a6c, 0x98f6ab86fe946691, 0x089fedd14740d6d6 },
+        { 0x340b35cee7e45585, 0x1b8246f5db92ade2, 0x421b3badd32ca6df, 0x06035adf239e0396 },
+        { 0x9a7717fe65bb6f81, 0xdb12b348cf2cd9af, 0xf5f129a5a2bc3871, 0x3ee7ba517eb9c665 },
+        { 0x2704ddd9cdb49728, 0x62995a8d20a39af8, 0x300a484b58c61788, 0x26a2b2de469d9141 },
+        { 0x9ccb30f6c2272445, 0x069fbb8e3e770484, 0x84786327caefddf2, 0x055f4f1cabcf7993 },
+        { 0x0f67c38e7713623d, 0xb85e07a5c9a62e18, 0x79864261a38bc530, 0x1af9c1105a40dba1 },
+        { 0xdb4427862905d2eb, 0x18d6c6512e7aebeb, 0x85b82d988e17c540, 0x240a1dd950809c8b },
+        { 0x71e5e6c30a89950a, 0x59f9f6798d618cd9, 0x6e6aeca58047557b, 0x3eabcd3889fa2ab2 },
+        { 0x4d58468ada9ad810, 0x88dc4f1afb20585b, 0x6a5272864ae0e780, 0x218a4517a9580f55 },
+        { 0xcd897706496597c9, 0xe31635e967f1d92e, 0xcb1da0f2a2475821, 0x23f897f9f6c56fc6 },
+        { 0x8af3edd6be499035, 0x2ea01407feff7643, 0xa4ffb8eaf0e9b362, 0x3670144dabc76b44 },
+        { 0xb4c4bb6bae2a3ba8, 0x478bdd146cae4eef, 0x514e25519a2ab365, 0x260a50a4b6541ccb },
+        { 0x931234b76f8fe7f2, 0xf30fe8031347c7f0, 0x1a0744146cffc680, 0x28a011502a388b39 },
+        { 0x27c0546c7d4c9e0f, 0x93817d3e7eac4d8b, 0xd4e199d3c6537e51, 0x0f6242ea7bb0cade },
+        { 0xb998a656519afd8f, 0x1684b13120711b71, 0xd1e311299c49ce19, 0x3c36d4d2cf829ecf },
+        { 0xcde7fedc7b2de3b6, 0x714fd11004b786f3, 0xb1a5d2d07db27595, 0x367eeb55b655dad2 },
+        { 0x6ef4f07697f119bd, 0x9ff06e818e893a5b, 0xd303598ff471abb1, 0x2f03ee2dddfd21f9 },
+        { 0x72f33ca891e39674, 0x8dc5e236e863dcfe, 0x68e8f2fc55b91a4b, 0x3b2fbcd475cec8b1 },
+        { 0x9929a81c993431da, 0xe13ab6bc056550db, 0x7a1a2d20309e40c7, 0x270354ba322860a0 },
+        { 0x5b64db153fe49dc9, 0xa4b26823c2c86de4, 0xc5caf25ba3621b1f, 0x013db8059fc11b39 },
+        { 0x471af31ccc29c7f9, 0x8af2752ca352bd36, 0xea02bf32109e77a0, 0x3ebd3e5a7d36476a },
+        { 0x0124e88659f8b7eb, 0x9e6020107113ca8d, 0x21803774a68270a7, 0x3ee97f1e615fc635 },
+        { 0x322e3a6195ec0214, 0xb2f09e6bb77686f3, 0x1a6f938dd4886086, 0x0485d31d9a1fb2b5 },
+        { 0x2d88fb1016416121, 0xae2b186a898cc7c1, 0x436adf8457ec4068, 0x1e538f48bb2e8d33 },
+        { 0x6d7f787664374374, 0xb02b6de27328a736, 0x12edd98f37a813c5, 0x3781ae4a2a49f0e7 },
+        { 0xfa36e39150e7c691, 0xf445e1a6b815a9cc, 0x2ed9429b5b0d33d3, 0x0b8aebc8999b74fd },
+        { 0xec0f5ac0fb88f3a2, 0xb9244d088ffae515, 0x1f984aa2b76b791b, 0x0b2313fa32b3e282 },
+        { 0x35c2f92b71a5e2a1, 0x819487789d65c9f0, 0x9aa601223e51bc95, 0x2efff687bc6b4269 },
+        { 0x8b039fa742d50369, 0x4dfe48a530e67235, 0x2ce0ba885100452d, 0x1da83c33eaf5e39a },
+        { 0xb27a9679bac8b636, 0xc694da20b6330af9, 0xe416b4cb72896338, 0x1e3c9ec000fd7990 },
+        { 0xbb35e4e3808b050c, 0x376cb6a7398df6f3, 0xccc29fc8e1d9c098, 0x00ad40b339f52bff },
+        { 0x12e0811935ffbee8, 0xd3b00213f789d3a8, 0x6aaa7c91f229dfdc, 0x2789b95c63878c20 },
+        { 0x8af402c000c9111e, 0xebe4ef3e57cf81a1, 0x7f93859dc69679ec, 0x369e4c611c2ac911 },
+        { 0xfb855e5d86ad8e6f, 0xc8d0aee08c333dfc, 0x5532d9c2a263a3d1, 0x12f4597dd31f6e73 },
+        { 0x57d3622aa7599777, 0xe11149108e144f26, 0x2d06430df5c1df89, 0x178963449638a740 },
+        { 0x4a2b29c704d7a4e8, 0xdb7848bee1c6e2b2, 0xc95be1c4fe8389b6, 0x1c9644243221d475 },
+        { 0x5cec61af06f65add, 0xdbd7a43d43dfa1b2, 0xaee816aea2a98e33, 0x30b17ddfc3e4fdc7 },
+        { 0xc373fea0c8380ed1, 0x9f0ae87653d7c7f4, 0x8528871d579fc755, 0x1f65691676ea1f21 },
+        { 0xb5d7343fa3a7c481, 0x8e300866b0ee3d64, 0x778d201a901dda75, 0x27c66b8463b7d568 },
+        { 0xb780c5eceac81595, 0x35e03b02513a6dd7, 0x01f3d2227cfa967e, 0x0057bdf4611f9523 },
+        { 0x919cdd87661ef087, 0x91ca113f97d7ca44, 0x3badd5e03c5d50ca, 0x13bca07cf7fd2b8a },
+        { 0xdce484404e36086d, 0x22f16ed9ef39b46d, 0x24641fbae874aa17, 0x1707be5d55a04693 },
+        { 0x78ff298f43ebfee7, 0x9a0f057361443e00, 0x5072e7e5497458ca, 0x25cffd791c497277 },
+        { 0xf9a2693af4584d75, 0xfbb1f8b65252ec20, 0xfa4404da6ab0841b, 0x3aa577b721f1aace },
+        { 0x5bc2577f1537dc9a, 0xa7401d39f2b63f9c, 0x4b58bf40d3e3acd0, 0x171b09d815051f66 },
+        { 0x408391ca520ea070, 0xed2e3ef8296f24e0, 0x251054a6386cb128, 0x3df2a8cfa1a52948 },
+        { 0x39709ce66cb9404e, 0x1e3e2b3cf0103576, 0x88e8a8df1a321514, 0x2e744c2095ef95c8 },
+        { 0x51ef68b13013e18e, 0x994fd316742ec18a, 0x6a50ccfb7c424d98, 0x1508606c585d9782 },
+        { 0x91c60317436466c2, 0xa1b66855982a3204, 0xb2d086f193433eb3, 0x3f107a3e099a9db5 },
+        { 0x8c44a69230cfdd5f, 0xb745d5c112ebf957, 0xea20269c3a610f77, 0x24f020cb9f483487 },
+        { 0x8af1557e45f82d7a, 0xd4f77f2b036a9767, 0x0913bd2a348861d2, 0x20b7b7fe8da50352 },
+        { 0xe1b53c94f584f1c6, 0x7f486268fccc14cb, 0xce19c8b42475c225, 0x3a21c97602d26c3c },
+        { 0x638c50dbfe1e821d, 0xb0961359be92ad3d, 0x7df980ffe16716df, 0x1018c5359b4ecc13 },
+        { 0x8552d0007b757561, 0xf1642763797cb8cc, 0x9a16b7ae73254312, 0x276292c77f39eecd },
+        { 0xc8baf102c72f16ff, 0x2af5435230c0fdd0, 0xc1ad28f067a535db, 0x27a459a747bfaa35 },
+        { 0x1415db10b291adfd, 0x21fa4aa67bdf3965, 0x979ae7d5aa5fe828, 0x1a685f9fdd2b7d7e },
+    },
+};
+
+const uint16_t SQRT_DLOG_INDEX[1 << SQRT_DLOG_BITS] = {
+    0x0031, 0x00b8, 0x00e8, 0xffff, 0x0011, 0x000a, 0x007b, 0xffff,
+    0x0071, 0xffff, 0x001d, 0xffff, 0x0028, 0x00f8, 0x006d, 0x003c,
+    0x002a, 0xffff, 0x0034, 0xffff, 0xffff, 0xffff, 0x002d, 0x00c7,
+    0x00d5, 0xffff, 0xffff, 0x0064, 0xffff, 0x00b2, 0xffff, 0xffff,
+    0xffff, 0x0050, 0x0056, 0xffff, 0x007d, 0xffff, 0xffff, 0x004d,
+    0xffff, 0x000f, 0xffff, 0xffff, 0x006e, 0x0009, 0x003f, 0xffff,
+    0x00b3, 0x00af, 0xffff, 0x005d, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0063, 0x0053, 0x00e6, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0044,
+    0x004b, 0xffff, 0x0060, 0x004e, 0x0007, 0x0057, 0x001f, 0x00d2,
+    0xffff, 0x0080, 0xffff, 0xffff, 0x0026, 0x00ab, 0xffff, 0xffff,
+    0xffff, 0x00cf, 0x000c, 0xffff, 0x0036, 0x0061, 0x009e, 0x0051,
+    0x00d4, 0xffff, 0xffff, 0xffff, 0xffff, 0x00be, 0xffff, 0xffff,
+    0x0042, 0x0082, 0x0086, 0x0094, 0x009a, 0xffff, 0x00f3, 0xffff,
+    0x008e, 0x0019, 0x00da, 0x00d8, 0x0012, 0x001b, 0x00e9, 0x00dc,
+    0x0003, 0x0084, 0x0090, 0x00ea, 0x00f6, 0x006c, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00bd, 0xffff, 0xffff, 0xffff,
+    0x00c5, 0xffff, 0x0001, 0x0008, 0x0029, 0x003b, 0xffff, 0xffff,
+    0x00f5, 0xffff, 0xffff, 0xffff, 0x00fe, 0xffff, 0xffff, 0xffff,
+    0x00e5, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a2,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0027, 0xffff, 0xffff,
+    0x0077, 0x006b, 0xffff, 0xffff, 0xffff, 0xffff, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0072, 0x0098,
+    0xffff, 0xffff, 0x00b9, 0x0059, 0x0074, 0xffff, 0x00ca, 0xffff,
+    0x0017, 0x0024, 0x0062, 0x00db, 0x00de, 0x0043, 0x003a, 0x0046,
+    0x0096, 0x00a5, 0x00ff, 0xffff, 0x0016, 0x007f, 0x0025, 0x00ba,
+    0x00c3, 0x005e, 0x00a4, 0x00c6, 0x005b, 0x0097, 0x004a, 0x00e2,
+    0x00d9, 0x00f4, 0x0039, 0xffff, 0xffff, 0x00f2, 0x0018, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x008b, 0xffff,
+    0xffff, 0xffff, 0x00eb, 0x00f7, 0xffff, 0xffff, 0x00a7, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0022, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0065, 0xffff, 0xffff, 0xffff, 0x007e,
+    0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0088, 0x0081, 0x00a9, 0x00bb, 0x0045, 0xffff, 0xffff, 0x003d,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00ec, 0x0076,
+    0xffff, 0xffff, 0x0010, 0x0083, 0x0004, 0x005c, 0x006a, 0x0092,
+    0x0058, 0x0069, 0x0099, 0x000e, 0x005a, 0x009b, 0x0073, 0xffff,
+    0x0014, 0x001a, 0x0002, 0x0006, 0x00c2, 0xffff, 0x003e, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00d1, 0x001e, 0x0054, 0x00b6,
+    0x00e1, 0x008c, 0x004f, 0xffff, 0xffff, 0xffff, 0x002b, 0x00a6,
+    0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0x0052, 0x009f, 0xffff,
+    0x0087, 0x00ce, 0x00d7, 0x00e0, 0x00c4, 0x00cb, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0085, 0xffff,
+    0xffff, 0x0066, 0x00d3, 0x00e3, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x002f, 0x0033, 0xffff, 0x0089, 0x00bf,
+    0x00ee, 0xffff, 0x008f, 0xffff, 0x00cd, 0xffff, 0xffff, 0x00fd,
+    0xffff, 0xffff, 0xffff, 0x00d0, 0x00d6, 0xffff, 0x0032, 0xffff,
+    0x00e4, 0xffff, 0xffff, 0xffff, 0x0047, 0x0055, 0x00ad, 0xffff,
+    0xffff, 0x00b4, 0xffff, 0xffff, 0x00aa, 0x00bc, 0x00ed, 0x0078,
+    0x00a8, 0x009d, 0xffff, 0x00f1, 0xffff, 0x00fb, 0x008a, 0x0091,
+    0xffff, 0xffff, 0x0068, 0x00b1, 0x0038, 0x006f, 0x0079, 0x00c8,
+    0x00df, 0xffff, 0x001c, 0x00e7, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x008d, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a3, 0xffff, 0x00c9,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0030, 0x007c, 0x0015, 0x00ac,
+    0x0093, 0xffff, 0xffff, 0xffff, 0xffff, 0x00c1, 0xffff, 0x0021,
+    0x0037, 0x0040, 0x00fa, 0xffff, 0x00cc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00b5, 0xffff, 0x0070, 0x00a0, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0020, 0x00f0, 0x0035, 0xffff, 0xffff, 0xffff, 0xffff, 0x004c,
+    0xffff, 0xffff, 0x007a, 0x00c0, 0x00a1, 0x00b7, 0x0041, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0013, 0x0095, 0xffff, 0x00b0,
+    0x002c, 0x00fc, 0xffff, 0xffff, 0xffff, 0x0049, 0x0023, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x000d, 0x00ae, 0xffff, 0xffff,
+    0xffff, 0x0067, 0x009c, 0x005f, 0xffff, 0x0048, 0x00ef, 0x00f9,
+};
@@ -0,0 +1,24 @@
+// pasta_fp_sqrt_tables.h - roots of unity for the table-driven Fp square root
+//
+//    w = 5^t is a primitive 2^32-th root of unity (t = (p - 1) / 2^32).
+//    SQRT_TABLE[i][k] = w^(-k * 2^(8i)) in montgomery form, for the four
+//    8-bit digits of a discrete logarithm in <w>.  SQRT_DLOG_INDEX is an
+//    open addressing hash of the 2^8-th roots of unity g^k (g = w^(2^24),
+//    g^k = SQRT_TABLE[3][-k mod 256]) keyed by
+//    (limb 0 * SQRT_DLOG_HASH) >> (64 - SQRT_DLOG_BITS), with linear
+//    probing; 0xffff marks an empty slot.
+//
+//    The tables are defined in pasta_fp_sqrt_tables.c, generated by
+//    sqrt_tables_gen.c (make sqrt_tables); unit_tests recomputes them.
+
+#pragma once
+
+#include <stdint.h>
+
+#define SQRT_DLOG_HASH 0x9e3779b97f4a7c15
+
+#define SQRT_DLOG_BITS 9
+
+extern const uint64_t SQRT_TABLE[4][256][4];
+
+extern const uint16_t SQRT_DLOG_INDEX[1 << SQRT_DLOG_BITS];
@@ -17,6 +17,9 @@
 
 #include <stdint.h>
 #include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
 typedef unsigned char fiat_pasta_fq_uint1;
 typedef signed char fiat_pasta_fq_int1;
 
@@ -24,6 +27,16 @@ typedef signed char fiat_pasta_fq_int1;
 #error "This code only works on a two's complement system"
 #endif
 
+// (q - 1) / 2
+static const uint64_t Q_MINUS_1_OVER_2[4] = {
+  0xc623759080000000, 0x11234c7e04ca546e, 0x0000000000000000, 0x2000000000000000
+};
+
+// (t - 1) / 2, where t = (q - 1) / 2^32
+static const uint64_t T_MINUS_1_OVER_2[4] = {
+  0x04ca546ec6237590, 0x0000000011234c7e, 0x0000000000000000, 0x0000000020000000
+};
+
 
 /*
  * The function fiat_pasta_fq_addcarryx_u64 is an addition with carry.
@@ -2068,3 +2081,236 @@ bool fiat_pasta_fq_equals(const uint64_t x[4], const uint64_t y[4]) {
 void fiat_pasta_fq_copy(uint64_t out[4], const uint64_t value[4]) {
     for (size_t j = 0; j < 4; ++j) { out[j] = value[j]; }
 }
+
+// Number of divsteps needed by Bernstein-Yang inversion for a 255-bit
+// modulus: floor((49 * 255 + 57) / 17)
+#define FIAT_PASTA_FQ_DIVSTEP_ITERATIONS 738
+
+void fiat_pasta_fq_inv(uint64_t out1[4], const uint64_t arg1[4]) {
+  // constant-time inversion by safegcd (Bernstein-Yang divsteps),
+  // see fiat_pasta_fp_inv
+
+  uint64_t precomp[4];
+  fiat_pasta_fq_divstep_precomp(precomp); // 2^{-738}
+
+  uint64_t d = 1;
+  uint64_t f[5];
+  uint64_t g[5];
+  uint64_t v[4] = { 0, 0, 0, 0 };
+  uint64_t r[4];
+  uint64_t out1_d;
+  uint64_t out2[5], out3[5], out4[4], out5[4];
+
+  fiat_pasta_fq_msat(f);
+  fiat_pasta_fq_set_one(r);
+
+  // divsteps operate on the plain (non-montgomery) value of x
+  fiat_pasta_fq_from_montgomery(g, arg1);
+  g[4] = 0;
+
+  for (size_t i = 0; i < FIAT_PASTA_FQ_DIVSTEP_ITERATIONS; i += 2) {
+    fiat_pasta_fq_divstep(&out1_d, out2, out3, out4, out5, d, f, g, v, r);
+    fiat_pasta_fq_divstep(&d, f, g, v, r, out1_d, out2, out3, out4, out5);
+  }
+
+  // fix the sign of f = +-1
+  uint64_t h[4];
+  fiat_pasta_fq_opp(h, v);
+  fiat_pasta_fq_selectznz(v, f[4] >> 63, v, h);
+
+  // remove the 2^738 accumulated by the divsteps
+  fiat_pasta_fq_mul(out1, v, precomp);
+}
+
+// Sliding window exponentiation with a precomputed table of the odd powers
+// arg1^1, arg1^3, ..., arg1^(2^w - 1).  The exponent is a little-endian
+// 256-bit integer and is treated as public (the window schedule depends on it).
+#define FIAT_PASTA_FQ_POW_WINDOW 4
+
+void fiat_pasta_fq_pow(uint64_t out1[4], const uint64_t arg1[4], const uint64_t exponent[4]) {
+  uint64_t table[1 << (FIAT_PASTA_FQ_POW_WINDOW - 1)][4];
+  uint64_t arg1_sq[4];
+
+  fiat_pasta_fq_copy(table[0], arg1);
+  fiat_pasta_fq_square(arg1_sq, arg1);
+  for (size_t i = 1; i < (1 << (FIAT_PASTA_FQ_POW_WINDOW - 1)); ++i) {
+    fiat_pasta_fq_mul(table[i], table[i - 1], arg1_sq);
+  }
+
+  fiat_pasta_fq_set_one(out1);
+  bool started = false;
+
+  #define EXP_BIT(j) ((exponent[(j) / 64] >> ((j) % 64)) & 1)
+  for (int i = 255; i >= 0; ) {
+    if (!EXP_BIT(i)) {
+      if (started) {
+        fiat_pasta_fq_square(out1, out1);
+      }
+      --i;
+      continue;
+    }
+
+    // longest window exponent[i..j] of at most w bits that ends in a one
+    int j = i - FIAT_PASTA_FQ_POW_WINDOW + 1;
+    if (j < 0) {
+      j = 0;
+    }
+    while (!EXP_BIT(j)) {
+      ++j;
+    }
+
+    size_t window = 0;
+    for (int k = i; k >= j; --k) {
+      window = (window << 1) | EXP_BIT(k);
+      if (started) {
+        fiat_pasta_fq_square(out1, out1);
+      }
+    }
+
+    if (started) {
+      fiat_pasta_fq_mul(out1, out1, table[window >> 1]);
+    } else {
+      fiat_pasta_fq_copy(out1, table[window >> 1]);
+      started = true;
+    }
+    i = j - 1;
+  }
+  #undef EXP_BIT
+}
+
+bool fiat_pasta_fq_equals_zero(const uint64_t x[4]) {
+  uint64_t x_nonzero;
+  fiat_pasta_fq_nonzero(&x_nonzero, x);
+  if (x_nonzero) {
+    return false;
+  } else {
+    return true;
+  }
+}
+
+bool fiat_pasta_fq_equals_one(const uint64_t x[4]) {
+  uint64_t one[4];
+  fiat_pasta_fq_set_one(one);
+
+  uint64_t x_minus_1[4];
+  fiat_pasta_fq_sub(x_minus_1, x, one);
+
+  uint64_t x_minus_1_nonzero;
+  fiat_pasta_fq_nonzero(&x_minus_1_nonzero, x_minus_1);
+  if (x_minus_1_nonzero) {
+    return false;
+  } else {
+    return true;
+  }
+}
+
+int fiat_pasta_fq_legendre(const uint64_t arg1[4]) {
+  uint64_t tmp[4];
+
+  fiat_pasta_fq_pow(tmp, arg1, Q_MINUS_1_OVER_2);
+
+  uint64_t input_non_zero;
+  fiat_pasta_fq_nonzero(&input_non_zero, arg1);
+  if (input_non_zero) {
+    if (fiat_pasta_fq_equals_one(tmp)) {
+      return 1;
+    } else {
+      return -1;
+    }
+  } else {
+    return 0;
+  }
+}
+
+bool fiat_pasta_fq_sqrt(uint64_t x[4], const uint64_t value[4]) {
+    if (fiat_pasta_fq_equals_zero(value)) {
+      for (size_t j = 0; j < 4; ++j) { x[j] = 0; }
+      return true;
+    }
+
+    uint64_t check[4];
+    fiat_pasta_fq_pow(check, value, Q_MINUS_1_OVER_2);
+    if (!fiat_pasta_fq_equals_one(check)) {
+      return false;
+    }
+
+    size_t v = 32;
+
+    // z = 5^( (q - 1)/2^32 )
+    uint64_t z[4] = { 0x218077428c9942de, 0xcc49578921b60494, 0xac2e5d27b2efbee2, 0x0b79fa897f2db056 };
+
+    // w = value^((t - 1) / 2)
+    // where
+    // t = (q - 1) / 2^32
+    uint64_t w[4];
+    fiat_pasta_fq_pow(w, value, T_MINUS_1_OVER_2);
+
+    fiat_pasta_fq_mul(x, value, w);
+
+    uint64_t b[4];
+    fiat_pasta_fq_mul(b, x, w);
+
+    // compute square root with Tonelli--Shanks
+
+    uint64_t b2m[4];
+
+    while (! fiat_pasta_fq_equals_one(b))
+    {
+        size_t m = 0;
+        fiat_pasta_fq_copy(b2m, b);
+
+        while (! fiat_pasta_fq_equals_one(b2m))
+        {
+            // b2m = b2m * b2m
+            fiat_pasta_fq_square(b2m, b2m);
+
+            /* invariant: b2m = b^(2^m) after entering this loop */
+            m += 1;
+        }
+
+        int j = v-m-1;
+        fiat_pasta_fq_copy(w, z);
+
+        while (j > 0)
+        {
+            fiat_pasta_fq_square(w, w);
+            --j;
+        } // w = z^2^(v-m-1)
+
+        fiat_pasta_fq_square(z, w);
+
+        fiat_pasta_fq_mul(b, b, z);
+        fiat_pasta_fq_mul(x, x, w);
+
+        v = m;
+    }
+
+    return true;
+}
+
+// Decode 32 little-endian bytes, rejecting values that are not < q
+bool fiat_pasta_fq_from_bytes_checked(uint64_t out1[4], const uint8_t arg1[32]) {
+  uint64_t m[5];
+  fiat_pasta_fq_msat(m);
+
+  uint64_t tmp[4];
+  for (size_t i = 0; i < 4; ++i) {
+    tmp[i] = 0;
+    for (size_t j = 0; j < 8; ++j) {
+      tmp[i] |= ((uint64_t)arg1[8*i + j]) << (8*j);
+    }
+  }
+
+  // borrow out of tmp - q is set iff tmp < q
+  uint64_t diff;
+  fiat_pasta_fq_uint1 borrow = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    fiat_pasta_fq_subborrowx_u64(&diff, &borrow, borrow, tmp[i], m[i]);
+  }
+  if (!borrow) {
+    return false;
+  }
+
+  fiat_pasta_fq_copy(out1, tmp);
+  return true;
+}
@@ -0,0 +1,134 @@
+// Sparse-modulus Montgomery multiplication for Pasta
+//
+//     Both Pasta primes are m = 2^254 + c with c < 2^126, i.e. in 64-bit
+//     limbs m = (m0, m1, 0, 2^62).  In each row of the operand scanning
+//     (CIOS) Montgomery reduction the multiple q * m therefore only needs
+//     q * m0 and q * m1; the zero limb is skipped and q * 2^62 is a pair of
+//     shifts.
+//
+//     Bounds: the rows run over the second operand b, and each keeps the
+//     accumulator below a + m.  For a < m and any b < 2^256 the result
+//     before the final subtraction is below 2m, so it is canonical after
+//     it (the lazily reduced operand goes second).  For a, b < 2m it is
+//     below 2m + c, and the subtraction brings it to [0, m + c) inside
+//     [0, 2m).  For a >= 2m the accumulator can overflow its words.
+
+#include "pasta_sparse.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+#include <stddef.h>
+
+bool pasta_use_sparse = false;
+
+#ifdef __SIZEOF_INT128__
+
+typedef unsigned __int128 uint128_t;
+
+static inline void mont_mul_sparse(uint64_t out[4], const uint64_t a[4], const uint64_t b[4],
+                                   const uint64_t m0, const uint64_t m1, const uint64_t m_inv)
+{
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4;
+    uint128_t uv;
+
+    for (size_t i = 0; i < 4; i++) {
+        // t += a * b[i]
+        const uint64_t bi = b[i];
+        uv = (uint128_t)a[0] * bi + t0;
+        t0 = (uint64_t)uv;
+        uv = (uint128_t)a[1] * bi + t1 + (uint64_t)(uv >> 64);
+        t1 = (uint64_t)uv;
+        uv = (uint128_t)a[2] * bi + t2 + (uint64_t)(uv >> 64);
+        t2 = (uint64_t)uv;
+        uv = (uint128_t)a[3] * bi + t3 + (uint64_t)(uv >> 64);
+        t3 = (uint64_t)uv;
+        t4 = (uint64_t)(uv >> 64);
+
+        // t = (t + q * m) / 2^64, with m = (m0, m1, 0, 2^62)
+        const uint64_t q = t0 * m_inv;
+        uv = (uint128_t)q * m0 + t0;                       // low word becomes zero
+        uv = (uint128_t)q * m1 + t1 + (uint64_t)(uv >> 64);
+        t0 = (uint64_t)uv;
+        uv = (uint128_t)t2 + (uint64_t)(uv >> 64);         // q * 0
+        t1 = (uint64_t)uv;
+        uv = (uint128_t)t3 + (q << 62) + (uint64_t)(uv >> 64);
+        t2 = (uint64_t)uv;
+        t3 = t4 + (q >> 2) + (uint64_t)(uv >> 64);         // cannot carry out
+    }
+
+    // conditional subtraction of m = (m0, m1, 0, 2^62)
+    uint64_t d0, d1, d2, d3, borrow;
+    uv = (uint128_t)t0 - m0;
+    d0 = (uint64_t)uv;
+    borrow = (uint64_t)(uv >> 64) & 1;
+    uv = (uint128_t)t1 - m1 - borrow;
+    d1 = (uint64_t)uv;
+    borrow = (uint64_t)(uv >> 64) & 1;
+    uv = (uint128_t)t2 - borrow;
+    d2 = (uint64_t)uv;
+    borrow = (uint64_t)(uv >> 64) & 1;
+    uv = (uint128_t)t3 - ((uint64_t)1 << 62) - borrow;
+    d3 = (uint64_t)uv;
+    borrow = (uint64_t)(uv >> 64) & 1;
+
+    // keep t if t < m
+    const uint64_t mask = 0 - borrow;
+    out[0] = (t0 & mask) | (d0 & ~mask);
+    out[1] = (t1 & mask) | (d1 & ~mask);
+    out[2] = (t2 & mask) | (d2 & ~mask);
+    out[3] = (t3 & mask) | (d3 & ~mask);
+}
+
+#define FP_M0    0x992d30ed00000001
+#define FP_M1    0x224698fc094cf91b
+#define FP_M_INV 0x992d30ecffffffff
+
+#define FQ_M0    0x8c46eb2100000001
+#define FQ_M1    0x224698fc0994a8dd
+#define FQ_M_INV 0x8c46eb20ffffffff
+
+void pasta_fp_mul_sparse(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4])
+{
+    mont_mul_sparse(out1, arg1, arg2, FP_M0, FP_M1, FP_M_INV);
+}
+
+void pasta_fp_square_sparse(uint64_t out1[4], const uint64_t arg1[4])
+{
+    mont_mul_sparse(out1, arg1, arg1, FP_M0, FP_M1, FP_M_INV);
+}
+
+void pasta_fq_mul_sparse(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4])
+{
+    mont_mul_sparse(out1, arg1, arg2, FQ_M0, FQ_M1, FQ_M_INV);
+}
+
+void pasta_fq_square_sparse(uint64_t out1[4], const uint64_t arg1[4])
+{
+    mont_mul_sparse(out1, arg1, arg1, FQ_M0, FQ_M1, FQ_M_INV);
+}
+
+#else
+
+// No 128-bit integers: forward to fiat (inputs must then be canonical)
+
+void pasta_fp_mul_sparse(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4])
+{
+    fiat_pasta_fp_mul(out1, arg1, arg2);
+}
+
+void pasta_fp_square_sparse(uint64_t out1[4], const uint64_t arg1[4])
+{
+    fiat_pasta_fp_square(out1, arg1);
+}
+
+void pasta_fq_mul_sparse(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4])
+{
+    fiat_pasta_fq_mul(out1, arg1, arg2);
+}
+
+void pasta_fq_square_sparse(uint64_t out1[4], const uint64_t arg1[4])
+{
+    fiat_pasta_fq_square(out1, arg1);
+}
+
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Set by set_backend (crypto.c) to use these beneath field_* and scalar_*
+extern bool pasta_use_sparse;
+
+// Portable Montgomery multiplication specialised to the shape of the
+// Pasta moduli m = 2^254 + c (c < 2^126): the third limb of m is zero and
+// the top limb is 2^62, so each reduction row needs two 64x64-bit
+// multiplications instead of four.
+//
+// With a canonical first operand the second may be any value below
+// 2^256 and the output is canonical.  A first operand in [m, 2m) with a
+// canonical second operand also gives a canonical output; two operands
+// in [0, 2m) (and squaring one) give an output in [0, 2m).  A first
+// operand of 2m or more is not supported.
+void pasta_fp_mul_sparse(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
+void pasta_fp_square_sparse(uint64_t out1[4], const uint64_t arg1[4]);
+void pasta_fq_mul_sparse(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
+void pasta_fq_square_sparse(uint64_t out1[4], const uint64_t arg1[4]);
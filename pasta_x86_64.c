@@ -0,0 +1,483 @@
+// x86-64 backend for the Pasta field arithmetic
+//
+//     Montgomery multiplication for Fp and Fq written against the BMI2
+//     (MULX) and ADX (ADCX/ADOX) extensions, so that the two carry chains
+//     of each multiply-accumulate row run interleaved.  Additions and
+//     subtractions are the inline carry chains in pasta_inline.h.  The
+//     fiat-crypto routines in pasta_fp.c and pasta_fq.c remain the
+//     verified reference; pasta_use_adx is set at startup from CPUID and
+//     the field/scalar layer in crypto.c falls back to fiat when it is
+//     false.  unit_tests compares both backends.
+//
+//     Both moduli are 2^254 + c with c < 2^126, so every intermediate
+//     Montgomery accumulator fits in five words (no sixth carry word).
+
+#include "pasta_x86_64.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+bool pasta_use_adx = false;
+
+#if PASTA_X86_64_ASM
+
+#include <cpuid.h>
+
+// Layout shared by the assembly below
+typedef struct pasta_modulus_t {
+    uint64_t m[4];   // modulus
+    uint64_t m_inv;  // -m^{-1} mod 2^64
+    uint64_t r2[4];  // 2^512 mod m (montgomery form of 2^256)
+} PastaModulus;
+
+static const PastaModulus PASTA_FP_MODULUS = {
+    { 0x992d30ed00000001, 0x224698fc094cf91b, 0x0000000000000000, 0x4000000000000000 },
+    0x992d30ecffffffff,
+    { 0x8c78ecb30000000f, 0xd7d30dbd8b0de0e7, 0x7797a99bc3c95d18, 0x096d41af7b9cb714 }
+};
+
+static const PastaModulus PASTA_FQ_MODULUS = {
+    { 0x8c46eb2100000001, 0x224698fc0994a8dd, 0x0000000000000000, 0x4000000000000000 },
+    0x8c46eb20ffffffff,
+    { 0xfc9678ff0000000f, 0x67bb433d891a16e3, 0x7fae231004ccf590, 0x096d41af7ccfdaa9 }
+};
+
+static const uint64_t ONE_NON_MONTGOMERY[4] = { 1, 0, 0, 0 };
+
+// System V: rdi = out, rsi = a, rdx = b, rcx = modulus (rdx for sqr)
+void pasta_x86_64_mont_mul(uint64_t out[4], const uint64_t a[4], const uint64_t b[4], const PastaModulus *m);
+void pasta_x86_64_mont_sqr(uint64_t out[4], const uint64_t a[4], const PastaModulus *m);
+
+// Operand-scanning (CIOS) Montgomery multiplication.  Each row adds
+// a * b[i] to the accumulator with the low halves on the CF chain (adcx)
+// and the high halves on the OF chain (adox), then folds in
+// q * m = (t0 * m_inv) * m the same way and drops the now zero low word.
+// Both Pasta moduli are (m0, m1, 0, 2^62), so the fold skips the zero limb
+// and forms q * 2^62 with flag-preserving shlx/shrx (r14 = 62, r15 = 2,
+// rdi = 0 while the output pointer is parked on the stack).  The
+// accumulator stays below 2m, so one conditional subtraction finishes.
+__asm__(
+    "    .text\n"
+    "    .p2align 4\n"
+    "    .globl pasta_x86_64_mont_mul\n"
+    "    .type pasta_x86_64_mont_mul, @function\n"
+    "pasta_x86_64_mont_mul:\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    pushq %rdi\n"
+    "    movq %rdx, %r11\n"
+    "    movl $62, %r14d\n"
+    "    movl $2, %r15d\n"
+    "    xorl %edi, %edi\n"
+    "    movq (%r11), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rsi), %r8, %r9\n"
+    "    mulxq 8(%rsi), %rax, %r10\n"
+    "    adcxq %rax, %r9\n"
+    "    mulxq 16(%rsi), %rax, %r12\n"
+    "    adcxq %rax, %r10\n"
+    "    mulxq 24(%rsi), %rax, %r13\n"
+    "    adcxq %rax, %r12\n"
+    "    adcxq %rdi, %r13\n"
+    "    movq %r8, %rdx\n"
+    "    imulq 32(%rcx), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r8\n"
+    "    adoxq %rbx, %r9\n"
+    "    mulxq 8(%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r9\n"
+    "    adoxq %rbx, %r10\n"
+    "    shlxq %r14, %rdx, %rax\n"
+    "    shrxq %r15, %rdx, %rbx\n"
+    "    adcxq %rdi, %r10\n"
+    "    adoxq %rdi, %r12\n"
+    "    adcxq %rax, %r12\n"
+    "    adoxq %rbx, %r13\n"
+    "    adcxq %rdi, %r13\n"
+    "    movq 8(%r11), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r9\n"
+    "    adoxq %rbx, %r10\n"
+    "    mulxq 8(%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r10\n"
+    "    adoxq %rbx, %r12\n"
+    "    mulxq 16(%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r12\n"
+    "    adoxq %rbx, %r13\n"
+    "    mulxq 24(%rsi), %rax, %r8\n"
+    "    adcxq %rax, %r13\n"
+    "    adoxq %rdi, %r8\n"
+    "    adcxq %rdi, %r8\n"
+    "    movq %r9, %rdx\n"
+    "    imulq 32(%rcx), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r9\n"
+    "    adoxq %rbx, %r10\n"
+    "    mulxq 8(%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r10\n"
+    "    adoxq %rbx, %r12\n"
+    "    shlxq %r14, %rdx, %rax\n"
+    "    shrxq %r15, %rdx, %rbx\n"
+    "    adcxq %rdi, %r12\n"
+    "    adoxq %rdi, %r13\n"
+    "    adcxq %rax, %r13\n"
+    "    adoxq %rbx, %r8\n"
+    "    adcxq %rdi, %r8\n"
+    "    movq 16(%r11), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r10\n"
+    "    adoxq %rbx, %r12\n"
+    "    mulxq 8(%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r12\n"
+    "    adoxq %rbx, %r13\n"
+    "    mulxq 16(%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r13\n"
+    "    adoxq %rbx, %r8\n"
+    "    mulxq 24(%rsi), %rax, %r9\n"
+    "    adcxq %rax, %r8\n"
+    "    adoxq %rdi, %r9\n"
+    "    adcxq %rdi, %r9\n"
+    "    movq %r10, %rdx\n"
+    "    imulq 32(%rcx), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r10\n"
+    "    adoxq %rbx, %r12\n"
+    "    mulxq 8(%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r12\n"
+    "    adoxq %rbx, %r13\n"
+    "    shlxq %r14, %rdx, %rax\n"
+    "    shrxq %r15, %rdx, %rbx\n"
+    "    adcxq %rdi, %r13\n"
+    "    adoxq %rdi, %r8\n"
+    "    adcxq %rax, %r8\n"
+    "    adoxq %rbx, %r9\n"
+    "    adcxq %rdi, %r9\n"
+    "    movq 24(%r11), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r12\n"
+    "    adoxq %rbx, %r13\n"
+    "    mulxq 8(%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r13\n"
+    "    adoxq %rbx, %r8\n"
+    "    mulxq 16(%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r8\n"
+    "    adoxq %rbx, %r9\n"
+    "    mulxq 24(%rsi), %rax, %r10\n"
+    "    adcxq %rax, %r9\n"
+    "    adoxq %rdi, %r10\n"
+    "    adcxq %rdi, %r10\n"
+    "    movq %r12, %rdx\n"
+    "    imulq 32(%rcx), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r12\n"
+    "    adoxq %rbx, %r13\n"
+    "    mulxq 8(%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r13\n"
+    "    adoxq %rbx, %r8\n"
+    "    shlxq %r14, %rdx, %rax\n"
+    "    shrxq %r15, %rdx, %rbx\n"
+    "    adcxq %rdi, %r8\n"
+    "    adoxq %rdi, %r9\n"
+    "    adcxq %rax, %r9\n"
+    "    adoxq %rbx, %r10\n"
+    "    adcxq %rdi, %r10\n"
+    "    movq %r13, %rax\n"
+    "    movq %r8, %rbx\n"
+    "    movq %r9, %rdx\n"
+    "    movq %r10, %r11\n"
+    "    subq (%rcx), %rax\n"
+    "    sbbq 8(%rcx), %rbx\n"
+    "    sbbq 16(%rcx), %rdx\n"
+    "    sbbq 24(%rcx), %r11\n"
+    "    cmovcq %r13, %rax\n"
+    "    cmovcq %r8, %rbx\n"
+    "    cmovcq %r9, %rdx\n"
+    "    cmovcq %r10, %r11\n"
+    "    popq %rdi\n"
+    "    movq %rax, (%rdi)\n"
+    "    movq %rbx, 8(%rdi)\n"
+    "    movq %rdx, 16(%rdi)\n"
+    "    movq %r11, 24(%rdi)\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    ret\n"
+    "    .size pasta_x86_64_mont_mul, .-pasta_x86_64_mont_mul\n"
+);
+
+// Montgomery squaring for a < m.  The six products a[i] * a[j], i < j,
+// are formed once and doubled on the CF chain while the squares a[i]^2
+// go in on the OF chain, giving the 512-bit a^2 in r8..r15 with 10 MULX
+// instead of 16.  The low half is then Montgomery reduced in place by
+// four folds as in the multiplication (q * 2^62 by MULX with m[3]; the
+// zeroed low word of each fold is the top word of the next), leaving
+// u = (lo + q m) / 2^256 <= m, and the high half hi < m^2 / 2^256 < m / 2
+// is added: u + hi < 2m, so one conditional subtraction finishes.
+__asm__(
+    "    .text\n"
+    "    .p2align 4\n"
+    "    .globl pasta_x86_64_mont_sqr\n"
+    "    .type pasta_x86_64_mont_sqr, @function\n"
+    "pasta_x86_64_mont_sqr:\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    pushq %rdi\n"
+    "    movq %rdx, %rcx\n"
+    "    xorl %edi, %edi\n"
+    "    movq (%rsi), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq 8(%rsi), %r9, %r10\n"
+    "    mulxq 16(%rsi), %rax, %r11\n"
+    "    adcxq %rax, %r10\n"
+    "    mulxq 24(%rsi), %rax, %r12\n"
+    "    adcxq %rax, %r11\n"
+    "    adcxq %rdi, %r12\n"
+    "    movq 8(%rsi), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq 16(%rsi), %rax, %rbx\n"
+    "    adcxq %rax, %r11\n"
+    "    adoxq %rbx, %r12\n"
+    "    mulxq 24(%rsi), %rax, %r13\n"
+    "    adcxq %rax, %r12\n"
+    "    adoxq %rdi, %r13\n"
+    "    adcxq %rdi, %r13\n"
+    "    movq 16(%rsi), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq 24(%rsi), %rax, %r14\n"
+    "    adcxq %rax, %r13\n"
+    "    adcxq %rdi, %r14\n"
+    "    xorl %r15d, %r15d\n"
+    "    movq (%rsi), %rdx\n"
+    "    mulxq %rdx, %r8, %rax\n"
+    "    adcxq %r9, %r9\n"
+    "    adoxq %rax, %r9\n"
+    "    movq 8(%rsi), %rdx\n"
+    "    mulxq %rdx, %rax, %rbx\n"
+    "    adcxq %r10, %r10\n"
+    "    adoxq %rax, %r10\n"
+    "    adcxq %r11, %r11\n"
+    "    adoxq %rbx, %r11\n"
+    "    movq 16(%rsi), %rdx\n"
+    "    mulxq %rdx, %rax, %rbx\n"
+    "    adcxq %r12, %r12\n"
+    "    adoxq %rax, %r12\n"
+    "    adcxq %r13, %r13\n"
+    "    adoxq %rbx, %r13\n"
+    "    movq 24(%rsi), %rdx\n"
+    "    mulxq %rdx, %rax, %rbx\n"
+    "    adcxq %r14, %r14\n"
+    "    adoxq %rax, %r14\n"
+    "    adcxq %rdi, %r15\n"
+    "    adoxq %rbx, %r15\n"
+    "    xorl %esi, %esi\n"
+    "    movq %r8, %rdx\n"
+    "    imulq 32(%rcx), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r8\n"
+    "    adoxq %rbx, %r9\n"
+    "    mulxq 8(%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r9\n"
+    "    adoxq %rbx, %r10\n"
+    "    mulxq 24(%rcx), %rax, %rbx\n"
+    "    adcxq %rdi, %r10\n"
+    "    adoxq %rdi, %r11\n"
+    "    adcxq %rax, %r11\n"
+    "    adoxq %rbx, %rsi\n"
+    "    adcxq %rdi, %rsi\n"
+    "    movq %r9, %rdx\n"
+    "    imulq 32(%rcx), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r9\n"
+    "    adoxq %rbx, %r10\n"
+    "    mulxq 8(%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r10\n"
+    "    adoxq %rbx, %r11\n"
+    "    mulxq 24(%rcx), %rax, %rbx\n"
+    "    adcxq %rdi, %r11\n"
+    "    adoxq %rdi, %rsi\n"
+    "    adcxq %rax, %rsi\n"
+    "    adoxq %rbx, %r8\n"
+    "    adcxq %rdi, %r8\n"
+    "    movq %r10, %rdx\n"
+    "    imulq 32(%rcx), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r10\n"
+    "    adoxq %rbx, %r11\n"
+    "    mulxq 8(%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r11\n"
+    "    adoxq %rbx, %rsi\n"
+    "    mulxq 24(%rcx), %rax, %rbx\n"
+    "    adcxq %rdi, %rsi\n"
+    "    adoxq %rdi, %r8\n"
+    "    adcxq %rax, %r8\n"
+    "    adoxq %rbx, %r9\n"
+    "    adcxq %rdi, %r9\n"
+    "    movq %r11, %rdx\n"
+    "    imulq 32(%rcx), %rdx\n"
+    "    xorl %eax, %eax\n"
+    "    mulxq (%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %r11\n"
+    "    adoxq %rbx, %rsi\n"
+    "    mulxq 8(%rcx), %rax, %rbx\n"
+    "    adcxq %rax, %rsi\n"
+    "    adoxq %rbx, %r8\n"
+    "    mulxq 24(%rcx), %rax, %rbx\n"
+    "    adcxq %rdi, %r8\n"
+    "    adoxq %rdi, %r9\n"
+    "    adcxq %rax, %r9\n"
+    "    adoxq %rbx, %r10\n"
+    "    adcxq %rdi, %r10\n"
+    "    addq %r12, %rsi\n"
+    "    adcq %r13, %r8\n"
+    "    adcq %r14, %r9\n"
+    "    adcq %r15, %r10\n"
+    "    movq %rsi, %rax\n"
+    "    movq %r8, %rbx\n"
+    "    movq %r9, %rdx\n"
+    "    movq %r10, %r11\n"
+    "    subq (%rcx), %rax\n"
+    "    sbbq 8(%rcx), %rbx\n"
+    "    sbbq 16(%rcx), %rdx\n"
+    "    sbbq 24(%rcx), %r11\n"
+    "    cmovcq %rsi, %rax\n"
+    "    cmovcq %r8, %rbx\n"
+    "    cmovcq %r9, %rdx\n"
+    "    cmovcq %r10, %r11\n"
+    "    popq %rdi\n"
+    "    movq %rax, (%rdi)\n"
+    "    movq %rbx, 8(%rdi)\n"
+    "    movq %rdx, 16(%rdi)\n"
+    "    movq %r11, 24(%rdi)\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    ret\n"
+    "    .size pasta_x86_64_mont_sqr, .-pasta_x86_64_mont_sqr\n"
+);
+
+bool pasta_x86_64_supported(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    const unsigned int BMI2 = 1 << 8;
+    const unsigned int ADX = 1 << 19;
+    return (ebx & BMI2) && (ebx & ADX);
+}
+
+__attribute__((constructor))
+static void pasta_x86_64_init(void)
+{
+    pasta_use_adx = pasta_x86_64_supported();
+}
+
+void pasta_fp_mul_adx(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4])
+{
+    pasta_x86_64_mont_mul(out1, arg1, arg2, &PASTA_FP_MODULUS);
+}
+
+void pasta_fp_square_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    pasta_x86_64_mont_sqr(out1, arg1, &PASTA_FP_MODULUS);
+}
+
+void pasta_fp_to_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    pasta_x86_64_mont_mul(out1, PASTA_FP_MODULUS.r2, arg1, &PASTA_FP_MODULUS);
+}
+
+void pasta_fp_from_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    pasta_x86_64_mont_mul(out1, ONE_NON_MONTGOMERY, arg1, &PASTA_FP_MODULUS);
+}
+
+void pasta_fq_mul_adx(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4])
+{
+    pasta_x86_64_mont_mul(out1, arg1, arg2, &PASTA_FQ_MODULUS);
+}
+
+void pasta_fq_square_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    pasta_x86_64_mont_sqr(out1, arg1, &PASTA_FQ_MODULUS);
+}
+
+void pasta_fq_to_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    pasta_x86_64_mont_mul(out1, PASTA_FQ_MODULUS.r2, arg1, &PASTA_FQ_MODULUS);
+}
+
+void pasta_fq_from_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    pasta_x86_64_mont_mul(out1, ONE_NON_MONTGOMERY, arg1, &PASTA_FQ_MODULUS);
+}
+
+#else
+
+// Portable build: the entry points forward to fiat and are never selected
+
+bool pasta_x86_64_supported(void)
+{
+    return false;
+}
+
+void pasta_fp_mul_adx(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4])
+{
+    fiat_pasta_fp_mul(out1, arg1, arg2);
+}
+
+void pasta_fp_square_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    fiat_pasta_fp_square(out1, arg1);
+}
+
+void pasta_fp_to_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    fiat_pasta_fp_to_montgomery(out1, arg1);
+}
+
+void pasta_fp_from_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    fiat_pasta_fp_from_montgomery(out1, arg1);
+}
+
+void pasta_fq_mul_adx(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4])
+{
+    fiat_pasta_fq_mul(out1, arg1, arg2);
+}
+
+void pasta_fq_square_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    fiat_pasta_fq_square(out1, arg1);
+}
+
+void pasta_fq_to_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    fiat_pasta_fq_to_montgomery(out1, arg1);
+}
+
+void pasta_fq_from_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4])
+{
+    fiat_pasta_fq_from_montgomery(out1, arg1);
+}
+
+#endif
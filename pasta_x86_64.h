@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The MULX/ADX assembly is available on x86-64 ELF targets; elsewhere the
+// *_adx entry points forward to fiat and pasta_use_adx stays false.
+#if defined(__x86_64__) && defined(__GNUC__) && defined(__ELF__)
+#define PASTA_X86_64_ASM 1
+#else
+#define PASTA_X86_64_ASM 0
+#endif
+
+// Set at startup when the CPU supports BMI2 and ADX (see set_backend)
+extern bool pasta_use_adx;
+
+bool pasta_x86_64_supported(void);
+
+// Canonical output for a canonical first operand and any second operand
+// below 2^256 (or a first operand below 2m with a canonical second one);
+// squaring requires a canonical input.  The conversions pass their input
+// second, so it may be any value below 2^256.
+void pasta_fp_mul_adx(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
+void pasta_fp_square_adx(uint64_t out1[4], const uint64_t arg1[4]);
+void pasta_fp_to_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4]);
+void pasta_fp_from_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4]);
+
+void pasta_fq_mul_adx(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
+void pasta_fq_square_adx(uint64_t out1[4], const uint64_t arg1[4]);
+void pasta_fq_to_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4]);
+void pasta_fq_from_montgomery_adx(uint64_t out1[4], const uint64_t arg1[4]);
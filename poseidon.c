@@ -7,89 +7,225 @@
  ********************************************************************************/
 
 #include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
 
 #include "crypto.h"
 #include "pasta_fp.h"
 #include "pasta_fq.h"
+#include "pasta_inline.h"
+#include "pasta_avx2.h"
 #include "poseidon.h"
 #include "poseidon_params_legacy.h"
 #include "poseidon_params_kimchi.h"
 
 #define SPONGE_BYTES(sponge_width) (sizeof(Field)*sponge_width)
-#define ROUND_KEY(ctx, round, idx) *(Field *)(ctx->round_keys + (round*ctx->sponge_width + idx)*LIMBS_PER_FIELD)
-#define MATRIX_ELT(m, row, col, width) *(Field *)(m + (row*width + col)*LIMBS_PER_FIELD)
 
-static void matrix_mul(State s1, const Field **m, const size_t width)
+// Width 3 kernels
+//
+//     Both parameter sets have a sponge of width 3, so the permutations
+//     are written out for it: the round keys are read straight from the
+//     (row per round) parameter tables, the 3x3 MDS product is unrolled
+//     and the S-boxes are fixed addition chains, x^5 in 3 and x^7 in 4
+//     multiplications.  A parameter set of another width needs its own
+//     kernels.
+
+_Static_assert(SPONGE_WIDTH_LEGACY == 3 && SPONGE_WIDTH_KIMCHI == 3, "width 3 kernels");
+
+// a = a^5
+static inline void sbox5(Field a)
 {
-    Field tmp;
+    Field t;
+    pasta_fp_sq(t, a);
+    pasta_fp_sq(t, t);
+    pasta_fp_mul(a, t, a);
+}
 
-    State s2;
-    bzero(s2, sizeof(s2));
-    for (size_t row = 0; row < width; row++) {
-        // Inner product
-        for (size_t col = 0; col < width; col++) {
-            Field t0;
-            field_mul(t0, s1[col], MATRIX_ELT(m, row, col, width));
-            field_copy(tmp, s2[row]);
-            field_add(s2[row], tmp, t0);
-        }
-    }
+// a = a^7
+static inline void sbox7(Field a)
+{
+    Field a2, a3;
+    pasta_fp_sq(a2, a);
+    pasta_fp_mul(a3, a2, a);
+    pasta_fp_sq(a2, a2);
+    pasta_fp_mul(a, a3, a2);
+}
 
-    for (size_t col = 0; col < width; col++) {
-        field_copy(s1[col], s2[col]);
-    }
+// s = m s + k
+static inline void mds3(State s, const Field m[3][3], const Field k[3])
+{
+    Field t0, t1, t2, u;
+
+    pasta_fp_mul(t0, s[0], m[0][0]);
+    pasta_fp_mul(u, s[1], m[0][1]);
+    pasta_fp_add(t0, t0, u);
+    pasta_fp_mul(u, s[2], m[0][2]);
+    pasta_fp_add(t0, t0, u);
+
+    pasta_fp_mul(t1, s[0], m[1][0]);
+    pasta_fp_mul(u, s[1], m[1][1]);
+    pasta_fp_add(t1, t1, u);
+    pasta_fp_mul(u, s[2], m[1][2]);
+    pasta_fp_add(t1, t1, u);
+
+    pasta_fp_mul(t2, s[0], m[2][0]);
+    pasta_fp_mul(u, s[1], m[2][1]);
+    pasta_fp_add(t2, t2, u);
+    pasta_fp_mul(u, s[2], m[2][2]);
+    pasta_fp_add(t2, t2, u);
+
+    pasta_fp_add(s[0], t0, k[0]);
+    pasta_fp_add(s[1], t1, k[1]);
+    pasta_fp_add(s[2], t2, k[2]);
 }
 
-// Legacy poseidon permutation function
+// Legacy poseidon permutation: ark, sbox, mds per round, then a final ark
 static void permutation_legacy(PoseidonCtx *ctx)
 {
-    Field tmp;
+    Field *s = ctx->state;
+    const Field (*k)[3] = round_keys_legacy;
 
-    // Full rounds only
-    for (size_t r = 0; r < ctx->full_rounds; r++) {
-        // ark
-        for (size_t i = 0; i < ctx->sponge_width; i++) {
-            field_copy(tmp, ctx->state[i]);
-            field_add(ctx->state[i], tmp, ROUND_KEY(ctx, r, i));
-        }
+    pasta_fp_add(s[0], s[0], k[0][0]);
+    pasta_fp_add(s[1], s[1], k[0][1]);
+    pasta_fp_add(s[2], s[2], k[0][2]);
+    for (size_t r = 1; r < ROUND_COUNT_LEGACY; r++) {
+        sbox5(s[0]);
+        sbox5(s[1]);
+        sbox5(s[2]);
+        // the ark of the next round (or the final one) folds into the mds
+        mds3(s, mds_matrix_legacy, k[r]);
+    }
+}
 
-        // sbox
-        for (size_t i = 0; i < ctx->sponge_width; i++) {
-            field_copy(tmp, ctx->state[i]);
-            field_pow(ctx->state[i], tmp, ctx->sbox_alpha);
-        }
+// Kimchi poseidon permutation: sbox, mds, ark per round
+static void permutation_kimchi(PoseidonCtx *ctx)
+{
+    Field *s = ctx->state;
+    const Field (*k)[3] = round_keys_kimchi;
 
-        // mds
-        matrix_mul(ctx->state, ctx->mds_matrix, ctx->sponge_width);
+    for (size_t r = 0; r < ROUND_COUNT_KIMCHI; r++) {
+        sbox7(s[0]);
+        sbox7(s[1]);
+        sbox7(s[2]);
+        mds3(s, mds_matrix_kimchi, k[r]);
     }
+}
 
-    // Final ark
-    for (size_t i = 0; i < ctx->sponge_width; i++) {
-        field_copy(tmp, ctx->state[i]);
-        field_add(ctx->state[i], tmp, ROUND_KEY(ctx, ctx->full_rounds, i));
+// Lockstep width 3 kernels for poseidon_hash_many: the rounds of up to
+// POSEIDON_LANES independent states interleaved (s[l] is the state of
+// lane l), so the multiplications of different lanes can overlap
+static void permutation_width3_lanes(Field *s[], const size_t lanes, const uint8_t type)
+{
+    if (type == POSEIDON_LEGACY) {
+        const Field (*k)[3] = round_keys_legacy;
+        for (size_t l = 0; l < lanes; l++) {
+            pasta_fp_add(s[l][0], s[l][0], k[0][0]);
+            pasta_fp_add(s[l][1], s[l][1], k[0][1]);
+            pasta_fp_add(s[l][2], s[l][2], k[0][2]);
+        }
+        for (size_t r = 1; r < ROUND_COUNT_LEGACY; r++) {
+            for (size_t l = 0; l < lanes; l++) {
+                sbox5(s[l][0]);
+                sbox5(s[l][1]);
+                sbox5(s[l][2]);
+            }
+            for (size_t l = 0; l < lanes; l++) {
+                mds3(s[l], mds_matrix_legacy, k[r]);
+            }
+        }
+    }
+    else {
+        const Field (*k)[3] = round_keys_kimchi;
+        for (size_t r = 0; r < ROUND_COUNT_KIMCHI; r++) {
+            for (size_t l = 0; l < lanes; l++) {
+                sbox7(s[l][0]);
+                sbox7(s[l][1]);
+                sbox7(s[l][2]);
+            }
+            for (size_t l = 0; l < lanes; l++) {
+                mds3(s[l], mds_matrix_kimchi, k[r]);
+            }
+        }
     }
 }
 
-// Kimchi poseidon permutation function
-static void permutation_kimchi(PoseidonCtx *ctx)
+// The same on four lanes per vector (pasta_avx2.h), for groups of four
+// lanes s[g]; m is the MDS matrix packed (broadcast) by the caller
+static void sbox5_fp4(PastaFp4 *a)
 {
-    Field tmp;
+    PastaFp4 t;
+    pasta_fp4_sq(&t, a);
+    pasta_fp4_sq(&t, &t);
+    pasta_fp4_mul(a, &t, a);
+}
 
-    // Full rounds only
-    for (size_t r = 0; r < ctx->full_rounds; r++) {
-        // sbox
-        for (unsigned int i = 0; i < ctx->sponge_width; i++) {
-            field_copy(tmp, ctx->state[i]);
-            field_pow(ctx->state[i], tmp, ctx->sbox_alpha);
-        }
+static void sbox7_fp4(PastaFp4 *a)
+{
+    PastaFp4 a2, a3;
+    pasta_fp4_sq(&a2, a);
+    pasta_fp4_mul(&a3, &a2, a);
+    pasta_fp4_sq(&a2, &a2);
+    pasta_fp4_mul(a, &a3, &a2);
+}
+
+static void mds3_fp4(PastaFp4 s[3], const PastaFp4 m[3][3], const PastaFp4 k[3])
+{
+    PastaFp4 t[3], u;
+    for (size_t row = 0; row < 3; row++) {
+        pasta_fp4_mul(&t[row], &s[0], &m[row][0]);
+        pasta_fp4_mul(&u, &s[1], &m[row][1]);
+        pasta_fp4_add(&t[row], &t[row], &u);
+        pasta_fp4_mul(&u, &s[2], &m[row][2]);
+        pasta_fp4_add(&t[row], &t[row], &u);
+    }
+    for (size_t i = 0; i < 3; i++) {
+        pasta_fp4_add(&s[i], &t[i], &k[i]);
+    }
+}
 
-        // mds
-        matrix_mul(ctx->state, ctx->mds_matrix, ctx->sponge_width);
+// Broadcast of the constant a to all lanes
+static void fp4_broadcast(PastaFp4 *r, const Field a)
+{
+    const uint64_t *lanes[PASTA_FP4_LANES] = { a, a, a, a };
+    pasta_fp4_pack(r, lanes);
+}
 
-        // ark
-        for (unsigned int i = 0; i < ctx->sponge_width; i++) {
-            field_copy(tmp, ctx->state[i]);
-            field_add(ctx->state[i], tmp, ROUND_KEY(ctx, r, i));
+static void permutation_width3_fp4(PastaFp4 s[][3], const size_t groups, const uint8_t type,
+                                   const PastaFp4 m[3][3])
+{
+    const bool legacy = type == POSEIDON_LEGACY;
+    const Field (*k)[3] = legacy ? round_keys_legacy : round_keys_kimchi;
+    const size_t rounds = legacy ? ROUND_COUNT_LEGACY : ROUND_COUNT_KIMCHI;
+    PastaFp4 k4[3];
+
+    size_t r = 0;
+    if (legacy) {
+        for (size_t i = 0; i < 3; i++) {
+            fp4_broadcast(&k4[i], k[0][i]);
+        }
+        for (size_t g = 0; g < groups; g++) {
+            for (size_t i = 0; i < 3; i++) {
+                pasta_fp4_add(&s[g][i], &s[g][i], &k4[i]);
+            }
+        }
+        r = 1;
+    }
+    for (; r < rounds; r++) {
+        for (size_t i = 0; i < 3; i++) {
+            fp4_broadcast(&k4[i], k[r][i]);
+        }
+        for (size_t g = 0; g < groups; g++) {
+            for (size_t i = 0; i < 3; i++) {
+                if (legacy) {
+                    sbox5_fp4(&s[g][i]);
+                }
+                else {
+                    sbox7_fp4(&s[g][i]);
+                }
+            }
+        }
+        for (size_t g = 0; g < groups; g++) {
+            mds3_fp4(s[g], m, k4);
         }
     }
 }
@@ -151,6 +287,7 @@ bool poseidon_init(PoseidonCtx *ctx, const uint8_t type, const uint8_t network_i
         return false;
     }
 
+    ctx->type         = type;
     ctx->sponge_width = _poseidon_config[type].sponge_width;
     ctx->sponge_rate  = _poseidon_config[type].sponge_rate;
     ctx->full_rounds  = _poseidon_config[type].full_rounds;
@@ -174,27 +311,410 @@ bool poseidon_init(PoseidonCtx *ctx, const uint8_t type, const uint8_t network_i
 
 void poseidon_update(PoseidonCtx *ctx, const Field *input, size_t len)
 {
-    Field tmp;
     for (size_t i = 0; i < len; i++) {
         if (ctx->absorbed == ctx->sponge_rate) {
             ctx->permutation(ctx);
             ctx->absorbed = 0;
         }
-        field_copy(tmp, ctx->state[ctx->absorbed]);
-        field_add(ctx->state[ctx->absorbed], tmp, input[i]);
+        pasta_fp_add(ctx->state[ctx->absorbed], ctx->state[ctx->absorbed], input[i]);
         ctx->absorbed++;
     }
 }
 
-// Squeezing poseidon returns the first element of its current state.
-void poseidon_digest(Scalar out, PoseidonCtx *ctx) {
-    ctx->permutation(ctx);
-
+// The hash output for the final state element s0
+static void squeeze(Scalar out, const Field s0)
+{
     uint64_t tmp[4];
-    fiat_pasta_fp_from_montgomery(tmp, ctx->state[0]);
+    pasta_fp_from_montgomery(tmp, s0);
 
     // since the difference in modulus between the two fields is < 2^125,
     // with high probability, a random value from one field will fit in the
     // other field.
-    fiat_pasta_fq_to_montgomery(out, tmp);
+    pasta_fq_to_montgomery(out, tmp);
+}
+
+// Squeezing poseidon returns the first element of its current state.
+void poseidon_digest(Scalar out, PoseidonCtx *ctx) {
+    ctx->permutation(ctx);
+    squeeze(out, ctx->state[0]);
+}
+
+void poseidon_snapshot(PoseidonSnapshot *snap, const PoseidonCtx *ctx)
+{
+    memcpy(snap->state, ctx->state, sizeof(State));
+    snap->absorbed = ctx->absorbed;
+    snap->type = ctx->type;
+}
+
+bool poseidon_restore(PoseidonCtx *ctx, const PoseidonSnapshot *snap)
+{
+    if (!poseidon_init(ctx, snap->type, NULLNET_ID)) {
+        return false;
+    }
+    memcpy(ctx->state, snap->state, sizeof(State));
+    ctx->absorbed = snap->absorbed;
+    return true;
+}
+
+void poseidon_clone(PoseidonCtx *dst, const PoseidonCtx *src)
+{
+    memcpy(dst, src, sizeof(PoseidonCtx));
+}
+
+// Prefix cache: entries[0..size) in a doubly linked LRU list (most
+// recently used first) and chained from buckets by hash of their key
+#define PREFIX_NIL UINT32_MAX
+
+typedef struct prefix_entry_t {
+    Field    key[POSEIDON_PREFIX_LEN];
+    uint8_t  type;
+    uint8_t  network_id;
+    PoseidonSnapshot snap;
+    uint32_t prev;
+    uint32_t next;
+    uint32_t chain;
+} PrefixEntry;
+
+static struct {
+    pthread_mutex_t lock;
+    PrefixEntry *entries;
+    uint32_t *buckets;
+    size_t capacity;
+    size_t size;
+    size_t bucket_mask;
+    uint32_t head;
+    uint32_t tail;
+    uint64_t hits;
+    uint64_t misses;
+} _prefix_cache = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+static size_t prefix_bucket(const uint8_t type, const uint8_t network_id, const Field key[POSEIDON_PREFIX_LEN])
+{
+    uint64_t h = ((uint64_t)type << 8) | network_id;
+    for (size_t i = 0; i < POSEIDON_PREFIX_LEN; i++) {
+        for (size_t j = 0; j < LIMBS_PER_FIELD; j++) {
+            h = (h ^ key[i][j]) * 0x9e3779b97f4a7c15;
+        }
+    }
+    return (size_t)(h >> 32) & _prefix_cache.bucket_mask;
+}
+
+static void prefix_lru_unlink(const uint32_t i)
+{
+    PrefixEntry *e = &_prefix_cache.entries[i];
+    if (e->prev != PREFIX_NIL) {
+        _prefix_cache.entries[e->prev].next = e->next;
+    }
+    else {
+        _prefix_cache.head = e->next;
+    }
+    if (e->next != PREFIX_NIL) {
+        _prefix_cache.entries[e->next].prev = e->prev;
+    }
+    else {
+        _prefix_cache.tail = e->prev;
+    }
+}
+
+static void prefix_lru_push(const uint32_t i)
+{
+    PrefixEntry *e = &_prefix_cache.entries[i];
+    e->prev = PREFIX_NIL;
+    e->next = _prefix_cache.head;
+    if (_prefix_cache.head != PREFIX_NIL) {
+        _prefix_cache.entries[_prefix_cache.head].prev = i;
+    }
+    else {
+        _prefix_cache.tail = i;
+    }
+    _prefix_cache.head = i;
+}
+
+// Entry of the key in bucket b, or PREFIX_NIL (lock held)
+static uint32_t prefix_find(const size_t b, const uint8_t type, const uint8_t network_id,
+                            const Field key[POSEIDON_PREFIX_LEN])
+{
+    for (uint32_t i = _prefix_cache.buckets[b]; i != PREFIX_NIL; i = _prefix_cache.entries[i].chain) {
+        const PrefixEntry *e = &_prefix_cache.entries[i];
+        if (e->type == type && e->network_id == network_id
+            && memcmp(e->key, key, sizeof(e->key)) == 0) {
+            return i;
+        }
+    }
+    return PREFIX_NIL;
+}
+
+// Stores the state for key, evicting the least recently used entry when
+// full (lock held)
+static void prefix_insert(const size_t b, const uint8_t type, const uint8_t network_id,
+                          const Field key[POSEIDON_PREFIX_LEN], const PoseidonSnapshot *snap)
+{
+    uint32_t i;
+    if (_prefix_cache.size < _prefix_cache.capacity) {
+        i = (uint32_t)_prefix_cache.size++;
+    }
+    else {
+        i = _prefix_cache.tail;
+        prefix_lru_unlink(i);
+        const PrefixEntry *old = &_prefix_cache.entries[i];
+        uint32_t *link = &_prefix_cache.buckets[prefix_bucket(old->type, old->network_id, old->key)];
+        while (*link != i) {
+            link = &_prefix_cache.entries[*link].chain;
+        }
+        *link = old->chain;
+    }
+
+    PrefixEntry *e = &_prefix_cache.entries[i];
+    memcpy(e->key, key, sizeof(e->key));
+    e->type = type;
+    e->network_id = network_id;
+    e->snap = *snap;
+    e->chain = _prefix_cache.buckets[b];
+    _prefix_cache.buckets[b] = i;
+    prefix_lru_push(i);
+}
+
+// Frees the entries (lock held)
+static void prefix_cache_clear(void)
+{
+    free(_prefix_cache.entries);
+    free(_prefix_cache.buckets);
+    _prefix_cache.entries = NULL;
+    _prefix_cache.buckets = NULL;
+    _prefix_cache.capacity = 0;
+    _prefix_cache.size = 0;
+    _prefix_cache.bucket_mask = 0;
+    _prefix_cache.head = PREFIX_NIL;
+    _prefix_cache.tail = PREFIX_NIL;
+    _prefix_cache.hits = 0;
+    _prefix_cache.misses = 0;
+}
+
+bool poseidon_prefix_cache_enable(const size_t capacity)
+{
+    if (capacity >= PREFIX_NIL) {
+        return false;
+    }
+
+    // at least twice as many buckets as entries
+    size_t buckets = 1;
+    while (buckets < 2 * capacity) {
+        buckets <<= 1;
+    }
+
+    bool ok = true;
+    pthread_mutex_lock(&_prefix_cache.lock);
+    prefix_cache_clear();
+    if (capacity > 0) {
+        _prefix_cache.entries = malloc(capacity * sizeof(PrefixEntry));
+        _prefix_cache.buckets = malloc(buckets * sizeof(uint32_t));
+        if (_prefix_cache.entries == NULL || _prefix_cache.buckets == NULL) {
+            prefix_cache_clear();
+            ok = false;
+        }
+        else {
+            memset(_prefix_cache.buckets, 0xff, buckets * sizeof(uint32_t));
+            _prefix_cache.capacity = capacity;
+            _prefix_cache.bucket_mask = buckets - 1;
+        }
+    }
+    pthread_mutex_unlock(&_prefix_cache.lock);
+    return ok;
+}
+
+void poseidon_prefix_cache_disable(void)
+{
+    poseidon_prefix_cache_enable(0);
+}
+
+bool poseidon_prefix_cache_enabled(void)
+{
+    pthread_mutex_lock(&_prefix_cache.lock);
+    const bool enabled = _prefix_cache.capacity > 0;
+    pthread_mutex_unlock(&_prefix_cache.lock);
+    return enabled;
+}
+
+void poseidon_prefix_cache_stats(uint64_t *hits, uint64_t *misses)
+{
+    pthread_mutex_lock(&_prefix_cache.lock);
+    *hits = _prefix_cache.hits;
+    *misses = _prefix_cache.misses;
+    pthread_mutex_unlock(&_prefix_cache.lock);
+}
+
+bool poseidon_init_prefix(PoseidonCtx *ctx, const uint8_t type, const uint8_t network_id,
+                          const Field prefix[POSEIDON_PREFIX_LEN])
+{
+    if (!poseidon_init(ctx, type, network_id)) {
+        return false;
+    }
+
+    PoseidonSnapshot snap;
+    size_t b = 0;
+    pthread_mutex_lock(&_prefix_cache.lock);
+    const bool enabled = _prefix_cache.capacity > 0;
+    if (enabled) {
+        b = prefix_bucket(type, network_id, prefix);
+        const uint32_t i = prefix_find(b, type, network_id, prefix);
+        if (i != PREFIX_NIL) {
+            _prefix_cache.hits++;
+            prefix_lru_unlink(i);
+            prefix_lru_push(i);
+            snap = _prefix_cache.entries[i].snap;
+            pthread_mutex_unlock(&_prefix_cache.lock);
+            memcpy(ctx->state, snap.state, sizeof(State));
+            ctx->absorbed = snap.absorbed;
+            return true;
+        }
+        _prefix_cache.misses++;
+    }
+    pthread_mutex_unlock(&_prefix_cache.lock);
+
+    // Both blocks are full: run the permutation poseidon_update would
+    // otherwise leave for the next element
+    poseidon_update(ctx, prefix, POSEIDON_PREFIX_LEN);
+    if (ctx->absorbed == ctx->sponge_rate) {
+        ctx->permutation(ctx);
+        ctx->absorbed = 0;
+    }
+    if (!enabled) {
+        return true;
+    }
+
+    // The permutations ran unlocked: another thread (or a resize) may
+    // have changed the cache meanwhile
+    poseidon_snapshot(&snap, ctx);
+    pthread_mutex_lock(&_prefix_cache.lock);
+    if (_prefix_cache.capacity > 0) {
+        b = prefix_bucket(type, network_id, prefix);
+        if (prefix_find(b, type, network_id, prefix) == PREFIX_NIL) {
+            prefix_insert(b, type, network_id, prefix, &snap);
+        }
+    }
+    pthread_mutex_unlock(&_prefix_cache.lock);
+    return true;
+}
+
+// Permutations a message of len elements goes through: one per full
+// block absorbed before more input arrives, and the one of the digest
+static size_t permutation_count(const size_t len, const size_t rate)
+{
+    return len ? (len + rate - 1) / rate : 1;
+}
+
+// Hashes lanes <= POSEIDON_LANES messages, starting from the state of ctx
+static void hash_lanes(Scalar *out, const Field *const *inputs, const size_t *lens,
+                       const size_t lanes, const PoseidonCtx *ctx)
+{
+    State s[POSEIDON_LANES];
+    size_t steps[POSEIDON_LANES], max_steps = 0;
+    for (size_t l = 0; l < lanes; l++) {
+        memcpy(s[l], ctx->state, sizeof(State));
+        steps[l] = permutation_count(lens[l], ctx->sponge_rate);
+        max_steps = steps[l] > max_steps ? steps[l] : max_steps;
+    }
+
+    for (size_t b = 0; b < max_steps; b++) {
+        // lanes still absorbing: finished ones drop out of the lockstep
+        Field *active[POSEIDON_LANES];
+        size_t count = 0;
+        for (size_t l = 0; l < lanes; l++) {
+            if (b >= steps[l]) {
+                continue;
+            }
+            for (size_t i = 0; i < ctx->sponge_rate && b * ctx->sponge_rate + i < lens[l]; i++) {
+                pasta_fp_add(s[l][i], s[l][i], inputs[l][b * ctx->sponge_rate + i]);
+            }
+            active[count++] = s[l];
+        }
+        permutation_width3_lanes(active, count, ctx->type);
+        for (size_t l = 0; l < lanes; l++) {
+            if (b + 1 == steps[l]) {
+                squeeze(out[l], s[l][0]);
+            }
+        }
+    }
+}
+
+// Hashes lanes <= POSEIDON_LANES_AVX2 messages on the four-lane vectors.
+// All lanes of a group run every permutation: lanes past the end of their
+// message absorb zero and their later states are ignored.
+static void hash_lanes_fp4(Scalar *out, const Field *const *inputs, const size_t *lens,
+                           const size_t lanes, const PoseidonCtx *ctx)
+{
+    const Field zero = { 0, 0, 0, 0 };
+    const size_t groups = (lanes + PASTA_FP4_LANES - 1) / PASTA_FP4_LANES;
+    PastaFp4 s[POSEIDON_LANES_AVX2 / PASTA_FP4_LANES][3], m[3][3];
+    size_t steps[POSEIDON_LANES_AVX2], max_steps = 0;
+
+    const Field (*mds)[3] = ctx->type == POSEIDON_LEGACY ? mds_matrix_legacy : mds_matrix_kimchi;
+    for (size_t row = 0; row < 3; row++) {
+        for (size_t col = 0; col < 3; col++) {
+            fp4_broadcast(&m[row][col], mds[row][col]);
+        }
+    }
+    for (size_t g = 0; g < groups; g++) {
+        for (size_t i = 0; i < 3; i++) {
+            fp4_broadcast(&s[g][i], ctx->state[i]);
+        }
+    }
+    for (size_t l = 0; l < lanes; l++) {
+        steps[l] = permutation_count(lens[l], ctx->sponge_rate);
+        max_steps = steps[l] > max_steps ? steps[l] : max_steps;
+    }
+
+    for (size_t b = 0; b < max_steps; b++) {
+        for (size_t g = 0; g < groups; g++) {
+            for (size_t i = 0; i < ctx->sponge_rate; i++) {
+                const uint64_t *x[PASTA_FP4_LANES];
+                const size_t pos = b * ctx->sponge_rate + i;
+                for (size_t j = 0; j < PASTA_FP4_LANES; j++) {
+                    const size_t l = g * PASTA_FP4_LANES + j;
+                    x[j] = l < lanes && pos < lens[l] ? inputs[l][pos] : zero;
+                }
+                PastaFp4 x4;
+                pasta_fp4_pack(&x4, x);
+                pasta_fp4_add(&s[g][i], &s[g][i], &x4);
+            }
+        }
+        permutation_width3_fp4(s, groups, ctx->type, (const PastaFp4 (*)[3])m);
+        for (size_t g = 0; g < groups; g++) {
+            Field s0[PASTA_FP4_LANES];
+            uint64_t *x[PASTA_FP4_LANES] = { s0[0], s0[1], s0[2], s0[3] };
+            bool unpacked = false;
+            for (size_t j = 0; j < PASTA_FP4_LANES; j++) {
+                const size_t l = g * PASTA_FP4_LANES + j;
+                if (l < lanes && b + 1 == steps[l]) {
+                    if (!unpacked) {
+                        pasta_fp4_unpack(x, &s[g][0]);
+                        unpacked = true;
+                    }
+                    squeeze(out[l], s0[j]);
+                }
+            }
+        }
+    }
+}
+
+bool poseidon_hash_many(Scalar *out, const Field *const *inputs, const size_t *lens, const size_t n,
+                        const uint8_t type, const uint8_t network_id)
+{
+    PoseidonCtx ctx;
+    if (!poseidon_init(&ctx, type, network_id)) {
+        return false;
+    }
+
+    const size_t group = pasta_use_avx2 ? POSEIDON_LANES_AVX2 : POSEIDON_LANES;
+    for (size_t start = 0; start < n; start += group) {
+        const size_t lanes = n - start < group ? n - start : group;
+        if (pasta_use_avx2) {
+            hash_lanes_fp4(&out[start], &inputs[start], &lens[start], lanes, &ctx);
+        }
+        else {
+            hash_lanes(&out[start], &inputs[start], &lens[start], lanes, &ctx);
+        }
+    }
+
+    return true;
 }
@@ -43,3 +43,48 @@ typedef struct poseidon_context_t {
 bool poseidon_init(PoseidonCtx *ctx, const uint8_t type, const uint8_t network_id);
 void poseidon_update(PoseidonCtx *ctx, const Field *input, size_t len);
 void poseidon_digest(Scalar out, PoseidonCtx *ctx);
+
+// Snapshots: the mutable part of a sponge, to store and resume later.
+// poseidon_clone copies a sponge that then continues independently.
+typedef struct poseidon_snapshot_t {
+    State   state;
+    size_t  absorbed;
+    uint8_t type;
+} PoseidonSnapshot;
+
+void poseidon_snapshot(PoseidonSnapshot *snap, const PoseidonCtx *ctx);
+bool poseidon_restore(PoseidonCtx *ctx, const PoseidonSnapshot *snap);
+void poseidon_clone(PoseidonCtx *dst, const PoseidonCtx *src);
+
+// Prefix cache (opt-in, thread-safe)
+//
+//     poseidon_init_prefix gives the sponge after absorbing the first
+//     POSEIDON_PREFIX_LEN elements of a message (two full blocks), with
+//     both their permutations already run, so at least one more element
+//     must follow before poseidon_digest.  With the cache enabled the
+//     resulting states are kept for the capacity most recently used
+//     prefixes (per type and network), skipping the permutations for
+//     repeated ones.  message_hash uses it for the leading public key
+//     fields of its messages (the parties to a payment).
+#define POSEIDON_PREFIX_LEN 4
+
+bool poseidon_init_prefix(PoseidonCtx *ctx, const uint8_t type, const uint8_t network_id,
+                          const Field prefix[POSEIDON_PREFIX_LEN]);
+
+// capacity 0 disables the cache; both drop its entries and statistics
+bool poseidon_prefix_cache_enable(size_t capacity);
+void poseidon_prefix_cache_disable(void);
+bool poseidon_prefix_cache_enabled(void);
+// Lookups since enabled; the hit rate is hits / (hits + misses)
+void poseidon_prefix_cache_stats(uint64_t *hits, uint64_t *misses);
+
+// Sponges poseidon_hash_many runs in lockstep: interleaved on the scalar
+// field backends, or two four-lane vectors with pasta_use_avx2
+#define POSEIDON_LANES      4
+#define POSEIDON_LANES_AVX2 8
+
+// out[i] = hash of inputs[i][0..lens[i]) for n independent messages of any
+// lengths, equal to poseidon_init, poseidon_update and poseidon_digest on
+// each.  Returns false for an invalid type or network_id.
+bool poseidon_hash_many(Scalar *out, const Field *const *inputs, const size_t *lens, size_t n,
+                        const uint8_t type, const uint8_t network_id);
@@ -11,8 +11,9 @@
 #define SPONGE_RATE_KIMCHI  2
 #define SBOX_ALPHA_KIMCHI   7
 
-// Round constants
-static const Field round_keys_kimchi[ROUND_COUNT_KIMCHI][SPONGE_WIDTH_KIMCHI] =
+// Round constants, one row of the sponge width (96 bytes) per round; the
+// table starts on a cache line
+static const Field round_keys_kimchi[ROUND_COUNT_KIMCHI][SPONGE_WIDTH_KIMCHI] __attribute__((aligned(64))) =
 {    {
         {0xd7224f9b885cd4e9, 0x6f184251a7e022f2, 0x5530ffaefe8a2dab, 0x212f41bcc627c1c7},
         {0xdbac75839aab548, 0x48bdc759224af0f7, 0x7f74df5c7e415974, 0x38802be08741ddca},
@@ -291,7 +292,7 @@ static const Field round_keys_kimchi[ROUND_COUNT_KIMCHI][SPONGE_WIDTH_KIMCHI] =
 };
 
 // MDS matrix
-static const Field mds_matrix_kimchi[SPONGE_WIDTH_KIMCHI][SPONGE_WIDTH_KIMCHI] =
+static const Field mds_matrix_kimchi[SPONGE_WIDTH_KIMCHI][SPONGE_WIDTH_KIMCHI] __attribute__((aligned(64))) =
 {
     {
         {0x2325ecd774ed5ef5, 0x6e29dac6a3c7cdd1, 0xe5beb6083a511912, 0x9676da44236aeec},
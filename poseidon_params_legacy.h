@@ -11,8 +11,9 @@
 #define SPONGE_RATE_LEGACY  2
 #define SBOX_ALPHA_LEGACY   5
 
-// Round constants
-static const Field round_keys_legacy[ROUND_COUNT_LEGACY][SPONGE_WIDTH_LEGACY] =
+// Round constants, one row of the sponge width (96 bytes) per round; the
+// table starts on a cache line
+static const Field round_keys_legacy[ROUND_COUNT_LEGACY][SPONGE_WIDTH_LEGACY] __attribute__((aligned(64))) =
 {
     {
         {0xd2425a07cfec91d, 0x6130240fd42af5be, 0x3fb56f00f649325, 0x107d26d6fefb125f},
@@ -337,7 +338,7 @@ static const Field round_keys_legacy[ROUND_COUNT_LEGACY][SPONGE_WIDTH_LEGACY] =
 };
 
 // MDS matrix
-static const Field mds_matrix_legacy[SPONGE_WIDTH_LEGACY][SPONGE_WIDTH_LEGACY] =
+static const Field mds_matrix_legacy[SPONGE_WIDTH_LEGACY][SPONGE_WIDTH_LEGACY] __attribute__((aligned(64))) =
 {
     {
         {0x32f4f94379d14f6, 0x666eef381fb1d4b0, 0xd760525c85a9299a, 0x70288de13f861f},
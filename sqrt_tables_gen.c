@@ -0,0 +1,100 @@
+// sqrt_tables_gen.c - generates pasta_fp_sqrt_tables.c
+//
+//     make sqrt_tables
+//
+//     Roots of unity for the table-driven Fp square root in pasta_fp.c
+//     (see pasta_fp_sqrt_tables.h).  With t = (p - 1) / 2^32 and w = 5^t
+//
+//         SQRT_TABLE[i][k] = w^(-k * 2^(8i))
+//
+//     and SQRT_DLOG_INDEX maps the 2^8-th roots of unity g^k (g = w^(2^24),
+//     g^k = SQRT_TABLE[3][-k mod 256]) back to k through an open addressing
+//     hash of their first limb, filled for k = 0, 1, ... with linear
+//     probing.  The values are computed with fiat.
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "pasta_fp.h"
+#include "pasta_fp_sqrt_tables.h"
+
+#define SQRT_DLOG_SLOTS (1 << SQRT_DLOG_BITS)
+#define SQRT_DLOG_EMPTY 0xffff
+
+// t = (p - 1) / 2^32
+static const uint64_t T[4] = { 0x094cf91b992d30ed, 0x00000000224698fc, 0x0, 0x40000000 };
+
+int main(void)
+{
+    static uint64_t table[4][256][4];
+    uint64_t w[4], step[4];
+    const uint64_t five[4] = { 5, 0, 0, 0 }, one[4] = { 1, 0, 0, 0 };
+    fiat_pasta_fp_to_montgomery(w, five);
+    fiat_pasta_fp_pow(w, w, T);
+    fiat_pasta_fp_inv(step, w);
+
+    // step = w^(-2^(8i)) for row i
+    for (size_t i = 0; i < 4; i++) {
+        fiat_pasta_fp_to_montgomery(table[i][0], one);
+        for (size_t k = 1; k < 256; k++) {
+            fiat_pasta_fp_mul(table[i][k], table[i][k - 1], step);
+        }
+        for (size_t k = 0; k < 8; k++) {
+            fiat_pasta_fp_square(step, step);
+        }
+    }
+
+    uint16_t index[SQRT_DLOG_SLOTS];
+    size_t longest = 0;
+    for (size_t h = 0; h < SQRT_DLOG_SLOTS; h++) {
+        index[h] = SQRT_DLOG_EMPTY;
+    }
+    for (uint16_t k = 0; k < 256; k++) {
+        const uint64_t *g = table[3][(256 - k) & 0xff];
+        size_t h = (size_t)((g[0] * SQRT_DLOG_HASH) >> (64 - SQRT_DLOG_BITS)), probes = 1;
+        while (index[h] != SQRT_DLOG_EMPTY) {
+            h = (h + 1) % SQRT_DLOG_SLOTS;
+            probes++;
+        }
+        index[h] = k;
+        if (probes > longest) {
+            longest = probes;
+        }
+    }
+
+    printf("// pasta_fp_sqrt_tables.c - roots of unity for the table-driven Fp square root\n");
+    printf("//\n");
+    printf("//    These constants were generated by sqrt_tables_gen.c\n");
+    printf("//    Generate: make sqrt_tables\n");
+    printf("//    Do not edit this file\n");
+    printf("//\n");
+    printf("//    Longest probe sequence of SQRT_DLOG_INDEX: %zu\n", longest);
+    printf("\n");
+    printf("#include \"pasta_fp_sqrt_tables.h\"\n");
+    printf("\n");
+    printf("const uint64_t SQRT_TABLE[4][256][4] = {\n");
+    for (size_t i = 0; i < 4; i++) {
+        printf("    {\n");
+        for (size_t k = 0; k < 256; k++) {
+            const uint64_t *x = table[i][k];
+            printf("        { 0x%016" PRIx64 ", 0x%016" PRIx64 ", 0x%016" PRIx64 ", 0x%016" PRIx64 " },\n",
+                   x[0], x[1], x[2], x[3]);
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+    printf("\n");
+    printf("const uint16_t SQRT_DLOG_INDEX[1 << SQRT_DLOG_BITS] = {\n");
+    for (size_t h = 0; h < SQRT_DLOG_SLOTS; h += 8) {
+        printf("   ");
+        for (size_t j = h; j < h + 8; j++) {
+            printf(" 0x%04" PRIx16 ",", index[j]);
+        }
+        printf("\n");
+    }
+    printf("};\n");
+
+    return 0;
+}
@@ -5,6 +5,11 @@
 
 #include "pasta_fp.h"
 #include "pasta_fq.h"
+#include "pasta_x86_64.h"
+#include "pasta_sparse.h"
+#include "pasta_avx2.h"
+#include "pasta_inline.h"
+#include "pasta_fp_sqrt_tables.h"
 #include "crypto.h"
 #include "poseidon.h"
 #include "base10.h"
@@ -182,6 +187,36 @@ bool sign_transaction(char *signature, const size_t len,
     return false;
   }
 
+  // The signature does not verify for a different amount
+  txn.amount++;
+  if (verify(&sig, &pub_compressed, &txn, network_id)) {
+    return false;
+  }
+  txn.amount--;
+
+  // Nor for rx or s out of range or a different rx
+  Signature bad = sig;
+  bad.rx[0] = PASTA_FP_M0;
+  bad.rx[1] = PASTA_FP_M1;
+  bad.rx[2] = 0;
+  bad.rx[3] = PASTA_M3;
+  if (verify(&bad, &pub_compressed, &txn, network_id)) {
+    return false;
+  }
+  bad = sig;
+  bad.s[0] = PASTA_FQ_M0;
+  bad.s[1] = PASTA_FQ_M1;
+  bad.s[2] = 0;
+  bad.s[3] = PASTA_M3;
+  if (verify(&bad, &pub_compressed, &txn, network_id)) {
+    return false;
+  }
+  bad = sig;
+  fiat_pasta_fp_opp(bad.rx, sig.rx);
+  if (verify(&bad, &pub_compressed, &txn, network_id)) {
+    return false;
+  }
+
   sig_to_hex(signature, len, sig);
 
   if (_verbose) {
@@ -578,6 +613,61 @@ void test_scalars() {
     assert(scalar_from_hex(s, "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff3f"));
     assert(!scalar_from_hex(s, "0000000000000000000000000000000000000000000000000000000000000040"));
     assert(!scalar_from_hex(s, "01000000ed302d991bf94c09fc98462200000000000000000000000000000040"));
+
+    // Inversion
+    Scalar zero, one, s_inv, t;
+    assert(scalar_from_hex(zero, "0000000000000000000000000000000000000000000000000000000000000000"));
+    assert(scalar_from_hex(one, "0100000000000000000000000000000000000000000000000000000000000000"));
+    scalar_inv(t, zero);
+    assert(scalar_eq(t, zero));
+    scalar_inv(t, one);
+    assert(scalar_eq(t, one));
+    assert(scalar_from_hex(s, "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff3f"));
+    for (size_t i = 0; i < 16; i++) {
+      scalar_inv(s_inv, s);
+      scalar_mul(t, s, s_inv);
+      assert(scalar_eq(t, one));
+      sha256_hash(s, sizeof(s), t, sizeof(t));
+      scalar_from_words(s, t);
+    }
+
+    // Exponentiation: s^0 = 1 and s^(q - 2) = 1/s
+    const uint64_t e_zero[4] = { 0, 0, 0, 0 };
+    const uint64_t q_minus_2[4] = { 0x8c46eb20ffffffff, 0x224698fc0994a8dd, 0x0, 0x4000000000000000 };
+    scalar_pow(t, s, e_zero);
+    assert(scalar_eq(t, one));
+    scalar_pow(t, s, q_minus_2);
+    scalar_inv(s_inv, s);
+    assert(scalar_eq(t, s_inv));
+
+    // Square roots and quadratic residuosity
+    Scalar s2, r;
+    for (size_t i = 0; i < 8; i++) {
+      scalar_sq(s2, s);
+      assert(scalar_legendre(s2) == 1);
+      assert(scalar_sqrt(r, s2));
+      scalar_sq(t, r);
+      assert(scalar_eq(t, s2));
+      sha256_hash(s, sizeof(s), t, sizeof(t));
+      scalar_from_words(s, t);
+    }
+    assert(scalar_legendre(zero) == 0);
+    assert(scalar_sqrt(r, zero) && scalar_eq(r, zero));
+    // 5 generates the multiplicative group of Fq, so it is a non-residue
+    assert(scalar_from_hex(s, "0500000000000000000000000000000000000000000000000000000000000000"));
+    assert(scalar_legendre(s) == -1);
+    assert(!scalar_sqrt(r, s));
+
+    // Canonical byte decoding accepts q - 1 and rejects q
+    uint8_t bytes[SCALAR_BYTES] = {
+      0x00, 0x00, 0x00, 0x00, 0x21, 0xeb, 0x46, 0x8c, 0xdd, 0xa8, 0x94, 0x09, 0xfc, 0x98, 0x46, 0x22,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40
+    };
+    assert(scalar_from_bytes(s, bytes));
+    scalar_add(t, s, one);
+    assert(scalar_eq(t, zero));
+    bytes[0] = 0x01;
+    assert(!scalar_from_bytes(s, bytes));
 }
 
 void test_fields() {
@@ -587,6 +677,895 @@ void test_fields() {
     assert(field_from_hex(f, "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff3f"));
     assert(!field_from_hex(f, "0000000000000000000000000000000000000000000000000000000000000040"));
     assert(!field_from_hex(f, "01000000ed302d991bf94c09fc98462200000000000000000000000000000040"));
+
+    // Inversion
+    Field zero, one, f_inv, t;
+    assert(field_from_hex(zero, "0000000000000000000000000000000000000000000000000000000000000000"));
+    assert(field_from_hex(one, "0100000000000000000000000000000000000000000000000000000000000000"));
+    field_inv(t, zero);
+    assert(fiat_pasta_fp_equals(t, zero));
+    field_inv(t, one);
+    assert(fiat_pasta_fp_equals(t, one));
+    for (size_t i = 0; i < 16; i++) {
+      field_inv(f_inv, f);
+      field_mul(t, f, f_inv);
+      assert(fiat_pasta_fp_equals(t, one));
+      sha256_hash(f, sizeof(f), t, sizeof(t));
+      t[3] &= (((uint64_t)1 << 62) - 1);
+      fiat_pasta_fp_to_montgomery(f, t);
+    }
+
+    // Exponentiation: f^(p - 2) = 1/f, against the safegcd inversion
+    // directly for 0, 1, p - 1 and pseudo-random f
+    const uint64_t p_minus_2[4] = { 0x992d30ecffffffff, 0x224698fc094cf91b, 0x0, 0x4000000000000000 };
+    fiat_pasta_fp_pow(t, f, p_minus_2);
+    field_inv(f_inv, f);
+    assert(fiat_pasta_fp_equals(t, f_inv));
+    Field g;
+    for (size_t i = 0; i < 19; i++) {
+      if (i == 0) {
+        field_copy(g, zero);
+      }
+      else if (i == 1) {
+        field_copy(g, one);
+      }
+      else if (i == 2) {
+        fiat_pasta_fp_opp(g, one);
+      }
+      else {
+        sha256_hash(g, sizeof(g), f, sizeof(f));
+        g[3] &= (((uint64_t)1 << 62) - 1);
+        fiat_pasta_fp_to_montgomery(f, g);
+        field_copy(g, f);
+      }
+      fiat_pasta_fp_pow(t, g, p_minus_2);
+      fiat_pasta_fp_inv(f_inv, g);
+      assert(fiat_pasta_fp_equals(t, f_inv));
+    }
+
+    // Square root tables: SQRT_TABLE[i][k] = w^(-k * 2^(8i)), w = 5^t
+    const uint64_t t_exp[4] = { 0x094cf91b992d30ed, 0x00000000224698fc, 0x0, 0x40000000 };
+    Field w, step;
+    assert(field_from_hex(w, "0500000000000000000000000000000000000000000000000000000000000000"));
+    fiat_pasta_fp_pow(w, w, t_exp);
+    field_inv(step, w);
+    for (size_t i = 0; i < 4; i++) {
+      field_copy(t, one);
+      for (size_t k = 0; k < 256; k++) {
+        assert(fiat_pasta_fp_equals(SQRT_TABLE[i][k], t));
+        field_mul(t, t, step);
+      }
+      for (size_t k = 0; k < 8; k++) {
+        field_sq(step, step);
+      }
+    }
+    for (uint16_t k = 0; k < 256; k++) {
+      const uint64_t *g = SQRT_TABLE[3][(256 - k) & 0xff];
+      size_t h = (size_t)((g[0] * SQRT_DLOG_HASH) >> (64 - SQRT_DLOG_BITS));
+      while (SQRT_DLOG_INDEX[h] != k) {
+        assert(SQRT_DLOG_INDEX[h] != 0xffff);
+        h = (h + 1) % ARRAY_LEN(SQRT_DLOG_INDEX);
+      }
+    }
+
+    // Square roots: the table-driven sqrt, its constant time variant and
+    // Tonelli-Shanks agree on which values are squares
+    Field r, r_ct, r_ts;
+    assert(fiat_pasta_fp_sqrt(r, zero) && fiat_pasta_fp_equals(r, zero));
+    assert(fiat_pasta_fp_sqrt_ct(r_ct, zero) && fiat_pasta_fp_equals(r_ct, zero));
+    assert(!fiat_pasta_fp_sqrt(r, w) && !fiat_pasta_fp_sqrt_ct(r_ct, w));
+    size_t squares = 0;
+    for (size_t i = 0; i < 64; i++) {
+      const bool is_square = fiat_pasta_fp_sqrt(r, f);
+      assert(fiat_pasta_fp_sqrt_ct(r_ct, f) == is_square);
+      assert(fiat_pasta_fp_sqrt_ts(r_ts, f) == is_square);
+      assert(is_square == (fiat_pasta_fp_legendre(f) == 1));
+      if (is_square) {
+        squares++;
+        assert(fiat_pasta_fp_equals(r, r_ct));
+        field_sq(t, r);
+        assert(fiat_pasta_fp_equals(t, f));
+      }
+
+      field_sq(t, f);
+      assert(fiat_pasta_fp_sqrt(r, t));
+      field_sq(r, r);
+      assert(fiat_pasta_fp_equals(r, t));
+
+      sha256_hash(f, sizeof(f), t, sizeof(t));
+      t[3] &= (((uint64_t)1 << 62) - 1);
+      fiat_pasta_fp_to_montgomery(f, t);
+    }
+    assert(squares > 0 && squares < 64);
+
+    // Legendre symbol (binary GCD) against Euler's criterion f^((p - 1)/2),
+    // including 0, 1, p - 1 and small values
+    const uint64_t p_minus_1_over_2[4] = { 0xcc96987680000000, 0x11234c7e04a67c8d, 0x0, 0x2000000000000000 };
+    Field minus_one;
+    fiat_pasta_fp_opp(minus_one, one);
+    assert(fiat_pasta_fp_legendre(zero) == 0 && field_is_square(zero));
+    assert(fiat_pasta_fp_legendre(one) == 1 && field_is_square(one));
+    assert(fiat_pasta_fp_legendre(minus_one) == 1);
+    assert(fiat_pasta_fp_legendre(w) == -1 && !field_is_square(w));
+    for (size_t i = 0; i < 256; i++) {
+      if (i < 32) {
+        t[0] = i;
+        t[1] = t[2] = t[3] = 0;
+      } else {
+        sha256_hash(f, sizeof(f), t, sizeof(t));
+        t[3] &= (((uint64_t)1 << 62) - 1);
+      }
+      fiat_pasta_fp_to_montgomery(f, t);
+      fiat_pasta_fp_pow(r, f, p_minus_1_over_2);
+      const int expected = fiat_pasta_fp_equals_zero(r) ? 0 : fiat_pasta_fp_equals(r, one) ? 1 : -1;
+      assert(fiat_pasta_fp_legendre(f) == expected);
+      assert(field_is_square(f) == (expected != -1));
+    }
+
+    // Small multiples k * f against repeated addition, including p - 1
+    for (size_t i = 0; i < 34; i++) {
+      if (i == 0) {
+        field_copy(f, minus_one);
+      } else if (i == 1) {
+        f[0] = PASTA_FP_M0 - 1;
+        f[1] = PASTA_FP_M1;
+        f[2] = 0;
+        f[3] = PASTA_M3;
+      } else {
+        sha256_hash(f, sizeof(f), t, sizeof(t));
+        t[3] &= (((uint64_t)1 << 62) - 1);
+        fiat_pasta_fp_to_montgomery(f, t);
+      }
+      field_copy(t, zero);
+      for (uint64_t k = 0; k <= 16; k++) {
+        pasta_fp_mul_small(r, f, k);
+        assert(fiat_pasta_fp_equals(r, t) && pasta_fp_is_reduced(r));
+        field_add(t, t, f);
+      }
+    }
+}
+
+// Differential test of the MULX/ADX backend against fiat
+void test_field_backends() {
+    if (!pasta_x86_64_supported()) {
+      if (_verbose) {
+        printf("MULX/ADX not supported, skipping backend comparison\n");
+      }
+      return;
+    }
+
+    // Edge values (non-montgomery): 0, 1, 2^64 - 1, m - 1 and m - 2
+    // followed by pseudo-random values below 2^254
+    const uint64_t P[4] = { 0x992d30ed00000001, 0x224698fc094cf91b, 0x0, 0x4000000000000000 };
+    const uint64_t Q[4] = { 0x8c46eb2100000001, 0x224698fc0994a8dd, 0x0, 0x4000000000000000 };
+    uint64_t fp[40][4], fq[40][4];
+    uint64_t seed[4] = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < ARRAY_LEN(fp); i++) {
+      uint64_t x[4] = { 0, 0, 0, 0 };
+      uint64_t y[4] = { 0, 0, 0, 0 };
+      if (i == 1) {
+        x[0] = y[0] = 1;
+      }
+      else if (i == 2) {
+        x[0] = y[0] = UINT64_MAX;
+      }
+      else if (i == 3 || i == 4) {
+        memcpy(x, P, sizeof(x));
+        memcpy(y, Q, sizeof(y));
+        x[0] -= i - 2;
+        y[0] -= i - 2;
+      }
+      else if (i > 4) {
+        sha256_hash(seed, sizeof(seed), seed, sizeof(seed));
+        memcpy(x, seed, sizeof(x));
+        x[3] &= (((uint64_t)1 << 62) - 1);
+        memcpy(y, x, sizeof(y));
+      }
+      fiat_pasta_fp_to_montgomery(fp[i], x);
+      fiat_pasta_fq_to_montgomery(fq[i], y);
+
+      uint64_t a[4], b[4];
+      pasta_fp_to_montgomery_adx(a, x);
+      assert(memcmp(a, fp[i], sizeof(a)) == 0);
+      pasta_fq_to_montgomery_adx(a, y);
+      assert(memcmp(a, fq[i], sizeof(a)) == 0);
+      pasta_fp_from_montgomery_adx(a, fp[i]);
+      fiat_pasta_fp_from_montgomery(b, fp[i]);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+      pasta_fq_from_montgomery_adx(a, fq[i]);
+      fiat_pasta_fq_from_montgomery(b, fq[i]);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+    }
+
+    for (size_t i = 0; i < ARRAY_LEN(fp); i++) {
+      for (size_t j = 0; j < ARRAY_LEN(fp); j++) {
+        uint64_t a[4], b[4];
+        pasta_fp_mul_adx(a, fp[i], fp[j]);
+        fiat_pasta_fp_mul(b, fp[i], fp[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+
+        pasta_fq_mul_adx(a, fq[i], fq[j]);
+        fiat_pasta_fq_mul(b, fq[i], fq[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+      }
+
+      uint64_t a[4], b[4];
+      pasta_fp_square_adx(a, fp[i]);
+      fiat_pasta_fp_square(b, fp[i]);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+      pasta_fq_square_adx(a, fq[i]);
+      fiat_pasta_fq_square(b, fq[i]);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+
+      // aliased output
+      memcpy(a, fp[i], sizeof(a));
+      pasta_fp_mul_adx(a, a, a);
+      fiat_pasta_fp_square(b, fp[i]);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+      memcpy(a, fp[i], sizeof(a));
+      pasta_fp_square_adx(a, a);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+    }
+}
+
+void test_sparse_backend() {
+    const uint64_t P[4] = { 0x992d30ed00000001, 0x224698fc094cf91b, 0x0, 0x4000000000000000 };
+    const uint64_t Q[4] = { 0x8c46eb2100000001, 0x224698fc0994a8dd, 0x0, 0x4000000000000000 };
+    const uint64_t zero[4] = { 0, 0, 0, 0 };
+    uint64_t fp[24][4], fq[24][4];
+    uint64_t seed[4] = { 1, 0, 0, 0 };
+    for (size_t i = 0; i < ARRAY_LEN(fp); i++) {
+      uint64_t x[4] = { 0, 0, 0, 0 };
+      uint64_t y[4] = { 0, 0, 0, 0 };
+      if (i == 1) {
+        x[0] = y[0] = 1;
+      }
+      else if (i == 2) {
+        memcpy(x, P, sizeof(x));
+        memcpy(y, Q, sizeof(y));
+        x[0] -= 1;
+        y[0] -= 1;
+      }
+      else if (i > 2) {
+        sha256_hash(seed, sizeof(seed), seed, sizeof(seed));
+        memcpy(x, seed, sizeof(x));
+        x[3] &= (((uint64_t)1 << 62) - 1);
+        memcpy(y, x, sizeof(y));
+      }
+      fiat_pasta_fp_to_montgomery(fp[i], x);
+      fiat_pasta_fq_to_montgomery(fq[i], y);
+    }
+
+    for (size_t i = 0; i < ARRAY_LEN(fp); i++) {
+      for (size_t j = 0; j < ARRAY_LEN(fp); j++) {
+        uint64_t a[4], b[4], lazy[4];
+
+        // inline additions match fiat
+        pasta_fp_add(a, fp[i], fp[j]);
+        fiat_pasta_fp_add(b, fp[i], fp[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+        pasta_fp_sub(a, fp[i], fp[j]);
+        fiat_pasta_fp_sub(b, fp[i], fp[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+        pasta_fq_add(a, fq[i], fq[j]);
+        fiat_pasta_fq_add(b, fq[i], fq[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+        pasta_fq_sub(a, fq[i], fq[j]);
+        fiat_pasta_fq_sub(b, fq[i], fq[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+
+        // canonical inputs give the canonical product
+        pasta_fp_mul_sparse(a, fp[i], fp[j]);
+        fiat_pasta_fp_mul(b, fp[i], fp[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+        pasta_fq_mul_sparse(a, fq[i], fq[j]);
+        fiat_pasta_fq_mul(b, fq[i], fq[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+
+        // unreduced inputs in [m, 2m) give the product up to one m
+        for (size_t k = 0, c = 0; k < 4; k++) {
+          __uint128_t t = (__uint128_t)fp[i][k] + P[k] + c;
+          lazy[k] = (uint64_t)t;
+          c = (uint64_t)(t >> 64);
+        }
+        pasta_fp_mul_sparse(a, lazy, fp[j]);
+        fiat_pasta_fp_add(a, a, zero);
+        fiat_pasta_fp_mul(b, fp[i], fp[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+        pasta_fp_mul_sparse(a, lazy, lazy);
+        fiat_pasta_fp_add(a, a, zero);
+        fiat_pasta_fp_square(b, fp[i]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+
+        for (size_t k = 0, c = 0; k < 4; k++) {
+          __uint128_t t = (__uint128_t)fq[j][k] + Q[k] + c;
+          lazy[k] = (uint64_t)t;
+          c = (uint64_t)(t >> 64);
+        }
+        pasta_fq_mul_sparse(a, fq[i], lazy);
+        fiat_pasta_fq_add(a, a, zero);
+        fiat_pasta_fq_mul(b, fq[i], fq[j]);
+        assert(memcmp(a, b, sizeof(a)) == 0);
+      }
+
+      uint64_t a[4], b[4];
+      pasta_fp_square_sparse(a, fp[i]);
+      fiat_pasta_fp_square(b, fp[i]);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+      pasta_fq_square_sparse(a, fq[i]);
+      fiat_pasta_fq_square(b, fq[i]);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+
+      // aliased output
+      memcpy(a, fp[i], sizeof(a));
+      pasta_fp_mul_sparse(a, a, a);
+      fiat_pasta_fp_square(b, fp[i]);
+      assert(memcmp(a, b, sizeof(a)) == 0);
+    }
+
+    // Whole curve arithmetic on each backend
+    const Backend backend = get_backend();
+    assert(set_backend(BACKEND_FIAT));
+    assert(get_backend() == BACKEND_FIAT);
+    assert(curve_checks());
+    assert(set_backend(BACKEND_SPARSE));
+    assert(get_backend() == BACKEND_SPARSE);
+    assert(curve_checks());
+    assert(set_backend(backend));
+}
+
+// x mod m for any x < 2^256, m = (m0, m1, 0, 2^62)
+static void mod_reduce(uint64_t r[4], const uint64_t x[4], const uint64_t m0, const uint64_t m1) {
+    const uint64_t m[4] = { m0, m1, 0, PASTA_M3 };
+    memcpy(r, x, 4 * sizeof(uint64_t));
+    while (!pasta_lt_mod(r, m0, m1)) {
+      uint64_t borrow = 0;
+      for (size_t k = 0; k < 4; k++) {
+        borrow = pasta_subborrow(&r[k], borrow, r[k], m[k]);
+      }
+    }
+}
+
+static void fp_reduce(uint64_t r[4], const uint64_t x[4]) {
+    mod_reduce(r, x, PASTA_FP_M0, PASTA_FP_M1);
+}
+
+// Lazily reduced sums and differences at the limits stated in
+// pasta_inline.h, multiplied on every backend as the second operand
+// (any value below 2^256) of pseudo-random reduced first operands, and
+// first operands in [p, 2p) against reduced second ones.  The montgomery
+// conversions take any input below 2^256 as well.
+void test_lazy_reduction() {
+    const uint64_t p[4] = { PASTA_FP_M0, PASTA_FP_M1, 0, PASTA_M3 };
+    const uint64_t p_minus_one[4] = { PASTA_FP_M0 - 1, PASTA_FP_M1, 0, PASTA_M3 };
+    const uint64_t zero[4] = { 0, 0, 0, 0 };
+    const uint64_t ones[4] = { UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX };
+    // 2^256 - p and 2^256 - p - 1
+    const uint64_t add_max[4] = { 0 - PASTA_FP_M0, ~PASTA_FP_M1, UINT64_MAX, ~PASTA_M3 };
+    const uint64_t sub_max[4] = { ~PASTA_FP_M0, ~PASTA_FP_M1, UINT64_MAX, ~PASTA_M3 };
+
+    uint64_t u[4][4], r[4];
+    pasta_fp_add_unreduced(u[0], add_max, p_minus_one); // 2^256 - 1
+    assert(memcmp(u[0], ones, sizeof(ones)) == 0);
+    pasta_fp_sub_unreduced(u[1], sub_max, zero);        // 2^256 - 1
+    assert(memcmp(u[1], ones, sizeof(ones)) == 0);
+    pasta_fp_sub_unreduced(u[2], sub_max, p_minus_one); // 2^256 - p
+    assert(memcmp(u[2], add_max, sizeof(add_max)) == 0);
+
+    uint64_t a[4], b[4], expected[4];
+    fp_reduce(a, add_max);
+    fiat_pasta_fp_add(expected, a, p_minus_one);
+    fp_reduce(r, u[0]);
+    assert(memcmp(r, expected, sizeof(r)) == 0);
+    fp_reduce(a, sub_max);
+    fiat_pasta_fp_sub(expected, a, zero);
+    fp_reduce(r, u[1]);
+    assert(memcmp(r, expected, sizeof(r)) == 0);
+    fiat_pasta_fp_sub(expected, a, p_minus_one);
+    fp_reduce(r, u[2]);
+    assert(memcmp(r, expected, sizeof(r)) == 0);
+
+    const Backend backend = get_backend();
+    const Backend backends[] = { BACKEND_FIAT, BACKEND_SPARSE, BACKEND_ADX };
+    for (size_t n = 0; n < ARRAY_LEN(backends); n++) {
+      if (!set_backend(backends[n])) {
+        continue;
+      }
+      uint64_t seed[4] = { 7, 0, 0, 0 };
+      for (size_t i = 0; i < 4096; i++) {
+        uint64_t x[4], y[4];
+        sha256_hash(seed, sizeof(seed), seed, sizeof(seed));
+        memcpy(u[3], seed, sizeof(seed));                     // any value
+        sha256_hash(seed, sizeof(seed), seed, sizeof(seed));
+        fp_reduce(x, seed);
+        sha256_hash(seed, sizeof(seed), seed, sizeof(seed));
+        fp_reduce(y, seed);
+
+        // unreduced second operand
+        for (size_t j = 0; j < ARRAY_LEN(u); j++) {
+          fp_reduce(b, u[j]);
+          fiat_pasta_fp_mul(expected, x, b);
+          pasta_fp_mul(r, x, u[j]);
+          assert(memcmp(r, expected, sizeof(r)) == 0);
+        }
+
+        // first operand in [p, 2p)
+        pasta_fp_add_unreduced(a, x, p);
+        fiat_pasta_fp_mul(expected, x, y);
+        pasta_fp_mul(r, a, y);
+        assert(memcmp(r, expected, sizeof(r)) == 0);
+
+        // conversions
+        fp_reduce(b, u[3]);
+        fiat_pasta_fp_to_montgomery(expected, b);
+        pasta_fp_to_montgomery(r, u[3]);
+        assert(memcmp(r, expected, sizeof(r)) == 0);
+        fiat_pasta_fp_from_montgomery(expected, b);
+        pasta_fp_from_montgomery(r, u[3]);
+        assert(memcmp(r, expected, sizeof(r)) == 0);
+        mod_reduce(b, u[3], PASTA_FQ_M0, PASTA_FQ_M1);
+        fiat_pasta_fq_to_montgomery(expected, b);
+        pasta_fq_to_montgomery(r, u[3]);
+        assert(memcmp(r, expected, sizeof(r)) == 0);
+        fiat_pasta_fq_from_montgomery(expected, b);
+        pasta_fq_from_montgomery(r, u[3]);
+        assert(memcmp(r, expected, sizeof(r)) == 0);
+      }
+    }
+    assert(set_backend(backend));
+}
+
+// Four-lane field arithmetic against fiat (lanes mixing 0, 1, m - 1 and
+// pseudo-random elements, through chains of lazily reduced results), and
+// the batch point kernels with and without it
+void test_avx2_backend() {
+    const uint64_t P[4] = { 0x992d30ed00000001, 0x224698fc094cf91b, 0x0, 0x4000000000000000 };
+    uint64_t fp[16][4];
+    uint64_t seed[4] = { 2, 0, 0, 0 };
+    for (size_t i = 0; i < ARRAY_LEN(fp); i++) {
+      uint64_t x[4] = { 0, 0, 0, 0 };
+      if (i == 1) {
+        x[0] = 1;
+      }
+      else if (i == 2) {
+        memcpy(x, P, sizeof(x));
+        x[0] -= 1;
+      }
+      else if (i > 2) {
+        sha256_hash(seed, sizeof(seed), seed, sizeof(seed));
+        memcpy(x, seed, sizeof(x));
+        x[3] &= (((uint64_t)1 << 62) - 1);
+      }
+      fiat_pasta_fp_to_montgomery(fp[i], x);
+    }
+
+    const bool use_avx2 = pasta_use_avx2;
+    assert(use_avx2 == pasta_avx2_supported());
+    for (size_t i = 0; i < ARRAY_LEN(fp); i++) {
+      uint64_t a[PASTA_FP4_LANES][4], b[PASTA_FP4_LANES][4], c[4];
+      const uint64_t *x[PASTA_FP4_LANES], *y[PASTA_FP4_LANES];
+      uint64_t *out[PASTA_FP4_LANES];
+      for (size_t l = 0; l < PASTA_FP4_LANES; l++) {
+        memcpy(b[l], fp[(i + 3 * l) % ARRAY_LEN(fp)], sizeof(b[l]));
+        x[l] = fp[(i + l) % ARRAY_LEN(fp)];
+        y[l] = b[l];
+        out[l] = a[l];
+      }
+
+      PastaFp4 u, v, w;
+      pasta_fp4_pack(&u, x);
+      pasta_fp4_pack(&v, y);
+      pasta_fp4_unpack(out, &u);
+      for (size_t l = 0; l < PASTA_FP4_LANES; l++) {
+        assert(memcmp(a[l], x[l], sizeof(a[l])) == 0);
+      }
+      // fp[0] is zero, in lane (16 - i) % 16
+      const size_t zero_lane = (ARRAY_LEN(fp) - i) % ARRAY_LEN(fp);
+      assert(pasta_fp4_is_zero(&u) == (zero_lane < PASTA_FP4_LANES ? 1u << zero_lane : 0));
+
+      // w = ((x * y + x) - y)^2 * 15, and lane by lane on fiat
+      pasta_fp4_mul(&w, &u, &v);
+      pasta_fp4_add(&w, &w, &u);
+      pasta_fp4_sub(&w, &w, &v);
+      pasta_fp4_sq(&w, &w);
+      pasta_fp4_mul_small(&w, &w, 15);
+      pasta_fp4_unpack(out, &w);
+      for (size_t l = 0; l < PASTA_FP4_LANES; l++) {
+        fiat_pasta_fp_mul(c, x[l], y[l]);
+        fiat_pasta_fp_add(c, c, x[l]);
+        fiat_pasta_fp_sub(c, c, y[l]);
+        fiat_pasta_fp_square(c, c);
+        uint64_t k[4] = { 15, 0, 0, 0 };
+        fiat_pasta_fp_to_montgomery(k, k);
+        fiat_pasta_fp_mul(c, c, k);
+        assert(memcmp(a[l], c, sizeof(c)) == 0);
+      }
+
+      // x - x is zero in every lane, select takes y in lanes 1 and 2
+      pasta_fp4_sub(&w, &u, &u);
+      assert(pasta_fp4_is_zero(&w) == PASTA_FP4_ALL);
+      pasta_fp4_select(&w, 6, &u, &v);
+      pasta_fp4_unpack(out, &w);
+      for (size_t l = 0; l < PASTA_FP4_LANES; l++) {
+        assert(memcmp(a[l], (l == 1 || l == 2) ? y[l] : x[l], sizeof(a[l])) == 0);
+      }
+    }
+
+    // Batch point kernels four lanes at a time and lane by lane: keys and
+    // scalars zero, one and -1, the zero point and a repeated point
+    Scalar k[11], one;
+    Affine p[11], r[2][11], pubs[2][11], t;
+    uint64_t words[4] = { 3, 0, 0, 0 };
+    assert(scalar_from_hex(one, "0100000000000000000000000000000000000000000000000000000000000000"));
+    for (size_t i = 0; i < ARRAY_LEN(k); i++) {
+      sha256_hash(words, sizeof(words), words, sizeof(words));
+      words[3] &= (((uint64_t)1 << 62) - 1);
+      scalar_from_words(k[i], words);
+      p[i] = A[i % EPOCHS][i % 3];
+    }
+    explicit_bzero(k[1], sizeof(k[1]));
+    scalar_copy(k[2], one);
+    scalar_negate(k[5], one);
+    explicit_bzero(&p[6], sizeof(p[6]));
+    p[7] = p[3];
+    for (size_t pass = 0; pass < 2; pass++) {
+      pasta_use_avx2 = pass == 0 ? use_avx2 : false;
+      affine_scalar_mul_batch(r[pass], k, p, ARRAY_LEN(k));
+      generate_pubkeys(pubs[pass], k, ARRAY_LEN(k));
+    }
+    pasta_use_avx2 = use_avx2;
+    for (size_t i = 0; i < ARRAY_LEN(k); i++) {
+      affine_scalar_mul(&t, k[i], &p[i]);
+      assert(memcmp(&r[0][i], &t, sizeof(t)) == 0);
+      assert(memcmp(&r[1][i], &t, sizeof(t)) == 0);
+      assert(memcmp(&pubs[0][i], &pubs[1][i], sizeof(t)) == 0);
+    }
+}
+
+// wNAF scalar multiplication against repeated addition for small
+// scalars (all digit patterns of the first windows) and k = q - 1, and
+// the fixed-base comb against it
+void test_scalar_mul() {
+    Scalar k, one;
+    Affine acc, r, neg;
+    explicit_bzero(k, sizeof(k));
+    assert(scalar_from_hex(one, "0100000000000000000000000000000000000000000000000000000000000000"));
+
+    affine_scalar_mul(&r, k, &A[0][0]);
+    assert(fiat_pasta_fp_equals_zero(r.x) && fiat_pasta_fp_equals_zero(r.y));
+
+    acc = A[0][0];
+    for (size_t i = 1; i <= 80; i++) {
+      scalar_add(k, k, one);
+      affine_scalar_mul(&r, k, &A[0][0]);
+      assert(affine_eq(&r, &acc));
+      affine_add(&acc, &acc, &A[0][0]);
+    }
+
+    scalar_negate(k, one);
+    affine_scalar_mul(&r, k, &A[1][0]);
+    affine_negate(&neg, &A[1][0]);
+    assert(affine_eq(&r, &neg));
+
+    // Constant time fixed-base multiplication (generate_pubkey) against the
+    // generic multiplication
+    Affine g;
+    generate_pubkey(&g, one);
+    assert(affine_is_on_curve(&g));
+    for (size_t i = 0; i < 2 * EPOCHS + 2; i++) {
+      if (i < 2 * EPOCHS) {
+        scalar_copy(k, S[i / 2][i % 2]);
+      }
+      else if (i == 2 * EPOCHS) {
+        scalar_negate(k, one);
+      }
+      else {
+        scalar_add(k, one, one);
+      }
+      generate_pubkey(&r, k);
+      affine_scalar_mul(&acc, k, &g);
+      assert(affine_eq(&r, &acc));
+    }
+    explicit_bzero(k, sizeof(k));
+    generate_pubkey(&r, k);
+    assert(fiat_pasta_fp_equals_zero(r.x) && fiat_pasta_fp_equals_zero(r.y));
+
+    // GLV splits of pseudo-random scalars (both signs of both halves)
+    uint64_t words[4] = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < 32; i++) {
+      sha256_hash(words, sizeof(words), words, sizeof(words));
+      words[3] &= (((uint64_t)1 << 62) - 1);
+      scalar_from_words(k, words);
+      generate_pubkey(&r, k);
+      affine_scalar_mul(&acc, k, &g);
+      assert(affine_eq(&r, &acc));
+    }
+
+    // Batch derivation (complete formulas) against generate_pubkey, over
+    // two full batches and a partial one, with zero, one and -1 keys
+    Scalar keys[19];
+    Affine pubs[19];
+    for (size_t i = 0; i < ARRAY_LEN(keys); i++) {
+      sha256_hash(words, sizeof(words), words, sizeof(words));
+      words[3] &= (((uint64_t)1 << 62) - 1);
+      scalar_from_words(keys[i], words);
+    }
+    explicit_bzero(keys[0], sizeof(keys[0]));
+    scalar_copy(keys[9], one);
+    scalar_negate(keys[17], one);
+    generate_pubkeys(pubs, keys, 0);
+    generate_pubkeys(pubs, keys, ARRAY_LEN(keys));
+    Affine zero = { { 0 }, { 0 } };
+    assert(memcmp(&pubs[0], &zero, sizeof(zero)) == 0);
+    for (size_t i = 1; i < ARRAY_LEN(keys); i++) {
+      generate_pubkey(&r, keys[i]);
+      assert(affine_eq(&pubs[i], &r));
+    }
+}
+
+// Jacobian group API against the affine one, with equality across
+// different projective representations of the same point
+void test_group() {
+    Group p[3], t, u, v, zero;
+    Affine a, b;
+    for (size_t i = 0; i < 3; i++) {
+      affine_to_group(&p[i], &A[0][i]);
+    }
+
+    // (A0 + A1) + A2 == A0 + (A1 + A2) == T4
+    group_add(&t, &p[0], &p[1]);
+    group_add(&u, &t, &p[2]);
+    group_add(&t, &p[1], &p[2]);
+    group_add(&v, &p[0], &t);
+    assert(group_eq(&u, &v));
+    assert(group_is_on_curve(&u));
+    affine_from_group(&a, &u);
+    assert(affine_eq(&a, &T[0][4]));
+
+    // 2 (A0 + A1) via doubling and via addition of the two sums
+    group_add(&t, &p[0], &p[1]);
+    group_add(&u, &p[1], &p[0]);
+    assert(group_eq(&t, &u));
+    group_add(&v, &t, &u);
+    group_dbl(&u, &t);
+    assert(group_eq(&u, &v));
+    assert(!group_eq(&u, &t));
+
+    // t + t and t - t with the second operand rescaled to
+    // (l^2 X : l^3 Y : l Z), so the coordinates differ
+    Field l, l2;
+    assert(field_from_hex(l, "0300000000000000000000000000000000000000000000000000000000000000"));
+    field_sq(l2, l);
+    field_mul(u.X, t.X, l2);
+    field_mul(l2, l2, l);
+    field_mul(u.Y, t.Y, l2);
+    field_mul(u.Z, t.Z, l);
+    assert(group_eq(&t, &u) && memcmp(&t, &u, sizeof(t)) != 0);
+    group_add(&v, &t, &u);
+    group_dbl(&zero, &t);
+    assert(group_eq(&v, &zero));
+    group_add(&v, &u, &t);
+    assert(group_eq(&v, &zero));
+    group_negate(&u, &u);
+    group_add(&v, &t, &u);
+    assert(group_is_zero(&v));
+
+    // t - t = 0, -A0 against affine_negate
+    group_negate(&u, &t);
+    group_add(&v, &t, &u);
+    assert(group_is_zero(&v));
+    group_one(&zero);
+    assert(!group_eq(&v, &zero));
+    group_negate(&zero, &v);
+    assert(group_eq(&v, &zero));
+    group_negate(&u, &p[0]);
+    affine_negate(&a, &A[0][0]);
+    affine_from_group(&b, &u);
+    assert(affine_eq(&a, &b) && affine_is_on_curve(&a));
+    affine_from_group(&a, &v);
+    affine_negate(&b, &a);
+    assert(affine_eq(&a, &b) && affine_is_on_curve(&a));
+
+    // S0 * A1 == T2
+    group_scalar_mul(&u, S[0][0], &p[1]);
+    affine_from_group(&a, &u);
+    assert(affine_eq(&a, &T[0][2]));
+}
+
+// Pippenger MSM against the sum of single scalar multiplications, for
+// sizes covering several window widths and the threaded path; the
+// inputs include a zero scalar, the point at infinity and repeated and
+// opposite points (bucket doublings and cancellations)
+void test_msm() {
+    static Scalar k[300];
+    static Affine P[300];
+    const size_t sizes[] = { 0, 1, 7, 40, 300 };
+
+    uint64_t words[4] = { 1, 0, 0, 0 };
+    for (size_t i = 0; i < ARRAY_LEN(P); i++) {
+      sha256_hash(words, sizeof(words), words, sizeof(words));
+      words[3] &= (((uint64_t)1 << 62) - 1);
+      scalar_from_words(k[i], words);
+      if (i < 16) {
+        generate_pubkey(&P[i], k[i]);
+      }
+      else {
+        P[i] = P[i % 16];
+        if (i % 3 == 0) {
+          affine_negate(&P[i], &P[i]);
+        }
+      }
+    }
+    explicit_bzero(k[3], sizeof(k[3]));
+    explicit_bzero(&P[5], sizeof(P[5]));
+    scalar_copy(k[20], k[4]); // P[20] = P[4]
+    scalar_copy(k[33], k[1]); // P[33] = -P[1]
+    scalar_copy(k[17], k[1]); // P[17] = P[1]
+
+    for (size_t s = 0; s < ARRAY_LEN(sizes); s++) {
+      const size_t n = sizes[s];
+      Affine expected = { { 0 }, { 0 } }, t;
+      for (size_t i = 0; i < n; i++) {
+        affine_scalar_mul(&t, k[i], &P[i]);
+        affine_add(&expected, &expected, &t);
+      }
+
+      Group g;
+      Affine result;
+      group_msm(&g, k, P, n);
+      group_batch_to_affine(&result, &g, 1);
+      assert(affine_eq(&result, &expected));
+    }
+
+    // 1*P + 2*P + 3*P: the bucket sums meet 3P in two different
+    // projective representations
+    Affine expected, result;
+    Group g;
+    for (size_t i = 0; i < 3; i++) {
+      const uint64_t small[4] = { i + 1, 0, 0, 0 };
+      scalar_from_words(k[i], small);
+      P[i] = P[0];
+    }
+    const uint64_t six[4] = { 6, 0, 0, 0 };
+    scalar_from_words(k[3], six);
+    affine_scalar_mul(&expected, k[3], &P[0]);
+    group_msm(&g, k, P, 3);
+    group_batch_to_affine(&result, &g, 1);
+    assert(affine_eq(&result, &expected));
+}
+
+// Batch verification agrees with verify: all valid, and a single bad
+// signature (modified amount) is found by the fallback
+void test_verify_batch() {
+    Keypair kp[6];
+    Compressed pubs[6];
+    Transaction txns[6];
+    Signature sigs[6];
+    bool valid[6];
+
+    uint64_t words[4] = { 2, 0, 0, 0 };
+    for (size_t i = 0; i < ARRAY_LEN(kp); i++) {
+      sha256_hash(words, sizeof(words), words, sizeof(words));
+      words[3] &= (((uint64_t)1 << 62) - 1);
+      scalar_from_words(kp[i].priv, words);
+      generate_pubkey(&kp[i].pub, kp[i].priv);
+      compress(&pubs[i], &kp[i].pub);
+
+      Transaction *txn = &txns[i];
+      prepare_memo(txn->memo, "batch");
+      txn->fee = 3;
+      txn->fee_token = DEFAULT_TOKEN_ID;
+      txn->fee_payer_pk = pubs[i];
+      txn->nonce = i;
+      txn->valid_until = 10000;
+      txn->tag[0] = 0;
+      txn->tag[1] = 0;
+      txn->tag[2] = 0;
+      txn->source_pk = pubs[i];
+      txn->receiver_pk = pubs[0];
+      txn->token_id = DEFAULT_TOKEN_ID;
+      txn->amount = 1000 + i;
+      txn->token_locked = false;
+      sign(&sigs[i], &kp[i], txn, TESTNET_ID);
+    }
+
+    assert(verify_batch(NULL, sigs, pubs, txns, 0, TESTNET_ID));
+    assert(verify_batch(valid, sigs, pubs, txns, ARRAY_LEN(sigs), TESTNET_ID));
+    for (size_t i = 0; i < ARRAY_LEN(sigs); i++) {
+      assert(valid[i]);
+    }
+
+    // Wrong network and a tampered transaction
+    assert(!verify_batch(NULL, sigs, pubs, txns, ARRAY_LEN(sigs), MAINNET_ID));
+    txns[4].amount++;
+    assert(!verify_batch(valid, sigs, pubs, txns, ARRAY_LEN(sigs), TESTNET_ID));
+    for (size_t i = 0; i < ARRAY_LEN(sigs); i++) {
+      assert(valid[i] == (i != 4));
+      assert(valid[i] == verify(&sigs[i], &pubs[i], &txns[i], TESTNET_ID));
+    }
+}
+
+void test_batch_inv() {
+    Field f[5], f_inv[5], t;
+    Scalar s[5], s_inv[5], u;
+
+    // Pseudo-random inputs with zeros at both ends and in the middle
+    explicit_bzero(t, sizeof(t));
+    for (size_t i = 0; i < ARRAY_LEN(f); i++) {
+      sha256_hash(t, sizeof(t), t, sizeof(t));
+      t[3] &= (((uint64_t)1 << 62) - 1);
+      fiat_pasta_fp_to_montgomery(f[i], t);
+      scalar_from_words(s[i], t);
+    }
+    explicit_bzero(f[0], sizeof(f[0]));
+    explicit_bzero(f[2], sizeof(f[2]));
+    explicit_bzero(s[4], sizeof(s[4]));
+
+    field_batch_inv(f_inv, f, ARRAY_LEN(f));
+    scalar_batch_inv(s_inv, s, ARRAY_LEN(s));
+    for (size_t i = 0; i < ARRAY_LEN(f); i++) {
+      field_inv(t, f[i]);
+      assert(fiat_pasta_fp_equals(t, f_inv[i]));
+      scalar_inv(u, s[i]);
+      assert(scalar_eq(u, s_inv[i]));
+    }
+
+    // Leading zeros, a single non-zero entry, all zeros and n = 0
+    for (size_t n = 0; n <= 3; n++) {
+      memset(f_inv, 0xff, sizeof(f_inv));
+      memset(s_inv, 0xff, sizeof(s_inv));
+      field_batch_inv(f_inv, f, n);
+      scalar_batch_inv(s_inv, &s[2], n);
+      for (size_t i = 0; i < n; i++) {
+        field_inv(t, f[i]);
+        assert(fiat_pasta_fp_equals(t, f_inv[i]));
+        scalar_inv(u, s[2 + i]);
+        assert(scalar_eq(u, s_inv[i]));
+      }
+      assert(f_inv[n][0] == UINT64_MAX && s_inv[n][0] == UINT64_MAX);
+    }
+    field_batch_inv(f_inv, f, 1);
+    assert(fiat_pasta_fp_equals_zero(f_inv[0]));
+    scalar_batch_inv(s_inv, &s[4], 1);
+    assert(scalar_eq(s_inv[0], s[4]));
+    field_batch_inv(f_inv, &f[1], 1);
+    field_inv(t, f[1]);
+    assert(fiat_pasta_fp_equals(t, f_inv[0]));
+
+    // Batch affine conversion of points with random Z, including infinity
+    Group g[4];
+    Affine a[4];
+    for (size_t i = 0; i < ARRAY_LEN(g); i++) {
+      Field z, z2;
+      field_copy(z, f[i + 1]);
+      if (i == 1) {
+        explicit_bzero(z, sizeof(z));
+      }
+      field_mul(z2, z, z);
+      field_mul(g[i].X, A[i][0].x, z2);
+      field_mul(z2, z2, z);
+      field_mul(g[i].Y, A[i][0].y, z2);
+      field_copy(g[i].Z, z);
+    }
+    group_batch_to_affine(a, g, ARRAY_LEN(g));
+    for (size_t i = 0; i < ARRAY_LEN(g); i++) {
+      if (i == 1) {
+        assert(fiat_pasta_fp_equals_zero(a[i].x) && fiat_pasta_fp_equals_zero(a[i].y));
+        continue;
+      }
+      assert(affine_eq(&a[i], &A[i][0]));
+    }
+
+    // starting at infinity, and infinity only
+    group_batch_to_affine(a, &g[1], ARRAY_LEN(g) - 1);
+    assert(fiat_pasta_fp_equals_zero(a[0].x) && fiat_pasta_fp_equals_zero(a[0].y));
+    for (size_t i = 1; i < ARRAY_LEN(g) - 1; i++) {
+      assert(affine_eq(&a[i], &A[i + 1][0]));
+    }
+    memset(a, 0xff, sizeof(a));
+    group_batch_to_affine(a, &g[1], 1);
+    assert(fiat_pasta_fp_equals_zero(a[0].x) && fiat_pasta_fp_equals_zero(a[0].y));
+    assert(a[1].x[0] == UINT64_MAX);
 }
 
 void test_poseidon() {
@@ -723,6 +1702,142 @@ void test_poseidon() {
       5,
       "09a2d55277908b7c8214f745b3605f0f9055dcd4c9b594cdd759292c34c3a20c"
     );
+
+    // poseidon_hash_many against one sponge per message, for messages of
+    // 0 to 11 elements (full and partial lane groups), with and without
+    // the four-lane vectors
+    Field msgs[11][12];
+    const Field *inputs[11];
+    size_t lens[11];
+    uint64_t words[4] = { 4, 0, 0, 0 };
+    for (size_t i = 0; i < ARRAY_LEN(msgs); i++) {
+      for (size_t j = 0; j < ARRAY_LEN(msgs[i]); j++) {
+        sha256_hash(words, sizeof(words), words, sizeof(words));
+        words[3] &= (((uint64_t)1 << 62) - 1);
+        fiat_pasta_fp_to_montgomery(msgs[i][j], words);
+      }
+      inputs[i] = msgs[i];
+      lens[i] = (7 * i) % 12;
+    }
+    const bool use_avx2 = pasta_use_avx2;
+    for (size_t pass = 0; pass < 2 * 2 * 2; pass++) {
+      const uint8_t type = pass & 1 ? POSEIDON_KIMCHI : POSEIDON_LEGACY;
+      const uint8_t network_id = pass & 2 ? MAINNET_ID : NULLNET_ID;
+      pasta_use_avx2 = pass & 4 ? false : use_avx2;
+
+      Scalar outs[11], expected;
+      assert(poseidon_hash_many(outs, inputs, lens, ARRAY_LEN(outs), type, network_id));
+      for (size_t i = 0; i < ARRAY_LEN(outs); i++) {
+        PoseidonCtx ctx;
+        assert(poseidon_init(&ctx, type, network_id));
+        poseidon_update(&ctx, inputs[i], lens[i]);
+        poseidon_digest(expected, &ctx);
+        assert(memcmp(outs[i], expected, sizeof(expected)) == 0);
+      }
+    }
+    pasta_use_avx2 = use_avx2;
+    assert(!poseidon_hash_many(NULL, inputs, lens, 0, 2, NULLNET_ID));
+}
+
+// Snapshots and clones continue like the original sponge, the prefix
+// sponge matches hashing from scratch, and signing and verification give
+// the same results with the prefix cache (hits, misses and evictions
+// counted) as without it
+void test_poseidon_prefix_cache() {
+    Field msg[7];
+    uint64_t words[4] = { 5, 0, 0, 0 };
+    for (size_t i = 0; i < ARRAY_LEN(msg); i++) {
+      sha256_hash(words, sizeof(words), words, sizeof(words));
+      words[3] &= (((uint64_t)1 << 62) - 1);
+      fiat_pasta_fp_to_montgomery(msg[i], words);
+    }
+
+    for (uint8_t type = POSEIDON_LEGACY; type <= POSEIDON_KIMCHI; type++) {
+      PoseidonCtx ctx, copy, resumed;
+      PoseidonSnapshot snap;
+      Scalar expected, a, b, c;
+      assert(poseidon_init(&ctx, type, MAINNET_ID));
+      poseidon_update(&ctx, msg, ARRAY_LEN(msg));
+      poseidon_digest(expected, &ctx);
+
+      assert(poseidon_init(&ctx, type, MAINNET_ID));
+      poseidon_update(&ctx, msg, 3);
+      poseidon_clone(&copy, &ctx);
+      poseidon_snapshot(&snap, &ctx);
+      poseidon_update(&ctx, msg + 3, ARRAY_LEN(msg) - 3);
+      poseidon_digest(a, &ctx);
+      poseidon_update(&copy, msg + 3, ARRAY_LEN(msg) - 3);
+      poseidon_digest(b, &copy);
+      assert(poseidon_restore(&resumed, &snap));
+      poseidon_update(&resumed, msg + 3, ARRAY_LEN(msg) - 3);
+      poseidon_digest(c, &resumed);
+      assert(memcmp(a, expected, sizeof(a)) == 0);
+      assert(memcmp(b, expected, sizeof(b)) == 0);
+      assert(memcmp(c, expected, sizeof(c)) == 0);
+
+      // with the cache off, then on (a miss and a hit)
+      for (size_t pass = 0; pass < 3; pass++) {
+        if (pass == 1) {
+          assert(poseidon_prefix_cache_enable(4));
+        }
+        assert(poseidon_init_prefix(&ctx, type, MAINNET_ID, msg));
+        poseidon_update(&ctx, msg + POSEIDON_PREFIX_LEN, ARRAY_LEN(msg) - POSEIDON_PREFIX_LEN);
+        poseidon_digest(a, &ctx);
+        assert(memcmp(a, expected, sizeof(a)) == 0);
+      }
+      uint64_t hits, misses;
+      poseidon_prefix_cache_stats(&hits, &misses);
+      assert(hits == 1 && misses == 1);
+      poseidon_prefix_cache_disable();
+      assert(!poseidon_prefix_cache_enabled());
+    }
+
+    // Payments from three senders to one receiver, signed and verified
+    // without the cache, and again with room for two senders only
+    Keypair kp[3];
+    Compressed pubs[3];
+    Transaction txns[6];
+    Signature sigs[6], cached;
+    for (size_t i = 0; i < ARRAY_LEN(kp); i++) {
+      sha256_hash(words, sizeof(words), words, sizeof(words));
+      words[3] &= (((uint64_t)1 << 62) - 1);
+      scalar_from_words(kp[i].priv, words);
+      generate_pubkey(&kp[i].pub, kp[i].priv);
+      compress(&pubs[i], &kp[i].pub);
+    }
+    for (size_t i = 0; i < ARRAY_LEN(txns); i++) {
+      Transaction *txn = &txns[i];
+      prepare_memo(txn->memo, "prefix");
+      txn->fee = 3;
+      txn->fee_token = DEFAULT_TOKEN_ID;
+      txn->fee_payer_pk = pubs[i % 3];
+      txn->nonce = i;
+      txn->valid_until = 10000;
+      txn->tag[0] = 0;
+      txn->tag[1] = 0;
+      txn->tag[2] = 0;
+      txn->source_pk = pubs[i % 3];
+      txn->receiver_pk = pubs[0];
+      txn->token_id = DEFAULT_TOKEN_ID;
+      txn->amount = 1000 + i;
+      txn->token_locked = false;
+      sign(&sigs[i], &kp[i % 3], txn, TESTNET_ID);
+    }
+
+    assert(poseidon_prefix_cache_enable(2));
+    for (size_t i = 0; i < ARRAY_LEN(txns); i++) {
+      sign(&cached, &kp[i % 3], &txns[i], TESTNET_ID);
+      assert(memcmp(&cached, &sigs[i], sizeof(cached)) == 0);
+      assert(verify(&cached, &pubs[i % 3], &txns[i], TESTNET_ID));
+    }
+    // senders cycle 0 1 2 0 1 2: each sign misses (the sender was the
+    // least recently used and got evicted) and the verify after it hits
+    uint64_t hits, misses;
+    poseidon_prefix_cache_stats(&hits, &misses);
+    assert(hits == ARRAY_LEN(txns) && misses == ARRAY_LEN(txns));
+    txns[1].amount++;
+    assert(!verify(&sigs[1], &pubs[1], &txns[1], TESTNET_ID));
+    poseidon_prefix_cache_disable();
 }
 
 void test_get_address() {
@@ -945,12 +2060,32 @@ int main(int argc, char* argv[]) {
     assert(!decompress(&pub, &bad_pk));
   }
 
+  test_field_backends();
+
+  test_sparse_backend();
+
+  test_lazy_reduction();
+
+  test_avx2_backend();
+
   test_scalars();
 
   test_fields();
 
+  test_batch_inv();
+
+  test_scalar_mul();
+
+  test_group();
+
+  test_msm();
+
+  test_verify_batch();
+
   test_poseidon();
 
+  test_poseidon_prefix_cache();
+
   test_get_address();
 
   test_sign_tx();